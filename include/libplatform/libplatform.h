@@ -6,6 +6,7 @@
 #define V8_LIBPLATFORM_LIBPLATFORM_H_
 
 #include <memory>
+#include <vector>
 
 #include "libplatform/libplatform-export.h"
 #include "libplatform/v8-tracing.h"
@@ -100,6 +101,26 @@ V8_PLATFORM_EXPORT void SetTracingController(
 V8_PLATFORM_EXPORT void NotifyIsolateShutdown(v8::Platform* platform,
                                               Isolate* isolate);
 
+/**
+ * Restricts the worker threads of the given platform to run only on the
+ * given logical processors: worker thread i runs on the processors in
+ * |cpu_sets[i % cpu_sets.size()]|. Passing a single set, e.g. the result of
+ * GetNumaNodeProcessors, keeps all background work such as concurrent marking
+ * and sweeping on one NUMA node; passing one processor per set pins each
+ * worker thread. Returns false if the affinity could not be set for every
+ * worker thread, e.g. because the operating system does not support it.
+ *
+ * The |platform| has to be created using |NewDefaultPlatform|.
+ */
+V8_PLATFORM_EXPORT bool SetWorkerThreadAffinity(
+    v8::Platform* platform, const std::vector<std::vector<int>>& cpu_sets);
+
+/**
+ * Returns the logical processors of the given NUMA node, or an empty vector
+ * if the node or the system topology is unknown.
+ */
+V8_PLATFORM_EXPORT std::vector<int> GetNumaNodeProcessors(int node);
+
 }  // namespace platform
 }  // namespace v8
 
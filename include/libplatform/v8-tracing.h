@@ -238,9 +238,20 @@ class V8_PLATFORM_EXPORT TracingController
   ~TracingController() override;
 
 #if defined(V8_USE_PERFETTO)
+  enum class OutputFormat {
+    // The trace is converted to the JSON trace event format when tracing
+    // stops.
+    kJSON,
+    // The binary Perfetto protobuf trace is written as it was recorded. This
+    // avoids the costly conversion and can be loaded into ui.perfetto.dev or
+    // trace_processor.
+    kProto
+  };
+
   // Must be called before StartTracing() if V8_USE_PERFETTO is true. Provides
-  // the output stream for the JSON trace data.
-  void InitializeForPerfetto(std::ostream* output_stream);
+  // the output stream for the trace data, written in |format|.
+  void InitializeForPerfetto(std::ostream* output_stream,
+                             OutputFormat format = OutputFormat::kJSON);
   // Provide an optional listener for testing that will receive trace events.
   // Must be called before StartTracing().
   void SetTraceEventListenerForTesting(TraceEventListener* listener);
@@ -310,6 +321,7 @@ class V8_PLATFORM_EXPORT TracingController
 
 #if defined(V8_USE_PERFETTO)
   std::ostream* output_stream_ = nullptr;
+  OutputFormat output_format_ = OutputFormat::kJSON;
   std::unique_ptr<perfetto::trace_processor::TraceProcessorStorage>
       trace_processor_;
   TraceEventListener* listener_for_testing_ = nullptr;
@@ -122,6 +122,11 @@
  *  - bool
  *  - int32_t
  *  - uint32_t
+ *  - FastApiArrayBufferView*, for typed arrays and DataViews
+ *  - FastOneByteString*, for sequential one-byte strings
+ * If an argument of the last two kinds does not have the expected type, e.g.
+ * because a string is a two-byte or cons string, or because the buffer was
+ * detached, the slow callback is called instead.
  * To be supported types:
  *  - int64_t
  *  - uint64_t
@@ -153,6 +158,8 @@ class CTypeInfo {
     kFloat32,
     kFloat64,
     kV8Value,
+    kArrayBufferView,
+    kOneByteString,
   };
 
   enum class ArgFlags : uint8_t {
@@ -219,6 +226,25 @@ struct ApiObject {
   uintptr_t address;
 };
 
+/**
+ * A typed array or DataView passed to a fast API call. {data} points to the
+ * first byte of the view and may point into the V8 heap, so it must not be
+ * retained beyond the call.
+ */
+struct FastApiArrayBufferView {
+  void* data;
+  size_t byte_length;
+};
+
+/**
+ * A sequential one-byte string passed to a fast API call. The characters are
+ * not null-terminated and must not be retained beyond the call.
+ */
+struct FastOneByteString {
+  const char* data;
+  uint32_t length;
+};
+
 namespace internal {
 
 template <typename T>
@@ -248,6 +274,8 @@ struct GetCType {
   V(ApiObject, kV8Value)
 
 SUPPORTED_C_TYPES(SPECIALIZE_GET_C_TYPE_FOR)
+SPECIALIZE_GET_C_TYPE_FOR(FastApiArrayBufferView*, kArrayBufferView)
+SPECIALIZE_GET_C_TYPE_FOR(FastOneByteString*, kOneByteString)
 
 // T* where T is a primitive (array of primitives).
 template <typename T, typename = void>
@@ -10,6 +10,144 @@
 namespace v8 {
 namespace metrics {
 
+struct FunctionDeoptimized {
+  // Static string describing the deoptimization reason, e.g. "not a Smi".
+  const char* reason = nullptr;
+  bool eager = false;
+  bool soft = false;
+  bool lazy = false;
+  // Whether the optimized code was thrown away. Soft deopts may keep using
+  // the code for up to --reuse-opt-code-count deoptimizations.
+  bool code_discarded = false;
+  // Identify the deoptimized function, so that embedders can aggregate
+  // deoptimizations per function. The script id is -1 for functions without
+  // a script.
+  int script_id = -1;
+  int function_start_position = -1;
+};
+
+// Phases of creating a context with v8::Context::New. Phases that did not
+// run are reported as -1.
+struct ContextCreated {
+  bool from_snapshot = false;
+  int64_t context_deserialization_wall_clock_duration_in_us = -1;
+  // Building the builtin objects from scratch, when no context snapshot is
+  // available.
+  int64_t bootstrapping_wall_clock_duration_in_us = -1;
+  // Setting up the global object from the global template.
+  int64_t global_object_setup_wall_clock_duration_in_us = -1;
+  int64_t experimental_globals_wall_clock_duration_in_us = -1;
+  int64_t extensions_wall_clock_duration_in_us = -1;
+  int64_t total_wall_clock_duration_in_us = -1;
+};
+
+struct FeedbackBecameMegamorphic {
+  // Static string naming the kind of the feedback slot, e.g. "LoadProperty".
+  const char* slot_kind = nullptr;
+  // Identify the function owning the feedback, as in FunctionDeoptimized.
+  int script_id = -1;
+  int function_start_position = -1;
+};
+
+// Durations of the phases of a full garbage collection, summed up over all
+// threads that worked on the phase. Phases that did not run are reported as
+// -1.
+struct GarbageCollectionPhases {
+  int64_t compact_wall_clock_duration_in_us = -1;
+  int64_t mark_wall_clock_duration_in_us = -1;
+  int64_t sweep_wall_clock_duration_in_us = -1;
+  int64_t weak_wall_clock_duration_in_us = -1;
+};
+
+struct GarbageCollectionFullCycle {
+  // Static string describing why the GC was triggered, e.g. "testing".
+  const char* reason = nullptr;
+  bool incremental = false;
+  bool reduce_memory = false;
+  // Duration of the atomic pause, which includes the main thread phases.
+  int64_t main_thread_atomic_wall_clock_duration_in_us = -1;
+  // Duration of incremental marking steps on the main thread before the
+  // atomic pause.
+  int64_t main_thread_incremental_wall_clock_duration_in_us = -1;
+  GarbageCollectionPhases main_thread_atomic_phases;
+  GarbageCollectionPhases background_phases;
+  size_t bytes_freed = 0;
+  // Live bytes moved by evacuation of fragmented pages.
+  size_t bytes_compacted = 0;
+};
+
+struct GarbageCollectionFullMainThreadIncrementalMark {
+  int64_t wall_clock_duration_in_us = -1;
+  size_t bytes_marked = 0;
+};
+
+// Incremental marking steps are reported in batches to keep the per-step
+// overhead low. A batch is flushed when it is full and before the
+// GarbageCollectionFullCycle event that finishes the marking cycle.
+struct GarbageCollectionFullMainThreadBatchedIncrementalMark {
+  std::vector<GarbageCollectionFullMainThreadIncrementalMark> events;
+};
+
+struct GarbageCollectionYoungCycle {
+  // Static string describing why the GC was triggered, e.g. "testing".
+  const char* reason = nullptr;
+  // Whether the young generation was collected by the minor mark-compactor
+  // rather than by the scavenger.
+  bool minor_mark_compactor = false;
+  int64_t main_thread_wall_clock_duration_in_us = -1;
+  // Summed up over all background threads.
+  int64_t background_wall_clock_duration_in_us = -1;
+  size_t bytes_freed = 0;
+  size_t bytes_promoted = 0;
+  size_t bytes_copied = 0;
+};
+
+// Phases of setting up an isolate with v8::Isolate::New. The event is
+// reported when the embedder installs its recorder, as isolate setup has
+// completed by then. Phases that did not run are reported as -1.
+struct IsolateStartup {
+  bool from_snapshot = false;
+  int64_t snapshot_decompression_wall_clock_duration_in_us = -1;
+  int64_t heap_setup_wall_clock_duration_in_us = -1;
+  // Includes deserialization of the read-only snapshot.
+  int64_t read_only_heap_setup_wall_clock_duration_in_us = -1;
+  // Setting up builtins, including the embedded blob when not using a
+  // snapshot.
+  int64_t builtins_setup_wall_clock_duration_in_us = -1;
+  int64_t startup_deserialization_wall_clock_duration_in_us = -1;
+  int64_t total_wall_clock_duration_in_us = -1;
+};
+
+struct MegamorphicStubCacheUsage {
+  // Whether this is the cache used by keyed and named stores rather than
+  // by loads.
+  bool store = false;
+  size_t primary_entries = 0;
+  size_t primary_entries_used = 0;
+  size_t secondary_entries = 0;
+  size_t secondary_entries_used = 0;
+  // Number of handlers added since the last report, and how many of those
+  // pushed a live entry out of the secondary table.
+  size_t updates = 0;
+  size_t evictions = 0;
+};
+
+struct RuntimeCallStatsCounter {
+  // Static string naming the counter, e.g. "CompileLazy".
+  const char* name = nullptr;
+  int64_t count = 0;
+  int64_t time_in_us = 0;
+};
+
+// Runtime call stats of all threads of an isolate, accumulated over the
+// sampling windows of --runtime-call-stats-sampling-interval so far.
+struct RuntimeCallStatsSample {
+  size_t window_count = 0;
+  int64_t sampled_wall_clock_time_in_us = 0;
+  // Only the counters that were entered at least once.
+  std::vector<RuntimeCallStatsCounter> counters;
+};
+
 struct WasmModuleDecoded {
   bool async = false;
   bool streamed = false;
@@ -49,12 +187,22 @@ struct WasmModulesPerIsolate {
 };
 
 #define V8_MAIN_THREAD_METRICS_EVENTS(V) \
+  V(ContextCreated)                      \
+  V(FeedbackBecameMegamorphic)           \
+  V(FunctionDeoptimized)                 \
   V(WasmModuleDecoded)                   \
   V(WasmModuleCompiled)                  \
   V(WasmModuleInstantiated)              \
   V(WasmModuleTieredUp)
 
-#define V8_THREAD_SAFE_METRICS_EVENTS(V) V(WasmModulesPerIsolate)
+#define V8_THREAD_SAFE_METRICS_EVENTS(V)                   \
+  V(GarbageCollectionFullCycle)                            \
+  V(GarbageCollectionFullMainThreadBatchedIncrementalMark) \
+  V(GarbageCollectionYoungCycle)                           \
+  V(IsolateStartup)                                        \
+  V(MegamorphicStubCacheUsage)                             \
+  V(RuntimeCallStatsSample)                                \
+  V(WasmModulesPerIsolate)
 
 /**
  * This class serves as a base class for recording event-based metrics in V8.
@@ -391,6 +391,14 @@ class PageAllocator {
    * memory area brings the memory transparently back.
    */
   virtual bool DiscardSystemPages(void* address, size_t size) { return true; }
+
+  /**
+   * Hints the operating system to back the given [address, address + size)
+   * range with huge pages (e.g. transparent huge pages on Linux). The range
+   * may still be reserved but inaccessible. Returns true if the hint was
+   * accepted.
+   */
+  virtual bool AdviseHugePages(void* address, size_t size) { return false; }
 };
 
 /**
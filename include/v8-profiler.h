@@ -260,7 +260,7 @@ class V8_EXPORT CpuProfilingOptions {
    * \param mode Type of computation of stack frame line numbers.
    * \param max_samples The maximum number of samples that should be recorded by
    *                    the profiler. Samples obtained after this limit will be
-   *                    discarded.
+   *                    discarded, unless |keep_latest_samples| is set.
    * \param sampling_interval_us controls the profile-specific target
    *                             sampling interval. The provided sampling
    *                             interval will be snapped to the next lowest
@@ -268,15 +268,28 @@ class V8_EXPORT CpuProfilingOptions {
    *                             interval, set via SetSamplingInterval(). If
    *                             zero, the sampling interval will be equal to
    *                             the profiler's sampling interval.
+   * \param filter_context If set, only samples of code running in this context
+   *                       are attributed to JS functions.
+   * \param keep_latest_samples If true, once |max_samples| samples have been
+   *                            recorded, every new sample replaces the oldest
+   *                            one. The profile is then a ring buffer of the
+   *                            most recent samples, e.g. for a long running
+   *                            low frequency "flight recorder" profile that is
+   *                            only looked at on demand. The hit counts of the
+   *                            profile's nodes still cover all samples. Use
+   *                            together with kEagerLogging to also avoid the
+   *                            cost of logging all code when profiling starts.
    */
   CpuProfilingOptions(
       CpuProfilingMode mode = kLeafNodeLineNumbers,
       unsigned max_samples = kNoSampleLimit, int sampling_interval_us = 0,
-      MaybeLocal<Context> filter_context = MaybeLocal<Context>());
+      MaybeLocal<Context> filter_context = MaybeLocal<Context>(),
+      bool keep_latest_samples = false);
 
   CpuProfilingMode mode() const { return mode_; }
   unsigned max_samples() const { return max_samples_; }
   int sampling_interval_us() const { return sampling_interval_us_; }
+  bool keep_latest_samples() const { return keep_latest_samples_; }
 
  private:
   friend class internal::CpuProfile;
@@ -287,6 +300,7 @@ class V8_EXPORT CpuProfilingOptions {
   CpuProfilingMode mode_;
   unsigned max_samples_;
   int sampling_interval_us_;
+  bool keep_latest_samples_;
   CopyablePersistentTraits<Context>::CopyablePersistent filter_context_;
 };
 
@@ -554,6 +568,12 @@ class V8_EXPORT HeapSnapshot {
    *
    * Nodes reference strings, other nodes, and edges by their indexes
    * in corresponding arrays.
+   *
+   * A snapshot does not reference the JavaScript heap once it is taken, so
+   * it may be serialized on a background thread while the isolate keeps
+   * running JavaScript. The snapshot must not be deleted during
+   * serialization, and heap object allocation tracking must not be active,
+   * because the trace tree is owned by the isolate.
    */
   void Serialize(OutputStream* stream,
                  SerializationFormat format = kJSON) const;
@@ -652,6 +672,21 @@ class V8_EXPORT AllocationProfile {
      * List of self allocations done by this node in the call-graph.
      */
     std::vector<Allocation> allocations;
+
+    /**
+     * Number of consecutive full garbage collections after which the
+     * estimated size of the live self allocations of this node was larger
+     * than after the previous one. Nodes whose count keeps increasing are
+     * likely leaking. Only computed with
+     * HeapProfiler::kSamplingTrackRetainedGrowth, 0 otherwise.
+     */
+    int growing_gc_count = 0;
+
+    /**
+     * Growth in bytes of the estimated size of the live self allocations over
+     * the last |growing_gc_count| full garbage collections.
+     */
+    size_t retained_size_growth = 0;
   };
 
   /**
@@ -774,6 +809,12 @@ class V8_EXPORT HeapProfiler {
   enum SamplingFlags {
     kSamplingNoFlags = 0,
     kSamplingForceGC = 1 << 0,
+    /**
+     * Compare the estimated retained size of every allocation stack after
+     * each full garbage collection with the one after the previous full
+     * garbage collection, see AllocationProfile::Node::growing_gc_count.
+     */
+    kSamplingTrackRetainedGrowth = 1 << 1,
   };
 
   /**
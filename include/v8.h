@@ -122,6 +122,7 @@ class EscapableHandleScope;
 template<typename T> class ReturnValue;
 
 namespace internal {
+class BackgroundDeserializeTask;
 enum class ArgumentsType;
 template <ArgumentsType>
 class Arguments;
@@ -1632,6 +1633,11 @@ class V8_EXPORT Script {
   Local<UnboundScript> GetUnboundScript();
 };
 
+/**
+ * The kind of source text that is streamed, see
+ * ScriptCompiler::StartStreaming.
+ */
+enum class ScriptType { kClassic, kModule };
 
 /**
  * For compiling scripts.
@@ -1676,16 +1682,41 @@ class V8_EXPORT ScriptCompiler {
     CachedData& operator=(const CachedData&) = delete;
   };
 
+  /**
+   * A task which the embedder can run on a background thread to deserialize a
+   * code cache ahead of compilation. Returned by
+   * ScriptCompiler::StartConsumingCodeCache.
+   */
+  class V8_EXPORT ConsumeCodeCacheTask final {
+   public:
+    ~ConsumeCodeCacheTask();
+
+    void Run();
+
+   private:
+    friend class ScriptCompiler;
+
+    explicit ConsumeCodeCacheTask(
+        std::unique_ptr<internal::BackgroundDeserializeTask> impl);
+
+    std::unique_ptr<internal::BackgroundDeserializeTask> impl_;
+  };
+
   /**
    * Source code which can be then compiled to a UnboundScript or Script.
    */
   class Source {
    public:
-    // Source takes ownership of CachedData.
+    // Source takes ownership of both CachedData and ConsumeCodeCacheTask.
+    // When a ConsumeCodeCacheTask is passed, its result is used instead of
+    // deserializing the CachedData again, and the CachedData only receives
+    // the rejected flag.
     V8_INLINE Source(Local<String> source_string, const ScriptOrigin& origin,
-                     CachedData* cached_data = nullptr);
+                     CachedData* cached_data = nullptr,
+                     ConsumeCodeCacheTask* consume_cache_task = nullptr);
     V8_INLINE Source(Local<String> source_string,
-                     CachedData* cached_data = nullptr);
+                     CachedData* cached_data = nullptr,
+                     ConsumeCodeCacheTask* consume_cache_task = nullptr);
     V8_INLINE ~Source();
 
     // Ownership of the CachedData or its buffers is *not* transferred to the
@@ -1716,6 +1747,7 @@ class V8_EXPORT ScriptCompiler {
     // set), or hold newly generated cache data (kProduce*Cache flags) are
     // set when calling a compile method.
     CachedData* cached_data;
+    std::unique_ptr<ConsumeCodeCacheTask> consume_cache_task;
   };
 
   /**
@@ -1888,6 +1920,29 @@ class V8_EXPORT ScriptCompiler {
       Isolate* isolate, StreamedSource* source,
       CompileOptions options = kNoCompileOptions);
 
+  /**
+   * Like StartStreamingScript, but can also stream ES modules. A streamed
+   * module has to be compiled with the CompileModule overload that takes a
+   * StreamedSource, a streamed classic script with Compile. Embedders loading
+   * a module graph can stream every module of the graph in parallel and only
+   * compile and link them once all tasks have run.
+   */
+  static ScriptStreamingTask* StartStreaming(
+      Isolate* isolate, StreamedSource* source,
+      ScriptType type = ScriptType::kClassic);
+
+  /**
+   * Returns a task which deserializes |source| when run, so that the
+   * expensive part of consuming a code cache can happen on a background
+   * thread. Must be called on the isolate's thread. The task has to be passed
+   * to a Source that is compiled with kConsumeCodeCache, after it has been
+   * run. If it has not been run by then, the code cache is deserialized on
+   * the main thread as usual. The caller owns the returned task until it is
+   * handed to a Source.
+   */
+  static ConsumeCodeCacheTask* StartConsumingCodeCache(
+      Isolate* isolate, std::unique_ptr<CachedData> source);
+
   /**
    * Compiles a streamed script (bound to current context).
    *
@@ -1931,6 +1986,19 @@ class V8_EXPORT ScriptCompiler {
       CompileOptions options = kNoCompileOptions,
       NoCacheReason no_cache_reason = kNoCacheNoReason);
 
+  /**
+   * Compiles a streamed module script.
+   *
+   * This can only be called after the streaming has finished
+   * (ScriptStreamingTask has been run). V8 doesn't construct the source string
+   * during streaming, so the embedder needs to pass the full source here.
+   * The streaming task must have been started with ScriptType::kModule and
+   * |origin| must mark the script as a module.
+   */
+  static V8_WARN_UNUSED_RESULT MaybeLocal<Module> CompileModule(
+      Local<Context> context, StreamedSource* v8_source,
+      Local<String> full_source_string, const ScriptOrigin& origin);
+
   /**
    * Compile a function for a given context. This is equivalent to running
    *
@@ -2265,6 +2333,19 @@ class V8_EXPORT JSON {
   static V8_WARN_UNUSED_RESULT MaybeLocal<Value> Parse(
       Local<Context> context, Local<String> json_string);
 
+  /**
+   * Like Parse, but takes the JSON text as |length| bytes of UTF-8 at |data|.
+   * ASCII input is parsed in place, without copying it into a string first.
+   * The bytes only need to stay valid until this function returns.
+   *
+   * \param the context in which to parse and create the value.
+   * \param data The UTF-8 encoded JSON text.
+   * \param length The number of bytes at |data|.
+   * \return The corresponding value if successfully parsed.
+   */
+  static V8_WARN_UNUSED_RESULT MaybeLocal<Value> ParseUtf8(
+      Local<Context> context, const char* data, size_t length);
+
   /**
    * Tries to stringify the JSON-serializable object |json_object| and returns
    * it as string if successful.
@@ -2316,6 +2397,19 @@ class V8_EXPORT ValueSerializer {
 
     virtual Maybe<uint32_t> GetWasmModuleTransferId(
         Isolate* isolate, Local<WasmModuleObject> module);
+
+    /**
+     * Called when the serializer encounters an external string. The embedder
+     * may return an ID for it, in which case only the ID is written instead
+     * of the string's contents. When deserializing, this ID will be passed to
+     * ValueDeserializer::GetExternalStringFromId, which can, for example,
+     * create a new external string sharing the same payload.
+     *
+     * If Nothing<uint32_t>() is returned without throwing an exception, the
+     * contents are copied as for any other string.
+     */
+    virtual Maybe<uint32_t> GetExternalStringTransferId(Isolate* isolate,
+                                                        Local<String> string);
     /**
      * Allocates memory for the buffer of at least the size provided. The actual
      * size (which may be greater or equal) is written to |actual_size|. If no
@@ -2427,6 +2521,13 @@ class V8_EXPORT ValueDeserializer {
      */
     virtual MaybeLocal<SharedArrayBuffer> GetSharedArrayBufferFromId(
         Isolate* isolate, uint32_t clone_id);
+
+    /**
+     * Get a String given a transfer_id previously provided
+     * by ValueSerializer::GetExternalStringTransferId
+     */
+    virtual MaybeLocal<String> GetExternalStringFromId(Isolate* isolate,
+                                                       uint32_t transfer_id);
   };
 
   ValueDeserializer(Isolate* isolate, const uint8_t* data, size_t size);
@@ -4123,6 +4224,22 @@ class V8_EXPORT Object : public Value {
                            Local<Name>* names, Local<Value>* values,
                            size_t length);
 
+  /**
+   * Creates a JavaScript object with the same shape as |shape|, i.e. with the
+   * same prototype and the same own properties in the same order and with the
+   * same attributes, and sets the i-th own property to |values[i]|.
+   * |shape| must be an ordinary object in fast mode without elements whose
+   * own properties are all data properties, for example one created from an
+   * object literal, and |length| must be its number of own properties.
+   *
+   * This is meant for creating many objects with the same properties, such
+   * as the rows of a database query result. The objects are allocated with
+   * their final map and their fields are filled in directly, instead of
+   * looking up and transitioning the map for every single property.
+   */
+  static Local<Object> NewWithShape(Isolate* isolate, Local<Object> shape,
+                                    Local<Value>* values, size_t length);
+
   V8_INLINE static Object* Cast(Value* obj);
 
  private:
@@ -4152,6 +4269,56 @@ class V8_EXPORT Array : public Object {
    */
   static Local<Array> New(Isolate* isolate, Local<Value>* elements,
                           size_t length);
+
+  /**
+   * Creates a JavaScript array with double elements out of a C++ array of
+   * doubles with a known length.
+   */
+  static Local<Array> New(Isolate* isolate, const double* elements,
+                          size_t length);
+
+  /**
+   * Copies the |count| elements starting at index |start| into |elements|,
+   * with the same result as calling Get for each index. Elements that are
+   * present in a fast backing store are read from it directly; holes and
+   * other kinds of elements go through the generic lookup, which may call
+   * into JavaScript.
+   */
+  V8_WARN_UNUSED_RESULT Maybe<bool> CopyElementsTo(Local<Context> context,
+                                                   uint32_t start,
+                                                   uint32_t count,
+                                                   Local<Value>* elements);
+
+  /**
+   * Copies the |count| elements starting at index |start| into |elements|
+   * without creating any handles. This only works if the array has Smi or
+   * double elements and all elements in the range are present; otherwise
+   * false is returned and the contents of |elements| are unspecified. Never
+   * calls into JavaScript.
+   */
+  bool CopyElementsTo(uint32_t start, uint32_t count, double* elements) const;
+
+  enum class CallbackResult {
+    kException,
+    kBreak,
+    kContinue,
+  };
+  using IterationCallback = CallbackResult (*)(uint32_t index,
+                                               Local<Value> element,
+                                               void* data);
+
+  /**
+   * Calls |callback| for every element of the array, in order, until it
+   * returns kBreak or kException. Elements in a fast backing store are passed
+   * without a generic element lookup, so iterating a packed array never calls
+   * into JavaScript. The length and the backing store are re-read for every
+   * element, so iteration stays correct if the callback modifies the array.
+   * Returns Nothing if an exception was thrown or the callback returned
+   * kException.
+   */
+  Maybe<void> Iterate(Local<Context> context, IterationCallback callback,
+                      void* callback_data);
+
   V8_INLINE static Array* Cast(Value* obj);
  private:
   Array();
@@ -5092,6 +5259,16 @@ class V8_EXPORT ArrayBuffer : public Object {
      */
     virtual void* Reallocate(void* data, size_t old_length, size_t new_length);
 
+    /**
+     * Free |count| memory blocks at once, where |data[i]| has size
+     * |lengths[i]|. V8 calls this when the GC releases many dead array buffers
+     * at the same time, so allocators that synchronize on every Free can
+     * release the whole batch with a single lock acquisition.
+     *
+     * The default implementation calls Free for every block.
+     */
+    virtual void FreeBatch(void** data, const size_t* lengths, size_t count);
+
     /**
      * ArrayBuffer allocation mode. kNormal is a malloc/free style allocation,
      * while kReservation is for larger allocations with the ability to set
@@ -7110,6 +7287,18 @@ class V8_EXPORT ResourceConstraints {
     initial_young_generation_size_ = initial_size;
   }
 
+  /**
+   * A soft target for the main thread pause of full garbage collections in
+   * milliseconds, or zero for the default heuristics. When set, V8 uses the
+   * observed marking speed and old generation allocation throughput to start
+   * incremental marking early enough, so that the remaining marking work at
+   * the allocation limit fits into the given pause.
+   */
+  double gc_pause_target_in_ms() const { return gc_pause_target_in_ms_; }
+  void set_gc_pause_target_in_ms(double pause_in_ms) {
+    gc_pause_target_in_ms_ = pause_in_ms;
+  }
+
   /**
    * Deprecated functions. Do not use in new code.
    */
@@ -7142,6 +7331,7 @@ class V8_EXPORT ResourceConstraints {
   size_t max_zone_pool_size_ = 0;
   size_t initial_old_generation_size_ = 0;
   size_t initial_young_generation_size_ = 0;
+  double gc_pause_target_in_ms_ = 0;
   uint32_t* stack_limit_ = nullptr;
 };
 
@@ -7394,6 +7584,18 @@ class V8_EXPORT MicrotaskQueue {
    */
   virtual void PerformCheckpoint(Isolate* isolate) = 0;
 
+  /**
+   * Like PerformCheckpoint, but stops once |max_microtasks| microtasks ran or
+   * |time_budget_in_seconds| elapsed, so that embedders can interleave long
+   * microtask chains with other work. Microtasks enqueued while running count
+   * towards the limits. The time budget is only checked between batches of
+   * microtasks and may therefore be exceeded. Returns true if the queue is
+   * empty afterwards, in which case the completed callbacks have been called.
+   */
+  virtual bool PerformCheckpointWithBudget(Isolate* isolate,
+                                           int max_microtasks,
+                                           double time_budget_in_seconds) = 0;
+
   /**
    * Returns true if a microtask is running on this MicrotaskQueue instance.
    */
@@ -7566,6 +7768,18 @@ typedef void (*InterruptCallback)(Isolate* isolate, void* data);
 typedef size_t (*NearHeapLimitCallback)(void* data, size_t current_heap_limit,
                                         size_t initial_heap_limit);
 
+/**
+ * This callback is invoked after a full garbage collection when the heap size
+ * exceeds the soft heap limit set with Isolate::SetSoftHeapLimitCallback. It
+ * is not invoked again until the heap size has dropped below the soft limit.
+ * The callback is invoked well before the heap limit is reached, so that the
+ * embedder has time to react, e.g. by releasing memory or by calling
+ * Isolate::TerminateExecution to stop only this isolate. The callback must
+ * not execute JavaScript.
+ */
+typedef void (*SoftHeapLimitCallback)(void* data, size_t heap_size,
+                                      size_t current_heap_limit);
+
 /**
  * Collection of shared per-process V8 memory information.
  *
@@ -7692,6 +7906,68 @@ class V8_EXPORT HeapCodeStatistics {
   friend class Isolate;
 };
 
+/**
+ * Statistics about the hidden classes (maps) of live objects and the
+ * transition trees connecting them.
+ */
+class V8_EXPORT MapTransitionStatistics {
+ public:
+  MapTransitionStatistics();
+  size_t number_of_maps() { return number_of_maps_; }
+  /** Maps that are not the target of a transition. */
+  size_t number_of_root_maps() { return number_of_root_maps_; }
+  size_t number_of_dictionary_maps() { return number_of_dictionary_maps_; }
+  size_t number_of_deprecated_maps() { return number_of_deprecated_maps_; }
+  /** Length of the longest chain of transitions from a root map. */
+  size_t max_transition_depth() { return max_transition_depth_; }
+  /** Largest number of outgoing transitions of a single map. */
+  size_t max_transitions_per_map() { return max_transitions_per_map_; }
+
+ private:
+  size_t number_of_maps_;
+  size_t number_of_root_maps_;
+  size_t number_of_dictionary_maps_;
+  size_t number_of_deprecated_maps_;
+  size_t max_transition_depth_;
+  size_t max_transitions_per_map_;
+
+  friend class Isolate;
+};
+
+/**
+ * CPU time in microseconds that was spent on behalf of an isolate. Only
+ * recorded when V8 runs with --account-isolate-cpu-time and the platform
+ * supports measuring thread CPU time.
+ */
+class V8_EXPORT CpuTimeStatistics {
+ public:
+  CpuTimeStatistics();
+  /** CPU time of threads while they had the isolate entered. */
+  int64_t main_thread_cpu_time_us() { return main_thread_cpu_time_us_; }
+  /** CPU time of background garbage collection tasks. */
+  int64_t gc_background_cpu_time_us() { return gc_background_cpu_time_us_; }
+  /** CPU time of background JavaScript parsing and compilation tasks. */
+  int64_t compile_background_cpu_time_us() {
+    return compile_background_cpu_time_us_;
+  }
+  /** CPU time of background WebAssembly compilation and tier-up tasks. */
+  int64_t wasm_background_cpu_time_us() {
+    return wasm_background_cpu_time_us_;
+  }
+  int64_t total_cpu_time_us() {
+    return main_thread_cpu_time_us_ + gc_background_cpu_time_us_ +
+           compile_background_cpu_time_us_ + wasm_background_cpu_time_us_;
+  }
+
+ private:
+  int64_t main_thread_cpu_time_us_;
+  int64_t gc_background_cpu_time_us_;
+  int64_t compile_background_cpu_time_us_;
+  int64_t wasm_background_cpu_time_us_;
+
+  friend class Isolate;
+};
+
 /**
  * A JIT code event is issued each time code is added, moved or removed.
  *
@@ -8696,6 +8972,21 @@ class V8_EXPORT Isolate {
   bool GetHeapObjectStatisticsAtLastGC(HeapObjectStatistics* object_statistics,
                                        size_t type_index);
 
+  /**
+   * Get statistics about young generation objects that survived the previous
+   * GC. Unlike GetHeapObjectStatisticsAtLastGC() this does not require a heap
+   * walk and is only available with --track-young-survivors-by-type.
+   *
+   * \param object_statistics The HeapObjectStatistics object to fill in the
+   *   count and size of surviving objects of the given type.
+   * \param type_index The index of the type of object to fill details about,
+   *   which ranges from 0 to NumberOfTrackedHeapObjectTypes() - 1. Only
+   *   indices that correspond to instance types are tracked.
+   * \returns true on success.
+   */
+  bool GetYoungSurvivorStatisticsAtLastGC(
+      HeapObjectStatistics* object_statistics, size_t type_index);
+
   /**
    * Get statistics about code and its metadata in the heap.
    *
@@ -8705,6 +8996,35 @@ class V8_EXPORT Isolate {
    */
   bool GetHeapCodeAndMetadataStatistics(HeapCodeStatistics* object_statistics);
 
+  /**
+   * Get statistics about the maps of live objects and their transition trees.
+   * This iterates the whole heap and is meant for diagnostics.
+   *
+   * \param map_statistics The MapTransitionStatistics object to fill in.
+   * \returns true on success.
+   */
+  bool GetMapTransitionStatistics(MapTransitionStatistics* map_statistics);
+
+  /**
+   * Get the CPU time that was spent on behalf of this isolate, including
+   * background tasks such as concurrent garbage collection and compilation.
+   * If the calling thread has entered the isolate, its CPU time up to now is
+   * included.
+   *
+   * \param cpu_time_statistics The CpuTimeStatistics object to fill in.
+   * \returns true on success.
+   */
+  bool GetCpuTimeStatistics(CpuTimeStatistics* cpu_time_statistics);
+
+  /**
+   * Throttles background tasks that V8 posts on behalf of this isolate, e.g.
+   * for concurrent garbage collection and optimizing compilation. While
+   * throttled they are posted with TaskPriority::kBestEffort, so a platform
+   * that honors task priorities runs them after other work. Tasks that the
+   * isolate's thread waits for are not affected.
+   */
+  void SetBackgroundTasksThrottled(bool throttled);
+
   /**
    * This API is experimental and may change significantly.
    *
@@ -9355,6 +9675,16 @@ class V8_EXPORT Isolate {
    */
   void AutomaticallyRestoreInitialHeapLimit(double threshold_percent = 0.5);
 
+  /**
+   * Set the callback to invoke when the heap size exceeds the given threshold
+   * percentage of the current heap limit, see SoftHeapLimitCallback. While the
+   * soft limit is exceeded, V8 also tries to reduce memory usage in subsequent
+   * garbage collections. Setting a nullptr callback removes the soft limit.
+   * The threshold percentage is a number in (0.0, 1.0) range.
+   */
+  void SetSoftHeapLimitCallback(SoftHeapLimitCallback callback, void* data,
+                                double threshold_percent = 0.8);
+
   /**
    * Set the callback to invoke to check if code generation from
    * strings should be allowed.
@@ -9529,6 +9859,52 @@ class V8_EXPORT Isolate {
   void ReportExternalAllocationLimitReached();
 };
 
+/**
+ * A pool of isolates that are created ahead of time on worker threads of the
+ * platform, optionally together with a context. Handing out a pooled isolate
+ * takes isolate initialization and context deserialization off the critical
+ * path. Isolates are never reused: each acquired isolate belongs to the
+ * caller, and the pool starts creating a replacement in the background.
+ *
+ * The pool must be destroyed before V8 is disposed.
+ */
+class V8_EXPORT IsolatePool {
+ public:
+  /**
+   * Creates a pool that keeps up to |size| isolates created with |params|
+   * ready. If |create_context| is true, a context is created in each isolate
+   * ahead of time as well.
+   */
+  IsolatePool(const Isolate::CreateParams& params, size_t size,
+              bool create_context = true);
+
+  /**
+   * Waits for isolates that are still being created and disposes all isolates
+   * that were not handed out.
+   */
+  ~IsolatePool();
+
+  /**
+   * Hands out an isolate from the pool, or creates one on the calling thread
+   * if none is ready. If |context| is not null, it is set to a context in the
+   * returned isolate. The caller owns the isolate and has to reset the context
+   * and dispose the isolate when it is done with it.
+   */
+  Isolate* Acquire(Global<Context>* context = nullptr);
+
+  /**
+   * Returns the number of isolates that are ready to be handed out.
+   */
+  size_t ReadyCount() const;
+
+  IsolatePool(const IsolatePool&) = delete;
+  IsolatePool& operator=(const IsolatePool&) = delete;
+
+ private:
+  class Impl;
+  std::shared_ptr<Impl> impl_;
+};
+
 class V8_EXPORT StartupData {
  public:
   /**
@@ -9832,7 +10208,13 @@ class V8_EXPORT V8 {
  */
 class V8_EXPORT SnapshotCreator {
  public:
-  enum class FunctionCodeHandling { kClear, kKeep };
+  /**
+   * kClear drops compiled code, kKeep keeps bytecode, and kKeepWithFeedback
+   * additionally keeps feedback vectors with their invocation counts and
+   * profiler ticks, so that functions warmed up before taking the snapshot
+   * tier up early. Optimized code is never included; feedback slots are reset.
+   */
+  enum class FunctionCodeHandling { kClear, kKeep, kKeepWithFeedback };
 
   /**
    * Initialize and enter an isolate, and set it up for serialization.
@@ -11323,7 +11705,8 @@ Local<Integer> ScriptOrigin::ScriptID() const { return script_id_; }
 Local<Value> ScriptOrigin::SourceMapUrl() const { return source_map_url_; }
 
 ScriptCompiler::Source::Source(Local<String> string, const ScriptOrigin& origin,
-                               CachedData* data)
+                               CachedData* data,
+                               ConsumeCodeCacheTask* consume_cache_task)
     : source_string(string),
       resource_name(origin.ResourceName()),
       resource_line_offset(origin.ResourceLineOffset()),
@@ -11331,11 +11714,14 @@ ScriptCompiler::Source::Source(Local<String> string, const ScriptOrigin& origin,
       resource_options(origin.Options()),
       source_map_url(origin.SourceMapUrl()),
       host_defined_options(origin.HostDefinedOptions()),
-      cached_data(data) {}
+      cached_data(data),
+      consume_cache_task(consume_cache_task) {}
 
-ScriptCompiler::Source::Source(Local<String> string,
-                               CachedData* data)
-    : source_string(string), cached_data(data) {}
+ScriptCompiler::Source::Source(Local<String> string, CachedData* data,
+                               ConsumeCodeCacheTask* consume_cache_task)
+    : source_string(string),
+      cached_data(data),
+      consume_cache_task(consume_cache_task) {}
 
 
 ScriptCompiler::Source::~Source() {
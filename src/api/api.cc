@@ -6,6 +6,7 @@
 
 #include <algorithm>  // For min
 #include <cmath>      // For isnan.
+#include <deque>
 #include <limits>
 #include <string>
 #include <utility>  // For move
@@ -19,6 +20,9 @@
 #include "src/api/api-natives.h"
 #include "src/base/functional.h"
 #include "src/base/logging.h"
+#include "src/base/optional.h"
+#include "src/base/platform/condition-variable.h"
+#include "src/base/platform/mutex.h"
 #include "src/base/platform/platform.h"
 #include "src/base/platform/time.h"
 #include "src/base/safe_conversions.h"
@@ -65,6 +69,7 @@
 #include "src/objects/contexts.h"
 #include "src/objects/embedder-data-array-inl.h"
 #include "src/objects/embedder-data-slot-inl.h"
+#include "src/objects/feedback-vector-inl.h"
 #include "src/objects/frame-array-inl.h"
 #include "src/objects/hash-table-inl.h"
 #include "src/objects/heap-object.h"
@@ -86,6 +91,7 @@
 #include "src/objects/smi.h"
 #include "src/objects/stack-frame-info-inl.h"
 #include "src/objects/templates.h"
+#include "src/objects/transitions-inl.h"
 #include "src/objects/value-serializer.h"
 #include "src/parsing/parse-info.h"
 #include "src/parsing/parser.h"
@@ -103,6 +109,7 @@
 #include "src/snapshot/startup-serializer.h"  // For SerializedHandleChecker.
 #include "src/strings/char-predicates-inl.h"
 #include "src/strings/string-hasher.h"
+#include "src/strings/unicode-decoder.h"
 #include "src/strings/unicode-inl.h"
 #include "src/tracing/trace-event.h"
 #include "src/trap-handler/trap-handler.h"
@@ -783,7 +790,8 @@ StartupData SnapshotCreator::CreateBlob(
   }
 
   i::Snapshot::ClearReconstructableDataForSerialization(
-      isolate, function_code_handling == FunctionCodeHandling::kClear);
+      isolate, function_code_handling == FunctionCodeHandling::kClear,
+      function_code_handling == FunctionCodeHandling::kKeepWithFeedback);
 
   i::DisallowHeapAllocation no_gc_from_here_on;
 
@@ -2435,11 +2443,17 @@ MaybeLocal<UnboundScript> ScriptCompiler::CompileUnboundInternal(
                      InternalEscapableScope);
 
   i::ScriptData* script_data = nullptr;
+  std::unique_ptr<i::BackgroundDeserializeTask> deserialize_task;
   if (options == kConsumeCodeCache) {
-    DCHECK(source->cached_data);
-    // ScriptData takes care of pointer-aligning the data.
-    script_data = new i::ScriptData(source->cached_data->data,
-                                    source->cached_data->length);
+    if (source->consume_cache_task) {
+      deserialize_task = std::move(source->consume_cache_task->impl_);
+      DCHECK_NOT_NULL(deserialize_task);
+    } else {
+      DCHECK(source->cached_data);
+      // ScriptData takes care of pointer-aligning the data.
+      script_data = new i::ScriptData(source->cached_data->data,
+                                      source->cached_data->length);
+    }
   }
 
   i::Handle<i::String> str = Utils::OpenHandle(*(source->source_string));
@@ -2452,9 +2466,12 @@ MaybeLocal<UnboundScript> ScriptCompiler::CompileUnboundInternal(
   i::MaybeHandle<i::SharedFunctionInfo> maybe_function_info =
       i::Compiler::GetSharedFunctionInfoForScript(
           isolate, str, script_details, source->resource_options, nullptr,
-          script_data, options, no_cache_reason, i::NOT_NATIVES_CODE);
-  if (options == kConsumeCodeCache) {
-    source->cached_data->rejected = script_data->rejected();
+          script_data, options, no_cache_reason, i::NOT_NATIVES_CODE,
+          deserialize_task.get());
+  if (options == kConsumeCodeCache && source->cached_data) {
+    source->cached_data->rejected = deserialize_task
+                                        ? deserialize_task->rejected()
+                                        : script_data->rejected();
   }
   delete script_data;
   has_pending_exception = !maybe_function_info.ToHandle(&result);
@@ -2615,41 +2632,72 @@ MaybeLocal<Function> ScriptCompiler::CompileFunctionInContext(
 
 void ScriptCompiler::ScriptStreamingTask::Run() { data_->task->Run(); }
 
+ScriptCompiler::ConsumeCodeCacheTask::ConsumeCodeCacheTask(
+    std::unique_ptr<i::BackgroundDeserializeTask> impl)
+    : impl_(std::move(impl)) {}
+
+ScriptCompiler::ConsumeCodeCacheTask::~ConsumeCodeCacheTask() = default;
+
+void ScriptCompiler::ConsumeCodeCacheTask::Run() { impl_->Run(); }
+
+ScriptCompiler::ConsumeCodeCacheTask* ScriptCompiler::StartConsumingCodeCache(
+    Isolate* v8_isolate, std::unique_ptr<CachedData> cached_data) {
+  i::Isolate* isolate = reinterpret_cast<i::Isolate*>(v8_isolate);
+  return new ScriptCompiler::ConsumeCodeCacheTask(
+      std::make_unique<i::BackgroundDeserializeTask>(isolate,
+                                                     std::move(cached_data)));
+}
+
 ScriptCompiler::ScriptStreamingTask* ScriptCompiler::StartStreamingScript(
     Isolate* v8_isolate, StreamedSource* source, CompileOptions options) {
-  if (!i::FLAG_script_streaming) {
-    return nullptr;
-  }
   // We don't support other compile options on streaming background compiles.
   // TODO(rmcilroy): remove CompileOptions from the API.
   CHECK(options == ScriptCompiler::kNoCompileOptions);
+  return StartStreaming(v8_isolate, source, ScriptType::kClassic);
+}
+
+ScriptCompiler::ScriptStreamingTask* ScriptCompiler::StartStreaming(
+    Isolate* v8_isolate, StreamedSource* source, v8::ScriptType type) {
+  if (!i::FLAG_script_streaming) {
+    return nullptr;
+  }
   i::Isolate* isolate = reinterpret_cast<i::Isolate*>(v8_isolate);
   i::ScriptStreamingData* data = source->impl();
   std::unique_ptr<i::BackgroundCompileTask> task =
-      std::make_unique<i::BackgroundCompileTask>(data, isolate);
+      std::make_unique<i::BackgroundCompileTask>(data, isolate, type);
   data->task = std::move(task);
   return new ScriptCompiler::ScriptStreamingTask(data);
 }
 
+namespace {
+i::MaybeHandle<i::SharedFunctionInfo> CompileStreamedSource(
+    i::Isolate* isolate, ScriptCompiler::StreamedSource* v8_source,
+    Local<String> full_source_string, const ScriptOrigin& origin) {
+  i::Handle<i::String> str = Utils::OpenHandle(*(full_source_string));
+  i::Compiler::ScriptDetails script_details = GetScriptDetails(
+      isolate, origin.ResourceName(), origin.ResourceLineOffset(),
+      origin.ResourceColumnOffset(), origin.SourceMapUrl(),
+      origin.HostDefinedOptions());
+  i::ScriptStreamingData* data = v8_source->impl();
+  return i::Compiler::GetSharedFunctionInfoForStreamedScript(
+      isolate, str, script_details, origin.Options(), data);
+}
+}  // namespace
+
 MaybeLocal<Script> ScriptCompiler::Compile(Local<Context> context,
                                            StreamedSource* v8_source,
                                            Local<String> full_source_string,
                                            const ScriptOrigin& origin) {
+  Utils::ApiCheck(
+      !origin.Options().IsModule(), "v8::ScriptCompiler::Compile",
+      "v8::ScriptCompiler::CompileModule must be used to compile modules");
   PREPARE_FOR_EXECUTION(context, ScriptCompiler, Compile, Script);
   TRACE_EVENT_CALL_STATS_SCOPED(isolate, "v8", "V8.ScriptCompiler");
   TRACE_EVENT0(TRACE_DISABLED_BY_DEFAULT("v8.compile"),
                "V8.CompileStreamedScript");
 
-  i::Handle<i::String> str = Utils::OpenHandle(*(full_source_string));
-  i::Compiler::ScriptDetails script_details = GetScriptDetails(
-      isolate, origin.ResourceName(), origin.ResourceLineOffset(),
-      origin.ResourceColumnOffset(), origin.SourceMapUrl(),
-      origin.HostDefinedOptions());
-  i::ScriptStreamingData* data = v8_source->impl();
-
   i::MaybeHandle<i::SharedFunctionInfo> maybe_function_info =
-      i::Compiler::GetSharedFunctionInfoForStreamedScript(
-          isolate, str, script_details, origin.Options(), data);
+      CompileStreamedSource(isolate, v8_source, full_source_string, origin);
 
   i::Handle<i::SharedFunctionInfo> result;
   has_pending_exception = !maybe_function_info.ToHandle(&result);
@@ -2664,6 +2712,30 @@ MaybeLocal<Script> ScriptCompiler::Compile(Local<Context> context,
   RETURN_ESCAPED(bound);
 }
 
+MaybeLocal<Module> ScriptCompiler::CompileModule(
+    Local<Context> context, StreamedSource* v8_source,
+    Local<String> full_source_string, const ScriptOrigin& origin) {
+  Utils::ApiCheck(origin.Options().IsModule(),
+                  "v8::ScriptCompiler::CompileModule",
+                  "Invalid ScriptOrigin: is_module must be true");
+  PREPARE_FOR_EXECUTION(context, ScriptCompiler, Compile, Module);
+  TRACE_EVENT_CALL_STATS_SCOPED(isolate, "v8", "V8.ScriptCompiler");
+  TRACE_EVENT0(TRACE_DISABLED_BY_DEFAULT("v8.compile"),
+               "V8.CompileStreamedModule");
+
+  i::MaybeHandle<i::SharedFunctionInfo> maybe_function_info =
+      CompileStreamedSource(isolate, v8_source, full_source_string, origin);
+
+  i::Handle<i::SharedFunctionInfo> result;
+  has_pending_exception = !maybe_function_info.ToHandle(&result);
+  if (has_pending_exception) isolate->ReportPendingMessages();
+
+  RETURN_ON_FAILED_EXECUTION(Module);
+
+  RETURN_ESCAPED(
+      ToApiHandle<Module>(isolate->factory()->NewSourceTextModule(result)));
+}
+
 uint32_t ScriptCompiler::CachedDataVersionTag() {
   return static_cast<uint32_t>(base::hash_combine(
       internal::Version::Hash(), internal::FlagList::Hash(),
@@ -3096,6 +3168,55 @@ MaybeLocal<Value> JSON::Parse(Local<Context> context,
   RETURN_ESCAPED(result);
 }
 
+namespace {
+// Exposes the embedder's buffer to the JSON parser in JSON::ParseUtf8. The
+// parser does not keep references to the source after it returns.
+class JsonSourceResource final : public String::ExternalOneByteStringResource {
+ public:
+  JsonSourceResource(const char* data, size_t length)
+      : data_(data), length_(length) {}
+  const char* data() const override { return data_; }
+  size_t length() const override { return length_; }
+
+ private:
+  const char* data_;
+  size_t length_;
+};
+}  // anonymous namespace
+
+MaybeLocal<Value> JSON::ParseUtf8(Local<Context> context, const char* data,
+                                  size_t length) {
+  PREPARE_FOR_EXECUTION(context, JSON, ParseUtf8, Value);
+  i::MaybeHandle<i::Object> maybe;
+  if (length > static_cast<size_t>(i::String::kMaxLength)) {
+    isolate->Throw(*isolate->factory()->NewInvalidStringLengthError());
+  } else if (length > 0 &&
+             i::NonAsciiStart(reinterpret_cast<const uint8_t*>(data),
+                              static_cast<int>(length)) ==
+                 static_cast<int>(length)) {
+    i::Handle<i::String> source =
+        isolate->factory()
+            ->NewExternalStringFromOneByte(
+                new JsonSourceResource(data, length))
+            .ToHandleChecked();
+    maybe = i::JsonParser<uint8_t>::ParseTransientSource(isolate, source);
+  } else {
+    i::Handle<i::String> source;
+    if (isolate->factory()
+            ->NewStringFromUtf8(i::Vector<const char>(data, length))
+            .ToHandle(&source)) {
+      i::Handle<i::Object> undefined = isolate->factory()->undefined_value();
+      maybe = source->IsOneByteRepresentation()
+                  ? i::JsonParser<uint8_t>::Parse(isolate, source, undefined)
+                  : i::JsonParser<uint16_t>::Parse(isolate, source, undefined);
+    }
+  }
+  Local<Value> result;
+  has_pending_exception = !ToLocal<Value>(maybe, &result);
+  RETURN_ON_FAILED_EXECUTION(Value);
+  RETURN_ESCAPED(result);
+}
+
 MaybeLocal<String> JSON::Stringify(Local<Context> context,
                                    Local<Value> json_object,
                                    Local<String> gap) {
@@ -3141,6 +3262,11 @@ Maybe<uint32_t> ValueSerializer::Delegate::GetWasmModuleTransferId(
   return Nothing<uint32_t>();
 }
 
+Maybe<uint32_t> ValueSerializer::Delegate::GetExternalStringTransferId(
+    Isolate* v8_isolate, Local<String> string) {
+  return Nothing<uint32_t>();
+}
+
 void* ValueSerializer::Delegate::ReallocateBufferMemory(void* old_buffer,
                                                         size_t size,
                                                         size_t* actual_size) {
@@ -3240,6 +3366,15 @@ ValueDeserializer::Delegate::GetSharedArrayBufferFromId(Isolate* v8_isolate,
   return MaybeLocal<SharedArrayBuffer>();
 }
 
+MaybeLocal<String> ValueDeserializer::Delegate::GetExternalStringFromId(
+    Isolate* v8_isolate, uint32_t id) {
+  i::Isolate* isolate = reinterpret_cast<i::Isolate*>(v8_isolate);
+  isolate->ScheduleThrow(*isolate->factory()->NewError(
+      isolate->error_function(),
+      i::MessageTemplate::kDataCloneDeserializationError));
+  return MaybeLocal<String>();
+}
+
 struct ValueDeserializer::PrivateData {
   PrivateData(i::Isolate* i, i::Vector<const uint8_t> data, Delegate* delegate)
       : isolate(i), deserializer(i, data, delegate) {}
@@ -5215,30 +5350,81 @@ bool String::ContainsOnlyOneByte() const {
   return helper.Check(*str);
 }
 
-int String::Utf8Length(Isolate* isolate) const {
-  i::Handle<i::String> str = Utils::OpenHandle(this);
-  str = i::String::Flatten(reinterpret_cast<i::Isolate*>(isolate), str);
-  int length = str->length();
-  if (length == 0) return 0;
+namespace {
+// Calls {visitor} with the flat content of each part of {string} in order.
+// Unlike String::Flatten, this does not copy ropes.
+template <typename Visitor>
+void VisitFlatParts(i::String string, const i::DisallowHeapAllocation& no_gc,
+                    Visitor&& visitor) {
+  if (!string.IsConsString() || string.IsFlat()) {
+    visitor(string.GetFlatContent(no_gc));
+    return;
+  }
+  i::ConsStringIterator iter(i::ConsString::cast(string));
+  int offset;
+  for (i::String part = iter.Next(&offset); !part.is_null();
+       part = iter.Next(&offset)) {
+    DCHECK_EQ(0, offset);
+    visitor(part.GetFlatContent(no_gc));
+  }
+}
+
+int Utf8LengthImpl(i::String string) {
   i::DisallowHeapAllocation no_gc;
-  i::String::FlatContent flat = str->GetFlatContent(no_gc);
-  DCHECK(flat.IsFlat());
   int utf8_length = 0;
-  if (flat.IsOneByte()) {
-    for (uint8_t c : flat.ToOneByteVector()) {
-      utf8_length += c >> 7;
-    }
-    utf8_length += length;
-  } else {
-    int last_character = unibrow::Utf16::kNoPreviousCharacter;
-    for (uint16_t c : flat.ToUC16Vector()) {
-      utf8_length += unibrow::Utf8::Length(c, last_character);
-      last_character = c;
+  int last_character = unibrow::Utf16::kNoPreviousCharacter;
+  VisitFlatParts(string, no_gc, [&](const i::String::FlatContent& flat) {
+    DCHECK(flat.IsFlat());
+    if (flat.IsOneByte()) {
+      i::Vector<const uint8_t> chars = flat.ToOneByteVector();
+      // Only characters past the ASCII prefix can take two bytes.
+      int ascii_length = i::NonAsciiStart(chars.begin(), chars.length());
+      for (int i = ascii_length; i < chars.length(); i++) {
+        utf8_length += chars[i] >> 7;
+      }
+      utf8_length += chars.length();
+      last_character = unibrow::Utf16::kNoPreviousCharacter;
+    } else {
+      for (uint16_t c : flat.ToUC16Vector()) {
+        utf8_length += unibrow::Utf8::Length(c, last_character);
+        last_character = c;
+      }
     }
-  }
+  });
   return utf8_length;
 }
 
+// Writes all of {string} as UTF-8 to {buffer} without flattening it. The
+// caller guarantees that the buffer can hold the whole encoded string.
+int WriteRopeUtf8(i::String string, char* buffer, bool replace_invalid_utf8) {
+  i::DisallowHeapAllocation no_gc;
+  char* current_write = buffer;
+  int prev_char = unibrow::Utf16::kNoPreviousCharacter;
+  VisitFlatParts(string, no_gc, [&](const i::String::FlatContent& flat) {
+    DCHECK(flat.IsFlat());
+    if (flat.IsOneByte()) {
+      for (uint8_t c : flat.ToOneByteVector()) {
+        current_write += unibrow::Utf8::EncodeOneByte(current_write, c);
+      }
+      prev_char = unibrow::Utf16::kNoPreviousCharacter;
+    } else {
+      for (uint16_t c : flat.ToUC16Vector()) {
+        current_write += unibrow::Utf8::Encode(current_write, c, prev_char,
+                                               replace_invalid_utf8);
+        prev_char = c;
+      }
+    }
+  });
+  return static_cast<int>(current_write - buffer);
+}
+}  // anonymous namespace
+
+int String::Utf8Length(Isolate* isolate) const {
+  i::Handle<i::String> str = Utils::OpenHandle(this);
+  if (str->length() == 0) return 0;
+  return Utf8LengthImpl(*str);
+}
+
 namespace {
 // Writes the flat content of a string to a buffer. This is done in two phases.
 // The first phase calculates a pessimistic estimate (writable_length) on how
@@ -5373,6 +5559,19 @@ int String::WriteUtf8(Isolate* v8_isolate, char* buffer, int capacity,
   i::Isolate* isolate = reinterpret_cast<i::Isolate*>(v8_isolate);
   LOG_API(isolate, String, WriteUtf8);
   ENTER_V8_NO_SCRIPT_NO_EXCEPTION(isolate);
+  // If the whole string fits, write ropes part by part instead of flattening
+  // them first.
+  if (str->IsConsString() && !str->IsFlat() &&
+      (capacity == -1 || capacity >= Utf8LengthImpl(*str))) {
+    int written = WriteRopeUtf8(*str, buffer,
+                                options & v8::String::REPLACE_INVALID_UTF8);
+    if (nchars_ref != nullptr) *nchars_ref = str->length();
+    if (!(options & v8::String::NO_NULL_TERMINATION) &&
+        (capacity == -1 || written < capacity)) {
+      buffer[written++] = '\0';
+    }
+    return written;
+  }
   str = i::String::Flatten(isolate, str);
   i::DisallowHeapAllocation no_gc;
   i::String::FlatContent content = str->GetFlatContent(no_gc);
@@ -5806,6 +6005,20 @@ HeapCodeStatistics::HeapCodeStatistics()
       bytecode_and_metadata_size_(0),
       external_script_source_size_(0) {}
 
+MapTransitionStatistics::MapTransitionStatistics()
+    : number_of_maps_(0),
+      number_of_root_maps_(0),
+      number_of_dictionary_maps_(0),
+      number_of_deprecated_maps_(0),
+      max_transition_depth_(0),
+      max_transitions_per_map_(0) {}
+
+CpuTimeStatistics::CpuTimeStatistics()
+    : main_thread_cpu_time_us_(0),
+      gc_background_cpu_time_us_(0),
+      compile_background_cpu_time_us_(0),
+      wasm_background_cpu_time_us_(0) {}
+
 bool v8::V8::InitializeICU(const char* icu_data_file) {
   return i::InitializeICU(icu_data_file);
 }
@@ -6609,6 +6822,111 @@ Local<v8::Object> v8::Object::New(Isolate* isolate,
   return Utils::ToLocal(obj);
 }
 
+Local<v8::Object> v8::Object::NewWithShape(Isolate* isolate,
+                                           Local<Object> shape,
+                                           Local<Value>* values,
+                                           size_t length) {
+  i::Isolate* i_isolate = reinterpret_cast<i::Isolate*>(isolate);
+  i::Handle<i::JSReceiver> receiver = Utils::OpenHandle(*shape);
+  if (!Utils::ApiCheck(receiver->IsJSObject() &&
+                           receiver->map().instance_type() ==
+                               i::JS_OBJECT_TYPE &&
+                           receiver->HasFastProperties() &&
+                           i::JSObject::cast(*receiver).HasFastElements() &&
+                           i::JSObject::cast(*receiver).elements().length() ==
+                               0,
+                       "v8::Object::NewWithShape",
+                       "shape must be a fast mode object without elements")) {
+    return Local<v8::Object>();
+  }
+  LOG_API(i_isolate, Object, NewWithShape);
+  ENTER_V8_NO_SCRIPT_NO_EXCEPTION(i_isolate);
+  i::Handle<i::JSObject> shape_obj = i::Handle<i::JSObject>::cast(receiver);
+  i::Handle<i::Map> map(shape_obj->map(), i_isolate);
+  if (map->is_deprecated()) map = i::Map::Update(i_isolate, map);
+  i::Handle<i::DescriptorArray> descriptors(map->instance_descriptors(),
+                                            i_isolate);
+  if (!Utils::ApiCheck(
+          map->NumberOfOwnDescriptors() == static_cast<int>(length),
+          "v8::Object::NewWithShape",
+          "length must match the number of properties of shape")) {
+    return Local<v8::Object>();
+  }
+
+  // Make sure every field of the map can hold its new value. Fields are
+  // generalized in place like stores would do; if a field would need a new
+  // map, the object is created property by property instead.
+  bool in_place = true;
+  for (i::InternalIndex i : map->IterateOwnDescriptors()) {
+    i::PropertyDetails details = descriptors->GetDetails(i);
+    if (!Utils::ApiCheck(
+            details.kind() == i::kData && details.location() == i::kField,
+            "v8::Object::NewWithShape",
+            "shape must only have data properties")) {
+      return Local<v8::Object>();
+    }
+    i::Handle<i::Object> value = Utils::OpenHandle(*values[i.as_int()]);
+    i::Representation representation = details.representation();
+    if (!value->FitsRepresentation(representation)) {
+      i::Representation new_representation =
+          value->OptimalRepresentation(i_isolate).generalize(representation);
+      if (!representation.CanBeInPlaceChangedTo(new_representation)) {
+        in_place = false;
+        break;
+      }
+      i::Map::GeneralizeField(
+          i_isolate, map, i, details.constness(), new_representation,
+          value->OptimalType(i_isolate, new_representation));
+    } else if (representation.IsHeapObject() &&
+               !descriptors->GetFieldType(i).NowContains(value)) {
+      i::Map::GeneralizeField(i_isolate, map, i, details.constness(),
+                              representation,
+                              value->OptimalType(i_isolate, representation));
+    }
+  }
+
+  if (!in_place) {
+    i::Handle<i::HeapObject> proto(map->prototype(), i_isolate);
+    i::Handle<i::JSObject> obj =
+        i::JSObject::ObjectCreate(i_isolate, proto).ToHandleChecked();
+    for (i::InternalIndex i : map->IterateOwnDescriptors()) {
+      i::Handle<i::Name> name(descriptors->GetKey(i), i_isolate);
+      i::JSObject::DefinePropertyOrElementIgnoreAttributes(
+          obj, name, Utils::OpenHandle(*values[i.as_int()]),
+          descriptors->GetDetails(i).attributes())
+          .Check();
+    }
+    return Utils::ToLocal(obj);
+  }
+
+  // Box the values of double fields before allocating the object, so that no
+  // allocation happens while its fields are written.
+  descriptors = i::handle(map->instance_descriptors(), i_isolate);
+  std::vector<i::Handle<i::Object>> field_values(length);
+  for (i::InternalIndex i : map->IterateOwnDescriptors()) {
+    i::Handle<i::Object> value = Utils::OpenHandle(*values[i.as_int()]);
+    if (descriptors->GetDetails(i).representation().IsDouble()) {
+      value = i_isolate->factory()->NewHeapNumber(value->Number());
+    }
+    field_values[i.as_int()] = value;
+  }
+  i::Handle<i::JSObject> obj = i_isolate->factory()->NewJSObjectFromMap(map);
+  int out_of_object_fields =
+      map->NumberOfFields() + map->UnusedPropertyFields() -
+      map->GetInObjectProperties();
+  if (!map->HasOutOfObjectProperties()) out_of_object_fields = 0;
+  if (out_of_object_fields > 0) {
+    obj->SetProperties(
+        *i_isolate->factory()->NewPropertyArray(out_of_object_fields));
+  }
+  i::DisallowHeapAllocation no_gc;
+  for (i::InternalIndex i : map->IterateOwnDescriptors()) {
+    i::FieldIndex index = i::FieldIndex::ForDescriptor(*map, i);
+    obj->FastPropertyAtPut(index, *field_values[i.as_int()]);
+  }
+  return Utils::ToLocal(obj);
+}
+
 Local<v8::Value> v8::NumberObject::New(Isolate* isolate, double value) {
   i::Isolate* i_isolate = reinterpret_cast<i::Isolate*>(isolate);
   LOG_API(i_isolate, NumberObject, New);
@@ -6844,14 +7162,135 @@ Local<v8::Array> v8::Array::New(Isolate* isolate, Local<Value>* elements,
       factory->NewJSArrayWithElements(result, i::PACKED_ELEMENTS, len));
 }
 
+Local<v8::Array> v8::Array::New(Isolate* isolate, const double* elements,
+                                size_t length) {
+  i::Isolate* i_isolate = reinterpret_cast<i::Isolate*>(isolate);
+  i::Factory* factory = i_isolate->factory();
+  LOG_API(i_isolate, Array, New);
+  ENTER_V8_NO_SCRIPT_NO_EXCEPTION(i_isolate);
+  int len = static_cast<int>(length);
+
+  i::Handle<i::FixedArrayBase> result = factory->NewFixedDoubleArray(len);
+  if (len > 0) {
+    i::FixedDoubleArray double_elements = i::FixedDoubleArray::cast(*result);
+    for (int i = 0; i < len; i++) double_elements.set(i, elements[i]);
+  }
+
+  return Utils::ToLocal(
+      factory->NewJSArrayWithElements(result, i::PACKED_DOUBLE_ELEMENTS, len));
+}
+
+namespace {
+
+uint32_t JSArrayLength(i::JSArray array) {
+  i::Object length = array.length();
+  if (length.IsSmi()) return i::Smi::ToInt(length);
+  return static_cast<uint32_t>(length.Number());
+}
+
+// Reads the element at {index} directly from the backing store of {array} if
+// the array has fast Smi, object or double elements and the element is
+// present. Returns an empty handle otherwise.
+i::MaybeHandle<i::Object> GetFastElement(i::Isolate* isolate,
+                                         i::Handle<i::JSArray> array,
+                                         uint32_t index) {
+  if (index >= JSArrayLength(*array)) return {};
+  i::ElementsKind kind = array->GetElementsKind();
+  i::FixedArrayBase backing_store = array->elements();
+  if (index >= static_cast<uint32_t>(backing_store.length())) return {};
+  if (i::IsSmiOrObjectElementsKind(kind)) {
+    i::Object value = i::FixedArray::cast(backing_store).get(index);
+    if (value.IsTheHole(isolate)) return {};
+    return i::handle(value, isolate);
+  }
+  if (i::IsDoubleElementsKind(kind)) {
+    i::FixedDoubleArray doubles = i::FixedDoubleArray::cast(backing_store);
+    if (doubles.is_the_hole(index)) return {};
+    return isolate->factory()->NewNumber(doubles.get_scalar(index));
+  }
+  return {};
+}
+
+}  // namespace
+
+Maybe<bool> v8::Array::CopyElementsTo(Local<Context> context, uint32_t start,
+                                      uint32_t count, Local<Value>* elements) {
+  auto self = Utils::OpenHandle(this);
+  i::Isolate* isolate = self->GetIsolate();
+  LOG_API(isolate, Array, CopyElementsTo);
+  if (!Utils::ApiCheck(count <= i::kMaxUInt32 - start,
+                       "v8::Array::CopyElementsTo", "range out of bounds")) {
+    return Nothing<bool>();
+  }
+  for (uint32_t i = 0; i < count; i++) {
+    uint32_t index = start + i;
+    i::Handle<i::Object> element;
+    if (GetFastElement(isolate, self, index).ToHandle(&element)) {
+      elements[i] = Utils::ToLocal(element);
+    } else if (!Get(context, index).ToLocal(&elements[i])) {
+      return Nothing<bool>();
+    }
+  }
+  return Just(true);
+}
+
+bool v8::Array::CopyElementsTo(uint32_t start, uint32_t count,
+                               double* elements) const {
+  auto self = Utils::OpenHandle(this);
+  i::DisallowHeapAllocation no_gc;
+  if (count > JSArrayLength(*self) || start > JSArrayLength(*self) - count) {
+    return false;
+  }
+  i::ElementsKind kind = self->GetElementsKind();
+  i::FixedArrayBase backing_store = self->elements();
+  if (start + count > static_cast<uint32_t>(backing_store.length())) {
+    return count == 0;
+  }
+  if (i::IsSmiElementsKind(kind)) {
+    i::FixedArray smis = i::FixedArray::cast(backing_store);
+    for (uint32_t i = 0; i < count; i++) {
+      i::Object value = smis.get(start + i);
+      if (!value.IsSmi()) return false;
+      elements[i] = i::Smi::ToInt(value);
+    }
+    return true;
+  }
+  if (i::IsDoubleElementsKind(kind)) {
+    i::FixedDoubleArray doubles = i::FixedDoubleArray::cast(backing_store);
+    for (uint32_t i = 0; i < count; i++) {
+      if (doubles.is_the_hole(start + i)) return false;
+      elements[i] = doubles.get_scalar(start + i);
+    }
+    return true;
+  }
+  return false;
+}
+
+Maybe<void> v8::Array::Iterate(Local<Context> context,
+                               IterationCallback callback,
+                               void* callback_data) {
+  auto self = Utils::OpenHandle(this);
+  auto isolate = reinterpret_cast<i::Isolate*>(context->GetIsolate());
+  ENTER_V8(isolate, context, Array, Iterate, Nothing<void>(), i::HandleScope);
+  for (uint32_t i = 0; i < JSArrayLength(*self); i++) {
+    i::HandleScope element_scope(isolate);
+    i::Handle<i::Object> element;
+    if (!GetFastElement(isolate, self, i).ToHandle(&element)) {
+      has_pending_exception =
+          !i::JSReceiver::GetElement(isolate, self, i).ToHandle(&element);
+      RETURN_ON_FAILED_EXECUTION_PRIMITIVE(void);
+    }
+    CallbackResult result =
+        callback(i, Utils::ToLocal(element), callback_data);
+    if (result == CallbackResult::kException) return Nothing<void>();
+    if (result == CallbackResult::kBreak) break;
+  }
+  return JustVoid();
+}
+
 uint32_t v8::Array::Length() const {
   i::Handle<i::JSArray> obj = Utils::OpenHandle(this);
-  i::Object length = obj->length();
-  if (length.IsSmi()) {
-    return i::Smi::ToInt(length);
-  } else {
-    return static_cast<uint32_t>(length.Number());
-  }
+  return JSArrayLength(*obj);
 }
 
 Local<v8::Map> v8::Map::New(Isolate* isolate) {
@@ -7326,6 +7765,13 @@ void* v8::ArrayBuffer::Allocator::Reallocate(void* data, size_t old_length,
   return new_data;
 }
 
+void v8::ArrayBuffer::Allocator::FreeBatch(void** data, const size_t* lengths,
+                                           size_t count) {
+  for (size_t i = 0; i < count; i++) {
+    Free(data[i], lengths[i]);
+  }
+}
+
 // static
 v8::ArrayBuffer::Allocator* v8::ArrayBuffer::Allocator::NewDefaultAllocator() {
   return new ArrayBufferAllocator();
@@ -8356,6 +8802,124 @@ void Isolate::Dispose() {
   i::Isolate::Delete(isolate);
 }
 
+class IsolatePool::Impl final : public std::enable_shared_from_this<Impl> {
+ public:
+  Impl(const Isolate::CreateParams& params, size_t size, bool create_context)
+      : params_(params), size_(size), create_context_(create_context) {}
+
+  void Refill() {
+    base::MutexGuard guard(&mutex_);
+    while (!shut_down_ && ready_.size() + pending_ < size_) {
+      pending_++;
+      i::V8::GetCurrentPlatform()->CallOnWorkerThread(
+          std::make_unique<WarmTask>(shared_from_this()));
+    }
+  }
+
+  Isolate* Acquire(Global<Context>* context) {
+    Entry entry;
+    {
+      base::MutexGuard guard(&mutex_);
+      if (!ready_.empty()) {
+        entry = std::move(ready_.front());
+        ready_.pop_front();
+      }
+    }
+    if (entry.isolate == nullptr) entry.isolate = Isolate::New(params_);
+    Refill();
+    if (context != nullptr) {
+      if (entry.context.IsEmpty()) CreateContext(&entry);
+      *context = std::move(entry.context);
+    }
+    return entry.isolate;
+  }
+
+  size_t ReadyCount() {
+    base::MutexGuard guard(&mutex_);
+    return ready_.size();
+  }
+
+  void ShutDown() {
+    std::deque<Entry> ready;
+    {
+      base::MutexGuard guard(&mutex_);
+      shut_down_ = true;
+      while (pending_ > 0) pending_done_.Wait(&mutex_);
+      ready.swap(ready_);
+    }
+    for (Entry& entry : ready) Dispose(&entry);
+  }
+
+ private:
+  struct Entry {
+    Isolate* isolate = nullptr;
+    Global<Context> context;
+  };
+
+  class WarmTask final : public v8::Task {
+   public:
+    explicit WarmTask(std::shared_ptr<Impl> pool) : pool_(std::move(pool)) {}
+
+    void Run() final { pool_->Warm(); }
+
+   private:
+    std::shared_ptr<Impl> pool_;
+  };
+
+  static void CreateContext(Entry* entry) {
+    // Only take the lock if the embedder uses lockers, as taking one enables
+    // locking checks for all isolates.
+    base::Optional<Locker> locker;
+    if (Locker::IsActive()) locker.emplace(entry->isolate);
+    Isolate::Scope isolate_scope(entry->isolate);
+    HandleScope handle_scope(entry->isolate);
+    entry->context.Reset(entry->isolate, Context::New(entry->isolate));
+  }
+
+  static void Dispose(Entry* entry) {
+    entry->context.Reset();
+    entry->isolate->Dispose();
+  }
+
+  void Warm() {
+    Entry entry;
+    entry.isolate = Isolate::New(params_);
+    if (create_context_) CreateContext(&entry);
+    base::MutexGuard guard(&mutex_);
+    if (shut_down_) {
+      Dispose(&entry);
+    } else {
+      ready_.push_back(std::move(entry));
+    }
+    pending_--;
+    pending_done_.NotifyAll();
+  }
+
+  const Isolate::CreateParams params_;
+  const size_t size_;
+  const bool create_context_;
+
+  base::Mutex mutex_;
+  base::ConditionVariable pending_done_;
+  std::deque<Entry> ready_;
+  size_t pending_ = 0;
+  bool shut_down_ = false;
+};
+
+IsolatePool::IsolatePool(const Isolate::CreateParams& params, size_t size,
+                         bool create_context)
+    : impl_(std::make_shared<Impl>(params, size, create_context)) {
+  impl_->Refill();
+}
+
+IsolatePool::~IsolatePool() { impl_->ShutDown(); }
+
+Isolate* IsolatePool::Acquire(Global<Context>* context) {
+  return impl_->Acquire(context);
+}
+
+size_t IsolatePool::ReadyCount() const { return impl_->ReadyCount(); }
+
 void Isolate::DumpAndResetStats() {
   i::Isolate* isolate = reinterpret_cast<i::Isolate*>(this);
   isolate->DumpAndResetStats();
@@ -8597,6 +9161,28 @@ bool Isolate::GetHeapObjectStatisticsAtLastGC(
   return true;
 }
 
+bool Isolate::GetYoungSurvivorStatisticsAtLastGC(
+    HeapObjectStatistics* object_statistics, size_t type_index) {
+  if (!object_statistics) return false;
+  if (V8_LIKELY(!i::FLAG_track_young_survivors_by_type)) return false;
+  if (type_index >= i::SurvivorStatsByType::kNumberOfTypes) return false;
+
+  i::Isolate* isolate = reinterpret_cast<i::Isolate*>(this);
+  i::Heap* heap = isolate->heap();
+  const char* object_type;
+  const char* object_sub_type;
+  if (!heap->GetObjectTypeName(type_index, &object_type, &object_sub_type)) {
+    return false;
+  }
+  const i::SurvivorStatsByType::Entry entry =
+      heap->YoungSurvivorsAtLastGC(type_index);
+  object_statistics->object_type_ = object_type;
+  object_statistics->object_sub_type_ = object_sub_type;
+  object_statistics->object_count_ = entry.count;
+  object_statistics->object_size_ = entry.size;
+  return true;
+}
+
 bool Isolate::GetHeapCodeAndMetadataStatistics(
     HeapCodeStatistics* code_statistics) {
   if (!code_statistics) return false;
@@ -8612,6 +9198,69 @@ bool Isolate::GetHeapCodeAndMetadataStatistics(
   return true;
 }
 
+bool Isolate::GetMapTransitionStatistics(
+    MapTransitionStatistics* map_statistics) {
+  if (!map_statistics) return false;
+
+  i::Isolate* isolate = reinterpret_cast<i::Isolate*>(this);
+  *map_statistics = MapTransitionStatistics();
+  i::HeapObjectIterator iterator(
+      isolate->heap(), i::HeapObjectIterator::kFilterUnreachable);
+  i::DisallowHeapAllocation no_gc;
+  for (i::HeapObject obj = iterator.Next(); !obj.is_null();
+       obj = iterator.Next()) {
+    if (!obj.IsMap()) continue;
+    i::Map map = i::Map::cast(obj);
+    map_statistics->number_of_maps_++;
+    if (map.is_dictionary_map()) map_statistics->number_of_dictionary_maps_++;
+    if (map.is_deprecated()) map_statistics->number_of_deprecated_maps_++;
+    if (!map.GetBackPointer().IsMap()) {
+      map_statistics->number_of_root_maps_++;
+    }
+    size_t transitions = static_cast<size_t>(
+        i::TransitionsAccessor(isolate, map, &no_gc).NumberOfTransitions());
+    map_statistics->max_transitions_per_map_ =
+        std::max(map_statistics->max_transitions_per_map_, transitions);
+    // Only leaves can end the longest chain, which keeps this linear in the
+    // number of maps for the common case of few long chains.
+    if (transitions != 0) continue;
+    size_t depth = 0;
+    for (i::HeapObject parent = map.GetBackPointer(); parent.IsMap();
+         parent = i::Map::cast(parent).GetBackPointer()) {
+      depth++;
+    }
+    map_statistics->max_transition_depth_ =
+        std::max(map_statistics->max_transition_depth_, depth);
+  }
+  return true;
+}
+
+bool Isolate::GetCpuTimeStatistics(CpuTimeStatistics* cpu_time_statistics) {
+  if (!cpu_time_statistics) return false;
+
+  i::Isolate* isolate = reinterpret_cast<i::Isolate*>(this);
+  if (i::FLAG_account_isolate_cpu_time &&
+      i::Isolate::TryGetCurrent() == isolate) {
+    isolate->AccountMainThreadCpuTime();
+  }
+  using Category = i::Counters::CpuTimeCategory;
+  i::Counters* counters = isolate->counters();
+  cpu_time_statistics->main_thread_cpu_time_us_ =
+      counters->cpu_time_in_us(Category::kMainThread);
+  cpu_time_statistics->gc_background_cpu_time_us_ =
+      counters->cpu_time_in_us(Category::kGCBackground);
+  cpu_time_statistics->compile_background_cpu_time_us_ =
+      counters->cpu_time_in_us(Category::kCompileBackground);
+  cpu_time_statistics->wasm_background_cpu_time_us_ =
+      counters->cpu_time_in_us(Category::kWasmBackground);
+  return true;
+}
+
+void Isolate::SetBackgroundTasksThrottled(bool throttled) {
+  i::Isolate* isolate = reinterpret_cast<i::Isolate*>(this);
+  isolate->set_background_tasks_throttled(throttled);
+}
+
 v8::MaybeLocal<v8::Promise> Isolate::MeasureMemory(
     v8::Local<v8::Context> context, MeasureMemoryMode mode) {
   return v8::MaybeLocal<v8::Promise>();
@@ -8799,8 +9448,10 @@ void Isolate::SetAddHistogramSampleFunction(
 
 void Isolate::SetMetricsRecorder(
     const std::shared_ptr<metrics::Recorder>& metrics_recorder) {
-  reinterpret_cast<i::Isolate*>(this)->metrics_recorder()->SetRecorder(
-      metrics_recorder);
+  i::Isolate* isolate = reinterpret_cast<i::Isolate*>(this);
+  isolate->metrics_recorder()->SetRecorder(metrics_recorder);
+  // Isolate setup has finished before the embedder could install a recorder.
+  isolate->metrics_recorder()->AddThreadSafeEvent(*isolate->startup_metrics());
 }
 
 void Isolate::SetAddCrashKeyCallback(AddCrashKeyCallback callback) {
@@ -9028,6 +9679,14 @@ void Isolate::AutomaticallyRestoreInitialHeapLimit(double threshold_percent) {
   isolate->heap()->AutomaticallyRestoreInitialHeapLimit(threshold_percent);
 }
 
+void Isolate::SetSoftHeapLimitCallback(v8::SoftHeapLimitCallback callback,
+                                       void* data, double threshold_percent) {
+  DCHECK_GT(threshold_percent, 0.0);
+  DCHECK_LT(threshold_percent, 1.0);
+  i::Isolate* isolate = reinterpret_cast<i::Isolate*>(this);
+  isolate->heap()->SetSoftHeapLimitCallback(callback, data, threshold_percent);
+}
+
 bool Isolate::IsDead() {
   i::Isolate* isolate = reinterpret_cast<i::Isolate*>(this);
   return isolate->IsDead();
@@ -10193,6 +10852,44 @@ int debug::GetDebuggingId(v8::Local<v8::Function> function) {
   return id;
 }
 
+debug::FeedbackSummary debug::GetFeedbackSummary(
+    v8::Local<v8::Function> function) {
+  FeedbackSummary summary;
+  i::Handle<i::JSReceiver> callable = v8::Utils::OpenHandle(*function);
+  if (!callable->IsJSFunction()) return summary;
+  i::Handle<i::JSFunction> func = i::Handle<i::JSFunction>::cast(callable);
+  summary.has_optimized_code = func->HasOptimizedCode();
+  if (!func->has_feedback_vector()) return summary;
+  i::FeedbackVector vector = func->feedback_vector();
+  summary.invocation_count = vector.invocation_count();
+  summary.profiler_ticks = vector.profiler_ticks();
+  i::FeedbackMetadataIterator iter(vector.metadata());
+  while (iter.HasNext()) {
+    i::FeedbackNexus nexus(vector, iter.Next());
+    summary.slot_count++;
+    switch (nexus.ic_state()) {
+      case i::NO_FEEDBACK:
+      case i::UNINITIALIZED:
+        summary.uninitialized++;
+        break;
+      case i::MONOMORPHIC:
+      case i::RECOMPUTE_HANDLER:
+        summary.monomorphic++;
+        break;
+      case i::POLYMORPHIC:
+        summary.polymorphic++;
+        break;
+      case i::MEGAMORPHIC:
+        summary.megamorphic++;
+        break;
+      case i::GENERIC:
+        summary.generic++;
+        break;
+    }
+  }
+  return summary;
+}
+
 bool debug::SetFunctionBreakpoint(v8::Local<v8::Function> function,
                                   v8::Local<v8::String> condition,
                                   BreakpointId* id) {
@@ -10598,10 +11295,12 @@ CpuProfiler* CpuProfiler::New(Isolate* isolate,
 CpuProfilingOptions::CpuProfilingOptions(CpuProfilingMode mode,
                                          unsigned max_samples,
                                          int sampling_interval_us,
-                                         MaybeLocal<Context> filter_context)
+                                         MaybeLocal<Context> filter_context,
+                                         bool keep_latest_samples)
     : mode_(mode),
       max_samples_(max_samples),
-      sampling_interval_us_(sampling_interval_us) {
+      sampling_interval_us_(sampling_interval_us),
+      keep_latest_samples_(keep_latest_samples) {
   if (!filter_context.IsEmpty()) {
     Local<Context> local_filter_context = filter_context.ToLocalChecked();
     filter_context_.Reset(local_filter_context->GetIsolate(),
@@ -11064,7 +11763,18 @@ const size_t HandleScopeImplementer::kEnteredContextsOffset =
 const size_t HandleScopeImplementer::kIsMicrotaskContextOffset =
     offsetof(HandleScopeImplementer, is_microtask_context_);
 
-void HandleScopeImplementer::FreeThreadResources() { Free(); }
+void HandleScopeImplementer::FreeThreadResources() {
+  // With lightweight thread migration the spare block and the capacity of the
+  // stacks are kept for the next thread that locks the isolate.
+  if (FLAG_lightweight_thread_migration) {
+    DCHECK(blocks_.empty());
+    DCHECK(entered_contexts_.empty());
+    DCHECK(is_microtask_context_.empty());
+    DCHECK(saved_contexts_.empty());
+    return;
+  }
+  Free();
+}
 
 char* HandleScopeImplementer::ArchiveThread(char* storage) {
   HandleScopeData* current = isolate_->handle_scope_data();
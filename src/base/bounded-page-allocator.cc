@@ -115,5 +115,10 @@ bool BoundedPageAllocator::DiscardSystemPages(void* address, size_t size) {
   return page_allocator_->DiscardSystemPages(address, size);
 }
 
+bool BoundedPageAllocator::AdviseHugePages(void* address, size_t size) {
+  DCHECK(region_allocator_.contains(reinterpret_cast<Address>(address), size));
+  return page_allocator_->AdviseHugePages(address, size);
+}
+
 }  // namespace base
 }  // namespace v8
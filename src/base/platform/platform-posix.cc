@@ -444,6 +444,17 @@ bool OS::DiscardSystemPages(void* address, size_t size) {
   return ret == 0;
 }
 
+// static
+bool OS::AdviseHugePages(void* address, size_t size) {
+#if V8_OS_LINUX && defined(MADV_HUGEPAGE)
+  // The advice is attached to the mapping, so it also applies to pages of
+  // the range that are committed later on.
+  return madvise(address, size, MADV_HUGEPAGE) == 0;
+#else
+  return false;
+#endif
+}
+
 // static
 bool OS::HasLazyCommits() {
 #if V8_OS_AIX || V8_OS_LINUX || V8_OS_MACOSX
@@ -858,6 +869,25 @@ bool Thread::Start() {
 
 void Thread::Join() { pthread_join(data_->thread_, nullptr); }
 
+bool Thread::SetAffinity(const std::vector<int>& cpus) {
+#if V8_OS_LINUX && !V8_OS_ANDROID
+  if (cpus.empty()) return false;
+  cpu_set_t cpu_set;
+  CPU_ZERO(&cpu_set);
+  for (int cpu : cpus) {
+    if (cpu < 0 || cpu >= CPU_SETSIZE) return false;
+    CPU_SET(cpu, &cpu_set);
+  }
+  MutexGuard lock_guard(&data_->thread_creation_mutex_);
+  if (data_->thread_ == kNoThread) return false;
+  return pthread_setaffinity_np(data_->thread_, sizeof(cpu_set), &cpu_set) ==
+         0;
+#else
+  USE(cpus);
+  return false;
+#endif
+}
+
 static Thread::LocalStorageKey PthreadKeyToLocalKey(pthread_key_t pthread_key) {
 #if V8_OS_CYGWIN
   // We need to cast pthread_key_t to Thread::LocalStorageKey in two steps
@@ -903,6 +903,9 @@ bool OS::DiscardSystemPages(void* address, size_t size) {
   return ptr;
 }
 
+// static
+bool OS::AdviseHugePages(void* address, size_t size) { return false; }
+
 // static
 bool OS::HasLazyCommits() {
   // TODO(alph): implement for the platform.
@@ -1366,6 +1369,19 @@ void Thread::Join() {
   }
 }
 
+bool Thread::SetAffinity(const std::vector<int>& cpus) {
+  // Affinity masks only cover the processors of the thread's processor group.
+  DWORD_PTR mask = 0;
+  for (int cpu : cpus) {
+    if (cpu < 0 || cpu >= static_cast<int>(sizeof(mask) * 8)) {
+      return false;
+    }
+    mask |= DWORD_PTR{1} << cpu;
+  }
+  if (mask == 0 || data_->thread_ == kNoThread) return false;
+  return SetThreadAffinityMask(data_->thread_, mask) != 0;
+}
+
 
 Thread::LocalStorageKey Thread::CreateThreadLocalKey() {
   DWORD result = TlsAlloc();
@@ -284,6 +284,9 @@ class V8_BASE_EXPORT OS {
   V8_WARN_UNUSED_RESULT static bool DiscardSystemPages(void* address,
                                                        size_t size);
 
+  V8_WARN_UNUSED_RESULT static bool AdviseHugePages(void* address,
+                                                    size_t size);
+
   static const int msPerSecond = 1000;
 
 #if V8_OS_POSIX
@@ -352,6 +355,11 @@ class V8_BASE_EXPORT Thread {
   // Wait until thread terminates.
   void Join();
 
+  // Restricts the started thread to run on the given logical processors.
+  // Returns false if the thread has not been started, if |cpus| is empty or
+  // invalid, or if the operating system does not support it.
+  bool SetAffinity(const std::vector<int>& cpus);
+
   inline const char* name() const {
     return name_;
   }
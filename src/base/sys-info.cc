@@ -18,6 +18,7 @@
 #include <sys/sysctl.h>
 #endif
 
+#include <cstdio>
 #include <limits>
 
 #include "src/base/logging.h"
@@ -115,5 +116,32 @@ int64_t SysInfo::AmountOfVirtualMemory() {
 #endif
 }
 
+// static
+std::vector<int> SysInfo::ProcessorsOfNumaNode(int node) {
+  std::vector<int> processors;
+#if V8_OS_LINUX
+  if (node < 0) return processors;
+  char path[64];
+  snprintf(path, sizeof(path), "/sys/devices/system/node/node%d/cpulist",
+           node);
+  FILE* file = fopen(path, "r");
+  if (file == nullptr) return processors;
+  // The list has the form "0-7,16-23".
+  int first;
+  while (fscanf(file, "%d", &first) == 1) {
+    int last = first;
+    int separator = fgetc(file);
+    if (separator == '-') {
+      if (fscanf(file, "%d", &last) != 1) break;
+      separator = fgetc(file);
+    }
+    for (int cpu = first; cpu <= last; cpu++) processors.push_back(cpu);
+    if (separator != ',') break;
+  }
+  fclose(file);
+#endif
+  return processors;
+}
+
 }  // namespace base
 }  // namespace v8
@@ -7,6 +7,8 @@
 
 #include <stdint.h>
 
+#include <vector>
+
 #include "src/base/base-export.h"
 #include "src/base/compiler-specific.h"
 
@@ -24,6 +26,11 @@ class V8_BASE_EXPORT SysInfo final {
   // Returns the number of bytes of virtual memory of this process. A return
   // value of zero means that there is no limit on the available virtual memory.
   static int64_t AmountOfVirtualMemory();
+
+  // Returns the logical processors that belong to the given NUMA node, or an
+  // empty vector if the node does not exist or the topology is unknown. Only
+  // implemented on Linux.
+  static std::vector<int> ProcessorsOfNumaNode(int node);
 };
 
 }  // namespace base
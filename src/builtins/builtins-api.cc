@@ -2,12 +2,17 @@
 // Use of this source code is governed by a BSD-style license that can be
 // found in the LICENSE file.
 
+#include <utility>
+
+#include "include/v8-fast-api-calls.h"
 #include "src/api/api-arguments-inl.h"
 #include "src/api/api-natives.h"
 #include "src/builtins/builtins-utils-inl.h"
 #include "src/builtins/builtins.h"
 #include "src/logging/counters.h"
 #include "src/logging/log.h"
+#include "src/numbers/conversions-inl.h"
+#include "src/objects/js-array-buffer-inl.h"
 #include "src/objects/objects-inl.h"
 #include "src/objects/prototype.h"
 #include "src/objects/templates.h"
@@ -46,6 +51,170 @@ JSReceiver GetCompatibleReceiver(Isolate* isolate, FunctionTemplateInfo info,
   return JSReceiver();
 }
 
+#if V8_HOST_ARCH_X64 || V8_HOST_ARCH_ARM64
+
+// Maximum number of C parameters of a fast API function that can be called
+// from HandleApiCall, including the receiver but not the trailing fallback
+// parameter.
+constexpr int kMaxFastApiCallArgumentCount = 8;
+
+// Backing store for the structs that are passed by pointer to fast API
+// functions.
+union FastApiCallArgumentStorage {
+  FastApiArrayBufferView array_buffer_view;
+  FastOneByteString one_byte_string;
+};
+
+// Converts the receiver and the JS arguments to the C parameters expected by
+// {signature}. All supported C types are passed in general purpose registers
+// or word sized stack slots on x64 and arm64, so each parameter is stored as
+// an uintptr_t. Returns false if a parameter type is not supported here or if
+// an argument does not have the expected type; the regular callback has to be
+// used in that case.
+bool PrepareFastApiCallArguments(Isolate* isolate,
+                                 const CFunctionInfo* signature,
+                                 JSReceiver receiver, BuiltinArguments* args,
+                                 uintptr_t* c_args,
+                                 FastApiCallArgumentStorage* storage,
+                                 const DisallowHeapAllocation& no_gc) {
+  const int c_arg_count = static_cast<int>(signature->ArgumentCount());
+  if (c_arg_count < 1 || c_arg_count > kMaxFastApiCallArgumentCount) {
+    return false;
+  }
+  if (signature->ReturnInfo().GetType() != CTypeInfo::Type::kVoid) {
+    return false;
+  }
+  ReadOnlyRoots roots(isolate);
+  for (int i = 0; i < c_arg_count; ++i) {
+    const CTypeInfo& info = signature->ArgumentInfo(i);
+    if (info.IsArray()) return false;
+    // C parameter 0 is the receiver, C parameter i is JS argument i - 1,
+    // which is at index i of {args}. Missing arguments are undefined.
+    Object value = i == 0 ? receiver
+                          : i < args->length() ? (*args)[i]
+                                               : roots.undefined_value();
+    switch (info.GetType()) {
+      case CTypeInfo::Type::kV8Value:
+        c_args[i] = value.ptr();
+        break;
+      case CTypeInfo::Type::kBool:
+        if (!value.IsBoolean(isolate)) return false;
+        c_args[i] = value.IsTrue(isolate) ? 1 : 0;
+        break;
+      case CTypeInfo::Type::kInt32:
+        if (!value.IsNumber()) return false;
+        c_args[i] = static_cast<uint32_t>(DoubleToInt32(value.Number()));
+        break;
+      case CTypeInfo::Type::kUint32:
+        if (!value.IsNumber()) return false;
+        c_args[i] = DoubleToUint32(value.Number());
+        break;
+      case CTypeInfo::Type::kInt64: {
+        if (!value.IsNumber()) return false;
+        double number = value.Number();
+        if (std::trunc(number) != number ||
+            std::abs(number) > kMaxSafeInteger) {
+          return false;
+        }
+        c_args[i] = static_cast<uintptr_t>(static_cast<int64_t>(number));
+        break;
+      }
+      case CTypeInfo::Type::kArrayBufferView: {
+        if (!value.IsJSArrayBufferView()) return false;
+        JSArrayBufferView view = JSArrayBufferView::cast(value);
+        if (view.WasDetached()) return false;
+        void* data;
+        if (view.IsJSTypedArray()) {
+          data = JSTypedArray::cast(view).DataPtr();
+        } else if (view.IsJSDataView()) {
+          data = JSDataView::cast(view).data_pointer();
+        } else {
+          return false;
+        }
+        storage[i].array_buffer_view = {data, view.byte_length()};
+        c_args[i] = reinterpret_cast<uintptr_t>(&storage[i].array_buffer_view);
+        break;
+      }
+      case CTypeInfo::Type::kOneByteString: {
+        if (!value.IsSeqOneByteString()) return false;
+        SeqOneByteString string = SeqOneByteString::cast(value);
+        storage[i].one_byte_string = {
+            reinterpret_cast<const char*>(string.GetChars(no_gc)),
+            static_cast<uint32_t>(string.length())};
+        c_args[i] = reinterpret_cast<uintptr_t>(&storage[i].one_byte_string);
+        break;
+      }
+      case CTypeInfo::Type::kVoid:
+      case CTypeInfo::Type::kUint64:
+      case CTypeInfo::Type::kFloat32:
+      case CTypeInfo::Type::kFloat64:
+        return false;
+    }
+  }
+  return true;
+}
+
+template <size_t>
+using FastApiCallWord = uintptr_t;
+
+template <size_t... kIndices>
+void CallFastApiFunction(Address c_function, const uintptr_t* c_args,
+                         int* fallback, std::index_sequence<kIndices...>) {
+  using Function = void (*)(FastApiCallWord<kIndices>..., int*);
+  reinterpret_cast<Function>(c_function)(c_args[kIndices]..., fallback);
+}
+
+// Calls the fast C function of {fun_data} directly if it has one and the
+// arguments match its signature. This gives calls from the interpreter and
+// from baseline code the same fast path that TurboFan inlines with
+// --turbo-fast-api-calls. Returns false if the regular callback still has to
+// be called, either because the fast path does not apply or because the C
+// function requested the fallback.
+bool TryCallFastApiFunction(Isolate* isolate, FunctionTemplateInfo fun_data,
+                            JSReceiver receiver, BuiltinArguments* args) {
+  Address c_function = v8::ToCData<Address>(fun_data.GetCFunction());
+  const CFunctionInfo* signature =
+      v8::ToCData<CFunctionInfo*>(fun_data.GetCSignature());
+  if (c_function == kNullAddress || signature == nullptr) return false;
+  // Side effect checks are only implemented for the regular callback.
+  if (isolate->debug_execution_mode() == DebugInfo::kSideEffects) return false;
+
+  DisallowHeapAllocation no_gc;
+  uintptr_t c_args[kMaxFastApiCallArgumentCount];
+  FastApiCallArgumentStorage storage[kMaxFastApiCallArgumentCount];
+  if (!PrepareFastApiCallArguments(isolate, signature, receiver, args, c_args,
+                                   storage, no_gc)) {
+    return false;
+  }
+
+  int fallback = 0;
+  {
+    VMState<EXTERNAL> state(isolate);
+    ExternalCallbackScope call_scope(isolate, c_function);
+    switch (signature->ArgumentCount()) {
+#define CASE(N)                                                                \
+  case N:                                                                      \
+    CallFastApiFunction(c_function, c_args, &fallback,                         \
+                        std::make_index_sequence<N>());                        \
+    break;
+      CASE(1)
+      CASE(2)
+      CASE(3)
+      CASE(4)
+      CASE(5)
+      CASE(6)
+      CASE(7)
+      CASE(8)
+#undef CASE
+      default:
+        UNREACHABLE();
+    }
+  }
+  return fallback == 0;
+}
+
+#endif  // V8_HOST_ARCH_X64 || V8_HOST_ARCH_ARM64
+
 template <bool is_construct>
 V8_WARN_UNUSED_RESULT MaybeHandle<Object> HandleApiCallHelper(
     Isolate* isolate, Handle<HeapObject> function,
@@ -97,6 +266,13 @@ V8_WARN_UNUSED_RESULT MaybeHandle<Object> HandleApiCallHelper(
       THROW_NEW_ERROR(
           isolate, NewTypeError(MessageTemplate::kIllegalInvocation), Object);
     }
+
+#if V8_HOST_ARCH_X64 || V8_HOST_ARCH_ARM64
+    if (FLAG_fast_api_calls_from_builtins &&
+        TryCallFastApiFunction(isolate, *fun_data, *js_receiver, &args)) {
+      return isolate->factory()->undefined_value();
+    }
+#endif  // V8_HOST_ARCH_X64 || V8_HOST_ARCH_ARM64
   }
 
   Object raw_call_data = fun_data->call_code();
@@ -24,6 +24,26 @@ class ValueUnwrapContext {
 
 }  // namespace
 
+void AsyncBuiltinsAssembler::InitializeAwaitContext(
+    TNode<NativeContext> native_context, TNode<Context> closure_context,
+    TNode<JSGeneratorObject> generator) {
+  // Initialize the await context, storing the {generator} as extension.
+  TNode<Map> map = CAST(
+      LoadContextElement(native_context, Context::AWAIT_CONTEXT_MAP_INDEX));
+  StoreMapNoWriteBarrier(closure_context, map);
+  StoreObjectFieldNoWriteBarrier(
+      closure_context, Context::kLengthOffset,
+      SmiConstant(Context::MIN_CONTEXT_EXTENDED_SLOTS));
+  const TNode<Object> empty_scope_info =
+      LoadContextElement(native_context, Context::SCOPE_INFO_INDEX);
+  StoreContextElementNoWriteBarrier(closure_context, Context::SCOPE_INFO_INDEX,
+                                    empty_scope_info);
+  StoreContextElementNoWriteBarrier(closure_context, Context::PREVIOUS_INDEX,
+                                    native_context);
+  StoreContextElementNoWriteBarrier(closure_context, Context::EXTENSION_INDEX,
+                                    generator);
+}
+
 TNode<Object> AsyncBuiltinsAssembler::AwaitOld(
     TNode<Context> context, TNode<JSGeneratorObject> generator,
     TNode<Object> value, TNode<JSPromise> outer_promise,
@@ -43,23 +63,7 @@ TNode<Object> AsyncBuiltinsAssembler::AwaitOld(
 
   TNode<HeapObject> base = AllocateInNewSpace(kTotalSize);
   TNode<Context> closure_context = UncheckedCast<Context>(base);
-  {
-    // Initialize the await context, storing the {generator} as extension.
-    TNode<Map> map = CAST(
-        LoadContextElement(native_context, Context::AWAIT_CONTEXT_MAP_INDEX));
-    StoreMapNoWriteBarrier(closure_context, map);
-    StoreObjectFieldNoWriteBarrier(
-        closure_context, Context::kLengthOffset,
-        SmiConstant(Context::MIN_CONTEXT_EXTENDED_SLOTS));
-    const TNode<Object> empty_scope_info =
-        LoadContextElement(native_context, Context::SCOPE_INFO_INDEX);
-    StoreContextElementNoWriteBarrier(
-        closure_context, Context::SCOPE_INFO_INDEX, empty_scope_info);
-    StoreContextElementNoWriteBarrier(closure_context, Context::PREVIOUS_INDEX,
-                                      native_context);
-    StoreContextElementNoWriteBarrier(closure_context, Context::EXTENSION_INDEX,
-                                      generator);
-  }
+  InitializeAwaitContext(native_context, closure_context, generator);
 
   // Let promiseCapability be ! NewPromiseCapability(%Promise%).
   const TNode<JSFunction> promise_fun =
@@ -140,23 +144,7 @@ TNode<Object> AsyncBuiltinsAssembler::AwaitOptimized(
 
   TNode<HeapObject> base = AllocateInNewSpace(kTotalSize);
   TNode<Context> closure_context = UncheckedCast<Context>(base);
-  {
-    // Initialize the await context, storing the {generator} as extension.
-    TNode<Map> map = CAST(
-        LoadContextElement(native_context, Context::AWAIT_CONTEXT_MAP_INDEX));
-    StoreMapNoWriteBarrier(closure_context, map);
-    StoreObjectFieldNoWriteBarrier(
-        closure_context, Context::kLengthOffset,
-        SmiConstant(Context::MIN_CONTEXT_EXTENDED_SLOTS));
-    const TNode<Object> empty_scope_info =
-        LoadContextElement(native_context, Context::SCOPE_INFO_INDEX);
-    StoreContextElementNoWriteBarrier(
-        closure_context, Context::SCOPE_INFO_INDEX, empty_scope_info);
-    StoreContextElementNoWriteBarrier(closure_context, Context::PREVIOUS_INDEX,
-                                      native_context);
-    StoreContextElementNoWriteBarrier(closure_context, Context::EXTENSION_INDEX,
-                                      generator);
-  }
+  InitializeAwaitContext(native_context, closure_context, generator);
 
   // Initialize resolve handler
   TNode<HeapObject> on_resolve = InnerAllocate(base, kResolveClosureOffset);
@@ -187,6 +175,32 @@ TNode<Object> AsyncBuiltinsAssembler::AwaitOptimized(
                      on_resolve, on_reject, var_throwaway.value());
 }
 
+TNode<Object> AsyncBuiltinsAssembler::AwaitPrimitive(
+    TNode<Context> context, TNode<JSGeneratorObject> generator,
+    TNode<Object> value, TNode<SharedFunctionInfo> on_resolve_sfi) {
+  const TNode<NativeContext> native_context = LoadNativeContext(context);
+
+  static const int kResolveClosureOffset =
+      FixedArray::SizeFor(Context::MIN_CONTEXT_EXTENDED_SLOTS);
+  static const int kTotalSize =
+      kResolveClosureOffset + JSFunction::kSizeWithoutPrototype;
+
+  // The promise that {value} would be wrapped in is fulfilled right away, so
+  // the resume job can be enqueued directly. Neither that promise nor the
+  // reject handler are observable.
+  TNode<HeapObject> base = AllocateInNewSpace(kTotalSize);
+  TNode<Context> closure_context = UncheckedCast<Context>(base);
+  InitializeAwaitContext(native_context, closure_context, generator);
+
+  // Initialize resolve handler
+  TNode<HeapObject> on_resolve = InnerAllocate(base, kResolveClosureOffset);
+  InitializeNativeClosure(closure_context, native_context, on_resolve,
+                          on_resolve_sfi);
+
+  EnqueueAwaitFulfillReactionJob(context, value, CAST(on_resolve));
+  return UndefinedConstant();
+}
+
 TNode<Object> AsyncBuiltinsAssembler::Await(
     TNode<Context> context, TNode<JSGeneratorObject> generator,
     TNode<Object> value, TNode<JSPromise> outer_promise,
@@ -194,7 +208,7 @@ TNode<Object> AsyncBuiltinsAssembler::Await(
     TNode<SharedFunctionInfo> on_reject_sfi,
     TNode<Oddball> is_predicted_as_caught) {
   TVARIABLE(Object, result);
-  Label if_old(this), if_new(this), done(this),
+  Label if_old(this), if_new(this), if_primitive(this), done(this),
       if_slow_constructor(this, Label::kDeferred);
 
   // We do the `PromiseResolve(%Promise%,value)` avoiding to unnecessarily
@@ -202,9 +216,10 @@ TNode<Object> AsyncBuiltinsAssembler::Await(
   // intrinsics %Promise% constructor as its "constructor", we don't need
   // to allocate the wrapper promise and can just use the `AwaitOptimized`
   // logic.
-  GotoIf(TaggedIsSmi(value), &if_old);
+  GotoIf(TaggedIsSmi(value), &if_primitive);
   TNode<HeapObject> value_object = CAST(value);
   const TNode<Map> value_map = LoadMap(value_object);
+  GotoIfNot(IsJSReceiverMap(value_map), &if_primitive);
   GotoIfNot(IsJSPromiseMap(value_map), &if_old);
   // We can skip the "constructor" lookup on {value} if it's [[Prototype]]
   // is the (initial) Promise.prototype and the @@species protector is
@@ -229,6 +244,14 @@ TNode<Object> AsyncBuiltinsAssembler::Await(
     Branch(TaggedEqual(value_constructor, promise_function), &if_new, &if_old);
   }
 
+  // Primitives are never thenable, so unless the wrapper promise needs to be
+  // observed, awaiting them only has to schedule the resume job.
+  BIND(&if_primitive);
+  GotoIf(IsPromiseHookEnabledOrDebugIsActiveOrHasAsyncEventDelegate(),
+         &if_old);
+  result = AwaitPrimitive(context, generator, value, on_resolve_sfi);
+  Goto(&done);
+
   BIND(&if_old);
   result = AwaitOld(context, generator, value, outer_promise, on_resolve_sfi,
                     on_reject_sfi, is_predicted_as_caught);
@@ -48,6 +48,9 @@ class AsyncBuiltinsAssembler : public PromiseBuiltinsAssembler {
                                TNode<SharedFunctionInfo> shared_info);
   TNode<Context> AllocateAsyncIteratorValueUnwrapContext(
       TNode<NativeContext> native_context, TNode<Oddball> done);
+  void InitializeAwaitContext(TNode<NativeContext> native_context,
+                              TNode<Context> closure_context,
+                              TNode<JSGeneratorObject> generator);
 
   TNode<Object> AwaitOld(TNode<Context> context,
                          TNode<JSGeneratorObject> generator,
@@ -55,6 +58,12 @@ class AsyncBuiltinsAssembler : public PromiseBuiltinsAssembler {
                          TNode<SharedFunctionInfo> on_resolve_sfi,
                          TNode<SharedFunctionInfo> on_reject_sfi,
                          TNode<Oddball> is_predicted_as_caught);
+  // Await for values which are not JSReceivers, when no promise hooks or
+  // debugger are active.
+  TNode<Object> AwaitPrimitive(TNode<Context> context,
+                               TNode<JSGeneratorObject> generator,
+                               TNode<Object> value,
+                               TNode<SharedFunctionInfo> on_resolve_sfi);
   TNode<Object> AwaitOptimized(TNode<Context> context,
                                TNode<JSGeneratorObject> generator,
                                TNode<JSPromise> promise,
@@ -2422,6 +2422,23 @@ TF_BUILTIN(FindOrderedHashMapEntry, CollectionsBuiltinsAssembler) {
   Return(SmiConstant(-1));
 }
 
+TF_BUILTIN(FindOrderedHashSetEntry, CollectionsBuiltinsAssembler) {
+  const TNode<OrderedHashSet> table = CAST(Parameter(Descriptor::kTable));
+  const TNode<Object> key = CAST(Parameter(Descriptor::kKey));
+
+  TVARIABLE(IntPtrT, entry_start_position, IntPtrConstant(0));
+  Label entry_found(this), not_found(this);
+
+  TryLookupOrderedHashTableIndex<OrderedHashSet>(
+      table, key, &entry_start_position, &entry_found, &not_found);
+
+  BIND(&entry_found);
+  Return(SmiTag(entry_start_position.value()));
+
+  BIND(&not_found);
+  Return(SmiConstant(-1));
+}
+
 class WeakCollectionsBuiltinsAssembler : public BaseCollectionsAssembler {
  public:
   explicit WeakCollectionsBuiltinsAssembler(compiler::CodeAssemblerState* state)
@@ -712,6 +712,7 @@ namespace internal {
   ASM(RegExpInterpreterTrampoline, CCall)                                      \
                                                                                \
   /* Set */                                                                    \
+  TFS(FindOrderedHashSetEntry, kTable, kKey)                                   \
   TFJ(SetConstructor, kDontAdaptArgumentsSentinel)                             \
   TFJ(SetPrototypeHas, 1, kReceiver, kKey)                                     \
   TFJ(SetPrototypeAdd, 1, kReceiver, kKey)                                     \
@@ -38,6 +38,7 @@ class MicrotaskQueueBuiltinsAssembler : public CodeStubAssembler {
   void RunSingleMicrotask(TNode<Context> current_context,
                           TNode<Microtask> microtask);
   void IncrementFinishedMicrotaskCount(TNode<RawPtrT> microtask_queue);
+  TNode<BoolT> FinishedMicrotaskLimitReached(TNode<RawPtrT> microtask_queue);
 
   TNode<Context> GetCurrentContext();
   void SetCurrentContext(TNode<Context> context);
@@ -348,6 +349,17 @@ void MicrotaskQueueBuiltinsAssembler::IncrementFinishedMicrotaskCount(
       IntPtrConstant(MicrotaskQueue::kFinishedMicrotaskCountOffset), new_count);
 }
 
+TNode<BoolT> MicrotaskQueueBuiltinsAssembler::FinishedMicrotaskLimitReached(
+    TNode<RawPtrT> microtask_queue) {
+  TNode<IntPtrT> count = Load<IntPtrT>(
+      microtask_queue,
+      IntPtrConstant(MicrotaskQueue::kFinishedMicrotaskCountOffset));
+  TNode<IntPtrT> limit = Load<IntPtrT>(
+      microtask_queue,
+      IntPtrConstant(MicrotaskQueue::kFinishedMicrotaskLimitOffset));
+  return IntPtrGreaterThanOrEqual(count, limit);
+}
+
 TNode<Context> MicrotaskQueueBuiltinsAssembler::GetCurrentContext() {
   auto ref = ExternalReference::Create(kContextAddress, isolate());
   // TODO(delphick): Add a checked cast. For now this is not possible as context
@@ -550,8 +562,9 @@ TF_BUILTIN(RunMicrotasks, MicrotaskQueueBuiltinsAssembler) {
 
   TNode<IntPtrT> size = GetMicrotaskQueueSize(microtask_queue);
 
-  // Exit if the queue is empty.
+  // Exit if the queue is empty, or if the caller's limit has been reached.
   GotoIf(WordEqual(size, IntPtrConstant(0)), &done);
+  GotoIf(FinishedMicrotaskLimitReached(microtask_queue), &done);
 
   TNode<RawPtrT> ring_buffer = GetMicrotaskRingBuffer(microtask_queue);
   TNode<IntPtrT> capacity = GetMicrotaskQueueCapacity(microtask_queue);
@@ -218,15 +218,31 @@ void ProxiesCodeStubAssembler::CheckGetSetTrapResult(
   TVARIABLE(Uint32T, var_details);
   TVARIABLE(Object, var_raw_value);
 
-  Label if_found_value(this), check_in_runtime(this, Label::kDeferred),
-      check_passed(this);
+  Label if_found_value(this), if_index(this),
+      check_in_runtime(this, Label::kDeferred), check_passed(this);
 
-  GotoIfNot(IsUniqueNameNoIndex(name), &check_in_runtime);
+  GotoIfNot(IsUniqueNameNoIndex(name), &if_index);
   TNode<Uint16T> instance_type = LoadInstanceType(target);
   TryGetOwnProperty(context, target, target, map, instance_type, name,
                     &if_found_value, &var_value, &var_details, &var_raw_value,
                     &check_passed, &check_in_runtime, kReturnAccessorPair);
 
+  BIND(&if_index);
+  {
+    // Elements in fast (and thus extensible) backing stores are always
+    // configurable, so the {trap_result} cannot violate any invariant for
+    // them. Only cached array indices are guaranteed to denote elements
+    // here, larger integer indices might be named properties.
+    GotoIf(IsSetWord32(LoadNameHashField(name),
+                       Name::kDoesNotContainCachedArrayIndexMask),
+           &check_in_runtime);
+    GotoIf(IsCustomElementsReceiverInstanceType(LoadMapInstanceType(map)),
+           &check_in_runtime);
+    Branch(IsElementsKindLessThanOrEqual(LoadMapElementsKind(map),
+                                         LAST_FAST_ELEMENTS_KIND),
+           &check_passed, &check_in_runtime);
+  }
+
   BIND(&if_found_value);
   {
     Label throw_non_configurable_data(this, Label::kDeferred),
@@ -250,10 +250,11 @@ TNode<JSRegExpResult> RegExpBuiltinsAssembler::ConstructNewResultFromMatchInfo(
         CAST(LoadObjectField(regexp, JSRegExp::kDataOffset));
 
     // We reach this point only if captures exist, implying that this is an
-    // IRREGEXP JSRegExp.
-    CSA_ASSERT(this,
-               SmiEqual(CAST(LoadFixedArrayElement(data, JSRegExp::kTagIndex)),
-                        SmiConstant(JSRegExp::IRREGEXP)));
+    // IRREGEXP or EXPERIMENTAL JSRegExp.
+    CSA_ASSERT(
+        this,
+        SmiNotEqual(CAST(LoadFixedArrayElement(data, JSRegExp::kTagIndex)),
+                    SmiConstant(JSRegExp::ATOM)));
 
     // The names fixed array associates names at even indices with a capture
     // index at odd indices.
@@ -400,8 +401,9 @@ TNode<HeapObject> RegExpBuiltinsAssembler::RegExpExecInternal(
           JSRegExp::IRREGEXP,
           JSRegExp::ATOM,
           JSRegExp::NOT_COMPILED,
+          JSRegExp::EXPERIMENTAL,
       };
-      Label* labels[] = {&next, &atom, &runtime};
+      Label* labels[] = {&next, &atom, &runtime, &runtime};
 
       STATIC_ASSERT(arraysize(values) == arraysize(labels));
       Switch(tag, &unreachable, values, labels, arraysize(values));
@@ -585,8 +587,12 @@ TNode<HeapObject> RegExpBuiltinsAssembler::RegExpExecInternal(
                        IntPtrConstant(RegExp::kInternalRegExpException)),
            &if_exception);
 
-    CSA_ASSERT(this, IntPtrEqual(int_result,
-                                 IntPtrConstant(RegExp::kInternalRegExpRetry)));
+    // Retries and fallbacks to the experimental engine go through the runtime.
+    STATIC_ASSERT(RegExp::kInternalRegExpFallbackToExperimental <
+                  RegExp::kInternalRegExpRetry);
+    CSA_ASSERT(this, IntPtrLessThanOrEqual(
+                         int_result,
+                         IntPtrConstant(RegExp::kInternalRegExpRetry)));
     Goto(&runtime);
   }
 
@@ -27,6 +27,14 @@ class ProfileDataFromFile {
                                                  : 0;
   }
 
+  // Returns the sum of all block counters, which approximates how much of the
+  // builtin's code was executed during profiling.
+  uint64_t GetTotalCount() const {
+    uint64_t total = 0;
+    for (uint32_t count : block_counts_by_id_) total += count;
+    return total;
+  }
+
   // Load basic block profiling data for the builtin with the given name, if
   // such data exists. The returned vector is indexed by block ID, and its
   // values are the number of times each block was executed while profiling.
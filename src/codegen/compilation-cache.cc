@@ -6,6 +6,7 @@
 
 #include "src/common/globals.h"
 #include "src/heap/factory.h"
+#include "src/heap/heap.h"
 #include "src/logging/counters.h"
 #include "src/logging/log.h"
 #include "src/objects/compilation-cache-inl.h"
@@ -66,14 +67,26 @@ void CompilationSubCache::AgeByGeneration(CompilationSubCache* c) {
 }
 
 // static
-void CompilationSubCache::AgeCustom(CompilationSubCache* c) {
+void CompilationSubCache::AgeCustom(CompilationSubCache* c,
+                                    int max_retained_entries) {
   DCHECK_EQ(c->generations(), 1);
   if (c->tables_[0].IsUndefined(c->isolate())) return;
-  CompilationCacheTable::cast(c->tables_[0]).Age();
+  CompilationCacheTable table = CompilationCacheTable::cast(c->tables_[0]);
+  table.Age(table.NumberOfElements() > max_retained_entries);
 }
 
 void CompilationCacheScript::Age() { AgeCustom(this); }
-void CompilationCacheEval::Age() { AgeCustom(this); }
+
+void CompilationCacheEval::Age() {
+  // Sources passed to eval and the Function constructor are often compiled
+  // again long after the resulting code got old, so keep a bounded number of
+  // entries alive across GCs while memory allows.
+  int max_retained_entries =
+      isolate()->heap()->ShouldOptimizeForMemoryUsage()
+          ? 0
+          : FLAG_compilation_cache_eval_retained_entries;
+  AgeCustom(this, max_retained_entries);
+}
 void CompilationCacheRegExp::Age() { AgeByGeneration(this); }
 void CompilationCacheCode::Age() {
   if (FLAG_trace_turbo_nci) CompilationCacheCode::TraceAgeing();
@@ -212,8 +225,10 @@ InfoCellPair CompilationCacheEval::Lookup(Handle<String> source,
       table, source, outer_info, native_context, language_mode, position);
   if (result.has_shared()) {
     isolate()->counters()->compilation_cache_hits()->Increment();
+    isolate()->counters()->compilation_cache_eval_hits()->Increment();
   } else {
     isolate()->counters()->compilation_cache_misses()->Increment();
+    isolate()->counters()->compilation_cache_eval_misses()->Increment();
   }
   return result;
 }
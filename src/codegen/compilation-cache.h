@@ -64,9 +64,11 @@ class CompilationSubCache {
   Isolate* isolate() const { return isolate_; }
 
   // Ageing occurs either by removing the oldest generation, or with
-  // custom logic implemented in CompilationCacheTable::Age.
+  // custom logic implemented in CompilationCacheTable::Age. Live entries
+  // with old code are only evicted once the table holds more than
+  // |max_retained_entries| elements.
   static void AgeByGeneration(CompilationSubCache* c);
-  static void AgeCustom(CompilationSubCache* c);
+  static void AgeCustom(CompilationSubCache* c, int max_retained_entries = 0);
 
  private:
   Isolate* const isolate_;
@@ -867,6 +867,11 @@ V8_WARN_UNUSED_RESULT MaybeHandle<Code> GetCodeFromOptimizedCodeCache(
                .native_context()
                .GetOSROptimizedCodeCache()
                .GetOptimizedCode(shared, osr_offset, isolate);
+    if (code.is_null()) {
+      isolate->counters()->osr_code_cache_misses()->Increment();
+    } else {
+      isolate->counters()->osr_code_cache_hits()->Increment();
+    }
   }
   if (!code.is_null()) {
     // Caching of optimized code enabled and optimized code found.
@@ -1374,13 +1379,19 @@ MaybeHandle<SharedFunctionInfo> CompileToplevel(
                          is_compiled_scope);
 }
 
+UnoptimizedCompileFlags StreamingCompileFlags(Isolate* isolate,
+                                              ScriptType type) {
+  UnoptimizedCompileFlags flags = UnoptimizedCompileFlags::ForToplevelCompile(
+      isolate, true, construct_language_mode(FLAG_use_strict), REPLMode::kNo);
+  flags.set_is_module(type == ScriptType::kModule);
+  return flags;
+}
+
 }  // namespace
 
 BackgroundCompileTask::BackgroundCompileTask(ScriptStreamingData* streamed_data,
-                                             Isolate* isolate)
-    : flags_(UnoptimizedCompileFlags::ForToplevelCompile(
-          isolate, true, construct_language_mode(FLAG_use_strict),
-          REPLMode::kNo)),
+                                             Isolate* isolate, ScriptType type)
+    : flags_(StreamingCompileFlags(isolate, type)),
       compile_state_(isolate),
       info_(std::make_unique<ParseInfo>(isolate, flags_, &compile_state_)),
       start_position_(0),
@@ -1404,8 +1415,11 @@ BackgroundCompileTask::BackgroundCompileTask(ScriptStreamingData* streamed_data,
   info_->set_character_stream(std::move(stream));
 
   // TODO(leszeks): Add block coverage support to off-thread finalization.
-  finalize_on_background_thread_ =
-      FLAG_finalize_streaming_on_background && !flags_.block_coverage_enabled();
+  // Streamed modules are always finalized on the main thread, like modules
+  // compiled without streaming.
+  finalize_on_background_thread_ = FLAG_finalize_streaming_on_background &&
+                                   !flags_.block_coverage_enabled() &&
+                                   !flags_.is_module();
   if (finalize_on_background_thread()) {
     off_thread_isolate_ =
         std::make_unique<OffThreadIsolate>(isolate, info_->zone());
@@ -1452,6 +1466,35 @@ BackgroundCompileTask::BackgroundCompileTask(
 
 BackgroundCompileTask::~BackgroundCompileTask() = default;
 
+BackgroundDeserializeTask::BackgroundDeserializeTask(
+    Isolate* isolate, std::unique_ptr<ScriptCompiler::CachedData> cached_data)
+    : cached_data_(std::move(cached_data)),
+      script_data_(cached_data_->data, cached_data_->length),
+      zone_(isolate->allocator(), "Deserialize"),
+      off_thread_isolate_(isolate, &zone_) {}
+
+void BackgroundDeserializeTask::Run() {
+  DCHECK(!has_run_);
+  TRACE_EVENT0(TRACE_DISABLED_BY_DEFAULT("v8.compile"),
+               "V8.DeserializeBackground");
+  off_thread_data_ =
+      CodeSerializer::StartDeserializeOffThread(&off_thread_isolate_,
+                                                &script_data_);
+  has_run_ = true;
+}
+
+MaybeHandle<SharedFunctionInfo> BackgroundDeserializeTask::Finish(
+    Isolate* isolate, Handle<String> source,
+    ScriptOriginOptions origin_options) {
+  if (!has_run_) {
+    return CodeSerializer::Deserialize(isolate, &script_data_, source,
+                                       origin_options);
+  }
+  return CodeSerializer::FinishOffThreadDeserialize(
+      isolate, &off_thread_isolate_, std::move(off_thread_data_),
+      &script_data_, source, origin_options);
+}
+
 namespace {
 
 // A scope object that ensures a parse info's runtime call stats and stack limit
@@ -2404,13 +2447,15 @@ MaybeHandle<SharedFunctionInfo> CompileScriptOnMainThread(
 
 class StressBackgroundCompileThread : public base::Thread {
  public:
-  StressBackgroundCompileThread(Isolate* isolate, Handle<String> source)
+  StressBackgroundCompileThread(Isolate* isolate, Handle<String> source,
+                                ScriptType type)
       : base::Thread(
             base::Thread::Options("StressBackgroundCompileThread", 2 * i::MB)),
         source_(source),
         streamed_source_(std::make_unique<SourceStream>(source, isolate),
                          v8::ScriptCompiler::StreamedSource::UTF8) {
-    data()->task = std::make_unique<i::BackgroundCompileTask>(data(), isolate);
+    data()->task =
+        std::make_unique<i::BackgroundCompileTask>(data(), isolate, type);
   }
 
   void Run() override { data()->task->Run(); }
@@ -2452,9 +2497,7 @@ bool CanBackgroundCompile(const Compiler::ScriptDetails& script_details,
                           v8::Extension* extension,
                           ScriptCompiler::CompileOptions compile_options,
                           NativesFlag natives) {
-  // TODO(leszeks): Remove the module check once background compilation of
-  // modules is supported.
-  return !origin_options.IsModule() && !extension &&
+  return !extension &&
          script_details.repl_mode == REPLMode::kNo &&
          compile_options == ScriptCompiler::kNoCompileOptions &&
          natives == NOT_NATIVES_CODE;
@@ -2475,7 +2518,9 @@ MaybeHandle<SharedFunctionInfo> CompileScriptOnBothBackgroundAndMainThread(
     ScriptOriginOptions origin_options, Isolate* isolate,
     IsCompiledScope* is_compiled_scope) {
   // Start a background thread compiling the script.
-  StressBackgroundCompileThread background_compile_thread(isolate, source);
+  StressBackgroundCompileThread background_compile_thread(
+      isolate, source,
+      origin_options.IsModule() ? ScriptType::kModule : ScriptType::kClassic);
 
   UnoptimizedCompileFlags flags_copy =
       background_compile_thread.data()->task->flags();
@@ -2536,15 +2581,17 @@ MaybeHandle<SharedFunctionInfo> Compiler::GetSharedFunctionInfoForScript(
     const Compiler::ScriptDetails& script_details,
     ScriptOriginOptions origin_options, v8::Extension* extension,
     ScriptData* cached_data, ScriptCompiler::CompileOptions compile_options,
-    ScriptCompiler::NoCacheReason no_cache_reason, NativesFlag natives) {
+    ScriptCompiler::NoCacheReason no_cache_reason, NativesFlag natives,
+    BackgroundDeserializeTask* deserialize_task) {
   ScriptCompileTimerScope compile_timer(isolate, no_cache_reason);
 
   if (compile_options == ScriptCompiler::kNoCompileOptions ||
       compile_options == ScriptCompiler::kEagerCompile) {
     DCHECK_NULL(cached_data);
+    DCHECK_NULL(deserialize_task);
   } else {
     DCHECK(compile_options == ScriptCompiler::kConsumeCodeCache);
-    DCHECK(cached_data);
+    DCHECK_NE(cached_data == nullptr, deserialize_task == nullptr);
     DCHECK_NULL(extension);
   }
   int source_length = source->length();
@@ -2579,10 +2626,13 @@ MaybeHandle<SharedFunctionInfo> Compiler::GetSharedFunctionInfoForScript(
           isolate, RuntimeCallCounterId::kCompileDeserialize);
       TRACE_EVENT0(TRACE_DISABLED_BY_DEFAULT("v8.compile"),
                    "V8.CompileDeserialize");
+      MaybeHandle<SharedFunctionInfo> maybe_deserialized =
+          deserialize_task != nullptr
+              ? deserialize_task->Finish(isolate, source, origin_options)
+              : CodeSerializer::Deserialize(isolate, cached_data, source,
+                                            origin_options);
       Handle<SharedFunctionInfo> inner_result;
-      if (CodeSerializer::Deserialize(isolate, cached_data, source,
-                                      origin_options)
-              .ToHandle(&inner_result) &&
+      if (maybe_deserialized.ToHandle(&inner_result) &&
           inner_result->is_compiled()) {
         // Promote to per-isolate compilation cache.
         is_compiled_scope = inner_result->is_compiled_scope(isolate);
@@ -2733,7 +2783,6 @@ Compiler::GetSharedFunctionInfoForStreamedScript(
     Isolate* isolate, Handle<String> source,
     const ScriptDetails& script_details, ScriptOriginOptions origin_options,
     ScriptStreamingData* streaming_data) {
-  DCHECK(!origin_options.IsModule());
   DCHECK(!origin_options.IsWasm());
 
   ScriptCompileTimerScope compile_timer(
@@ -2745,6 +2794,7 @@ Compiler::GetSharedFunctionInfoForStreamedScript(
   isolate->counters()->total_compile_size()->Increment(source_length);
 
   BackgroundCompileTask* task = streaming_data->task.get();
+  DCHECK_EQ(task->flags().is_module(), origin_options.IsModule());
 
   MaybeHandle<SharedFunctionInfo> maybe_result;
   // Check if compile cache already holds the SFI, if so no need to finalize
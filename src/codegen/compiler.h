@@ -17,6 +17,7 @@
 #include "src/objects/contexts.h"
 #include "src/parsing/parse-info.h"
 #include "src/parsing/pending-compilation-error-handler.h"
+#include "src/snapshot/code-serializer.h"
 #include "src/utils/allocation.h"
 #include "src/zone/zone.h"
 
@@ -26,6 +27,7 @@ namespace internal {
 // Forward declarations.
 class AstRawString;
 class BackgroundCompileTask;
+class BackgroundDeserializeTask;
 class IsCompiledScope;
 class JavaScriptFrame;
 class OptimizedCompilationInfo;
@@ -175,7 +177,8 @@ class V8_EXPORT_PRIVATE Compiler : public AllStatic {
       v8::Extension* extension, ScriptData* cached_data,
       ScriptCompiler::CompileOptions compile_options,
       ScriptCompiler::NoCacheReason no_cache_reason,
-      NativesFlag is_natives_code);
+      NativesFlag is_natives_code,
+      BackgroundDeserializeTask* deserialize_task = nullptr);
 
   // Create a shared function info object for a Script source that has already
   // been parsed and possibly compiled on a background thread while being loaded
@@ -464,7 +467,8 @@ class V8_EXPORT_PRIVATE BackgroundCompileTask {
   // script associated with |data| and can be finalized with
   // Compiler::GetSharedFunctionInfoForStreamedScript.
   // Note: does not take ownership of |data|.
-  BackgroundCompileTask(ScriptStreamingData* data, Isolate* isolate);
+  BackgroundCompileTask(ScriptStreamingData* data, Isolate* isolate,
+                        ScriptType type);
   ~BackgroundCompileTask();
 
   // Creates a new task that when run will parse and compile the
@@ -554,6 +558,37 @@ class V8_EXPORT_PRIVATE BackgroundCompileTask {
   DISALLOW_COPY_AND_ASSIGN(BackgroundCompileTask);
 };
 
+// A task that deserializes a code cache into an OffThreadIsolate, so that the
+// main thread only has to publish the result. Implements
+// v8::ScriptCompiler::ConsumeCodeCacheTask.
+class V8_EXPORT_PRIVATE BackgroundDeserializeTask {
+ public:
+  // Must be created on the main thread.
+  BackgroundDeserializeTask(Isolate* isolate,
+                            std::unique_ptr<ScriptCompiler::CachedData> data);
+
+  // Can be called on any thread, at most once.
+  void Run();
+
+  // Finishes deserialization on the main thread. Falls back to deserializing
+  // on the main thread if Run has not been called.
+  MaybeHandle<SharedFunctionInfo> Finish(Isolate* isolate,
+                                         Handle<String> source,
+                                         ScriptOriginOptions origin_options);
+
+  bool rejected() const { return script_data_.rejected(); }
+
+ private:
+  std::unique_ptr<ScriptCompiler::CachedData> cached_data_;
+  ScriptData script_data_;
+  Zone zone_;
+  OffThreadIsolate off_thread_isolate_;
+  OffThreadDeserializeData off_thread_data_;
+  bool has_run_ = false;
+
+  DISALLOW_COPY_AND_ASSIGN(BackgroundDeserializeTask);
+};
+
 // Contains all data which needs to be transmitted between threads for
 // background parsing and compiling and finalizing it on the main thread.
 struct ScriptStreamingData {
@@ -202,6 +202,12 @@ class V8_EXPORT_PRIVATE OptimizedCompilationInfo final {
                          Handle<BytecodeArray> inlined_bytecode,
                          SourcePosition pos);
 
+  // Functions whose calls were lowered without going through their code.
+  // Like inlined functions they are recorded in the deoptimization literals,
+  // so that the debugger finds this code when it breaks at their entry.
+  using BypassedEntryList = std::vector<Handle<SharedFunctionInfo>>;
+  BypassedEntryList& bypassed_entries() { return bypassed_entries_; }
+
   std::unique_ptr<char[]> GetDebugName() const;
 
   StackFrame::Type GetOutputStackFrameType() const;
@@ -268,6 +274,7 @@ class V8_EXPORT_PRIVATE OptimizedCompilationInfo final {
   BailoutReason bailout_reason_ = BailoutReason::kNoReason;
 
   InlinedFunctionList inlined_functions_;
+  BypassedEntryList bypassed_entries_;
 
   static constexpr int kNoOptimizationId = -1;
   const int optimization_id_;
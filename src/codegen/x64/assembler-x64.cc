@@ -4022,16 +4022,6 @@ void Assembler::movddup(XMMRegister dst, Operand src) {
   emit_sse_operand(dst, src);
 }
 
-void Assembler::psrldq(XMMRegister dst, uint8_t shift) {
-  EnsureSpace ensure_space(this);
-  emit(0x66);
-  emit_optional_rex_32(dst);
-  emit(0x0F);
-  emit(0x73);
-  emit_sse_operand(dst);
-  emit(shift);
-}
-
 void Assembler::pshufhw(XMMRegister dst, XMMRegister src, uint8_t shuffle) {
   EnsureSpace ensure_space(this);
   emit(0xF3);
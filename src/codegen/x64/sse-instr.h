@@ -111,11 +111,13 @@
   V(psrlw, 66, 0F, 71, 2)                  \
   V(psrld, 66, 0F, 72, 2)                  \
   V(psrlq, 66, 0F, 73, 2)                  \
+  V(psrldq, 66, 0F, 73, 3)                 \
   V(psraw, 66, 0F, 71, 4)                  \
   V(psrad, 66, 0F, 72, 4)                  \
   V(psllw, 66, 0F, 71, 6)                  \
   V(pslld, 66, 0F, 72, 6)                  \
-  V(psllq, 66, 0F, 73, 6)
+  V(psllq, 66, 0F, 73, 6)                  \
+  V(pslldq, 66, 0F, 73, 7)
 
 // Instructions dealing with scalar double-precision values.
 #define SSE2_INSTRUCTION_LIST_SD(V) \
@@ -825,6 +825,9 @@ enum Executability { NOT_EXECUTABLE, EXECUTABLE };
 enum class BytecodeFlushMode {
   kDoNotFlushBytecode,
   kFlushBytecode,
+  // Used for GCs that reduce memory: also flushes bytecode that was not
+  // executed since the previous mark-compact, even if it is not old yet.
+  kFlushUnusedBytecode,
   kStressFlushBytecode,
 };
 
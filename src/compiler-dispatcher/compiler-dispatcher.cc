@@ -9,6 +9,7 @@
 #include "src/codegen/compiler.h"
 #include "src/flags/flags.h"
 #include "src/handles/global-handles.h"
+#include "src/logging/counters.h"
 #include "src/objects/objects-inl.h"
 #include "src/parsing/parse-info.h"
 #include "src/parsing/parser.h"
@@ -254,6 +255,8 @@ void CompilerDispatcher::ScheduleMoreWorkerTasksIfNeeded() {
 void CompilerDispatcher::DoBackgroundWork() {
   TRACE_EVENT0(TRACE_DISABLED_BY_DEFAULT("v8.compile"),
                "V8.CompilerDispatcherDoBackgroundWork");
+  CpuTimeAccountingScope cpu_time_scope(
+      isolate_->counters(), Counters::CpuTimeCategory::kCompileBackground);
   for (;;) {
     Job* job = nullptr;
     {
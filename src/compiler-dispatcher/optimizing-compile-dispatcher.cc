@@ -11,8 +11,8 @@
 #include "src/init/v8.h"
 #include "src/logging/counters.h"
 #include "src/logging/log.h"
+#include "src/objects/feedback-vector-inl.h"
 #include "src/objects/objects-inl.h"
-#include "src/tasks/cancelable-task.h"
 #include "src/tracing/trace-event.h"
 
 namespace v8 {
@@ -38,35 +38,32 @@ void DisposeCompilationJob(OptimizedCompilationJob* job,
 
 }  // namespace
 
-class OptimizingCompileDispatcher::CompileTask : public CancelableTask {
+class OptimizingCompileDispatcher::CompileTask : public v8::JobTask {
  public:
   explicit CompileTask(Isolate* isolate,
                        OptimizingCompileDispatcher* dispatcher)
-      : CancelableTask(isolate),
-        isolate_(isolate),
+      : isolate_(isolate),
         worker_thread_runtime_call_stats_(
             isolate->counters()->worker_thread_runtime_call_stats()),
-        dispatcher_(dispatcher) {
-    base::MutexGuard lock_guard(&dispatcher_->ref_count_mutex_);
-    ++dispatcher_->ref_count_;
-  }
+        dispatcher_(dispatcher) {}
 
   ~CompileTask() override = default;
 
- private:
-  // v8::Task overrides.
-  void RunInternal() override {
+  // v8::JobTask overrides.
+  void Run(JobDelegate* delegate) override {
     DisallowHeapAllocation no_allocation;
     DisallowHandleAllocation no_handles;
     DisallowHandleDereference no_deref;
 
-    {
-      WorkerThreadRuntimeCallStatsScope runtime_call_stats_scope(
-          worker_thread_runtime_call_stats_);
-      RuntimeCallTimerScope runtimeTimer(
-          runtime_call_stats_scope.Get(),
-          RuntimeCallCounterId::kOptimizeBackgroundDispatcherJob);
+    CpuTimeAccountingScope cpu_time_scope(
+        isolate_->counters(), Counters::CpuTimeCategory::kCompileBackground);
+    WorkerThreadRuntimeCallStatsScope runtime_call_stats_scope(
+        worker_thread_runtime_call_stats_);
+    RuntimeCallTimerScope runtimeTimer(
+        runtime_call_stats_scope.Get(),
+        RuntimeCallCounterId::kOptimizeBackgroundDispatcherJob);
 
+    while (!delegate->ShouldYield()) {
       TimerEventScope<TimerEventRecompileConcurrent> timer(isolate_);
       TRACE_EVENT0(TRACE_DISABLED_BY_DEFAULT("v8.compile"),
                    "V8.OptimizeBackground");
@@ -76,17 +73,20 @@ class OptimizingCompileDispatcher::CompileTask : public CancelableTask {
             dispatcher_->recompilation_delay_));
       }
 
-      dispatcher_->CompileNext(dispatcher_->NextInput(true),
-                               runtime_call_stats_scope.Get());
-    }
-    {
-      base::MutexGuard lock_guard(&dispatcher_->ref_count_mutex_);
-      if (--dispatcher_->ref_count_ == 0) {
-        dispatcher_->ref_count_zero_.NotifyOne();
-      }
+      OptimizedCompilationJob* job = dispatcher_->NextInput(true);
+      if (job == nullptr) return;
+      dispatcher_->CompileNext(job, runtime_call_stats_scope.Get());
     }
   }
 
+  size_t GetMaxConcurrency() const override {
+    base::MutexGuard access_input_queue(&dispatcher_->input_queue_mutex_);
+    DCHECK_LE(dispatcher_->blocked_jobs_, dispatcher_->input_queue_length_);
+    return static_cast<size_t>(dispatcher_->input_queue_length_ -
+                               dispatcher_->blocked_jobs_);
+  }
+
+ private:
   Isolate* isolate_;
   WorkerThreadRuntimeCallStats* worker_thread_runtime_call_stats_;
   OptimizingCompileDispatcher* dispatcher_;
@@ -95,12 +95,7 @@ class OptimizingCompileDispatcher::CompileTask : public CancelableTask {
 };
 
 OptimizingCompileDispatcher::~OptimizingCompileDispatcher() {
-#ifdef DEBUG
-  {
-    base::MutexGuard lock_guard(&ref_count_mutex_);
-    DCHECK_EQ(0, ref_count_);
-  }
-#endif
+  DCHECK(!job_handle_);
   DCHECK_EQ(0, input_queue_length_);
   DeleteArray(input_queue_);
 }
@@ -108,8 +103,24 @@ OptimizingCompileDispatcher::~OptimizingCompileDispatcher() {
 OptimizedCompilationJob* OptimizingCompileDispatcher::NextInput(
     bool check_if_flushing) {
   base::MutexGuard access_input_queue_(&input_queue_mutex_);
-  if (input_queue_length_ == 0) return nullptr;
-  OptimizedCompilationJob* job = input_queue_[InputQueueIndex(0)];
+  if (input_queue_length_ <= blocked_jobs_) return nullptr;
+  if (FLAG_concurrent_recompilation_by_hotness) {
+    // Move the hottest job to the front. Jobs of equal hotness keep their
+    // FIFO order.
+    int hottest = 0;
+    for (int i = 1; i < input_queue_length_; i++) {
+      if (input_queue_[InputQueueIndex(i)].hotness >
+          input_queue_[InputQueueIndex(hottest)].hotness) {
+        hottest = i;
+      }
+    }
+    InputQueueEntry entry = input_queue_[InputQueueIndex(hottest)];
+    for (int i = hottest; i > 0; i--) {
+      input_queue_[InputQueueIndex(i)] = input_queue_[InputQueueIndex(i - 1)];
+    }
+    input_queue_[InputQueueIndex(0)] = entry;
+  }
+  OptimizedCompilationJob* job = input_queue_[InputQueueIndex(0)].job;
   DCHECK_NOT_NULL(job);
   input_queue_shift_ = InputQueueIndex(1);
   input_queue_length_--;
@@ -142,6 +153,18 @@ void OptimizingCompileDispatcher::CompileNext(OptimizedCompilationJob* job,
   isolate_->stack_guard()->RequestInstallCode();
 }
 
+void OptimizingCompileDispatcher::FlushInputQueue() {
+  base::MutexGuard access_input_queue_(&input_queue_mutex_);
+  while (input_queue_length_ > 0) {
+    OptimizedCompilationJob* job = input_queue_[InputQueueIndex(0)].job;
+    DCHECK_NOT_NULL(job);
+    input_queue_shift_ = InputQueueIndex(1);
+    input_queue_length_--;
+    DisposeCompilationJob(job, true);
+  }
+  blocked_jobs_ = 0;
+}
+
 void OptimizingCompileDispatcher::FlushOutputQueue(bool restore_function_code) {
   for (;;) {
     OptimizedCompilationJob* job = nullptr;
@@ -159,14 +182,7 @@ void OptimizingCompileDispatcher::FlushOutputQueue(bool restore_function_code) {
 void OptimizingCompileDispatcher::Flush(BlockingBehavior blocking_behavior) {
   if (blocking_behavior == BlockingBehavior::kDontBlock) {
     if (FLAG_block_concurrent_recompilation) Unblock();
-    base::MutexGuard access_input_queue_(&input_queue_mutex_);
-    while (input_queue_length_ > 0) {
-      OptimizedCompilationJob* job = input_queue_[InputQueueIndex(0)];
-      DCHECK_NOT_NULL(job);
-      input_queue_shift_ = InputQueueIndex(1);
-      input_queue_length_--;
-      DisposeCompilationJob(job, true);
-    }
+    FlushInputQueue();
     FlushOutputQueue(true);
     if (FLAG_trace_concurrent_recompilation) {
       PrintF("  ** Flushed concurrent recompilation queues (not blocking).\n");
@@ -175,11 +191,9 @@ void OptimizingCompileDispatcher::Flush(BlockingBehavior blocking_behavior) {
   }
   mode_ = FLUSH;
   if (FLAG_block_concurrent_recompilation) Unblock();
-  {
-    base::MutexGuard lock_guard(&ref_count_mutex_);
-    while (ref_count_ > 0) ref_count_zero_.Wait(&ref_count_mutex_);
-    mode_ = COMPILE;
-  }
+  AwaitCompileJob();
+  mode_ = COMPILE;
+  FlushInputQueue();
   FlushOutputQueue(true);
   if (FLAG_trace_concurrent_recompilation) {
     PrintF("  ** Flushed concurrent recompilation queues.\n");
@@ -189,15 +203,12 @@ void OptimizingCompileDispatcher::Flush(BlockingBehavior blocking_behavior) {
 void OptimizingCompileDispatcher::Stop() {
   mode_ = FLUSH;
   if (FLAG_block_concurrent_recompilation) Unblock();
-  {
-    base::MutexGuard lock_guard(&ref_count_mutex_);
-    while (ref_count_ > 0) ref_count_zero_.Wait(&ref_count_mutex_);
-    mode_ = COMPILE;
-  }
+  AwaitCompileJob();
+  mode_ = COMPILE;
 
-  // At this point the optimizing compiler thread's event loop has stopped.
-  // There is no need for a mutex when reading input_queue_length_.
-  DCHECK_EQ(input_queue_length_, 0);
+  // At this point no worker runs the compile job anymore. Jobs that were not
+  // picked up before the compile job was cancelled are disposed here.
+  FlushInputQueue();
   FlushOutputQueue(false);
 }
 
@@ -230,27 +241,47 @@ void OptimizingCompileDispatcher::InstallOptimizedFunctions() {
 void OptimizingCompileDispatcher::QueueForOptimization(
     OptimizedCompilationJob* job) {
   DCHECK(IsQueueAvailable());
+  JSFunction function = *job->compilation_info()->closure();
+  const int hotness = function.has_feedback_vector()
+                          ? function.feedback_vector().invocation_count()
+                          : 0;
   {
     // Add job to the back of the input queue.
     base::MutexGuard access_input_queue(&input_queue_mutex_);
     DCHECK_LT(input_queue_length_, input_queue_capacity_);
-    input_queue_[InputQueueIndex(input_queue_length_)] = job;
+    input_queue_[InputQueueIndex(input_queue_length_)] = {job, hotness};
     input_queue_length_++;
+    if (FLAG_block_concurrent_recompilation) {
+      blocked_jobs_++;
+      return;
+    }
   }
-  if (FLAG_block_concurrent_recompilation) {
-    blocked_jobs_++;
-  } else {
-    V8::GetCurrentPlatform()->CallOnWorkerThread(
-        std::make_unique<CompileTask>(isolate_, this));
-  }
+  ScheduleCompileJob();
 }
 
 void OptimizingCompileDispatcher::Unblock() {
-  while (blocked_jobs_ > 0) {
-    V8::GetCurrentPlatform()->CallOnWorkerThread(
-        std::make_unique<CompileTask>(isolate_, this));
-    blocked_jobs_--;
+  {
+    base::MutexGuard access_input_queue(&input_queue_mutex_);
+    if (blocked_jobs_ == 0) return;
+    blocked_jobs_ = 0;
+  }
+  ScheduleCompileJob();
+}
+
+void OptimizingCompileDispatcher::ScheduleCompileJob() {
+  if (job_handle_) {
+    job_handle_->NotifyConcurrencyIncrease();
+    return;
   }
+  job_handle_ = V8::GetCurrentPlatform()->PostJob(
+      isolate_->BackgroundTaskPriority(TaskPriority::kUserVisible),
+      std::make_unique<CompileTask>(isolate_, this));
+}
+
+void OptimizingCompileDispatcher::AwaitCompileJob() {
+  if (!job_handle_) return;
+  job_handle_->Cancel();
+  job_handle_.reset();
 }
 
 }  // namespace internal
@@ -6,9 +6,10 @@
 #define V8_COMPILER_DISPATCHER_OPTIMIZING_COMPILE_DISPATCHER_H_
 
 #include <atomic>
+#include <memory>
 #include <queue>
 
-#include "src/base/platform/condition-variable.h"
+#include "include/v8-platform.h"
 #include "src/base/platform/mutex.h"
 #include "src/base/platform/platform.h"
 #include "src/common/globals.h"
@@ -31,9 +32,8 @@ class V8_EXPORT_PRIVATE OptimizingCompileDispatcher {
         input_queue_shift_(0),
         mode_(COMPILE),
         blocked_jobs_(0),
-        ref_count_(0),
         recompilation_delay_(FLAG_concurrent_recompilation_delay) {
-    input_queue_ = NewArray<OptimizedCompilationJob*>(input_queue_capacity_);
+    input_queue_ = NewArray<InputQueueEntry>(input_queue_capacity_);
   }
 
   ~OptimizingCompileDispatcher();
@@ -57,7 +57,19 @@ class V8_EXPORT_PRIVATE OptimizingCompileDispatcher {
 
   enum ModeFlag { COMPILE, FLUSH };
 
+  struct InputQueueEntry {
+    OptimizedCompilationJob* job;
+    // Invocation count of the function at the time it was queued. Computed on
+    // the main thread as workers must not access the heap.
+    int hotness;
+  };
+
+  void FlushInputQueue();
   void FlushOutputQueue(bool restore_function_code);
+  // Posts the compile job or notifies it about newly available input.
+  void ScheduleCompileJob();
+  // Waits for running compilations to finish and cancels the compile job.
+  void AwaitCompileJob();
   void CompileNext(OptimizedCompilationJob* job, RuntimeCallStats* stats);
   OptimizedCompilationJob* NextInput(bool check_if_flushing = false);
 
@@ -71,7 +83,7 @@ class V8_EXPORT_PRIVATE OptimizingCompileDispatcher {
   Isolate* isolate_;
 
   // Circular queue of incoming recompilation tasks (including OSR).
-  OptimizedCompilationJob** input_queue_;
+  InputQueueEntry* input_queue_;
   int input_queue_capacity_;
   int input_queue_length_;
   int input_queue_shift_;
@@ -85,11 +97,13 @@ class V8_EXPORT_PRIVATE OptimizingCompileDispatcher {
 
   std::atomic<ModeFlag> mode_;
 
+  // Number of queued jobs that must not be compiled before Unblock() is
+  // called. Protected by |input_queue_mutex_|.
   int blocked_jobs_;
 
-  int ref_count_;
-  base::Mutex ref_count_mutex_;
-  base::ConditionVariable ref_count_zero_;
+  // Compiles queued jobs on worker threads. Posted lazily and reused for all
+  // jobs queued afterwards. Only accessed on the main thread.
+  std::unique_ptr<JobHandle> job_handle_;
 
   // Copy of FLAG_concurrent_recompilation_delay that will be used from the
   // background thread.
@@ -879,6 +879,24 @@ FieldAccess AccessBuilder::ForCellValue() {
   return access;
 }
 
+// static
+FieldAccess AccessBuilder::ForAccessorPairGetter() {
+  FieldAccess access = {kTaggedBase,      AccessorPair::kGetterOffset,
+                        Handle<Name>(),   MaybeHandle<Map>(),
+                        Type::Any(),      MachineType::AnyTagged(),
+                        kFullWriteBarrier};
+  return access;
+}
+
+// static
+FieldAccess AccessBuilder::ForAccessorPairSetter() {
+  FieldAccess access = {kTaggedBase,      AccessorPair::kSetterOffset,
+                        Handle<Name>(),   MaybeHandle<Map>(),
+                        Type::Any(),      MachineType::AnyTagged(),
+                        kFullWriteBarrier};
+  return access;
+}
+
 // static
 FieldAccess AccessBuilder::ForScopeInfoFlags() {
   FieldAccess access = {kTaggedBase,         ScopeInfo::kFlagsOffset,
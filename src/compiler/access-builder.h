@@ -272,6 +272,10 @@ class V8_EXPORT_PRIVATE AccessBuilder final
   // Provides access to Cell::value() field.
   static FieldAccess ForCellValue();
 
+  // Provides access to AccessorPair::getter() and AccessorPair::setter().
+  static FieldAccess ForAccessorPairGetter();
+  static FieldAccess ForAccessorPairSetter();
+
   // Provides access to arguments object fields.
   static FieldAccess ForArgumentsLength();
   static FieldAccess ForArgumentsCallee();
@@ -230,6 +230,9 @@ void CodeGenerator::AssembleCode() {
       inlined.RegisterInlinedFunctionId(index);
     }
   }
+  for (Handle<SharedFunctionInfo> shared : info->bypassed_entries()) {
+    DefineDeoptimizationLiteral(DeoptimizationLiteral(shared));
+  }
   inlined_function_count_ = deoptimization_literals_.size();
 
   // Define deoptimization literals for all BytecodeArrays to which we might
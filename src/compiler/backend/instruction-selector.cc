@@ -3216,6 +3216,18 @@ bool InstructionSelector::TryMatchBlend(const uint8_t* shuffle) {
   return wasm::TryMatchBlend(shuffle);
 }
 
+// static
+bool InstructionSelector::TryMatchByteShiftRight(const uint8_t* shuffle,
+                                                 uint8_t* shift) {
+  return wasm::TryMatchByteShiftRight(shuffle, shift);
+}
+
+// static
+bool InstructionSelector::TryMatchByteShiftLeft(const uint8_t* shuffle,
+                                                uint8_t* shift) {
+  return wasm::TryMatchByteShiftLeft(shuffle, shift);
+}
+
 // static
 int32_t InstructionSelector::Pack4Lanes(const uint8_t* shuffle) {
   int32_t result = 0;
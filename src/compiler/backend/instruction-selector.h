@@ -480,6 +480,14 @@ class V8_EXPORT_PRIVATE InstructionSelector final {
   static bool TryMatchBlendForTesting(const uint8_t* shuffle) {
     return TryMatchBlend(shuffle);
   }
+  static bool TryMatchByteShiftRightForTesting(const uint8_t* shuffle,
+                                               uint8_t* shift) {
+    return TryMatchByteShiftRight(shuffle, shift);
+  }
+  static bool TryMatchByteShiftLeftForTesting(const uint8_t* shuffle,
+                                              uint8_t* shift) {
+    return TryMatchByteShiftLeft(shuffle, shift);
+  }
 
  private:
   friend class OperandGenerator;
@@ -697,6 +705,14 @@ class V8_EXPORT_PRIVATE InstructionSelector final {
   // shuffle should be canonicalized.
   static bool TryMatchBlend(const uint8_t* shuffle);
 
+  // Tries to match a byte shuffle to a whole-register byte shift, for shuffles
+  // where one of the inputs is known to be zero. E.g. [4 5 .. 15 16 .. 16]
+  // shifts the first source right by 4 bytes if the second one is zero, and
+  // [0 0 0 0 16 17 .. 27] shifts the second source left by 4 bytes if the first
+  // one is zero. The shuffle should be canonicalized.
+  static bool TryMatchByteShiftRight(const uint8_t* shuffle, uint8_t* shift);
+  static bool TryMatchByteShiftLeft(const uint8_t* shuffle, uint8_t* shift);
+
   // Packs 4 bytes of shuffle into a 32 bit immediate.
   static int32_t Pack4Lanes(const uint8_t* shuffle);
 
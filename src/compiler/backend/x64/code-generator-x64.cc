@@ -673,6 +673,21 @@ void EmitWordLoadPoisoningIfNeeded(CodeGenerator* codegen,
     __ opcode(i.OutputSimd128Register(), i.InputSimd128Register(1), imm); \
   } while (false)
 
+// Whole-register byte shifts. The AVX form can write a different register, so
+// the instruction selector only requests same-as-first without AVX.
+#define ASSEMBLE_SIMD_BYTE_SHIFT(opcode)                                  \
+  do {                                                                    \
+    XMMRegister dst = i.OutputSimd128Register();                          \
+    XMMRegister src = i.InputSimd128Register(0);                          \
+    if (CpuFeatures::IsSupported(AVX)) {                                  \
+      CpuFeatureScope avx_scope(tasm(), AVX);                             \
+      __ v##opcode(dst, src, i.InputUint8(1));                            \
+    } else {                                                              \
+      DCHECK_EQ(dst, src);                                                \
+      __ opcode(dst, i.InputUint8(1));                                    \
+    }                                                                     \
+  } while (false)
+
 #define ASSEMBLE_SIMD_ALL_TRUE(opcode)          \
   do {                                          \
     Register dst = i.OutputRegister();          \
@@ -3887,6 +3902,14 @@ CodeGenerator::CodeGenResult CodeGenerator::AssembleArchInstruction(
       ASSEMBLE_SIMD_IMM_SHUFFLE(Palignr, i.InputUint8(2));
       break;
     }
+    case kX64S8x16ByteShiftRight: {
+      ASSEMBLE_SIMD_BYTE_SHIFT(psrldq);
+      break;
+    }
+    case kX64S8x16ByteShiftLeft: {
+      ASSEMBLE_SIMD_BYTE_SHIFT(pslldq);
+      break;
+    }
     case kX64S16x8Dup: {
       XMMRegister dst = i.OutputSimd128Register();
       uint8_t lane = i.InputInt8(1) & 0x7;
@@ -4261,6 +4284,7 @@ CodeGenerator::CodeGenResult CodeGenerator::AssembleArchInstruction(
 #undef ASSEMBLE_SIMD_IMM_INSTR
 #undef ASSEMBLE_SIMD_PUNPCK_SHUFFLE
 #undef ASSEMBLE_SIMD_IMM_SHUFFLE
+#undef ASSEMBLE_SIMD_BYTE_SHIFT
 #undef ASSEMBLE_SIMD_ALL_TRUE
 #undef ASSEMBLE_SIMD_SHIFT
 
@@ -345,6 +345,8 @@ namespace compiler {
   V(X64S16x8HalfShuffle1)                 \
   V(X64S16x8HalfShuffle2)                 \
   V(X64S8x16Alignr)                       \
+  V(X64S8x16ByteShiftRight)               \
+  V(X64S8x16ByteShiftLeft)                \
   V(X64S16x8Dup)                          \
   V(X64S8x16Dup)                          \
   V(X64S16x8UnzipHigh)                    \
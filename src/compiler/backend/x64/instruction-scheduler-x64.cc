@@ -2,12 +2,48 @@
 // Use of this source code is governed by a BSD-style license that can be
 // found in the LICENSE file.
 
+#include <cstring>
+
+#include "src/base/cpu.h"
 #include "src/compiler/backend/instruction-scheduler.h"
 
 namespace v8 {
 namespace internal {
 namespace compiler {
 
+namespace {
+
+// AMD Zen and Intel Ice Lake (and their successors) come with a much faster
+// integer divider than the cores the default latencies were measured on.
+bool HasFastIntegerDivider() {
+  static const bool fast_divider = []() {
+    base::CPU cpu;
+    if (strcmp(cpu.vendor(), "AuthenticAMD") == 0) {
+      return cpu.family() == 0xF && cpu.ext_family() >= 0x8;
+    }
+    if (strcmp(cpu.vendor(), "GenuineIntel") == 0 && cpu.family() == 0x6) {
+      switch (cpu.model()) {
+        case 0x6A:  // Ice Lake server.
+        case 0x6C:
+        case 0x7D:  // Ice Lake client.
+        case 0x7E:
+        case 0x8C:  // Tiger Lake.
+        case 0x8D:
+        case 0x97:  // Alder Lake.
+        case 0x9A:
+        case 0xA7:  // Rocket Lake.
+          return true;
+        default:
+          return false;
+      }
+    }
+    return false;
+  }();
+  return fast_divider;
+}
+
+}  // namespace
+
 bool InstructionScheduler::SchedulerSupported() { return true; }
 
 int InstructionScheduler::GetTargetInstructionFlags(
@@ -311,6 +347,8 @@ int InstructionScheduler::GetTargetInstructionFlags(
     case kX64S16x8HalfShuffle1:
     case kX64S16x8HalfShuffle2:
     case kX64S8x16Alignr:
+    case kX64S8x16ByteShiftRight:
+    case kX64S8x16ByteShiftLeft:
     case kX64S16x8Dup:
     case kX64S8x16Dup:
     case kX64S16x8UnzipHigh:
@@ -487,18 +525,49 @@ int InstructionScheduler::GetInstructionLatency(const Instruction* instr) {
     case kSSEFloat64ToUint32:
       return 4;
     case kX64Idiv:
-      return 49;
+      return HasFastIntegerDivider() ? 18 : 49;
     case kX64Idiv32:
-      return 35;
+      return HasFastIntegerDivider() ? 14 : 35;
     case kX64Udiv:
-      return 38;
+      return HasFastIntegerDivider() ? 18 : 38;
     case kX64Udiv32:
-      return 26;
+      return HasFastIntegerDivider() ? 14 : 26;
     case kSSEFloat32Div:
     case kSSEFloat64Div:
     case kSSEFloat32Sqrt:
     case kSSEFloat64Sqrt:
       return 13;
+    case kX64F32x4Add:
+    case kX64F32x4Sub:
+    case kX64F32x4Mul:
+    case kX64F32x4Qfma:
+    case kX64F32x4Qfms:
+    case kX64F32x4RecipApprox:
+    case kX64F32x4RecipSqrtApprox:
+    case kX64F32x4SConvertI32x4:
+    case kX64F64x2Add:
+    case kX64F64x2Sub:
+    case kX64F64x2Mul:
+    case kX64F64x2Qfma:
+    case kX64F64x2Qfms:
+      return 4;
+    case kX64I16x8Mul:
+    case kX64I32x4DotI16x8S:
+      return 5;
+    case kX64F32x4Round:
+    case kX64F64x2Round:
+      return 8;
+    case kX64I32x4Mul:
+    case kX64I64x2Mul:
+      return 10;
+    case kX64F32x4Div:
+      return 11;
+    case kX64F32x4Sqrt:
+      return 12;
+    case kX64F64x2Div:
+      return 14;
+    case kX64F64x2Sqrt:
+      return 16;
     case kSSEFloat32ToInt64:
     case kSSEFloat64ToInt64:
     case kSSEFloat32ToUint64:
@@ -3268,6 +3268,17 @@ static const ShuffleEntry arch_shuffles[] = {
      true,
      true}};
 
+// Returns true if {node} is a constant with all bits cleared.
+bool IsS128ZeroConstant(Node* node) {
+  if (node->opcode() == IrOpcode::kS128Zero) return true;
+  if (node->opcode() != IrOpcode::kS128Const) return false;
+  const uint8_t* bytes = S128ImmediateParameterOf(node->op()).data();
+  for (int i = 0; i < kSimd128Size; ++i) {
+    if (bytes[i] != 0) return false;
+  }
+  return true;
+}
+
 bool TryMatchArchShuffle(const uint8_t* shuffle, const ShuffleEntry* table,
                          size_t num_entries, bool is_swizzle,
                          const ShuffleEntry** arch_shuffle) {
@@ -3315,7 +3326,23 @@ void InstructionSelector::VisitS8x16Shuffle(Node* node) {
   uint8_t shuffle16x8[8];
   int index;
   const ShuffleEntry* arch_shuffle;
-  if (TryMatchConcat(shuffle, &offset)) {
+  if (!is_swizzle && IsS128ZeroConstant(node->InputAt(1)) &&
+      TryMatchByteShiftRight(shuffle, &offset)) {
+    // The zero input is shifted in by (v)psrldq, so it is not needed.
+    is_swizzle = true;
+    // AVX has a non-destructive form which doesn't need same-as-first.
+    no_same_as_first = IsSupported(AVX);
+    opcode = kX64S8x16ByteShiftRight;
+    imms[imm_count++] = offset;
+  } else if (!is_swizzle && IsS128ZeroConstant(node->InputAt(0)) &&
+             TryMatchByteShiftLeft(shuffle, &offset)) {
+    // Move the shifted input into place, the zero input is not needed.
+    SwapShuffleInputs(node);
+    is_swizzle = true;
+    no_same_as_first = IsSupported(AVX);
+    opcode = kX64S8x16ByteShiftLeft;
+    imms[imm_count++] = offset;
+  } else if (TryMatchConcat(shuffle, &offset)) {
     // Swap inputs from the normal order for (v)palignr.
     SwapShuffleInputs(node);
     is_swizzle = false;        // It's simpler to just handle the general case.
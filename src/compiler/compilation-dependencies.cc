@@ -17,7 +17,10 @@ namespace compiler {
 
 CompilationDependencies::CompilationDependencies(JSHeapBroker* broker,
                                                  Zone* zone)
-    : zone_(zone), broker_(broker), dependencies_(zone) {}
+    : zone_(zone),
+      broker_(broker),
+      dependencies_(zone),
+      bypassed_entries_(zone) {}
 
 class InitialMapDependency final : public CompilationDependency {
  public:
@@ -504,6 +507,14 @@ bool CompilationDependencies::AreValid() const {
   return true;
 }
 
+void CompilationDependencies::RecordBypassedEntry(
+    const SharedFunctionInfoRef& shared) {
+  if (!shared.native() && !shared.function_template_info().has_value()) {
+    return;
+  }
+  bypassed_entries_.push_back(shared.object());
+}
+
 bool CompilationDependencies::Commit(Handle<Code> code) {
   // Dependencies are context-dependent. In the future it may be possible to
   // restore them in the consumer native context, but for now they are
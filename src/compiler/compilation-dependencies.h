@@ -110,6 +110,16 @@ class V8_EXPORT_PRIVATE CompilationDependencies : public ZoneObject {
   SlackTrackingPrediction DependOnInitialMapInstanceSizePrediction(
       const JSFunctionRef& function);
 
+  // Record that a call to {shared} was lowered in a way that doesn't go
+  // through the code of its function (e.g. to a direct builtin or API
+  // callback call), which hides it from a break at entry that the debugger
+  // installs later on. Only functions that can break at entry are recorded,
+  // see Debug::CanBreakAtEntry.
+  void RecordBypassedEntry(const SharedFunctionInfoRef& shared);
+  ZoneVector<Handle<SharedFunctionInfo>> const& bypassed_entries() const {
+    return bypassed_entries_;
+  }
+
   // The methods below allow for gathering dependencies without actually
   // recording them. They can be recorded at a later time (or they can be
   // ignored). For example,
@@ -131,6 +141,7 @@ class V8_EXPORT_PRIVATE CompilationDependencies : public ZoneObject {
   Zone* const zone_;
   JSHeapBroker* const broker_;
   ZoneForwardList<CompilationDependency const*> dependencies_;
+  ZoneVector<Handle<SharedFunctionInfo>> bypassed_entries_;
 };
 
 }  // namespace compiler
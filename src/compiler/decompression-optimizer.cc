@@ -78,13 +78,27 @@ void DecompressionOptimizer::MarkNodeInputs(Node* node) {
                                   State::kOnly32BitsObserved);  // value
       break;
     // BINOPS.
+    // All the 32-bit binops below only observe the lower halves of their
+    // inputs, both in the x64 and arm64 instruction selectors. This lets Smi
+    // arithmetic, Smi untagging and tag checks on tagged values work directly
+    // on the compressed representation.
+    case IrOpcode::kInt32Add:
+    case IrOpcode::kInt32AddWithOverflow:
     case IrOpcode::kInt32LessThan:
     case IrOpcode::kInt32LessThanOrEqual:
+    case IrOpcode::kInt32Mul:
+    case IrOpcode::kInt32MulWithOverflow:
+    case IrOpcode::kInt32Sub:
+    case IrOpcode::kInt32SubWithOverflow:
     case IrOpcode::kUint32LessThan:
     case IrOpcode::kUint32LessThanOrEqual:
     case IrOpcode::kWord32And:
     case IrOpcode::kWord32Equal:
+    case IrOpcode::kWord32Or:
+    case IrOpcode::kWord32Sar:
     case IrOpcode::kWord32Shl:
+    case IrOpcode::kWord32Shr:
+    case IrOpcode::kWord32Xor:
       DCHECK_EQ(node->op()->ValueInputCount(), 2);
       MaybeMarkAndQueueForRevisit(node->InputAt(0),
                                   State::kOnly32BitsObserved);  // value_0
@@ -192,13 +192,16 @@ class EffectControlLinearizer {
   Node* LowerFastApiCall(Node* node);
   Node* LowerLoadTypedElement(Node* node);
   Node* LowerLoadDataViewElement(Node* node);
+  Node* LowerAtomicTypedElement(Node* node);
   Node* LowerLoadStackArgument(Node* node);
   void LowerStoreMessage(Node* node);
   void LowerStoreTypedElement(Node* node);
   void LowerStoreDataViewElement(Node* node);
   void LowerStoreSignedSmallElement(Node* node);
-  Node* LowerFindOrderedHashMapEntry(Node* node);
-  Node* LowerFindOrderedHashMapEntryForInt32Key(Node* node);
+  template <typename CollectionType>
+  Node* LowerFindOrderedHashTableEntry(Node* node, Builtins::Name builtin);
+  template <typename CollectionType>
+  Node* LowerFindOrderedHashTableEntryForInt32Key(Node* node);
   void LowerTransitionAndStoreElement(Node* node);
   void LowerTransitionAndStoreNumberElement(Node* node);
   void LowerTransitionAndStoreNonNumberElement(Node* node);
@@ -241,6 +244,10 @@ class EffectControlLinearizer {
   Node* IsElementsKindGreaterThan(Node* kind, ElementsKind reference_kind);
 
   Node* BuildTypedArrayDataPointer(Node* base, Node* external);
+  Node* AdaptFastCallArrayBufferViewArgument(Node* value,
+                                             GraphAssemblerLabel<0>* if_error);
+  Node* AdaptFastCallOneByteStringArgument(Node* value,
+                                           GraphAssemblerLabel<0>* if_error);
 
   template <typename... Args>
   Node* CallBuiltin(Builtins::Name builtin, Operator::Properties properties,
@@ -1280,6 +1287,9 @@ bool EffectControlLinearizer::TryWireInStateEffect(Node* node,
     case IrOpcode::kStoreTypedElement:
       LowerStoreTypedElement(node);
       break;
+    case IrOpcode::kAtomicTypedElement:
+      result = LowerAtomicTypedElement(node);
+      break;
     case IrOpcode::kStoreDataViewElement:
       LowerStoreDataViewElement(node);
       break;
@@ -1287,10 +1297,18 @@ bool EffectControlLinearizer::TryWireInStateEffect(Node* node,
       LowerStoreSignedSmallElement(node);
       break;
     case IrOpcode::kFindOrderedHashMapEntry:
-      result = LowerFindOrderedHashMapEntry(node);
+      result = LowerFindOrderedHashTableEntry<OrderedHashMap>(
+          node, Builtins::kFindOrderedHashMapEntry);
       break;
     case IrOpcode::kFindOrderedHashMapEntryForInt32Key:
-      result = LowerFindOrderedHashMapEntryForInt32Key(node);
+      result = LowerFindOrderedHashTableEntryForInt32Key<OrderedHashMap>(node);
+      break;
+    case IrOpcode::kFindOrderedHashSetEntry:
+      result = LowerFindOrderedHashTableEntry<OrderedHashSet>(
+          node, Builtins::kFindOrderedHashSetEntry);
+      break;
+    case IrOpcode::kFindOrderedHashSetEntryForInt32Key:
+      result = LowerFindOrderedHashTableEntryForInt32Key<OrderedHashSet>(node);
       break;
     case IrOpcode::kTransitionAndStoreNumberElement:
       LowerTransitionAndStoreNumberElement(node);
@@ -4977,9 +4995,98 @@ static MachineType MachineTypeFor(CTypeInfo::Type type) {
       return MachineType::Float64();
     case CTypeInfo::Type::kV8Value:
       return MachineType::AnyTagged();
+    case CTypeInfo::Type::kArrayBufferView:
+    case CTypeInfo::Type::kOneByteString:
+      return MachineType::Pointer();
   }
 }
 
+// Checks that {value} is a typed array or DataView whose buffer is not
+// detached, and returns a pointer to a FastApiArrayBufferView describing it.
+// Jumps to {if_error} otherwise.
+Node* EffectControlLinearizer::AdaptFastCallArrayBufferViewArgument(
+    Node* value, GraphAssemblerLabel<0>* if_error) {
+  __ GotoIf(ObjectIsSmi(value), if_error);
+  Node* value_map = __ LoadField(AccessBuilder::ForMap(), value);
+  Node* value_instance_type =
+      __ LoadField(AccessBuilder::ForMapInstanceType(), value_map);
+
+  auto if_typed_array = __ MakeLabel();
+  auto done = __ MakeLabel(MachineType::PointerRepresentation());
+  __ GotoIf(__ Word32Equal(value_instance_type,
+                           __ Int32Constant(JS_TYPED_ARRAY_TYPE)),
+            &if_typed_array);
+  __ GotoIfNot(__ Word32Equal(value_instance_type,
+                              __ Int32Constant(JS_DATA_VIEW_TYPE)),
+               if_error);
+  __ Goto(&done,
+          __ LoadField(AccessBuilder::ForJSDataViewDataPointer(), value));
+
+  __ Bind(&if_typed_array);
+  Node* base = __ LoadField(AccessBuilder::ForJSTypedArrayBasePointer(), value);
+  Node* external =
+      __ LoadField(AccessBuilder::ForJSTypedArrayExternalPointer(), value);
+  __ Goto(&done, BuildTypedArrayDataPointer(base, external));
+
+  __ Bind(&done);
+  Node* data = done.PhiAt(0);
+  Node* buffer =
+      __ LoadField(AccessBuilder::ForJSArrayBufferViewBuffer(), value);
+  Node* buffer_bit_field =
+      __ LoadField(AccessBuilder::ForJSArrayBufferBitField(), buffer);
+  __ GotoIfNot(
+      __ Word32Equal(
+          __ Word32And(buffer_bit_field,
+                       __ Int32Constant(JSArrayBuffer::WasDetachedBit::kMask)),
+          __ Int32Constant(0)),
+      if_error);
+  Node* byte_length =
+      __ LoadField(AccessBuilder::ForJSArrayBufferViewByteLength(), value);
+
+  Node* stack_slot = __ StackSlot(sizeof(FastApiArrayBufferView),
+                                  alignof(FastApiArrayBufferView));
+  __ Store(StoreRepresentation(MachineType::PointerRepresentation(),
+                               kNoWriteBarrier),
+           stack_slot, offsetof(FastApiArrayBufferView, data), data);
+  __ Store(StoreRepresentation(MachineType::PointerRepresentation(),
+                               kNoWriteBarrier),
+           stack_slot, offsetof(FastApiArrayBufferView, byte_length),
+           byte_length);
+  return stack_slot;
+}
+
+// Checks that {value} is a sequential one-byte string and returns a pointer to
+// a FastOneByteString describing it. Jumps to {if_error} otherwise.
+Node* EffectControlLinearizer::AdaptFastCallOneByteStringArgument(
+    Node* value, GraphAssemblerLabel<0>* if_error) {
+  __ GotoIf(ObjectIsSmi(value), if_error);
+  Node* value_map = __ LoadField(AccessBuilder::ForMap(), value);
+  Node* value_instance_type =
+      __ LoadField(AccessBuilder::ForMapInstanceType(), value_map);
+  __ GotoIfNot(
+      __ Word32Equal(
+          __ Word32And(value_instance_type,
+                       __ Int32Constant(kIsNotStringMask |
+                                        kStringRepresentationMask |
+                                        kStringEncodingMask)),
+          __ Int32Constant(kStringTag | kSeqStringTag | kOneByteStringTag)),
+      if_error);
+
+  Node* data = __ IntAdd(__ BitcastTaggedToWord(value),
+                         __ IntPtrConstant(SeqOneByteString::kHeaderSize -
+                                           kHeapObjectTag));
+  Node* length = __ LoadField(AccessBuilder::ForStringLength(), value);
+
+  Node* stack_slot =
+      __ StackSlot(sizeof(FastOneByteString), alignof(FastOneByteString));
+  __ Store(StoreRepresentation(MachineType::PointerRepresentation(),
+                               kNoWriteBarrier),
+           stack_slot, offsetof(FastOneByteString, data), data);
+  __ Store(StoreRepresentation(MachineRepresentation::kWord32, kNoWriteBarrier),
+           stack_slot, offsetof(FastOneByteString, length), length);
+  return stack_slot;
+}
+
 Node* EffectControlLinearizer::LowerFastApiCall(Node* node) {
   FastApiCallNode n(node);
   FastApiCallParameters const& params = n.Parameters();
@@ -5015,11 +5122,27 @@ Node* EffectControlLinearizer::LowerFastApiCall(Node* node) {
 
   call_descriptor->SetCFunctionInfo(c_signature);
 
+  // Arguments that do not have the type the C function expects go straight to
+  // the slow call.
+  auto if_error = __ MakeDeferredLabel();
+
   Node** const inputs = graph()->zone()->NewArray<Node*>(
       c_arg_count + FastApiCallNode::kFastCallExtraInputCount);
-  for (int i = 0; i < c_arg_count + FastApiCallNode::kFastTargetInputCount;
-       ++i) {
-    inputs[i] = NodeProperties::GetValueInput(node, i);
+  inputs[0] = NodeProperties::GetValueInput(node, 0);  // Target.
+  for (int i = 0; i < c_arg_count; ++i) {
+    Node* value = NodeProperties::GetValueInput(
+        node, i + FastApiCallNode::kFastTargetInputCount);
+    switch (c_signature->ArgumentInfo(i).GetType()) {
+      case CTypeInfo::Type::kArrayBufferView:
+        value = AdaptFastCallArrayBufferViewArgument(value, &if_error);
+        break;
+      case CTypeInfo::Type::kOneByteString:
+        value = AdaptFastCallOneByteStringArgument(value, &if_error);
+        break;
+      default:
+        break;
+    }
+    inputs[i + FastApiCallNode::kFastTargetInputCount] = value;
   }
   inputs[c_arg_count + 1] = has_error;
   inputs[c_arg_count + 2] = __ effect();
@@ -5035,7 +5158,6 @@ Node* EffectControlLinearizer::LowerFastApiCall(Node* node) {
       TNode<Boolean>::UncheckedCast(__ Word32Equal(load, __ Int32Constant(0)));
   // Hint to true.
   auto if_success = __ MakeLabel();
-  auto if_error = __ MakeDeferredLabel();
   auto merge = __ MakeLabel(MachineRepresentation::kTagged);
   __ Branch(cond, &if_success, &if_error);
 
@@ -5391,6 +5513,66 @@ void EffectControlLinearizer::LowerStoreTypedElement(Node* node) {
                   data_ptr, index, value);
 }
 
+Node* EffectControlLinearizer::LowerAtomicTypedElement(Node* node) {
+  AtomicTypedElementParameters const& params =
+      AtomicTypedElementParametersOf(node->op());
+  Node* buffer = node->InputAt(0);
+  Node* base = node->InputAt(1);
+  Node* external = node->InputAt(2);
+  Node* index = node->InputAt(3);
+
+  // We need to keep the {buffer} alive so that the GC will not release the
+  // ArrayBuffer (if there's any) as long as we are still operating on it.
+  __ Retain(buffer);
+
+  Node* data_ptr = BuildTypedArrayDataPointer(base, external);
+  MachineType const type =
+      AccessBuilder::ForTypedArrayElement(params.array_type(), true)
+          .machine_type;
+  Node* offset = __ WordShl(
+      index, __ IntPtrConstant(ElementSizeLog2Of(type.representation())));
+
+  const Operator* op = nullptr;
+  switch (params.op()) {
+    case AtomicTypedElementOp::kLoad:
+      op = machine()->Word32AtomicLoad(type);
+      break;
+    case AtomicTypedElementOp::kStore:
+      __ AddNode(graph()->NewNode(
+          machine()->Word32AtomicStore(type.representation()), data_ptr,
+          offset, node->InputAt(4), __ effect(), __ control()));
+      return nullptr;
+    case AtomicTypedElementOp::kAdd:
+      op = machine()->Word32AtomicAdd(type);
+      break;
+    case AtomicTypedElementOp::kSub:
+      op = machine()->Word32AtomicSub(type);
+      break;
+    case AtomicTypedElementOp::kAnd:
+      op = machine()->Word32AtomicAnd(type);
+      break;
+    case AtomicTypedElementOp::kOr:
+      op = machine()->Word32AtomicOr(type);
+      break;
+    case AtomicTypedElementOp::kXor:
+      op = machine()->Word32AtomicXor(type);
+      break;
+    case AtomicTypedElementOp::kExchange:
+      op = machine()->Word32AtomicExchange(type);
+      break;
+    case AtomicTypedElementOp::kCompareExchange:
+      return __ AddNode(graph()->NewNode(
+          machine()->Word32AtomicCompareExchange(type), data_ptr, offset,
+          node->InputAt(4), node->InputAt(5), __ effect(), __ control()));
+  }
+  if (params.op() == AtomicTypedElementOp::kLoad) {
+    return __ AddNode(
+        graph()->NewNode(op, data_ptr, offset, __ effect(), __ control()));
+  }
+  return __ AddNode(graph()->NewNode(op, data_ptr, offset, node->InputAt(4),
+                                     __ effect(), __ control()));
+}
+
 void EffectControlLinearizer::TransitionElementsTo(Node* node, Node* array,
                                                    ElementsKind from,
                                                    ElementsKind to) {
@@ -6216,13 +6398,14 @@ Maybe<Node*> EffectControlLinearizer::LowerFloat64RoundTruncate(Node* node) {
   return Just(BuildFloat64RoundTruncate(input));
 }
 
-Node* EffectControlLinearizer::LowerFindOrderedHashMapEntry(Node* node) {
+template <typename CollectionType>
+Node* EffectControlLinearizer::LowerFindOrderedHashTableEntry(
+    Node* node, Builtins::Name builtin) {
   Node* table = NodeProperties::GetValueInput(node, 0);
   Node* key = NodeProperties::GetValueInput(node, 1);
 
   {
-    Callable const callable =
-        Builtins::CallableFor(isolate(), Builtins::kFindOrderedHashMapEntry);
+    Callable const callable = Builtins::CallableFor(isolate(), builtin);
     Operator::Properties const properties = node->op()->properties();
     CallDescriptor::Flags const flags = CallDescriptor::kNoFlags;
     auto call_descriptor = Linkage::GetStubCallDescriptor(
@@ -6246,7 +6429,8 @@ Node* EffectControlLinearizer::ComputeUnseededHash(Node* value) {
   return value;
 }
 
-Node* EffectControlLinearizer::LowerFindOrderedHashMapEntryForInt32Key(
+template <typename CollectionType>
+Node* EffectControlLinearizer::LowerFindOrderedHashTableEntryForInt32Key(
     Node* node) {
   Node* table = NodeProperties::GetValueInput(node, 0);
   Node* key = NodeProperties::GetValueInput(node, 1);
@@ -6260,7 +6444,7 @@ Node* EffectControlLinearizer::LowerFindOrderedHashMapEntryForInt32Key(
   Node* first_entry = ChangeSmiToIntPtr(__ Load(
       MachineType::TaggedSigned(), table,
       __ IntAdd(__ WordShl(hash, __ IntPtrConstant(kTaggedSizeLog2)),
-                __ IntPtrConstant(OrderedHashMap::HashTableStartOffset() -
+                __ IntPtrConstant(CollectionType::HashTableStartOffset() -
                                   kHeapObjectTag))));
 
   auto loop = __ MakeLoopLabel(MachineType::PointerRepresentation());
@@ -6270,16 +6454,16 @@ Node* EffectControlLinearizer::LowerFindOrderedHashMapEntryForInt32Key(
   {
     Node* entry = loop.PhiAt(0);
     Node* check =
-        __ IntPtrEqual(entry, __ IntPtrConstant(OrderedHashMap::kNotFound));
+        __ IntPtrEqual(entry, __ IntPtrConstant(CollectionType::kNotFound));
     __ GotoIf(check, &done, entry);
     entry = __ IntAdd(
-        __ IntMul(entry, __ IntPtrConstant(OrderedHashMap::kEntrySize)),
+        __ IntMul(entry, __ IntPtrConstant(CollectionType::kEntrySize)),
         number_of_buckets);
 
     Node* candidate_key = __ Load(
         MachineType::AnyTagged(), table,
         __ IntAdd(__ WordShl(entry, __ IntPtrConstant(kTaggedSizeLog2)),
-                  __ IntPtrConstant(OrderedHashMap::HashTableStartOffset() -
+                  __ IntPtrConstant(CollectionType::HashTableStartOffset() -
                                     kHeapObjectTag)));
 
     auto if_match = __ MakeLabel();
@@ -6308,8 +6492,8 @@ Node* EffectControlLinearizer::LowerFindOrderedHashMapEntryForInt32Key(
           MachineType::TaggedSigned(), table,
           __ IntAdd(
               __ WordShl(entry, __ IntPtrConstant(kTaggedSizeLog2)),
-              __ IntPtrConstant(OrderedHashMap::HashTableStartOffset() +
-                                OrderedHashMap::kChainOffset * kTaggedSize -
+              __ IntPtrConstant(CollectionType::HashTableStartOffset() +
+                                CollectionType::kChainOffset * kTaggedSize -
                                 kHeapObjectTag))));
       __ Goto(&loop, next_entry);
     }
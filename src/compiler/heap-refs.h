@@ -454,6 +454,8 @@ class NativeContextRef : public ContextRef {
   ScopeInfoRef scope_info() const;
   MapRef GetFunctionMapFromIndex(int index) const;
   MapRef GetInitialJSArrayMap(ElementsKind kind) const;
+  MapRef GetCollectionIteratorMap(CollectionKind collection_kind,
+                                  IterationKind iteration_kind) const;
   base::Optional<JSFunctionRef> GetConstructorFunction(const MapRef& map) const;
 };
 
@@ -3707,6 +3707,12 @@ Reduction JSCallReducer::ReduceCallOrConstructWithArrayLikeOrSpread(
 
   Node* arguments_list =
       NodeProperties::GetValueInput(node, arraylike_or_spread_index);
+  if (arguments_list->opcode() == IrOpcode::kJSCreateArray ||
+      arguments_list->opcode() == IrOpcode::kJSCreateEmptyLiteralArray) {
+    return ReduceCallOrConstructWithKnownArrayElements(
+        node, arraylike_or_spread_index, frequency, feedback,
+        speculation_mode);
+  }
   if (arguments_list->opcode() != IrOpcode::kJSCreateArguments) {
     return NoChange();
   }
@@ -3852,10 +3858,90 @@ Reduction JSCallReducer::ReduceCallOrConstructWithArrayLikeOrSpread(
   }
   // Add the actual parameters to the {node}, skipping the receiver.
   Node* const parameters = frame_state->InputAt(kFrameStateParametersInput);
+  NodeVector arguments(graph()->zone());
   for (int i = start_index + 1; i < parameters->InputCount(); ++i) {
+    arguments.push_back(parameters->InputAt(i));
+  }
+  return ReduceCallOrConstructWithExpandedArguments(
+      node, argc, arguments, frequency, feedback, speculation_mode);
+}
+
+// Forwards the elements of an array that was created from a statically known
+// list of values directly to the call or construct {node}, i.e. turns
+// f(...new Array(a, b)) into f(a, b) and f(...[]) into f().
+Reduction JSCallReducer::ReduceCallOrConstructWithKnownArrayElements(
+    Node* node, int arraylike_or_spread_index, CallFrequency const& frequency,
+    FeedbackSource const& feedback, SpeculationMode speculation_mode) {
+  Node* arguments_list =
+      NodeProperties::GetValueInput(node, arraylike_or_spread_index);
+  NodeVector elements(graph()->zone());
+  if (arguments_list->opcode() == IrOpcode::kJSCreateArray) {
+    // A single argument is the length of the new array rather than its only
+    // element, so we leave that case alone.
+    int const arity =
+        static_cast<int>(CreateArrayParametersOf(arguments_list->op()).arity());
+    if (arity == 1) return NoChange();
+
+    // Only arrays created by the Array function itself (and not by some
+    // subclass) are guaranteed to have the initial Array.prototype.
+    Node* target = NodeProperties::GetValueInput(arguments_list, 0);
+    Node* new_target = NodeProperties::GetValueInput(arguments_list, 1);
+    HeapObjectMatcher m(target);
+    if (target != new_target || !m.HasValue() ||
+        !m.Ref(broker()).equals(native_context().array_function())) {
+      return NoChange();
+    }
+    for (int i = 0; i < arity; ++i) {
+      elements.push_back(NodeProperties::GetValueInput(arguments_list, 2 + i));
+    }
+  } else {
+    DCHECK_EQ(IrOpcode::kJSCreateEmptyLiteralArray, arguments_list->opcode());
+  }
+
+  // Check if {node} is the only value user of {arguments_list} (except for
+  // value uses in frame states). Then nothing can have changed the elements
+  // or the [[Prototype]] of the array since it was created.
+  for (Edge edge : arguments_list->use_edges()) {
+    if (!NodeProperties::IsValueEdge(edge)) continue;
+    Node* const user = edge.from();
+    if (user == node && edge.index() == arraylike_or_spread_index) continue;
+    if (user->opcode() == IrOpcode::kFrameState ||
+        user->opcode() == IrOpcode::kStateValues) {
+      continue;
+    }
+    return NoChange();
+  }
+
+  // TODO(jgruber,v8:8888): Attempt to remove this restriction. The reason it
+  // currently exists is because we cannot create code dependencies in NCI code.
+  if (broker()->is_native_context_independent()) return NoChange();
+
+  // Spreading the array must not run any user code, which is guaranteed as
+  // long as no one messed with the %ArrayIteratorPrototype%.next method or
+  // the Array.prototype[@@iterator].
+  if (IsCallOrConstructWithSpread(node)) {
+    if (!dependencies()->DependOnArrayIteratorProtector()) return NoChange();
+  }
+
+  // Remove the {arguments_list} input from the {node}.
+  node->RemoveInput(arraylike_or_spread_index);
+  int const argc =
+      arraylike_or_spread_index - JSCallOrConstructNode::FirstArgumentIndex();
+  return ReduceCallOrConstructWithExpandedArguments(
+      node, argc, elements, frequency, feedback, speculation_mode);
+}
+
+// Inserts the {arguments} after the first {argc} arguments of the call or
+// construct with array-like or spread {node}, whose array-like or spread
+// input has already been removed, and turns it into a regular call or
+// construct.
+Reduction JSCallReducer::ReduceCallOrConstructWithExpandedArguments(
+    Node* node, int argc, NodeVector const& arguments,
+    CallFrequency const& frequency, FeedbackSource const& feedback,
+    SpeculationMode speculation_mode) {
+  for (Node* argument : arguments) {
     node->InsertInput(graph()->zone(),
-                      JSCallOrConstructNode::ArgumentIndex(argc++),
-                      parameters->InputAt(i));
+                      JSCallOrConstructNode::ArgumentIndex(argc++), argument);
   }
 
   if (IsCallWithArrayLikeOrSpread(node)) {
@@ -4160,6 +4246,7 @@ Reduction JSCallReducer::ReduceJSCall(Node* node,
 
   // Do not reduce calls to functions with break points.
   if (shared.HasBreakInfo()) return NoChange();
+  dependencies()->RecordBypassedEntry(shared);
 
   // Raise a TypeError if the {target} is a "classConstructor".
   if (IsClassConstructor(shared.kind())) {
@@ -4256,6 +4343,25 @@ Reduction JSCallReducer::ReduceJSCall(Node* node,
       return ReduceArrayIsArray(node);
     case Builtins::kArrayBufferIsView:
       return ReduceArrayBufferIsView(node);
+    case Builtins::kAtomicsLoad:
+      return ReduceAtomicsOperation(node, AtomicTypedElementOp::kLoad);
+    case Builtins::kAtomicsStore:
+      return ReduceAtomicsOperation(node, AtomicTypedElementOp::kStore);
+    case Builtins::kAtomicsAdd:
+      return ReduceAtomicsOperation(node, AtomicTypedElementOp::kAdd);
+    case Builtins::kAtomicsSub:
+      return ReduceAtomicsOperation(node, AtomicTypedElementOp::kSub);
+    case Builtins::kAtomicsAnd:
+      return ReduceAtomicsOperation(node, AtomicTypedElementOp::kAnd);
+    case Builtins::kAtomicsOr:
+      return ReduceAtomicsOperation(node, AtomicTypedElementOp::kOr);
+    case Builtins::kAtomicsXor:
+      return ReduceAtomicsOperation(node, AtomicTypedElementOp::kXor);
+    case Builtins::kAtomicsExchange:
+      return ReduceAtomicsOperation(node, AtomicTypedElementOp::kExchange);
+    case Builtins::kAtomicsCompareExchange:
+      return ReduceAtomicsOperation(node,
+                                    AtomicTypedElementOp::kCompareExchange);
     case Builtins::kDataViewPrototypeGetByteLength:
       return ReduceArrayBufferViewAccessor(
           node, JS_DATA_VIEW_TYPE,
@@ -4411,6 +4517,8 @@ Reduction JSCallReducer::ReduceJSCall(Node* node,
       return ReduceMapPrototypeGet(node);
     case Builtins::kMapPrototypeHas:
       return ReduceMapPrototypeHas(node);
+    case Builtins::kSetPrototypeHas:
+      return ReduceSetPrototypeHas(node);
     case Builtins::kRegExpPrototypeTest:
       return ReduceRegExpPrototypeTest(node);
     case Builtins::kReturnReceiver:
@@ -4620,6 +4728,7 @@ Reduction JSCallReducer::ReduceJSConstruct(Node* node) {
 
       // Do not reduce constructors with break points.
       if (function.shared().HasBreakInfo()) return NoChange();
+      dependencies()->RecordBypassedEntry(function.shared());
 
       // Don't inline cross native context.
       if (!function.native_context().equals(native_context())) {
@@ -6859,6 +6968,35 @@ Reduction JSCallReducer::ReduceMapPrototypeHas(Node* node) {
   return Replace(value);
 }
 
+Reduction JSCallReducer::ReduceSetPrototypeHas(Node* node) {
+  // We only optimize if we have target, receiver and key parameters.
+  JSCallNode n(node);
+  if (n.ArgumentCount() != 1) return NoChange();
+  Node* receiver = NodeProperties::GetValueInput(node, 1);
+  Node* effect = NodeProperties::GetEffectInput(node);
+  Node* control = NodeProperties::GetControlInput(node);
+  Node* key = NodeProperties::GetValueInput(node, 2);
+
+  MapInference inference(broker(), receiver, effect);
+  if (!inference.HaveMaps() || !inference.AllOfInstanceTypesAre(JS_SET_TYPE)) {
+    return NoChange();
+  }
+
+  Node* table = effect = graph()->NewNode(
+      simplified()->LoadField(AccessBuilder::ForJSCollectionTable()), receiver,
+      effect, control);
+
+  Node* index = effect = graph()->NewNode(
+      simplified()->FindOrderedHashSetEntry(), table, key, effect, control);
+
+  Node* value = graph()->NewNode(simplified()->NumberEqual(), index,
+                                 jsgraph()->MinusOneConstant());
+  value = graph()->NewNode(simplified()->BooleanNot(), value);
+
+  ReplaceWithValue(node, value, effect, control);
+  return Replace(value);
+}
+
 namespace {
 
 InstanceType InstanceTypeForCollectionKind(CollectionKind kind) {
@@ -7288,6 +7426,146 @@ uint32_t ExternalArrayElementSize(const ExternalArrayType element_type) {
 }
 }  // namespace
 
+// ES #sec-atomics.load, #sec-atomics.store, #sec-atomics.compareexchange and
+// the read-modify-write operations based on #sec-atomicreadmodifywrite.
+Reduction JSCallReducer::ReduceAtomicsOperation(Node* node,
+                                                AtomicTypedElementOp op) {
+  JSCallNode n(node);
+  CallParameters const& p = n.Parameters();
+  if (p.speculation_mode() == SpeculationMode::kDisallowSpeculation) {
+    return NoChange();
+  }
+
+  int value_count = 1;
+  if (op == AtomicTypedElementOp::kLoad) value_count = 0;
+  if (op == AtomicTypedElementOp::kCompareExchange) value_count = 2;
+  if (n.ArgumentCount() < 2 + value_count) return NoChange();
+
+  Effect effect = n.effect();
+  Control control = n.control();
+  Node* array = n.Argument(0);
+  Node* index = n.Argument(1);
+
+  // Only do stuff if the {array} is really an integer JSTypedArray with
+  // elements of at most 32 bits, so that the operation maps onto the Word32
+  // atomic machine operations. BigInt64Array and BigUint64Array are left to
+  // the builtins, as TurboFan cannot load from BigInt typed arrays yet.
+  MapInference inference(broker(), array, effect);
+  if (!inference.HaveMaps() ||
+      !inference.AllOfInstanceTypesAre(JS_TYPED_ARRAY_TYPE)) {
+    return NoChange();
+  }
+  MapHandles const& array_maps = inference.GetMaps();
+  ElementsKind elements_kind = MapRef(broker(), array_maps[0]).elements_kind();
+  ExternalArrayType array_type;
+  switch (elements_kind) {
+    case INT8_ELEMENTS:
+      array_type = kExternalInt8Array;
+      break;
+    case UINT8_ELEMENTS:
+      array_type = kExternalUint8Array;
+      break;
+    case INT16_ELEMENTS:
+      array_type = kExternalInt16Array;
+      break;
+    case UINT16_ELEMENTS:
+      array_type = kExternalUint16Array;
+      break;
+    case INT32_ELEMENTS:
+      array_type = kExternalInt32Array;
+      break;
+    case UINT32_ELEMENTS:
+      array_type = kExternalUint32Array;
+      break;
+    default:
+      return inference.NoChange();
+  }
+  for (Handle<Map> map : array_maps) {
+    if (MapRef(broker(), map).elements_kind() != elements_kind) {
+      return inference.NoChange();
+    }
+  }
+  inference.RelyOnMapsPreferStability(dependencies(), jsgraph(), &effect,
+                                      control, p.feedback());
+
+  // Load the underlying buffer, which also keeps the backing store alive
+  // during the atomic operation, and bail out if it was detached. Shared
+  // buffers cannot be detached, but the Atomics operations (except wait and
+  // notify) also accept TypedArrays on regular ArrayBuffers.
+  Node* buffer = effect = graph()->NewNode(
+      simplified()->LoadField(AccessBuilder::ForJSArrayBufferViewBuffer()),
+      array, effect, control);
+  if (!dependencies()->DependOnArrayBufferDetachingProtector()) {
+    Node* buffer_bit_field = effect = graph()->NewNode(
+        simplified()->LoadField(AccessBuilder::ForJSArrayBufferBitField()),
+        buffer, effect, control);
+    Node* check = graph()->NewNode(
+        simplified()->NumberEqual(),
+        graph()->NewNode(
+            simplified()->NumberBitwiseAnd(), buffer_bit_field,
+            jsgraph()->Constant(JSArrayBuffer::WasDetachedBit::kMask)),
+        jsgraph()->ZeroConstant());
+    effect = graph()->NewNode(
+        simplified()->CheckIf(DeoptimizeReason::kArrayBufferWasDetached,
+                              p.feedback()),
+        check, effect, control);
+  }
+
+  // Check that the {index} is within range for the {array}. The checks above
+  // and this one are ordinary checks, which later phases can eliminate or
+  // hoist out of loops like those of regular element accesses.
+  Node* length = effect = graph()->NewNode(
+      simplified()->LoadField(AccessBuilder::ForJSTypedArrayLength()), array,
+      effect, control);
+  index = effect = graph()->NewNode(simplified()->CheckBounds(p.feedback()),
+                                    index, length, effect, control);
+
+  // Coerce the values to Number. Atomics.store returns the value as converted
+  // by ToIntegerOrInfinity, so speculate that it is in Signed32 range there;
+  // the other operations only need the value truncated to the element type.
+  Node* values[2] = {nullptr, nullptr};
+  NumberOperationHint const hint = op == AtomicTypedElementOp::kStore
+                                       ? NumberOperationHint::kSigned32
+                                       : NumberOperationHint::kNumberOrOddball;
+  for (int i = 0; i < value_count; ++i) {
+    values[i] = effect = graph()->NewNode(
+        simplified()->SpeculativeToNumber(hint, p.feedback()),
+        n.Argument(2 + i), effect, control);
+  }
+
+  Node* base_pointer = effect = graph()->NewNode(
+      simplified()->LoadField(AccessBuilder::ForJSTypedArrayBasePointer()),
+      array, effect, control);
+  Node* external_pointer = effect = graph()->NewNode(
+      simplified()->LoadField(AccessBuilder::ForJSTypedArrayExternalPointer()),
+      array, effect, control);
+
+  const Operator* atomic_op = simplified()->AtomicTypedElement(op, array_type);
+  Node* value;
+  switch (value_count) {
+    case 0:
+      value = effect =
+          graph()->NewNode(atomic_op, buffer, base_pointer, external_pointer,
+                           index, effect, control);
+      break;
+    case 1:
+      value = effect =
+          graph()->NewNode(atomic_op, buffer, base_pointer, external_pointer,
+                           index, values[0], effect, control);
+      break;
+    default:
+      DCHECK_EQ(2, value_count);
+      value = effect = graph()->NewNode(atomic_op, buffer, base_pointer,
+                                        external_pointer, index, values[0],
+                                        values[1], effect, control);
+      break;
+  }
+  if (op == AtomicTypedElementOp::kStore) value = values[0];
+
+  ReplaceWithValue(node, value, effect, control);
+  return Replace(value);
+}
+
 Reduction JSCallReducer::ReduceDataViewAccess(Node* node, DataViewAccess access,
                                               ExternalArrayType element_type) {
   JSCallNode n(node);
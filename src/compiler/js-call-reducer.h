@@ -22,6 +22,7 @@ class JSGlobalProxy;
 namespace compiler {
 
 // Forward declarations.
+enum class AtomicTypedElementOp : uint8_t;
 class CallFrequency;
 class CommonOperatorBuilder;
 class CompilationDependencies;
@@ -117,6 +118,13 @@ class V8_EXPORT_PRIVATE JSCallReducer final : public AdvancedReducer {
       Node* node, int arraylike_or_spread_index, CallFrequency const& frequency,
       FeedbackSource const& feedback, SpeculationMode speculation_mode,
       CallFeedbackRelation feedback_relation);
+  Reduction ReduceCallOrConstructWithKnownArrayElements(
+      Node* node, int arraylike_or_spread_index, CallFrequency const& frequency,
+      FeedbackSource const& feedback, SpeculationMode speculation_mode);
+  Reduction ReduceCallOrConstructWithExpandedArguments(
+      Node* node, int argc, NodeVector const& arguments,
+      CallFrequency const& frequency, FeedbackSource const& feedback,
+      SpeculationMode speculation_mode);
   Reduction ReduceJSConstruct(Node* node);
   Reduction ReduceJSConstructWithArrayLike(Node* node);
   Reduction ReduceJSConstructWithSpread(Node* node);
@@ -176,6 +184,7 @@ class V8_EXPORT_PRIVATE JSCallReducer final : public AdvancedReducer {
   Reduction ReduceGlobalIsNaN(Node* node);
 
   Reduction ReduceMapPrototypeHas(Node* node);
+  Reduction ReduceSetPrototypeHas(Node* node);
   Reduction ReduceMapPrototypeGet(Node* node);
   Reduction ReduceCollectionIteration(Node* node,
                                       CollectionKind collection_kind,
@@ -192,6 +201,8 @@ class V8_EXPORT_PRIVATE JSCallReducer final : public AdvancedReducer {
                                           InstanceType instance_type,
                                           FieldAccess const& access);
 
+  Reduction ReduceAtomicsOperation(Node* node, AtomicTypedElementOp op);
+
   enum class DataViewAccess { kGet, kSet };
   Reduction ReduceDataViewAccess(Node* node, DataViewAccess access,
                                  ExternalArrayType element_type);
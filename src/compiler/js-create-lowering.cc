@@ -828,38 +828,6 @@ Reduction JSCreateLowering::ReduceJSCreateAsyncFunctionObject(Node* node) {
   return Changed(node);
 }
 
-namespace {
-
-MapRef MapForCollectionIterationKind(const NativeContextRef& native_context,
-                                     CollectionKind collection_kind,
-                                     IterationKind iteration_kind) {
-  switch (collection_kind) {
-    case CollectionKind::kSet:
-      switch (iteration_kind) {
-        case IterationKind::kKeys:
-          UNREACHABLE();
-        case IterationKind::kValues:
-          return native_context.set_value_iterator_map();
-        case IterationKind::kEntries:
-          return native_context.set_key_value_iterator_map();
-      }
-      break;
-    case CollectionKind::kMap:
-      switch (iteration_kind) {
-        case IterationKind::kKeys:
-          return native_context.map_key_iterator_map();
-        case IterationKind::kValues:
-          return native_context.map_value_iterator_map();
-        case IterationKind::kEntries:
-          return native_context.map_key_value_iterator_map();
-      }
-      break;
-  }
-  UNREACHABLE();
-}
-
-}  // namespace
-
 Reduction JSCreateLowering::ReduceJSCreateCollectionIterator(Node* node) {
   DCHECK_EQ(IrOpcode::kJSCreateCollectionIterator, node->opcode());
   CreateCollectionIteratorParameters const& p =
@@ -878,8 +846,8 @@ Reduction JSCreateLowering::ReduceJSCreateCollectionIterator(Node* node) {
   a.Allocate(JSCollectionIterator::kHeaderSize, AllocationType::kYoung,
              Type::OtherObject());
   a.Store(AccessBuilder::ForMap(),
-          MapForCollectionIterationKind(native_context(), p.collection_kind(),
-                                        p.iteration_kind()));
+          native_context().GetCollectionIteratorMap(p.collection_kind(),
+                                                    p.iteration_kind()));
   a.Store(AccessBuilder::ForJSObjectPropertiesOrHashKnownPointer(),
           jsgraph()->EmptyFixedArrayConstant());
   a.Store(AccessBuilder::ForJSObjectElements(),
@@ -3802,6 +3802,33 @@ MapRef NativeContextRef::GetInitialJSArrayMap(ElementsKind kind) const {
   }
 }
 
+MapRef NativeContextRef::GetCollectionIteratorMap(
+    CollectionKind collection_kind, IterationKind iteration_kind) const {
+  switch (collection_kind) {
+    case CollectionKind::kSet:
+      switch (iteration_kind) {
+        case IterationKind::kKeys:
+          UNREACHABLE();
+        case IterationKind::kValues:
+          return set_value_iterator_map();
+        case IterationKind::kEntries:
+          return set_key_value_iterator_map();
+      }
+      break;
+    case CollectionKind::kMap:
+      switch (iteration_kind) {
+        case IterationKind::kKeys:
+          return map_key_iterator_map();
+        case IterationKind::kValues:
+          return map_value_iterator_map();
+        case IterationKind::kEntries:
+          return map_key_value_iterator_map();
+      }
+      break;
+  }
+  UNREACHABLE();
+}
+
 base::Optional<JSFunctionRef> NativeContextRef::GetConstructorFunction(
     const MapRef& map) const {
   CHECK(map.IsPrimitiveMap());
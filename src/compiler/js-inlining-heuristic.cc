@@ -22,8 +22,17 @@ namespace compiler {
   } while (false)
 
 namespace {
-bool IsSmall(int const size) {
-  return size <= FLAG_max_inlined_bytecode_size_small;
+bool IsHot(CallFrequency const& frequency) {
+  return frequency.IsKnown() &&
+         frequency.value() >= FLAG_min_hot_inlining_frequency;
+}
+
+// Call sites that are hit many times per invocation of the caller (usually
+// because they sit in a loop) get a larger allowance for forced inlining.
+bool IsSmall(int const size, CallFrequency const& frequency) {
+  int const limit = IsHot(frequency) ? FLAG_max_inlined_bytecode_size_small_hot
+                                     : FLAG_max_inlined_bytecode_size_small;
+  return size <= limit;
 }
 
 bool CanConsiderForInlining(JSHeapBroker* broker,
@@ -165,6 +174,15 @@ Reduction JSInliningHeuristic::Reduce(Node* node) {
     return NoChange();
   }
 
+  // Gather feedback on how often this call site has been hit before.
+  if (node->opcode() == IrOpcode::kJSCall) {
+    CallParameters const p = CallParametersOf(node->op());
+    candidate.frequency = p.frequency();
+  } else {
+    ConstructParameters const p = ConstructParametersOf(node->op());
+    candidate.frequency = p.frequency();
+  }
+
   bool can_inline_candidate = false, candidate_is_small = true;
   candidate.total_size = 0;
   Node* frame_state = NodeProperties::GetFrameStateInput(node);
@@ -209,21 +227,13 @@ Reduction JSInliningHeuristic::Reduce(Node* node) {
           candidate.total_size += inlined_bytecode_size;
         }
       }
-      candidate_is_small = candidate_is_small &&
-                           IsSmall(bytecode.length() + inlined_bytecode_size);
+      int const size = bytecode.length() + inlined_bytecode_size;
+      candidate_is_small =
+          candidate_is_small && IsSmall(size, candidate.frequency);
     }
   }
   if (!can_inline_candidate) return NoChange();
 
-  // Gather feedback on how often this call site has been hit before.
-  if (node->opcode() == IrOpcode::kJSCall) {
-    CallParameters const p = CallParametersOf(node->op());
-    candidate.frequency = p.frequency();
-  } else {
-    ConstructParameters const p = ConstructParametersOf(node->op());
-    candidate.frequency = p.frequency();
-  }
-
   // Don't consider a {candidate} whose frequency is below the
   // threshold, i.e. a call site that is only hit once every N
   // invocations of the caller.
@@ -78,6 +78,12 @@ Reduction JSIntrinsicLowering::Reduce(Node* node) {
       return ReduceIsJSReceiver(node);
     case Runtime::kInlineIsSmi:
       return ReduceIsSmi(node);
+    case Runtime::kInlineLoadPrivateGetter:
+      return ReduceLoadPrivateAccessor(node,
+                                       AccessBuilder::ForAccessorPairGetter());
+    case Runtime::kInlineLoadPrivateSetter:
+      return ReduceLoadPrivateAccessor(node,
+                                       AccessBuilder::ForAccessorPairSetter());
     case Runtime::kInlineToLength:
       return ReduceToLength(node);
     case Runtime::kInlineToObject:
@@ -227,6 +233,16 @@ Reduction JSIntrinsicLowering::ReduceGeneratorGetResumeMode(Node* node) {
   return Change(node, op, generator, effect, control);
 }
 
+Reduction JSIntrinsicLowering::ReduceLoadPrivateAccessor(
+    Node* node, FieldAccess const& access) {
+  Node* const accessor_pair = NodeProperties::GetValueInput(node, 0);
+  Node* const effect = NodeProperties::GetEffectInput(node);
+  Node* const control = NodeProperties::GetControlInput(node);
+  Operator const* const op = simplified()->LoadField(access);
+
+  return Change(node, op, accessor_pair, effect, control);
+}
+
 Reduction JSIntrinsicLowering::ReduceIsInstanceType(
     Node* node, InstanceType instance_type) {
   // if (%_IsSmi(value)) {
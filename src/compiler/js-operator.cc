@@ -972,6 +972,11 @@ const Operator* JSOperatorBuilder::GeneratorStore(int register_count) {
       register_count);                                  // parameter
 }
 
+StackCheckKind StackCheckKindOf(const Operator* op) {
+  DCHECK_EQ(IrOpcode::kJSStackCheck, op->opcode());
+  return OpParameter<StackCheckKind>(op);
+}
+
 int RegisterCountOf(Operator const* op) {
   DCHECK_EQ(IrOpcode::kJSCreateAsyncFunctionObject, op->opcode());
   return OpParameter<int>(op);
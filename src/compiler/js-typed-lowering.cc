@@ -9,6 +9,7 @@
 #include "src/codegen/code-factory.h"
 #include "src/compiler/access-builder.h"
 #include "src/compiler/allocation-builder.h"
+#include "src/compiler/compilation-dependencies.h"
 #include "src/compiler/graph-assembler.h"
 #include "src/compiler/js-graph.h"
 #include "src/compiler/js-heap-broker.h"
@@ -122,10 +123,45 @@ class JSBinopReduction final {
           return left_string.IsSeqString() || left_string.IsExternalString();
         }
       }
+      // In concatenation chains (e.g. template literals) the inputs are often
+      // constants or earlier concatenations, whose combined length may be
+      // known to be large enough. As long as the right hand side can't be
+      // empty, any left hand side satisfies the ConsString invariant.
+      uint32_t const right_length = MinimumStringLength(right(), 0);
+      if (right_length > 0 &&
+          MinimumStringLength(left(), 0) + right_length >=
+              static_cast<uint32_t>(ConsString::kMinLength)) {
+        return true;
+      }
     }
     return false;
   }
 
+  // Returns a lower bound for the length of the string {node}, looking
+  // through constants and (a bounded number of) earlier concatenations.
+  uint32_t MinimumStringLength(Node* node, int depth) {
+    static const int kMaxDepth = 8;
+    switch (node->opcode()) {
+      case IrOpcode::kHeapConstant: {
+        HeapObjectMatcher m(node);
+        ObjectRef ref = m.Ref(lowering_->broker());
+        return ref.IsString() ? ref.AsString().length() : 0;
+      }
+      case IrOpcode::kNewConsString:
+      case IrOpcode::kStringConcat: {
+        if (depth >= kMaxDepth) return 0;
+        // Both bounds are at most String::kMaxLength, so the sum can't
+        // overflow.
+        uint32_t const length =
+            MinimumStringLength(node->InputAt(1), depth + 1) +
+            MinimumStringLength(node->InputAt(2), depth + 1);
+        return std::min(length, static_cast<uint32_t>(String::kMaxLength));
+      }
+      default:
+        return 0;
+    }
+  }
+
   // Inserts a CheckReceiver for the left input.
   void CheckLeftInputToReceiver() {
     Node* left_input = graph()->NewNode(simplified()->CheckReceiver(), left(),
@@ -444,10 +480,13 @@ class JSBinopReduction final {
 // - relax effects from generic but not-side-effecting operations
 
 JSTypedLowering::JSTypedLowering(Editor* editor, JSGraph* jsgraph,
-                                 JSHeapBroker* broker, Zone* zone)
+                                 JSHeapBroker* broker,
+                                 CompilationDependencies* dependencies,
+                                 Zone* zone)
     : AdvancedReducer(editor),
       jsgraph_(jsgraph),
       broker_(broker),
+      dependencies_(dependencies),
       empty_string_type_(
           Type::Constant(broker, factory()->empty_string(), graph()->zone())),
       pointer_comparable_type_(
@@ -1745,6 +1784,7 @@ Reduction JSTypedLowering::ReduceJSCall(Node* node) {
   if (shared.has_value()) {
     // Do not inline the call if we need to check whether to break at entry.
     if (shared->HasBreakInfo()) return NoChange();
+    dependencies()->RecordBypassedEntry(*shared);
 
     // Class constructors are callable, but [[Call]] will raise an exception.
     // See ES6 section 9.2.1 [[Call]] ( thisArgument, argumentsList ).
@@ -6,7 +6,9 @@
 
 #include "src/compiler/access-builder.h"
 #include "src/compiler/common-operator.h"
+#include "src/compiler/compilation-dependencies.h"
 #include "src/compiler/js-graph.h"
+#include "src/compiler/js-heap-broker.h"
 #include "src/compiler/node-properties.h"
 #include "src/heap/factory.h"
 #include "src/objects/objects-inl.h"
@@ -365,6 +367,32 @@ LoadElimination::AbstractMaps const* LoadElimination::AbstractMaps::Kill(
   return this;
 }
 
+LoadElimination::AbstractMaps const*
+LoadElimination::AbstractMaps::KillUnstable(
+    JSHeapBroker* broker, CompilationDependencies* dependencies,
+    Zone* zone) const {
+  // Dependencies can't be used for native context independent code.
+  if (broker->is_native_context_independent()) return nullptr;
+  AbstractMaps* that = nullptr;
+  for (auto pair : this->info_for_node_) {
+    ZoneHandleSet<Map> const& maps = pair.second;
+    bool all_stable = true;
+    for (size_t i = 0; i < maps.size(); ++i) {
+      if (!MapRef(broker, maps[i]).is_stable()) {
+        all_stable = false;
+        break;
+      }
+    }
+    if (!all_stable) continue;
+    for (size_t i = 0; i < maps.size(); ++i) {
+      dependencies->DependOnStableMap(MapRef(broker, maps[i]));
+    }
+    if (that == nullptr) that = zone->New<AbstractMaps>(zone);
+    that->info_for_node_.insert(pair);
+  }
+  return that;
+}
+
 LoadElimination::AbstractMaps const* LoadElimination::AbstractMaps::Merge(
     AbstractMaps const* that, Zone* zone) const {
   if (this->Equals(that)) return this;
@@ -628,16 +656,29 @@ LoadElimination::AbstractState::KillFields(Node* object, MaybeHandle<Name> name,
 }
 
 LoadElimination::AbstractState const* LoadElimination::AbstractState::KillAll(
+    JSHeapBroker* broker, CompilationDependencies* dependencies,
     Zone* zone) const {
-  // Kill everything except for const fields
+  // Kill everything except for const fields and the maps of objects whose
+  // maps are all stable. An object can't leave a stable map without the map
+  // becoming unstable, which deoptimizes the code through the stable map
+  // dependencies, so these maps even survive arbitrary side effects.
+  AbstractMaps const* maps =
+      this->maps_ ? this->maps_->KillUnstable(broker, dependencies, zone)
+                  : nullptr;
+  bool has_const_fields = false;
   for (size_t i = 0; i < const_fields_.size(); ++i) {
     if (const_fields_[i]) {
-      AbstractState* that = zone->New<AbstractState>();
-      that->const_fields_ = const_fields_;
-      return that;
+      has_const_fields = true;
+      break;
     }
   }
-  return LoadElimination::empty_state();
+  if (!has_const_fields && maps == nullptr) {
+    return LoadElimination::empty_state();
+  }
+  AbstractState* that = zone->New<AbstractState>();
+  that->const_fields_ = const_fields_;
+  that->maps_ = maps;
+  return that;
 }
 
 LoadElimination::FieldInfo const* LoadElimination::AbstractState::LookupField(
@@ -1221,7 +1262,7 @@ Reduction LoadElimination::ReduceOtherNode(Node* node) {
       if (state == nullptr) return NoChange();
       // Check if this {node} has some uncontrolled side effects.
       if (!node->op()->HasProperty(Operator::kNoWrite)) {
-        state = state->KillAll(zone());
+        state = state->KillAll(broker(), dependencies(), zone());
       }
       return UpdateState(node, state);
     } else {
@@ -1341,7 +1382,10 @@ LoadElimination::AbstractState const* LoadElimination::ComputeLoopState(
             break;
           }
           default:
-            return state->KillAll(zone());
+            // Keep looking at the other effects in the loop, since they
+            // might still change the maps that survive the KillAll.
+            state = state->KillAll(broker(), dependencies(), zone());
+            break;
         }
       }
       for (int i = 0; i < current->op()->EffectInputCount(); ++i) {
@@ -23,15 +23,22 @@ namespace compiler {
 
 // Forward declarations.
 class CommonOperatorBuilder;
+class CompilationDependencies;
 struct FieldAccess;
 class Graph;
 class JSGraph;
+class JSHeapBroker;
 
 class V8_EXPORT_PRIVATE LoadElimination final
     : public NON_EXPORTED_BASE(AdvancedReducer) {
  public:
-  LoadElimination(Editor* editor, JSGraph* jsgraph, Zone* zone)
-      : AdvancedReducer(editor), node_states_(zone), jsgraph_(jsgraph) {}
+  LoadElimination(Editor* editor, CompilationDependencies* dependencies,
+                  JSGraph* jsgraph, JSHeapBroker* broker, Zone* zone)
+      : AdvancedReducer(editor),
+        node_states_(zone),
+        dependencies_(dependencies),
+        jsgraph_(jsgraph),
+        broker_(broker) {}
   ~LoadElimination() final = default;
 
   const char* reducer_name() const override { return "LoadElimination"; }
@@ -182,6 +189,11 @@ class V8_EXPORT_PRIVATE LoadElimination final
     bool Lookup(Node* object, ZoneHandleSet<Map>* object_maps) const;
     AbstractMaps const* Kill(const AliasStateInfo& alias_info,
                              Zone* zone) const;
+    // Only keeps the objects whose maps are all stable, and records
+    // dependencies on the stability of these maps.
+    AbstractMaps const* KillUnstable(JSHeapBroker* broker,
+                                     CompilationDependencies* dependencies,
+                                     Zone* zone) const;
     bool Equals(AbstractMaps const* that) const {
       return this == that || this->info_for_node_ == that->info_for_node_;
     }
@@ -249,7 +261,9 @@ class V8_EXPORT_PRIVATE LoadElimination final
                                    MaybeHandle<Name> name, Zone* zone) const;
     AbstractState const* KillFields(Node* object, MaybeHandle<Name> name,
                                     Zone* zone) const;
-    AbstractState const* KillAll(Zone* zone) const;
+    AbstractState const* KillAll(JSHeapBroker* broker,
+                                 CompilationDependencies* dependencies,
+                                 Zone* zone) const;
     FieldInfo const* LookupField(Node* object, IndexRange index,
                                  ConstFieldInfo const_field_info) const;
 
@@ -330,11 +344,15 @@ class V8_EXPORT_PRIVATE LoadElimination final
   Isolate* isolate() const;
   Factory* factory() const;
   Graph* graph() const;
+  CompilationDependencies* dependencies() const { return dependencies_; }
   JSGraph* jsgraph() const { return jsgraph_; }
+  JSHeapBroker* broker() const { return broker_; }
   Zone* zone() const { return node_states_.zone(); }
 
   AbstractStateForEffectNodes node_states_;
+  CompilationDependencies* const dependencies_;
   JSGraph* const jsgraph_;
+  JSHeapBroker* const broker_;
 
   DISALLOW_COPY_AND_ASSIGN(LoadElimination);
 };
@@ -4,9 +4,14 @@
 
 #include "src/compiler/loop-variable-optimizer.h"
 
+#include <algorithm>
+#include <cmath>
+
 #include "src/compiler/common-operator.h"
 #include "src/compiler/graph.h"
+#include "src/compiler/js-operator.h"
 #include "src/compiler/node-marker.h"
+#include "src/compiler/node-matchers.h"
 #include "src/compiler/node-properties.h"
 #include "src/compiler/node.h"
 #include "src/zone/zone-containers.h"
@@ -311,6 +316,71 @@ void LoopVariableOptimizer::ChangeToInductionVariablePhis() {
   }
 }
 
+// static
+bool LoopVariableOptimizer::GetMaxBackedgeCount(
+    InductionVariable* induction_var, double* count) {
+  // Only consider variables which move towards their bound by at least one in
+  // each iteration, and values where this isn't affected by rounding.
+  NumberMatcher init(induction_var->init_value());
+  NumberMatcher increment(induction_var->increment());
+  if (!init.HasValue() || !increment.HasValue()) return false;
+  if (!(increment.Value() >= 1)) return false;
+  if (!(std::abs(init.Value()) <= kMaxInt)) return false;
+  if (!(increment.Value() <= kMaxInt)) return false;
+
+  bool const is_addition =
+      induction_var->Type() == InductionVariable::ArithmeticType::kAddition;
+  // The bounds hold on every path to the loop's backedge, so for an
+  // increasing variable the upper bounds limit the number of iterations, and
+  // the lower bounds for a decreasing one.
+  const ZoneVector<InductionVariable::Bound>& bounds =
+      is_addition ? induction_var->upper_bounds()
+                  : induction_var->lower_bounds();
+  bool found = false;
+  for (InductionVariable::Bound bound : bounds) {
+    NumberMatcher limit(bound.bound);
+    if (!limit.HasValue() || !(std::abs(limit.Value()) <= kMaxInt)) continue;
+    double const distance = is_addition ? limit.Value() - init.Value()
+                                        : init.Value() - limit.Value();
+    double const backedges =
+        std::max(0.0, std::floor(distance / increment.Value()) + 1);
+    if (!found || backedges < *count) *count = backedges;
+    found = true;
+  }
+  return found;
+}
+
+void LoopVariableOptimizer::RemoveBoundedLoopStackChecks() {
+  for (auto entry : induction_vars_) {
+    InductionVariable* induction_var = entry.second;
+    // The iteration body stack check is the last effect before the backedge.
+    Node* effect_phi = induction_var->effect_phi();
+    Node* stack_check =
+        NodeProperties::GetEffectInput(effect_phi, kFirstBackedge);
+    if (stack_check->opcode() != IrOpcode::kJSStackCheck ||
+        StackCheckKindOf(stack_check->op()) !=
+            StackCheckKind::kJSIterationBody ||
+        NodeProperties::IsExceptionalCall(stack_check)) {
+      continue;
+    }
+
+    double max_backedges;
+    if (!GetMaxBackedgeCount(induction_var, &max_backedges) ||
+        max_backedges > FLAG_turbo_bounded_loop_max_iterations) {
+      continue;
+    }
+
+    TRACE("Removing stack check %i from loop %i (at most %.0f iterations)\n",
+          stack_check->id(),
+          NodeProperties::GetControlInput(induction_var->phi())->id(),
+          max_backedges);
+    NodeProperties::ReplaceUses(stack_check, nullptr,
+                                NodeProperties::GetEffectInput(stack_check),
+                                NodeProperties::GetControlInput(stack_check));
+    stack_check->Kill();
+  }
+}
+
 void LoopVariableOptimizer::ChangeToPhisAndInsertGuards() {
   for (auto entry : induction_vars_) {
     InductionVariable* induction_var = entry.second;
@@ -81,6 +81,14 @@ class LoopVariableOptimizer {
   void ChangeToInductionVariablePhis();
   void ChangeToPhisAndInsertGuards();
 
+  // Removes the iteration body stack checks of loops which are known to take
+  // their backedge at most --turbo-bounded-loop-max-iterations times. These
+  // checks only serve to handle interrupts (the stack doesn't grow across
+  // iterations), and for such loops the interrupt latency stays bounded
+  // without them: anything in the loop body that may run for long (calls,
+  // inner loops) performs its own checks.
+  void RemoveBoundedLoopStackChecks();
+
  private:
   const int kAssumedLoopEntryIndex = 0;
   const int kFirstBackedge = 1;
@@ -114,6 +122,12 @@ class LoopVariableOptimizer {
   InductionVariable* TryGetInductionVariable(Node* phi);
   void DetectInductionVariables(Node* loop);
 
+  // Returns true and sets {count} to an upper bound of the number of times
+  // the backedge of the loop of {induction_var} can be taken if that's known
+  // from the constant initial value, increment and bounds of the variable.
+  static bool GetMaxBackedgeCount(InductionVariable* induction_var,
+                                  double* count);
+
   Graph* graph() { return graph_; }
   CommonOperatorBuilder* common() { return common_; }
   Zone* zone() { return zone_; }
@@ -348,6 +348,35 @@ base::Optional<MapRef> NodeProperties::GetJSCreateMap(JSHeapBroker* broker,
   return base::nullopt;
 }
 
+namespace {
+
+// Returns the map of the objects allocated by the iteration protocol related
+// {node}s, which is always the same for a given native context.
+Handle<Map> GetIterationObjectMap(JSHeapBroker* broker, Node* node) {
+  NativeContextRef native_context = broker->target_native_context();
+  switch (node->opcode()) {
+    case IrOpcode::kJSCreateArrayIterator:
+      return native_context.initial_array_iterator_map().object();
+    case IrOpcode::kJSCreateCollectionIterator: {
+      CreateCollectionIteratorParameters const& p =
+          CreateCollectionIteratorParametersOf(node->op());
+      return native_context
+          .GetCollectionIteratorMap(p.collection_kind(), p.iteration_kind())
+          .object();
+    }
+    case IrOpcode::kJSCreateIterResultObject:
+      return native_context.iterator_result_map().object();
+    case IrOpcode::kJSCreateKeyValueArray:
+      return native_context.js_array_packed_elements_map().object();
+    case IrOpcode::kJSCreateStringIterator:
+      return native_context.initial_string_iterator_map().object();
+    default:
+      UNREACHABLE();
+  }
+}
+
+}  // namespace
+
 // static
 NodeProperties::InferReceiverMapsResult NodeProperties::InferReceiverMapsUnsafe(
     JSHeapBroker* broker, Node* receiver, Node* effect,
@@ -404,6 +433,21 @@ NodeProperties::InferReceiverMapsResult NodeProperties::InferReceiverMapsUnsafe(
         result = kUnreliableReceiverMaps;  // JSCreate can have side-effect.
         break;
       }
+      case IrOpcode::kJSCreateArrayIterator:
+      case IrOpcode::kJSCreateCollectionIterator:
+      case IrOpcode::kJSCreateIterResultObject:
+      case IrOpcode::kJSCreateKeyValueArray:
+      case IrOpcode::kJSCreateStringIterator: {
+        if (IsSame(receiver, effect)) {
+          *maps_return =
+              ZoneHandleSet<Map>(GetIterationObjectMap(broker, receiver));
+          return result;
+        }
+        // These operators are eliminatable and don't change the map of
+        // any other object.
+        DCHECK(effect->op()->HasProperty(Operator::kNoWrite));
+        break;
+      }
       case IrOpcode::kJSCreatePromise: {
         if (IsSame(receiver, effect)) {
           *maps_return = ZoneHandleSet<Map>(broker->target_native_context()
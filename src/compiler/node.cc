@@ -8,26 +8,45 @@ namespace v8 {
 namespace internal {
 namespace compiler {
 
+#ifdef V8_COMPRESS_ZONES
+STATIC_ASSERT(sizeof(ZoneNodePtr) == kUInt32Size);
+#else
+STATIC_ASSERT(sizeof(ZoneNodePtr) == kSystemPointerSize);
+#endif
+
+namespace {
+
+// Size of the {count} uses in front of a Node or OutOfLineInputs, including
+// the padding that keeps the latter pointer-aligned.
+size_t UsesSize(int count, size_t use_size) {
+  return RoundUp(count * use_size, kSystemPointerSize);
+}
+
+}  // namespace
+
 Node::OutOfLineInputs* Node::OutOfLineInputs::New(Zone* zone, int capacity) {
+  DCHECK_IMPLIES(kCompressGraphZone, zone->supports_compression());
+  size_t uses_size = UsesSize(capacity, sizeof(Use));
   size_t size =
-      sizeof(OutOfLineInputs) + capacity * (sizeof(Node*) + sizeof(Use));
+      uses_size + sizeof(OutOfLineInputs) + capacity * sizeof(ZoneNodePtr);
   intptr_t raw_buffer =
       reinterpret_cast<intptr_t>(zone->Allocate<Node::OutOfLineInputs>(size));
   Node::OutOfLineInputs* outline =
-      reinterpret_cast<OutOfLineInputs*>(raw_buffer + capacity * sizeof(Use));
+      reinterpret_cast<OutOfLineInputs*>(raw_buffer + uses_size);
   outline->capacity_ = capacity;
   outline->count_ = 0;
   return outline;
 }
 
 
-void Node::OutOfLineInputs::ExtractFrom(Use* old_use_ptr, Node** old_input_ptr,
+void Node::OutOfLineInputs::ExtractFrom(Use* old_use_ptr,
+                                        ZoneNodePtr* old_input_ptr,
                                         int count) {
   DCHECK_GE(count, 0);
   // Extract the inputs from the old use and input pointers and copy them
   // to this out-of-line-storage.
   Use* new_use_ptr = reinterpret_cast<Use*>(this) - 1;
-  Node** new_input_ptr = inputs();
+  ZoneNodePtr* new_input_ptr = inputs();
   CHECK_IMPLIES(count > 0, Use::InputIndexField::is_valid(count - 1));
   for (int current = 0; current < count; current++) {
     new_use_ptr->bit_field_ =
@@ -55,11 +74,14 @@ void Node::OutOfLineInputs::ExtractFrom(Use* old_use_ptr, Node** old_input_ptr,
 struct NodeWithOutOfLineInputs {};
 struct NodeWithInLineInputs {};
 
-Node* Node::New(Zone* zone, NodeId id, const Operator* op, int input_count,
-                Node* const* inputs, bool has_extensible_inputs) {
+template <typename NodePtrT>
+Node* Node::NewImpl(Zone* zone, NodeId id, const Operator* op, int input_count,
+                    NodePtrT const* inputs, bool has_extensible_inputs) {
+  // Node uses compressed pointers, so zone must support pointer compression.
+  DCHECK_IMPLIES(kCompressGraphZone, zone->supports_compression());
   DCHECK_GE(input_count, 0);
 
-  Node** input_ptr;
+  ZoneNodePtr* input_ptr;
   Use* use_ptr;
   Node* node;
   bool is_inline;
@@ -80,7 +102,7 @@ Node* Node::New(Zone* zone, NodeId id, const Operator* op, int input_count,
 
     // Allocate node, with space for OutOfLineInputs pointer.
     void* node_buffer = zone->Allocate<NodeWithOutOfLineInputs>(
-        sizeof(Node) + sizeof(OutOfLineInputs*));
+        sizeof(Node) + sizeof(ZoneOutOfLineInputsPtr));
     node = new (node_buffer) Node(id, op, kOutlineMarker, 0);
     node->set_outline_inputs(outline);
 
@@ -99,11 +121,14 @@ Node* Node::New(Zone* zone, NodeId id, const Operator* op, int input_count,
       capacity = std::min(input_count + 3, max);
     }
 
-    size_t size = sizeof(Node) + capacity * (sizeof(Node*) + sizeof(Use));
+    // The inline input slots must be able to hold the OutOfLineInputs
+    // pointer once the node switches to out-of-line inputs.
+    STATIC_ASSERT(sizeof(ZoneOutOfLineInputsPtr) == sizeof(ZoneNodePtr));
+    size_t uses_size = UsesSize(capacity, sizeof(Use));
+    size_t size = uses_size + sizeof(Node) + capacity * sizeof(ZoneNodePtr);
     intptr_t raw_buffer =
         reinterpret_cast<intptr_t>(zone->Allocate<NodeWithInLineInputs>(size));
-    void* node_buffer =
-        reinterpret_cast<void*>(raw_buffer + capacity * sizeof(Use));
+    void* node_buffer = reinterpret_cast<void*>(raw_buffer + uses_size);
 
     node = new (node_buffer) Node(id, op, input_count, capacity);
     input_ptr = node->inline_inputs();
@@ -126,13 +151,18 @@ Node* Node::New(Zone* zone, NodeId id, const Operator* op, int input_count,
   return node;
 }
 
+Node* Node::New(Zone* zone, NodeId id, const Operator* op, int input_count,
+                Node* const* inputs, bool has_extensible_inputs) {
+  return NewImpl(zone, id, op, input_count, inputs, has_extensible_inputs);
+}
 
 Node* Node::Clone(Zone* zone, NodeId id, const Node* node) {
   int const input_count = node->InputCount();
-  Node* const* const inputs = node->has_inline_inputs()
-                                  ? node->inline_inputs()
-                                  : node->outline_inputs()->inputs();
-  Node* const clone = New(zone, id, node->op(), input_count, inputs, false);
+  ZoneNodePtr const* const inputs = node->has_inline_inputs()
+                                        ? node->inline_inputs()
+                                        : node->outline_inputs()->inputs();
+  Node* const clone =
+      NewImpl(zone, id, node->op(), input_count, inputs, false);
   clone->set_type(node->type());
   return clone;
 }
@@ -236,7 +266,7 @@ Node* Node::RemoveInput(int index) {
 }
 
 void Node::ClearInputs(int start, int count) {
-  Node** input_ptr = GetInputPtr(start);
+  ZoneNodePtr* input_ptr = GetInputPtr(start);
   Use* use_ptr = GetUsePtr(start);
   while (count-- > 0) {
     DCHECK_EQ(input_ptr, use_ptr->input_ptr());
@@ -397,7 +427,7 @@ Node::Node(NodeId id, const Operator* op, int inline_count, int inline_capacity)
 
 void Node::AppendUse(Use* use) {
   DCHECK(first_use_ == nullptr || first_use_->prev == nullptr);
-  DCHECK_EQ(this, *use->input_ptr());
+  DCHECK(*use->input_ptr() == this);
   use->next = first_use_;
   use->prev = nullptr;
   if (first_use_) first_use_->prev = use;
@@ -408,10 +438,10 @@ void Node::AppendUse(Use* use) {
 void Node::RemoveUse(Use* use) {
   DCHECK(first_use_ == nullptr || first_use_->prev == nullptr);
   if (use->prev) {
-    DCHECK_NE(first_use_, use);
+    DCHECK(first_use_ != use);
     use->prev->next = use->next;
   } else {
-    DCHECK_EQ(first_use_, use);
+    DCHECK(first_use_ == use);
     first_use_ = use->next;
   }
   if (use->next) {
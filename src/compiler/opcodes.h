@@ -394,6 +394,7 @@
   V(ArgumentsFrame)                     \
   V(ArgumentsLength)                    \
   V(AssertType)                         \
+  V(AtomicTypedElement)                 \
   V(BooleanNot)                         \
   V(CheckBounds)                        \
   V(CheckClosure)                       \
@@ -421,6 +422,8 @@
   V(FastApiCall)                        \
   V(FindOrderedHashMapEntry)            \
   V(FindOrderedHashMapEntryForInt32Key) \
+  V(FindOrderedHashSetEntry)            \
+  V(FindOrderedHashSetEntryForInt32Key) \
   V(LoadDataViewElement)                \
   V(LoadElement)                        \
   V(LoadField)                          \
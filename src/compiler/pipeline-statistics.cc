@@ -7,6 +7,7 @@
 #include "src/codegen/optimized-compilation-info.h"
 #include "src/compiler/pipeline-statistics.h"
 #include "src/compiler/zone-stats.h"
+#include "src/flags/flags.h"
 #include "src/objects/shared-function-info.h"
 #include "src/objects/string.h"
 #include "src/tracing/trace-event.h"
@@ -23,6 +24,12 @@ constexpr const char kTraceCategory[] =           // --
     TRACE_DISABLED_BY_DEFAULT("v8.turbofan") ","  // --
     TRACE_DISABLED_BY_DEFAULT("v8.wasm.detailed");
 
+const char* TierName(OptimizedCompilationInfo* info) {
+  if (info->IsOptimizing()) return FLAG_turboprop ? "Turboprop" : "TurboFan";
+  if (info->IsWasm()) return "Wasm";
+  return "Stubs";
+}
+
 }  // namespace
 
 void PipelineStatistics::CommonStats::Begin(
@@ -62,6 +69,7 @@ PipelineStatistics::PipelineStatistics(OptimizedCompilationInfo* info,
       zone_stats_(zone_stats),
       compilation_stats_(compilation_stats),
       source_size_(0),
+      tier_name_(TierName(info)),
       phase_kind_name_(nullptr),
       phase_name_(nullptr) {
   if (info->has_shared_info()) {
@@ -77,7 +85,8 @@ PipelineStatistics::~PipelineStatistics() {
   if (InPhaseKind()) EndPhaseKind();
   CompilationStatistics::BasicStats diff;
   total_stats_.End(this, &diff);
-  compilation_stats_->RecordTotalStats(source_size_, diff);
+  compilation_stats_->RecordTotalStats(tier_name_, source_size_, code_size_,
+                                       diff);
 }
 
 
@@ -27,6 +27,9 @@ class PipelineStatistics : public Malloced {
   void BeginPhaseKind(const char* phase_kind_name);
   void EndPhaseKind();
 
+  // Size of the generated instructions, recorded once code is finalized.
+  void set_code_size(size_t code_size) { code_size_ = code_size; }
+
  private:
   size_t OuterZoneSize() {
     return static_cast<size_t>(outer_zone_->allocation_size());
@@ -64,6 +67,9 @@ class PipelineStatistics : public Malloced {
   // Stats for the entire compilation.
   CommonStats total_stats_;
   size_t source_size_;
+  size_t code_size_ = 0;
+  // Optimization tier the stats are attributed to.
+  const char* tier_name_;
 
   // Stats for phase kind.
   const char* phase_kind_name_;
@@ -1486,6 +1486,9 @@ struct TyperPhase {
     LoopVariableOptimizer induction_vars(data->jsgraph()->graph(),
                                          data->common(), temp_zone);
     if (FLAG_turbo_loop_variable) induction_vars.Run();
+    if (FLAG_turbo_elide_bounded_loop_stack_checks) {
+      induction_vars.RemoveBoundedLoopStackChecks();
+    }
     typer->Run(roots, &induction_vars);
   }
 };
@@ -1588,7 +1591,8 @@ struct TypedLoweringPhase {
                                      data->jsgraph(), data->broker(),
                                      temp_zone);
     JSTypedLowering typed_lowering(&graph_reducer, data->jsgraph(),
-                                   data->broker(), temp_zone);
+                                   data->broker(), data->dependencies(),
+                                   temp_zone);
     ConstantFoldingReducer constant_folding_reducer(
         &graph_reducer, data->jsgraph(), data->broker());
     TypedOptimization typed_optimization(&graph_reducer, data->dependencies(),
@@ -1822,7 +1826,8 @@ struct LoadEliminationPhase {
     DeadCodeElimination dead_code_elimination(&graph_reducer, data->graph(),
                                               data->common(), temp_zone);
     RedundancyElimination redundancy_elimination(&graph_reducer, temp_zone);
-    LoadElimination load_elimination(&graph_reducer, data->jsgraph(),
+    LoadElimination load_elimination(&graph_reducer, data->dependencies(),
+                                     data->jsgraph(), data->broker(),
                                      temp_zone);
     CheckpointElimination checkpoint_elimination(&graph_reducer);
     ValueNumberingReducer value_numbering(temp_zone, data->graph()->zone());
@@ -3333,7 +3338,14 @@ bool PipelineImpl::SelectInstructions(Linkage* linkage) {
       config = RegisterConfiguration::Default();
     }
 
-    if (FLAG_turboprop_mid_tier_reg_alloc) {
+    // Linear scan allocation becomes superlinear for huge functions, so fall
+    // back to the mid-tier allocator above the configured size.
+    const int instruction_count =
+        static_cast<int>(data->sequence()->instructions().size());
+    const bool is_huge =
+        FLAG_mid_tier_reg_alloc_instruction_threshold > 0 &&
+        instruction_count >= FLAG_mid_tier_reg_alloc_instruction_threshold;
+    if (FLAG_turboprop_mid_tier_reg_alloc || is_huge) {
       AllocateRegistersForMidTier(config, call_descriptor, run_verifier);
     } else {
       AllocateRegistersForTopTier(config, call_descriptor, run_verifier);
@@ -3433,6 +3445,12 @@ void PipelineImpl::AssembleCode(Linkage* linkage,
                                 std::unique_ptr<AssemblerBuffer> buffer) {
   PipelineData* data = this->data_;
   data->BeginPhaseKind("V8.TFCodeGeneration");
+  if (data->dependencies() != nullptr) {
+    for (Handle<SharedFunctionInfo> shared :
+         data->dependencies()->bypassed_entries()) {
+      data->info()->bypassed_entries().push_back(shared);
+    }
+  }
   data->InitializeCodeGenerator(linkage, std::move(buffer));
 
   Run<AssembleCodePhase>();
@@ -3464,6 +3482,10 @@ MaybeHandle<Code> PipelineImpl::FinalizeCode(bool retire_broker) {
   }
 
   info()->SetCode(code);
+  if (data->pipeline_statistics() != nullptr) {
+    data->pipeline_statistics()->set_code_size(
+        static_cast<size_t>(code->raw_instruction_size()));
+  }
   PrintCode(isolate(), code, info());
 
   if (info()->trace_turbo_json()) {
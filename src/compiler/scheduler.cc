@@ -4,6 +4,7 @@
 
 #include "src/compiler/scheduler.h"
 
+#include <algorithm>
 #include <iomanip>
 
 #include "src/base/iterator.h"
@@ -27,6 +28,16 @@ namespace compiler {
     if (FLAG_trace_turbo_scheduler) PrintF(__VA_ARGS__); \
   } while (false)
 
+namespace {
+
+// A successor that is visited a non-trivial number of times during profiling
+// and substantially more often than its alternatives is considered likely,
+// and the alternatives are deferred.
+constexpr uint32_t kProfileMinimumCount = 100000;
+constexpr uint32_t kProfileThresholdRatio = 4000;
+
+}  // namespace
+
 Scheduler::Scheduler(Zone* zone, Graph* graph, Schedule* schedule, Flags flags,
                      size_t node_count_hint, TickCounter* tick_counter,
                      const ProfileDataFromFile* profile_data)
@@ -482,15 +493,11 @@ class CFGBuilder : public ZoneObject {
           profile_data->GetCounter(successor_blocks[0]->id().ToSize());
       uint32_t block_one_count =
           profile_data->GetCounter(successor_blocks[1]->id().ToSize());
-      // If a branch is visited a non-trivial number of times and substantially
-      // more often than its alternative, then mark it as likely.
-      constexpr uint32_t kMinimumCount = 100000;
-      constexpr uint32_t kThresholdRatio = 4000;
-      if (block_zero_count > kMinimumCount &&
-          block_zero_count / kThresholdRatio > block_one_count) {
+      if (block_zero_count > kProfileMinimumCount &&
+          block_zero_count / kProfileThresholdRatio > block_one_count) {
         hint_from_profile = BranchHint::kTrue;
-      } else if (block_one_count > kMinimumCount &&
-                 block_one_count / kThresholdRatio > block_zero_count) {
+      } else if (block_one_count > kProfileMinimumCount &&
+                 block_one_count / kProfileThresholdRatio > block_zero_count) {
         hint_from_profile = BranchHint::kFalse;
       }
     }
@@ -564,6 +571,24 @@ class CFGBuilder : public ZoneObject {
         successor_blocks[index]->set_deferred(true);
       }
     }
+    if (const ProfileDataFromFile* profile_data = scheduler_->profile_data()) {
+      // Defer the cases that were (almost) never taken while profiling.
+      uint32_t max_count = 0;
+      for (size_t index = 0; index < successor_count; ++index) {
+        uint32_t count =
+            profile_data->GetCounter(successor_blocks[index]->id().ToSize());
+        max_count = std::max(max_count, count);
+      }
+      if (max_count > kProfileMinimumCount) {
+        for (size_t index = 0; index < successor_count; ++index) {
+          uint32_t count =
+              profile_data->GetCounter(successor_blocks[index]->id().ToSize());
+          if (max_count / kProfileThresholdRatio > count) {
+            successor_blocks[index]->set_deferred(true);
+          }
+        }
+      }
+    }
   }
 
   void ConnectMerge(Node* merge) {
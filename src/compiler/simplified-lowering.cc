@@ -1726,6 +1726,9 @@ class RepresentationSelector {
         return MachineType::Float64();
       case CTypeInfo::Type::kV8Value:
         return MachineType::AnyTagged();
+      case CTypeInfo::Type::kArrayBufferView:
+      case CTypeInfo::Type::kOneByteString:
+        return MachineType::Pointer();
     }
   }
 
@@ -1752,6 +1755,10 @@ class RepresentationSelector {
       case CTypeInfo::Type::kUint64:
         return UseInfo::Word64();
       case CTypeInfo::Type::kV8Value:
+      // Checked and unpacked during effect control linearization, which falls
+      // back to the slow call on a type mismatch.
+      case CTypeInfo::Type::kArrayBufferView:
+      case CTypeInfo::Type::kOneByteString:
         return UseInfo::AnyTagged();
     }
   }
@@ -3207,6 +3214,26 @@ class RepresentationSelector {
         SetOutput<T>(node, rep);
         return;
       }
+      case IrOpcode::kAtomicTypedElement: {
+        AtomicTypedElementParameters const& params =
+            AtomicTypedElementParametersOf(node->op());
+        MachineRepresentation const rep =
+            MachineRepresentationFromArrayType(params.array_type());
+        ProcessInput<T>(node, 0, UseInfo::AnyTagged());  // buffer
+        ProcessInput<T>(node, 1, UseInfo::AnyTagged());  // base pointer
+        ProcessInput<T>(node, 2, UseInfo::Word());       // external pointer
+        ProcessInput<T>(node, 3, UseInfo::Word());       // index
+        int const value_input_count = node->op()->ValueInputCount();
+        for (int i = 4; i < value_input_count; ++i) {
+          ProcessInput<T>(node, i,
+                          TruncatingUseInfoFromRepresentation(rep));  // value
+        }
+        ProcessRemainingInputs<T>(node, value_input_count);
+        SetOutput<T>(node, params.op() == AtomicTypedElementOp::kStore
+                               ? MachineRepresentation::kNone
+                               : rep);
+        return;
+      }
       case IrOpcode::kLoadDataViewElement: {
         MachineRepresentation const rep =
             MachineRepresentationFromArrayType(ExternalArrayTypeOf(node->op()));
@@ -3680,7 +3707,8 @@ class RepresentationSelector {
         // Assume the output is tagged.
         return SetOutput<T>(node, MachineRepresentation::kTagged);
 
-      case IrOpcode::kFindOrderedHashMapEntry: {
+      case IrOpcode::kFindOrderedHashMapEntry:
+      case IrOpcode::kFindOrderedHashSetEntry: {
         Type const key_type = TypeOf(node->InputAt(1));
         if (key_type.Is(Type::Signed32OrMinusZero())) {
           VisitBinop<T>(node, UseInfo::AnyTagged(), UseInfo::TruncatingWord32(),
@@ -3688,7 +3716,11 @@ class RepresentationSelector {
           if (lower<T>()) {
             NodeProperties::ChangeOp(
                 node,
-                lowering->simplified()->FindOrderedHashMapEntryForInt32Key());
+                node->opcode() == IrOpcode::kFindOrderedHashMapEntry
+                    ? lowering->simplified()
+                          ->FindOrderedHashMapEntryForInt32Key()
+                    : lowering->simplified()
+                          ->FindOrderedHashSetEntryForInt32Key());
           }
         } else {
           VisitBinop<T>(node, UseInfo::AnyTagged(),
@@ -373,6 +373,52 @@ bool operator==(ElementsTransition const& lhs, ElementsTransition const& rhs) {
          lhs.target().address() == rhs.target().address();
 }
 
+size_t hash_value(AtomicTypedElementOp op) { return static_cast<uint8_t>(op); }
+
+std::ostream& operator<<(std::ostream& os, AtomicTypedElementOp op) {
+  switch (op) {
+    case AtomicTypedElementOp::kLoad:
+      return os << "Load";
+    case AtomicTypedElementOp::kStore:
+      return os << "Store";
+    case AtomicTypedElementOp::kAdd:
+      return os << "Add";
+    case AtomicTypedElementOp::kSub:
+      return os << "Sub";
+    case AtomicTypedElementOp::kAnd:
+      return os << "And";
+    case AtomicTypedElementOp::kOr:
+      return os << "Or";
+    case AtomicTypedElementOp::kXor:
+      return os << "Xor";
+    case AtomicTypedElementOp::kExchange:
+      return os << "Exchange";
+    case AtomicTypedElementOp::kCompareExchange:
+      return os << "CompareExchange";
+  }
+  UNREACHABLE();
+}
+
+bool operator==(const AtomicTypedElementParameters& lhs,
+                const AtomicTypedElementParameters& rhs) {
+  return lhs.op() == rhs.op() && lhs.array_type() == rhs.array_type();
+}
+
+size_t hash_value(const AtomicTypedElementParameters& params) {
+  return base::hash_combine(params.op(), params.array_type());
+}
+
+std::ostream& operator<<(std::ostream& os,
+                         const AtomicTypedElementParameters& params) {
+  return os << params.op() << ", " << params.array_type();
+}
+
+const AtomicTypedElementParameters& AtomicTypedElementParametersOf(
+    const Operator* op) {
+  DCHECK_EQ(IrOpcode::kAtomicTypedElement, op->opcode());
+  return OpParameter<AtomicTypedElementParameters>(op);
+}
+
 size_t hash_value(ElementsTransition transition) {
   return base::hash_combine(static_cast<uint8_t>(transition.mode()),
                             transition.source().address(),
@@ -967,6 +1013,22 @@ struct SimplifiedOperatorGlobalCache final {
   FindOrderedHashMapEntryForInt32KeyOperator
       kFindOrderedHashMapEntryForInt32Key;
 
+  struct FindOrderedHashSetEntryOperator final : public Operator {
+    FindOrderedHashSetEntryOperator()
+        : Operator(IrOpcode::kFindOrderedHashSetEntry, Operator::kEliminatable,
+                   "FindOrderedHashSetEntry", 2, 1, 1, 1, 1, 0) {}
+  };
+  FindOrderedHashSetEntryOperator kFindOrderedHashSetEntry;
+
+  struct FindOrderedHashSetEntryForInt32KeyOperator final : public Operator {
+    FindOrderedHashSetEntryForInt32KeyOperator()
+        : Operator(IrOpcode::kFindOrderedHashSetEntryForInt32Key,
+                   Operator::kEliminatable,
+                   "FindOrderedHashSetEntryForInt32Key", 2, 1, 1, 1, 1, 0) {}
+  };
+  FindOrderedHashSetEntryForInt32KeyOperator
+      kFindOrderedHashSetEntryForInt32Key;
+
   struct ArgumentsFrameOperator final : public Operator {
     ArgumentsFrameOperator()
         : Operator(IrOpcode::kArgumentsFrame, Operator::kPure, "ArgumentsFrame",
@@ -1226,6 +1288,8 @@ CHECKED_OP_LIST(GET_FROM_CACHE)
 GET_FROM_CACHE(ArgumentsFrame)
 GET_FROM_CACHE(FindOrderedHashMapEntry)
 GET_FROM_CACHE(FindOrderedHashMapEntryForInt32Key)
+GET_FROM_CACHE(FindOrderedHashSetEntry)
+GET_FROM_CACHE(FindOrderedHashSetEntryForInt32Key)
 GET_FROM_CACHE(LoadFieldByIndex)
 #undef GET_FROM_CACHE
 
@@ -1621,6 +1685,38 @@ const Operator* SimplifiedOperatorBuilder::MaybeGrowFastElements(
       GrowFastElementsParameters(mode, feedback));            // parameter
 }
 
+const Operator* SimplifiedOperatorBuilder::AtomicTypedElement(
+    AtomicTypedElementOp op, ExternalArrayType array_type) {
+  int value_input_count = 5;
+  int value_output_count = 1;
+  switch (op) {
+    case AtomicTypedElementOp::kLoad:
+      value_input_count = 4;
+      break;
+    case AtomicTypedElementOp::kStore:
+      value_output_count = 0;
+      break;
+    case AtomicTypedElementOp::kCompareExchange:
+      value_input_count = 6;
+      break;
+    case AtomicTypedElementOp::kAdd:
+    case AtomicTypedElementOp::kSub:
+    case AtomicTypedElementOp::kAnd:
+    case AtomicTypedElementOp::kOr:
+    case AtomicTypedElementOp::kXor:
+    case AtomicTypedElementOp::kExchange:
+      break;
+  }
+  // Atomic operations must neither be eliminated nor reordered with other
+  // memory operations, so they are modelled as both reading and writing.
+  return zone()->New<Operator1<AtomicTypedElementParameters>>(  // --
+      IrOpcode::kAtomicTypedElement,                            // opcode
+      Operator::kNoDeopt | Operator::kNoThrow,                  // flags
+      "AtomicTypedElement",                                     // name
+      value_input_count, 1, 1, value_output_count, 1, 0,        // counts
+      AtomicTypedElementParameters(op, array_type));            // parameter
+}
+
 const Operator* SimplifiedOperatorBuilder::TransitionElementsKind(
     ElementsTransition transition) {
   return zone()->New<Operator1<ElementsTransition>>(  // --
@@ -497,6 +497,48 @@ std::ostream& operator<<(std::ostream&, const GrowFastElementsParameters&);
 const GrowFastElementsParameters& GrowFastElementsParametersOf(const Operator*)
     V8_WARN_UNUSED_RESULT;
 
+// The kind of an AtomicTypedElement operation, corresponding to the Atomics
+// builtin of the same name.
+enum class AtomicTypedElementOp : uint8_t {
+  kLoad,
+  kStore,
+  kAdd,
+  kSub,
+  kAnd,
+  kOr,
+  kXor,
+  kExchange,
+  kCompareExchange
+};
+
+size_t hash_value(AtomicTypedElementOp);
+
+V8_EXPORT_PRIVATE std::ostream& operator<<(std::ostream&, AtomicTypedElementOp);
+
+class AtomicTypedElementParameters {
+ public:
+  AtomicTypedElementParameters(AtomicTypedElementOp op,
+                               ExternalArrayType array_type)
+      : op_(op), array_type_(array_type) {}
+
+  AtomicTypedElementOp op() const { return op_; }
+  ExternalArrayType array_type() const { return array_type_; }
+
+ private:
+  AtomicTypedElementOp op_;
+  ExternalArrayType array_type_;
+};
+
+bool operator==(const AtomicTypedElementParameters&,
+                const AtomicTypedElementParameters&);
+
+size_t hash_value(const AtomicTypedElementParameters&);
+
+std::ostream& operator<<(std::ostream&, const AtomicTypedElementParameters&);
+
+const AtomicTypedElementParameters& AtomicTypedElementParametersOf(
+    const Operator*) V8_WARN_UNUSED_RESULT;
+
 // A descriptor for elements kind transitions.
 class ElementsTransition final {
  public:
@@ -820,6 +862,8 @@ class V8_EXPORT_PRIVATE SimplifiedOperatorBuilder final
 
   const Operator* FindOrderedHashMapEntry();
   const Operator* FindOrderedHashMapEntryForInt32Key();
+  const Operator* FindOrderedHashSetEntry();
+  const Operator* FindOrderedHashSetEntryForInt32Key();
 
   const Operator* SpeculativeToNumber(NumberOperationHint hint,
                                       const FeedbackSource& feedback);
@@ -1022,6 +1066,13 @@ class V8_EXPORT_PRIVATE SimplifiedOperatorBuilder final
   // store-data-view-element object, [base + index], value
   const Operator* StoreDataViewElement(ExternalArrayType const&);
 
+  // atomic-typed-element buffer, [base + external + index], values
+  // The number of values depends on {op}: none for loads, two (expected and
+  // replacement value) for compare-exchange and one otherwise. Produces the
+  // previous element value for all operations except stores.
+  const Operator* AtomicTypedElement(AtomicTypedElementOp op,
+                                     ExternalArrayType array_type);
+
   // Abort (for terminating execution on internal error).
   const Operator* RuntimeAbort(AbortReason reason);
 
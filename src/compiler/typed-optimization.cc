@@ -563,6 +563,7 @@ Reduction TypedOptimization::ReduceStringLength(Node* node) {
       }
       break;
     }
+    case IrOpcode::kNewConsString:
     case IrOpcode::kStringConcat: {
       // The first value input to the {input} is the resulting length.
       return Replace(input->InputAt(0));
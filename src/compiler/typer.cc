@@ -2184,6 +2184,20 @@ Type Typer::Visitor::TypeLoadTypedElement(Node* node) {
   UNREACHABLE();
 }
 
+Type Typer::Visitor::TypeAtomicTypedElement(Node* node) {
+  AtomicTypedElementParameters const& params =
+      AtomicTypedElementParametersOf(node->op());
+  DCHECK_NE(AtomicTypedElementOp::kStore, params.op());
+  switch (params.array_type()) {
+#define TYPED_ARRAY_CASE(ElemType, type, TYPE, ctype) \
+  case kExternal##ElemType##Array:                    \
+    return typer_->cache_->k##ElemType;
+    TYPED_ARRAYS(TYPED_ARRAY_CASE)
+#undef TYPED_ARRAY_CASE
+  }
+  UNREACHABLE();
+}
+
 Type Typer::Visitor::TypeLoadDataViewElement(Node* node) {
   switch (ExternalArrayTypeOf(node->op())) {
 #define TYPED_ARRAY_CASE(ElemType, type, TYPE, ctype) \
@@ -2343,6 +2357,14 @@ Type Typer::Visitor::TypeFindOrderedHashMapEntryForInt32Key(Node* node) {
   return Type::Range(-1.0, FixedArray::kMaxLength, zone());
 }
 
+Type Typer::Visitor::TypeFindOrderedHashSetEntry(Node* node) {
+  return Type::Range(-1.0, FixedArray::kMaxLength, zone());
+}
+
+Type Typer::Visitor::TypeFindOrderedHashSetEntryForInt32Key(Node* node) {
+  return Type::Range(-1.0, FixedArray::kMaxLength, zone());
+}
+
 Type Typer::Visitor::TypeRuntimeAbort(Node* node) { UNREACHABLE(); }
 
 Type Typer::Visitor::TypeAssertType(Node* node) { UNREACHABLE(); }
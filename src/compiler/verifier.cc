@@ -1217,10 +1217,12 @@ void Verifier::Visitor::Check(Node* node, const AllNodes& all) {
       CheckTypeIs(node, Type::Boolean());
       break;
     case IrOpcode::kFindOrderedHashMapEntry:
+    case IrOpcode::kFindOrderedHashSetEntry:
       CheckValueInputIs(node, 0, Type::Any());
       CheckTypeIs(node, Type::SignedSmall());
       break;
     case IrOpcode::kFindOrderedHashMapEntryForInt32Key:
+    case IrOpcode::kFindOrderedHashSetEntryForInt32Key:
       CheckValueInputIs(node, 0, Type::Any());
       CheckValueInputIs(node, 1, Type::Signed32());
       CheckTypeIs(node, Type::SignedSmall());
@@ -1555,6 +1557,12 @@ void Verifier::Visitor::Check(Node* node, const AllNodes& all) {
       break;
     case IrOpcode::kLoadDataViewElement:
       break;
+    case IrOpcode::kAtomicTypedElement:
+      if (AtomicTypedElementParametersOf(node->op()).op() ==
+          AtomicTypedElementOp::kStore) {
+        CheckNotTyped(node);
+      }
+      break;
     case IrOpcode::kStoreField:
     case IrOpcode::kStoreMessage:
       // (Object, fieldtype) -> _|_
@@ -2898,7 +2898,10 @@ Node* WasmGraphBuilder::BuildIndirectCall(uint32_t table_index,
   Node* loaded_sig = SetEffect(
       graph()->NewNode(machine->Load(MachineType::Int32()), ift_sig_ids,
                        int32_scaled_key, effect(), control()));
-  Node* sig_match = graph()->NewNode(machine->WordEqual(), loaded_sig,
+  // Compare as 32-bit values, so that the instruction selector can fold the
+  // signature load into the comparison (a single cmp with a memory operand on
+  // x64 and ia32).
+  Node* sig_match = graph()->NewNode(machine->Word32Equal(), loaded_sig,
                                      Int32Constant(expected_sig_id));
 
   TrapIfFalse(wasm::kTrapFuncSigMismatch, sig_match, position);
@@ -3500,6 +3503,7 @@ Node* WasmGraphBuilder::BoundsCheckMem(uint8_t access_size, Node* index,
                                        wasm::WasmCodePosition position,
                                        EnforceBoundsCheck enforce_check) {
   DCHECK_LE(1, access_size);
+  Node* const uint32_index = index;
   index = Uint32ToUintptr(index);
   if (!FLAG_wasm_bounds_checks) return index;
 
@@ -3525,6 +3529,11 @@ Node* WasmGraphBuilder::BoundsCheckMem(uint8_t access_size, Node* index,
   //    - checking that {index < effective_size}.
 
   auto m = mcgraph()->machine();
+  if (FLAG_wasm_eliminate_redundant_bounds_checks &&
+      IsRedundantBoundsCheck(uint32_index, end_offset)) {
+    return MaskMemIndex(index);
+  }
+
   Node* mem_size = instance_cache_->mem_size;
   if (end_offset >= env_->min_memory_size) {
     // The end offset is larger than the smallest memory.
@@ -3552,14 +3561,45 @@ Node* WasmGraphBuilder::BoundsCheckMem(uint8_t access_size, Node* index,
   // Introduce the actual bounds check.
   Node* cond = graph()->NewNode(m->UintLessThan(), index, effective_size);
   TrapIfFalse(wasm::kTrapMemOutOfBounds, cond, position);
+  RecordBoundsCheck(uint32_index, end_offset);
 
-  if (untrusted_code_mitigations_) {
-    // In the fallthrough case, condition the index with the memory mask.
-    Node* mem_mask = instance_cache_->mem_mask;
-    DCHECK_NOT_NULL(mem_mask);
-    index = graph()->NewNode(m->WordAnd(), index, mem_mask);
+  return MaskMemIndex(index);
+}
+
+bool WasmGraphBuilder::IsRedundantBoundsCheck(Node* index,
+                                              uint64_t end_offset) {
+  if (control() != checked_bounds_control_) {
+    checked_bounds_.clear();
+    return false;
   }
-  return index;
+  for (const CheckedBounds& checked : checked_bounds_) {
+    if (checked.index == index && end_offset <= checked.end_offset) {
+      return true;
+    }
+  }
+  return false;
+}
+
+void WasmGraphBuilder::RecordBoundsCheck(Node* index, uint64_t end_offset) {
+  // The check just emitted is the last control node, so everything reached
+  // while it is still the current control is dominated by it.
+  if (control() != checked_bounds_control_) checked_bounds_.clear();
+  checked_bounds_control_ = control();
+  for (CheckedBounds& checked : checked_bounds_) {
+    if (checked.index == index) {
+      checked.end_offset = std::max(checked.end_offset, end_offset);
+      return;
+    }
+  }
+  checked_bounds_.push_back({index, end_offset});
+}
+
+Node* WasmGraphBuilder::MaskMemIndex(Node* index) {
+  if (!untrusted_code_mitigations_) return index;
+  // In the fallthrough case, condition the index with the memory mask.
+  Node* mem_mask = instance_cache_->mem_mask;
+  DCHECK_NOT_NULL(mem_mask);
+  return graph()->NewNode(mcgraph()->machine()->WordAnd(), index, mem_mask);
 }
 
 Node* WasmGraphBuilder::BoundsCheckRange(Node* start, Node** size, Node* max,
@@ -5096,8 +5136,122 @@ Node* WasmGraphBuilder::StoreArgsInStackSlot(
   return stack_slot;
 }
 
+namespace {
+
+// memory.copy and memory.fill with a constant size of up to this many bytes
+// are expanded inline instead of calling out to C.
+constexpr uint32_t kMaxInlineBulkMemorySize = 32;
+
+// Returns the widest machine type for the next chunk of an inline bulk memory
+// operation with {remaining} bytes left.
+MachineType InlineBulkMemoryChunkType(uint32_t remaining) {
+  if (kSystemPointerSize == 8 && remaining >= 8) return MachineType::Uint64();
+  if (remaining >= 4) return MachineType::Uint32();
+  if (remaining >= 2) return MachineType::Uint16();
+  return MachineType::Uint8();
+}
+
+bool IsInlineBulkMemorySize(Node* size, uint32_t* size_val) {
+  Uint32Matcher match(size);
+  if (!match.HasValue()) return false;
+  *size_val = match.Value();
+  return *size_val > 0 && *size_val <= kMaxInlineBulkMemorySize;
+}
+
+}  // namespace
+
+Node* WasmGraphBuilder::BuildInlineMemLoad(MachineType type, Node* index,
+                                           uint32_t offset) {
+  auto m = mcgraph()->machine();
+  const Operator* op = type.representation() == MachineRepresentation::kWord8 ||
+                               m->UnalignedLoadSupported(type.representation())
+                           ? m->Load(type)
+                           : m->UnalignedLoad(type);
+  return SetEffect(graph()->NewNode(op, MemBuffer(offset), index, effect(),
+                                    control()));
+}
+
+Node* WasmGraphBuilder::BuildInlineMemStore(MachineRepresentation rep,
+                                            Node* index, uint32_t offset,
+                                            Node* value) {
+  auto m = mcgraph()->machine();
+  const Operator* op =
+      rep == MachineRepresentation::kWord8 || m->UnalignedStoreSupported(rep)
+          ? m->Store(StoreRepresentation(rep, kNoWriteBarrier))
+          : m->UnalignedStore(rep);
+  return SetEffect(graph()->NewNode(op, MemBuffer(offset), index, value,
+                                    effect(), control()));
+}
+
+Node* WasmGraphBuilder::BuildInlineMemoryCopy(Node* dst, Node* src,
+                                              uint32_t size,
+                                              wasm::WasmCodePosition position) {
+  DCHECK_LE(size, kMaxInlineBulkMemorySize);
+  // Both ranges are checked before anything is written, so an out-of-bounds
+  // copy traps without modifying memory.
+  Node* dst_index = BoundsCheckMem(static_cast<uint8_t>(size), dst, 0,
+                                   position, kNeedsBoundsCheck);
+  Node* src_index = BoundsCheckMem(static_cast<uint8_t>(size), src, 0,
+                                   position, kNeedsBoundsCheck);
+  // Load everything before storing anything, which gives memmove semantics
+  // for overlapping ranges.
+  MachineType chunk_types[kMaxInlineBulkMemorySize];
+  Node* chunks[kMaxInlineBulkMemorySize];
+  int num_chunks = 0;
+  for (uint32_t offset = 0; offset < size;) {
+    MachineType type = InlineBulkMemoryChunkType(size - offset);
+    chunk_types[num_chunks] = type;
+    chunks[num_chunks++] = BuildInlineMemLoad(type, src_index, offset);
+    offset += ElementSizeInBytes(type.representation());
+  }
+  Node* store = nullptr;
+  uint32_t offset = 0;
+  for (int i = 0; i < num_chunks; ++i) {
+    MachineRepresentation rep = chunk_types[i].representation();
+    store = BuildInlineMemStore(rep, dst_index, offset, chunks[i]);
+    offset += ElementSizeInBytes(rep);
+  }
+  return store;
+}
+
+Node* WasmGraphBuilder::BuildInlineMemoryFill(Node* dst, Node* value,
+                                              uint32_t size,
+                                              wasm::WasmCodePosition position) {
+  DCHECK_LE(size, kMaxInlineBulkMemorySize);
+  Node* dst_index = BoundsCheckMem(static_cast<uint8_t>(size), dst, 0,
+                                   position, kNeedsBoundsCheck);
+  // Replicate the low byte of {value} into all bytes of a word.
+  auto m = mcgraph()->machine();
+  Node* byte = graph()->NewNode(m->Word32And(), value, Int32Constant(0xFF));
+  Node* pattern32 =
+      graph()->NewNode(m->Int32Mul(), byte, Int32Constant(0x01010101));
+  Node* pattern64 = nullptr;
+  Node* store = nullptr;
+  for (uint32_t offset = 0; offset < size;) {
+    MachineRepresentation rep =
+        InlineBulkMemoryChunkType(size - offset).representation();
+    Node* pattern = pattern32;
+    if (rep == MachineRepresentation::kWord64) {
+      if (pattern64 == nullptr) {
+        pattern64 = graph()->NewNode(
+            m->Int64Mul(), graph()->NewNode(m->ChangeUint32ToUint64(), byte),
+            Int64Constant(0x0101010101010101));
+      }
+      pattern = pattern64;
+    }
+    store = BuildInlineMemStore(rep, dst_index, offset, pattern);
+    offset += ElementSizeInBytes(rep);
+  }
+  return store;
+}
+
 Node* WasmGraphBuilder::MemoryCopy(Node* dst, Node* src, Node* size,
                                    wasm::WasmCodePosition position) {
+  uint32_t size_val;
+  if (IsInlineBulkMemorySize(size, &size_val)) {
+    return BuildInlineMemoryCopy(dst, src, size_val, position);
+  }
+
   Node* function = graph()->NewNode(mcgraph()->common()->ExternalConstant(
       ExternalReference::wasm_memory_copy()));
 
@@ -5115,6 +5269,11 @@ Node* WasmGraphBuilder::MemoryCopy(Node* dst, Node* src, Node* size,
 
 Node* WasmGraphBuilder::MemoryFill(Node* dst, Node* value, Node* size,
                                    wasm::WasmCodePosition position) {
+  uint32_t size_val;
+  if (IsInlineBulkMemorySize(size, &size_val)) {
+    return BuildInlineMemoryFill(dst, value, size_val, position);
+  }
+
   Node* function = graph()->NewNode(mcgraph()->common()->ExternalConstant(
       ExternalReference::wasm_memory_fill()));
 
@@ -5397,6 +5556,19 @@ void AssertFalse(GraphAssembler* gasm, Node* condition) {
 #endif
 }
 
+Node* WasmGraphBuilder::BuildIsRttSubtype(Node* map, Node* rtt) {
+  // Objects are most often checked against their exact rtt, so handle that
+  // inline and only walk the supertype chain in the builtin otherwise.
+  auto done = gasm_->MakeLabel(MachineRepresentation::kWord32);
+  gasm_->GotoIf(gasm_->WordEqual(map, rtt), &done, gasm_->Int32Constant(1));
+  Node* subtype_check = BuildChangeSmiToInt32(CALL_BUILTIN(
+      WasmIsRttSubtype, map, rtt,
+      LOAD_INSTANCE_FIELD(NativeContext, MachineType::TaggedPointer())));
+  gasm_->Goto(&done, subtype_check);
+  gasm_->Bind(&done);
+  return done.PhiAt(0);
+}
+
 Node* WasmGraphBuilder::RefTest(Node* object, Node* rtt,
                                 CheckForNull null_check, CheckForI31 i31_check,
                                 RttIsI31 rtt_is_i31) {
@@ -5419,10 +5591,7 @@ Node* WasmGraphBuilder::RefTest(Node* object, Node* rtt,
 
   Node* map = gasm_->Load(MachineType::TaggedPointer(), object,
                           HeapObject::kMapOffset - kHeapObjectTag);
-  // TODO(7748): Add a fast path for map == rtt.
-  Node* subtype_check = BuildChangeSmiToInt32(CALL_BUILTIN(
-      WasmIsRttSubtype, map, rtt,
-      LOAD_INSTANCE_FIELD(NativeContext, MachineType::TaggedPointer())));
+  Node* subtype_check = BuildIsRttSubtype(map, rtt);
 
   if (need_done_label) {
     gasm_->Goto(&done, subtype_check);
@@ -5452,10 +5621,7 @@ Node* WasmGraphBuilder::RefCast(Node* object, Node* rtt,
   }
   Node* map = gasm_->Load(MachineType::TaggedPointer(), object,
                           HeapObject::kMapOffset - kHeapObjectTag);
-  // TODO(7748): Add a fast path for map == rtt.
-  Node* check_result = BuildChangeSmiToInt32(CALL_BUILTIN(
-      WasmIsRttSubtype, map, rtt,
-      LOAD_INSTANCE_FIELD(NativeContext, MachineType::TaggedPointer())));
+  Node* check_result = BuildIsRttSubtype(map, rtt);
   TrapIfFalse(wasm::kTrapIllegalCast, check_result, position);
   return object;
 }
@@ -5500,10 +5666,7 @@ Node* WasmGraphBuilder::BrOnCast(Node* object, Node* rtt,
   // At this point, {object} is neither null nor an i31ref/Smi.
   Node* map = gasm_->Load(MachineType::TaggedPointer(), object,
                           HeapObject::kMapOffset - kHeapObjectTag);
-  // TODO(7748): Add a fast path for map == rtt.
-  Node* subtype_check = BuildChangeSmiToInt32(CALL_BUILTIN(
-      WasmIsRttSubtype, map, rtt,
-      LOAD_INSTANCE_FIELD(NativeContext, MachineType::TaggedPointer())));
+  Node* subtype_check = BuildIsRttSubtype(map, rtt);
   Node* cast_branch =
       graph()->NewNode(mcgraph()->common()->Branch(BranchHint::kFalse),
                        subtype_check, control());
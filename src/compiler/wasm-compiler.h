@@ -10,6 +10,7 @@
 
 // Clients of this interface shouldn't depend on lots of compiler internals.
 // Do not include anything from src/compiler here!
+#include "src/base/small-vector.h"
 #include "src/runtime/runtime.h"
 #include "src/wasm/function-body-decoder.h"
 #include "src/wasm/function-compiler.h"
@@ -449,6 +450,11 @@ class WasmGraphBuilder {
   // BoundsCheckMem receives a uint32 {index} node and returns a ptrsize index.
   Node* BoundsCheckMem(uint8_t access_size, Node* index, uint32_t offset,
                        wasm::WasmCodePosition, EnforceBoundsCheck);
+  // Returns true if an access with {end_offset} at the uint32 {index} was
+  // already bounds checked on the current control path.
+  bool IsRedundantBoundsCheck(Node* index, uint64_t end_offset);
+  void RecordBoundsCheck(Node* index, uint64_t end_offset);
+  Node* MaskMemIndex(Node* index);
   // Check that the range [start, start + size) is in the range [0, max).
   // Also updates *size with the valid range. Returns true if the range is
   // partially out-of-bounds, traps if it is completely out-of-bounds.
@@ -620,6 +626,19 @@ class WasmGraphBuilder {
   Node* StoreArgsInStackSlot(
       std::initializer_list<std::pair<MachineRepresentation, Node*>> args);
 
+  // Returns 1 if {map} is {rtt} or one of its subtypes, 0 otherwise.
+  Node* BuildIsRttSubtype(Node* map, Node* rtt);
+
+  // Helpers for memory.copy and memory.fill with small constant sizes, which
+  // are expanded into word-sized loads and stores.
+  Node* BuildInlineMemLoad(MachineType type, Node* index, uint32_t offset);
+  Node* BuildInlineMemStore(MachineRepresentation rep, Node* index,
+                            uint32_t offset, Node* value);
+  Node* BuildInlineMemoryCopy(Node* dst, Node* src, uint32_t size,
+                              wasm::WasmCodePosition position);
+  Node* BuildInlineMemoryFill(Node* dst, Node* value, uint32_t size,
+                              wasm::WasmCodePosition position);
+
   std::unique_ptr<WasmGraphAssembler> gasm_;
   Zone* const zone_;
   MachineGraph* const mcgraph_;
@@ -634,6 +653,17 @@ class WasmGraphBuilder {
   SetOncePointer<Node> isolate_root_node_;
   SetOncePointer<const Operator> stack_check_call_operator_;
 
+  // Bounds checks performed since {checked_bounds_control_} became the current
+  // control. Any access with the same (uint32) index and an end offset that is
+  // not larger is statically known to be in bounds, since memory never
+  // shrinks. The list is dropped as soon as control changes.
+  struct CheckedBounds {
+    Node* index;
+    uint64_t end_offset;
+  };
+  base::SmallVector<CheckedBounds, 4> checked_bounds_;
+  Node* checked_bounds_control_ = nullptr;
+
   bool has_simd_ = false;
   bool needs_stack_check_ = false;
   const bool untrusted_code_mitigations_ = true;
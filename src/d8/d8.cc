@@ -8,6 +8,7 @@
 #include <sys/stat.h>
 
 #include <algorithm>
+#include <cmath>
 #include <fstream>
 #include <iomanip>
 #include <iterator>
@@ -616,6 +617,8 @@ bool Shell::ExecuteString(Isolate* isolate, Local<String> source,
     MaybeLocal<Script> maybe_script;
     Local<Context> context(isolate->GetCurrentContext());
     ScriptOrigin origin(name);
+    base::ElapsedTimer compile_timer;
+    compile_timer.Start();
 
     if (options.compile_options == ScriptCompiler::kConsumeCodeCache) {
       ScriptCompiler::CachedData* cached_code =
@@ -648,6 +651,7 @@ bool Shell::ExecuteString(Isolate* isolate, Local<String> source,
       maybe_script = ScriptCompiler::Compile(context, &script_source,
                                              options.compile_options);
     }
+    data->compile_time_ += compile_timer.Elapsed();
 
     Local<Script> script;
     if (!maybe_script.ToLocal(&script)) {
@@ -3282,6 +3286,15 @@ bool Shell::SetOptions(int argc, char* argv[]) {
       argv[i] = nullptr;
     } else if (strcmp(argv[i], "--isolate") == 0) {
       options.num_isolates++;
+    } else if (strcmp(argv[i], "--bench") == 0) {
+      options.bench = true;
+      argv[i] = nullptr;
+    } else if (strncmp(argv[i], "--bench-isolates=", 17) == 0) {
+      options.bench_isolates = std::max(1, atoi(argv[i] + 17));
+      argv[i] = nullptr;
+    } else if (strncmp(argv[i], "--bench-iterations=", 19) == 0) {
+      options.bench_iterations = std::max(1, atoi(argv[i] + 19));
+      argv[i] = nullptr;
     } else if (strcmp(argv[i], "--throws") == 0) {
       options.expected_to_throw = true;
       argv[i] = nullptr;
@@ -3336,6 +3349,20 @@ bool Shell::SetOptions(int argc, char* argv[]) {
     } else if (strncmp(argv[i], "--trace-config=", 15) == 0) {
       options.trace_config = argv[i] + 15;
       argv[i] = nullptr;
+    } else if (strncmp(argv[i], "--trace-format=", 15) == 0) {
+      const char* format = argv[i] + 15;
+      if (strcmp(format, "proto") == 0) {
+#ifdef V8_USE_PERFETTO
+        options.trace_proto = true;
+#else
+        printf("--trace-format=proto requires a build with Perfetto.\n");
+        return false;
+#endif  // V8_USE_PERFETTO
+      } else if (strcmp(format, "json") != 0) {
+        printf("Unknown trace format '%s'.\n", format);
+        return false;
+      }
+      argv[i] = nullptr;
     } else if (strcmp(argv[i], "--enable-inspector") == 0) {
       options.enable_inspector = true;
       argv[i] = nullptr;
@@ -3390,7 +3417,10 @@ bool Shell::SetOptions(int argc, char* argv[]) {
       "  d8 [options] [-e <string>] [--shell] [[--module] <file>...]\n\n"
       "  -e        execute a string in V8\n"
       "  --shell   run an interactive JavaScript shell\n"
-      "  --module  execute a file as a JavaScript module\n\n";
+      "  --module  execute a file as a JavaScript module\n"
+      "  --bench   run the scripts --bench-iterations times (default 100) on\n"
+      "            each of --bench-isolates isolates (default 1), on one\n"
+      "            thread per isolate, and report throughput and latencies\n\n";
   using HelpOptions = i::FlagList::HelpOptions;
   i::FlagList::SetFlagsFromCommandLine(&argc, argv, true,
                                        HelpOptions(HelpOptions::kExit, usage));
@@ -3491,6 +3521,140 @@ int Shell::RunMain(Isolate* isolate, bool last_run) {
   return success == Shell::options.expected_to_throw ? 1 : 0;
 }
 
+namespace {
+
+struct BenchmarkStats {
+  std::vector<double> latencies_ms;
+  double total_ms = 0;
+  double gc_ms = 0;
+  double compile_ms = 0;
+  int gc_count = 0;
+  bool success = true;
+  base::TimeTicks gc_start;
+};
+
+void BenchmarkGCPrologue(Isolate* isolate, GCType type, GCCallbackFlags flags,
+                         void* data) {
+  static_cast<BenchmarkStats*>(data)->gc_start = base::TimeTicks::Now();
+}
+
+void BenchmarkGCEpilogue(Isolate* isolate, GCType type, GCCallbackFlags flags,
+                         void* data) {
+  BenchmarkStats* stats = static_cast<BenchmarkStats*>(data);
+  stats->gc_ms += (base::TimeTicks::Now() - stats->gc_start).InMillisecondsF();
+  stats->gc_count++;
+}
+
+// Runs the scripts of a source group --bench-iterations times in a fresh
+// isolate. All iterations share one context.
+class BenchmarkThread : public base::Thread {
+ public:
+  BenchmarkThread(SourceGroup* group, BenchmarkStats* stats)
+      : base::Thread(GetThreadOptions("BenchmarkThread")),
+        group_(group),
+        stats_(stats) {}
+
+  void Run() override {
+    Isolate::CreateParams create_params;
+    create_params.array_buffer_allocator = Shell::array_buffer_allocator;
+    Isolate* isolate = Isolate::New(create_params);
+    Shell::SetWaitUntilDone(isolate, false);
+    D8Console console(isolate);
+    Shell::Initialize(isolate, &console, false);
+    {
+      Isolate::Scope iscope(isolate);
+      PerIsolateData data(isolate);
+      isolate->AddGCPrologueCallback(BenchmarkGCPrologue, stats_);
+      isolate->AddGCEpilogueCallback(BenchmarkGCEpilogue, stats_);
+      HandleScope scope(isolate);
+      Local<Context> context = Shell::CreateEvaluationContext(isolate);
+      {
+        Context::Scope cscope(context);
+        PerIsolateData::RealmScope realm_scope(&data);
+        base::ElapsedTimer total_timer;
+        total_timer.Start();
+        for (int i = 0; i < Shell::options.bench_iterations; ++i) {
+          base::ElapsedTimer timer;
+          timer.Start();
+          if (!group_->Execute(isolate) ||
+              !Shell::CompleteMessageLoop(isolate)) {
+            stats_->success = false;
+            break;
+          }
+          stats_->latencies_ms.push_back(timer.Elapsed().InMillisecondsF());
+        }
+        stats_->total_ms = total_timer.Elapsed().InMillisecondsF();
+        stats_->compile_ms = data.compile_time().InMillisecondsF();
+      }
+      DisposeModuleEmbedderData(context);
+      isolate->RemoveGCPrologueCallback(BenchmarkGCPrologue, stats_);
+      isolate->RemoveGCEpilogueCallback(BenchmarkGCEpilogue, stats_);
+    }
+    isolate->Dispose();
+  }
+
+ private:
+  SourceGroup* group_;
+  BenchmarkStats* stats_;
+};
+
+// Returns the given percentile of the sorted latencies.
+double Percentile(const std::vector<double>& sorted, double percentile) {
+  if (sorted.empty()) return 0;
+  size_t index = static_cast<size_t>(
+      std::ceil(percentile / 100 * sorted.size()));
+  return sorted[std::max<size_t>(index, 1) - 1];
+}
+
+void PrintBenchmarkLatencies(std::vector<double> latencies_ms) {
+  std::sort(latencies_ms.begin(), latencies_ms.end());
+  printf("latency p50 %.3f ms, p90 %.3f ms, p99 %.3f ms, max %.3f ms\n",
+         Percentile(latencies_ms, 50), Percentile(latencies_ms, 90),
+         Percentile(latencies_ms, 99), Percentile(latencies_ms, 100));
+}
+
+}  // namespace
+
+int Shell::RunBenchmark() {
+  const int num_isolates = options.bench_isolates;
+  std::vector<BenchmarkStats> stats(num_isolates);
+  std::vector<std::unique_ptr<BenchmarkThread>> threads;
+  base::ElapsedTimer wall_timer;
+  wall_timer.Start();
+  for (int i = 0; i < num_isolates; ++i) {
+    threads.emplace_back(
+        new BenchmarkThread(&options.isolate_sources[0], &stats[i]));
+    CHECK(threads.back()->Start());
+  }
+  for (auto& thread : threads) thread->Join();
+  double wall_ms = wall_timer.Elapsed().InMillisecondsF();
+
+  bool success = true;
+  std::vector<double> all_latencies_ms;
+  size_t total_iterations = 0;
+  for (int i = 0; i < num_isolates; ++i) {
+    const BenchmarkStats& s = stats[i];
+    success &= s.success;
+    total_iterations += s.latencies_ms.size();
+    all_latencies_ms.insert(all_latencies_ms.end(), s.latencies_ms.begin(),
+                            s.latencies_ms.end());
+    printf("isolate %d: %zu iterations in %.3f ms, %.2f ops/s, "
+           "gc %.3f ms (%d gcs), compile %.3f ms, ",
+           i, s.latencies_ms.size(), s.total_ms,
+           s.total_ms > 0 ? s.latencies_ms.size() * 1000 / s.total_ms : 0,
+           s.gc_ms, s.gc_count, s.compile_ms);
+    PrintBenchmarkLatencies(s.latencies_ms);
+  }
+  printf("total: %d isolates, %zu iterations in %.3f ms, %.2f ops/s, ",
+         num_isolates, total_iterations, wall_ms,
+         wall_ms > 0 ? total_iterations * 1000 / wall_ms : 0);
+  PrintBenchmarkLatencies(all_latencies_ms);
+
+  WaitForRunningWorkers();
+  // In order to finish successfully, success must be != expected_to_throw.
+  return success == Shell::options.expected_to_throw ? 1 : 0;
+}
+
 void Shell::CollectGarbage(Isolate* isolate) {
   if (options.send_idle_notification) {
     const double kLongIdlePauseInSeconds = 1.0;
@@ -3948,9 +4112,13 @@ int Shell::Main(int argc, char* argv[]) {
   std::ofstream trace_file;
   if (options.trace_enabled && !i::FLAG_verify_predictable) {
     tracing = std::make_unique<platform::tracing::TracingController>();
-    const char* trace_path =
-        options.trace_path ? options.trace_path : "v8_trace.json";
-    trace_file.open(trace_path);
+    const char* trace_path = options.trace_path;
+    if (trace_path == nullptr) {
+      trace_path = options.trace_proto ? "v8_trace.pftrace" : "v8_trace.json";
+    }
+    trace_file.open(trace_path, options.trace_proto
+                                    ? std::ios_base::out | std::ios_base::binary
+                                    : std::ios_base::out);
     if (!trace_file.good()) {
       printf("Cannot open trace file '%s' for writing: %s.\n", trace_path,
              strerror(errno));
@@ -3964,7 +4132,11 @@ int Shell::Main(int argc, char* argv[]) {
     init_args.backends = perfetto::BackendType::kInProcessBackend;
     perfetto::Tracing::Initialize(init_args);
 
-    tracing->InitializeForPerfetto(&trace_file);
+    tracing->InitializeForPerfetto(
+        &trace_file,
+        options.trace_proto
+            ? platform::tracing::TracingController::OutputFormat::kProto
+            : platform::tracing::TracingController::OutputFormat::kJSON);
 #else
     platform::tracing::TraceBuffer* trace_buffer =
         platform::tracing::TraceBuffer::CreateTraceBufferRingBuffer(
@@ -4147,6 +4319,8 @@ int Shell::Main(int argc, char* argv[]) {
         // Second run to consume the cache in current isolate
         result = RunMain(isolate, true);
         options.compile_options = v8::ScriptCompiler::kNoCompileOptions;
+      } else if (options.bench) {
+        result = RunBenchmark();
       } else {
         bool last_run = true;
         result = RunMain(isolate, last_run);
@@ -262,6 +262,9 @@ class PerIsolateData {
   int HandleUnhandledPromiseRejections();
   size_t GetUnhandledPromiseCount();
 
+  // Time spent compiling top-level scripts in Shell::ExecuteString.
+  base::TimeDelta compile_time() const { return compile_time_; }
+
  private:
   friend class Shell;
   friend class RealmScope;
@@ -276,6 +279,7 @@ class PerIsolateData {
   std::vector<std::tuple<Global<Promise>, Global<Message>, Global<Value>>>
       unhandled_promises_;
   AsyncHooks* async_hooks_wrapper_;
+  base::TimeDelta compile_time_;
 
   int RealmIndexOrThrow(const v8::FunctionCallbackInfo<v8::Value>& args,
                         int arg_offset);
@@ -321,6 +325,7 @@ class ShellOptions {
   bool trace_enabled = false;
   const char* trace_path = nullptr;
   const char* trace_config = nullptr;
+  bool trace_proto = false;
   const char* lcov_file = nullptr;
   bool disable_in_process_stack_traces = false;
   int read_from_tcp_port = -1;
@@ -333,6 +338,11 @@ class ShellOptions {
   bool cpu_profiler = false;
   bool cpu_profiler_print = false;
   bool fuzzy_module_file_extensions = true;
+  // Runs the scripts in a loop on separate isolates and reports throughput,
+  // GC and compile time, and latency percentiles.
+  bool bench = false;
+  int bench_isolates = 1;
+  int bench_iterations = 100;
 };
 
 class Shell : public i::AllStatic {
@@ -358,6 +368,7 @@ class Shell : public i::AllStatic {
   static Local<String> ReadFile(Isolate* isolate, const char* name);
   static Local<Context> CreateEvaluationContext(Isolate* isolate);
   static int RunMain(Isolate* isolate, bool last_run);
+  static int RunBenchmark();
   static int Main(int argc, char* argv[]);
   static void Exit(int exit_code);
   static void OnExit(Isolate* isolate);
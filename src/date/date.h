@@ -75,15 +75,16 @@ class V8_EXPORT_PRIVATE DateCache {
   }
 
   // ECMA 262 - ES#sec-local-time-zone-adjustment
-  int LocalOffsetInMs(int64_t time, bool is_utc) {
-    return GetLocalOffsetFromOS(time, is_utc);
-  }
+  // Offsets of UTC times are served from the segment cache below, which only
+  // calls into the OS or ICU on a miss. Local times are less common and always
+  // ask the OS.
+  int LocalOffsetInMs(int64_t time_ms, bool is_utc);
 
   const char* LocalTimezone(int64_t time_ms) {
     if (time_ms < 0 || time_ms > kMaxEpochTimeInMs) {
       time_ms = EquivalentTime(time_ms);
     }
-    bool is_dst = DaylightSavingsOffsetInMs(time_ms) != 0;
+    bool is_dst = GetDaylightSavingsOffsetFromOS(time_ms / 1000) != 0;
     const char** name = is_dst ? &dst_tz_name_ : &tz_name_;
     if (*name == nullptr) {
       *name = tz_cache_->LocalTimezone(static_cast<double>(time_ms));
@@ -174,51 +175,50 @@ class V8_EXPORT_PRIVATE DateCache {
   // September 30.
   static const int kDefaultDSTDeltaInSec = 19 * kSecPerDay;
 
-  // Size of the Daylight Savings Time cache.
-  static const int kDSTSize = 32;
+  static const int64_t kDefaultTimeZoneOffsetDeltaInMs =
+      int64_t{kDefaultDSTDeltaInSec} * 1000;
+
+  // Size of the local timezone offset cache.
+  static const int kCacheSize = 64;
 
-  // Daylight Savings Time segment stores a segment of time where
-  // daylight savings offset does not change.
-  struct DST {
-    int start_sec;
-    int end_sec;
+  // A segment of UTC time in which the local timezone offset, i.e. the
+  // standard offset plus the daylight savings offset, does not change.
+  struct CacheItem {
+    int64_t start_ms;
+    int64_t end_ms;
     int offset_ms;
     int last_used;
   };
 
-  // Computes the daylight savings offset for the given time.
-  // ECMA 262 - 15.9.1.8
-  int DaylightSavingsOffsetInMs(int64_t time_ms);
-
-  // Sets the before_ and the after_ segments from the DST cache such that
+  // Sets the before_ and the after_ segments from the cache such that
   // the before_ segment starts earlier than the given time and
   // the after_ segment start later than the given time.
   // Both segments might be invalid.
   // The last_used counters of the before_ and after_ are updated.
-  void ProbeDST(int time_sec);
+  void ProbeCache(int64_t time_ms);
 
-  // Finds the least recently used segment from the DST cache that is not
+  // Finds the least recently used segment from the cache that is not
   // equal to the given 'skip' segment.
-  DST* LeastRecentlyUsedDST(DST* skip);
+  CacheItem* LeastRecentlyUsedCacheItem(CacheItem* skip);
 
   // Extends the after_ segment with the given point or resets it
-  // if it starts later than the given time + kDefaultDSTDeltaInSec.
-  inline void ExtendTheAfterSegment(int time_sec, int offset_ms);
+  // if it starts later than the given time + kDefaultTimeZoneOffsetDeltaInMs.
+  inline void ExtendTheAfterSegment(int64_t time_ms, int offset_ms);
 
   // Makes the given segment invalid.
-  inline void ClearSegment(DST* segment);
+  inline void ClearSegment(CacheItem* segment);
 
-  bool InvalidSegment(DST* segment) {
-    return segment->start_sec > segment->end_sec;
+  bool InvalidSegment(CacheItem* segment) {
+    return segment->start_ms > segment->end_ms;
   }
 
   Smi stamp_;
 
-  // Daylight Saving Time cache.
-  DST dst_[kDSTSize];
-  int dst_usage_counter_;
-  DST* before_;
-  DST* after_;
+  // Local timezone offset cache.
+  CacheItem cache_[kCacheSize];
+  int cache_usage_counter_;
+  CacheItem* before_;
+  CacheItem* after_;
 
   int local_offset_ms_;
 
@@ -14,6 +14,8 @@ namespace internal {
 
 template <typename Char>
 bool DateParser::Parse(Isolate* isolate, Vector<Char> str, double* out) {
+  if (ParseISODateTimeFast(str, out)) return true;
+
   InputReader<Char> in(str);
   DateStringTokenizer<Char> scanner(&in);
   TimeZoneComposer tz;
@@ -348,6 +350,88 @@ DateParser::DateToken DateParser::ParseES5DateTime(
   return DateToken::EndOfInput();
 }
 
+template <typename Char>
+bool DateParser::ParseISODateTimeFast(Vector<Char> str, double* out) {
+  int length = str.length();
+  int pos = 0;
+  // Reads a fixed number of digits, or returns -1.
+  auto read_digits = [&](int count) {
+    if (pos + count > length) return -1;
+    int value = 0;
+    for (int i = 0; i < count; i++) {
+      Char c = str[pos + i];
+      if (!IsDecimalDigit(c)) return -1;
+      value = value * 10 + (c - '0');
+    }
+    pos += count;
+    return value;
+  };
+  auto skip = [&](char c) {
+    if (pos >= length || str[pos] != c) return false;
+    pos++;
+    return true;
+  };
+
+  int year = read_digits(4);
+  if (year < 0 || !skip('-')) return false;
+  int month = read_digits(2);
+  if (!DayComposer::IsMonth(month) || !skip('-')) return false;
+  int day = read_digits(2);
+  if (!DayComposer::IsDay(day)) return false;
+  out[YEAR] = year;
+  out[MONTH] = month - 1;  // 0-based
+  out[DAY] = day;
+  out[HOUR] = out[MINUTE] = out[SECOND] = out[MILLISECOND] = 0;
+  if (pos == length) {
+    // Date-only forms are UTC.
+    out[UTC_OFFSET] = 0;
+    return true;
+  }
+
+  // The 24th hour is left to the full parser.
+  if (!skip('T')) return false;
+  int hour = read_digits(2);
+  if (!TimeComposer::IsHour(hour) || !skip(':')) return false;
+  int minute = read_digits(2);
+  if (!TimeComposer::IsMinute(minute)) return false;
+  out[HOUR] = hour;
+  out[MINUTE] = minute;
+  if (skip(':')) {
+    int second = read_digits(2);
+    if (!TimeComposer::IsSecond(second)) return false;
+    out[SECOND] = second;
+    if (skip('.')) {
+      int millisecond = read_digits(3);
+      if (millisecond < 0) return false;
+      out[MILLISECOND] = millisecond;
+    }
+  }
+
+  if (pos == length) {
+    // Date-time forms without an offset are local time.
+    out[UTC_OFFSET] = std::numeric_limits<double>::quiet_NaN();
+    return true;
+  }
+  if (skip('Z')) {
+    out[UTC_OFFSET] = 0;
+  } else {
+    int sign;
+    if (skip('+')) {
+      sign = 1;
+    } else if (skip('-')) {
+      sign = -1;
+    } else {
+      return false;
+    }
+    int offset_hour = read_digits(2);
+    if (!TimeComposer::IsHour(offset_hour) || !skip(':')) return false;
+    int offset_minute = read_digits(2);
+    if (!TimeComposer::IsMinute(offset_minute)) return false;
+    out[UTC_OFFSET] = sign * (offset_hour * 3600 + offset_minute * 60);
+  }
+  return pos == length;
+}
+
 }  // namespace internal
 }  // namespace v8
 
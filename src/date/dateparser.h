@@ -353,6 +353,15 @@ class DateParser : public AllStatic {
   static DateParser::DateToken ParseES5DateTime(
       DateStringTokenizer<Char>* scanner, DayComposer* day, TimeComposer* time,
       TimeZoneComposer* tz);
+
+  // Parses the common fixed-width ISO 8601 forms
+  //   yyyy-MM-DD[THH:mm[:ss[.sss]][Z|(+|-)hh:mm]]
+  // without going through the tokenizer. Returns false if the string does not
+  // have exactly this shape, in which case the full parser has to be used.
+  // Never accepts a string that the full parser would reject or parse
+  // differently.
+  template <typename Char>
+  static bool ParseISODateTimeFast(Vector<Char> str, double* output);
 };
 
 }  // namespace internal
@@ -512,6 +512,23 @@ V8_EXPORT_PRIVATE v8::MaybeLocal<v8::Value> EvaluateGlobal(
 
 int GetDebuggingId(v8::Local<v8::Function> function);
 
+// Number of feedback slots of a function per inline cache state. All counts
+// are zero if the function has no feedback vector (yet).
+struct FeedbackSummary {
+  int slot_count = 0;
+  int uninitialized = 0;
+  int monomorphic = 0;
+  int polymorphic = 0;
+  int megamorphic = 0;
+  int generic = 0;
+  int invocation_count = 0;
+  int profiler_ticks = 0;
+  bool has_optimized_code = false;
+};
+
+V8_EXPORT_PRIVATE FeedbackSummary
+GetFeedbackSummary(v8::Local<v8::Function> function);
+
 bool SetFunctionBreakpoint(v8::Local<v8::Function> function,
                            v8::Local<v8::String> condition, BreakpointId* id);
 
@@ -1249,8 +1249,11 @@ void Debug::PrepareFunctionForDebugExecution(
   debug_info->set_original_bytecode_array(*maybe_original_bytecode_array);
 
   if (debug_info->CanBreakAtEntry()) {
-    // Deopt everything in case the function is inlined anywhere.
-    Deoptimizer::DeoptimizeAll(isolate_);
+    // Optimized code that inlines the function or calls it without going
+    // through its code (e.g. directly calling the builtin or API callback)
+    // records it like an inlined function, so there is no need to deopt
+    // everything.
+    DeoptimizeFunction(shared);
     InstallDebugBreakTrampoline();
   } else {
     DeoptimizeFunction(shared);
@@ -620,6 +620,10 @@ Handle<Code> Deoptimizer::compiled_code() const {
   return Handle<Code>(compiled_code_, isolate());
 }
 
+DeoptimizeReason Deoptimizer::deopt_reason() const {
+  return GetDeoptInfo(compiled_code_, from_).deopt_reason;
+}
+
 bool Deoptimizer::should_reuse_code() const {
   int count = compiled_code_.deoptimization_count();
   return deopt_kind_ == DeoptimizeKind::kSoft &&
@@ -2,6 +2,7 @@
 // Use of this source code is governed by a BSD-style license that can be
 // found in the LICENSE file.
 
+#include <cinttypes>
 #include <ostream>  // NOLINT(readability/streams)
 #include <vector>
 
@@ -40,12 +41,18 @@ void CompilationStatistics::RecordPhaseKindStats(const char* phase_kind_name,
   it->second.Accumulate(stats);
 }
 
-void CompilationStatistics::RecordTotalStats(size_t source_size,
+void CompilationStatistics::RecordTotalStats(const char* tier_name,
+                                             size_t source_size,
+                                             size_t code_size,
                                              const BasicStats& stats) {
   base::MutexGuard guard(&record_mutex_);
 
-  source_size += source_size;
-  total_stats_.Accumulate(stats);
+  for (TotalStats* total : {&total_stats_, &tier_map_[tier_name]}) {
+    total->source_size_ += source_size;
+    total->code_size_ += code_size;
+    total->count_++;
+    total->Accumulate(stats);
+  }
 }
 
 void CompilationStatistics::BasicStats::Accumulate(const BasicStats& stats) {
@@ -89,6 +96,32 @@ static void WriteLine(std::ostream& os, bool machine_format, const char* name,
   }
 }
 
+static void WriteTierLine(
+    std::ostream& os, bool machine_format, const std::string& name,
+    const CompilationStatistics::BasicStats& stats, size_t count,
+    uint64_t code_size, const CompilationStatistics::BasicStats& total_stats) {
+  const size_t kBufferSize = 128;
+  char buffer[kBufferSize];
+
+  double ms = stats.delta_.InMillisecondsF();
+  if (machine_format) {
+    base::OS::SNPrintF(buffer, kBufferSize,
+                       "\"%s_time\"=%.3f\n\"%s_count\"=%zu\n"
+                       "\"%s_code_size\"=%" PRIu64,
+                       name.c_str(), ms, name.c_str(), count, name.c_str(),
+                       code_size);
+    os << buffer << std::endl;
+  } else {
+    base::OS::SNPrintF(buffer, kBufferSize,
+                       "%34s %10.3f (%5.1f%%)  %10zu functions %12" PRIu64
+                       " bytes of code",
+                       name.c_str(), ms,
+                       stats.delta_.PercentOf(total_stats.delta_), count,
+                       code_size);
+    os << buffer << std::endl;
+  }
+}
+
 static void WriteFullLine(std::ostream& os) {
   os << "-----------------------------------------------------------"
         "-----------------------------------------------------------\n";
@@ -150,6 +183,12 @@ std::ostream& operator<<(std::ostream& os, const AsPrintableStatistics& ps) {
   if (!ps.machine_output) WriteFullLine(os);
   WriteLine(os, ps.machine_output, "totals", s.total_stats_, s.total_stats_);
 
+  if (!ps.machine_output) WriteFullLine(os);
+  for (const auto& tier : s.tier_map_) {
+    WriteTierLine(os, ps.machine_output, tier.first, tier.second,
+                  tier.second.count_, tier.second.code_size_, s.total_stats_);
+  }
+
   return os;
 }
 
@@ -48,13 +48,18 @@ class CompilationStatistics final : public Malloced {
   void RecordPhaseKindStats(const char* phase_kind_name,
                             const BasicStats& stats);
 
-  void RecordTotalStats(size_t source_size, const BasicStats& stats);
+  // Records the stats of a whole compilation, both in the totals and in the
+  // totals of the given optimization tier.
+  void RecordTotalStats(const char* tier_name, size_t source_size,
+                        size_t code_size, const BasicStats& stats);
 
  private:
   class TotalStats : public BasicStats {
    public:
-    TotalStats() : source_size_(0) {}
+    TotalStats() : source_size_(0), code_size_(0), count_(0) {}
     uint64_t source_size_;
+    uint64_t code_size_;
+    size_t count_;
   };
 
   class OrderedStats : public BasicStats {
@@ -76,8 +81,10 @@ class CompilationStatistics final : public Malloced {
   using PhaseKindStats = OrderedStats;
   using PhaseKindMap = std::map<std::string, PhaseKindStats>;
   using PhaseMap = std::map<std::string, PhaseStats>;
+  using TierMap = std::map<std::string, TotalStats>;
 
   TotalStats total_stats_;
+  TierMap tier_map_;
   PhaseKindMap phase_kind_map_;
   PhaseMap phase_map_;
   base::Mutex record_mutex_;
@@ -1255,6 +1255,15 @@ void JSRegExp::JSRegExpVerify(Isolate* isolate) {
       CHECK(arr.get(JSRegExp::kIrregexpBacktrackLimit).IsSmi());
       break;
     }
+    case JSRegExp::EXPERIMENTAL: {
+      FixedArray arr = FixedArray::cast(data());
+      Object bytecode = arr.get(JSRegExp::kIrregexpLatin1BytecodeIndex);
+      CHECK(bytecode.IsByteArray());
+      CHECK_EQ(bytecode, arr.get(JSRegExp::kIrregexpUC16BytecodeIndex));
+      CHECK(arr.get(JSRegExp::kIrregexpCaptureCountIndex).IsSmi());
+      CHECK(arr.get(JSRegExp::kIrregexpMaxRegisterCountIndex).IsSmi());
+      break;
+    }
     default:
       CHECK_EQ(JSRegExp::NOT_COMPILED, TypeTag());
       CHECK(data().IsUndefined(isolate));
@@ -84,6 +84,16 @@ struct PerfJitCodeLoad : PerfJitBase {
   uint64_t code_id_;
 };
 
+struct PerfJitCodeMove : PerfJitBase {
+  uint32_t process_id_;
+  uint32_t thread_id_;
+  uint64_t vma_;
+  uint64_t old_code_addr_;
+  uint64_t new_code_addr_;
+  uint64_t code_size_;
+  uint64_t code_id_;
+};
+
 struct PerfJitDebugEntry {
   uint64_t address_;
   int line_number_;
@@ -114,6 +124,7 @@ base::LazyRecursiveMutex PerfJitLogger::file_mutex_;
 uint64_t PerfJitLogger::reference_count_ = 0;
 void* PerfJitLogger::marker_address_ = nullptr;
 uint64_t PerfJitLogger::code_index_ = 0;
+std::unordered_map<Address, uint64_t>* PerfJitLogger::code_indices_ = nullptr;
 FILE* PerfJitLogger::perf_output_handle_ = nullptr;
 
 void PerfJitLogger::OpenJitDumpFile() {
@@ -177,6 +188,7 @@ PerfJitLogger::PerfJitLogger(Isolate* isolate) : CodeEventLogger(isolate) {
     OpenJitDumpFile();
     if (perf_output_handle_ == nullptr) return;
     LogWriteHeader();
+    code_indices_ = new std::unordered_map<Address, uint64_t>();
   }
 }
 
@@ -187,6 +199,8 @@ PerfJitLogger::~PerfJitLogger() {
   // If this was the last logger, close the file.
   if (reference_count_ == 0) {
     CloseJitDumpFile();
+    delete code_indices_;
+    code_indices_ = nullptr;
   }
 }
 
@@ -220,7 +234,7 @@ void PerfJitLogger::LogRecordedBuffer(
 
   // Debug info has to be emitted first.
   Handle<SharedFunctionInfo> shared;
-  if (FLAG_perf_prof && !maybe_shared.ToHandle(&shared)) {
+  if (FLAG_perf_prof && maybe_shared.ToHandle(&shared)) {
     // TODO(herhut): This currently breaks for js2wasm/wasm2js functions.
     if (code->kind() != Code::JS_TO_WASM_FUNCTION &&
         code->kind() != Code::WASM_TO_JS_FUNCTION) {
@@ -238,6 +252,11 @@ void PerfJitLogger::LogRecordedBuffer(
   // Unwinding info comes right after debug info.
   if (FLAG_perf_prof_unwinding_info) LogWriteUnwindingInfo(*code);
 
+  // Remember the index of the load record for on-heap code, which can be
+  // moved by a compacting GC.
+  if (!code->is_off_heap_trampoline() && code_indices_ != nullptr) {
+    (*code_indices_)[code->InstructionStart()] = code_index_;
+  }
   WriteJitCodeLoadEntry(code_pointer, code_size, code_name, length);
 }
 
@@ -280,6 +299,27 @@ void PerfJitLogger::WriteJitCodeLoadEntry(const uint8_t* code_pointer,
   LogWriteBytes(reinterpret_cast<const char*>(code_pointer), code_size);
 }
 
+void PerfJitLogger::WriteJitCodeMoveEntry(Address from, Address to,
+                                          uint32_t code_size,
+                                          uint64_t code_id) {
+  PerfJitCodeMove code_move;
+  code_move.event_ = PerfJitCodeMove::kMove;
+  code_move.size_ = sizeof(code_move);
+  code_move.time_stamp_ = GetTimestamp();
+  code_move.process_id_ =
+      static_cast<uint32_t>(base::OS::GetCurrentProcessId());
+  code_move.thread_id_ = static_cast<uint32_t>(base::OS::GetCurrentThreadId());
+  code_move.vma_ = static_cast<uint64_t>(to);
+  code_move.old_code_addr_ = static_cast<uint64_t>(from);
+  code_move.new_code_addr_ = static_cast<uint64_t>(to);
+  code_move.code_size_ = code_size;
+  // "perf inject" maps the moved code to the ELF image written for the
+  // original load record, so the id must be the one of that record.
+  code_move.code_id_ = code_id;
+
+  LogWriteBytes(reinterpret_cast<const char*>(&code_move), sizeof(code_move));
+}
+
 namespace {
 
 constexpr char kUnknownScriptNameString[] = "<unknown>";
@@ -496,9 +536,26 @@ void PerfJitLogger::LogWriteUnwindingInfo(Code code) {
 }
 
 void PerfJitLogger::CodeMoveEvent(AbstractCode from, AbstractCode to) {
-  // We may receive a CodeMove event if a BytecodeArray object moves. Otherwise
-  // code relocation is not supported.
-  CHECK(from.IsBytecodeArray());
+  // BytecodeArray objects are not logged, so their moves are irrelevant.
+  if (from.IsBytecodeArray()) return;
+  Code from_code = Code::cast(from);
+  if (from_code.is_off_heap_trampoline()) return;
+
+  // Move events are reported by parallel evacuation tasks.
+  base::LockGuard<base::RecursiveMutex> guard_file(file_mutex_.Pointer());
+
+  if (perf_output_handle_ == nullptr) return;
+
+  // Code that was not logged (e.g. filtered by
+  // --perf-basic-prof-only-functions) has no load record to move.
+  auto it = code_indices_->find(from_code.InstructionStart());
+  if (it == code_indices_->end()) return;
+  uint64_t code_id = it->second;
+  code_indices_->erase(it);
+  (*code_indices_)[to.InstructionStart()] = code_id;
+
+  WriteJitCodeMoveEntry(from_code.InstructionStart(), to.InstructionStart(),
+                        from_code.ExecutableInstructionSize(), code_id);
 }
 
 void PerfJitLogger::LogWriteBytes(const char* bytes, int size) {
@@ -33,6 +33,8 @@
 // {PerfJitLogger} is only implemented on Linux.
 #if V8_OS_LINUX
 
+#include <unordered_map>
+
 #include "src/logging/log.h"
 
 namespace v8 {
@@ -71,6 +73,8 @@ class PerfJitLogger : public CodeEventLogger {
 
   void WriteJitCodeLoadEntry(const uint8_t* code_pointer, uint32_t code_size,
                              const char* name, int name_length);
+  void WriteJitCodeMoveEntry(Address from, Address to, uint32_t code_size,
+                             uint64_t code_id);
 
   void LogWriteBytes(const char* bytes, int size);
   void LogWriteHeader();
@@ -125,6 +129,9 @@ class PerfJitLogger : public CodeEventLogger {
   static uint64_t reference_count_;
   static void* marker_address_;
   static uint64_t code_index_;
+  // Maps the instruction start of logged on-heap code to the index used for
+  // its load record, so that moves can refer to the original load.
+  static std::unordered_map<Address, uint64_t>* code_indices_;
 };
 
 }  // namespace internal
@@ -1469,8 +1469,8 @@ int DisassemblerX64::AVXInstruction(byte* data) {
         AppendToBuffer(",%u", *current++);
         break;
       case 0x73:
-        AppendToBuffer("vps%sq %s,", sf_str[regop / 2],
-                       NameOfXMMRegister(vvvv));
+        AppendToBuffer("vps%s%s %s,", sf_str[regop / 2],
+                       regop & 1 ? "dq" : "q", NameOfXMMRegister(vvvv));
         current += PrintRightXMMOperand(current);
         AppendToBuffer(",%u", *current++);
         break;
@@ -1999,7 +1999,8 @@ int DisassemblerX64::TwoByteOpcodeInstruction(byte* data) {
         current += 1;
       } else if (opcode == 0x73) {
         current += 1;
-        AppendToBuffer("ps%sq %s,%d", sf_str[regop / 2], NameOfXMMRegister(rm),
+        AppendToBuffer("ps%s%s %s,%d", sf_str[regop / 2],
+                       regop & 1 ? "dq" : "q", NameOfXMMRegister(rm),
                        *current & 0x7F);
         current += 1;
       } else if (opcode == 0xB1) {
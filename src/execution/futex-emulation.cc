@@ -5,6 +5,7 @@
 #include "src/execution/futex-emulation.h"
 
 #include <limits>
+#include <unordered_map>
 
 #include "src/api/api-inl.h"
 #include "src/base/logging.h"
@@ -31,6 +32,16 @@ class FutexWaitList {
   void AddNode(FutexWaitListNode* node);
   void RemoveNode(FutexWaitListNode* node);
 
+  static void* ToWaitLocation(const BackingStore* backing_store, size_t addr) {
+    return static_cast<int8_t*>(backing_store->buffer_start()) + addr;
+  }
+
+  // Returns the first node waiting on |wait_location|, or nullptr.
+  FutexWaitListNode* FirstNodeAt(void* wait_location) {
+    auto it = location_lists_.find(wait_location);
+    return it == location_lists_.end() ? nullptr : it->second.head;
+  }
+
   // For checking the internal consistency of the FutexWaitList.
   void Verify();
   // Verifies the local consistency of |node|. If it's the first node of its
@@ -43,13 +54,18 @@ class FutexWaitList {
  private:
   friend class FutexEmulation;
 
-  FutexWaitListNode* head_ = nullptr;
-  FutexWaitListNode* tail_ = nullptr;
-
   struct HeadAndTail {
     FutexWaitListNode* head;
     FutexWaitListNode* tail;
   };
+
+  // Unlinks |node| from |list| without touching the maps.
+  static void UnlinkNode(FutexWaitListNode* node, HeadAndTail* list);
+
+  // Location -> linked list of Nodes waiting on it. Keeping one list per
+  // location makes Wake proportional to the number of waiters on the woken
+  // location rather than to the number of waiters in the process.
+  std::unordered_map<void*, HeadAndTail> location_lists_;
   // Isolate* -> linked list of Nodes which are waiting for their Promises to
   // be resolved.
   std::map<Isolate*, HeadAndTail> isolate_promises_to_resolve_;
@@ -163,38 +179,48 @@ void FutexEmulation::NotifyAsyncWaiter(FutexWaitListNode* node) {
 void FutexWaitList::AddNode(FutexWaitListNode* node) {
   DCHECK_NULL(node->prev_);
   DCHECK_NULL(node->next_);
-  if (tail_) {
-    tail_->next_ = node;
+  DCHECK_NOT_NULL(node->wait_location_);
+  auto it = location_lists_.find(node->wait_location_);
+  if (it == location_lists_.end()) {
+    location_lists_.insert(
+        std::make_pair(node->wait_location_, HeadAndTail{node, node}));
   } else {
-    head_ = node;
+    it->second.tail->next_ = node;
+    node->prev_ = it->second.tail;
+    it->second.tail = node;
   }
 
-  node->prev_ = tail_;
-  tail_ = node;
-
   Verify();
 }
 
 void FutexWaitList::RemoveNode(FutexWaitListNode* node) {
-  DCHECK(NodeIsOnList(node, head_));
+  auto it = location_lists_.find(node->wait_location_);
+  DCHECK_NE(location_lists_.end(), it);
+  DCHECK(NodeIsOnList(node, it->second.head));
 
+  UnlinkNode(node, &it->second);
+  if (it->second.head == nullptr) location_lists_.erase(it);
+
+  Verify();
+}
+
+// static
+void FutexWaitList::UnlinkNode(FutexWaitListNode* node, HeadAndTail* list) {
   if (node->prev_) {
     node->prev_->next_ = node->next_;
   } else {
-    DCHECK_EQ(node, head_);
-    head_ = node->next_;
+    DCHECK_EQ(node, list->head);
+    list->head = node->next_;
   }
 
   if (node->next_) {
     node->next_->prev_ = node->prev_;
   } else {
-    DCHECK_EQ(node, tail_);
-    tail_ = node->prev_;
+    DCHECK_EQ(node, list->tail);
+    list->tail = node->prev_;
   }
 
   node->prev_ = node->next_ = nullptr;
-
-  Verify();
 }
 
 void AtomicsWaitWakeHandle::Wake() {
@@ -343,6 +369,8 @@ Object FutexEmulation::WaitSync(Isolate* isolate,
     FutexWaitListNode* node = isolate->futex_wait_list_node();
     node->backing_store_ = backing_store;
     node->wait_addr_ = addr;
+    node->wait_location_ =
+        FutexWaitList::ToWaitLocation(backing_store.get(), addr);
     node->waiting_ = true;
 
     // Reset node->waiting_ = false when leaving this scope (but while
@@ -455,6 +483,8 @@ FutexWaitListNode::FutexWaitListNode(
     : isolate_for_async_waiters_(isolate),
       backing_store_(backing_store),
       wait_addr_(wait_addr),
+      wait_location_(
+          FutexWaitList::ToWaitLocation(backing_store.get(), wait_addr)),
       waiting_(true) {
   auto v8_isolate = reinterpret_cast<v8::Isolate*>(isolate);
   task_runner_ = V8::GetCurrentPlatform()->GetForegroundTaskRunner(v8_isolate);
@@ -569,8 +599,14 @@ Object FutexEmulation::Wake(Handle<JSArrayBuffer> array_buffer, size_t addr,
   int waiters_woken = 0;
   std::shared_ptr<BackingStore> backing_store = array_buffer->GetBackingStore();
 
+  void* wait_location =
+      FutexWaitList::ToWaitLocation(backing_store.get(), addr);
+
   base::MutexGuard lock_guard(g_mutex.Pointer());
-  FutexWaitListNode* node = g_wait_list.Pointer()->head_;
+  // Only nodes waiting on this location need to be looked at. The backing
+  // store is still compared below, since a dead backing store's address may
+  // have been reused by a new one.
+  FutexWaitListNode* node = g_wait_list.Pointer()->FirstNodeAt(wait_location);
   while (node && num_waiters_to_wake > 0) {
     bool delete_this_node = false;
     std::shared_ptr<BackingStore> node_backing_store =
@@ -580,8 +616,8 @@ Object FutexEmulation::Wake(Handle<JSArrayBuffer> array_buffer, size_t addr,
       node = node->next_;
       continue;
     }
-    if (backing_store.get() == node_backing_store.get() &&
-        addr == node->wait_addr_) {
+    if (backing_store.get() == node_backing_store.get()) {
+      DCHECK_EQ(addr, node->wait_addr_);
       node->waiting_ = false;
 
       // Retrieve the next node to iterate before calling NotifyAsyncWaiter,
@@ -761,17 +797,26 @@ void FutexEmulation::HandleAsyncWaiterTimeout(FutexWaitListNode* node) {
 void FutexEmulation::IsolateDeinit(Isolate* isolate) {
   base::MutexGuard lock_guard(g_mutex.Pointer());
 
-  FutexWaitListNode* node = g_wait_list.Pointer()->head_;
-  while (node) {
-    if (node->isolate_for_async_waiters_ == isolate) {
-      // The Isolate is going away; don't bother cleaning up the Promises in the
-      // NativeContext. Also we don't need to cancel the timeout task, since it
-      // will be cancelled by Isolate::Deinit.
-      node->timeout_task_id_ = CancelableTaskManager::kInvalidTaskId;
-      g_wait_list.Pointer()->RemoveNode(node);
-      node = DeleteAsyncWaiterNode(node);
+  FutexWaitListNode* node;
+  auto& location_lists = g_wait_list.Pointer()->location_lists_;
+  for (auto it = location_lists.begin(); it != location_lists.end();) {
+    node = it->second.head;
+    while (node) {
+      FutexWaitListNode* next = node->next_;
+      if (node->isolate_for_async_waiters_ == isolate) {
+        // The Isolate is going away; don't bother cleaning up the Promises in
+        // the NativeContext. Also we don't need to cancel the timeout task,
+        // since it will be cancelled by Isolate::Deinit.
+        node->timeout_task_id_ = CancelableTaskManager::kInvalidTaskId;
+        FutexWaitList::UnlinkNode(node, &it->second);
+        delete node;
+      }
+      node = next;
+    }
+    if (it->second.head == nullptr) {
+      it = location_lists.erase(it);
     } else {
-      node = node->next_;
+      ++it;
     }
   }
 
@@ -794,15 +839,17 @@ Object FutexEmulation::NumWaitersForTesting(Handle<JSArrayBuffer> array_buffer,
   DCHECK_LT(addr, array_buffer->byte_length());
   std::shared_ptr<BackingStore> backing_store = array_buffer->GetBackingStore();
 
+  void* wait_location =
+      FutexWaitList::ToWaitLocation(backing_store.get(), addr);
+
   base::MutexGuard lock_guard(g_mutex.Pointer());
 
   int waiters = 0;
-  FutexWaitListNode* node = g_wait_list.Pointer()->head_;
+  FutexWaitListNode* node = g_wait_list.Pointer()->FirstNodeAt(wait_location);
   while (node) {
     std::shared_ptr<BackingStore> node_backing_store =
         node->backing_store_.lock();
-    if (backing_store.get() == node_backing_store.get() &&
-        addr == node->wait_addr_ && node->waiting_) {
+    if (backing_store.get() == node_backing_store.get() && node->waiting_) {
       waiters++;
     }
 
@@ -816,12 +863,14 @@ Object FutexEmulation::NumAsyncWaitersForTesting(Isolate* isolate) {
   base::MutexGuard lock_guard(g_mutex.Pointer());
 
   int waiters = 0;
-  FutexWaitListNode* node = g_wait_list.Pointer()->head_;
-  while (node) {
-    if (node->isolate_for_async_waiters_ == isolate && node->waiting_) {
-      waiters++;
+  for (const auto& it : g_wait_list.Pointer()->location_lists_) {
+    FutexWaitListNode* node = it.second.head;
+    while (node) {
+      if (node->isolate_for_async_waiters_ == isolate && node->waiting_) {
+        waiters++;
+      }
+      node = node->next_;
     }
-    node = node->next_;
   }
 
   return Smi::FromInt(waiters);
@@ -881,13 +930,16 @@ void FutexWaitList::VerifyNode(FutexWaitListNode* node, FutexWaitListNode* head,
 
 void FutexWaitList::Verify() {
 #ifdef DEBUG
-  FutexWaitListNode* node = head_;
-  while (node) {
-    VerifyNode(node, head_, tail_);
-    node = node->next_;
+  for (const auto& it : location_lists_) {
+    auto node = it.second.head;
+    while (node) {
+      VerifyNode(node, it.second.head, it.second.tail);
+      DCHECK_EQ(it.first, node->wait_location_);
+      node = node->next_;
+    }
   }
 
-  for (auto it : isolate_promises_to_resolve_) {
+  for (const auto& it : isolate_promises_to_resolve_) {
     auto node = it.second.head;
     while (node) {
       VerifyNode(node, it.second.head, it.second.tail);
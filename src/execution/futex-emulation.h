@@ -100,6 +100,9 @@ class FutexWaitListNode {
 
   std::weak_ptr<BackingStore> backing_store_;
   size_t wait_addr_ = 0;
+  // The address of the waited-on word; the key of the per-location list in
+  // FutexWaitList this node is on.
+  void* wait_location_ = nullptr;
   // waiting_ and interrupted_ are protected by FutexEmulation::mutex_
   // if this node is currently contained in FutexEmulation::wait_list_
   // or an AtomicsWaitWakeHandle has access to it.
@@ -6,6 +6,7 @@
 
 #include <stdlib.h>
 
+#include <algorithm>
 #include <atomic>
 #include <fstream>  // NOLINT(readability/streams)
 #include <memory>
@@ -56,6 +57,7 @@
 #include "src/logging/counters.h"
 #include "src/logging/log.h"
 #include "src/logging/metrics.h"
+#include "src/logging/runtime-call-stats-sampler.h"
 #include "src/numbers/hash-seed-inl.h"
 #include "src/objects/backing-store.h"
 #include "src/objects/elements.h"
@@ -2859,7 +2861,10 @@ class TracingAccountingAllocator : public AccountingAllocator {
     }
     out << "\"allocated\": " << total_segment_bytes_allocated << ", "
         << "\"used\": " << total_zone_allocation_size << ", "
-        << "\"freed\": " << total_zone_freed_size << "}";
+        << "\"freed\": " << total_zone_freed_size << ", "
+        << "\"pooled\": " << GetPooledMemory() << ", "
+        << "\"pool_hits\": " << GetSegmentPoolHits() << ", "
+        << "\"pool_misses\": " << GetSegmentPoolMisses() << "}";
   }
 
   Isolate* const isolate_;
@@ -3036,6 +3041,10 @@ void Isolate::Deinit() {
     heap_profiler()->StopSamplingHeapProfiler();
   }
 
+  if (runtime_call_stats_sampler_) {
+    runtime_call_stats_sampler_->Stop();
+    runtime_call_stats_sampler_.reset();
+  }
   metrics_recorder_->NotifyIsolateDisposal();
 
 #if defined(V8_OS_WIN64)
@@ -3468,7 +3477,9 @@ bool Isolate::Init(ReadOnlyDeserializer* read_only_deserializer,
   DCHECK_EQ(create_heap_objects, startup_deserializer == nullptr);
 
   base::ElapsedTimer timer;
-  if (create_heap_objects && FLAG_profile_deserialization) timer.Start();
+  timer.Start();
+  base::ElapsedTimer phase_timer;
+  startup_metrics_.from_snapshot = !create_heap_objects;
 
   time_millis_at_init_ = heap_.MonotonicallyIncreasingTimeInMs();
 
@@ -3524,9 +3535,16 @@ bool Isolate::Init(ReadOnlyDeserializer* read_only_deserializer,
 
   // SetUp the object heap.
   DCHECK(!heap_.HasBeenSetUp());
+  phase_timer.Start();
   heap_.SetUp();
+  base::TimeDelta heap_setup_time = phase_timer.Restart();
   ReadOnlyHeap::SetUp(this, read_only_deserializer);
+  startup_metrics_.read_only_heap_setup_wall_clock_duration_in_us =
+      phase_timer.Restart().InMicroseconds();
   heap_.SetUpSpaces();
+  heap_setup_time += phase_timer.Elapsed();
+  startup_metrics_.heap_setup_wall_clock_duration_in_us =
+      heap_setup_time.InMicroseconds();
 
   isolate_data_.external_reference_table()->Init(this);
 
@@ -3562,6 +3580,7 @@ bool Isolate::Init(ReadOnlyDeserializer* read_only_deserializer,
 
   bootstrapper_->Initialize(create_heap_objects);
 
+  phase_timer.Restart();
   if (create_heap_objects) {
     builtins_constants_table_builder_ = new BuiltinsConstantsTableBuilder(this);
 
@@ -3588,6 +3607,8 @@ bool Isolate::Init(ReadOnlyDeserializer* read_only_deserializer,
   } else {
     setup_delegate_->SetupBuiltins(this);
   }
+  startup_metrics_.builtins_setup_wall_clock_duration_in_us =
+      phase_timer.Elapsed().InMicroseconds();
 
   // Initialize custom memcopy and memmove functions (must happen after
   // embedded blob setup).
@@ -3616,7 +3637,10 @@ bool Isolate::Init(ReadOnlyDeserializer* read_only_deserializer,
       heap_.read_only_space()->ClearStringPaddingIfNeeded();
       read_only_heap_->OnCreateHeapObjectsComplete(this);
     } else {
+      phase_timer.Restart();
       startup_deserializer->DeserializeInto(this);
+      startup_metrics_.startup_deserialization_wall_clock_duration_in_us =
+          phase_timer.Elapsed().InMicroseconds();
     }
     load_stub_cache_->Initialize();
     store_stub_cache_->Initialize();
@@ -3689,6 +3713,12 @@ bool Isolate::Init(ReadOnlyDeserializer* read_only_deserializer,
                                                sampling_flags);
   }
 
+  if (FLAG_runtime_call_stats_sampling_interval > 0) {
+    runtime_call_stats_sampler_ =
+        std::make_unique<RuntimeCallStatsSampler>(this);
+    runtime_call_stats_sampler_->Start();
+  }
+
 #if defined(V8_OS_WIN64)
   if (win64_unwindinfo::CanRegisterUnwindInfoForNonABICompliantCodeRange()) {
     const base::AddressRegion& code_range =
@@ -3704,6 +3734,28 @@ bool Isolate::Init(ReadOnlyDeserializer* read_only_deserializer,
     PrintF("[Initializing isolate from scratch took %0.3f ms]\n", ms);
   }
 
+  // Snapshot decompression happens before Init() and is recorded by
+  // Snapshot::Initialize().
+  startup_metrics_.total_wall_clock_duration_in_us =
+      timer.Elapsed().InMicroseconds() +
+      std::max<int64_t>(
+          0, startup_metrics_.snapshot_decompression_wall_clock_duration_in_us);
+  if (FLAG_trace_startup) {
+    const v8::metrics::IsolateStartup& m = startup_metrics_;
+    PrintIsolate(this,
+                 "[Isolate startup (%s): total=%" PRId64
+                 " decompression=%" PRId64 " heap=%" PRId64
+                 " read_only_heap=%" PRId64 " builtins=%" PRId64
+                 " deserialization=%" PRId64 " (us)]\n",
+                 m.from_snapshot ? "snapshot" : "scratch",
+                 m.total_wall_clock_duration_in_us,
+                 m.snapshot_decompression_wall_clock_duration_in_us,
+                 m.heap_setup_wall_clock_duration_in_us,
+                 m.read_only_heap_setup_wall_clock_duration_in_us,
+                 m.builtins_setup_wall_clock_duration_in_us,
+                 m.startup_deserialization_wall_clock_duration_in_us);
+  }
+
   return true;
 }
 
@@ -3733,6 +3785,12 @@ void Isolate::Enter() {
       new EntryStackItem(current_data, current_isolate, entry_stack_);
   entry_stack_ = item;
 
+  if (V8_UNLIKELY(FLAG_account_isolate_cpu_time)) {
+    // The thread stops working on behalf of the isolate it entered before.
+    if (current_isolate != nullptr) current_isolate->AccountMainThreadCpuTime();
+    AccountMainThreadCpuTime();
+  }
+
   SetIsolateThreadLocals(this, data);
 
   // In case it's the first time some thread enters the isolate.
@@ -3750,6 +3808,8 @@ void Isolate::Exit() {
   DCHECK_NOT_NULL(CurrentPerIsolateThreadData());
   DCHECK(CurrentPerIsolateThreadData()->isolate_ == this);
 
+  if (V8_UNLIKELY(FLAG_account_isolate_cpu_time)) AccountMainThreadCpuTime();
+
   // Pop the stack.
   EntryStackItem* item = entry_stack_;
   entry_stack_ = item->previous_item;
@@ -3761,6 +3821,36 @@ void Isolate::Exit() {
 
   // Reinit the current thread for the isolate it was running before this one.
   SetIsolateThreadLocals(previous_isolate, previous_thread_data);
+
+  if (V8_UNLIKELY(FLAG_account_isolate_cpu_time) &&
+      previous_isolate != nullptr) {
+    // Don't charge the time spent in this isolate to the previous one.
+    previous_isolate->entry_stack_->cpu_time_start = base::ThreadTicks();
+    previous_isolate->AccountMainThreadCpuTime();
+  }
+}
+
+void Isolate::AccountMainThreadCpuTime() {
+  DCHECK_NOT_NULL(entry_stack_);
+  if (!base::ThreadTicks::IsSupported()) return;
+  base::ThreadTicks now = base::ThreadTicks::Now();
+  base::ThreadTicks start = entry_stack_->cpu_time_start;
+  entry_stack_->cpu_time_start = now;
+  if (start.IsNull()) return;
+  counters()->AddCpuTime(Counters::CpuTimeCategory::kMainThread,
+                         (now - start).InMicroseconds());
+}
+
+void Isolate::PostBackgroundTask(std::unique_ptr<Task> task) {
+  v8::Platform* platform = V8::GetCurrentPlatform();
+  switch (BackgroundTaskPriority(TaskPriority::kUserVisible)) {
+    case TaskPriority::kBestEffort:
+      return platform->CallLowPriorityTaskOnWorkerThread(std::move(task));
+    case TaskPriority::kUserVisible:
+      return platform->CallOnWorkerThread(std::move(task));
+    case TaskPriority::kUserBlocking:
+      return platform->CallBlockingTaskOnWorkerThread(std::move(task));
+  }
 }
 
 void Isolate::LinkDeferredHandles(DeferredHandles* deferred) {
@@ -4576,20 +4666,63 @@ void Isolate::CollectSourcePositionsForAllBytecodeArrays() {
 }
 
 #ifdef V8_INTL_SUPPORT
-icu::UMemory* Isolate::get_cached_icu_object(ICUObjectCacheType cache_type) {
-  return icu_object_cache_[cache_type].get();
+namespace {
+using ICUObjectCacheType = Isolate::ICUObjectCacheType;
+STATIC_ASSERT(
+    static_cast<int>(ICUObjectCacheType::kDefaultSimpleDateFormatForDate) + 1 ==
+    Isolate::kICUObjectCacheTypeCount);
+
+std::string ICUObjectCacheKey(Handle<Object> locales) {
+  if (locales->IsUndefined()) return std::string();
+  DCHECK(locales->IsString());
+  std::string key = String::cast(*locales).ToCString().get();
+  DCHECK(!key.empty());
+  return key;
+}
+}  // namespace
+
+icu::UMemory* Isolate::get_cached_icu_object(ICUObjectCacheType cache_type,
+                                             Handle<Object> locales) {
+  std::vector<ICUObjectCacheEntry>& entries =
+      icu_object_cache_[static_cast<int>(cache_type)];
+  if (entries.empty()) return nullptr;
+  std::string key = ICUObjectCacheKey(locales);
+  for (auto it = entries.begin(); it != entries.end(); ++it) {
+    if (it->locales != key) continue;
+    // Move the entry to the front.
+    std::rotate(entries.begin(), it, it + 1);
+    return entries.front().obj.get();
+  }
+  return nullptr;
 }
 
 void Isolate::set_icu_object_in_cache(ICUObjectCacheType cache_type,
+                                      Handle<Object> locales,
                                       std::shared_ptr<icu::UMemory> obj) {
-  icu_object_cache_[cache_type] = obj;
+  if (FLAG_icu_object_cache_size <= 0) return;
+  std::vector<ICUObjectCacheEntry>& entries =
+      icu_object_cache_[static_cast<int>(cache_type)];
+  std::string key = ICUObjectCacheKey(locales);
+  auto it = std::find_if(entries.begin(), entries.end(),
+                         [&key](const ICUObjectCacheEntry& entry) {
+                           return entry.locales == key;
+                         });
+  if (it != entries.end()) entries.erase(it);
+  if (entries.size() >= static_cast<size_t>(FLAG_icu_object_cache_size)) {
+    entries.resize(FLAG_icu_object_cache_size - 1);
+  }
+  entries.insert(entries.begin(), ICUObjectCacheEntry{key, std::move(obj)});
 }
 
 void Isolate::clear_cached_icu_object(ICUObjectCacheType cache_type) {
-  icu_object_cache_.erase(cache_type);
+  icu_object_cache_[static_cast<int>(cache_type)].clear();
 }
 
-void Isolate::ClearCachedIcuObjects() { icu_object_cache_.clear(); }
+void Isolate::ClearCachedIcuObjects() {
+  for (int i = 0; i < kICUObjectCacheTypeCount; i++) {
+    icu_object_cache_[i].clear();
+  }
+}
 
 #endif  // V8_INTL_SUPPORT
 
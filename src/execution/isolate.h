@@ -14,9 +14,12 @@
 
 #include "include/v8-inspector.h"
 #include "include/v8-internal.h"
+#include "include/v8-metrics.h"
+#include "include/v8-platform.h"
 #include "include/v8.h"
 #include "src/base/macros.h"
 #include "src/base/platform/mutex.h"
+#include "src/base/platform/time.h"
 #include "src/builtins/builtins.h"
 #include "src/common/globals.h"
 #include "src/debug/interface-types.h"
@@ -92,6 +95,7 @@ class ReadOnlyArtifacts;
 class ReadOnlyDeserializer;
 class RegExpStack;
 class RootVisitor;
+class RuntimeCallStatsSampler;
 class RuntimeProfiler;
 class SetupIsolateDelegate;
 class Simulator;
@@ -921,6 +925,24 @@ class V8_EXPORT_PRIVATE Isolate final : private HiddenFactory {
   Bootstrapper* bootstrapper() { return bootstrapper_; }
   // Use for updating counters on a foreground thread.
   Counters* counters() { return async_counters().get(); }
+  // Charges the CPU time that the current thread spent in this isolate since
+  // it entered the isolate, or since the last call, to the main thread CPU
+  // time. Only used with --account-isolate-cpu-time.
+  void AccountMainThreadCpuTime();
+
+  void set_background_tasks_throttled(bool throttled) {
+    background_tasks_throttled_.store(throttled, std::memory_order_relaxed);
+  }
+  // Returns the priority to use for a background task that is posted on
+  // behalf of this isolate. Throttled isolates use TaskPriority::kBestEffort.
+  TaskPriority BackgroundTaskPriority(TaskPriority priority) const {
+    if (background_tasks_throttled_.load(std::memory_order_relaxed)) {
+      return TaskPriority::kBestEffort;
+    }
+    return priority;
+  }
+  // Posts |task| to a worker thread on behalf of this isolate.
+  void PostBackgroundTask(std::unique_ptr<Task> task);
   // Use for updating counters on a background thread.
   const std::shared_ptr<Counters>& async_counters() {
     // Make sure InitializeCounters() has been called.
@@ -930,6 +952,8 @@ class V8_EXPORT_PRIVATE Isolate final : private HiddenFactory {
   const std::shared_ptr<metrics::Recorder>& metrics_recorder() {
     return metrics_recorder_;
   }
+  // Durations of the phases of Isolate::Init, see --trace-startup.
+  v8::metrics::IsolateStartup* startup_metrics() { return &startup_metrics_; }
   RuntimeProfiler* runtime_profiler() { return runtime_profiler_; }
   CompilationCache* compilation_cache() { return compilation_cache_; }
   Logger* logger() {
@@ -1189,9 +1213,15 @@ class V8_EXPORT_PRIVATE Isolate final : private HiddenFactory {
   enum class ICUObjectCacheType{
       kDefaultCollator, kDefaultNumberFormat, kDefaultSimpleDateFormat,
       kDefaultSimpleDateFormatForTime, kDefaultSimpleDateFormatForDate};
+  static constexpr int kICUObjectCacheTypeCount = 5;
 
-  icu::UMemory* get_cached_icu_object(ICUObjectCacheType cache_type);
+  // The cache keeps the --icu-object-cache-size most recently used objects
+  // per type, keyed by the locales argument, which must be undefined or a
+  // non-empty string (see Intl::CanCacheICUObject).
+  icu::UMemory* get_cached_icu_object(ICUObjectCacheType cache_type,
+                                      Handle<Object> locales);
   void set_icu_object_in_cache(ICUObjectCacheType cache_type,
+                               Handle<Object> locales,
                                std::shared_ptr<icu::UMemory> obj);
   void clear_cached_icu_object(ICUObjectCacheType cache_type);
   void ClearCachedIcuObjects();
@@ -1602,6 +1632,9 @@ class V8_EXPORT_PRIVATE Isolate final : private HiddenFactory {
     PerIsolateThreadData* previous_thread_data;
     Isolate* previous_isolate;
     EntryStackItem* previous_item;
+    // Thread CPU time at which accounting for this entry started, see
+    // AccountMainThreadCpuTime.
+    base::ThreadTicks cpu_time_start;
 
    private:
     DISALLOW_COPY_AND_ASSIGN(EntryStackItem);
@@ -1669,6 +1702,7 @@ class V8_EXPORT_PRIVATE Isolate final : private HiddenFactory {
   RuntimeProfiler* runtime_profiler_ = nullptr;
   CompilationCache* compilation_cache_ = nullptr;
   std::shared_ptr<Counters> async_counters_;
+  std::atomic<bool> background_tasks_throttled_{false};
   base::RecursiveMutex break_access_;
   base::SharedMutex transition_array_access_;
   base::Mutex string_table_mutex_;
@@ -1719,14 +1753,14 @@ class V8_EXPORT_PRIVATE Isolate final : private HiddenFactory {
 #ifdef V8_INTL_SUPPORT
   std::string default_locale_;
 
-  struct ICUObjectCacheTypeHash {
-    std::size_t operator()(ICUObjectCacheType a) const {
-      return static_cast<std::size_t>(a);
-    }
+  struct ICUObjectCacheEntry {
+    // Empty for the default locale.
+    std::string locales;
+    std::shared_ptr<icu::UMemory> obj;
   };
-  std::unordered_map<ICUObjectCacheType, std::shared_ptr<icu::UMemory>,
-                     ICUObjectCacheTypeHash>
-      icu_object_cache_;
+  // Most recently used entries first.
+  std::vector<ICUObjectCacheEntry>
+      icu_object_cache_[kICUObjectCacheTypeCount];
 
 #endif  // V8_INTL_SUPPORT
 
@@ -1824,6 +1858,7 @@ class V8_EXPORT_PRIVATE Isolate final : private HiddenFactory {
   v8::Isolate::UseCounterCallback use_counter_callback_ = nullptr;
 
   std::shared_ptr<metrics::Recorder> metrics_recorder_;
+  v8::metrics::IsolateStartup startup_metrics_;
   uintptr_t last_context_token_ = 0;
   std::unordered_map<
       uintptr_t,
@@ -1879,6 +1914,8 @@ class V8_EXPORT_PRIVATE Isolate final : private HiddenFactory {
 
   std::unique_ptr<TracingCpuProfilerImpl> tracing_cpu_profiler_;
 
+  std::unique_ptr<RuntimeCallStatsSampler> runtime_call_stats_sampler_;
+
   EmbeddedFileWriterInterface* embedded_file_writer_ = nullptr;
 
   // The top entry of the v8::Context::BackupIncumbentScope stack.
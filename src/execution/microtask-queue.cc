@@ -6,9 +6,11 @@
 
 #include <stddef.h>
 #include <algorithm>
+#include <limits>
 
 #include "src/api/api-inl.h"
 #include "src/base/logging.h"
+#include "src/base/platform/time.h"
 #include "src/execution/isolate.h"
 #include "src/handles/handles-inl.h"
 #include "src/objects/microtask-inl.h"
@@ -27,8 +29,12 @@ const size_t MicrotaskQueue::kSizeOffset = OFFSET_OF(MicrotaskQueue, size_);
 const size_t MicrotaskQueue::kStartOffset = OFFSET_OF(MicrotaskQueue, start_);
 const size_t MicrotaskQueue::kFinishedMicrotaskCountOffset =
     OFFSET_OF(MicrotaskQueue, finished_microtask_count_);
+const size_t MicrotaskQueue::kFinishedMicrotaskLimitOffset =
+    OFFSET_OF(MicrotaskQueue, finished_microtask_limit_);
 
 const intptr_t MicrotaskQueue::kMinimumCapacity = 8;
+const intptr_t MicrotaskQueue::kNoMicrotaskLimit =
+    std::numeric_limits<intptr_t>::max();
 
 // static
 void MicrotaskQueue::SetUpDefaultMicrotaskQueue(Isolate* isolate) {
@@ -119,6 +125,32 @@ void MicrotaskQueue::PerformCheckpoint(v8::Isolate* v8_isolate) {
   }
 }
 
+bool MicrotaskQueue::PerformCheckpointWithBudget(
+    v8::Isolate* v8_isolate, int max_microtasks,
+    double time_budget_in_seconds) {
+  // Checking the clock after every microtask would add noticeable overhead to
+  // short microtasks, so they are run in batches.
+  static const int kBatchSize = 64;
+  if (!IsRunningMicrotasks() && !GetMicrotasksScopeDepth() &&
+      !HasMicrotasksSuppressions()) {
+    Isolate* isolate = reinterpret_cast<Isolate*>(v8_isolate);
+    base::TimeTicks deadline =
+        base::TimeTicks::Now() +
+        base::TimeDelta::FromMillisecondsD(
+            time_budget_in_seconds *
+            base::TimeConstants::kMillisecondsPerSecond);
+    int remaining = max_microtasks;
+    while (size() && remaining > 0) {
+      int processed = RunMicrotasks(isolate, std::min(remaining, kBatchSize));
+      if (processed < 0) return false;
+      remaining -= processed;
+      if (base::TimeTicks::Now() >= deadline) break;
+    }
+    isolate->ClearKeptObjects();
+  }
+  return size() == 0;
+}
+
 namespace {
 
 class SetIsRunningMicrotasks {
@@ -139,13 +171,18 @@ class SetIsRunningMicrotasks {
 
 }  // namespace
 
-int MicrotaskQueue::RunMicrotasks(Isolate* isolate) {
+int MicrotaskQueue::RunMicrotasks(Isolate* isolate, intptr_t max_count) {
   if (!size()) {
     OnCompleted(isolate);
     return 0;
   }
 
   intptr_t base_count = finished_microtask_count_;
+  DCHECK_GT(max_count, 0);
+  DCHECK_EQ(kNoMicrotaskLimit, finished_microtask_limit_);
+  if (max_count < kNoMicrotaskLimit - base_count) {
+    finished_microtask_limit_ = base_count + max_count;
+  }
 
   HandleScope handle_scope(isolate);
   MaybeHandle<Object> maybe_exception;
@@ -166,6 +203,7 @@ int MicrotaskQueue::RunMicrotasks(Isolate* isolate) {
                                                  &maybe_exception);
       processed_microtask_count =
           static_cast<int>(finished_microtask_count_ - base_count);
+      finished_microtask_limit_ = kNoMicrotaskLimit;
     }
     TRACE_EVENT_END1("v8.execute", "RunMicrotasks", "microtask_count",
                      processed_microtask_count);
@@ -183,7 +221,11 @@ int MicrotaskQueue::RunMicrotasks(Isolate* isolate) {
     OnCompleted(isolate);
     return -1;
   }
-  DCHECK_EQ(0, size());
+  // Microtasks are left over only if the limit was reached.
+  if (size()) {
+    DCHECK_EQ(processed_microtask_count, max_count);
+    return processed_microtask_count;
+  }
   OnCompleted(isolate);
 
   return processed_microtask_count;
@@ -41,6 +41,8 @@ class V8_EXPORT_PRIVATE MicrotaskQueue final : public v8::MicrotaskQueue {
   void EnqueueMicrotask(v8::Isolate* isolate, v8::MicrotaskCallback callback,
                         void* data) override;
   void PerformCheckpoint(v8::Isolate* isolate) override;
+  bool PerformCheckpointWithBudget(v8::Isolate* isolate, int max_microtasks,
+                                   double time_budget_in_seconds) override;
 
   void EnqueueMicrotask(Microtask microtask);
   void AddMicrotasksCompletedCallback(
@@ -49,10 +51,10 @@ class V8_EXPORT_PRIVATE MicrotaskQueue final : public v8::MicrotaskQueue {
       MicrotasksCompletedCallbackWithData callback, void* data) override;
   bool IsRunningMicrotasks() const override { return is_running_microtasks_; }
 
-  // Runs all queued Microtasks.
+  // Runs all queued Microtasks, or at most {max_count} of them.
   // Returns -1 if the execution is terminating, otherwise, returns the number
   // of microtasks that ran in this round.
-  int RunMicrotasks(Isolate* isolate);
+  int RunMicrotasks(Isolate* isolate, intptr_t max_count = kNoMicrotaskLimit);
 
   // Iterate all pending Microtasks in this queue as strong roots, so that
   // builtins can update the queue directly without the write barrier.
@@ -103,8 +105,10 @@ class V8_EXPORT_PRIVATE MicrotaskQueue final : public v8::MicrotaskQueue {
   static const size_t kSizeOffset;
   static const size_t kStartOffset;
   static const size_t kFinishedMicrotaskCountOffset;
+  static const size_t kFinishedMicrotaskLimitOffset;
 
   static const intptr_t kMinimumCapacity;
+  static const intptr_t kNoMicrotaskLimit;
 
  private:
   void OnCompleted(Isolate* isolate);
@@ -123,6 +127,9 @@ class V8_EXPORT_PRIVATE MicrotaskQueue final : public v8::MicrotaskQueue {
   // The number of finished microtask.
   intptr_t finished_microtask_count_ = 0;
 
+  // RunMicrotasks stops once {finished_microtask_count_} reaches this.
+  intptr_t finished_microtask_limit_ = kNoMicrotaskLimit;
+
   // MicrotaskQueue instances form a doubly linked list loop, so that all
   // instances are reachable through |next_|.
   MicrotaskQueue* next_ = nullptr;
@@ -71,7 +71,15 @@ void Unlocker::Initialize(v8::Isolate* isolate) {
   DCHECK_NOT_NULL(isolate);
   isolate_ = reinterpret_cast<i::Isolate*>(isolate);
   DCHECK(isolate_->thread_manager()->IsLockedByCurrentThread());
-  isolate_->thread_manager()->ArchiveThread();
+  if (i::FLAG_lightweight_thread_migration &&
+      isolate_->thread_manager()->IsCurrentThreadIdle()) {
+    // Nothing on this thread has to survive until the Unlocker is destroyed,
+    // so release the isolate like a top-level Locker does. The next Locker
+    // on another thread then does not have to archive this thread's state.
+    isolate_->thread_manager()->FreeThreadResources();
+  } else {
+    isolate_->thread_manager()->ArchiveThread();
+  }
   isolate_->thread_manager()->Unlock();
 }
 
@@ -278,10 +286,36 @@ void ThreadManager::FreeThreadResources() {
   isolate_->FreeThreadResources();
   isolate_->debug()->FreeThreadResources();
   isolate_->stack_guard()->FreeThreadResources();
-  isolate_->regexp_stack()->FreeThreadResources();
+  // The regexp stack is not tied to a thread, so with lightweight migration
+  // the next thread that locks the isolate reuses its memory.
+  if (!FLAG_lightweight_thread_migration) {
+    isolate_->regexp_stack()->FreeThreadResources();
+  }
   isolate_->bootstrapper()->FreeThreadResources();
 }
 
+bool ThreadManager::IsCurrentThreadIdle() {
+  DCHECK(IsLockedByCurrentThread());
+  // A thread is idle if it has neither JavaScript frames nor API calls on its
+  // stack and holds no handles, contexts, exceptions or debugger state that
+  // would have to be restored later.
+  HandleScopeImplementer* hsi = isolate_->handle_scope_implementer();
+  return isolate_->js_entry_sp() == kNullAddress &&
+         isolate_->thread_local_top()->CallDepthIsZero() &&
+         isolate_->thread_local_top()->promise_on_stack_ == nullptr &&
+         isolate_->handle_scope_data()->level == 0 && hsi->blocks()->empty() &&
+         hsi->EnteredContextCount() == 0 && !hsi->HasSavedContexts() &&
+         isolate_->context().is_null() &&
+         isolate_->relocatable_top() == nullptr &&
+         isolate_->try_catch_handler() == nullptr &&
+         !isolate_->has_pending_exception() &&
+         !isolate_->has_scheduled_exception() &&
+         !isolate_->external_caught_exception() &&
+         !isolate_->debug()->in_debug_scope() &&
+         isolate_->debug()->last_step_action() == StepNone &&
+         !isolate_->bootstrapper()->IsActive();
+}
+
 bool ThreadManager::IsArchived() {
   Isolate::PerIsolateThreadData* data =
       isolate_->FindPerThreadDataForThisThread();
@@ -67,6 +67,9 @@ class ThreadManager {
   bool RestoreThread();
   void FreeThreadResources();
   bool IsArchived();
+  // Returns true if the current thread can give up the isolate without
+  // archiving its state, see v8::Unlocker.
+  bool IsCurrentThreadIdle();
 
   void Iterate(RootVisitor* v);
   void IterateArchivedThreads(ThreadVisitor* v);
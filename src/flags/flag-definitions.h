@@ -288,6 +288,9 @@ HARMONY_SHIPPING(FLAG_SHIPPING_FEATURES)
 
 #ifdef V8_INTL_SUPPORT
 DEFINE_BOOL(icu_timezone_data, true, "get information about timezones from ICU")
+DEFINE_INT(icu_object_cache_size, 8,
+           "number of ICU formatters and collators cached per kind for "
+           "toLocaleString and localeCompare calls with a string locale")
 #endif
 
 #ifdef V8_ENABLE_DOUBLE_CONST_STORE_CHECK
@@ -386,6 +389,10 @@ DEFINE_BOOL(assert_types, false,
 // Flags for experimental implementation features.
 DEFINE_BOOL(allocation_site_pretenuring, true,
             "pretenure with allocation sites")
+DEFINE_INT(json_parse_pretenure_threshold, 0,
+           "allocate JSON.parse results in old space if the source has at "
+           "least this many characters and recent scavenges had high "
+           "survival (0 disables)")
 DEFINE_BOOL(page_promotion, true, "promote pages based on utilization")
 DEFINE_BOOL(always_promote_young_mc, true,
             "always promote young objects during mark-compact")
@@ -504,6 +511,9 @@ DEFINE_BOOL(trace_generalization, false, "trace map generalization")
 DEFINE_BOOL(turboprop, false, "enable experimental turboprop mid-tier compiler")
 DEFINE_BOOL(turboprop_mid_tier_reg_alloc, false,
             "enable experimental mid-tier register allocator")
+DEFINE_INT(mid_tier_reg_alloc_instruction_threshold, 0,
+           "use the mid-tier register allocator for code with at least this "
+           "many instructions (0 means never)")
 DEFINE_NEG_IMPLICATION(turboprop, turbo_inlining)
 DEFINE_IMPLICATION(turboprop, concurrent_inlining)
 DEFINE_VALUE_IMPLICATION(turboprop, interrupt_budget, 15 * KB)
@@ -519,6 +529,8 @@ DEFINE_INT(concurrent_recompilation_queue_length, 8,
            "the length of the concurrent compilation queue")
 DEFINE_INT(concurrent_recompilation_delay, 0,
            "artificial compilation delay in ms")
+DEFINE_BOOL(concurrent_recompilation_by_hotness, true,
+            "compile queued functions with higher invocation counts first")
 DEFINE_BOOL(block_concurrent_recompilation, false,
             "block queued jobs until released")
 DEFINE_BOOL(concurrent_inlining, false,
@@ -609,6 +621,11 @@ DEFINE_FLOAT(reserve_inline_budget_scale_factor, 1.2,
              "maximum cumulative size of bytecode considered for inlining")
 DEFINE_INT(max_inlined_bytecode_size_small, 30,
            "maximum size of bytecode considered for small function inlining")
+DEFINE_INT(max_inlined_bytecode_size_small_hot, 60,
+           "maximum size of bytecode considered for small function inlining "
+           "at hot call sites")
+DEFINE_FLOAT(min_hot_inlining_frequency, 8.0,
+             "minimum frequency for a call site to be considered hot")
 DEFINE_INT(max_optimized_bytecode_size, 60 * KB,
            "maximum bytecode size to "
            "be considered for optimization; too high values may cause "
@@ -651,6 +668,13 @@ DEFINE_BOOL(turbo_jt, true, "enable jump threading in TurboFan")
 DEFINE_BOOL(turbo_loop_peeling, true, "Turbofan loop peeling")
 DEFINE_BOOL(turbo_loop_variable, true, "Turbofan loop variable optimization")
 DEFINE_BOOL(turbo_loop_rotation, true, "Turbofan loop rotation")
+DEFINE_BOOL(turbo_elide_bounded_loop_stack_checks, false,
+            "remove the interrupt checks from loops whose iteration count is "
+            "bounded by a small constant")
+DEFINE_INT(turbo_bounded_loop_max_iterations, 1000,
+           "maximum number of iterations of a loop for its interrupt check "
+           "to be removed")
+DEFINE_IMPLICATION(turbo_elide_bounded_loop_stack_checks, turbo_loop_variable)
 DEFINE_BOOL(turbo_cf_optimization, true, "optimize control flow in TurboFan")
 DEFINE_BOOL(turbo_escape, true, "enable escape analysis")
 DEFINE_BOOL(turbo_allocation_folding, true, "Turbofan allocation folding")
@@ -669,6 +693,9 @@ DEFINE_BOOL(
     stress_gc_during_compilation, false,
     "simulate GC/compiler thread race related to https://crbug.com/v8/8520")
 DEFINE_BOOL(turbo_fast_api_calls, false, "enable fast API calls from TurboFan")
+DEFINE_BOOL(fast_api_calls_from_builtins, false,
+            "call fast API functions directly from the HandleApiCall builtin "
+            "when the arguments match their signature")
 DEFINE_INT(reuse_opt_code_count, 0,
            "don't discard optimized code for the specified number of deopts.")
 DEFINE_BOOL(dynamic_map_checks, false,
@@ -708,6 +735,9 @@ DEFINE_BOOL(untrusted_code_mitigations, V8_DEFAULT_UNTRUSTED_CODE_MITIGATIONS,
 DEFINE_BOOL(wasm_generic_wrapper, false,
             "use generic js-to-wasm wrapper instead of per-signature wrappers")
 DEFINE_BOOL(expose_wasm, true, "expose wasm interface to JavaScript")
+DEFINE_BOOL(lazy_wasm_js_api, true,
+            "set up the wasm interface on first use rather than on context "
+            "creation")
 DEFINE_BOOL(assume_asmjs_origin, false,
             "force wasm decoder to assume input is internal asm-wasm format")
 DEFINE_INT(wasm_num_compilation_tasks, 128,
@@ -737,6 +767,11 @@ DEFINE_BOOL(wasm_tier_up, true,
             "have an effect)")
 DEFINE_BOOL(wasm_dynamic_tiering, false,
             "enable dynamic tier up to the optimizing compiler")
+DEFINE_INT(wasm_tier_up_call_count, 5,
+           "number of calls after which Liftoff code is tiered up with "
+           "--wasm-dynamic-tiering")
+DEFINE_BOOL(wasm_liftoff_profiling, false,
+            "count function entries and loop iterations in Liftoff code")
 DEFINE_DEBUG_BOOL(trace_wasm_decoder, false, "trace decoding of wasm code")
 DEFINE_DEBUG_BOOL(trace_wasm_compiler, false, "trace compiling of wasm code")
 DEFINE_DEBUG_BOOL(trace_wasm_interpreter, false,
@@ -800,6 +835,9 @@ DEFINE_BOOL(wasm_opt, false, "enable wasm optimization")
 DEFINE_BOOL(
     wasm_bounds_checks, true,
     "enable bounds checks (disable for performance testing only)")
+DEFINE_BOOL(wasm_eliminate_redundant_bounds_checks, true,
+            "skip explicit bounds checks of memory accesses that are dominated "
+            "by a check of the same index and a larger offset")
 DEFINE_BOOL(wasm_stack_checks, true,
             "enable stack checks (disable for performance testing only)")
 DEFINE_BOOL(wasm_math_intrinsics, true,
@@ -820,6 +858,12 @@ DEFINE_BOOL(wasm_lazy_compilation, false,
             "enable lazy compilation for all wasm modules")
 DEFINE_DEBUG_BOOL(trace_wasm_lazy_compilation, false,
                   "trace lazy compilation of wasm functions")
+DEFINE_BOOL(wasm_print_compilation_hints, false,
+            "print compilation hints derived from the functions that were "
+            "executed and tiered up when a wasm module dies (use with "
+            "--wasm-lazy-compilation and --wasm-dynamic-tiering)")
+DEFINE_BOOL(wasm_lazy_deserialization, false,
+            "deserialize cached wasm functions when they are first called")
 DEFINE_BOOL(wasm_lazy_validation, false,
             "enable lazy validation for lazily compiled wasm functions")
 
@@ -838,6 +882,8 @@ DEFINE_BOOL(wasm_code_gc, true, "enable garbage collection of wasm code")
 DEFINE_BOOL(trace_wasm_code_gc, false, "trace garbage collection of wasm code")
 DEFINE_BOOL(stress_wasm_code_gc, false,
             "stress test garbage collection of wasm code")
+DEFINE_BOOL(wasm_reuse_freed_code_space, true,
+            "allocate new wasm code in code space freed by code GC")
 DEFINE_INT(wasm_max_initial_code_space_reservation, 0,
            "maximum size of the initial wasm code space reservation (in MB)")
 
@@ -860,7 +906,16 @@ DEFINE_SIZE_T(max_semi_space_size, 0,
               "max size of a semi-space (in MBytes), the new space consists of "
               "two semi-spaces")
 DEFINE_INT(semi_space_growth_factor, 2, "factor by which to grow the new space")
+DEFINE_INT(scavenge_target_interval_ms, 0,
+           "grow the new space if scavenges happen more often than this based "
+           "on the new space allocation throughput (0 means disabled)")
+DEFINE_INT(scavenge_target_pause_ms, 1,
+           "do not grow the new space for --scavenge-target-interval-ms if the "
+           "estimated scavenge pause exceeds this limit")
 DEFINE_SIZE_T(max_old_space_size, 0, "max size of the old space (in Mbytes)")
+DEFINE_INT(max_number_string_cache_entries, 0x10000,
+           "upper bound for the number of entries in the number-string "
+           "cache, rounded down to a power of two")
 DEFINE_SIZE_T(
     max_heap_size, 0,
     "max size of the heap (in Mbytes) "
@@ -925,6 +980,9 @@ DEFINE_BOOL(incremental_marking, true, "use incremental marking")
 DEFINE_BOOL(incremental_marking_wrappers, true,
             "use incremental marking for marking wrappers")
 DEFINE_BOOL(incremental_marking_task, true, "use tasks for incremental marking")
+DEFINE_BOOL(incremental_marking_idle_task, true,
+            "use idle tasks for incremental marking if the platform supports "
+            "them")
 DEFINE_INT(incremental_marking_soft_trigger, 0,
            "threshold for starting incremental marking via a task in percent "
            "of available space: limit - size")
@@ -938,6 +996,9 @@ DEFINE_INT(scavenge_task_trigger, 80,
            "scavenge task trigger in percent of the current heap limit")
 DEFINE_BOOL(scavenge_separate_stack_scanning, false,
             "use a separate phase for stack scanning in scavenge")
+DEFINE_BOOL(scavenge_on_external_memory_pressure, false,
+            "try a scavenge before a full GC when most of the external memory "
+            "growth is held by young objects")
 DEFINE_BOOL(trace_parallel_scavenge, false, "trace parallel scavenge")
 DEFINE_BOOL(write_protect_code_memory, true, "write protect code memory")
 #ifdef V8_CONCURRENT_MARKING
@@ -957,6 +1018,9 @@ DEFINE_BOOL_READONLY(array_buffer_extension, V8_ARRAY_BUFFER_EXTENSION_BOOL,
 DEFINE_IMPLICATION(array_buffer_extension, always_promote_young_mc)
 DEFINE_BOOL(concurrent_array_buffer_sweeping, true,
             "concurrently sweep array buffers")
+DEFINE_BOOL(batch_array_buffer_free, true,
+            "return backing stores of dead array buffers to the embedder's "
+            "allocator in batches")
 DEFINE_BOOL(concurrent_allocation, false, "concurrently allocate in old space")
 DEFINE_BOOL(local_heaps, false, "allow heap access from background tasks")
 DEFINE_IMPLICATION(concurrent_inlining, local_heaps)
@@ -977,6 +1041,13 @@ DEFINE_BOOL(concurrent_sweeping, true, "use concurrent sweeping")
 DEFINE_BOOL(parallel_compaction, true, "use parallel compaction")
 DEFINE_BOOL(parallel_pointer_update, true,
             "use parallel pointer update during compaction")
+DEFINE_INT(compaction_pause_budget_ms, 0,
+           "limit the bytes selected for evacuation in latency critical mode "
+           "so that compaction is expected to take at most this many ms "
+           "(0 means no limit)")
+DEFINE_INT(large_page_pool_size, 0,
+           "maximum size of uncommitted large object pages kept for reuse by "
+           "allocations of the same size (in Mbytes)")
 DEFINE_BOOL(detect_ineffective_gcs_near_heap_limit, true,
             "trigger out-of-memory failure to avoid GC storm near heap limit")
 DEFINE_BOOL(trace_incremental_marking, false,
@@ -987,6 +1058,8 @@ DEFINE_BOOL(track_gc_object_stats, false,
             "track object counts and memory usage")
 DEFINE_BOOL(trace_gc_object_stats, false,
             "trace object counts and memory usage")
+DEFINE_INT(zone_segment_pool_size, 16,
+           "number of free zone segments kept for reuse per size class")
 DEFINE_BOOL(trace_zone_stats, false, "trace zone memory usage")
 DEFINE_GENERIC_IMPLICATION(
     trace_zone_stats,
@@ -1036,10 +1109,18 @@ DEFINE_BOOL(memory_reducer_for_small_heaps, true,
 DEFINE_INT(heap_growing_percent, 0,
            "specifies heap growing factor as (1 + heap_growing_percent/100)")
 DEFINE_INT(v8_os_page_size, 0, "override OS page size (in KBytes)")
+DEFINE_BOOL(track_young_survivors_by_type, false,
+            "track count and size of surviving young objects per instance type")
+DEFINE_BOOL(transparent_huge_pages, false,
+            "advise the OS to back the code range and the pointer compression "
+            "cage with huge pages")
 DEFINE_BOOL(always_compact, false, "Perform compaction on every full GC")
 DEFINE_BOOL(never_compact, false,
             "Never perform compaction on full GC - testing only")
 DEFINE_BOOL(compact_code_space, true, "Compact code space on full collections")
+DEFINE_INT(compact_code_space_min_free_percent, 0,
+           "only compact code space when at least this percentage of it is "
+           "free (0 means no minimum)")
 DEFINE_BOOL(flush_bytecode, true,
             "flush of bytecode when it has not been executed recently")
 DEFINE_BOOL(stress_flush_bytecode, false, "stress bytecode flushing")
@@ -1205,6 +1286,10 @@ DEFINE_BOOL(trace_wasm, false, "trace wasm function calls")
 DEFINE_BOOL(lazy, true, "use lazy compilation")
 DEFINE_BOOL(max_lazy, false, "ignore eager compilation hints")
 DEFINE_IMPLICATION(max_lazy, lazy)
+DEFINE_BOOL(compile_hints_magic, true,
+            "eagerly compile all functions that follow an "
+            "//# allFunctionsCalledOnLoad magic comment")
+DEFINE_NEG_IMPLICATION(max_lazy, compile_hints_magic)
 DEFINE_BOOL(trace_opt, false, "trace lazy optimization")
 DEFINE_BOOL(trace_opt_verbose, false, "extra verbose compilation tracing")
 DEFINE_IMPLICATION(trace_opt_verbose, trace_opt)
@@ -1224,6 +1309,9 @@ DEFINE_BOOL(external_reference_stats, false,
 
 // compilation-cache.cc
 DEFINE_BOOL(compilation_cache, true, "enable compilation cache")
+DEFINE_INT(compilation_cache_eval_retained_entries, 0,
+           "number of eval cache entries that are kept across GCs even if "
+           "their bytecode is old, unless the heap optimizes for memory")
 
 DEFINE_BOOL(cache_prototype_transitions, true, "cache prototype transitions")
 
@@ -1252,6 +1340,11 @@ DEFINE_BOOL(expose_inspector_scripts, false,
 DEFINE_INT(stack_size, V8_DEFAULT_STACK_SIZE_KB,
            "default size of stack region v8 is allowed to use (in kBytes)")
 
+// v8threads.cc
+DEFINE_BOOL(lightweight_thread_migration, true,
+            "release idle threads in v8::Unlocker without archiving their "
+            "state and keep thread resources across v8::Locker hand-offs")
+
 // frames.cc
 DEFINE_INT(max_stack_trace_source_length, 300,
            "maximum length of function source code printed in a stack trace.")
@@ -1263,6 +1356,9 @@ DEFINE_BOOL(clear_exceptions_on_js_entry, false,
 // counters.cc
 DEFINE_INT(histogram_interval, 600000,
            "time interval in ms for aggregating memory histograms")
+DEFINE_BOOL(account_isolate_cpu_time, false,
+            "account the CPU time of threads that entered an isolate and of "
+            "background tasks that run on its behalf")
 
 // heap-snapshot-generator.cc
 DEFINE_BOOL(heap_profiler_trace_objects, false,
@@ -1275,6 +1371,13 @@ DEFINE_INT(heap_snapshot_string_limit, 1024,
 // sampling-heap-profiler.cc
 DEFINE_BOOL(sampling_heap_profiler_suppress_randomness, false,
             "Use constant sample intervals to eliminate test flakiness")
+DEFINE_BOOL(trace_sampling_heap_growth, false,
+            "print allocation stacks of the sampling heap profiler whose "
+            "retained size keeps growing across full GCs (requires "
+            "kSamplingTrackRetainedGrowth)")
+DEFINE_INT(sampling_heap_growth_gcs, 3,
+           "number of consecutive growing full GCs after which an allocation "
+           "stack is reported by --trace-sampling-heap-growth")
 
 // v8.cc
 DEFINE_BOOL(use_idle_notification, true,
@@ -1340,6 +1443,9 @@ DEFINE_BOOL(trace_sim_messages, false,
 // isolate.cc
 DEFINE_BOOL(async_stack_traces, true,
             "include async stack traces in Error.stack")
+DEFINE_BOOL(dynamic_import_fast_path, false,
+            "resolve import() of an evaluated static dependency of the "
+            "importing module without calling the embedder")
 DEFINE_BOOL(stack_trace_on_illegal, false,
             "print stack trace when an illegal exception is thrown")
 DEFINE_BOOL(abort_on_uncaught_exception, false,
@@ -1386,10 +1492,26 @@ DEFINE_IMPLICATION(rcs, runtime_call_stats)
 DEFINE_BOOL(rcs_cpu_time, false,
             "report runtime times in cpu time (the default is wall time)")
 DEFINE_IMPLICATION(rcs_cpu_time, rcs)
+DEFINE_INT(runtime_call_stats_sampling_interval, 0,
+           "average interval in ms between windows in which runtime call "
+           "stats are collected and reported to the metrics recorder "
+           "(0 disables sampling)")
+DEFINE_INT(runtime_call_stats_sampling_window, 10,
+           "length in ms of the runtime call stats sampling windows")
 
 // snapshot-common.cc
+DEFINE_INT(code_cache_trim_bytecode_age, 0,
+           "serialize functions whose bytecode reached this age as "
+           "uncompiled into code caches (0 means never)")
 DEFINE_BOOL(profile_deserialization, false,
             "Print the time it takes to deserialize the snapshot.")
+DEFINE_BOOL(trace_startup, false,
+            "Print the time spent in the phases of isolate and context "
+            "creation.")
+DEFINE_BOOL(cache_snapshot_checksum, true,
+            "Verify the checksum of a snapshot blob only once per process.")
+DEFINE_BOOL(parallel_snapshot_decompression, true,
+            "Decompress the read-only and startup snapshots in parallel.")
 DEFINE_BOOL(serialization_statistics, false,
             "Collect statistics on serialized objects.")
 #ifdef V8_ENABLE_THIRD_PARTY_HEAP
@@ -1414,6 +1536,13 @@ DEFINE_BOOL(regexp_tier_up, true,
 DEFINE_INT(regexp_tier_up_ticks, 1,
            "set the number of executions for the regexp interpreter before "
            "tiering-up to the compiler")
+DEFINE_BOOL(regexp_tier_up_in_task, false,
+            "defer regexp tier-up compilation to a task and keep interpreting "
+            "the regexp until the native code is installed")
+DEFINE_IMPLICATION(regexp_tier_up_in_task, regexp_tier_up)
+DEFINE_BOOL(regexp_simd, true,
+            "use SIMD instructions to scan for the first characters of "
+            "unanchored regexps in native code")
 DEFINE_BOOL(regexp_peephole_optimization, REGEXP_PEEPHOLE_OPTIMIZATION_BOOL,
             "enable peephole optimization for regexp bytecode")
 DEFINE_BOOL(trace_regexp_peephole_optimization, false,
@@ -1424,6 +1553,19 @@ DEFINE_BOOL(trace_regexp_assembler, false,
 DEFINE_BOOL(trace_regexp_parser, false, "trace regexp parsing")
 DEFINE_BOOL(trace_regexp_tier_up, false, "trace regexp tiering up execution")
 
+DEFINE_BOOL(enable_experimental_regexp_engine, false,
+            "compile regexps without back references and lookarounds with "
+            "the linear-time experimental engine")
+DEFINE_BOOL(enable_experimental_regexp_engine_on_excessive_backtracks, false,
+            "fall back to the experimental engine once a regexp exceeds its "
+            "backtrack limit (which is capped by "
+            "--regexp-backtracks-before-fallback)")
+DEFINE_UINT(regexp_backtracks_before_fallback, 50000,
+            "number of backtracks during regexp execution before falling "
+            "back to the experimental engine")
+DEFINE_BOOL(trace_experimental_regexp_engine, false,
+            "print the bytecode compiled by the experimental regexp engine")
+
 // Testing flags test/cctest/test-{flags,api,serialization}.cc
 DEFINE_BOOL(testing_bool_flag, true, "testing_bool_flag")
 DEFINE_MAYBE_BOOL(testing_maybe_bool_flag, "testing_maybe_bool_flag")
@@ -1463,6 +1605,9 @@ DEFINE_BOOL(target_is_simulator, false,
 DEFINE_STRING(turbo_profiling_log_file, nullptr,
               "Path of the input file containing basic block counters for "
               "builtins. (mksnapshot only)")
+DEFINE_BOOL(reorder_builtins, true,
+            "Lay out builtins in the embedded blob by decreasing hotness, "
+            "based on --turbo-profiling-log-file. (mksnapshot only)")
 
 //
 // Minor mark compact collector flags.
@@ -1473,6 +1618,9 @@ DEFINE_BOOL(minor_mc_parallel_marking, true,
 DEFINE_BOOL(trace_minor_mc_parallel_marking, false,
             "trace parallel marking for the young generation")
 DEFINE_BOOL(minor_mc, false, "perform young generation mark compact GCs")
+DEFINE_BOOL(minor_mc_high_survival_promotion, true,
+            "promote dense young generation pages regardless of the age mark "
+            "on high survival rates")
 #else
 DEFINE_BOOL_READONLY(minor_mc, false,
                      "perform young generation mark compact GCs")
@@ -1668,7 +1816,6 @@ DEFINE_PERF_PROF_BOOL(
 DEFINE_PERF_PROF_BOOL(
     perf_prof_delete_file,
     "Remove the perf file right after creating it (for testing only).")
-DEFINE_NEG_IMPLICATION(perf_prof, compact_code_space)
 // TODO(v8:8462) Remove implication once perf supports remapping.
 DEFINE_NEG_IMPLICATION(perf_prof, write_protect_code_memory)
 DEFINE_NEG_IMPLICATION(perf_prof, wasm_write_protect_code_memory)
@@ -5,6 +5,7 @@
 #include "src/heap/array-buffer-sweeper.h"
 #include "src/heap/gc-tracer.h"
 #include "src/heap/heap-inl.h"
+#include "src/objects/backing-store.h"
 #include "src/objects/js-array-buffer.h"
 #include "src/tasks/cancelable-task.h"
 #include "src/tasks/task-utils.h"
@@ -153,7 +154,7 @@ void ArrayBufferSweeper::RequestSweep(SweepingScope scope) {
       job_finished_.NotifyAll();
     });
     job_.id = task->id();
-    V8::GetCurrentPlatform()->CallOnWorkerThread(std::move(task));
+    heap_->isolate()->PostBackgroundTask(std::move(task));
     sweeping_in_progress_ = true;
   } else {
     Prepare(scope);
@@ -253,6 +254,7 @@ void ArrayBufferSweeper::Sweep() {
     CHECK_EQ(job_.scope, SweepingScope::Full);
     SweepFull();
   }
+  FlushBatchedBackingStores();
   job_.state = SweepingState::Swept;
 }
 
@@ -274,7 +276,7 @@ ArrayBufferList ArrayBufferSweeper::SweepListFull(ArrayBufferList* list) {
 
     if (!current->IsMarked()) {
       size_t bytes = current->accounting_length();
-      delete current;
+      FreeExtension(current);
       IncrementFreedBytes(bytes);
     } else {
       current->Unmark();
@@ -300,7 +302,7 @@ void ArrayBufferSweeper::SweepYoung() {
 
     if (!current->IsYoungMarked()) {
       size_t bytes = current->accounting_length();
-      delete current;
+      FreeExtension(current);
       IncrementFreedBytes(bytes);
     } else if (current->IsYoungPromoted()) {
       current->YoungUnmark();
@@ -317,6 +319,31 @@ void ArrayBufferSweeper::SweepYoung() {
   job_.young = new_young;
 }
 
+void ArrayBufferSweeper::FreeExtension(ArrayBufferExtension* extension) {
+  if (FLAG_batch_array_buffer_free) {
+    std::shared_ptr<BackingStore> backing_store =
+        extension->RemoveBackingStore();
+    void* data;
+    size_t length;
+    if (backing_store && backing_store.use_count() == 1 &&
+        backing_store->ReleaseToAllocatorBatch(
+            heap_->isolate()->array_buffer_allocator(), &data, &length)) {
+      batched_data_.push_back(data);
+      batched_lengths_.push_back(length);
+    }
+  }
+  delete extension;
+}
+
+void ArrayBufferSweeper::FlushBatchedBackingStores() {
+  DCHECK_EQ(batched_data_.size(), batched_lengths_.size());
+  if (batched_data_.empty()) return;
+  heap_->isolate()->array_buffer_allocator()->FreeBatch(
+      batched_data_.data(), batched_lengths_.data(), batched_data_.size());
+  batched_data_.clear();
+  batched_lengths_.clear();
+}
+
 void ArrayBufferSweeper::IncrementFreedBytes(size_t bytes) {
   if (bytes == 0) return;
   freed_bytes_.fetch_add(bytes);
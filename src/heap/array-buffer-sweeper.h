@@ -5,6 +5,8 @@
 #ifndef V8_HEAP_ARRAY_BUFFER_SWEEPER_H_
 #define V8_HEAP_ARRAY_BUFFER_SWEEPER_H_
 
+#include <vector>
+
 #include "src/base/platform/mutex.h"
 #include "src/objects/js-array-buffer.h"
 #include "src/tasks/cancelable-task.h"
@@ -91,6 +93,12 @@ class ArrayBufferSweeper {
   void IncrementExternalMemoryCounters(size_t bytes);
   void IncrementFreedBytes(size_t bytes);
 
+  // Deletes a dead extension. Backing stores that are owned only by this
+  // extension are queued for FlushBatchedBackingStores when batching is
+  // enabled.
+  void FreeExtension(ArrayBufferExtension* extension);
+  void FlushBatchedBackingStores();
+
   void RequestSweep(SweepingScope sweeping_task);
   void Prepare(SweepingScope sweeping_task);
 
@@ -116,6 +124,11 @@ class ArrayBufferSweeper {
 
   size_t young_bytes_;
   size_t old_bytes_;
+
+  // Memory of dead backing stores waiting to be returned to the array buffer
+  // allocator. Only accessed while sweeping.
+  std::vector<void*> batched_data_;
+  std::vector<size_t> batched_lengths_;
 };
 
 }  // namespace internal
@@ -389,7 +389,7 @@ void ConcurrentMarking::Run(int task_id, TaskState* task_state) {
   MarkingWorklists marking_worklists(task_id, marking_worklists_holder_);
   ConcurrentMarkingVisitor visitor(
       task_id, &marking_worklists, weak_objects_, heap_,
-      task_state->mark_compact_epoch, Heap::GetBytecodeFlushMode(),
+      task_state->mark_compact_epoch, task_state->bytecode_flush_mode,
       heap_->local_embedder_heap_tracer()->InUse(), task_state->is_forced_gc,
       &task_state->memory_chunk_data);
   NativeContextInferrer& native_context_inferrer =
@@ -403,6 +403,9 @@ void ConcurrentMarking::Run(int task_id, TaskState* task_state) {
                                 task_id);
   }
   bool ephemeron_marked = false;
+  MarkingWorklist* shared = marking_worklists_holder_->shared();
+  size_t stolen_segments = shared->StolenSegments(task_id);
+  size_t published_segments = shared->PublishedSegments(task_id);
 
   {
     TimedScope scope(&time_ms);
@@ -474,6 +477,9 @@ void ConcurrentMarking::Run(int task_id, TaskState* task_state) {
     }
 
     marking_worklists.FlushToGlobal();
+    stolen_segments = shared->StolenSegments(task_id) - stolen_segments;
+    published_segments =
+        shared->PublishedSegments(task_id) - published_segments;
     weak_objects_->transition_arrays.FlushToGlobal(task_id);
     weak_objects_->ephemeron_hash_tables.FlushToGlobal(task_id);
     weak_objects_->current_ephemerons.FlushToGlobal(task_id);
@@ -501,8 +507,10 @@ void ConcurrentMarking::Run(int task_id, TaskState* task_state) {
   }
   if (FLAG_trace_concurrent_marking) {
     heap_->isolate()->PrintWithTimestamp(
-        "Task %d concurrently marked %dKB in %.2fms\n", task_id,
-        static_cast<int>(marked_bytes / KB), time_ms);
+        "Task %d concurrently marked %dKB in %.2fms "
+        "(stolen segments: %zu, published segments: %zu)\n",
+        task_id, static_cast<int>(marked_bytes / KB), time_ms,
+        stolen_segments, published_segments);
   }
 }
 
@@ -543,12 +551,14 @@ void ConcurrentMarking::ScheduleTasks() {
       task_state_[i].mark_compact_epoch =
           heap_->mark_compact_collector()->epoch();
       task_state_[i].is_forced_gc = heap_->is_current_gc_forced();
+      task_state_[i].bytecode_flush_mode =
+          Heap::GetBytecodeFlushMode(heap_->ShouldReduceMemory());
       is_pending_[i] = true;
       ++pending_task_count_;
       auto task =
           std::make_unique<Task>(heap_->isolate(), this, &task_state_[i], i);
       cancelable_id_[i] = task->id();
-      V8::GetCurrentPlatform()->CallOnWorkerThread(std::move(task));
+      heap_->isolate()->PostBackgroundTask(std::move(task));
     }
   }
   DCHECK_EQ(total_task_count_, pending_task_count_);
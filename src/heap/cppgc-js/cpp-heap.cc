@@ -107,6 +107,17 @@ CppHeap::CppHeap(v8::Isolate* isolate, size_t custom_spaces)
                                 custom_spaces),
       isolate_(*reinterpret_cast<Isolate*>(isolate)) {
   CHECK(!FLAG_incremental_marking_wrappers);
+  stats_collector()->RegisterObserver(this);
+}
+
+CppHeap::~CppHeap() { stats_collector()->UnregisterObserver(this); }
+
+void CppHeap::AllocatedObjectSizeIncreased(size_t bytes) {
+  IncreaseAllocatedSize(bytes);
+}
+
+void CppHeap::AllocatedObjectSizeDecreased(size_t bytes) {
+  DecreaseAllocatedSize(bytes);
 }
 
 void CppHeap::RegisterV8References(
@@ -149,6 +160,9 @@ void CppHeap::EnterFinalPause(EmbedderStackState stack_state) {
 void CppHeap::TraceEpilogue(TraceSummary* trace_summary) {
   CHECK(marking_done_);
   marker_->LeaveAtomicPause();
+  // Marked bytes are the exact live size of the C++ heap. V8 resets its view
+  // of embedder memory to this value.
+  trace_summary->allocated_size = stats_collector()->allocated_object_size();
   {
     // Pre finalizers are forbidden from allocating objects
     cppgc::internal::ObjectAllocator::NoAllocationScope no_allocation_scope_(
@@ -163,7 +177,15 @@ void CppHeap::TraceEpilogue(TraceSummary* trace_summary) {
 #endif
   {
     NoGCScope no_gc(*this);
-    sweeper().Start(cppgc::internal::Sweeper::Config::kAtomic);
+    using FreeMemoryHandling = cppgc::internal::Sweeper::FreeMemoryHandling;
+    // Memory reducing GCs additionally return free memory of fragmented pages
+    // to the OS.
+    const FreeMemoryHandling free_memory_handling =
+        isolate_.heap()->ShouldReduceMemory()
+            ? FreeMemoryHandling::kDiscardWherePossible
+            : FreeMemoryHandling::kDoNotDiscard;
+    sweeper().Start(cppgc::internal::Sweeper::Config::kAtomic,
+                    free_memory_handling);
   }
 }
 
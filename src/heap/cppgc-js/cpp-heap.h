@@ -8,6 +8,7 @@
 #include "include/v8.h"
 #include "src/base/macros.h"
 #include "src/heap/cppgc/heap-base.h"
+#include "src/heap/cppgc/stats-collector.h"
 
 namespace v8 {
 
@@ -16,10 +17,17 @@ class Isolate;
 namespace internal {
 
 // A C++ heap implementation used with V8 to implement unified heap.
-class V8_EXPORT_PRIVATE CppHeap final : public cppgc::internal::HeapBase,
-                                        public v8::EmbedderHeapTracer {
+//
+// Allocated object size is forwarded to V8 through the EmbedderHeapTracer
+// accounting, so that V8's global allocation limits and GC heuristics take
+// memory held by the C++ heap into account.
+class V8_EXPORT_PRIVATE CppHeap final
+    : public cppgc::internal::HeapBase,
+      public v8::EmbedderHeapTracer,
+      public cppgc::internal::StatsCollector::AllocationObserver {
  public:
   CppHeap(v8::Isolate* isolate, size_t custom_spaces);
+  ~CppHeap() final;
 
   HeapBase& AsBase() { return *this; }
   const HeapBase& AsBase() const { return *this; }
@@ -32,6 +40,11 @@ class V8_EXPORT_PRIVATE CppHeap final : public cppgc::internal::HeapBase,
   void TraceEpilogue(TraceSummary* trace_summary) final;
   void EnterFinalPause(EmbedderStackState stack_state) final;
 
+  // StatsCollector::AllocationObserver interface.
+  void AllocatedObjectSizeIncreased(size_t) final;
+  void AllocatedObjectSizeDecreased(size_t) final;
+  void ResetAllocatedObjectSize(size_t) final {}
+
  private:
   Isolate& isolate_;
   bool marking_done_ = false;
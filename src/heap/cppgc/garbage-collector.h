@@ -20,6 +20,7 @@ class GarbageCollector {
     using StackState = cppgc::Heap::StackState;
     using MarkingType = Marker::MarkingConfig::MarkingType;
     using SweepingType = Sweeper::Config;
+    using FreeMemoryHandling = Sweeper::FreeMemoryHandling;
 
     static constexpr Config ConservativeAtomicConfig() {
       return {CollectionType::kMajor, StackState::kMayContainHeapPointers,
@@ -40,6 +41,8 @@ class GarbageCollector {
     StackState stack_state = StackState::kMayContainHeapPointers;
     MarkingType marking_type = MarkingType::kAtomic;
     SweepingType sweeping_type = SweepingType::kAtomic;
+    FreeMemoryHandling free_memory_handling =
+        FreeMemoryHandling::kDoNotDiscard;
   };
 
   // Executes a garbage collection specified in config.
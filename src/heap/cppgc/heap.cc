@@ -119,7 +119,7 @@ void Heap::CollectGarbage(Config config) {
 #endif
   {
     NoGCScope no_gc(*this);
-    sweeper_.Start(config.sweeping_type);
+    sweeper_.Start(config.sweeping_type, config.free_memory_handling);
   }
 }
 
@@ -6,6 +6,7 @@
 
 #include <memory>
 
+#include "include/cppgc/internal/pointer-policies.h"
 #include "include/cppgc/internal/process-heap.h"
 #include "src/heap/cppgc/heap-object-header.h"
 #include "src/heap/cppgc/heap-page.h"
@@ -60,10 +61,14 @@ void VisitRememberedSlots(HeapBase& heap, MarkingState& marking_state) {
     // top level (with the guarantee that no objects are currently being in
     // construction). This can be ensured by running young GCs from safe points
     // or by reintroducing nested allocation scopes that avoid finalization.
-    DCHECK(
-        !header.IsInConstruction<HeapObjectHeader::AccessMode::kNonAtomic>());
+    DCHECK(!slot_header
+                .IsInConstruction<HeapObjectHeader::AccessMode::kNonAtomic>());
 
     void* value = *reinterpret_cast<void**>(slot);
+    // The slot may have been cleared after it was recorded. Clearing a Member
+    // does not emit a barrier, so the set may contain slots that no longer
+    // point into the young generation.
+    if (!value || value == static_cast<void*>(kSentinelPointer)) continue;
     marking_state.DynamicallyMarkAddress(static_cast<Address>(value));
   }
 #endif
@@ -100,8 +105,36 @@ bool DrainWorklistWithDeadline(v8::base::TimeTicks deadline, Worklist* worklist,
 
 }  // namespace
 
+constexpr v8::base::TimeDelta MarkerBase::kMaximumIncrementalStepDuration;
+
+MarkerBase::IncrementalMarkingTask::IncrementalMarkingTask(MarkerBase* marker)
+    : marker_(marker), handle_(Handle::NonEmptyTag{}) {}
+
+// static
+MarkerBase::IncrementalMarkingTask::Handle
+MarkerBase::IncrementalMarkingTask::Post(v8::TaskRunner* runner,
+                                         MarkerBase* marker) {
+  auto task = std::make_unique<IncrementalMarkingTask>(marker);
+  auto handle = task->handle_;
+  runner->PostTask(std::move(task));
+  return handle;
+}
+
+void MarkerBase::IncrementalMarkingTask::Run() {
+  if (handle_.IsCanceled()) return;
+
+  // Tasks run from the event loop and thus never see heap pointers on the
+  // stack, so marking can progress without scanning it.
+  if (!marker_->AdvanceMarkingWithDeadline(kMaximumIncrementalStepDuration)) {
+    marker_->ScheduleIncrementalMarkingTask();
+  }
+}
+
 MarkerBase::MarkerBase(HeapBase& heap)
     : heap_(heap),
+      foreground_task_runner_(heap.platform()
+                                  ? heap.platform()->GetForegroundTaskRunner()
+                                  : nullptr),
       mutator_marking_state_(
           heap, marking_worklists_.marking_worklist(),
           marking_worklists_.not_fully_constructed_worklist(),
@@ -109,6 +142,7 @@ MarkerBase::MarkerBase(HeapBase& heap)
           MarkingWorklists::kMutatorThreadId) {}
 
 MarkerBase::~MarkerBase() {
+  if (incremental_marking_handle_) incremental_marking_handle_.Cancel();
   // The fixed point iteration may have found not-fully-constructed objects.
   // Such objects should have already been found through the stack scan though
   // and should thus already be marked.
@@ -137,9 +171,13 @@ void MarkerBase::StartMarking(MarkingConfig config) {
   config_ = config;
   VisitRoots();
   EnterIncrementalMarkingIfNeeded(config, heap());
+  if (config.marking_type != MarkingConfig::MarkingType::kAtomic) {
+    ScheduleIncrementalMarkingTask();
+  }
 }
 
 void MarkerBase::EnterAtomicPause(MarkingConfig config) {
+  if (incremental_marking_handle_) incremental_marking_handle_.Cancel();
   ExitIncrementalMarkingIfNeeded(config_, heap());
   config_ = config;
 
@@ -253,6 +291,12 @@ void MarkerBase::MarkNotFullyConstructedObjects() {
   }
 }
 
+void MarkerBase::ScheduleIncrementalMarkingTask() {
+  if (!foreground_task_runner_) return;
+  incremental_marking_handle_ =
+      IncrementalMarkingTask::Post(foreground_task_runner_.get(), this);
+}
+
 void MarkerBase::ClearAllWorklistsForTesting() {
   marking_worklists_.ClearForTesting();
 }
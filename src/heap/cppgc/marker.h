@@ -8,6 +8,7 @@
 #include <memory>
 
 #include "include/cppgc/heap.h"
+#include "include/cppgc/platform.h"
 #include "include/cppgc/visitor.h"
 #include "src/base/macros.h"
 #include "src/base/platform/time.h"
@@ -15,6 +16,7 @@
 #include "src/heap/cppgc/marking-state.h"
 #include "src/heap/cppgc/marking-visitor.h"
 #include "src/heap/cppgc/marking-worklists.h"
+#include "src/heap/cppgc/task-handle.h"
 #include "src/heap/cppgc/worklist.h"
 
 namespace cppgc {
@@ -93,6 +95,27 @@ class V8_EXPORT_PRIVATE MarkerBase {
   void ClearAllWorklistsForTesting();
 
  protected:
+  // Duration of a single marking step performed by an incremental marking
+  // task.
+  static constexpr v8::base::TimeDelta kMaximumIncrementalStepDuration =
+      v8::base::TimeDelta::FromMilliseconds(2);
+
+  class IncrementalMarkingTask final : public v8::Task {
+   public:
+    using Handle = SingleThreadedHandle;
+
+    explicit IncrementalMarkingTask(MarkerBase*);
+
+    static Handle Post(v8::TaskRunner*, MarkerBase*);
+
+   private:
+    void Run() final;
+
+    MarkerBase* const marker_;
+    // TODO(chromium:1056170): Change to CancelableTask.
+    Handle handle_;
+  };
+
   explicit MarkerBase(HeapBase& heap);
 
   virtual cppgc::Visitor& visitor() = 0;
@@ -103,9 +126,14 @@ class V8_EXPORT_PRIVATE MarkerBase {
 
   void MarkNotFullyConstructedObjects();
 
+  void ScheduleIncrementalMarkingTask();
+
   HeapBase& heap_;
   MarkingConfig config_ = MarkingConfig::Default();
 
+  std::shared_ptr<v8::TaskRunner> foreground_task_runner_;
+  IncrementalMarkingTask::Handle incremental_marking_handle_;
+
   MarkingWorklists marking_worklists_;
   MarkingState mutator_marking_state_;
 };
@@ -133,10 +133,15 @@ void* ObjectAllocator::OutOfLineAllocateImpl(NormalPageSpace* space,
 
   // 3. Lazily sweep pages of this heap until we find a freed area for
   // this allocation or we finish sweeping all pages of this heap.
-  // TODO(chromium:1056170): Add lazy sweep.
+  Sweeper& sweeper = raw_heap_->heap()->sweeper();
+  while (sweeper.SweepPageForAllocationIfRunning(space)) {
+    if (void* result = AllocateFromFreeList(space, size, gcinfo)) {
+      return result;
+    }
+  }
 
   // 4. Complete sweeping.
-  raw_heap_->heap()->sweeper().Finish();
+  sweeper.Finish();
 
   // 5. Add a new page to this heap.
   auto* new_page = NormalPage::Create(page_backend_, space);
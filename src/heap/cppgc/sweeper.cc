@@ -111,6 +111,23 @@ struct SpaceState {
 
 using SpaceStates = std::vector<SpaceState>;
 
+// Discards the system pages that are fully covered by the free list entry
+// [start, start + size), keeping the entry's header intact.
+void DiscardFreeMemory(PageAllocator* page_allocator, Address start,
+                       size_t size) {
+  if (!page_allocator) return;
+  const size_t page_size = page_allocator->CommitPageSize();
+  const uintptr_t discard_begin =
+      RoundUp(reinterpret_cast<uintptr_t>(start) + kFreeListEntrySize,
+              page_size);
+  const uintptr_t discard_end =
+      RoundDown(reinterpret_cast<uintptr_t>(start) + size, page_size);
+  if (discard_begin < discard_end) {
+    page_allocator->DiscardSystemPages(reinterpret_cast<void*>(discard_begin),
+                                       discard_end - discard_begin);
+  }
+}
+
 void StickyUnmark(HeapObjectHeader* header) {
   // Young generation in Oilpan uses sticky mark bits.
 #if !defined(CPPGC_YOUNG_GENERATION)
@@ -123,7 +140,8 @@ class InlinedFinalizationBuilder final {
  public:
   using ResultType = bool;
 
-  explicit InlinedFinalizationBuilder(BasePage* page) : page_(page) {}
+  InlinedFinalizationBuilder(BasePage* page, PageAllocator* discard_allocator)
+      : page_(page), discard_allocator_(discard_allocator) {}
 
   void AddFinalizer(HeapObjectHeader* header, size_t size) {
     header->Finalize();
@@ -133,12 +151,14 @@ class InlinedFinalizationBuilder final {
   void AddFreeListEntry(Address start, size_t size) {
     auto* space = NormalPageSpace::From(page_->space());
     space->free_list().Add({start, size});
+    DiscardFreeMemory(discard_allocator_, start, size);
   }
 
   ResultType GetResult(bool is_empty) { return is_empty; }
 
  private:
   BasePage* page_;
+  PageAllocator* discard_allocator_;
 };
 
 // Builder that produces results for deferred processing.
@@ -146,7 +166,10 @@ class DeferredFinalizationBuilder final {
  public:
   using ResultType = SpaceState::SweptPageState;
 
-  explicit DeferredFinalizationBuilder(BasePage* page) { result_.page = page; }
+  DeferredFinalizationBuilder(BasePage* page, PageAllocator* discard_allocator)
+      : discard_allocator_(discard_allocator) {
+    result_.page = page;
+  }
 
   void AddFinalizer(HeapObjectHeader* header, size_t size) {
     if (header->IsFinalizable()) {
@@ -159,9 +182,11 @@ class DeferredFinalizationBuilder final {
 
   void AddFreeListEntry(Address start, size_t size) {
     if (found_finalizer_) {
+      // The range still holds objects whose finalizers have not run yet.
       result_.unfinalized_free_list.push_back({start, size});
     } else {
       result_.cached_free_list.Add({start, size});
+      DiscardFreeMemory(discard_allocator_, start, size);
     }
     found_finalizer_ = false;
   }
@@ -173,13 +198,15 @@ class DeferredFinalizationBuilder final {
 
  private:
   ResultType result_;
+  PageAllocator* discard_allocator_;
   bool found_finalizer_ = false;
 };
 
 template <typename FinalizationBuilder>
-typename FinalizationBuilder::ResultType SweepNormalPage(NormalPage* page) {
+typename FinalizationBuilder::ResultType SweepNormalPage(
+    NormalPage* page, PageAllocator* discard_allocator) {
   constexpr auto kAtomicAccess = HeapObjectHeader::AccessMode::kAtomic;
-  FinalizationBuilder builder(page);
+  FinalizationBuilder builder(page, discard_allocator);
 
   PlatformAwareObjectStartBitmap& bitmap = page->object_start_bitmap();
   bitmap.Clear();
@@ -306,8 +333,11 @@ class MutatorThreadSweeper final : private HeapVisitor<MutatorThreadSweeper> {
   friend class HeapVisitor<MutatorThreadSweeper>;
 
  public:
-  explicit MutatorThreadSweeper(SpaceStates* states, cppgc::Platform* platform)
-      : states_(states), platform_(platform) {}
+  MutatorThreadSweeper(SpaceStates* states, cppgc::Platform* platform,
+                       PageAllocator* discard_allocator)
+      : states_(states),
+        platform_(platform),
+        discard_allocator_(discard_allocator) {}
 
   void Sweep() {
     for (SpaceState& state : *states_) {
@@ -317,6 +347,8 @@ class MutatorThreadSweeper final : private HeapVisitor<MutatorThreadSweeper> {
     }
   }
 
+  void SweepPage(BasePage* page) { Traverse(page); }
+
   bool SweepWithDeadline(double deadline_in_seconds) {
     DCHECK(platform_);
     static constexpr double kSlackInSeconds = 0.001;
@@ -359,7 +391,8 @@ class MutatorThreadSweeper final : private HeapVisitor<MutatorThreadSweeper> {
   }
 
   bool VisitNormalPage(NormalPage* page) {
-    const bool is_empty = SweepNormalPage<InlinedFinalizationBuilder>(page);
+    const bool is_empty = SweepNormalPage<InlinedFinalizationBuilder>(
+        page, discard_allocator_);
     if (is_empty) {
       NormalPage::Destroy(page);
     } else {
@@ -382,6 +415,7 @@ class MutatorThreadSweeper final : private HeapVisitor<MutatorThreadSweeper> {
 
   SpaceStates* states_;
   cppgc::Platform* platform_;
+  PageAllocator* discard_allocator_;
 };
 
 class ConcurrentSweepTask final : public v8::JobTask,
@@ -389,7 +423,8 @@ class ConcurrentSweepTask final : public v8::JobTask,
   friend class HeapVisitor<ConcurrentSweepTask>;
 
  public:
-  explicit ConcurrentSweepTask(SpaceStates* states) : states_(states) {}
+  ConcurrentSweepTask(SpaceStates* states, PageAllocator* discard_allocator)
+      : states_(states), discard_allocator_(discard_allocator) {}
 
   void Run(v8::JobDelegate* delegate) final {
     for (SpaceState& state : *states_) {
@@ -408,7 +443,7 @@ class ConcurrentSweepTask final : public v8::JobTask,
  private:
   bool VisitNormalPage(NormalPage* page) {
     SpaceState::SweptPageState sweep_result =
-        SweepNormalPage<DeferredFinalizationBuilder>(page);
+        SweepNormalPage<DeferredFinalizationBuilder>(page, discard_allocator_);
     const size_t space_index = page->space()->index();
     DCHECK_GT(states_->size(), space_index);
     SpaceState& space_state = (*states_)[space_index];
@@ -436,6 +471,7 @@ class ConcurrentSweepTask final : public v8::JobTask,
   }
 
   SpaceStates* states_;
+  PageAllocator* discard_allocator_;
   std::atomic_bool is_completed_{false};
 };
 
@@ -483,8 +519,13 @@ class Sweeper::SweeperImpl final {
 
   ~SweeperImpl() { CancelSweepers(); }
 
-  void Start(Config config) {
+  void Start(Config config, FreeMemoryHandling free_memory_handling) {
     is_in_progress_ = true;
+    discard_allocator_ =
+        (platform_ &&
+         free_memory_handling == FreeMemoryHandling::kDiscardWherePossible)
+            ? platform_->GetPageAllocator()
+            : nullptr;
 #if DEBUG
     ObjectStartBitmapVerifier().Verify(heap_);
 #endif
@@ -499,6 +540,26 @@ class Sweeper::SweeperImpl final {
     }
   }
 
+  bool SweepPageForAllocationIfRunning(NormalPageSpace* space) {
+    if (!is_in_progress_) return false;
+
+    SpaceState& space_state = space_states_[space->index()];
+    // Prefer pages that were already swept concurrently as they only need
+    // finalization.
+    if (auto page_state = space_state.swept_unfinalized_pages.Pop()) {
+      SweepFinalizer finalizer(platform_);
+      finalizer.FinalizePage(&*page_state);
+      return true;
+    }
+    if (auto page = space_state.unswept_pages.Pop()) {
+      MutatorThreadSweeper sweeper(&space_states_, platform_,
+                                   discard_allocator_);
+      sweeper.SweepPage(*page);
+      return true;
+    }
+    return false;
+  }
+
   void Finish() {
     if (!is_in_progress_) return;
 
@@ -507,7 +568,7 @@ class Sweeper::SweeperImpl final {
     finalizer.FinalizeHeap(&space_states_);
 
     // Then, help out the concurrent thread.
-    MutatorThreadSweeper sweeper(&space_states_, platform_);
+    MutatorThreadSweeper sweeper(&space_states_, platform_, discard_allocator_);
     sweeper.Sweep();
 
     // Synchronize with the concurrent sweeper and call remaining finalizers.
@@ -538,7 +599,8 @@ class Sweeper::SweeperImpl final {
       if (handle_.IsCanceled() || !sweeper_->is_in_progress_) return;
 
       MutatorThreadSweeper sweeper(&sweeper_->space_states_,
-                                   sweeper_->platform_);
+                                   sweeper_->platform_,
+                                   sweeper_->discard_allocator_);
       const bool sweep_complete =
           sweeper.SweepWithDeadline(deadline_in_seconds);
 
@@ -568,7 +630,8 @@ class Sweeper::SweeperImpl final {
 
     concurrent_sweeper_handle_ = platform_->PostJob(
         v8::TaskPriority::kUserVisible,
-        std::make_unique<ConcurrentSweepTask>(&space_states_));
+        std::make_unique<ConcurrentSweepTask>(&space_states_,
+                                              discard_allocator_));
   }
 
   void CancelSweepers() {
@@ -590,6 +653,9 @@ class Sweeper::SweeperImpl final {
   std::shared_ptr<v8::TaskRunner> foreground_task_runner_;
   IncrementalSweepTask::Handle incremental_sweeper_handle_;
   std::unique_ptr<v8::JobHandle> concurrent_sweeper_handle_;
+  // Page allocator used to discard free memory, or nullptr if free memory is
+  // kept committed.
+  PageAllocator* discard_allocator_ = nullptr;
   bool is_in_progress_ = false;
 };
 
@@ -599,8 +665,13 @@ Sweeper::Sweeper(RawHeap* heap, cppgc::Platform* platform,
 
 Sweeper::~Sweeper() = default;
 
-void Sweeper::Start(Config config) { impl_->Start(config); }
+void Sweeper::Start(Config config, FreeMemoryHandling free_memory_handling) {
+  impl_->Start(config, free_memory_handling);
+}
 void Sweeper::Finish() { impl_->Finish(); }
+bool Sweeper::SweepPageForAllocationIfRunning(NormalPageSpace* space) {
+  return impl_->SweepPageForAllocationIfRunning(space);
+}
 
 }  // namespace internal
 }  // namespace cppgc
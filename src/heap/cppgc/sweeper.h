@@ -16,11 +16,17 @@ class Platform;
 namespace internal {
 
 class StatsCollector;
+class NormalPageSpace;
 class RawHeap;
 
 class V8_EXPORT_PRIVATE Sweeper final {
  public:
   enum class Config { kAtomic, kIncrementalAndConcurrent };
+  // Whether the sweeper returns the system pages fully covered by free list
+  // entries to the OS. Discarding reclaims memory of fragmented pages without
+  // moving objects but makes the next allocation in that range fault in a
+  // fresh page.
+  enum class FreeMemoryHandling { kDoNotDiscard, kDiscardWherePossible };
 
   Sweeper(RawHeap*, cppgc::Platform*, StatsCollector*);
   ~Sweeper();
@@ -29,9 +35,15 @@ class V8_EXPORT_PRIVATE Sweeper final {
   Sweeper& operator=(const Sweeper&) = delete;
 
   // Sweeper::Start assumes the heap holds no linear allocation buffers.
-  void Start(Config);
+  void Start(Config,
+             FreeMemoryHandling = FreeMemoryHandling::kDoNotDiscard);
   void Finish();
 
+  // Sweeps or finalizes a single page of |space| if sweeping is in progress.
+  // Returns false if there is no page of |space| left to process. Used by the
+  // allocator to refill free lists lazily instead of finishing sweeping.
+  bool SweepPageForAllocationIfRunning(NormalPageSpace* space);
+
  private:
   class SweeperImpl;
   std::unique_ptr<SweeperImpl> impl_;
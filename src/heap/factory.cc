@@ -2954,6 +2954,11 @@ V8_INLINE int NumberToStringCacheHash(Handle<FixedArray> cache, double number) {
   return (static_cast<int>(bits) ^ static_cast<int>(bits >> 32)) & mask;
 }
 
+V8_INLINE int NumberToStringCacheHash(Handle<FixedArray> cache, Object number) {
+  if (number.IsSmi()) return NumberToStringCacheHash(cache, Smi::cast(number));
+  return NumberToStringCacheHash(cache, HeapNumber::cast(number).value());
+}
+
 V8_INLINE Handle<String> CharToString(Factory* factory, const char* string,
                                       NumberCacheMode mode) {
   // We tenure the allocated string since it is referenced from the
@@ -2968,19 +2973,34 @@ V8_INLINE Handle<String> CharToString(Factory* factory, const char* string,
 
 void Factory::NumberToStringCacheSet(Handle<Object> number, int hash,
                                      Handle<String> js_string) {
-  if (!number_string_cache()->get(hash * 2).IsUndefined(isolate())) {
-    int full_size = isolate()->heap()->MaxNumberToStringCacheSize();
-    if (number_string_cache()->length() != full_size) {
-      Handle<FixedArray> new_cache =
-          NewFixedArray(full_size, AllocationType::kOld);
-      isolate()->heap()->set_number_string_cache(*new_cache);
-      return;
-    }
+  if (!number_string_cache()->get(hash * 2).IsUndefined(isolate()) &&
+      isolate()->heap()->RecordNumberStringCacheCollision()) {
+    GrowNumberStringCache();
+    hash = NumberToStringCacheHash(number_string_cache(), *number);
   }
   number_string_cache()->set(hash * 2, *number);
   number_string_cache()->set(hash * 2 + 1, *js_string);
 }
 
+void Factory::GrowNumberStringCache() {
+  Handle<FixedArray> old_cache = number_string_cache();
+  int new_length =
+      Min(old_cache->length() * Heap::kNumberStringCacheGrowthFactor,
+          isolate()->heap()->MaxNumberToStringCacheSize());
+  Handle<FixedArray> new_cache =
+      NewFixedArray(new_length, AllocationType::kOld);
+  // Rehash the existing entries so that they survive the resize.
+  DisallowHeapAllocation no_gc;
+  for (int i = 0; i < old_cache->length(); i += 2) {
+    Object key = old_cache->get(i);
+    if (key.IsUndefined(isolate())) continue;
+    int hash = NumberToStringCacheHash(new_cache, key);
+    new_cache->set(hash * 2, key);
+    new_cache->set(hash * 2 + 1, old_cache->get(i + 1));
+  }
+  isolate()->heap()->set_number_string_cache(*new_cache);
+}
+
 Handle<Object> Factory::NumberToStringCacheGet(Object number, int hash) {
   DisallowHeapAllocation no_gc;
   Object key = number_string_cache()->get(hash * 2);
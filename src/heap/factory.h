@@ -964,6 +964,10 @@ class V8_EXPORT_PRIVATE Factory : public FactoryBase<Factory> {
   V8_INLINE void NumberToStringCacheSet(Handle<Object> number, int hash,
                                         Handle<String> js_string);
 
+  // Grows the number-string cache by kNumberStringCacheGrowthFactor up to
+  // Heap::MaxNumberToStringCacheSize() and rehashes the existing entries.
+  void GrowNumberStringCache();
+
   // Creates a new JSArray with the given backing storage. Performs no
   // verification of the backing storage because it may not yet be filled.
   Handle<JSArray> NewJSArrayWithUnverifiedElements(
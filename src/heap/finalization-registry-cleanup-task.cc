@@ -6,9 +6,11 @@
 
 #include "src/execution/frames.h"
 #include "src/execution/interrupts-scope.h"
+#include "src/execution/microtask-queue.h"
 #include "src/execution/stack-guard.h"
 #include "src/execution/v8threads.h"
 #include "src/heap/heap-inl.h"
+#include "src/objects/contexts-inl.h"
 #include "src/objects/js-weak-refs-inl.h"
 #include "src/tracing/trace-event.h"
 
@@ -42,6 +44,22 @@ void FinalizationRegistryCleanupTask::RunInternal() {
   TRACE_EVENT_CALL_STATS_SCOPED(isolate, "v8",
                                 "V8.FinalizationRegistryCleanupTask");
 
+  // Processing several FinalizationRegistries per task avoids posting one task
+  // per registry when many of them became dirty in the same GC.
+  const base::TimeTicks deadline =
+      base::TimeTicks::Now() +
+      base::TimeDelta::FromMillisecondsD(kBatchBudgetInMs);
+  while (CleanupOneFinalizationRegistry() &&
+         base::TimeTicks::Now() < deadline) {
+  }
+
+  // Repost if there are remaining dirty FinalizationRegistries.
+  heap_->set_is_finalization_registry_cleanup_task_posted(false);
+  heap_->PostFinalizationRegistryCleanupTaskIfNeeded();
+}
+
+bool FinalizationRegistryCleanupTask::CleanupOneFinalizationRegistry() {
+  Isolate* isolate = heap_->isolate();
   HandleScope handle_scope(isolate);
   Handle<JSFinalizationRegistry> finalization_registry;
   // There could be no dirty FinalizationRegistries. When a context is disposed
@@ -49,7 +67,7 @@ void FinalizationRegistryCleanupTask::RunInternal() {
   // list.
   if (!heap_->DequeueDirtyJSFinalizationRegistry().ToHandle(
           &finalization_registry)) {
-    return;
+    return false;
   }
   finalization_registry->set_scheduled_for_cleanup(false);
 
@@ -70,8 +88,6 @@ void FinalizationRegistryCleanupTask::RunInternal() {
   // after an exception so the host can perform a microtask checkpoint. In case
   // of exception, check if the FinalizationRegistry still needs cleanup
   // and should be requeued.
-  //
-  // TODO(syg): Implement better scheduling for finalizers.
   InvokeFinalizationRegistryCleanupFromTask(context, finalization_registry,
                                             callback);
   if (finalization_registry->NeedsCleanup() &&
@@ -80,9 +96,13 @@ void FinalizationRegistryCleanupTask::RunInternal() {
     heap_->EnqueueDirtyJSFinalizationRegistry(*finalization_registry, nop);
   }
 
-  // Repost if there are remaining dirty FinalizationRegistries.
-  heap_->set_is_finalization_registry_cleanup_task_posted(false);
-  heap_->PostFinalizationRegistryCleanupTaskIfNeeded();
+  // Continuing with the next FinalizationRegistry is only indistinguishable
+  // from running it in a separate task if the microtask checkpoint that the
+  // host would perform in between has nothing to do.
+  if (catcher.HasCaught()) return false;
+  MicrotaskQueue* microtask_queue =
+      NativeContext::cast(*context).microtask_queue();
+  return !microtask_queue || microtask_queue->size() == 0;
 }
 
 }  // namespace internal
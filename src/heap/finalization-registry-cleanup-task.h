@@ -12,8 +12,10 @@ namespace v8 {
 namespace internal {
 
 // The GC schedules a cleanup task when the dirty FinalizationRegistry list is
-// non-empty. The task processes a single FinalizationRegistry and posts another
-// cleanup task if there are remaining dirty FinalizationRegistries on the list.
+// non-empty. The task processes dirty FinalizationRegistries until it runs out
+// of its time budget or a cleanup callback leaves work for a microtask
+// checkpoint, and posts another cleanup task if there are remaining dirty
+// FinalizationRegistries on the list.
 class FinalizationRegistryCleanupTask : public CancelableTask {
  public:
   explicit FinalizationRegistryCleanupTask(Heap* heap);
@@ -23,8 +25,14 @@ class FinalizationRegistryCleanupTask : public CancelableTask {
   void operator=(const FinalizationRegistryCleanupTask&) = delete;
 
  private:
+  // Time budget for processing several FinalizationRegistries in a row.
+  static constexpr double kBatchBudgetInMs = 1.0;
+
   void RunInternal() override;
   void SlowAssertNoActiveJavaScript();
+  // Cleans up a single dirty FinalizationRegistry. Returns true if the task
+  // may go on with the next one without yielding to the embedder.
+  bool CleanupOneFinalizationRegistry();
 
   Heap* heap_;
 };
@@ -12,6 +12,7 @@
 #include "src/heap/incremental-marking.h"
 #include "src/heap/spaces.h"
 #include "src/logging/counters-inl.h"
+#include "src/logging/metrics.h"
 
 namespace v8 {
 namespace internal {
@@ -65,7 +66,11 @@ GCTracer::Scope::~Scope() {
 
 GCTracer::BackgroundScope::BackgroundScope(GCTracer* tracer, ScopeId scope,
                                            RuntimeCallStats* runtime_stats)
-    : tracer_(tracer), scope_(scope), runtime_stats_(runtime_stats) {
+    : tracer_(tracer),
+      scope_(scope),
+      runtime_stats_(runtime_stats),
+      cpu_time_scope_(tracer->heap_->isolate()->counters(),
+                      Counters::CpuTimeCategory::kGCBackground) {
   start_time_ = tracer_->heap_->MonotonicallyIncreasingTimeInMs();
   if (V8_LIKELY(!TracingFlags::is_runtime_stats_enabled())) return;
   runtime_stats_->Enter(&timer_,
@@ -203,6 +208,8 @@ void GCTracer::ResetForTesting() {
   recorded_embedder_generation_allocations_.Reset();
   recorded_context_disposal_times_.Reset();
   recorded_survival_ratios_.Reset();
+  bytes_compacted_ = 0;
+  incremental_mark_batched_events_.events.clear();
   start_counter_ = 0;
   average_mutator_duration_ = 0;
   average_mark_compact_duration_ = 0;
@@ -256,6 +263,7 @@ void GCTracer::Start(GarbageCollector collector,
 
   current_.incremental_marking_bytes = 0;
   current_.incremental_marking_duration = 0;
+  bytes_compacted_ = 0;
 
   for (int i = 0; i < Scope::NUMBER_OF_SCOPES; i++) {
     current_.scopes[i] = 0;
@@ -373,6 +381,14 @@ void GCTracer::Stop(GarbageCollector collector) {
   }
   FetchBackgroundGeneralCounters();
 
+  if (heap_->isolate()->metrics_recorder()->HasEmbedderRecorder()) {
+    if (Heap::IsYoungGenerationCollector(collector)) {
+      ReportYoungCycleToRecorder();
+    } else {
+      ReportFullCycleToRecorder();
+    }
+  }
+
   heap_->UpdateTotalGCTime(duration);
 
   if ((current_.type == Event::SCAVENGER ||
@@ -474,6 +490,7 @@ void GCTracer::AddCompactionEvent(double duration,
                                   size_t live_bytes_compacted) {
   recorded_compactions_.Push(
       MakeBytesAndDuration(live_bytes_compacted, duration));
+  bytes_compacted_ += live_bytes_compacted;
 }
 
 
@@ -486,6 +503,17 @@ void GCTracer::AddIncrementalMarkingStep(double duration, size_t bytes) {
     incremental_marking_bytes_ += bytes;
     incremental_marking_duration_ += duration;
   }
+  if (heap_->isolate()->metrics_recorder()->HasEmbedderRecorder()) {
+    v8::metrics::GarbageCollectionFullMainThreadIncrementalMark event;
+    event.wall_clock_duration_in_us = static_cast<int64_t>(
+        duration * base::Time::kMicrosecondsPerMillisecond);
+    event.bytes_marked = bytes;
+    incremental_mark_batched_events_.events.push_back(event);
+    if (incremental_mark_batched_events_.events.size() >=
+        kMaxBatchedIncrementalMarkEvents) {
+      FlushBatchedIncrementalMarkEvents();
+    }
+  }
 }
 
 void GCTracer::Output(const char* format, ...) const {
@@ -680,7 +708,16 @@ void GCTracer::PrintNVP() const {
           "background.store_buffer=%.2f "
           "background.unmapper=%.2f "
           "update_marking_deque=%.2f "
-          "reset_liveness=%.2f\n",
+          "reset_liveness=%.2f "
+          "scavenge_throughput=%.f "
+          "total_size_before=%zu "
+          "total_size_after=%zu "
+          "promoted=%zu "
+          "semi_space_copied=%zu "
+          "promotion_ratio=%.1f%% "
+          "average_survival_ratio=%.1f%% "
+          "promotion_rate=%.1f%% "
+          "semi_space_copy_rate=%.1f%%\n",
           duration, spent_in_mutator, "mmc", current_.reduce_memory,
           current_.scopes[Scope::MINOR_MC],
           current_.scopes[Scope::MINOR_MC_SWEEPING],
@@ -706,7 +743,12 @@ void GCTracer::PrintNVP() const {
           current_.scopes[Scope::BACKGROUND_STORE_BUFFER],
           current_.scopes[Scope::BACKGROUND_UNMAPPER],
           current_.scopes[Scope::MINOR_MC_MARKING_DEQUE],
-          current_.scopes[Scope::MINOR_MC_RESET_LIVENESS]);
+          current_.scopes[Scope::MINOR_MC_RESET_LIVENESS],
+          ScavengeSpeedInBytesPerMillisecond(), current_.start_object_size,
+          current_.end_object_size, heap_->promoted_objects_size(),
+          heap_->semi_space_copied_object_size(), heap_->promotion_ratio_,
+          AverageSurvivalRatio(), heap_->promotion_rate_,
+          heap_->semi_space_copied_rate_);
       break;
     case Event::MARK_COMPACTOR:
     case Event::INCREMENTAL_MARK_COMPACTOR:
@@ -1202,6 +1244,83 @@ void GCTracer::AddBackgroundScopeSample(BackgroundScope::ScopeId scope,
   counter.total_duration_ms += duration;
 }
 
+namespace {
+
+int64_t ToMicroseconds(double ms) {
+  return static_cast<int64_t>(ms * base::Time::kMicrosecondsPerMillisecond);
+}
+
+size_t BytesFreed(size_t start_object_size, size_t end_object_size) {
+  return start_object_size > end_object_size
+             ? start_object_size - end_object_size
+             : 0;
+}
+
+}  // namespace
+
+void GCTracer::FlushBatchedIncrementalMarkEvents() {
+  if (incremental_mark_batched_events_.events.empty()) return;
+  heap_->isolate()->metrics_recorder()->AddThreadSafeEvent(
+      incremental_mark_batched_events_);
+  incremental_mark_batched_events_.events.clear();
+}
+
+void GCTracer::ReportFullCycleToRecorder() {
+  FlushBatchedIncrementalMarkEvents();
+
+  v8::metrics::GarbageCollectionFullCycle event;
+  event.reason = Heap::GarbageCollectionReasonToString(current_.gc_reason);
+  event.incremental = current_.type == Event::INCREMENTAL_MARK_COMPACTOR;
+  event.reduce_memory = current_.reduce_memory;
+  event.main_thread_atomic_wall_clock_duration_in_us =
+      ToMicroseconds(current_.end_time - current_.start_time);
+  event.main_thread_incremental_wall_clock_duration_in_us =
+      ToMicroseconds(current_.incremental_marking_duration);
+
+  event.main_thread_atomic_phases.compact_wall_clock_duration_in_us =
+      ToMicroseconds(current_.scopes[Scope::MC_EVACUATE]);
+  event.main_thread_atomic_phases.mark_wall_clock_duration_in_us =
+      ToMicroseconds(current_.scopes[Scope::MC_MARK]);
+  event.main_thread_atomic_phases.sweep_wall_clock_duration_in_us =
+      ToMicroseconds(current_.scopes[Scope::MC_SWEEP]);
+  event.main_thread_atomic_phases.weak_wall_clock_duration_in_us =
+      ToMicroseconds(current_.scopes[Scope::MC_CLEAR]);
+
+  // Weak processing does not run on background threads.
+  event.background_phases.compact_wall_clock_duration_in_us = ToMicroseconds(
+      current_.scopes[Scope::MC_BACKGROUND_EVACUATE_COPY] +
+      current_.scopes[Scope::MC_BACKGROUND_EVACUATE_UPDATE_POINTERS]);
+  event.background_phases.mark_wall_clock_duration_in_us =
+      ToMicroseconds(current_.scopes[Scope::MC_BACKGROUND_MARKING]);
+  event.background_phases.sweep_wall_clock_duration_in_us =
+      ToMicroseconds(current_.scopes[Scope::MC_BACKGROUND_SWEEPING]);
+
+  event.bytes_freed =
+      BytesFreed(current_.start_object_size, current_.end_object_size);
+  event.bytes_compacted = bytes_compacted_;
+  heap_->isolate()->metrics_recorder()->AddThreadSafeEvent(event);
+}
+
+void GCTracer::ReportYoungCycleToRecorder() {
+  v8::metrics::GarbageCollectionYoungCycle event;
+  event.reason = Heap::GarbageCollectionReasonToString(current_.gc_reason);
+  event.minor_mark_compactor = current_.type == Event::MINOR_MARK_COMPACTOR;
+  event.main_thread_wall_clock_duration_in_us =
+      ToMicroseconds(current_.end_time - current_.start_time);
+  double background_duration = 0;
+  for (int i = Scope::FIRST_MINOR_GC_BACKGROUND_SCOPE;
+       i <= Scope::LAST_MINOR_GC_BACKGROUND_SCOPE; i++) {
+    background_duration += current_.scopes[i];
+  }
+  event.background_wall_clock_duration_in_us =
+      ToMicroseconds(background_duration);
+  event.bytes_freed =
+      BytesFreed(current_.start_object_size, current_.end_object_size);
+  event.bytes_promoted = heap_->promoted_objects_size();
+  event.bytes_copied = heap_->semi_space_copied_object_size();
+  heap_->isolate()->metrics_recorder()->AddThreadSafeEvent(event);
+}
+
 void GCTracer::RecordGCPhasesHistograms(TimedHistogram* gc_timer) {
   Counters* counters = heap_->isolate()->counters();
   if (gc_timer == counters->gc_finalize()) {
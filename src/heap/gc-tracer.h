@@ -5,6 +5,7 @@
 #ifndef V8_HEAP_GC_TRACER_H_
 #define V8_HEAP_GC_TRACER_H_
 
+#include "include/v8-metrics.h"
 #include "src/base/compiler-specific.h"
 #include "src/base/platform/platform.h"
 #include "src/base/ring-buffer.h"
@@ -130,6 +131,7 @@ class V8_EXPORT_PRIVATE GCTracer {
     double start_time_;
     RuntimeCallTimer timer_;
     RuntimeCallStats* runtime_stats_;
+    CpuTimeAccountingScope cpu_time_scope_;
     DISALLOW_COPY_AND_ASSIGN(BackgroundScope);
   };
 
@@ -205,6 +207,9 @@ class V8_EXPORT_PRIVATE GCTracer {
   };
 
   static const int kThroughputTimeFrameMs = 5000;
+  // Number of incremental marking steps reported to the embedder's metrics
+  // recorder in one batch.
+  static const size_t kMaxBatchedIncrementalMarkEvents = 16;
   static constexpr double kConservativeSpeedInBytesPerMillisecond = 128 * KB;
 
   static double CombineSpeedsInBytesPerMillisecond(double default_speed,
@@ -378,6 +383,7 @@ class V8_EXPORT_PRIVATE GCTracer {
   FRIEND_TEST(GCTracerTest, IncrementalMarkingDetails);
   FRIEND_TEST(GCTracerTest, IncrementalScope);
   FRIEND_TEST(GCTracerTest, IncrementalMarkingSpeed);
+  FRIEND_TEST(GCTracerTest, MetricsRecorderEvents);
   FRIEND_TEST(GCTracerTest, MutatorUtilization);
   FRIEND_TEST(GCTracerTest, RecordGCSumHistograms);
   FRIEND_TEST(GCTracerTest, RecordMarkCompactHistograms);
@@ -432,6 +438,12 @@ class V8_EXPORT_PRIVATE GCTracer {
   void FetchBackgroundMarkCompactCounters();
   void FetchBackgroundGeneralCounters();
 
+  // Report the current cycle and incremental marking steps to the embedder
+  // through v8::metrics::Recorder.
+  void ReportFullCycleToRecorder();
+  void ReportYoungCycleToRecorder();
+  void FlushBatchedIncrementalMarkEvents();
+
   // Pointer to the heap that owns this tracer.
   Heap* heap_;
 
@@ -458,6 +470,12 @@ class V8_EXPORT_PRIVATE GCTracer {
 
   double recorded_embedder_speed_ = 0.0;
 
+  // Live bytes evacuated by compaction during the current cycle.
+  size_t bytes_compacted_ = 0;
+
+  v8::metrics::GarbageCollectionFullMainThreadBatchedIncrementalMark
+      incremental_mark_batched_events_;
+
   // Incremental scopes carry more information than just the duration. The infos
   // here are merged back upon starting/stopping the GC tracer.
   IncrementalMarkingInfos
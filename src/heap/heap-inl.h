@@ -16,6 +16,7 @@
 #include "src/heap/third-party/heap-api.h"
 
 #include "src/base/atomic-utils.h"
+#include "src/base/bits.h"
 #include "src/base/platform/platform.h"
 #include "src/objects/feedback-vector.h"
 
@@ -630,10 +631,12 @@ int Heap::MaxNumberToStringCacheSize() const {
   // Compute the size of the number string cache based on the max newspace size.
   // The number string cache has a minimum size based on twice the initial cache
   // size to ensure that it is bigger after being made 'full size'.
-  size_t number_string_cache_size = max_semi_space_size_ / 512;
+  size_t max_entries = base::bits::RoundDownToPowerOfTwo32(
+      Max(1, FLAG_max_number_string_cache_entries));
+  size_t number_string_cache_size = max_semi_space_size_ / 256;
   number_string_cache_size =
       Max(static_cast<size_t>(kInitialNumberStringCacheSize * 2),
-          Min<size_t>(0x4000u, number_string_cache_size));
+          Min(max_entries, number_string_cache_size));
   // There is a string and a number per entry so the length is twice the number
   // of entries.
   return static_cast<int>(number_string_cache_size * 2);
@@ -79,6 +79,7 @@
 #include "src/objects/shared-function-info.h"
 #include "src/objects/slots-atomic-inl.h"
 #include "src/objects/slots-inl.h"
+#include "src/profiler/sampling-heap-profiler.h"
 #include "src/regexp/regexp.h"
 #include "src/snapshot/embedded/embedded-data.h"
 #include "src/snapshot/serializer-deserializer.h"
@@ -89,6 +90,7 @@
 #include "src/tracing/trace-event.h"
 #include "src/utils/utils-inl.h"
 #include "src/utils/utils.h"
+#include "src/zone/accounting-allocator.h"
 
 // Has to be the last include (doesn't have include guards):
 #include "src/objects/object-macros.h"
@@ -824,6 +826,7 @@ void Heap::GarbageCollectionPrologue() {
 
   // Reset GC statistics.
   promoted_objects_size_ = 0;
+  young_survivors_by_type_.Reset();
   previous_semi_space_copied_object_size_ = semi_space_copied_object_size_;
   semi_space_copied_object_size_ = 0;
   nodes_died_in_new_space_ = 0;
@@ -989,6 +992,16 @@ void Heap::RemoveAllocationSitePretenuringFeedback(AllocationSite site) {
   global_pretenuring_feedback_.erase(site);
 }
 
+AllocationType Heap::AllocationTypeForBulkAllocation(size_t input_size,
+                                                     size_t threshold) {
+  if (threshold == 0 || input_size < threshold) return AllocationType::kYoung;
+  if (tracer()->AverageSurvivalRatio() <
+      kMinPromotedPercentForFastPromotionMode) {
+    return AllocationType::kYoung;
+  }
+  return AllocationType::kOld;
+}
+
 bool Heap::DeoptMaybeTenuredAllocationSites() {
   return new_space_->IsAtMaximumCapacity() && maximum_size_scavenges_ == 0;
 }
@@ -1429,6 +1442,12 @@ void Heap::ReportExternalMemoryPressure() {
                                      kGCCallbackFlagsForExternalMemory));
     return;
   }
+  if (FLAG_scavenge_on_external_memory_pressure &&
+      incremental_marking()->IsStopped() &&
+      ScavengeForExternalMemoryPressure(current - baseline)) {
+    return;
+  }
+  current = isolate()->isolate_data()->external_memory_;
   if (incremental_marking()->IsStopped()) {
     if (incremental_marking()->CanBeActivated()) {
       StartIncrementalMarking(GCFlagsForIncrementalMarking(),
@@ -1455,6 +1474,29 @@ void Heap::ReportExternalMemoryPressure() {
   }
 }
 
+bool Heap::ScavengeForExternalMemoryPressure(int64_t growth) {
+  // Array buffers and external strings owned by young objects are accounted
+  // to the new space. If they hold at least half of the growth since the last
+  // mark-compact, a scavenge is likely to free enough of it.
+  const size_t young_external_bytes = new_space()->ExternalBackingStoreBytes();
+  if (growth <= 0 || young_external_bytes < static_cast<size_t>(growth) / 2) {
+    return false;
+  }
+  CollectGarbage(NEW_SPACE, GarbageCollectionReason::kExternalMemoryPressure);
+  // Freed array buffers are only subtracted from the external memory once
+  // sweeping them finished.
+  array_buffer_sweeper()->EnsureFinished();
+  const int64_t current = isolate()->isolate_data()->external_memory_;
+  const int64_t limit = isolate()->isolate_data()->external_memory_limit_;
+  if (FLAG_trace_gc_verbose) {
+    isolate()->PrintWithTimestamp(
+        "External memory pressure: young external %zu KB, after scavenge "
+        "%" PRId64 " KB, limit %" PRId64 " KB\n",
+        young_external_bytes / KB, current / KB, limit / KB);
+  }
+  return current <= limit;
+}
+
 void Heap::EnsureFillerObjectAtTop() {
   // There may be an allocation memento behind objects in new space. Upon
   // evacuation of a non-full new space (or if we are on the last page) there
@@ -1648,6 +1690,7 @@ bool Heap::CollectGarbage(AllocationSpace space,
           used_memory_after < initial_max_old_generation_size_threshold_) {
         max_old_generation_size_ = initial_max_old_generation_size_;
       }
+      CheckSoftHeapLimit(used_memory_after);
     }
 
     tracer()->Stop(collector);
@@ -1661,6 +1704,8 @@ bool Heap::CollectGarbage(AllocationSpace space,
 
   collection_barrier_.CollectionPerformed();
 
+  if (soft_heap_limit_callback_pending_) InvokeSoftHeapLimitCallback();
+
   // Start incremental marking for the next cycle. We do this only for scavenger
   // to avoid a loop where mark-compact causes another mark-compact.
   if (IsYoungGenerationCollector(collector)) {
@@ -2310,6 +2355,10 @@ void Heap::MarkCompactEpilogue() {
   incremental_marking()->Epilogue();
 
   DCHECK(incremental_marking()->IsStopped());
+
+  SamplingHeapProfiler* profiler =
+      isolate()->heap_profiler()->sampling_heap_profiler();
+  if (profiler) profiler->OnMarkCompactDone();
 }
 
 
@@ -2327,15 +2376,32 @@ void Heap::MarkCompactPrologue() {
 
 void Heap::CheckNewSpaceExpansionCriteria() {
   if (new_space_->TotalCapacity() < new_space_->MaximumCapacity() &&
-      survived_since_last_expansion_ > new_space_->TotalCapacity()) {
+      (survived_since_last_expansion_ > new_space_->TotalCapacity() ||
+       ScavengesTooFrequent())) {
     // Grow the size of new space if there is room to grow, and enough data
-    // has survived scavenge since the last expansion.
+    // has survived scavenge since the last expansion or scavenges happen more
+    // often than the configured target interval.
     new_space_->Grow();
     survived_since_last_expansion_ = 0;
   }
   new_lo_space()->SetCapacity(new_space()->Capacity());
 }
 
+bool Heap::ScavengesTooFrequent() {
+  if (FLAG_scavenge_target_interval_ms <= 0) return false;
+  const double allocation_throughput =
+      tracer()->NewSpaceAllocationThroughputInBytesPerMillisecond();
+  const double survived_speed =
+      tracer()->ScavengeSpeedInBytesPerMillisecond(kForSurvivedObjects);
+  if (allocation_throughput == 0 || survived_speed == 0) return false;
+  const double interval_ms = new_space_->Capacity() / allocation_throughput;
+  // The scavenge cost is dominated by the surviving objects, which roughly
+  // stays the same for a larger new space because more objects die.
+  const double estimated_pause_ms = survived_last_scavenge_ / survived_speed;
+  return interval_ms < FLAG_scavenge_target_interval_ms &&
+         estimated_pause_ms < FLAG_scavenge_target_pause_ms;
+}
+
 void Heap::EvacuateYoungGeneration() {
   TRACE_GC(tracer(), GCTracer::Scope::SCAVENGER_FAST_PROMOTE);
   base::MutexGuard guard(relocation_mutex());
@@ -2678,11 +2744,14 @@ void Heap::ProcessAllWeakReferences(WeakObjectRetainer* retainer) {
   ProcessNativeContexts(retainer);
   ProcessAllocationSites(retainer);
   ProcessDirtyJSFinalizationRegistries(retainer);
+  // Has to come after the allocation sites, which may be retained as zombies.
+  ProcessAllocationSamples(retainer, false);
 }
 
 
 void Heap::ProcessYoungWeakReferences(WeakObjectRetainer* retainer) {
   ProcessNativeContexts(retainer);
+  ProcessAllocationSamples(retainer, true);
 }
 
 
@@ -2710,6 +2779,13 @@ void Heap::ProcessDirtyJSFinalizationRegistries(WeakObjectRetainer* retainer) {
   }
 }
 
+void Heap::ProcessAllocationSamples(WeakObjectRetainer* retainer,
+                                    bool young_only) {
+  SamplingHeapProfiler* profiler =
+      isolate()->heap_profiler()->sampling_heap_profiler();
+  if (profiler) profiler->ProcessSamples(retainer, young_only);
+}
+
 void Heap::ProcessWeakListRoots(WeakObjectRetainer* retainer) {
   set_native_contexts_list(retainer->RetainAs(native_contexts_list()));
   set_allocation_sites_list(retainer->RetainAs(allocation_sites_list()));
@@ -2717,6 +2793,9 @@ void Heap::ProcessWeakListRoots(WeakObjectRetainer* retainer) {
       retainer->RetainAs(dirty_js_finalization_registries_list()));
   set_dirty_js_finalization_registries_list_tail(
       retainer->RetainAs(dirty_js_finalization_registries_list_tail()));
+  // Sampled objects are not roots, but they have to be updated after
+  // evacuation as well.
+  ProcessAllocationSamples(retainer, false);
 }
 
 void Heap::ForeachAllocationSite(
@@ -2951,6 +3030,19 @@ void Heap::FlushNumberStringCache() {
   for (int i = 0; i < len; i++) {
     number_string_cache().set_undefined(i);
   }
+  number_string_cache_collisions_ = 0;
+}
+
+bool Heap::RecordNumberStringCacheCollision() {
+  int length = number_string_cache().length();
+  if (length >= MaxNumberToStringCacheSize()) return false;
+  int entries = length / 2;
+  if (++number_string_cache_collisions_ <
+      entries / kNumberStringCacheCollisionsPerEntry) {
+    return false;
+  }
+  number_string_cache_collisions_ = 0;
+  return true;
 }
 
 namespace {
@@ -3461,6 +3553,7 @@ bool Heap::ShouldOptimizeForMemoryUsage() {
   const size_t kOldGenerationSlack = max_old_generation_size_ / 8;
   return FLAG_optimize_for_size || isolate()->IsIsolateInBackground() ||
          isolate()->IsMemorySavingsModeActive() || HighMemoryPressure() ||
+         soft_heap_limit_exceeded_ ||
          !CanExpandOldGeneration(kOldGenerationSlack);
 }
 
@@ -3844,6 +3937,7 @@ void Heap::CheckMemoryPressure() {
   memory_pressure_level_ = MemoryPressureLevel::kNone;
   if (memory_pressure_level == MemoryPressureLevel::kCritical) {
     TRACE_EVENT0("devtools.timeline,v8", "V8.CheckMemoryPressure");
+    isolate()->allocator()->ReleasePooledSegments();
     CollectGarbageOnMemoryPressure();
   } else if (memory_pressure_level == MemoryPressureLevel::kModerate) {
     if (FLAG_incremental_marking && incremental_marking()->IsStopped()) {
@@ -3981,6 +4075,41 @@ bool Heap::InvokeNearHeapLimitCallback() {
   return false;
 }
 
+void Heap::SetSoftHeapLimitCallback(v8::SoftHeapLimitCallback callback,
+                                    void* data, double threshold_percent) {
+  soft_heap_limit_callback_ = callback;
+  soft_heap_limit_callback_data_ = data;
+  soft_heap_limit_percent_ = threshold_percent;
+  soft_heap_limit_exceeded_ = false;
+  soft_heap_limit_callback_pending_ = false;
+}
+
+void Heap::CheckSoftHeapLimit(size_t old_generation_size) {
+  if (soft_heap_limit_callback_ == nullptr) return;
+  bool exceeded = old_generation_size >
+                  soft_heap_limit_percent_ * max_old_generation_size_;
+  if (exceeded && !soft_heap_limit_exceeded_) {
+    soft_heap_limit_callback_pending_ = true;
+  }
+  soft_heap_limit_exceeded_ = exceeded;
+}
+
+void Heap::InvokeSoftHeapLimitCallback() {
+  DCHECK_NOT_NULL(soft_heap_limit_callback_);
+  // Reset first as the callback may trigger another GC.
+  soft_heap_limit_callback_pending_ = false;
+  if (FLAG_trace_gc_verbose) {
+    isolate()->PrintWithTimestamp(
+        "Soft heap limit exceeded: %zu KB of %zu KB\n",
+        OldGenerationSizeOfObjects() / KB, max_old_generation_size_ / KB);
+  }
+  VMState<EXTERNAL> state(isolate_);
+  HandleScope scope(isolate());
+  soft_heap_limit_callback_(soft_heap_limit_callback_data_,
+                            OldGenerationSizeOfObjects(),
+                            max_old_generation_size_);
+}
+
 bool Heap::MeasureMemory(std::unique_ptr<v8::MeasureMemoryDelegate> delegate,
                          v8::MeasureMemoryExecution execution) {
   HandleScope handle_scope(isolate());
@@ -4811,6 +4940,7 @@ void Heap::ConfigureHeap(const v8::ResourceConstraints& constraints) {
           AllocationMemento::kSize));
 
   code_range_size_ = constraints.code_range_size_in_bytes();
+  gc_pause_target_ms_ = constraints.gc_pause_target_in_ms();
 
   configured_ = true;
 }
@@ -5030,6 +5160,27 @@ double Heap::PercentToGlobalMemoryLimit() {
   return total_bytes > 0 ? (current_bytes / total_bytes) * 100.0 : 0;
 }
 
+bool Heap::IncrementalMarkingDueForPauseTarget(
+    size_t old_generation_space_available) {
+  const double allocation_throughput =
+      tracer()->CurrentOldGenerationAllocationThroughputInBytesPerMillisecond();
+  const double marking_speed =
+      tracer()->IncrementalMarkingSpeedInBytesPerMillisecond();
+  const double finalize_speed =
+      tracer()->FinalIncrementalMarkCompactSpeedInBytesPerMillisecond();
+  if (allocation_throughput == 0 || finalize_speed == 0) return false;
+  // Marking work that may be left for the finalization pause.
+  const double bytes_for_pause = gc_pause_target_ms_ * finalize_speed;
+  const double bytes_to_mark =
+      static_cast<double>(OldGenerationSizeOfObjects());
+  if (bytes_to_mark <= bytes_for_pause) return false;
+  const double time_to_limit_ms =
+      old_generation_space_available / allocation_throughput;
+  const double marking_time_ms =
+      (bytes_to_mark - bytes_for_pause) / marking_speed;
+  return marking_time_ms >= time_to_limit_ms;
+}
+
 // This function returns either kNoLimit, kSoftLimit, or kHardLimit.
 // The kNoLimit means that either incremental marking is disabled or it is too
 // early to start incremental marking.
@@ -5097,6 +5248,11 @@ Heap::IncrementalMarkingLimit Heap::IncrementalMarkingLimitReached() {
   const base::Optional<size_t> global_memory_available =
       GlobalMemoryAvailable();
 
+  if (gc_pause_target_ms_ > 0 && !ShouldOptimizeForLoadTime() &&
+      IncrementalMarkingDueForPauseTarget(old_generation_space_available)) {
+    return IncrementalMarkingLimit::kSoftLimit;
+  }
+
   if (old_generation_space_available > new_space_->Capacity() &&
       (!global_memory_available ||
        global_memory_available > new_space_->Capacity())) {
@@ -6616,7 +6772,13 @@ void Heap::WriteBarrierForCodeSlow(Code code) {
 void Heap::GenerationalBarrierSlow(HeapObject object, Address slot,
                                    HeapObject value) {
   MemoryChunk* chunk = MemoryChunk::FromHeapObject(object);
-  RememberedSet<OLD_TO_NEW>::Insert<AccessMode::NON_ATOMIC>(chunk, slot);
+  if (FLAG_local_heaps) {
+    // Background threads with a LocalHeap may record slots on the same page
+    // concurrently to the main thread.
+    RememberedSet<OLD_TO_NEW>::Insert<AccessMode::ATOMIC>(chunk, slot);
+  } else {
+    RememberedSet<OLD_TO_NEW>::Insert<AccessMode::NON_ATOMIC>(chunk, slot);
+  }
 }
 
 void Heap::RecordEphemeronKeyWrite(EphemeronHashTable table, Address slot) {
@@ -24,6 +24,7 @@
 #include "src/common/assert-scope.h"
 #include "src/common/globals.h"
 #include "src/heap/allocation-observer.h"
+#include "src/heap/survivor-stats.h"
 #include "src/init/heap-symbols.h"
 #include "src/objects/allocation-site.h"
 #include "src/objects/fixed-array.h"
@@ -372,11 +373,14 @@ class Heap {
 
   // Helper function to get the bytecode flushing mode based on the flags. This
   // is required because it is not safe to acess flags in concurrent marker.
-  static inline BytecodeFlushMode GetBytecodeFlushMode() {
+  // GCs that reduce memory, e.g. on memory pressure, flush more eagerly.
+  static inline BytecodeFlushMode GetBytecodeFlushMode(
+      bool should_reduce_memory = false) {
     if (FLAG_stress_flush_bytecode) {
       return BytecodeFlushMode::kStressFlushBytecode;
     } else if (FLAG_flush_bytecode) {
-      return BytecodeFlushMode::kFlushBytecode;
+      return should_reduce_memory ? BytecodeFlushMode::kFlushUnusedBytecode
+                                  : BytecodeFlushMode::kFlushBytecode;
     }
     return BytecodeFlushMode::kDoNotFlushBytecode;
   }
@@ -623,6 +627,9 @@ class Heap {
       v8::NearHeapLimitCallback callback, size_t heap_limit);
   V8_EXPORT_PRIVATE void AutomaticallyRestoreInitialHeapLimit(
       double threshold_percent);
+  V8_EXPORT_PRIVATE void SetSoftHeapLimitCallback(
+      v8::SoftHeapLimitCallback callback, void* data,
+      double threshold_percent);
 
   void AppendArrayBufferExtension(JSArrayBuffer object,
                                   ArrayBufferExtension* extension);
@@ -642,6 +649,9 @@ class Heap {
 
   // Check new space expansion criteria and expand semispaces if it was hit.
   void CheckNewSpaceExpansionCriteria();
+  // Returns true if scavenges happen more often than the target interval
+  // and growing the new space is not expected to exceed the pause target.
+  bool ScavengesTooFrequent();
 
   void VisitExternalResources(v8::ExternalResourceVisitor* visitor);
 
@@ -1137,6 +1147,13 @@ class Heap {
   bool GetObjectTypeName(size_t index, const char** object_type,
                          const char** object_sub_type);
 
+  // Returns count and size of young generation objects of the given instance
+  // type that survived the last GC. Only tracked with
+  // --track-young-survivors-by-type.
+  SurvivorStatsByType::Entry YoungSurvivorsAtLastGC(size_t index) const {
+    return young_survivors_by_type_.Get(index);
+  }
+
   // The total number of native contexts object on the heap.
   size_t NumberOfNativeContexts();
   // The total number of native contexts that were detached but were not
@@ -1229,6 +1246,10 @@ class Heap {
   }
   inline size_t promoted_objects_size() { return promoted_objects_size_; }
 
+  void MergeYoungSurvivorsByType(const SurvivorStatsByType& stats) {
+    young_survivors_by_type_.Merge(stats);
+  }
+
   inline void IncrementSemiSpaceCopiedObjectSize(size_t object_size) {
     semi_space_copied_object_size_ += object_size;
   }
@@ -1382,6 +1403,13 @@ class Heap {
   void MergeAllocationSitePretenuringFeedback(
       const PretenuringFeedbackMap& local_pretenuring_feedback);
 
+  // Builtins that materialize a large object graph (e.g. JSON.parse) do not
+  // carry allocation mementos. Returns the allocation type they should use for
+  // an input of the given size, based on the survival rate of recent
+  // scavenges.
+  AllocationType AllocationTypeForBulkAllocation(size_t input_size,
+                                                 size_t threshold);
+
   // ===========================================================================
   // Allocation tracking. ======================================================
   // ===========================================================================
@@ -1487,6 +1515,11 @@ class Heap {
   // Calculates the nof entries for the full sized number to string cache.
   inline int MaxNumberToStringCacheSize() const;
 
+  // Records a collision in the number to string cache and returns whether the
+  // cache should be grown. The cache grows once the number of collisions since
+  // it was last resized or flushed reaches a fraction of its capacity.
+  bool RecordNumberStringCacheCollision();
+
   static Isolate* GetIsolateFromWritableObject(HeapObject object);
 
  private:
@@ -1586,6 +1619,8 @@ class Heap {
   static const int kInitialStringTableSize = StringTable::kMinCapacity;
   static const int kInitialEvalCacheSize = 64;
   static const int kInitialNumberStringCacheSize = 256;
+  static const int kNumberStringCacheGrowthFactor = 4;
+  static const int kNumberStringCacheCollisionsPerEntry = 16;
 
   static const int kRememberedUnmappedPages = 128;
 
@@ -1634,6 +1669,11 @@ class Heap {
   // with the allocation memento of the object at the top
   void EnsureFillerObjectAtTop();
 
+  // Performs a scavenge for external memory pressure if young objects hold
+  // enough of the external memory |growth| since the last mark-compact.
+  // Returns true if external memory dropped back below its limit.
+  bool ScavengeForExternalMemoryPressure(int64_t growth);
+
   // Ensure that we have swept all spaces in such a way that we can iterate
   // over all objects.  May cause a GC.
   void MakeHeapIterable();
@@ -1737,6 +1777,12 @@ class Heap {
 
   bool InvokeNearHeapLimitCallback();
 
+  // Updates whether the old generation exceeds the soft heap limit after a
+  // mark-compact and schedules the soft heap limit callback if it does so for
+  // the first time.
+  void CheckSoftHeapLimit(size_t old_generation_size);
+  void InvokeSoftHeapLimitCallback();
+
   void ComputeFastPromotionMode();
 
   // Attempt to over-approximate the weak closure by marking object groups and
@@ -1805,6 +1851,7 @@ class Heap {
   void ProcessNativeContexts(WeakObjectRetainer* retainer);
   void ProcessAllocationSites(WeakObjectRetainer* retainer);
   void ProcessDirtyJSFinalizationRegistries(WeakObjectRetainer* retainer);
+  void ProcessAllocationSamples(WeakObjectRetainer* retainer, bool young_only);
   void ProcessWeakListRoots(WeakObjectRetainer* retainer);
 
   // ===========================================================================
@@ -1872,6 +1919,10 @@ class Heap {
   double PercentToGlobalMemoryLimit();
   enum class IncrementalMarkingLimit { kNoLimit, kSoftLimit, kHardLimit };
   IncrementalMarkingLimit IncrementalMarkingLimitReached();
+  // Returns true if incremental marking has to start now in order to keep the
+  // finalization pause within the embedder provided pause target.
+  bool IncrementalMarkingDueForPauseTarget(
+      size_t old_generation_space_available);
 
   bool UseGlobalMemoryScheduling() const {
     return FLAG_global_gc_scheduling && local_embedder_heap_tracer();
@@ -2006,6 +2057,8 @@ class Heap {
   size_t initial_max_old_generation_size_threshold_ = 0;
   size_t initial_old_generation_size_ = 0;
   bool old_generation_size_configured_ = false;
+  // Soft target for full GC pauses in ms, or zero if not configured.
+  double gc_pause_target_ms_ = 0;
   size_t maximum_committed_ = 0;
   size_t old_generation_capacity_after_bootstrap_ = 0;
 
@@ -2030,6 +2083,12 @@ class Heap {
   std::vector<std::pair<v8::NearHeapLimitCallback, void*> >
       near_heap_limit_callbacks_;
 
+  v8::SoftHeapLimitCallback soft_heap_limit_callback_ = nullptr;
+  void* soft_heap_limit_callback_data_ = nullptr;
+  double soft_heap_limit_percent_ = 0.0;
+  bool soft_heap_limit_exceeded_ = false;
+  bool soft_heap_limit_callback_pending_ = false;
+
   // For keeping track of context disposals.
   int contexts_disposed_ = 0;
 
@@ -2088,6 +2147,10 @@ class Heap {
   // How many mark-sweep collections happened.
   unsigned int ms_count_ = 0;
 
+  // Collisions in the number to string cache since it was last resized or
+  // flushed.
+  int number_string_cache_collisions_ = 0;
+
   // How many gc happened.
   unsigned int gc_count_ = 0;
 
@@ -2129,6 +2192,7 @@ class Heap {
   int deferred_counters_[v8::Isolate::kUseCounterFeatureCount];
 
   size_t promoted_objects_size_ = 0;
+  SurvivorStatsByType young_survivors_by_type_;
   double promotion_ratio_ = 0.0;
   double promotion_rate_ = 0.0;
   size_t semi_space_copied_object_size_ = 0;
@@ -42,9 +42,25 @@ class IncrementalMarkingJob::Task : public CancelableTask {
   const TaskType task_type_;
 };
 
+class IncrementalMarkingJob::IdleTask : public CancelableIdleTask {
+ public:
+  IdleTask(Isolate* isolate, IncrementalMarkingJob* job)
+      : CancelableIdleTask(isolate), isolate_(isolate), job_(job) {}
+
+  // CancelableIdleTask overrides.
+  void RunInternal(double deadline_in_seconds) override;
+
+  Isolate* isolate() const { return isolate_; }
+
+ private:
+  Isolate* const isolate_;
+  IncrementalMarkingJob* const job_;
+};
+
 void IncrementalMarkingJob::Start(Heap* heap) {
   DCHECK(!heap->incremental_marking()->IsStopped());
   ScheduleTask(heap);
+  ScheduleTask(heap, TaskType::kIdle);
 }
 
 void IncrementalMarkingJob::ScheduleTask(Heap* heap, TaskType task_type) {
@@ -53,9 +69,19 @@ void IncrementalMarkingJob::ScheduleTask(Heap* heap, TaskType task_type) {
   if (!IsTaskPending(task_type) && !heap->IsTearingDown() &&
       FLAG_incremental_marking_task) {
     v8::Isolate* isolate = reinterpret_cast<v8::Isolate*>(heap->isolate());
-    SetTaskPending(task_type, true);
     auto taskrunner =
         V8::GetCurrentPlatform()->GetForegroundTaskRunner(isolate);
+    if (task_type == TaskType::kIdle) {
+      if (!FLAG_incremental_marking_idle_task ||
+          !taskrunner->IdleTasksEnabled()) {
+        return;
+      }
+      SetTaskPending(task_type, true);
+      taskrunner->PostIdleTask(
+          std::make_unique<IdleTask>(heap->isolate(), this));
+      return;
+    }
+    SetTaskPending(task_type, true);
     const EmbedderHeapTracer::EmbedderStackState stack_state =
         taskrunner->NonNestableTasksEnabled()
             ? EmbedderHeapTracer::EmbedderStackState::kNoHeapPointers
@@ -134,6 +160,35 @@ void IncrementalMarkingJob::Task::RunInternal() {
   }
 }
 
+void IncrementalMarkingJob::IdleTask::RunInternal(double deadline_in_seconds) {
+  VMState<GC> state(isolate());
+  TRACE_EVENT_CALL_STATS_SCOPED(isolate(), "v8", "V8.Task");
+
+  Heap* heap = isolate()->heap();
+  {
+    base::MutexGuard guard(&job_->mutex_);
+    job_->SetTaskPending(TaskType::kIdle, false);
+  }
+
+  IncrementalMarking* incremental_marking = heap->incremental_marking();
+  if (incremental_marking->IsStopped()) return;
+
+  // Only use the slack the embedder reported for this idle period.
+  const double deadline_in_ms =
+      deadline_in_seconds *
+      static_cast<double>(base::Time::kMillisecondsPerSecond);
+  if (deadline_in_ms > heap->MonotonicallyIncreasingTimeInMs()) {
+    incremental_marking->AdvanceWithDeadline(
+        deadline_in_ms, i::IncrementalMarking::NO_GC_VIA_STACK_GUARD,
+        i::StepOrigin::kTask);
+    heap->FinalizeIncrementalMarkingIfComplete(
+        GarbageCollectionReason::kFinalizeMarkingViaTask);
+  }
+  if (!incremental_marking->IsStopped()) {
+    job_->ScheduleTask(heap, TaskType::kIdle);
+  }
+}
+
 double IncrementalMarkingJob::CurrentTimeToTask(Heap* heap) const {
   if (scheduled_time_ == 0.0) return 0.0;
 
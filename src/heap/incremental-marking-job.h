@@ -15,10 +15,12 @@ class Isolate;
 
 // The incremental marking job uses platform tasks to perform incremental
 // marking steps. The job posts a foreground task that makes a small (~1ms)
-// step and posts another task until the marking is completed.
+// step and posts another task until the marking is completed. If the platform
+// supports idle tasks, the job additionally posts idle tasks that use the
+// deadline provided by the embedder for their steps.
 class IncrementalMarkingJob final {
  public:
-  enum class TaskType { kNormal, kDelayed };
+  enum class TaskType { kNormal, kDelayed, kIdle };
 
   IncrementalMarkingJob() V8_NOEXCEPT = default;
 
@@ -30,18 +32,26 @@ class IncrementalMarkingJob final {
 
  private:
   class Task;
+  class IdleTask;
   static constexpr double kDelayInSeconds = 10.0 / 1000.0;
 
   bool IsTaskPending(TaskType task_type) const {
+    if (task_type == TaskType::kIdle) return idle_task_pending_;
     return task_type == TaskType::kNormal ? normal_task_pending_
                                           : delayed_task_pending_;
   }
 
   void SetTaskPending(TaskType task_type, bool value) {
-    if (task_type == TaskType::kNormal) {
-      normal_task_pending_ = value;
-    } else {
-      delayed_task_pending_ = value;
+    switch (task_type) {
+      case TaskType::kNormal:
+        normal_task_pending_ = value;
+        break;
+      case TaskType::kDelayed:
+        delayed_task_pending_ = value;
+        break;
+      case TaskType::kIdle:
+        idle_task_pending_ = value;
+        break;
     }
   }
 
@@ -49,6 +59,7 @@ class IncrementalMarkingJob final {
   double scheduled_time_ = 0.0;
   bool normal_task_pending_ = false;
   bool delayed_task_pending_ = false;
+  bool idle_task_pending_ = false;
 };
 }  // namespace internal
 }  // namespace v8
@@ -8,6 +8,7 @@
 
 #include "src/base/utils/random-number-generator.h"
 #include "src/codegen/compilation-cache.h"
+#include "src/codegen/flush-instruction-cache.h"
 #include "src/deoptimizer/deoptimizer.h"
 #include "src/execution/execution.h"
 #include "src/execution/frames-inl.h"
@@ -454,6 +455,7 @@ void MarkCompactCollector::SetUp() {
 void MarkCompactCollector::TearDown() {
   AbortCompaction();
   AbortWeakObjects();
+  sweeper()->TearDown();
   if (heap()->incremental_marking()->IsMarking()) {
     marking_worklists_holder()->Clear();
   }
@@ -481,6 +483,32 @@ static void TraceFragmentation(PagedSpace* space) {
          static_cast<int>(free), static_cast<double>(free) * 100 / reserved);
 }
 
+// Evacuating code requires relocating every moved Code object and flushing
+// the instruction cache for it. With --compact-code-space-min-free-percent,
+// this cost is only paid once enough of code space is free.
+static bool ShouldCompactCodeSpace(Isolate* isolate, PagedSpace* space) {
+  const int min_free_percent = FLAG_compact_code_space_min_free_percent;
+  if (min_free_percent <= 0 || FLAG_manual_evacuation_candidates_selection ||
+      FLAG_stress_compaction_random || FLAG_stress_compaction ||
+      FLAG_always_compact) {
+    return true;
+  }
+  const size_t reserved =
+      static_cast<size_t>(space->CountTotalPages()) * space->AreaSize();
+  const size_t size = space->SizeOfObjects();
+  const double free_percent =
+      reserved > size ? static_cast<double>(reserved - size) * 100 / reserved
+                      : 0.0;
+  const bool compact = free_percent >= min_free_percent;
+  if (FLAG_trace_fragmentation) {
+    PrintIsolate(isolate,
+                 "code-space-compaction: free_percent=%.1f "
+                 "min_free_percent=%d compact=%d\n",
+                 free_percent, min_free_percent, compact);
+  }
+  return compact;
+}
+
 bool MarkCompactCollector::StartCompaction() {
   if (!compacting_) {
     DCHECK(evacuation_candidates_.empty());
@@ -490,7 +518,8 @@ bool MarkCompactCollector::StartCompaction() {
 
     CollectEvacuationCandidates(heap()->old_space());
 
-    if (FLAG_compact_code_space) {
+    if (FLAG_compact_code_space &&
+        ShouldCompactCodeSpace(isolate(), heap()->code_space())) {
       CollectEvacuationCandidates(heap()->code_space());
     } else if (FLAG_trace_fragmentation) {
       TraceFragmentation(heap()->code_space());
@@ -525,7 +554,7 @@ void MarkCompactCollector::StartMarking() {
       kMainThreadTask, marking_worklists_holder());
   marking_visitor_ = std::make_unique<MarkingVisitor>(
       marking_state(), marking_worklists(), weak_objects(), heap_, epoch(),
-      Heap::GetBytecodeFlushMode(),
+      Heap::GetBytecodeFlushMode(heap_->ShouldReduceMemory()),
       heap_->local_embedder_heap_tracer()->InUse(),
       heap_->is_current_gc_forced());
 // Marking bits are cleared by the sweeper.
@@ -678,6 +707,17 @@ void MarkCompactCollector::ComputeEvacuationHeuristics(
       *target_fragmentation_percent = kTargetFragmentationPercent;
     }
     *max_evacuated_bytes = kMaxEvacuatedBytes;
+    if (FLAG_compaction_pause_budget_ms > 0 &&
+        estimated_compaction_speed != 0) {
+      // Bound the evacuation quota by the pause budget. The traced speed is
+      // per evacuator, so scale it by the number of possible evacuators.
+      const int evacuators =
+          FLAG_parallel_compaction ? NumberOfAvailableCores() : 1;
+      const double budget_bytes = estimated_compaction_speed *
+                                  FLAG_compaction_pause_budget_ms * evacuators;
+      *max_evacuated_bytes =
+          Min(*max_evacuated_bytes, static_cast<size_t>(budget_bytes));
+    }
   }
 }
 
@@ -1306,11 +1346,22 @@ class HeapObjectVisitor {
 
 class EvacuateVisitorBase : public HeapObjectVisitor {
  public:
+  ~EvacuateVisitorBase() override { DCHECK_EQ(0, pending_flush_size_); }
+
   void AddObserver(MigrationObserver* observer) {
     migration_function_ = RawMigrateObject<MigrationMode::kObserved>;
     observers_.push_back(observer);
   }
 
+  // Flushes the instruction cache for the code objects migrated since the last
+  // call. Must be called before the migrated code can be executed.
+  void FlushMigratedCode() {
+    if (pending_flush_size_ == 0) return;
+    FlushInstructionCache(pending_flush_start_, pending_flush_size_);
+    pending_flush_start_ = kNullAddress;
+    pending_flush_size_ = 0;
+  }
+
  protected:
   enum MigrationMode { kFast, kObserved };
 
@@ -1339,7 +1390,8 @@ class EvacuateVisitorBase : public HeapObjectVisitor {
     } else if (dest == CODE_SPACE) {
       DCHECK_CODEOBJECT_SIZE(size, base->heap_->code_space());
       base->heap_->CopyBlock(dst_addr, src_addr, size);
-      Code::cast(dst).Relocate(dst_addr - src_addr);
+      Code::cast(dst).RelocateNoFlush(dst_addr - src_addr);
+      base->RecordMigratedCode(dst_addr, size);
       if (mode != MigrationMode::kFast)
         base->ExecuteMigrationObservers(dest, src, dst, size);
       dst.IterateBodyFast(dst.map(), size, base->record_visitor_);
@@ -1380,6 +1432,20 @@ class EvacuateVisitorBase : public HeapObjectVisitor {
     return false;
   }
 
+  // Code objects that are migrated one after another are usually allocated
+  // back to back from the same LAB. Their instruction cache flushes are
+  // combined into a single flush of the whole range.
+  void RecordMigratedCode(Address start, int size) {
+    if (pending_flush_size_ > 0 &&
+        pending_flush_start_ + pending_flush_size_ == start) {
+      pending_flush_size_ += size;
+      return;
+    }
+    FlushMigratedCode();
+    pending_flush_start_ = start;
+    pending_flush_size_ = size;
+  }
+
   inline void ExecuteMigrationObservers(AllocationSpace dest, HeapObject src,
                                         HeapObject dst, int size) {
     for (MigrationObserver* obs : observers_) {
@@ -1416,6 +1482,8 @@ class EvacuateVisitorBase : public HeapObjectVisitor {
   RecordMigratedSlotVisitor* record_visitor_;
   std::vector<MigrationObserver*> observers_;
   MigrateFunction migration_function_;
+  Address pending_flush_start_ = kNullAddress;
+  size_t pending_flush_size_ = 0;
 };
 
 class EvacuateNewSpaceVisitor final : public EvacuateVisitorBase {
@@ -1435,6 +1503,9 @@ class EvacuateNewSpaceVisitor final : public EvacuateVisitorBase {
 
   inline bool Visit(HeapObject object, int size) override {
     if (TryEvacuateWithoutCopy(object)) return true;
+    if (V8_UNLIKELY(survivors_by_type_.enabled())) {
+      survivors_by_type_.Record(object.map().instance_type(), size);
+    }
     HeapObject target_object;
 
     if (always_promote_young_) {
@@ -1468,6 +1539,9 @@ class EvacuateNewSpaceVisitor final : public EvacuateVisitorBase {
 
   intptr_t promoted_size() { return promoted_size_; }
   intptr_t semispace_copied_size() { return semispace_copied_size_; }
+  const SurvivorStatsByType& survivors_by_type() const {
+    return survivors_by_type_;
+  }
 
  private:
   inline bool TryEvacuateWithoutCopy(HeapObject object) {
@@ -1518,6 +1592,7 @@ class EvacuateNewSpaceVisitor final : public EvacuateVisitorBase {
   LocalAllocationBuffer buffer_;
   intptr_t promoted_size_;
   intptr_t semispace_copied_size_;
+  SurvivorStatsByType survivors_by_type_;
   Heap::PretenuringFeedbackMap* local_pretenuring_feedback_;
   bool is_incremental_marking_;
   bool always_promote_young_;
@@ -1551,6 +1626,9 @@ class EvacuateNewSpacePageVisitor final : public HeapObjectVisitor {
   }
 
   inline bool Visit(HeapObject object, int size) override {
+    if (V8_UNLIKELY(survivors_by_type_.enabled())) {
+      survivors_by_type_.Record(object.map().instance_type(), size);
+    }
     if (mode == NEW_TO_NEW) {
       heap_->UpdateAllocationSite(object.map(), object,
                                   local_pretenuring_feedback_);
@@ -1565,11 +1643,15 @@ class EvacuateNewSpacePageVisitor final : public HeapObjectVisitor {
 
   intptr_t moved_bytes() { return moved_bytes_; }
   void account_moved_bytes(intptr_t bytes) { moved_bytes_ += bytes; }
+  const SurvivorStatsByType& survivors_by_type() const {
+    return survivors_by_type_;
+  }
 
  private:
   Heap* heap_;
   RecordMigratedSlotVisitor* record_visitor_;
   intptr_t moved_bytes_;
+  SurvivorStatsByType survivors_by_type_;
   Heap::PretenuringFeedbackMap* local_pretenuring_feedback_;
 };
 
@@ -2276,6 +2358,7 @@ void MarkCompactCollector::ClearOldBytecodeCandidates() {
     if (!non_atomic_marking_state()->IsBlackOrGrey(
             flushing_candidate.GetBytecodeArray())) {
       FlushBytecodeFromSFI(flushing_candidate);
+      isolate()->counters()->bytecode_arrays_flushed()->Increment();
     }
 
     // Now record the slot, which has either been updated to an uncompiled data,
@@ -2987,6 +3070,9 @@ void Evacuator::EvacuatePage(MemoryChunk* chunk) {
     AlwaysAllocateScope always_allocate(heap());
     TimedScope timed_scope(&evacuation_time);
     RawEvacuatePage(chunk, &saved_live_bytes);
+    // Flush the instruction cache once for the code that was migrated from
+    // this page instead of once per code object.
+    old_space_visitor_.FlushMigratedCode();
   }
   ReportCompactionProgress(evacuation_time, saved_live_bytes);
   if (FLAG_trace_evacuation) {
@@ -3019,6 +3105,11 @@ void Evacuator::Finalize() {
       new_to_old_page_visitor_.moved_bytes() +
       new_to_new_page_visitor_.moved_bytes());
   heap()->MergeAllocationSitePretenuringFeedback(local_pretenuring_feedback_);
+  heap()->MergeYoungSurvivorsByType(new_space_visitor_.survivors_by_type());
+  heap()->MergeYoungSurvivorsByType(
+      new_to_new_page_visitor_.survivors_by_type());
+  heap()->MergeYoungSurvivorsByType(
+      new_to_old_page_visitor_.survivors_by_type());
 }
 
 class FullEvacuator : public Evacuator {
@@ -5237,12 +5328,20 @@ void MinorMarkCompactCollector::EvacuatePagesInParallel() {
                                  &page_parallel_job_semaphore_);
   intptr_t live_bytes = 0;
 
+  // With high survival rates most objects would be copied twice before being
+  // promoted. Avoid this by promoting dense pages directly, independent of the
+  // age mark.
+  const bool promote_young =
+      FLAG_minor_mc_high_survival_promotion &&
+      heap()->tracer()->AverageSurvivalRatio() >=
+          Heap::kMinPromotedPercentForFastPromotionMode;
   for (Page* page : new_space_evacuation_pages_) {
     intptr_t live_bytes_on_page = non_atomic_marking_state()->live_bytes(page);
     if (live_bytes_on_page == 0 && !page->contains_array_buffers()) continue;
     live_bytes += live_bytes_on_page;
-    if (ShouldMovePage(page, live_bytes_on_page, false)) {
-      if (page->IsFlagSet(MemoryChunk::NEW_SPACE_BELOW_AGE_MARK)) {
+    if (ShouldMovePage(page, live_bytes_on_page, promote_young)) {
+      if (page->IsFlagSet(MemoryChunk::NEW_SPACE_BELOW_AGE_MARK) ||
+          promote_young) {
         EvacuateNewSpacePageVisitor<NEW_TO_OLD>::Move(page);
       } else {
         EvacuateNewSpacePageVisitor<NEW_TO_NEW>::Move(page);
@@ -127,6 +127,13 @@ void MemoryAllocator::InitializeCodePageAllocator(
       page_allocator, aligned_base, size,
       static_cast<size_t>(MemoryChunk::kAlignment));
   code_page_allocator_ = code_page_allocator_instance_.get();
+
+  if (FLAG_transparent_huge_pages) {
+    // Code pages are small compared to huge pages, so this mostly reduces
+    // iTLB pressure for hot regions that are densely packed with code.
+    USE(code_page_allocator_->AdviseHugePages(
+        reinterpret_cast<void*>(aligned_base), size));
+  }
 }
 
 void MemoryAllocator::TearDown() {
@@ -247,10 +254,59 @@ bool MemoryAllocator::Unmapper::MakeRoomForNewTasks() {
 void MemoryAllocator::Unmapper::PerformFreeMemoryOnQueuedNonRegularChunks() {
   MemoryChunk* chunk = nullptr;
   while ((chunk = GetMemoryChunkSafe<kNonRegular>()) != nullptr) {
+    // Pooled chunks are only uncommitted by PerformFreeMemory.
+    if (TryPoolLargeChunk(chunk)) chunk->SetFlag(MemoryChunk::POOLED);
     allocator_->PerformFreeMemory(chunk);
   }
 }
 
+bool MemoryAllocator::Unmapper::TryPoolLargeChunk(MemoryChunk* chunk) {
+  if (FLAG_large_page_pool_size == 0 || !chunk->IsLargePage() ||
+      chunk->executable() == EXECUTABLE) {
+    return false;
+  }
+  const base::AddressRegion region = chunk->reserved_memory()->region();
+  const size_t max_pool_size =
+      static_cast<size_t>(FLAG_large_page_pool_size) * MB;
+  base::MutexGuard guard(&mutex_);
+  if (pooled_large_chunks_size_ + region.size() > max_pool_size) return false;
+  pooled_large_chunks_.push_back(region);
+  pooled_large_chunks_size_ += region.size();
+  return true;
+}
+
+Address MemoryAllocator::Unmapper::TryGetPooledLargeChunkSafe(
+    size_t reserved_size) {
+  base::MutexGuard guard(&mutex_);
+  for (auto it = pooled_large_chunks_.begin(); it != pooled_large_chunks_.end();
+       ++it) {
+    if (it->size() != reserved_size) continue;
+    const Address start = it->begin();
+    pooled_large_chunks_.erase(it);
+    pooled_large_chunks_size_ -= reserved_size;
+    return start;
+  }
+  return kNullAddress;
+}
+
+void MemoryAllocator::Unmapper::ReleasePooledLargeChunks() {
+  std::vector<base::AddressRegion> regions;
+  {
+    base::MutexGuard guard(&mutex_);
+    regions.swap(pooled_large_chunks_);
+    pooled_large_chunks_size_ = 0;
+  }
+  for (const base::AddressRegion& region : regions) {
+    allocator_->FreeMemory(allocator_->data_page_allocator(), region.begin(),
+                           region.size());
+  }
+}
+
+size_t MemoryAllocator::Unmapper::PooledLargeChunksSize() {
+  base::MutexGuard guard(&mutex_);
+  return pooled_large_chunks_size_;
+}
+
 template <MemoryAllocator::Unmapper::FreeMode mode>
 void MemoryAllocator::Unmapper::PerformFreeMemoryOnQueuedChunks() {
   MemoryChunk* chunk = nullptr;
@@ -275,6 +331,9 @@ void MemoryAllocator::Unmapper::PerformFreeMemoryOnQueuedChunks() {
     }
   }
   PerformFreeMemoryOnQueuedNonRegularChunks();
+  if (mode == MemoryAllocator::Unmapper::FreeMode::kReleasePooled) {
+    ReleasePooledLargeChunks();
+  }
 }
 
 void MemoryAllocator::Unmapper::TearDown() {
@@ -283,6 +342,7 @@ void MemoryAllocator::Unmapper::TearDown() {
   for (int i = 0; i < kNumberOfChunkQueues; i++) {
     DCHECK(chunks_[i].empty());
   }
+  DCHECK(pooled_large_chunks_.empty());
 }
 
 size_t MemoryAllocator::Unmapper::NumberOfCommittedChunks() {
@@ -674,11 +734,52 @@ ReadOnlyPage* MemoryAllocator::AllocateReadOnlyPage(size_t size,
 LargePage* MemoryAllocator::AllocateLargePage(size_t size,
                                               LargeObjectSpace* owner,
                                               Executability executable) {
-  MemoryChunk* chunk = AllocateChunk(size, size, executable, owner);
+  MemoryChunk* chunk = nullptr;
+  if (FLAG_large_page_pool_size > 0 && executable == NOT_EXECUTABLE) {
+    chunk = AllocateLargePagePooled(size, owner);
+  }
+  if (chunk == nullptr) {
+    chunk = AllocateChunk(size, size, executable, owner);
+  }
   if (chunk == nullptr) return nullptr;
   return LargePage::Initialize(isolate_->heap(), chunk, executable);
 }
 
+MemoryChunk* MemoryAllocator::AllocateLargePagePooled(size_t size,
+                                                      LargeObjectSpace* owner) {
+  const size_t chunk_size = ::RoundUp(
+      MemoryChunkLayout::ObjectStartOffsetInDataPage() + size,
+      GetCommitPageSize());
+  // Pooled chunks are keyed by the size of their reservation, which may be
+  // larger than the chunk itself.
+  const size_t reserved_size =
+      ::RoundUp(chunk_size, data_page_allocator()->AllocatePageSize());
+  const Address start = unmapper()->TryGetPooledLargeChunkSafe(reserved_size);
+  if (start == kNullAddress) return nullptr;
+  const Address area_start =
+      start + MemoryChunkLayout::ObjectStartOffsetInDataPage();
+  const Address area_end = area_start + size;
+  VirtualMemory reservation(data_page_allocator(), start, reserved_size);
+  if (!CommitMemory(&reservation)) {
+    reservation.Free();
+    return nullptr;
+  }
+  if (Heap::ShouldZapGarbage()) {
+    ZapBlock(start, MemoryChunkLayout::ObjectStartOffsetInDataPage() + size,
+             kZapValue);
+  }
+  LOG(isolate_,
+      NewEvent("MemoryChunk", reinterpret_cast<void*>(start), chunk_size));
+  BasicMemoryChunk* basic_chunk =
+      BasicMemoryChunk::Initialize(isolate_->heap(), start, chunk_size,
+                                   area_start, area_end, owner,
+                                   std::move(reservation));
+  MemoryChunk* chunk =
+      MemoryChunk::Initialize(basic_chunk, isolate_->heap(), NOT_EXECUTABLE);
+  size_ += reserved_size;
+  return chunk;
+}
+
 template <typename SpaceType>
 MemoryChunk* MemoryAllocator::AllocatePagePooled(SpaceType* owner) {
   MemoryChunk* chunk = unmapper()->TryGetPooledMemoryChunkSafe();
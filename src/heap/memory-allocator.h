@@ -97,6 +97,10 @@ class MemoryAllocator {
       return chunk;
     }
 
+    // Returns the start of an uncommitted large chunk reservation of exactly
+    // |reserved_size| bytes that can be reused, or kNullAddress.
+    Address TryGetPooledLargeChunkSafe(size_t reserved_size);
+
     V8_EXPORT_PRIVATE void FreeQueuedChunks();
     void CancelAndWaitForPendingTasks();
     void PrepareForGC();
@@ -105,6 +109,7 @@ class MemoryAllocator {
     size_t NumberOfCommittedChunks();
     V8_EXPORT_PRIVATE int NumberOfChunks();
     size_t CommittedBufferedMemory();
+    V8_EXPORT_PRIVATE size_t PooledLargeChunksSize();
 
    private:
     static const int kReservedQueueingSlots = 64;
@@ -145,10 +150,19 @@ class MemoryAllocator {
 
     void PerformFreeMemoryOnQueuedNonRegularChunks();
 
+    // Keeps the reservation of a non-executable large chunk for reuse if the
+    // pool has room for it. The chunk is uncommitted by the caller.
+    bool TryPoolLargeChunk(MemoryChunk* chunk);
+    void ReleasePooledLargeChunks();
+
     Heap* const heap_;
     MemoryAllocator* const allocator_;
     base::Mutex mutex_;
     std::vector<MemoryChunk*> chunks_[kNumberOfChunkQueues];
+    // Reservations of uncommitted large chunks. Their headers are not
+    // accessible anymore, so the regions are kept on the side.
+    std::vector<base::AddressRegion> pooled_large_chunks_;
+    size_t pooled_large_chunks_size_ = 0;
     CancelableTaskManager::Id task_ids_[kMaxUnmapperTasks];
     base::Semaphore pending_unmapping_tasks_semaphore_;
     intptr_t pending_unmapping_tasks_;
@@ -190,8 +204,9 @@ class MemoryAllocator {
   EXPORT_TEMPLATE_DECLARE(V8_EXPORT_PRIVATE)
   Page* AllocatePage(size_t size, SpaceType* owner, Executability executable);
 
-  LargePage* AllocateLargePage(size_t size, LargeObjectSpace* owner,
-                               Executability executable);
+  V8_EXPORT_PRIVATE LargePage* AllocateLargePage(size_t size,
+                                                 LargeObjectSpace* owner,
+                                                 Executability executable);
 
   ReadOnlyPage* AllocateReadOnlyPage(size_t size, ReadOnlySpace* owner);
 
@@ -322,6 +337,10 @@ class MemoryAllocator {
   template <typename SpaceType>
   MemoryChunk* AllocatePagePooled(SpaceType* owner);
 
+  // Tries to reuse a pooled large chunk reservation for a non-executable large
+  // page of the given area size.
+  MemoryChunk* AllocateLargePagePooled(size_t size, LargeObjectSpace* owner);
+
   // Initializes pages in a chunk. Returns the first page address.
   // This function and GetChunkId() are provided for the mark-compact
   // collector to rebuild page headers in the from space, which is
@@ -31,6 +31,11 @@ class ReadOnlySpace;
 
 // This class transparently manages read-only space, roots and cache creation
 // and destruction.
+// TODO(v8:7464): Only read-only space is shared between isolates. Immutable
+// objects that are deserialized into old space (e.g. internalized strings of
+// the startup snapshot and the string table itself) are still copied into
+// every isolate. Sharing them requires a shared space that is collected
+// independently of the isolates using it.
 class ReadOnlyHeap final {
  public:
   static constexpr size_t kEntriesCount =
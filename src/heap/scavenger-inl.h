@@ -83,6 +83,16 @@ bool Scavenger::PromotionList::IsGlobalPoolEmpty() {
          large_object_promotion_list_.IsGlobalPoolEmpty();
 }
 
+size_t Scavenger::PromotionList::GlobalPoolSize() const {
+  return regular_object_promotion_list_.GlobalPoolSize() +
+         large_object_promotion_list_.GlobalPoolSize();
+}
+
+void Scavenger::PromotionList::FlushToGlobal(int task_id) {
+  regular_object_promotion_list_.FlushToGlobal(task_id);
+  large_object_promotion_list_.FlushToGlobal(task_id);
+}
+
 bool Scavenger::PromotionList::ShouldEagerlyProcessPromotionList(int task_id) {
   // Threshold when to prioritize processing of the promotion list. Right
   // now we only look into the regular object list.
@@ -157,6 +167,7 @@ CopyAndForwardResult Scavenger::SemiSpaceCopyObject(
       copied_list_.Push(ObjectAndSize(target, object_size));
     }
     copied_size_ += object_size;
+    survivors_by_type_.Record(map.instance_type(), object_size);
     return CopyAndForwardResult::SUCCESS_YOUNG_GENERATION;
   }
   return CopyAndForwardResult::FAILURE;
@@ -193,6 +204,7 @@ CopyAndForwardResult Scavenger::PromoteObject(Map map, THeapObjectSlot slot,
       promotion_list_.PushRegularObject(target, object_size);
     }
     promoted_size_ += object_size;
+    survivors_by_type_.Record(map.instance_type(), object_size);
     return CopyAndForwardResult::SUCCESS_OLD_GENERATION;
   }
   return CopyAndForwardResult::FAILURE;
@@ -218,6 +230,7 @@ bool Scavenger::HandleLargeObject(Map map, HeapObject object, int object_size,
             MapWord::FromMap(map), MapWord::FromForwardingAddress(object))) {
       surviving_new_large_objects_.insert({object, map});
       promoted_size_ += object_size;
+      survivors_by_type_.Record(map.instance_type(), object_size);
       if (object_fields == ObjectFields::kMaybePointers) {
         promotion_list_.PushLargeObject(object, map, object_size);
       }
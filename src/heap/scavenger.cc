@@ -6,11 +6,9 @@
 
 #include "src/heap/array-buffer-collector.h"
 #include "src/heap/array-buffer-sweeper.h"
-#include "src/heap/barrier.h"
 #include "src/heap/gc-tracer.h"
 #include "src/heap/heap-inl.h"
 #include "src/heap/invalidated-slots-inl.h"
-#include "src/heap/item-parallel-job.h"
 #include "src/heap/mark-compact-inl.h"
 #include "src/heap/memory-chunk-inl.h"
 #include "src/heap/objects-visiting-inl.h"
@@ -26,63 +24,158 @@
 namespace v8 {
 namespace internal {
 
-class PageScavengingItem final : public ItemParallelJob::Item {
+// Scavenges old-to-new slots of the given pages and then drains the shared
+// copied and promotion worklists. Each Scavenger owns task local worklist
+// segments and allocation buffers, so a worker has exclusive access to one
+// Scavenger while it runs. Concurrency is bounded by the number of Scavengers
+// and otherwise follows the amount of remaining work.
+//
+// The slot sets of large pages can be arbitrarily big, so they are split into
+// ranges of kBucketsPerItem buckets that are processed independently. The
+// worker finishing the last range of a page finalizes it.
+class ScavengerCollector::JobTask : public v8::JobTask {
  public:
-  explicit PageScavengingItem(MemoryChunk* chunk) : chunk_(chunk) {}
-  ~PageScavengingItem() override = default;
-
-  void Process(Scavenger* scavenger) { scavenger->ScavengePage(chunk_); }
-
- private:
-  MemoryChunk* const chunk_;
-};
+  // 512 buckets cover 2MB (4MB) of the page with (without) pointer
+  // compression.
+  static constexpr size_t kBucketsPerItem = 512;
+  STATIC_ASSERT(kBucketsPerItem % PossiblyEmptyBuckets::kBucketsPerWord == 0);
+
+  JobTask(ScavengerCollector* outer, Scavenger** scavengers,
+          int num_scavengers, const std::vector<MemoryChunk*>& memory_chunks,
+          Scavenger::CopiedList* copied_list,
+          Scavenger::PromotionList* promotion_list)
+      : outer_(outer),
+        copied_list_(copied_list),
+        promotion_list_(promotion_list),
+        num_scavengers_(static_cast<size_t>(num_scavengers)),
+        idle_scavengers_(scavengers, scavengers + num_scavengers) {
+    size_t num_split_pages = 0;
+    for (MemoryChunk* chunk : memory_chunks) {
+      if (ShouldSplit(chunk)) num_split_pages++;
+    }
+    pending_ranges_ =
+        std::make_unique<std::atomic<size_t>[]>(num_split_pages);
+    size_t split_index = 0;
+    for (MemoryChunk* chunk : memory_chunks) {
+      if (!ShouldSplit(chunk)) {
+        items_.push_back({chunk, 0, 0, nullptr});
+        continue;
+      }
+      const size_t buckets = chunk->buckets();
+      chunk->possibly_empty_buckets()->AllocateForConcurrentInsert(buckets);
+      std::atomic<size_t>* pending = &pending_ranges_[split_index++];
+      pending->store((buckets + kBucketsPerItem - 1) / kBucketsPerItem,
+                     std::memory_order_relaxed);
+      for (size_t start = 0; start < buckets; start += kBucketsPerItem) {
+        items_.push_back(
+            {chunk, start, std::min(start + kBucketsPerItem, buckets),
+             pending});
+      }
+    }
+  }
 
-class ScavengingTask final : public ItemParallelJob::Task {
- public:
-  ScavengingTask(Heap* heap, Scavenger* scavenger, OneshotBarrier* barrier)
-      : ItemParallelJob::Task(heap->isolate()),
-        heap_(heap),
-        scavenger_(scavenger),
-        barrier_(barrier) {}
-
-  void RunInParallel(Runner runner) final {
-    if (runner == Runner::kForeground) {
-      TRACE_GC(heap_->tracer(), GCTracer::Scope::SCAVENGER_SCAVENGE_PARALLEL);
-      ProcessItems();
+  void Run(JobDelegate* delegate) override {
+    Scavenger* scavenger = AcquireScavenger();
+    if (scavenger == nullptr) return;
+    if (outer_->isolate_->thread_id() == ThreadId::Current()) {
+      TRACE_GC(outer_->heap_->tracer(),
+               GCTracer::Scope::SCAVENGER_SCAVENGE_PARALLEL);
+      ProcessItems(delegate, scavenger);
     } else {
       TRACE_BACKGROUND_GC(
-          heap_->tracer(),
+          outer_->heap_->tracer(),
           GCTracer::BackgroundScope::SCAVENGER_BACKGROUND_SCAVENGE_PARALLEL);
-      ProcessItems();
+      ProcessItems(delegate, scavenger);
     }
+    ReleaseScavenger(scavenger);
+  }
+
+  size_t GetMaxConcurrency() const override {
+    const size_t next_item =
+        std::min(next_item_.load(std::memory_order_relaxed), items_.size());
+    const size_t remaining_items = items_.size() - next_item;
+    // Active workers may still publish objects from their local segments.
+    const size_t remaining_objects =
+        active_workers_.load(std::memory_order_relaxed) +
+        copied_list_->GlobalPoolSize() + promotion_list_->GlobalPoolSize();
+    return std::min(num_scavengers_,
+                    std::max(remaining_items, remaining_objects));
   }
 
  private:
-  void ProcessItems() {
+  // Either a whole page ({pending_ranges} is null) or the bucket range
+  // [start_bucket, end_bucket) of a split large page.
+  struct Item {
+    MemoryChunk* chunk;
+    size_t start_bucket;
+    size_t end_bucket;
+    std::atomic<size_t>* pending_ranges;
+  };
+
+  static bool ShouldSplit(MemoryChunk* chunk) {
+    return chunk->IsLargePage() &&
+           !chunk->IsFlagSet(MemoryChunk::IS_EXECUTABLE) &&
+           chunk->slot_set<OLD_TO_NEW, AccessMode::NON_ATOMIC>() != nullptr &&
+           chunk->buckets() > kBucketsPerItem;
+  }
+
+  void ProcessItems(JobDelegate* delegate, Scavenger* scavenger) {
     double scavenging_time = 0.0;
+    size_t items = 0;
     {
-      barrier_->Start();
       TimedScope scope(&scavenging_time);
-      PageScavengingItem* item = nullptr;
-      while ((item = GetItem<PageScavengingItem>()) != nullptr) {
-        item->Process(scavenger_);
-        item->MarkFinished();
+      size_t index;
+      while ((index = next_item_.fetch_add(1, std::memory_order_relaxed)) <
+             items_.size()) {
+        const Item& item = items_[index];
+        items++;
+        if (item.pending_ranges == nullptr) {
+          scavenger->ScavengePage(item.chunk);
+          continue;
+        }
+        scavenger->ScavengePageRange(item.chunk, item.start_bucket,
+                                     item.end_bucket);
+        if (item.pending_ranges->fetch_sub(1, std::memory_order_acq_rel) ==
+            1) {
+          scavenger->FinalizeScavengedPageRanges(item.chunk);
+        }
       }
-      do {
-        scavenger_->Process(barrier_);
-      } while (!barrier_->Wait());
-      scavenger_->Process();
+      scavenger->Process(delegate);
     }
     if (FLAG_trace_parallel_scavenge) {
-      PrintIsolate(heap_->isolate(),
-                   "scavenge[%p]: time=%.2f copied=%zu promoted=%zu\n",
-                   static_cast<void*>(this), scavenging_time,
-                   scavenger_->bytes_copied(), scavenger_->bytes_promoted());
+      PrintIsolate(outer_->isolate_,
+                   "scavenge[%p]: time=%.2f items=%zu copied=%zu "
+                   "promoted=%zu\n",
+                   static_cast<void*>(scavenger), scavenging_time, items,
+                   scavenger->bytes_copied(), scavenger->bytes_promoted());
     }
   }
-  Heap* const heap_;
-  Scavenger* const scavenger_;
-  OneshotBarrier* const barrier_;
+
+  Scavenger* AcquireScavenger() {
+    base::MutexGuard guard(&idle_scavengers_mutex_);
+    if (idle_scavengers_.empty()) return nullptr;
+    Scavenger* scavenger = idle_scavengers_.back();
+    idle_scavengers_.pop_back();
+    active_workers_++;
+    return scavenger;
+  }
+
+  void ReleaseScavenger(Scavenger* scavenger) {
+    base::MutexGuard guard(&idle_scavengers_mutex_);
+    idle_scavengers_.push_back(scavenger);
+    active_workers_--;
+  }
+
+  ScavengerCollector* const outer_;
+  std::vector<Item> items_;
+  std::unique_ptr<std::atomic<size_t>[]> pending_ranges_;
+  std::atomic<size_t> next_item_{0};
+  std::atomic<size_t> active_workers_{0};
+  Scavenger::CopiedList* const copied_list_;
+  Scavenger::PromotionList* const promotion_list_;
+  const size_t num_scavengers_;
+  base::Mutex idle_scavengers_mutex_;
+  std::vector<Scavenger*> idle_scavengers_;
 };
 
 class IterateAndScavengePromotedObjectsVisitor final : public ObjectVisitor {
@@ -221,7 +314,7 @@ class ScavengeWeakObjectRetainer : public WeakObjectRetainer {
 };
 
 ScavengerCollector::ScavengerCollector(Heap* heap)
-    : isolate_(heap->isolate()), heap_(heap), parallel_scavenge_semaphore_(0) {}
+    : isolate_(heap->isolate()), heap_(heap) {}
 
 // Remove this crashkey after chromium:1010312 is fixed.
 class ScopedFullHeapCrashKey {
@@ -247,13 +340,10 @@ void ScavengerCollector::CollectGarbage() {
   }
 
   DCHECK(surviving_new_large_objects_.empty());
-  ItemParallelJob job(isolate_->cancelable_task_manager(),
-                      &parallel_scavenge_semaphore_);
   const int kMainThreadId = 0;
   Scavenger* scavengers[kMaxScavengerTasks];
   const bool is_logging = isolate_->LogObjectRelocation();
   const int num_scavenge_tasks = NumberOfScavengeTasks();
-  OneshotBarrier barrier(base::TimeDelta::FromMilliseconds(kMaxWaitTimeMs));
   Worklist<MemoryChunk*, 64> empty_chunks;
   Scavenger::CopiedList copied_list(num_scavenge_tasks);
   Scavenger::PromotionList promotion_list(num_scavenge_tasks);
@@ -262,7 +352,6 @@ void ScavengerCollector::CollectGarbage() {
     scavengers[i] =
         new Scavenger(this, heap_, is_logging, &empty_chunks, &copied_list,
                       &promotion_list, &ephemeron_table_list, i);
-    job.AddTask(new ScavengingTask(heap_, scavengers[i], &barrier));
   }
 
   {
@@ -290,9 +379,10 @@ void ScavengerCollector::CollectGarbage() {
       return !page->ContainsSlots<OLD_TO_NEW>() && !page->sweeping_slot_set();
     });
 
+    std::vector<MemoryChunk*> memory_chunks;
     RememberedSet<OLD_TO_NEW>::IterateMemoryChunks(
-        heap_, [&job](MemoryChunk* chunk) {
-          job.AddItem(new PageScavengingItem(chunk));
+        heap_, [&memory_chunks](MemoryChunk* chunk) {
+          memory_chunks.push_back(chunk);
         });
 
     RootScavengeVisitor root_scavenge_visitor(scavengers[kMainThreadId]);
@@ -324,7 +414,16 @@ void ScavengerCollector::CollectGarbage() {
     {
       // Parallel phase scavenging all copied and promoted objects.
       TRACE_GC(heap_->tracer(), GCTracer::Scope::SCAVENGER_SCAVENGE_PARALLEL);
-      job.Run();
+      // Objects reached from roots are in the main thread's local segments.
+      // Publish them so that any worker can pick them up.
+      copied_list.FlushToGlobal(kMainThreadId);
+      promotion_list.FlushToGlobal(kMainThreadId);
+      V8::GetCurrentPlatform()
+          ->PostJob(v8::TaskPriority::kUserBlocking,
+                    std::make_unique<JobTask>(this, scavengers,
+                                              num_scavenge_tasks, memory_chunks,
+                                              &copied_list, &promotion_list))
+          ->Join();
       DCHECK(copied_list.IsEmpty());
       DCHECK(promotion_list.IsEmpty());
     }
@@ -556,19 +655,48 @@ void Scavenger::AddPageToSweeperIfNecessary(MemoryChunk* page) {
 }
 
 void Scavenger::ScavengePage(MemoryChunk* page) {
-  CodePageMemoryModificationScope memory_modification_scope(page);
-
-  if (page->slot_set<OLD_TO_NEW, AccessMode::NON_ATOMIC>() != nullptr) {
-    InvalidatedSlotsFilter filter = InvalidatedSlotsFilter::OldToNew(page);
-    RememberedSet<OLD_TO_NEW>::IterateAndTrackEmptyBuckets(
-        page,
-        [this, &filter](MaybeObjectSlot slot) {
-          if (!filter.IsValid(slot.address())) return REMOVE_SLOT;
-          return CheckAndScavengeObject(heap_, slot);
-        },
-        empty_chunks_);
+  {
+    CodePageMemoryModificationScope memory_modification_scope(page);
+    if (page->slot_set<OLD_TO_NEW, AccessMode::NON_ATOMIC>() != nullptr) {
+      InvalidatedSlotsFilter filter = InvalidatedSlotsFilter::OldToNew(page);
+      RememberedSet<OLD_TO_NEW>::IterateAndTrackEmptyBuckets(
+          page,
+          [this, &filter](MaybeObjectSlot slot) {
+            if (!filter.IsValid(slot.address())) return REMOVE_SLOT;
+            return CheckAndScavengeObject(heap_, slot);
+          },
+          empty_chunks_);
+    }
   }
 
+  FinalizeScavengedPage(page);
+}
+
+void Scavenger::ScavengePageRange(MemoryChunk* page, size_t start_bucket,
+                                  size_t end_bucket) {
+  DCHECK(page->IsLargePage());
+  DCHECK(!page->IsFlagSet(MemoryChunk::IS_EXECUTABLE));
+  DCHECK_EQ(0, start_bucket % PossiblyEmptyBuckets::kBucketsPerWord);
+  SlotSet* slot_set = page->slot_set<OLD_TO_NEW, AccessMode::NON_ATOMIC>();
+  DCHECK_NOT_NULL(slot_set);
+  InvalidatedSlotsFilter filter = InvalidatedSlotsFilter::OldToNew(page);
+  slot_set->IterateAndTrackEmptyBuckets(
+      page->address(), start_bucket, end_bucket,
+      [this, &filter](MaybeObjectSlot slot) {
+        if (!filter.IsValid(slot.address())) return REMOVE_SLOT;
+        return CheckAndScavengeObject(heap_, slot);
+      },
+      page->possibly_empty_buckets());
+}
+
+void Scavenger::FinalizeScavengedPageRanges(MemoryChunk* page) {
+  if (!page->possibly_empty_buckets()->IsEmpty()) empty_chunks_.Push(page);
+  FinalizeScavengedPage(page);
+}
+
+void Scavenger::FinalizeScavengedPage(MemoryChunk* page) {
+  CodePageMemoryModificationScope memory_modification_scope(page);
+
   if (page->sweeping_slot_set<AccessMode::NON_ATOMIC>() != nullptr) {
     InvalidatedSlotsFilter filter = InvalidatedSlotsFilter::OldToNew(page);
     RememberedSetSweeping::Iterate(
@@ -597,10 +725,9 @@ void Scavenger::ScavengePage(MemoryChunk* page) {
   AddPageToSweeperIfNecessary(page);
 }
 
-void Scavenger::Process(OneshotBarrier* barrier) {
+void Scavenger::Process(JobDelegate* delegate) {
   ScavengeVisitor scavenge_visitor(this);
 
-  const bool have_barrier = barrier != nullptr;
   bool done;
   size_t objects = 0;
   do {
@@ -610,9 +737,9 @@ void Scavenger::Process(OneshotBarrier* barrier) {
            copied_list_.Pop(&object_and_size)) {
       scavenge_visitor.Visit(object_and_size.first);
       done = false;
-      if (have_barrier && ((++objects % kInterruptThreshold) == 0)) {
+      if (delegate && ((++objects % kInterruptThreshold) == 0)) {
         if (!copied_list_.IsGlobalPoolEmpty()) {
-          barrier->NotifyAll();
+          delegate->NotifyConcurrencyIncrease();
         }
       }
     }
@@ -622,9 +749,9 @@ void Scavenger::Process(OneshotBarrier* barrier) {
       HeapObject target = entry.heap_object;
       IterateAndScavengePromotedObject(target, entry.map, entry.size);
       done = false;
-      if (have_barrier && ((++objects % kInterruptThreshold) == 0)) {
+      if (delegate && ((++objects % kInterruptThreshold) == 0)) {
         if (!promotion_list_.IsGlobalPoolEmpty()) {
-          barrier->NotifyAll();
+          delegate->NotifyConcurrencyIncrease();
         }
       }
     }
@@ -698,6 +825,7 @@ void Scavenger::Finalize() {
   heap()->MergeAllocationSitePretenuringFeedback(local_pretenuring_feedback_);
   heap()->IncrementSemiSpaceCopiedObjectSize(copied_size_);
   heap()->IncrementPromotedObjectsSize(promoted_size_);
+  heap()->MergeYoungSurvivorsByType(survivors_by_type_);
   collector_->MergeSurvivingNewLargeObjects(surviving_new_large_objects_);
   allocator_.Finalize();
   empty_chunks_.FlushToGlobal();
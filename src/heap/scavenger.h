@@ -5,16 +5,17 @@
 #ifndef V8_HEAP_SCAVENGER_H_
 #define V8_HEAP_SCAVENGER_H_
 
+#include "include/v8-platform.h"
 #include "src/base/platform/condition-variable.h"
 #include "src/heap/local-allocator.h"
 #include "src/heap/objects-visiting.h"
 #include "src/heap/slot-set.h"
+#include "src/heap/survivor-stats.h"
 #include "src/heap/worklist.h"
 
 namespace v8 {
 namespace internal {
 
-class OneshotBarrier;
 class RootScavengeVisitor;
 class Scavenger;
 
@@ -36,13 +37,14 @@ using EphemeronTableList =
 class ScavengerCollector {
  public:
   static const int kMaxScavengerTasks = 8;
-  static const int kMaxWaitTimeMs = 2;
 
   explicit ScavengerCollector(Heap* heap);
 
   void CollectGarbage();
 
  private:
+  class JobTask;
+
   void MergeSurvivingNewLargeObjects(
       const SurvivingNewLargeObjectsMap& objects);
 
@@ -60,7 +62,6 @@ class ScavengerCollector {
                                int main_thread_id);
   Isolate* const isolate_;
   Heap* const heap_;
-  base::Semaphore parallel_scavenge_semaphore_;
   SurvivingNewLargeObjectsMap surviving_new_large_objects_;
 
   friend class Scavenger;
@@ -105,6 +106,8 @@ class Scavenger {
     inline size_t LocalPushSegmentSize(int task_id);
     inline bool Pop(int task_id, struct PromotionListEntry* entry);
     inline bool IsGlobalPoolEmpty();
+    inline size_t GlobalPoolSize() const;
+    inline void FlushToGlobal(int task_id);
     inline bool ShouldEagerlyProcessPromotionList(int task_id);
 
    private:
@@ -132,9 +135,20 @@ class Scavenger {
   // objects see RootScavengingVisitor and ScavengeVisitor below.
   void ScavengePage(MemoryChunk* page);
 
+  // Scavenges the old-to-new slot set of a large page in the buckets
+  // [start_bucket, end_bucket). Several Scavengers may process disjoint ranges
+  // of the same page concurrently; the page's possibly empty buckets must be
+  // allocated for concurrent insertion. Once all ranges are done,
+  // FinalizeScavengedPageRanges needs to be called on the page exactly once.
+  void ScavengePageRange(MemoryChunk* page, size_t start_bucket,
+                         size_t end_bucket);
+  void FinalizeScavengedPageRanges(MemoryChunk* page);
+
   // Processes remaining work (=objects) after single objects have been
-  // manually scavenged using ScavengeObject or CheckAndScavengeObject.
-  void Process(OneshotBarrier* barrier = nullptr);
+  // manually scavenged using ScavengeObject or CheckAndScavengeObject. When
+  // running as part of a job, |delegate| is notified whenever work becomes
+  // available to other workers.
+  void Process(JobDelegate* delegate = nullptr);
 
   // Finalize the Scavenger. Needs to be called from the main thread.
   void Finalize();
@@ -156,6 +170,10 @@ class Scavenger {
 
   void AddPageToSweeperIfNecessary(MemoryChunk* page);
 
+  // Processes the sweeping and typed old-to-new slots of a page after its
+  // old-to-new slot set was scavenged, and hands the page back to the sweeper.
+  void FinalizeScavengedPage(MemoryChunk* page);
+
   // Potentially scavenges an object referenced from |slot| if it is
   // indeed a HeapObject and resides in from space.
   template <typename TSlot>
@@ -221,6 +239,7 @@ class Scavenger {
   Heap::PretenuringFeedbackMap local_pretenuring_feedback_;
   size_t copied_size_;
   size_t promoted_size_;
+  SurvivorStatsByType survivors_by_type_;
   EvacuationAllocator allocator_;
   SurvivingNewLargeObjectsMap surviving_new_large_objects_;
 
@@ -78,6 +78,15 @@ class PossiblyEmptyBuckets {
 
   bool IsEmpty() { return bitmap_ == kNullAddress; }
 
+  // Allocates the bitmap for |buckets| buckets up front. Afterwards, threads
+  // may insert concurrently as long as they use disjoint ranges of buckets
+  // that are aligned to kBucketsPerWord.
+  void AllocateForConcurrentInsert(size_t buckets) {
+    if (!IsAllocated()) Allocate(buckets);
+  }
+
+  static const int kBucketsPerWord = sizeof(uintptr_t) * kBitsPerByte;
+
  private:
   Address bitmap_;
   static const Address kPointerTag = 1;
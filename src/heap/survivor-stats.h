@@ -0,0 +1,73 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_HEAP_SURVIVOR_STATS_H_
+#define V8_HEAP_SURVIVOR_STATS_H_
+
+#include <vector>
+
+#include "src/base/logging.h"
+#include "src/base/macros.h"
+#include "src/flags/flags.h"
+#include "src/objects/instance-type.h"
+
+namespace v8 {
+namespace internal {
+
+// Number and size of young generation objects per InstanceType that survived
+// a GC. Scavenger and evacuator tasks record into task local instances that
+// are merged into the heap's instance on the main thread. Recording is only
+// enabled with --track-young-survivors-by-type.
+class SurvivorStatsByType final {
+ public:
+  static constexpr size_t kNumberOfTypes = LAST_TYPE + 1;
+
+  struct Entry {
+    size_t count = 0;
+    size_t size = 0;
+  };
+
+  SurvivorStatsByType()
+      : entries_(FLAG_track_young_survivors_by_type ? kNumberOfTypes : 0) {}
+
+  bool enabled() const { return !entries_.empty(); }
+
+  V8_INLINE void Record(InstanceType type, size_t size) {
+    if (V8_LIKELY(!enabled())) return;
+    DCHECK_LT(static_cast<size_t>(type), kNumberOfTypes);
+    Entry& entry = entries_[type];
+    entry.count++;
+    entry.size += size;
+  }
+
+  void Merge(const SurvivorStatsByType& other) {
+    if (!enabled() || !other.enabled()) return;
+    for (size_t i = 0; i < kNumberOfTypes; i++) {
+      entries_[i].count += other.entries_[i].count;
+      entries_[i].size += other.entries_[i].size;
+    }
+  }
+
+  // Clears all entries. Also picks up changes of the flag so that long-living
+  // instances can be enabled at runtime.
+  void Reset() {
+    entries_.assign(FLAG_track_young_survivors_by_type ? kNumberOfTypes : 0,
+                    Entry());
+  }
+
+  Entry Get(size_t type_index) const {
+    if (!enabled() || type_index >= kNumberOfTypes) return Entry();
+    return entries_[type_index];
+  }
+
+ private:
+  std::vector<Entry> entries_;
+
+  DISALLOW_COPY_AND_ASSIGN(SurvivorStatsByType);
+};
+
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_HEAP_SURVIVOR_STATS_H_
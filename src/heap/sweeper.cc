@@ -20,8 +20,6 @@ namespace internal {
 Sweeper::Sweeper(Heap* heap, MajorNonAtomicMarkingState* marking_state)
     : heap_(heap),
       marking_state_(marking_state),
-      num_tasks_(0),
-      pending_sweeper_tasks_semaphore_(0),
       incremental_sweeper_pending_(false),
       sweeping_in_progress_(false),
       num_sweeping_tasks_(0),
@@ -79,47 +77,52 @@ Sweeper::FilterSweepingPagesScope::~FilterSweepingPagesScope() {
   // old_space_sweeping_list_ does not need to be cleared as we don't use it.
 }
 
-class Sweeper::SweeperTask final : public CancelableTask {
+class Sweeper::SweeperJob final : public JobTask {
  public:
-  SweeperTask(Isolate* isolate, Sweeper* sweeper,
-              base::Semaphore* pending_sweeper_tasks,
-              std::atomic<intptr_t>* num_sweeping_tasks,
-              AllocationSpace space_to_start)
-      : CancelableTask(isolate),
-        sweeper_(sweeper),
-        pending_sweeper_tasks_(pending_sweeper_tasks),
-        num_sweeping_tasks_(num_sweeping_tasks),
-        space_to_start_(space_to_start),
-        tracer_(isolate->heap()->tracer()) {}
-
-  ~SweeperTask() override = default;
-
- private:
-  void RunInternal() final {
-    TRACE_BACKGROUND_GC(tracer_,
-                        GCTracer::BackgroundScope::MC_BACKGROUND_SWEEPING);
-    DCHECK(IsValidSweepingSpace(space_to_start_));
-    const int offset = space_to_start_ - FIRST_GROWABLE_PAGED_SPACE;
-    for (int i = 0; i < kNumberOfSweepingSpaces; i++) {
-      const AllocationSpace space_id = static_cast<AllocationSpace>(
-          FIRST_GROWABLE_PAGED_SPACE +
-          ((i + offset) % kNumberOfSweepingSpaces));
-      // Do not sweep code space concurrently.
-      if (space_id == CODE_SPACE) continue;
-      DCHECK(IsValidSweepingSpace(space_id));
-      sweeper_->SweepSpaceFromTask(space_id);
+  SweeperJob(Isolate* isolate, Sweeper* sweeper)
+      : sweeper_(sweeper), tracer_(isolate->heap()->tracer()) {}
+
+  ~SweeperJob() override = default;
+
+  void Run(JobDelegate* delegate) final {
+    sweeper_->num_sweeping_tasks_++;
+    {
+      TRACE_BACKGROUND_GC(tracer_,
+                          GCTracer::BackgroundScope::MC_BACKGROUND_SWEEPING);
+      // Spread the workers over the spaces so that they don't contend on the
+      // same sweeping list.
+      const int offset = next_space_offset_++;
+      for (int i = 0; i < kNumberOfSweepingSpaces; i++) {
+        const AllocationSpace space_id = static_cast<AllocationSpace>(
+            FIRST_GROWABLE_PAGED_SPACE +
+            ((i + offset) % kNumberOfSweepingSpaces));
+        // Do not sweep code space concurrently.
+        if (space_id == CODE_SPACE) continue;
+        DCHECK(IsValidSweepingSpace(space_id));
+        if (!sweeper_->ConcurrentSweepSpace(space_id, delegate)) break;
+      }
     }
-    (*num_sweeping_tasks_)--;
-    pending_sweeper_tasks_->Signal();
+    sweeper_->num_sweeping_tasks_--;
   }
 
+  size_t GetMaxConcurrency() const override {
+    if (sweeper_->stop_sweeper_tasks_) return 0;
+    const size_t kPagesPerTask = 2;
+    const size_t active_tasks =
+        static_cast<size_t>(sweeper_->num_sweeping_tasks_.load());
+    return std::min<size_t>(
+        kMaxSweeperTasks,
+        active_tasks +
+            (sweeper_->ConcurrentSweepingPageCount() + kPagesPerTask - 1) /
+                kPagesPerTask);
+  }
+
+ private:
   Sweeper* const sweeper_;
-  base::Semaphore* const pending_sweeper_tasks_;
-  std::atomic<intptr_t>* const num_sweeping_tasks_;
-  AllocationSpace space_to_start_;
   GCTracer* const tracer_;
+  std::atomic<int> next_space_offset_{0};
 
-  DISALLOW_COPY_AND_ASSIGN(SweeperTask);
+  DISALLOW_COPY_AND_ASSIGN(SweeperJob);
 };
 
 class Sweeper::IncrementalSweeperTask final : public CancelableTask {
@@ -174,21 +177,21 @@ void Sweeper::StartSweeping() {
   });
 }
 
+void Sweeper::TearDown() {
+  if (job_handle_) {
+    job_handle_->Cancel();
+    job_handle_.reset();
+  }
+}
+
 void Sweeper::StartSweeperTasks() {
-  DCHECK_EQ(0, num_tasks_);
+  DCHECK(!job_handle_);
   DCHECK_EQ(0, num_sweeping_tasks_);
   if (FLAG_concurrent_sweeping && sweeping_in_progress_ &&
       !heap_->delay_sweeper_tasks_for_testing_) {
-    ForAllSweepingSpaces([this](AllocationSpace space) {
-      DCHECK(IsValidSweepingSpace(space));
-      num_sweeping_tasks_++;
-      auto task = std::make_unique<SweeperTask>(
-          heap_->isolate(), this, &pending_sweeper_tasks_semaphore_,
-          &num_sweeping_tasks_, space);
-      DCHECK_LT(num_tasks_, kMaxSweeperTasks);
-      task_ids_[num_tasks_++] = task->id();
-      V8::GetCurrentPlatform()->CallOnWorkerThread(std::move(task));
-    });
+    job_handle_ = V8::GetCurrentPlatform()->PostJob(
+        heap_->isolate()->BackgroundTaskPriority(TaskPriority::kUserVisible),
+        std::make_unique<SweeperJob>(heap_->isolate(), this));
     ScheduleIncrementalSweepingTask();
   }
 }
@@ -214,18 +217,11 @@ void Sweeper::MergeOldToNewRememberedSetsForSweptPages() {
 }
 
 void Sweeper::AbortAndWaitForTasks() {
-  if (!FLAG_concurrent_sweeping) return;
-
-  for (int i = 0; i < num_tasks_; i++) {
-    if (heap_->isolate()->cancelable_task_manager()->TryAbort(task_ids_[i]) !=
-        TryAbortResult::kTaskAborted) {
-      pending_sweeper_tasks_semaphore_.Wait();
-    } else {
-      // Aborted case.
-      num_sweeping_tasks_--;
-    }
-  }
-  num_tasks_ = 0;
+  if (!job_handle_) return;
+
+  // Cancelling waits for all running workers to return.
+  job_handle_->Cancel();
+  job_handle_.reset();
   DCHECK_EQ(0, num_sweeping_tasks_);
 }
 
@@ -266,7 +262,21 @@ void Sweeper::SupportConcurrentSweeping() {
   });
 }
 
-bool Sweeper::AreSweeperTasksRunning() { return num_sweeping_tasks_ != 0; }
+bool Sweeper::AreSweeperTasksRunning() {
+  if (!job_handle_) return false;
+  return num_sweeping_tasks_ != 0 || ConcurrentSweepingPageCount() != 0;
+}
+
+size_t Sweeper::ConcurrentSweepingPageCount() {
+  base::MutexGuard guard(&mutex_);
+  size_t count = 0;
+  ForAllSweepingSpaces([this, &count](AllocationSpace space) {
+    // Code space is only swept on the main thread.
+    if (space == CODE_SPACE) return;
+    count += sweeping_list_[GetSweepSpaceIndex(space)].size();
+  });
+  return count;
+}
 
 V8_INLINE size_t Sweeper::FreeAndProcessFreedMemory(
     Address free_start, Address free_end, Page* page, Space* space,
@@ -442,16 +452,19 @@ int Sweeper::RawSweep(
       p->owner()->free_list()->GuaranteedAllocatable(max_freed_bytes));
 }
 
-void Sweeper::SweepSpaceFromTask(AllocationSpace identity) {
-  Page* page = nullptr;
-  while (!stop_sweeper_tasks_ &&
-         ((page = GetSweepingPageSafe(identity)) != nullptr)) {
+bool Sweeper::ConcurrentSweepSpace(AllocationSpace identity,
+                                   JobDelegate* delegate) {
+  while (!stop_sweeper_tasks_) {
+    if (delegate->ShouldYield()) return false;
+    Page* page = GetSweepingPageSafe(identity);
+    if (page == nullptr) return true;
     // Typed slot sets are only recorded on code pages. Code pages
     // are not swept concurrently to the application to ensure W^X.
     DCHECK(!page->typed_slot_set<OLD_TO_NEW>() &&
            !page->typed_slot_set<OLD_TO_OLD>());
     ParallelSweepPage(page, identity);
   }
+  return false;
 }
 
 bool Sweeper::SweepSpaceIncrementallyFromTask(AllocationSpace identity) {
@@ -630,7 +643,7 @@ void Sweeper::StartIterabilityTasks() {
                                                   &iterability_task_semaphore_);
     iterability_task_id_ = task->id();
     iterability_task_started_ = true;
-    V8::GetCurrentPlatform()->CallOnWorkerThread(std::move(task));
+    heap_->isolate()->PostBackgroundTask(std::move(task));
   }
 }
 
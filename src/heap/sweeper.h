@@ -7,8 +7,10 @@
 
 #include <deque>
 #include <map>
+#include <memory>
 #include <vector>
 
+#include "include/v8-platform.h"
 #include "src/base/platform/semaphore.h"
 #include "src/common/globals.h"
 #include "src/tasks/cancelable-task.h"
@@ -105,6 +107,8 @@ class Sweeper {
   // are not running yet.
   void StartSweeping();
   V8_EXPORT_PRIVATE void StartSweeperTasks();
+  // Cancels the concurrent sweeper job without completing sweeping.
+  void TearDown();
   void EnsureCompleted();
   void DrainSweepingWorklists();
   void DrainSweepingWorklistForSpace(AllocationSpace space);
@@ -123,7 +127,7 @@ class Sweeper {
  private:
   class IncrementalSweeperTask;
   class IterabilityTask;
-  class SweeperTask;
+  class SweeperJob;
 
   static const int kNumberOfSweepingSpaces =
       LAST_GROWABLE_PAGED_SPACE - FIRST_GROWABLE_PAGED_SPACE + 1;
@@ -172,7 +176,12 @@ class Sweeper {
     return is_done;
   }
 
-  void SweepSpaceFromTask(AllocationSpace identity);
+  // Sweeps pages of the given space from a concurrent sweeper job. Returns
+  // false if the job was asked to yield or the sweeper to stop.
+  bool ConcurrentSweepSpace(AllocationSpace identity, JobDelegate* delegate);
+
+  // Number of pages left to sweep in spaces that are swept concurrently.
+  size_t ConcurrentSweepingPageCount();
 
   // Sweeps incrementally one page from the given space. Returns true if
   // there are no more pages to sweep in the given space.
@@ -202,9 +211,7 @@ class Sweeper {
 
   Heap* const heap_;
   MajorNonAtomicMarkingState* marking_state_;
-  int num_tasks_;
-  CancelableTaskManager::Id task_ids_[kNumberOfSweepingSpaces];
-  base::Semaphore pending_sweeper_tasks_semaphore_;
+  std::unique_ptr<JobHandle> job_handle_;
   base::Mutex mutex_;
   SweptList swept_list_[kNumberOfSweepingSpaces];
   SweepingList sweeping_list_[kNumberOfSweepingSpaces];
@@ -212,8 +219,7 @@ class Sweeper {
   // Main thread can finalize sweeping, while background threads allocation slow
   // path checks this flag to see whether it could support concurrent sweeping.
   std::atomic<bool> sweeping_in_progress_;
-  // Counter is actively maintained by the concurrent tasks to avoid querying
-  // the semaphore for maintaining a task counter on the main thread.
+  // Number of workers currently running the concurrent sweeper job.
   std::atomic<intptr_t> num_sweeping_tasks_;
   // Used by PauseOrCompleteScope to signal early bailout to tasks.
   std::atomic<bool> stop_sweeper_tasks_;
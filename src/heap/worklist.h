@@ -53,6 +53,12 @@ class Worklist {
 
     void FlushToGlobal() { worklist_->FlushToGlobal(task_id_); }
 
+    size_t StolenSegments() { return worklist_->StolenSegments(task_id_); }
+
+    size_t PublishedSegments() {
+      return worklist_->PublishedSegments(task_id_);
+    }
+
    private:
     Worklist<EntryType, SEGMENT_SIZE>* worklist_;
     int task_id_;
@@ -68,6 +74,8 @@ class Worklist {
     for (int i = 0; i < num_tasks_; i++) {
       private_push_segment(i) = NewSegment();
       private_pop_segment(i) = NewSegment();
+      private_segments_[i].stolen_segments = 0;
+      private_segments_[i].published_segments = 0;
     }
   }
 
@@ -151,6 +159,24 @@ class Worklist {
   // Thread-safe but may return an outdated result.
   size_t GlobalPoolSize() const { return global_pool_.Size(); }
 
+  // Number of segments the given task took from or handed to the global pool
+  // since the last ResetStats(). The counters are only written by the owning
+  // task and are meant for tracing work distribution between markers.
+  size_t StolenSegments(int task_id) {
+    return private_segments_[task_id].stolen_segments;
+  }
+  size_t PublishedSegments(int task_id) {
+    return private_segments_[task_id].published_segments;
+  }
+
+  // Assumes that no other tasks are running.
+  void ResetStats() {
+    for (int i = 0; i < num_tasks_; i++) {
+      private_segments_[i].stolen_segments = 0;
+      private_segments_[i].published_segments = 0;
+    }
+  }
+
   // Clears all segments. Frees the global segment pool.
   //
   // Assumes that no other tasks are running.
@@ -272,6 +298,8 @@ class Worklist {
   struct PrivateSegmentHolder {
     Segment* private_push_segment;
     Segment* private_pop_segment;
+    size_t stolen_segments;
+    size_t published_segments;
     char cache_line_padding[64];
   };
 
@@ -416,6 +444,7 @@ class Worklist {
     if (!private_push_segment(task_id)->IsEmpty()) {
       global_pool_.Push(private_push_segment(task_id));
       private_push_segment(task_id) = NewSegment();
+      private_segments_[task_id].published_segments++;
     }
   }
 
@@ -423,6 +452,7 @@ class Worklist {
     if (!private_pop_segment(task_id)->IsEmpty()) {
       global_pool_.Push(private_pop_segment(task_id));
       private_pop_segment(task_id) = NewSegment();
+      private_segments_[task_id].published_segments++;
     }
   }
 
@@ -432,6 +462,7 @@ class Worklist {
     if (global_pool_.Pop(&new_segment)) {
       delete private_pop_segment(task_id);
       private_pop_segment(task_id) = new_segment;
+      private_segments_[task_id].stolen_segments++;
       return true;
     }
     return false;
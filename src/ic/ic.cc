@@ -23,6 +23,7 @@
 #include "src/ic/ic-inl.h"
 #include "src/ic/ic-stats.h"
 #include "src/ic/stub-cache.h"
+#include "src/logging/metrics.h"
 #include "src/numbers/conversions.h"
 #include "src/objects/api-callbacks.h"
 #include "src/objects/data-handler-inl.h"
@@ -340,6 +341,18 @@ bool IC::ConfigureVectorState(IC::State new_state, Handle<Object> key) {
   bool changed =
       nexus()->ConfigureMegamorphic(key->IsName() ? PROPERTY : ELEMENT);
   OnFeedbackChanged("Megamorphic");
+  if (changed && isolate()->metrics_recorder()->HasEmbedderRecorder()) {
+    v8::metrics::FeedbackBecameMegamorphic event;
+    event.slot_kind = FeedbackMetadata::Kind2String(nexus()->kind());
+    SharedFunctionInfo shared = nexus()->vector().shared_function_info();
+    if (shared.script().IsScript()) {
+      event.script_id = Script::cast(shared.script()).id();
+    }
+    event.function_start_position = shared.StartPosition();
+    Handle<NativeContext> native_context = isolate()->native_context();
+    isolate()->metrics_recorder()->AddMainThreadEvent(
+        event, isolate()->GetOrRegisterContextToken(native_context));
+  }
   return changed;
 }
 
@@ -9,6 +9,7 @@
 #include "src/heap/heap-inl.h"  // For InYoungGeneration().
 #include "src/ic/ic-inl.h"
 #include "src/logging/counters.h"
+#include "src/logging/metrics.h"
 #include "src/objects/tagged-value-inl.h"
 
 namespace v8 {
@@ -100,6 +101,7 @@ void StubCache::Set(Name name, Map map, MaybeObject handler) {
     int secondary_offset = SecondaryOffset(
         Name::cast(StrongTaggedValue::ToObject(isolate(), primary->key)), seed);
     Entry* secondary = entry(secondary_, secondary_offset);
+    if (!secondary->map.IsSmi()) evictions_++;
     *secondary = *primary;
   }
 
@@ -107,6 +109,7 @@ void StubCache::Set(Name name, Map map, MaybeObject handler) {
   primary->key = StrongTaggedValue(name);
   primary->value = TaggedValue(handler);
   primary->map = StrongTaggedValue(map);
+  updates_++;
   isolate()->counters()->megamorphic_stub_cache_updates()->Increment();
 }
 
@@ -125,7 +128,29 @@ MaybeObject StubCache::Get(Name name, Map map) {
   return MaybeObject();
 }
 
+void StubCache::ReportUsage() {
+  v8::metrics::MegamorphicStubCacheUsage event;
+  event.store = this == isolate()->store_stub_cache();
+  event.primary_entries = kPrimaryTableSize;
+  event.secondary_entries = kSecondaryTableSize;
+  for (int i = 0; i < kPrimaryTableSize; i++) {
+    if (!primary_[i].map.IsSmi()) event.primary_entries_used++;
+  }
+  for (int j = 0; j < kSecondaryTableSize; j++) {
+    if (!secondary_[j].map.IsSmi()) event.secondary_entries_used++;
+  }
+  event.updates = updates_;
+  event.evictions = evictions_;
+  isolate()->metrics_recorder()->AddThreadSafeEvent(event);
+}
+
 void StubCache::Clear() {
+  if (updates_ > 0 && isolate()->metrics_recorder() &&
+      isolate()->metrics_recorder()->HasEmbedderRecorder()) {
+    ReportUsage();
+  }
+  updates_ = 0;
+  evictions_ = 0;
   MaybeObject empty = MaybeObject::FromObject(
       isolate_->builtins()->builtin(Builtins::kIllegal));
   Name empty_string = ReadOnlyRoots(isolate()).empty_string();
@@ -136,9 +136,16 @@ class V8_EXPORT_PRIVATE StubCache {
   }
 
  private:
+  // Reports how full the tables are to the embedder's metrics recorder.
+  void ReportUsage();
+
   Entry primary_[kPrimaryTableSize];
   Entry secondary_[kSecondaryTableSize];
   Isolate* isolate_;
+  // Number of Set() calls since the last Clear(), and how many of them
+  // overwrote a live secondary entry.
+  size_t updates_ = 0;
+  size_t evictions_ = 0;
 
   friend class Isolate;
   friend class SCTableReference;
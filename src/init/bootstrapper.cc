@@ -27,6 +27,7 @@
 #include "src/heap/heap-inl.h"
 #include "src/logging/counters.h"
 #include "src/logging/log.h"
+#include "src/logging/metrics.h"
 #include "src/numbers/math-random.h"
 #include "src/objects/api-callbacks.h"
 #include "src/objects/arguments.h"
@@ -168,6 +169,9 @@ class Genesis {
 
   Handle<JSGlobalProxy> global_proxy() { return global_proxy_; }
 
+  // Durations of the phases of context creation, see --trace-startup.
+  v8::metrics::ContextCreated* metrics() { return &metrics_; }
+
  private:
   Handle<NativeContext> native_context() { return native_context_; }
 
@@ -299,6 +303,8 @@ class Genesis {
   // %ThrowTypeError%. See ES#sec-%throwtypeerror% for details.
   Handle<JSFunction> restricted_properties_thrower_;
 
+  v8::metrics::ContextCreated metrics_;
+
   BootstrapperActive active_;
   friend class Bootstrapper;
 };
@@ -315,21 +321,52 @@ Handle<Context> Bootstrapper::CreateEnvironment(
     v8::DeserializeEmbedderFieldsCallback embedder_fields_deserializer,
     v8::MicrotaskQueue* microtask_queue) {
   HandleScope scope(isolate_);
+  base::ElapsedTimer timer;
+  timer.Start();
   Handle<Context> env;
+  v8::metrics::ContextCreated metrics;
   {
     Genesis genesis(isolate_, maybe_global_proxy, global_proxy_template,
                     context_snapshot_index, embedder_fields_deserializer,
                     microtask_queue);
     env = genesis.result();
-    if (env.is_null() || !InstallExtensions(env, extensions)) {
-      return Handle<Context>();
-    }
+    if (env.is_null()) return Handle<Context>();
+    base::ElapsedTimer extensions_timer;
+    extensions_timer.Start();
+    if (!InstallExtensions(env, extensions)) return Handle<Context>();
+    metrics = *genesis.metrics();
+    metrics.extensions_wall_clock_duration_in_us =
+        extensions_timer.Elapsed().InMicroseconds();
   }
   LogAllMaps();
   isolate_->heap()->NotifyBootstrapComplete();
+  metrics.total_wall_clock_duration_in_us = timer.Elapsed().InMicroseconds();
+  ReportContextCreated(Handle<NativeContext>::cast(env), metrics);
   return scope.CloseAndEscape(env);
 }
 
+void Bootstrapper::ReportContextCreated(
+    Handle<NativeContext> context, const v8::metrics::ContextCreated& metrics) {
+  if (FLAG_trace_startup) {
+    PrintIsolate(isolate_,
+                 "[Context creation (%s): total=%" PRId64
+                 " deserialization=%" PRId64 " bootstrapping=%" PRId64
+                 " global_object=%" PRId64 " experimental_globals=%" PRId64
+                 " extensions=%" PRId64 " (us)]\n",
+                 metrics.from_snapshot ? "snapshot" : "scratch",
+                 metrics.total_wall_clock_duration_in_us,
+                 metrics.context_deserialization_wall_clock_duration_in_us,
+                 metrics.bootstrapping_wall_clock_duration_in_us,
+                 metrics.global_object_setup_wall_clock_duration_in_us,
+                 metrics.experimental_globals_wall_clock_duration_in_us,
+                 metrics.extensions_wall_clock_duration_in_us);
+  }
+  if (isolate_->metrics_recorder()->HasEmbedderRecorder()) {
+    isolate_->metrics_recorder()->AddMainThreadEvent(
+        metrics, isolate_->GetOrRegisterContextToken(context));
+  }
+}
+
 Handle<JSGlobalProxy> Bootstrapper::NewRemoteContext(
     MaybeHandle<JSGlobalProxy> maybe_global_proxy,
     v8::Local<v8::ObjectTemplate> global_proxy_template) {
@@ -4794,11 +4831,15 @@ bool Genesis::InstallSpecialObjects(Isolate* isolate,
   Handle<Smi> stack_trace_limit(Smi::FromInt(FLAG_stack_trace_limit), isolate);
   JSObject::AddProperty(isolate, Error, name, stack_trace_limit, NONE);
 
-  if (FLAG_expose_wasm) {
+  if (FLAG_expose_wasm && FLAG_lazy_wasm_js_api) {
+    // Expose on the global object, but only install the internal data
+    // structures once they are needed.
+    WasmJs::InstallLazily(isolate);
+  } else if (FLAG_expose_wasm) {
     // Install the internal data structures into the isolate and expose on
     // the global object.
     WasmJs::Install(isolate, true);
-  } else if (FLAG_validate_asm) {
+  } else if (FLAG_validate_asm && !FLAG_lazy_wasm_js_api) {
     // Install the internal data structures only; these are needed for asm.js
     // translated to Wasm to work correctly.
     WasmJs::Install(isolate, false);
@@ -5176,6 +5217,8 @@ Genesis::Genesis(
   // a snapshot. Otherwise we have to build the context from scratch.
   // Also create a context from scratch to expose natives, if required by flag.
   DCHECK(native_context_.is_null());
+  base::ElapsedTimer phase_timer;
+  phase_timer.Start();
   if (isolate->initialized_from_snapshot()) {
     Handle<Context> context;
     if (Snapshot::NewContextFromSnapshot(isolate, global_proxy,
@@ -5187,6 +5230,9 @@ Genesis::Genesis(
   }
 
   if (!native_context().is_null()) {
+    metrics_.from_snapshot = true;
+    metrics_.context_deserialization_wall_clock_duration_in_us =
+        phase_timer.Restart().InMicroseconds();
     AddToWeakNativeContextList(isolate, *native_context());
     isolate->set_context(*native_context());
     isolate->counters()->contexts_created_by_snapshot()->Increment();
@@ -5201,12 +5247,14 @@ Genesis::Genesis(
       // The global proxy needs to be integrated into the native context.
       HookUpGlobalProxy(global_proxy);
     }
+    metrics_.global_object_setup_wall_clock_duration_in_us =
+        phase_timer.Elapsed().InMicroseconds();
     DCHECK(!global_proxy->IsDetachedFrom(native_context()->global_object()));
   } else {
     DCHECK(native_context().is_null());
 
     base::ElapsedTimer timer;
-    if (FLAG_profile_deserialization) timer.Start();
+    timer.Start();
     DCHECK_EQ(0u, context_snapshot_index);
     // We get here if there was no context snapshot.
     CreateRoots();
@@ -5231,6 +5279,8 @@ Genesis::Genesis(
 
     isolate->counters()->contexts_created_from_scratch()->Increment();
 
+    metrics_.bootstrapping_wall_clock_duration_in_us =
+        timer.Elapsed().InMicroseconds();
     if (FLAG_profile_deserialization) {
       double ms = timer.Elapsed().InMillisecondsF();
       PrintF("[Initializing context from scratch took %0.3f ms]\n", ms);
@@ -5245,6 +5295,7 @@ Genesis::Genesis(
   // snapshot as we should be able to turn them off at runtime. Re-installing
   // them after they have already been deserialized would also fail.
   if (!isolate->serializer_enabled()) {
+    phase_timer.Restart();
     InitializeExperimentalGlobal();
 
     // Store String.prototype's map again in case it has been changed by
@@ -5256,6 +5307,8 @@ Genesis::Genesis(
     DCHECK(string_function_prototype.HasFastProperties());
     native_context()->set_string_function_prototype_map(
         string_function_prototype.map());
+    metrics_.experimental_globals_wall_clock_duration_in_us =
+        phase_timer.Elapsed().InMicroseconds();
   }
 
   if (FLAG_disallow_code_generation_from_strings) {
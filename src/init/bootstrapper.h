@@ -5,6 +5,7 @@
 #ifndef V8_INIT_BOOTSTRAPPER_H_
 #define V8_INIT_BOOTSTRAPPER_H_
 
+#include "include/v8-metrics.h"
 #include "src/heap/factory.h"
 #include "src/objects/fixed-array.h"
 #include "src/objects/shared-function-info.h"
@@ -98,6 +99,11 @@ class Bootstrapper final {
   // Log newly created Map objects if no snapshot was used.
   void LogAllMaps();
 
+  // Print or record the phase durations of a new context for --trace-startup
+  // and the embedder's metrics recorder.
+  void ReportContextCreated(Handle<NativeContext> context,
+                            const v8::metrics::ContextCreated& metrics);
+
   Isolate* isolate_;
   using NestingCounterType = int;
   NestingCounterType nesting_;
@@ -6,6 +6,7 @@
 #include "src/base/bounded-page-allocator.h"
 #include "src/common/ptr-compr.h"
 #include "src/execution/isolate.h"
+#include "src/flags/flags.h"
 #include "src/utils/memcopy.h"
 #include "src/utils/utils.h"
 
@@ -157,6 +158,13 @@ void IsolateAllocator::CommitPagesForIsolate(Address heap_reservation_address) {
       page_size);
   page_allocator_ = page_allocator_instance_.get();
 
+  if (FLAG_transparent_huge_pages) {
+    // The cage is 4Gb aligned, so every huge page sized region within it is
+    // eligible for huge page backing once it is committed.
+    USE(platform_page_allocator->AdviseHugePages(
+        reinterpret_cast<void*>(isolate_root), kPtrComprHeapReservationSize));
+  }
+
   Address isolate_address = isolate_root - Isolate::isolate_root_bias();
   Address isolate_end = isolate_address + sizeof(Isolate);
 
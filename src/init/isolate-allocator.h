@@ -32,6 +32,13 @@ namespace internal {
 // the Isolate object takes ownership of the IsolateAllocator object to keep
 // the memory alive.
 // Isolate::Delete() takes care of the proper order of the objects destruction.
+//
+// With pointer compression every Isolate gets its own 4Gb cage because the
+// isolate root doubles as the base for decompression (see
+// kPtrComprIsolateRootAlignment) and roots are addressed relative to it.
+// TODO(v8:7703): Sharing a cage between Isolates requires a decompression base
+// that is independent of the isolate root, and cages larger than 4Gb require
+// shifting compressed values by kObjectAlignmentBits in generated code.
 class V8_EXPORT_PRIVATE IsolateAllocator final {
  public:
   explicit IsolateAllocator(IsolateAllocationMode mode);
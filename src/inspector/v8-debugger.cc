@@ -1065,6 +1065,7 @@ void V8Debugger::collectOldAsyncStacksIfNeeded() {
   }
   cleanupExpiredWeakPointers(m_asyncTaskStacks);
   cleanupExpiredWeakPointers(m_storedStackTraces);
+  cleanupExpiredWeakPointers(m_cachedStackFrames);
   for (auto it = m_recurringTasks.begin(); it != m_recurringTasks.end();) {
     if (m_asyncTaskStacks.find(*it) == m_asyncTaskStacks.end()) {
       it = m_recurringTasks.erase(it);
@@ -1077,7 +1078,30 @@ void V8Debugger::collectOldAsyncStacksIfNeeded() {
 std::shared_ptr<StackFrame> V8Debugger::symbolize(
     v8::Local<v8::StackFrame> v8Frame) {
   CHECK(!v8Frame.IsEmpty());
-  return std::make_shared<StackFrame>(isolate(), v8Frame);
+  int scriptId = v8Frame->GetScriptId();
+  int lineNumber = v8Frame->GetLineNumber() - 1;
+  int columnNumber = v8Frame->GetColumn() - 1;
+  CachedStackFrameKey key{scriptId, lineNumber, columnNumber};
+  String16 functionName =
+      toProtocolString(isolate(), v8Frame->GetFunctionName());
+  auto it = m_cachedStackFrames.find(key);
+  if (it != m_cachedStackFrames.end() && !it->second.expired()) {
+    std::shared_ptr<StackFrame> stackFrame = it->second.lock();
+    if (stackFrame->functionName() == functionName) {
+      DCHECK(stackFrame->sourceURL() ==
+             toProtocolString(isolate(), v8Frame->GetScriptNameOrSourceURL()));
+      return stackFrame;
+    }
+  }
+  String16 sourceURL =
+      toProtocolString(isolate(), v8Frame->GetScriptNameOrSourceURL());
+  bool hasSourceURLComment =
+      v8Frame->GetScriptName() != v8Frame->GetScriptNameOrSourceURL();
+  auto stackFrame = std::make_shared<StackFrame>(
+      std::move(functionName), scriptId, std::move(sourceURL), lineNumber,
+      columnNumber, hasSourceURLComment);
+  m_cachedStackFrames[key] = stackFrame;
+  return stackFrame;
 }
 
 void V8Debugger::setMaxAsyncTaskStacksForTest(int limit) {
@@ -248,6 +248,36 @@ class V8Debugger : public v8::debug::DebugDelegate,
   // are weak, which allows to collect some stacks when there are too many.
   std::list<std::shared_ptr<AsyncStackTrace>> m_allAsyncStacks;
 
+  // Frames are shared between all stack traces that contain them, which
+  // keeps capturing async stacks cheap when the same call sites schedule
+  // tasks over and over again.
+  struct CachedStackFrameKey {
+    int scriptId;
+    int lineNumber;
+    int columnNumber;
+
+    struct Hash {
+      size_t operator()(CachedStackFrameKey const& key) const {
+        size_t code = 0;
+        code = code * 31 + key.scriptId;
+        code = code * 31 + key.lineNumber;
+        code = code * 31 + key.columnNumber;
+        return code;
+      }
+    };
+
+    struct Equal {
+      bool operator()(CachedStackFrameKey const& a,
+                      CachedStackFrameKey const& b) const {
+        return a.scriptId == b.scriptId && a.lineNumber == b.lineNumber &&
+               a.columnNumber == b.columnNumber;
+      }
+    };
+  };
+  std::unordered_map<CachedStackFrameKey, std::weak_ptr<StackFrame>,
+                     CachedStackFrameKey::Hash, CachedStackFrameKey::Equal>
+      m_cachedStackFrames;
+
   std::unordered_map<V8DebuggerAgentImpl*, int> m_maxAsyncCallStackDepthMap;
   void* m_taskWithScheduledBreak = nullptr;
 
@@ -169,12 +169,16 @@ protocol::DictionaryValue* V8InspectorSessionImpl::agentState(
 std::unique_ptr<StringBuffer> V8InspectorSessionImpl::serializeForFrontend(
     std::unique_ptr<protocol::Serializable> message) {
   std::vector<uint8_t> cbor = message->Serialize();
+  // Responses like Profiler.stop or Runtime.getProperties can be large, so
+  // don't keep more than two encodings of them alive at any point in time.
+  message.reset();
   DCHECK(CheckCBORMessage(SpanFrom(cbor)).ok());
   if (use_binary_protocol_) return StringBufferFrom(std::move(cbor));
   std::vector<uint8_t> json;
   Status status = ConvertCBORToJSON(SpanFrom(cbor), &json);
   DCHECK(status.ok());
   USE(status);
+  std::vector<uint8_t>().swap(cbor);
   // TODO(johannes): It should be OK to make a StringBuffer from |json|
   // directly, since it's 7 Bit US-ASCII with anything else escaped.
   // However it appears that the Node.js tests (or perhaps even production)
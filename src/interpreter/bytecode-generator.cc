@@ -4635,7 +4635,7 @@ void BytecodeGenerator::BuildPrivateGetterAccess(Register object,
   RegisterList args = register_allocator()->NewRegisterList(1);
 
   builder()
-      ->CallRuntime(Runtime::kLoadPrivateGetter, accessor_pair)
+      ->CallRuntime(Runtime::kInlineLoadPrivateGetter, accessor_pair)
       .StoreAccumulatorInRegister(accessor)
       .MoveRegister(object, args[0])
       .CallProperty(accessor, args,
@@ -4650,7 +4650,7 @@ void BytecodeGenerator::BuildPrivateSetterAccess(Register object,
   RegisterList args = register_allocator()->NewRegisterList(2);
 
   builder()
-      ->CallRuntime(Runtime::kLoadPrivateSetter, accessor_pair)
+      ->CallRuntime(Runtime::kInlineLoadPrivateSetter, accessor_pair)
       .StoreAccumulatorInRegister(accessor)
       .MoveRegister(object, args[0])
       .MoveRegister(value, args[1])
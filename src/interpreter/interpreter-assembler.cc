@@ -1493,7 +1493,10 @@ TNode<FixedArray> InterpreterAssembler::ImportRegisterFile(
         IntPtrSub(IntPtrConstant(Register(0).ToOperand()), index);
     StoreRegister(value, reg_index);
 
-    StoreFixedArrayElement(array, array_index, StaleRegisterConstant());
+    // The stale register marker is an immortal immovable root, so clearing
+    // the slot doesn't need a write barrier.
+    StoreFixedArrayElement(array, array_index, StaleRegisterConstant(),
+                           SKIP_WRITE_BARRIER);
 
     var_index = IntPtrAdd(index, IntPtrConstant(1));
     Goto(&loop);
@@ -2764,14 +2764,14 @@ DEBUG_BREAK_BYTECODE_LIST(DEBUG_BREAK)
 // IncBlockCounter <slot>
 //
 // Increment the execution count for the given slot. Used for block code
-// coverage.
+// coverage. The counter is incremented inline, without calling the
+// IncBlockCounter builtin used by optimized code.
 IGNITION_HANDLER(IncBlockCounter, InterpreterAssembler) {
-  TNode<Object> closure = LoadRegister(Register::function_closure());
+  TNode<JSFunction> closure = CAST(LoadRegister(Register::function_closure()));
   TNode<Smi> coverage_array_slot = BytecodeOperandIdxSmi(0);
   TNode<Context> context = GetContext();
 
-  CallBuiltin(Builtins::kIncBlockCounter, context, closure,
-              coverage_array_slot);
+  IncrementBlockCountIfCovered(context, closure, coverage_array_slot);
 
   Dispatch();
 }
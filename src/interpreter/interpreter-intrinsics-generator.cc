@@ -314,6 +314,20 @@ TNode<Object> IntrinsicsGenerator::GeneratorGetResumeMode(
   return value;
 }
 
+TNode<Object> IntrinsicsGenerator::LoadPrivateGetter(
+    const InterpreterAssembler::RegListNodePair& args, TNode<Context> context) {
+  TNode<AccessorPair> accessor_pair =
+      __ CAST(__ LoadRegisterFromRegisterList(args, 0));
+  return __ LoadObjectField(accessor_pair, AccessorPair::kGetterOffset);
+}
+
+TNode<Object> IntrinsicsGenerator::LoadPrivateSetter(
+    const InterpreterAssembler::RegListNodePair& args, TNode<Context> context) {
+  TNode<AccessorPair> accessor_pair =
+      __ CAST(__ LoadRegisterFromRegisterList(args, 0));
+  return __ LoadObjectField(accessor_pair, AccessorPair::kSetterOffset);
+}
+
 TNode<Object> IntrinsicsGenerator::GeneratorClose(
     const InterpreterAssembler::RegListNodePair& args, TNode<Context> context) {
   TNode<JSGeneratorObject> generator =
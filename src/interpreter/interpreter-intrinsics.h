@@ -36,6 +36,8 @@ namespace interpreter {
   V(IsArray, is_array, 1)                                            \
   V(IsJSReceiver, is_js_receiver, 1)                                 \
   V(IsSmi, is_smi, 1)                                                \
+  V(LoadPrivateGetter, load_private_getter, 1)                       \
+  V(LoadPrivateSetter, load_private_setter, 1)                       \
   V(ToStringRT, to_string, 1)                                        \
   V(ToLength, to_length, 1)                                          \
   V(ToObject, to_object, 1)
@@ -4,6 +4,7 @@
 
 #include "src/json/json-parser.h"
 
+#include "src/base/memory.h"
 #include "src/common/message-template.h"
 #include "src/debug/debug.h"
 #include "src/numbers/conversions.h"
@@ -231,6 +232,8 @@ JsonParser<Char>::JsonParser(Isolate* isolate, Handle<String> source)
   }
   cursor_ = chars_ + start;
   end_ = cursor_ + length;
+  allocation_ = isolate->heap()->AllocationTypeForBulkAllocation(
+      length, FLAG_json_parse_pretenure_threshold);
 }
 
 template <typename Char>
@@ -265,7 +268,23 @@ void JsonParser<Char>::ReportUnexpectedToken(JsonToken token) {
       break;
   }
 
-  Handle<Script> script(factory->NewScript(original_source_));
+  Handle<String> script_source = original_source_;
+  if (source_is_transient_) {
+    // The script outlives the parser, so it gets its own copy of the source.
+    DCHECK(!original_source_->IsSlicedString());
+    int length = static_cast<int>(end_ - chars_);
+    script_source =
+        sizeof(Char) == 1
+            ? factory
+                  ->NewStringFromOneByte(Vector<const uint8_t>(
+                      reinterpret_cast<const uint8_t*>(chars_), length))
+                  .ToHandleChecked()
+            : factory
+                  ->NewStringFromTwoByte(Vector<const uc16>(
+                      reinterpret_cast<const uc16*>(chars_), length))
+                  .ToHandleChecked();
+  }
+  Handle<Script> script(factory->NewScript(script_source));
   if (isolate()->NeedsSourcePositionsForProfiling()) {
     Script::InitLineEnds(isolate(), script);
   }
@@ -431,7 +450,7 @@ Handle<Object> JsonParser<Char>::BuildJsonObject(
       elements = elms;
     } else {
       Handle<FixedArray> elms =
-          factory()->NewFixedArrayWithHoles(cont.max_index + 1);
+          factory()->NewFixedArrayWithHoles(cont.max_index + 1, allocation_);
       DisallowHeapAllocation no_gc;
       WriteBarrierMode mode = elms->GetWriteBarrierMode(no_gc);
       DCHECK_EQ(HOLEY_ELEMENTS, map->elements_kind());
@@ -548,9 +567,11 @@ Handle<Object> JsonParser<Char>::BuildJsonObject(
         factory()->NewByteArray(kMutableDoubleSize * new_mutable_double);
   }
 
-  Handle<JSObject> object = initial_map->is_dictionary_map()
-                                ? factory()->NewSlowJSObjectFromMap(map)
-                                : factory()->NewJSObjectFromMap(map);
+  Handle<JSObject> object =
+      initial_map->is_dictionary_map()
+          ? factory()->NewSlowJSObjectFromMap(
+                map, NameDictionary::kInitialCapacity, allocation_)
+          : factory()->NewJSObjectFromMap(map, allocation_);
   object->set_elements(*elements);
 
   {
@@ -675,7 +696,8 @@ Handle<Object> JsonParser<Char>::BuildJsonArray(
     }
   }
 
-  Handle<JSArray> array = factory()->NewJSArray(kind, length, length);
+  Handle<JSArray> array = factory()->NewJSArray(
+      kind, length, length, DONT_INITIALIZE_ARRAY_ELEMENTS, allocation_);
   if (kind == PACKED_DOUBLE_ELEMENTS) {
     DisallowHeapAllocation no_gc;
     FixedDoubleArray elements = FixedDoubleArray::cast(array->elements());
@@ -706,6 +728,13 @@ MaybeHandle<Object> JsonParser<Char>::ParseJsonValue() {
   property_stack.reserve(16);
   element_stack.reserve(16);
 
+  // The map of the last object built at each nesting depth. This is used as
+  // feedback for objects that do not directly follow an object in the same
+  // array, e.g. for objects in properties of array elements.
+  static constexpr int kMaxFeedbackDepth = 16;
+  Handle<FixedArray> depth_feedback =
+      factory()->NewFixedArray(kMaxFeedbackDepth);
+
   JsonContinuation cont(isolate_, JsonContinuation::kReturn, 0);
 
   Handle<Object> value;
@@ -733,7 +762,7 @@ MaybeHandle<Object> JsonParser<Char>::ParseJsonValue() {
           Consume(JsonToken::LBRACE);
           if (Check(JsonToken::RBRACE)) {
             // TODO(verwaest): Directly use the map instead.
-            value = factory()->NewJSObject(object_constructor_);
+            value = factory()->NewJSObject(object_constructor_, allocation_);
             break;
           }
 
@@ -755,7 +784,8 @@ MaybeHandle<Object> JsonParser<Char>::ParseJsonValue() {
         case JsonToken::LBRACK:
           Consume(JsonToken::LBRACK);
           if (Check(JsonToken::RBRACK)) {
-            value = factory()->NewJSArray(0, PACKED_SMI_ELEMENTS);
+            value =
+                factory()->NewJSArray(0, PACKED_SMI_ELEMENTS, allocation_);
             break;
           }
 
@@ -830,22 +860,31 @@ MaybeHandle<Object> JsonParser<Char>::ParseJsonValue() {
             break;
           }
 
-          Handle<Map> feedback;
+          int depth = static_cast<int>(cont_stack.size());
+          Object maybe_feedback = Smi::zero();
           if (cont_stack.size() > 0 &&
               cont_stack.back().type() == JsonContinuation::kArrayElement &&
               cont_stack.back().index < element_stack.size() &&
               element_stack.back()->IsJSObject()) {
-            Map maybe_feedback = JSObject::cast(*element_stack.back()).map();
-            // Don't consume feedback from objects with a map that's detached
-            // from the transition tree.
-            if (!maybe_feedback.IsDetached(isolate_)) {
-              feedback = handle(maybe_feedback, isolate_);
-              if (feedback->is_deprecated()) {
-                feedback = Map::Update(isolate_, feedback);
-              }
+            maybe_feedback = JSObject::cast(*element_stack.back()).map();
+          } else if (depth < kMaxFeedbackDepth) {
+            maybe_feedback = depth_feedback->get(depth);
+          }
+          Handle<Map> feedback;
+          // Don't consume feedback from objects with a map that's detached
+          // from the transition tree.
+          if (maybe_feedback.IsMap() &&
+              !Map::cast(maybe_feedback).IsDetached(isolate_)) {
+            feedback = handle(Map::cast(maybe_feedback), isolate_);
+            if (feedback->is_deprecated()) {
+              feedback = Map::Update(isolate_, feedback);
             }
           }
           value = BuildJsonObject(cont, property_stack, feedback);
+          if (depth < kMaxFeedbackDepth) {
+            Map map = JSObject::cast(*value).map();
+            if (!map.is_dictionary_map()) depth_feedback->set(depth, map);
+          }
           property_stack.resize(cont.index);
           Expect(JsonToken::RBRACE);
 
@@ -1045,12 +1084,16 @@ Handle<String> JsonParser<Char>::MakeString(const JsonString& string,
   if (sizeof(Char) == 1 ? V8_LIKELY(!string.needs_conversion())
                         : string.needs_conversion()) {
     Handle<SeqOneByteString> intermediate =
-        factory()->NewRawOneByteString(string.length()).ToHandleChecked();
+        factory()
+            ->NewRawOneByteString(string.length(), allocation_)
+            .ToHandleChecked();
     return DecodeString(string, intermediate, hint);
   }
 
   Handle<SeqTwoByteString> intermediate =
-      factory()->NewRawTwoByteString(string.length()).ToHandleChecked();
+      factory()
+          ->NewRawTwoByteString(string.length(), allocation_)
+          .ToHandleChecked();
   return DecodeString(string, intermediate, hint);
 }
 
@@ -1118,6 +1161,45 @@ void JsonParser<Char>::DecodeString(SinkChar* sink, int start, int length) {
   }
 }
 
+namespace {
+
+// Skips characters a machine word at a time while none of them can terminate
+// a JSON string, i.e. none of them is a quote, a backslash or a control
+// character. Returns the start of the first word that may contain such a
+// character. For two-byte sources, a character above the Latin1 range among
+// the skipped ones is recorded in {bits}.
+template <typename Char>
+const Char* SkipJsonStringCharacters(const Char* cursor, const Char* end,
+                                     uc32* bits) {
+  using Word = uint64_t;
+  constexpr int kCharsPerWord = sizeof(Word) / sizeof(Char);
+  // A word with each character set to one, and the same with each character's
+  // top bit set.
+  constexpr Word kOnes = ~Word{0} / static_cast<Char>(~Char{0});
+  constexpr Word kTopBits = kOnes << (kBitsPerByte * sizeof(Char) - 1);
+  Word skipped = 0;
+  while (end - cursor >= kCharsPerWord) {
+    Word word =
+        base::ReadUnalignedValue<Word>(reinterpret_cast<Address>(cursor));
+    Word quotes = word ^ (kOnes * '"');
+    Word backslashes = word ^ (kOnes * '\\');
+    // Each term has a top bit set iff one of the characters is zero, or below
+    // 0x20 respectively.
+    Word terminators = ((quotes - kOnes) & ~quotes) |
+                       ((backslashes - kOnes) & ~backslashes) |
+                       ((word - kOnes * 0x20) & ~word);
+    if (terminators & kTopBits) break;
+    skipped |= word;
+    cursor += kCharsPerWord;
+  }
+  if (sizeof(Char) == 2 && (skipped & (kOnes * 0xFF00)) != 0) {
+    *bits |= unibrow::Latin1::kMaxChar + 1;
+  }
+  return cursor;
+}
+
+}  // namespace
+
 template <typename Char>
 JsonString JsonParser<Char>::ScanJsonString(bool needs_internalization) {
   DisallowHeapAllocation no_gc;
@@ -1127,6 +1209,7 @@ JsonString JsonParser<Char>::ScanJsonString(bool needs_internalization) {
   uc32 bits = 0;
 
   while (true) {
+    cursor_ = SkipJsonStringCharacters(cursor_, end_, &bits);
     cursor_ = std::find_if(cursor_, end_, [&bits](Char c) {
       if (sizeof(Char) == 2 && V8_UNLIKELY(c > unibrow::Latin1::kMaxChar)) {
         bits |= c;
@@ -151,6 +151,16 @@ class JsonParser final {
     return result;
   }
 
+  // Parses a source whose characters are only valid for the duration of the
+  // call, e.g. an external string that wraps an embedder buffer. Syntax errors
+  // are reported against a copy of the source.
+  V8_WARN_UNUSED_RESULT static MaybeHandle<Object> ParseTransientSource(
+      Isolate* isolate, Handle<String> source) {
+    JsonParser parser(isolate, source);
+    parser.source_is_transient_ = true;
+    return parser.ParseJson();
+  }
+
   static constexpr uc32 kEndOfString = static_cast<uc32>(-1);
   static constexpr uc32 kInvalidUnicodeCharacter = static_cast<uc32>(-1);
 
@@ -335,6 +345,11 @@ class JsonParser final {
   JsonToken next_;
   // Indicates whether the bytes underneath source_ can relocate during GC.
   bool chars_may_relocate_;
+  // Indicates whether the bytes underneath source_ become invalid once
+  // parsing is done.
+  bool source_is_transient_ = false;
+  // Allocation type used for the objects, arrays and strings of the result.
+  AllocationType allocation_;
   Handle<JSFunction> object_constructor_;
   const Handle<String> original_source_;
   Handle<String> source_;
@@ -4,6 +4,7 @@
 
 #include "src/json/json-stringifier.h"
 
+#include "src/base/memory.h"
 #include "src/common/message-template.h"
 #include "src/numbers/conversions.h"
 #include "src/objects/heap-number-inl.h"
@@ -56,10 +57,16 @@ class JsonStringifier {
   // Serialize a object property.
   // The key may or may not be serialized depending on the property.
   // The key may also serve as argument for the toJSON function.
+  // If {key_needs_no_escape} is set, the key is known to consist of printable
+  // ASCII characters other than quotes and backslashes only.
   V8_INLINE Result SerializeProperty(Handle<Object> object, bool deferred_comma,
-                                     Handle<String> deferred_key) {
+                                     Handle<String> deferred_key,
+                                     bool key_needs_no_escape = false) {
     DCHECK(!deferred_key.is_null());
-    return Serialize_<true>(object, deferred_comma, deferred_key);
+    deferred_key_needs_no_escape_ = key_needs_no_escape;
+    Result result = Serialize_<true>(object, deferred_comma, deferred_key);
+    deferred_key_needs_no_escape_ = false;
+    return result;
   }
 
   template <bool deferred_string_key>
@@ -88,6 +95,11 @@ class JsonStringifier {
                                 uint32_t length);
 
   void SerializeString(Handle<String> object);
+  void SerializeStringWithoutEscapes(Handle<String> object);
+
+  // Returns whether none of the enumerable string keys of {map} need to be
+  // escaped. The result for the last map is cached.
+  bool KeysNeedNoEscape(Handle<Map> map);
 
   template <typename SrcChar, typename DestChar>
   V8_INLINE static void SerializeStringUnchecked_(
@@ -127,8 +139,11 @@ class JsonStringifier {
   Handle<String> tojson_string_;
   Handle<FixedArray> property_list_;
   Handle<JSReceiver> replacer_function_;
+  // One-entry cache for KeysNeedNoEscape, holding the map and the result.
+  Handle<FixedArray> key_escape_cache_;
   uc16* gap_;
   int indent_;
+  bool deferred_key_needs_no_escape_ = false;
 
   using KeyObject = std::pair<Handle<Object>, Handle<Object>>;
   std::vector<KeyObject> stack_;
@@ -218,6 +233,7 @@ JsonStringifier::JsonStringifier(Isolate* isolate)
       indent_(0),
       stack_() {
   tojson_string_ = factory()->toJSON_string();
+  key_escape_cache_ = factory()->NewFixedArray(2);
 }
 
 MaybeHandle<Object> JsonStringifier::Stringify(Handle<Object> object,
@@ -768,6 +784,7 @@ JsonStringifier::Result JsonStringifier::SerializeJSObject(
     DCHECK(!object->HasIndexedInterceptor());
     DCHECK(!object->HasNamedInterceptor());
     Handle<Map> map(object->map(), isolate_);
+    bool keys_need_no_escape = KeysNeedNoEscape(map);
     builder_.AppendCharacter('{');
     Indent();
     bool comma = false;
@@ -789,7 +806,8 @@ JsonStringifier::Result JsonStringifier::SerializeJSObject(
             isolate_, property,
             Object::GetPropertyOrElement(isolate_, object, key), EXCEPTION);
       }
-      Result result = SerializeProperty(property, comma, key);
+      Result result =
+          SerializeProperty(property, comma, key, keys_need_no_escape);
       if (!comma && result == SUCCESS) comma = true;
       if (result == EXCEPTION) return result;
     }
@@ -871,6 +889,42 @@ JsonStringifier::Result JsonStringifier::SerializeJSProxy(
   return SUCCESS;
 }
 
+namespace {
+
+// Returns the end of the run of printable ASCII characters other than quotes
+// and backslashes that starts at {start}, checking a machine word at a time.
+// The result is only exact to the word, the characters after it still need to
+// be checked one by one.
+template <typename Char>
+int SkipCharactersWithoutJsonEscape(Vector<const Char> src, int start) {
+  using Word = uint64_t;
+  constexpr int kCharsPerWord = sizeof(Word) / sizeof(Char);
+  // A word with each character set to one, with each character's top bit set
+  // and with all bits above 0x7F set.
+  constexpr Word kOnes = ~Word{0} / static_cast<Char>(~Char{0});
+  constexpr Word kTopBits = kOnes << (kBitsPerByte * sizeof(Char) - 1);
+  constexpr Word kNonAscii = kOnes * static_cast<Char>(~Char{0x7F});
+  int i = start;
+  while (src.length() - i >= kCharsPerWord) {
+    Word word =
+        base::ReadUnalignedValue<Word>(reinterpret_cast<Address>(&src[i]));
+    Word quotes = word ^ (kOnes * '"');
+    Word backslashes = word ^ (kOnes * '\\');
+    // Each term is non-zero iff one of the characters is a quote, a
+    // backslash, a control character, or 0x7F and above respectively.
+    Word escapes = (((quotes - kOnes) & ~quotes) |
+                    ((backslashes - kOnes) & ~backslashes) |
+                    ((word - kOnes * 0x20) & ~word)) &
+                   kTopBits;
+    escapes |= (word | (word + kOnes)) & kNonAscii;
+    if (escapes != 0) break;
+    i += kCharsPerWord;
+  }
+  return i;
+}
+
+}  // namespace
+
 template <typename SrcChar, typename DestChar>
 void JsonStringifier::SerializeStringUnchecked_(
     Vector<const SrcChar> src,
@@ -879,6 +933,12 @@ void JsonStringifier::SerializeStringUnchecked_(
   // The <uc16, char> version of this method must not be called.
   DCHECK(sizeof(DestChar) >= sizeof(SrcChar));
   for (int i = 0; i < src.length(); i++) {
+    int run_end = SkipCharactersWithoutJsonEscape(src, i);
+    if (run_end > i) {
+      dest->AppendChars(&src[i], run_end - i);
+      i = run_end;
+      if (i == src.length()) break;
+    }
     SrcChar c = src[i];
     if (DoNotEscape(c)) {
       dest->Append(c);
@@ -1018,11 +1078,79 @@ void JsonStringifier::Separator(bool first) {
 void JsonStringifier::SerializeDeferredKey(bool deferred_comma,
                                            Handle<Object> deferred_key) {
   Separator(!deferred_comma);
-  SerializeString(Handle<String>::cast(deferred_key));
+  if (deferred_key_needs_no_escape_) {
+    SerializeStringWithoutEscapes(Handle<String>::cast(deferred_key));
+  } else {
+    SerializeString(Handle<String>::cast(deferred_key));
+  }
   builder_.AppendCharacter(':');
   if (gap_ != nullptr) builder_.AppendCharacter(' ');
 }
 
+namespace {
+
+bool NeedsNoJsonEscape(String string) {
+  if (!string.IsFlat() || !String::IsOneByteRepresentationUnderneath(string)) {
+    return false;
+  }
+  DisallowHeapAllocation no_gc;
+  Vector<const uint8_t> chars = string.GetCharVector<uint8_t>(no_gc);
+  for (int i = SkipCharactersWithoutJsonEscape(chars, 0); i < chars.length();
+       i++) {
+    uint8_t c = chars[i];
+    if (c < 0x20 || c >= 0x7F || c == '"' || c == '\\') return false;
+  }
+  return true;
+}
+
+}  // namespace
+
+bool JsonStringifier::KeysNeedNoEscape(Handle<Map> map) {
+  if (key_escape_cache_->get(0) == *map) {
+    return key_escape_cache_->get(1) == Smi::FromInt(1);
+  }
+  bool result = true;
+  {
+    DisallowHeapAllocation no_gc;
+    DescriptorArray descriptors = map->instance_descriptors();
+    for (InternalIndex i : map->IterateOwnDescriptors()) {
+      Name name = descriptors.GetKey(i);
+      if (!name.IsString() || descriptors.GetDetails(i).IsDontEnum()) continue;
+      if (!NeedsNoJsonEscape(String::cast(name))) {
+        result = false;
+        break;
+      }
+    }
+  }
+  key_escape_cache_->set(0, *map);
+  key_escape_cache_->set(1, Smi::FromInt(result ? 1 : 0));
+  return result;
+}
+
+void JsonStringifier::SerializeStringWithoutEscapes(Handle<String> object) {
+  DCHECK(NeedsNoJsonEscape(*object));
+  int length = object->length() + 2;
+  if (!builder_.CurrentPartCanFit(length)) {
+    SerializeString(object);
+    return;
+  }
+  DisallowHeapAllocation no_gc;
+  Vector<const uint8_t> chars = object->GetCharVector<uint8_t>(no_gc);
+  if (builder_.CurrentEncoding() == String::ONE_BYTE_ENCODING) {
+    IncrementalStringBuilder::NoExtendBuilder<uint8_t> no_extend(
+        &builder_, length, no_gc);
+    no_extend.Append('"');
+    no_extend.AppendChars(chars.begin(), chars.length());
+    no_extend.Append('"');
+  } else {
+    IncrementalStringBuilder::NoExtendBuilder<uc16> no_extend(&builder_,
+                                                              length, no_gc);
+    no_extend.Append('"');
+    no_extend.AppendChars(chars.begin(), chars.length());
+    no_extend.Append('"');
+  }
+}
+
 void JsonStringifier::SerializeString(Handle<String> object) {
   object = String::Flatten(isolate_, object);
   if (builder_.CurrentEncoding() == String::ONE_BYTE_ENCODING) {
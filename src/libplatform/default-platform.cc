@@ -75,6 +75,16 @@ void NotifyIsolateShutdown(v8::Platform* platform, Isolate* isolate) {
   static_cast<DefaultPlatform*>(platform)->NotifyIsolateShutdown(isolate);
 }
 
+bool SetWorkerThreadAffinity(v8::Platform* platform,
+                             const std::vector<std::vector<int>>& cpu_sets) {
+  return static_cast<DefaultPlatform*>(platform)->SetWorkerThreadAffinity(
+      cpu_sets);
+}
+
+std::vector<int> GetNumaNodeProcessors(int node) {
+  return base::SysInfo::ProcessorsOfNumaNode(node);
+}
+
 namespace {
 constexpr int kMaxThreadPoolSize = 16;
 
@@ -131,6 +141,12 @@ void DefaultPlatform::EnsureBackgroundTaskRunnerInitialized() {
   }
 }
 
+bool DefaultPlatform::SetWorkerThreadAffinity(
+    const std::vector<std::vector<int>>& cpu_sets) {
+  EnsureBackgroundTaskRunnerInitialized();
+  return worker_threads_task_runner_->SetWorkerThreadAffinity(cpu_sets);
+}
+
 void DefaultPlatform::SetTimeFunctionForTesting(
     DefaultPlatform::TimeFunction time_function) {
   base::MutexGuard guard(&lock_);
@@ -197,7 +213,22 @@ std::shared_ptr<TaskRunner> DefaultPlatform::GetForegroundTaskRunner(
 
 void DefaultPlatform::CallOnWorkerThread(std::unique_ptr<Task> task) {
   EnsureBackgroundTaskRunnerInitialized();
-  worker_threads_task_runner_->PostTask(std::move(task));
+  worker_threads_task_runner_->PostTaskWithPriority(std::move(task),
+                                                    TaskPriority::kUserVisible);
+}
+
+void DefaultPlatform::CallBlockingTaskOnWorkerThread(
+    std::unique_ptr<Task> task) {
+  EnsureBackgroundTaskRunnerInitialized();
+  worker_threads_task_runner_->PostTaskWithPriority(
+      std::move(task), TaskPriority::kUserBlocking);
+}
+
+void DefaultPlatform::CallLowPriorityTaskOnWorkerThread(
+    std::unique_ptr<Task> task) {
+  EnsureBackgroundTaskRunnerInitialized();
+  worker_threads_task_runner_->PostTaskWithPriority(std::move(task),
+                                                    TaskPriority::kBestEffort);
 }
 
 void DefaultPlatform::CallDelayedOnWorkerThread(std::unique_ptr<Task> task,
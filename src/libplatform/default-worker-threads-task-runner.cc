@@ -25,22 +25,35 @@ double DefaultWorkerThreadsTaskRunner::MonotonicallyIncreasingTime() {
 
 void DefaultWorkerThreadsTaskRunner::Terminate() {
   base::MutexGuard guard(&lock_);
-  terminated_ = true;
   queue_.Terminate();
   // Clearing the thread pool lets all worker threads join.
   thread_pool_.clear();
 }
 
-void DefaultWorkerThreadsTaskRunner::PostTask(std::unique_ptr<Task> task) {
+bool DefaultWorkerThreadsTaskRunner::SetWorkerThreadAffinity(
+    const std::vector<std::vector<int>>& cpu_sets) {
+  if (cpu_sets.empty()) return false;
   base::MutexGuard guard(&lock_);
-  if (terminated_) return;
+  bool success = true;
+  for (size_t i = 0; i < thread_pool_.size(); ++i) {
+    success &= thread_pool_[i]->SetAffinity(cpu_sets[i % cpu_sets.size()]);
+  }
+  return success;
+}
+
+// Posting only takes the lock of the queue, which drops tasks that are posted
+// after termination.
+void DefaultWorkerThreadsTaskRunner::PostTaskWithPriority(
+    std::unique_ptr<Task> task, TaskPriority priority) {
+  queue_.Append(std::move(task), priority);
+}
+
+void DefaultWorkerThreadsTaskRunner::PostTask(std::unique_ptr<Task> task) {
   queue_.Append(std::move(task));
 }
 
 void DefaultWorkerThreadsTaskRunner::PostDelayedTask(std::unique_ptr<Task> task,
                                                      double delay_in_seconds) {
-  base::MutexGuard guard(&lock_);
-  if (terminated_) return;
   queue_.AppendDelayed(std::move(task), delay_in_seconds);
 }
 
@@ -29,8 +29,17 @@ class V8_PLATFORM_EXPORT DefaultWorkerThreadsTaskRunner
 
   void Terminate();
 
+  // Restricts worker thread i to the processors in
+  // |cpu_sets[i % cpu_sets.size()]|. Returns false if any thread could not be
+  // restricted.
+  bool SetWorkerThreadAffinity(const std::vector<std::vector<int>>& cpu_sets);
+
   double MonotonicallyIncreasingTime();
 
+  // Posts an immediate task that is run before all pending tasks of lower
+  // priority.
+  void PostTaskWithPriority(std::unique_ptr<Task> task, TaskPriority priority);
+
   // v8::TaskRunner implementation.
   void PostTask(std::unique_ptr<Task> task) override;
 
@@ -60,7 +69,6 @@ class V8_PLATFORM_EXPORT DefaultWorkerThreadsTaskRunner
   // executed. Blocks if no task is available.
   std::unique_ptr<Task> GetNext();
 
-  bool terminated_ = false;
   base::Mutex lock_;
   DelayedTaskQueue queue_;
   std::vector<std::unique_ptr<WorkerThread>> thread_pool_;
@@ -17,17 +17,20 @@ DelayedTaskQueue::DelayedTaskQueue(TimeFunction time_function)
 DelayedTaskQueue::~DelayedTaskQueue() {
   base::MutexGuard guard(&lock_);
   DCHECK(terminated_);
-  DCHECK(task_queue_.empty());
+#ifdef DEBUG
+  for (const auto& queue : task_queues_) DCHECK(queue.empty());
+#endif
 }
 
 double DelayedTaskQueue::MonotonicallyIncreasingTime() {
   return time_function_();
 }
 
-void DelayedTaskQueue::Append(std::unique_ptr<Task> task) {
+void DelayedTaskQueue::Append(std::unique_ptr<Task> task,
+                              TaskPriority priority) {
   base::MutexGuard guard(&lock_);
-  DCHECK(!terminated_);
-  task_queue_.push(std::move(task));
+  if (terminated_) return;
+  task_queue(priority).push(std::move(task));
   queues_condition_var_.NotifyOne();
 }
 
@@ -37,7 +40,7 @@ void DelayedTaskQueue::AppendDelayed(std::unique_ptr<Task> task,
   double deadline = MonotonicallyIncreasingTime() + delay_in_seconds;
   {
     base::MutexGuard guard(&lock_);
-    DCHECK(!terminated_);
+    if (terminated_) return;
     delayed_task_queue_.emplace(deadline, std::move(task));
     queues_condition_var_.NotifyOne();
   }
@@ -50,12 +53,10 @@ std::unique_ptr<Task> DelayedTaskQueue::GetNext() {
     double now = MonotonicallyIncreasingTime();
     std::unique_ptr<Task> task = PopTaskFromDelayedQueue(now);
     while (task) {
-      task_queue_.push(std::move(task));
+      task_queue(TaskPriority::kUserVisible).push(std::move(task));
       task = PopTaskFromDelayedQueue(now);
     }
-    if (!task_queue_.empty()) {
-      std::unique_ptr<Task> result = std::move(task_queue_.front());
-      task_queue_.pop();
+    if (std::unique_ptr<Task> result = PopTaskFromTaskQueues()) {
       return result;
     }
 
@@ -64,7 +65,7 @@ std::unique_ptr<Task> DelayedTaskQueue::GetNext() {
       return nullptr;
     }
 
-    if (task_queue_.empty() && !delayed_task_queue_.empty()) {
+    if (!delayed_task_queue_.empty()) {
       // Wait for the next delayed task or a newly posted task.
       double wait_in_seconds = delayed_task_queue_.begin()->first - now;
       base::TimeDelta wait_delta = base::TimeDelta::FromMicroseconds(
@@ -94,6 +95,17 @@ std::unique_ptr<Task> DelayedTaskQueue::PopTaskFromDelayedQueue(double now) {
   return result;
 }
 
+std::unique_ptr<Task> DelayedTaskQueue::PopTaskFromTaskQueues() {
+  for (size_t i = kNumberOfPriorities; i > 0; --i) {
+    std::queue<std::unique_ptr<Task>>& queue = task_queues_[i - 1];
+    if (queue.empty()) continue;
+    std::unique_ptr<Task> result = std::move(queue.front());
+    queue.pop();
+    return result;
+  }
+  return nullptr;
+}
+
 void DelayedTaskQueue::Terminate() {
   base::MutexGuard guard(&lock_);
   DCHECK(!terminated_);
@@ -10,19 +10,20 @@
 #include <queue>
 
 #include "include/libplatform/libplatform-export.h"
+#include "include/v8-platform.h"
 #include "src/base/macros.h"
 #include "src/base/platform/condition-variable.h"
 #include "src/base/platform/mutex.h"
 
 namespace v8 {
 
-class Task;
-
 namespace platform {
 
-// DelayedTaskQueue provides queueing for immediate and delayed tasks. It does
-// not provide any guarantees about ordering of tasks, except that immediate
-// tasks will be run in the order that they are posted.
+// DelayedTaskQueue provides queueing for immediate and delayed tasks. Immediate
+// tasks are kept in one lane per TaskPriority; a task is only handed out if
+// all lanes of higher priority are empty. There are no other guarantees about
+// ordering of tasks, except that immediate tasks of the same priority will be
+// run in the order that they are posted.
 class V8_PLATFORM_EXPORT DelayedTaskQueue {
  public:
   using TimeFunction = double (*)();
@@ -33,12 +34,16 @@ class V8_PLATFORM_EXPORT DelayedTaskQueue {
   double MonotonicallyIncreasingTime();
 
   // Appends an immediate task to the queue. The queue takes ownership of
-  // |task|. Tasks appended via this method will be run in order. Thread-safe.
-  void Append(std::unique_ptr<Task> task);
+  // |task|. Tasks appended via this method with the same |priority| will be
+  // run in order. Tasks appended after Terminate() are dropped. Thread-safe.
+  void Append(std::unique_ptr<Task> task,
+              TaskPriority priority = TaskPriority::kUserVisible);
 
   // Appends a delayed task to the queue. There is no ordering guarantee
   // provided regarding delayed tasks, both with respect to other delayed tasks
-  // and non-delayed tasks that were appended using Append(). Thread-safe.
+  // and non-delayed tasks that were appended using Append(). Delayed tasks
+  // run with priority kUserVisible once their deadline has passed. Tasks
+  // appended after Terminate() are dropped. Thread-safe.
   void AppendDelayed(std::unique_ptr<Task> task, double delay_in_seconds);
 
   // Returns the next task to process. Blocks if no task is available.
@@ -51,11 +56,22 @@ class V8_PLATFORM_EXPORT DelayedTaskQueue {
   void Terminate();
 
  private:
+  static constexpr size_t kNumberOfPriorities =
+      static_cast<size_t>(TaskPriority::kUserBlocking) + 1;
+
+  std::queue<std::unique_ptr<Task>>& task_queue(TaskPriority priority) {
+    return task_queues_[static_cast<size_t>(priority)];
+  }
+
   std::unique_ptr<Task> PopTaskFromDelayedQueue(double now);
 
+  // Pops the oldest task of the highest priority lane that is not empty.
+  // Returns nullptr if all lanes are empty.
+  std::unique_ptr<Task> PopTaskFromTaskQueues();
+
   base::ConditionVariable queues_condition_var_;
   base::Mutex lock_;
-  std::queue<std::unique_ptr<Task>> task_queue_;
+  std::queue<std::unique_ptr<Task>> task_queues_[kNumberOfPriorities];
   std::multimap<double, std::unique_ptr<Task>> delayed_task_queue_;
   bool terminated_ = false;
   TimeFunction time_function_;
@@ -74,6 +74,9 @@ namespace internal {
   /* percent of freed code size per module, collected on GC */                 \
   HR(wasm_module_freed_code_size_percent, V8.WasmModuleCodeSizePercentFreed,   \
      0, 100, 32)                                                               \
+  /* percent of generated code size per module placed in freed code space */   \
+  HR(wasm_module_reused_code_size_percent, V8.WasmModuleCodeSizePercentReused, \
+     0, 100, 32)                                                               \
   /* number of code GCs triggered per native module, collected on code GC */   \
   HR(wasm_module_num_triggered_code_gcs,                                       \
      V8.WasmModuleNumberOfCodeGCsTriggered, 1, 128, 20)                        \
@@ -255,6 +258,12 @@ namespace internal {
   SC(inlined_copied_elements, V8.InlinedCopiedElements)            \
   SC(compilation_cache_hits, V8.CompilationCacheHits)              \
   SC(compilation_cache_misses, V8.CompilationCacheMisses)          \
+  /* Lookups of eval and Function constructor sources. */          \
+  SC(compilation_cache_eval_hits, V8.CompilationCacheEvalHits)     \
+  SC(compilation_cache_eval_misses, V8.CompilationCacheEvalMisses) \
+  /* OSR entries served from or missing in the OSR code cache. */  \
+  SC(osr_code_cache_hits, V8.OSRCodeCacheHits)                     \
+  SC(osr_code_cache_misses, V8.OSRCodeCacheMisses)                 \
   /* Amount of evaled source code. */                              \
   SC(total_eval_size, V8.TotalEvalSize)                            \
   /* Amount of loaded source code. */                              \
@@ -290,11 +299,15 @@ namespace internal {
   SC(enum_cache_hits, V8.EnumCacheHits)                                        \
   SC(enum_cache_misses, V8.EnumCacheMisses)                                    \
   SC(string_add_runtime, V8.StringAddRuntime)                                  \
+  SC(string_flattens, V8.StringFlattens)                                       \
+  SC(string_flattened_chars, V8.StringFlattenedChars)                          \
   SC(sub_string_runtime, V8.SubStringRuntime)                                  \
   SC(regexp_entry_runtime, V8.RegExpEntryRuntime)                              \
+  SC(regexp_fallbacks_to_experimental, V8.RegExpFallbacksToExperimental)       \
   SC(stack_interrupts, V8.StackInterrupts)                                     \
   SC(runtime_profiler_ticks, V8.RuntimeProfilerTicks)                          \
   SC(soft_deopts_executed, V8.SoftDeoptsExecuted)                              \
+  SC(bytecode_arrays_flushed, V8.BytecodeArraysFlushed)                        \
   SC(new_space_bytes_available, V8.MemoryNewSpaceBytesAvailable)               \
   SC(new_space_bytes_committed, V8.MemoryNewSpaceBytesCommitted)               \
   SC(new_space_bytes_used, V8.MemoryNewSpaceBytesUsed)                         \
@@ -319,6 +332,8 @@ namespace internal {
   SC(wasm_generated_code_size, V8.WasmGeneratedCodeBytes)            \
   SC(wasm_reloc_size, V8.WasmRelocBytes)                             \
   SC(wasm_lazily_compiled_functions, V8.WasmLazilyCompiledFunctions) \
+  SC(wasm_lazily_deserialized_functions, V8.WasmLazilyDeserializedFunctions) \
+  SC(wasm_tiered_up_functions, V8.WasmTieredUpFunctions)             \
   SC(liftoff_compiled_functions, V8.LiftoffCompiledFunctions)        \
   SC(liftoff_unsupported_functions, V8.LiftoffUnsupportedFunctions)
 
@@ -618,9 +618,29 @@ void WorkerThreadRuntimeCallStats::AddToMainTable(
   }
 }
 
+void WorkerThreadRuntimeCallStats::AddToSampledTable(
+    RuntimeCallStats* worker_stats) {
+  base::MutexGuard lock(&mutex_);
+  if (!sampled_table_) {
+    sampled_table_ =
+        std::make_unique<RuntimeCallStats>(RuntimeCallStats::kWorkerThread);
+  }
+  sampled_table_->Add(worker_stats);
+  // Unlike Reset(), this does not depend on the counters still being enabled.
+  for (int i = 0; i < RuntimeCallStats::kNumberOfCounters; i++) {
+    worker_stats->GetCounter(i)->Reset();
+  }
+}
+
+void WorkerThreadRuntimeCallStats::AddSampledTableTo(
+    RuntimeCallStats* call_stats) {
+  base::MutexGuard lock(&mutex_);
+  if (sampled_table_) call_stats->Add(sampled_table_.get());
+}
+
 WorkerThreadRuntimeCallStatsScope::WorkerThreadRuntimeCallStatsScope(
     WorkerThreadRuntimeCallStats* worker_stats)
-    : table_(nullptr) {
+    : worker_stats_(worker_stats), table_(nullptr) {
   if (V8_LIKELY(!TracingFlags::is_runtime_stats_enabled())) return;
 
   table_ = reinterpret_cast<RuntimeCallStats*>(
@@ -639,6 +659,14 @@ WorkerThreadRuntimeCallStatsScope::WorkerThreadRuntimeCallStatsScope(
 WorkerThreadRuntimeCallStatsScope::~WorkerThreadRuntimeCallStatsScope() {
   if (V8_LIKELY(table_ == nullptr)) return;
 
+  // Sampled counters are handed over at the end of each scope, when all
+  // timers of this thread have stopped, so that the main thread can report
+  // them without racing with this thread.
+  if ((TracingFlags::runtime_stats.load(std::memory_order_relaxed) &
+       v8::tracing::TracingCategoryObserver::ENABLED_BY_WINDOW_SAMPLING)) {
+    worker_stats_->AddToSampledTable(table_);
+  }
+
   if ((TracingFlags::runtime_stats.load(std::memory_order_relaxed) &
        v8::tracing::TracingCategoryObserver::ENABLED_BY_TRACING)) {
     auto value = v8::tracing::TracedValue::Create();
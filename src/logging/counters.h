@@ -5,6 +5,7 @@
 #ifndef V8_LOGGING_COUNTERS_H_
 #define V8_LOGGING_COUNTERS_H_
 
+#include <atomic>
 #include <memory>
 
 #include "include/v8.h"
@@ -14,6 +15,7 @@
 #include "src/base/platform/time.h"
 #include "src/common/globals.h"
 #include "src/execution/isolate.h"
+#include "src/flags/flags.h"
 #include "src/init/heap-symbols.h"
 #include "src/logging/counters-definitions.h"
 #include "src/logging/tracing-flags.h"
@@ -714,6 +716,8 @@ class RuntimeCallTimer final {
   V(ArrayBuffer_NewBackingStore)                           \
   V(ArrayBuffer_BackingStore_Reallocate)                   \
   V(Array_CloneElementAt)                                  \
+  V(Array_CopyElementsTo)                                  \
+  V(Array_Iterate)                                         \
   V(Array_New)                                             \
   V(BigInt64Array_New)                                     \
   V(BigInt_NewFromWords)                                   \
@@ -748,6 +752,7 @@ class RuntimeCallTimer final {
   V(Isolate_LocaleConfigurationChangeNotification)         \
   V(JSMemberBase_New)                                      \
   V(JSON_Parse)                                            \
+  V(JSON_ParseUtf8)                                        \
   V(JSON_Stringify)                                        \
   V(Map_AsArray)                                           \
   V(Map_Clear)                                             \
@@ -788,6 +793,7 @@ class RuntimeCallTimer final {
   V(Object_HasRealNamedCallbackProperty)                   \
   V(Object_HasRealNamedProperty)                           \
   V(Object_New)                                            \
+  V(Object_NewWithShape)                                   \
   V(Object_ObjectProtoToString)                            \
   V(Object_Set)                                            \
   V(Object_SetAccessor)                                    \
@@ -1213,9 +1219,18 @@ class WorkerThreadRuntimeCallStats final {
   // Adds the counters from the worker thread tables to |main_call_stats|.
   void AddToMainTable(RuntimeCallStats* main_call_stats);
 
+  // Moves the counters of the worker thread table |worker_stats| into the
+  // table accumulated for --runtime-call-stats-sampling-interval. Must be
+  // called on the thread owning |worker_stats| while no timer is running.
+  void AddToSampledTable(RuntimeCallStats* worker_stats);
+
+  // Adds the counters accumulated by AddToSampledTable to |call_stats|.
+  void AddSampledTableTo(RuntimeCallStats* call_stats);
+
  private:
   base::Mutex mutex_;
   std::vector<std::unique_ptr<RuntimeCallStats>> tables_;
+  std::unique_ptr<RuntimeCallStats> sampled_table_;
   base::Optional<base::Thread::LocalStorageKey> tls_key_;
   // Since this is for creating worker thread runtime-call stats, record the
   // main thread ID to ensure we never create a worker RCS table for the main
@@ -1235,6 +1250,7 @@ class WorkerThreadRuntimeCallStatsScope final {
   RuntimeCallStats* Get() const { return table_; }
 
  private:
+  WorkerThreadRuntimeCallStats* const worker_stats_;
   RuntimeCallStats* table_;
 };
 
@@ -1393,6 +1409,27 @@ class Counters : public std::enable_shared_from_this<Counters> {
     return &worker_thread_runtime_call_stats_;
   }
 
+  // CPU time spent on behalf of the isolate, see
+  // v8::Isolate::GetCpuTimeStatistics. Only recorded with
+  // --account-isolate-cpu-time.
+  enum class CpuTimeCategory {
+    kMainThread,
+    kGCBackground,
+    kCompileBackground,
+    kWasmBackground,
+    kNumberOfCategories
+  };
+
+  void AddCpuTime(CpuTimeCategory category, int64_t microseconds) {
+    cpu_time_in_us_[static_cast<int>(category)].fetch_add(
+        microseconds, std::memory_order_relaxed);
+  }
+
+  int64_t cpu_time_in_us(CpuTimeCategory category) const {
+    return cpu_time_in_us_[static_cast<int>(category)].load(
+        std::memory_order_relaxed);
+  }
+
  private:
   friend class StatsTable;
   friend class StatsCounterBase;
@@ -1401,6 +1438,8 @@ class Counters : public std::enable_shared_from_this<Counters> {
 
   Isolate* isolate_;
   StatsTable stats_table_;
+  std::atomic<int64_t> cpu_time_in_us_[static_cast<int>(
+      CpuTimeCategory::kNumberOfCategories)]{};
 
   int* FindLocation(const char* name) {
     return stats_table_.FindLocation(name);
@@ -1474,6 +1513,34 @@ class Counters : public std::enable_shared_from_this<Counters> {
   DISALLOW_IMPLICIT_CONSTRUCTORS(Counters);
 };
 
+// Charges the CPU time that the current thread spends inside the scope to
+// the given category of |counters|. Does nothing unless
+// --account-isolate-cpu-time is enabled and the platform supports thread CPU
+// time.
+class CpuTimeAccountingScope final {
+ public:
+  CpuTimeAccountingScope(Counters* counters,
+                         Counters::CpuTimeCategory category)
+      : counters_(counters), category_(category) {
+    if (V8_LIKELY(!FLAG_account_isolate_cpu_time)) return;
+    if (!base::ThreadTicks::IsSupported()) return;
+    start_ = base::ThreadTicks::Now();
+  }
+
+  ~CpuTimeAccountingScope() {
+    if (V8_LIKELY(start_.IsNull())) return;
+    counters_->AddCpuTime(category_,
+                          (base::ThreadTicks::Now() - start_).InMicroseconds());
+  }
+
+ private:
+  Counters* const counters_;
+  const Counters::CpuTimeCategory category_;
+  base::ThreadTicks start_;
+
+  DISALLOW_COPY_AND_ASSIGN(CpuTimeAccountingScope);
+};
+
 void HistogramTimer::Start() {
   TimedHistogram::Start(&timer_, counters()->isolate());
 }
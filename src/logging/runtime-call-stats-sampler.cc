@@ -0,0 +1,189 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/logging/runtime-call-stats-sampler.h"
+
+#include <algorithm>
+#include <memory>
+
+#include "include/v8-metrics.h"
+#include "src/base/ieee754.h"
+#include "src/execution/isolate.h"
+#include "src/flags/flags.h"
+#include "src/init/v8.h"
+#include "src/logging/counters.h"
+#include "src/logging/metrics.h"
+#include "src/logging/tracing-flags.h"
+#include "src/tracing/tracing-category-observer.h"
+
+namespace v8 {
+namespace internal {
+
+namespace {
+
+// TracingFlags::runtime_stats is process-wide, so windows of several isolates
+// may overlap. The counters stay enabled until the last window closes.
+base::LazyMutex open_windows_mutex = LAZY_MUTEX_INITIALIZER;
+int open_windows = 0;
+
+void EnableCountersForWindow() {
+  base::MutexGuard guard(open_windows_mutex.Pointer());
+  if (open_windows++ == 0) {
+    TracingFlags::runtime_stats.fetch_or(
+        v8::tracing::TracingCategoryObserver::ENABLED_BY_WINDOW_SAMPLING,
+        std::memory_order_relaxed);
+  }
+}
+
+void DisableCountersForWindow() {
+  base::MutexGuard guard(open_windows_mutex.Pointer());
+  DCHECK_LT(0, open_windows);
+  if (--open_windows == 0) {
+    TracingFlags::runtime_stats.fetch_and(
+        ~v8::tracing::TracingCategoryObserver::ENABLED_BY_WINDOW_SAMPLING,
+        std::memory_order_relaxed);
+  }
+}
+
+}  // namespace
+
+class RuntimeCallStatsSampler::OpenWindowTask final : public CancelableTask {
+ public:
+  explicit OpenWindowTask(RuntimeCallStatsSampler* sampler)
+      : CancelableTask(&sampler->task_manager_), sampler_(sampler) {}
+
+ private:
+  void RunInternal() final { sampler_->OpenWindow(); }
+
+  RuntimeCallStatsSampler* const sampler_;
+};
+
+class RuntimeCallStatsSampler::CloseWindowTask final : public CancelableTask {
+ public:
+  explicit CloseWindowTask(RuntimeCallStatsSampler* sampler)
+      : CancelableTask(&sampler->task_manager_), sampler_(sampler) {}
+
+ private:
+  void RunInternal() final { sampler_->CloseWindow(); }
+
+  RuntimeCallStatsSampler* const sampler_;
+};
+
+class RuntimeCallStatsSampler::ReportTask final : public CancelableTask {
+ public:
+  explicit ReportTask(RuntimeCallStatsSampler* sampler)
+      : CancelableTask(&sampler->task_manager_), sampler_(sampler) {}
+
+ private:
+  void RunInternal() final { sampler_->Report(); }
+
+  RuntimeCallStatsSampler* const sampler_;
+};
+
+RuntimeCallStatsSampler::RuntimeCallStatsSampler(Isolate* isolate)
+    : isolate_(isolate) {
+  if (FLAG_random_seed != 0) random_.SetSeed(FLAG_random_seed);
+}
+
+RuntimeCallStatsSampler::~RuntimeCallStatsSampler() {
+  DCHECK(!window_open_);
+  task_manager_.CancelAndWait();
+}
+
+void RuntimeCallStatsSampler::Start() {
+  // Explicitly enabled runtime call stats are never turned off.
+  if (FLAG_runtime_call_stats_sampling_interval <= 0 ||
+      FLAG_runtime_call_stats) {
+    return;
+  }
+  started_ = true;
+  ScheduleWindow();
+}
+
+void RuntimeCallStatsSampler::Stop() {
+  if (!started_) return;
+  started_ = false;
+  task_manager_.CancelAndWait();
+  FinishWindow();
+  Report();
+}
+
+void RuntimeCallStatsSampler::ScheduleWindow() {
+  // Exponentially distributed gaps between the windows, so that the windows
+  // do not line up with periodic work of the embedder.
+  double u = std::max(random_.NextDouble(), 1e-6);
+  double delay_in_ms =
+      -base::ieee754::log(u) * FLAG_runtime_call_stats_sampling_interval;
+  V8::GetCurrentPlatform()->CallDelayedOnWorkerThread(
+      std::make_unique<OpenWindowTask>(this),
+      delay_in_ms / base::Time::kMillisecondsPerSecond);
+}
+
+void RuntimeCallStatsSampler::OpenWindow() {
+  {
+    base::MutexGuard guard(&mutex_);
+    DCHECK(!window_open_);
+    window_open_ = true;
+    window_start_ = base::TimeTicks::Now();
+  }
+  EnableCountersForWindow();
+  V8::GetCurrentPlatform()->CallDelayedOnWorkerThread(
+      std::make_unique<CloseWindowTask>(this),
+      static_cast<double>(FLAG_runtime_call_stats_sampling_window) /
+          base::Time::kMillisecondsPerSecond);
+}
+
+void RuntimeCallStatsSampler::CloseWindow() {
+  FinishWindow();
+  // The main thread table can only be read on the isolate's thread.
+  auto taskrunner = V8::GetCurrentPlatform()->GetForegroundTaskRunner(
+      reinterpret_cast<v8::Isolate*>(isolate_));
+  taskrunner->PostTask(std::make_unique<ReportTask>(this));
+  ScheduleWindow();
+}
+
+void RuntimeCallStatsSampler::FinishWindow() {
+  {
+    base::MutexGuard guard(&mutex_);
+    if (!window_open_) return;
+    window_open_ = false;
+    window_count_++;
+    sampled_time_ += base::TimeTicks::Now() - window_start_;
+  }
+  DisableCountersForWindow();
+}
+
+void RuntimeCallStatsSampler::Report() {
+  const std::shared_ptr<metrics::Recorder>& recorder =
+      isolate_->metrics_recorder();
+  if (!recorder->HasEmbedderRecorder()) return;
+  // Tracing resets the tables whenever it dumps them, which would make the
+  // numbers meaningless.
+  if (TracingFlags::runtime_stats.load(std::memory_order_relaxed) &
+      ~v8::tracing::TracingCategoryObserver::ENABLED_BY_WINDOW_SAMPLING) {
+    return;
+  }
+
+  v8::metrics::RuntimeCallStatsSample event;
+  {
+    base::MutexGuard guard(&mutex_);
+    event.window_count = window_count_;
+    event.sampled_wall_clock_time_in_us = sampled_time_.InMicroseconds();
+  }
+  auto accumulated = std::make_unique<RuntimeCallStats>(
+      RuntimeCallStats::kMainIsolateThread);
+  accumulated->Add(isolate_->counters()->runtime_call_stats());
+  isolate_->counters()->worker_thread_runtime_call_stats()->AddSampledTableTo(
+      accumulated.get());
+  for (int i = 0; i < RuntimeCallStats::kNumberOfCounters; i++) {
+    RuntimeCallCounter* counter = accumulated->GetCounter(i);
+    if (counter->count() == 0) continue;
+    event.counters.push_back(
+        {counter->name(), counter->count(), counter->time().InMicroseconds()});
+  }
+  recorder->AddThreadSafeEvent(event);
+}
+
+}  // namespace internal
+}  // namespace v8
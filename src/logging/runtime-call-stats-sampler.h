@@ -0,0 +1,67 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_LOGGING_RUNTIME_CALL_STATS_SAMPLER_H_
+#define V8_LOGGING_RUNTIME_CALL_STATS_SAMPLER_H_
+
+#include "src/base/macros.h"
+#include "src/base/platform/mutex.h"
+#include "src/base/platform/time.h"
+#include "src/base/utils/random-number-generator.h"
+#include "src/tasks/cancelable-task.h"
+
+namespace v8 {
+namespace internal {
+
+class Isolate;
+
+// Enables runtime call stats for short windows at random intervals (see
+// --runtime-call-stats-sampling-interval), so that they cost nothing outside
+// of the windows. Each thread accumulates into its own table. After each
+// window the counters of all threads collected so far are reported to the
+// embedder's metrics recorder as a v8::metrics::RuntimeCallStatsSample.
+class RuntimeCallStatsSampler final {
+ public:
+  explicit RuntimeCallStatsSampler(Isolate* isolate);
+  ~RuntimeCallStatsSampler();
+
+  // Schedules the first window if sampling is enabled.
+  void Start();
+
+  // Cancels pending windows, closes an open one and reports the result.
+  // Must be called on the isolate's thread.
+  void Stop();
+
+ private:
+  class OpenWindowTask;
+  class CloseWindowTask;
+  class ReportTask;
+
+  void ScheduleWindow();
+  void OpenWindow();
+  void CloseWindow();
+  // Closes the window if it is open, without scheduling the next one.
+  void FinishWindow();
+  void Report();
+
+  Isolate* const isolate_;
+  CancelableTaskManager task_manager_;
+  // Only used by the window tasks, which never run concurrently.
+  base::RandomNumberGenerator random_;
+  bool started_ = false;
+
+  base::Mutex mutex_;
+  // The following fields are protected by {mutex_}.
+  bool window_open_ = false;
+  base::TimeTicks window_start_;
+  size_t window_count_ = 0;
+  base::TimeDelta sampled_time_;
+
+  DISALLOW_COPY_AND_ASSIGN(RuntimeCallStatsSampler);
+};
+
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_LOGGING_RUNTIME_CALL_STATS_SAMPLER_H_
@@ -0,0 +1,29 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_NUMBERS_EISEL_LEMIRE_H_
+#define V8_NUMBERS_EISEL_LEMIRE_H_
+
+#include <stdint.h>
+
+#include "src/base/macros.h"
+
+namespace v8 {
+namespace internal {
+
+// Computes the double closest to significand * 10^exponent using the
+// Eisel-Lemire algorithm: the significand is multiplied with a truncated
+// 128-bit approximation of the power of ten, which is precise enough to
+// determine the correctly rounded result in all but a few ambiguous cases.
+// Returns false if the result could not be determined, in which case the
+// caller has to fall back to a slower, exact algorithm. Subnormal results
+// and results that overflow to infinity are not handled either.
+// The significand must not be zero.
+V8_EXPORT_PRIVATE bool EiselLemireStrtod(uint64_t significand, int exponent,
+                                         double* result);
+
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_NUMBERS_EISEL_LEMIRE_H_
@@ -11,6 +11,7 @@
 #include "src/numbers/bignum.h"
 #include "src/numbers/cached-powers.h"
 #include "src/numbers/double.h"
+#include "src/numbers/eisel-lemire.h"
 #include "src/utils/utils.h"
 
 namespace v8 {
@@ -202,6 +203,25 @@ static bool DoubleStrtod(Vector<const char> trimmed, int exponent,
 
 // Returns 10^exponent as an exact DiyFp.
 // The given exponent must be in the range [1; kDecimalExponentDistance[.
+// Tries the Eisel-Lemire algorithm on the first 19 digits. If there are more
+// digits, the exact value lies strictly between the truncated significand and
+// the next larger one, and the result is only returned if both round to the
+// same double.
+static bool EiselLemireStrtod(Vector<const char> trimmed, int exponent,
+                              double* result) {
+  int read_digits;
+  uint64_t significand = ReadUint64(trimmed, &read_digits);
+  int remaining_digits = trimmed.length() - read_digits;
+  if (!EiselLemireStrtod(significand, exponent + remaining_digits, result)) {
+    return false;
+  }
+  if (remaining_digits == 0) return true;
+  double upper;
+  return EiselLemireStrtod(significand + 1, exponent + remaining_digits,
+                           &upper) &&
+         upper == *result;
+}
+
 static DiyFp AdjustmentPowerOfTen(int exponent) {
   DCHECK_LT(0, exponent);
   DCHECK_LT(exponent, PowersOfTenCache::kDecimalExponentDistance);
@@ -407,6 +427,7 @@ double Strtod(Vector<const char> buffer, int exponent) {
 
   double guess;
   if (DoubleStrtod(trimmed, exponent, &guess) ||
+      EiselLemireStrtod(trimmed, exponent, &guess) ||
       DiyFpStrtod(trimmed, exponent, &guess)) {
     return guess;
   }
@@ -450,13 +450,16 @@ std::unique_ptr<BackingStore> BackingStore::AllocateWasmMemory(
 }
 
 std::unique_ptr<BackingStore> BackingStore::CopyWasmMemory(Isolate* isolate,
-                                                           size_t new_pages) {
+                                                           size_t new_pages,
+                                                           size_t max_pages) {
+  DCHECK_LE(new_pages, max_pages);
   // Note that we could allocate uninitialized to save initialization cost here,
   // but since Wasm memories are allocated by the page allocator, the zeroing
   // cost is already built-in.
-  // TODO(titzer): should we use a suitable maximum here?
+  // {AllocateWasmMemory} falls back to smaller reservations down to
+  // {new_pages} if {max_pages} cannot be reserved.
   auto new_backing_store = BackingStore::AllocateWasmMemory(
-      isolate, new_pages, new_pages,
+      isolate, new_pages, max_pages,
       is_shared() ? SharedFlag::kShared : SharedFlag::kNotShared);
 
   if (!new_backing_store ||
@@ -639,6 +642,21 @@ bool BackingStore::Reallocate(Isolate* isolate, size_t new_byte_length) {
   return true;
 }
 
+bool BackingStore::ReleaseToAllocatorBatch(
+    v8::ArrayBuffer::Allocator* allocator, void** data, size_t* length) {
+  if (buffer_start_ == nullptr || is_wasm_memory_ || custom_deleter_ ||
+      globally_registered_ || !free_on_destruct_) {
+    return false;
+  }
+  if (get_v8_api_array_buffer_allocator() != allocator) return false;
+  TRACE_BS("BS:batch  bs=%p mem=%p (length=%zu, capacity=%zu)\n", this,
+           buffer_start_, byte_length(), byte_capacity_);
+  *data = buffer_start_;
+  *length = byte_length_;
+  Clear();
+  return true;
+}
+
 v8::ArrayBuffer::Allocator* BackingStore::get_v8_api_array_buffer_allocator() {
   CHECK(!is_wasm_memory_);
   auto array_buffer_allocator =
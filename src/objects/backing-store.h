@@ -92,10 +92,19 @@ class V8_EXPORT_PRIVATE BackingStore : public BackingStoreBase {
   // Wrapper around ArrayBuffer::Allocator::Reallocate.
   bool Reallocate(Isolate* isolate, size_t new_byte_length);
 
+  // If this backing store would free its memory through |allocator| when
+  // destructed, hands the memory over to the caller instead, who becomes
+  // responsible for freeing it (e.g. via ArrayBuffer::Allocator::FreeBatch).
+  // Returns false and leaves the backing store untouched otherwise.
+  bool ReleaseToAllocatorBatch(v8::ArrayBuffer::Allocator* allocator,
+                               void** data, size_t* length);
+
   // Allocate a new, larger, backing store for this Wasm memory and copy the
-  // contents of this backing store into it.
+  // contents of this backing store into it. Tries to reserve capacity for up
+  // to {max_pages}, so that later growth can happen in place.
   std::unique_ptr<BackingStore> CopyWasmMemory(Isolate* isolate,
-                                               size_t new_pages);
+                                               size_t new_pages,
+                                               size_t max_pages);
 
   // Attach the given memory object to this backing store. The memory object
   // will be updated if this backing store is grown.
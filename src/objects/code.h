@@ -335,6 +335,9 @@ class Code : public HeapObject {
   // object has been moved by delta bytes.
   void Relocate(intptr_t delta);
 
+  // Like Relocate, but leaves flushing the instruction cache to the caller.
+  void RelocateNoFlush(intptr_t delta);
+
   // Migrate code from desc without flushing the instruction cache.
   void CopyFromNoFlush(Heap* heap, const CodeDesc& desc);
 
@@ -85,11 +85,11 @@ EXTERN_DECLARE_HASH_TABLE(CompilationCacheTable, CompilationCacheShape)
 // the hash. On each call to Age all such lifetimes get reduced, and
 // removed once they reach zero. If a second put is called while such
 // a hash is live in the cache, the hash gets replaced by an actual
-// cache entry. Age also removes stale live entries from the cache.
-// Such entries are identified by SharedFunctionInfos pointing to
-// either the recompilation stub, or to "old" code. This avoids memory
-// leaks due to premature caching of scripts and eval strings that are
-// never needed later.
+// cache entry. Age also removes stale live entries from the cache
+// unless |evict_old_entries| is false. Such entries are identified by
+// SharedFunctionInfos pointing to either the recompilation stub, or to
+// "old" code. This avoids memory leaks due to premature caching of
+// scripts and eval strings that are never needed later.
 class CompilationCacheTable
     : public HashTable<CompilationCacheTable, CompilationCacheShape> {
  public:
@@ -121,7 +121,7 @@ class CompilationCacheTable
       Isolate* isolate, Handle<CompilationCacheTable> cache,
       Handle<SharedFunctionInfo> key, Handle<Code> value);
   void Remove(Object value);
-  void Age();
+  void Age(bool evict_old_entries);
   static const int kHashGenerations = 10;
 
   DECL_CAST(CompilationCacheTable)
@@ -2158,6 +2158,22 @@ class FastElementsAccessor : public ElementsAccessorBase<Subclass, KindTraits> {
     }
     DCHECK_LE(end, Subclass::GetCapacityImpl(*receiver, receiver->elements()));
 
+    DisallowHeapAllocation no_gc;
+    if (IsSmiOrObjectElementsKind(Subclass::kind()) && obj_value->IsSmi()) {
+      // Smis don't need a write barrier, so they can be stored in bulk.
+      FixedArray elements = FixedArray::cast(receiver->elements());
+      MemsetTagged(elements.RawFieldOfElementAt(static_cast<int>(start)),
+                   *obj_value, end - start);
+      return *receiver;
+    }
+    if (IsDoubleElementsKind(Subclass::kind())) {
+      FixedDoubleArray elements = FixedDoubleArray::cast(receiver->elements());
+      double value = obj_value->Number();
+      for (size_t index = start; index < end; ++index) {
+        elements.set(static_cast<int>(index), value);
+      }
+      return *receiver;
+    }
     for (size_t index = start; index < end; ++index) {
       Subclass::SetImpl(receiver, InternalIndex(index), *obj_value);
     }
@@ -3172,6 +3188,37 @@ class TypedElementsAccessor
     return *typed_array;
   }
 
+  // Returns the index of the first element in [start, end) that is equal to
+  // {value}, or {end} if there is none. {value} must not be NaN.
+  static size_t FindFirstImpl(ElementType* data_ptr, size_t start, size_t end,
+                              ElementType value) {
+    if (start >= end) return end;
+    if (sizeof(ElementType) == 1) {
+      // Byte-sized elements can use the (vectorized) libc search.
+      TSAN_ANNOTATE_IGNORE_READS_BEGIN;
+      const void* match = memchr(data_ptr + start, static_cast<uint8_t>(value),
+                                 end - start);
+      TSAN_ANNOTATE_IGNORE_READS_END;
+      if (match == nullptr) return end;
+      return static_cast<const ElementType*>(match) - data_ptr;
+    }
+    // Compare blocks of elements without an early exit, which the C++
+    // compiler can vectorize, and then locate the match within the block.
+    static constexpr size_t kBlockSize = 32 / sizeof(ElementType);
+    size_t k = start;
+    for (; k + kBlockSize <= end; k += kBlockSize) {
+      bool found = false;
+      for (size_t i = 0; i < kBlockSize; ++i) {
+        found |= AccessorClass::GetImpl(data_ptr, k + i) == value;
+      }
+      if (found) break;
+    }
+    for (; k < end; ++k) {
+      if (AccessorClass::GetImpl(data_ptr, k) == value) return k;
+    }
+    return end;
+  }
+
   static Maybe<bool> IncludesValueImpl(Isolate* isolate,
                                        Handle<JSObject> receiver,
                                        Handle<Object> value, size_t start_from,
@@ -3230,11 +3277,8 @@ class TypedElementsAccessor
       }
     }
 
-    for (size_t k = start_from; k < length; ++k) {
-      ElementType elem_k = AccessorClass::GetImpl(data_ptr, k);
-      if (elem_k == typed_search_value) return Just(true);
-    }
-    return Just(false);
+    return Just(FindFirstImpl(data_ptr, start_from, length,
+                              typed_search_value) < length);
   }
 
   static Maybe<int64_t> IndexOfValueImpl(Isolate* isolate,
@@ -3283,10 +3327,8 @@ class TypedElementsAccessor
       length = typed_array.length();
     }
 
-    for (size_t k = start_from; k < length; ++k) {
-      ElementType elem_k = AccessorClass::GetImpl(data_ptr, k);
-      if (elem_k == typed_search_value) return Just<int64_t>(k);
-    }
+    size_t k = FindFirstImpl(data_ptr, start_from, length, typed_search_value);
+    if (k < length) return Just<int64_t>(k);
     return Just<int64_t>(-1);
   }
 
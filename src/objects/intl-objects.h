@@ -153,6 +153,13 @@ class Intl {
   V8_WARN_UNUSED_RESULT static MaybeHandle<String> ConvertToLower(
       Isolate* isolate, Handle<String> s);
 
+  // Returns whether the ICU object created for the given locales and options
+  // can be taken from and put into the isolate's ICU object cache. This is the
+  // case if examining the arguments has no observable side effects, i.e. when
+  // the options are undefined and the locales are undefined or a string.
+  static bool CanCacheICUObject(Isolate* isolate, Handle<Object> locales,
+                                Handle<Object> options);
+
   V8_WARN_UNUSED_RESULT static MaybeHandle<Object> StringLocaleCompare(
       Isolate* isolate, Handle<String> s1, Handle<String> s2,
       Handle<Object> locales, Handle<Object> options, const char* method);
@@ -39,6 +39,7 @@ int JSRegExp::CaptureCount() const {
     case ATOM:
       return 0;
     case IRREGEXP:
+    case EXPERIMENTAL:
       return Smi::ToInt(DataAt(kIrregexpCaptureCountIndex));
     default:
       UNREACHABLE();
@@ -66,7 +67,7 @@ String JSRegExp::Pattern() {
 
 Object JSRegExp::CaptureNameMap() {
   DCHECK(this->data().IsFixedArray());
-  DCHECK_EQ(TypeTag(), IRREGEXP);
+  DCHECK(TypeTag() == IRREGEXP || TypeTag() == EXPERIMENTAL);
   Object value = DataAt(kIrregexpCaptureNameMapIndex);
   DCHECK_NE(value, Smi::FromInt(JSRegExp::kUninitializedValue));
   return value;
@@ -252,7 +252,7 @@ bool JSRegExp::ShouldProduceBytecode() {
 // tier-up ticks value is not set.
 bool JSRegExp::MarkedForTierUp() {
   DCHECK(data().IsFixedArray());
-  if (TypeTag() == JSRegExp::ATOM || !FLAG_regexp_tier_up) {
+  if (TypeTag() != JSRegExp::IRREGEXP || !FLAG_regexp_tier_up) {
     return false;
   }
   return Smi::ToInt(DataAt(kIrregexpTicksUntilTierUpIndex)) == 0;
@@ -261,6 +261,7 @@ bool JSRegExp::MarkedForTierUp() {
 void JSRegExp::ResetLastTierUpTick() {
   DCHECK(FLAG_regexp_tier_up);
   DCHECK_EQ(TypeTag(), JSRegExp::IRREGEXP);
+  if (TierUpPending()) return;
   int tier_up_ticks = Smi::ToInt(DataAt(kIrregexpTicksUntilTierUpIndex)) + 1;
   FixedArray::cast(data()).set(JSRegExp::kIrregexpTicksUntilTierUpIndex,
                                Smi::FromInt(tier_up_ticks));
@@ -270,7 +271,7 @@ void JSRegExp::TierUpTick() {
   DCHECK(FLAG_regexp_tier_up);
   DCHECK_EQ(TypeTag(), JSRegExp::IRREGEXP);
   int tier_up_ticks = Smi::ToInt(DataAt(kIrregexpTicksUntilTierUpIndex));
-  if (tier_up_ticks == 0) {
+  if (tier_up_ticks <= 0) {
     return;
   }
   FixedArray::cast(data()).set(JSRegExp::kIrregexpTicksUntilTierUpIndex,
@@ -280,10 +281,28 @@ void JSRegExp::TierUpTick() {
 void JSRegExp::MarkTierUpForNextExec() {
   DCHECK(FLAG_regexp_tier_up);
   DCHECK_EQ(TypeTag(), JSRegExp::IRREGEXP);
+  // A pending tier-up task compiles the native code soon anyway.
+  if (TierUpPending()) return;
   FixedArray::cast(data()).set(JSRegExp::kIrregexpTicksUntilTierUpIndex,
                                Smi::zero());
 }
 
+bool JSRegExp::TierUpPending() {
+  DCHECK(data().IsFixedArray());
+  if (TypeTag() != JSRegExp::IRREGEXP || !FLAG_regexp_tier_up) {
+    return false;
+  }
+  return Smi::ToInt(DataAt(kIrregexpTicksUntilTierUpIndex)) ==
+         kTierUpPendingValue;
+}
+
+void JSRegExp::MarkTierUpPending() {
+  DCHECK(FLAG_regexp_tier_up_in_task);
+  DCHECK_EQ(TypeTag(), JSRegExp::IRREGEXP);
+  FixedArray::cast(data()).set(JSRegExp::kIrregexpTicksUntilTierUpIndex,
+                               Smi::FromInt(kTierUpPendingValue));
+}
+
 // static
 MaybeHandle<JSRegExp> JSRegExp::Initialize(Handle<JSRegExp> regexp,
                                            Handle<String> source,
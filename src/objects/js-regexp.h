@@ -36,7 +36,10 @@ class JSRegExp : public TorqueGeneratedJSRegExp<JSRegExp, JSObject> {
   // NOT_COMPILED: Initial value. No data has been stored in the JSRegExp yet.
   // ATOM: A simple string to match against using an indexOf operation.
   // IRREGEXP: Compiled with Irregexp.
-  enum Type { NOT_COMPILED, ATOM, IRREGEXP };
+  // EXPERIMENTAL: Compiled to bytecode of the linear-time experimental
+  // engine. Uses the irregexp data layout; both bytecode slots hold the same
+  // array and the code slots are unused.
+  enum Type { NOT_COMPILED, ATOM, IRREGEXP, EXPERIMENTAL };
   DEFINE_TORQUE_GENERATED_JS_REG_EXP_FLAGS()
 
   static constexpr base::Optional<Flag> FlagFromChar(char c) {
@@ -85,6 +88,8 @@ class JSRegExp : public TorqueGeneratedJSRegExp<JSRegExp, JSObject> {
   void ResetLastTierUpTick();
   void TierUpTick();
   void MarkTierUpForNextExec();
+  bool TierUpPending();
+  void MarkTierUpPending();
 
   inline Type TypeTag() const;
 
@@ -206,6 +211,10 @@ class JSRegExp : public TorqueGeneratedJSRegExp<JSRegExp, JSObject> {
   // tier-up to the compiler immediately, instead of using the interpreter.
   static constexpr int kTierUpForSubjectLengthValue = 1000;
 
+  // The tier-up ticks value of a regexp whose tier-up compilation has been
+  // posted as a task (see --regexp-tier-up-in-task) but not yet run.
+  static constexpr int kTierUpPendingValue = -1;
+
   TQ_OBJECT_CONSTRUCTORS(JSRegExp)
 };
 
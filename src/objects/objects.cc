@@ -6562,7 +6562,7 @@ Handle<CompilationCacheTable> CompilationCacheTable::PutCode(
   return cache;
 }
 
-void CompilationCacheTable::Age() {
+void CompilationCacheTable::Age(bool evict_old_entries) {
   DisallowHeapAllocation no_allocation;
   Object the_hole_value = GetReadOnlyRoots().the_hole_value();
   for (InternalIndex entry : IterateEntries()) {
@@ -6579,7 +6579,7 @@ void CompilationCacheTable::Age() {
       } else {
         NoWriteBarrierSet(*this, value_index, count);
       }
-    } else if (get(entry_index).IsFixedArray()) {
+    } else if (evict_old_entries && get(entry_index).IsFixedArray()) {
       SharedFunctionInfo info = SharedFunctionInfo::cast(get(value_index));
       if (info.IsInterpreted() && info.GetBytecodeArray().IsOld()) {
         for (int i = 0; i < kEntrySize; i++) {
@@ -113,11 +113,17 @@ int OrderedHashTable<Derived, entrysize>::FindEntry(Isolate* isolate,
     entry = HashToEntry(Smi::ToInt(hash));
   }
 
-  // Walk the chain in the bucket to find the key.
+  // Walk the chain in the bucket to find the key. The number of buckets is
+  // fixed for the lifetime of the table, so compute the start of the entries
+  // once instead of reloading it for every entry on the chain.
+  int const entries_start = HashTableStartIndex() + NumberOfBuckets();
   while (entry != kNotFound) {
-    Object candidate_key = KeyAt(entry);
-    if (candidate_key.SameValueZero(key)) break;
-    entry = NextChainEntry(entry);
+    int const index = entries_start + entry * kEntrySize;
+    DCHECK_EQ(index, EntryToIndex(entry));
+    Object candidate_key = get(index);
+    // Most keys are found by identity; only call out for numbers and strings.
+    if (candidate_key == key || candidate_key.SameValueZero(key)) break;
+    entry = Smi::ToInt(get(index + kChainOffset));
   }
 
   return entry;
@@ -371,16 +377,15 @@ V8_EXPORT_PRIVATE int OrderedHashTable<OrderedNameDictionary, 3>::FindEntry(
   Name raw_key = Name::cast(key);
 
   int entry = HashToEntry(raw_key.Hash());
+  int const entries_start = HashTableStartIndex() + NumberOfBuckets();
   while (entry != kNotFound) {
-    Object candidate_key = KeyAt(entry);
+    int const index = entries_start + entry * kEntrySize;
+    DCHECK_EQ(index, EntryToIndex(entry));
+    Object candidate_key = get(index);
     DCHECK(candidate_key.IsTheHole() ||
            Name::cast(candidate_key).IsUniqueName());
     if (candidate_key == raw_key) return entry;
-
-    // TODO(gsathya): This is loading the bucket count from the hash
-    // table for every iteration. This should be peeled out of the
-    // loop.
-    entry = NextChainEntry(entry);
+    entry = Smi::ToInt(get(index + kChainOffset));
   }
 
   return kNotFound;
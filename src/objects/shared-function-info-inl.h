@@ -508,6 +508,9 @@ bool SharedFunctionInfo::ShouldFlushBytecode(BytecodeFlushMode mode) {
 
   BytecodeArray bytecode = BytecodeArray::cast(data);
 
+  if (mode == BytecodeFlushMode::kFlushUnusedBytecode) {
+    return bytecode.bytecode_age() > BytecodeArray::kFirstBytecodeAge;
+  }
   return bytecode.IsOld();
 }
 
@@ -9,6 +9,7 @@
 #include "src/heap/heap-inl.h"
 #include "src/heap/memory-chunk.h"
 #include "src/heap/read-only-heap.h"
+#include "src/logging/counters.h"
 #include "src/numbers/conversions.h"
 #include "src/objects/map.h"
 #include "src/objects/oddball.h"
@@ -43,6 +44,8 @@ Handle<String> String::SlowFlatten(Isolate* isolate, Handle<ConsString> cons,
 
   DCHECK(AllowHeapAllocation::IsAllowed());
   int length = cons->length();
+  isolate->counters()->string_flattens()->Increment();
+  isolate->counters()->string_flattened_chars()->Increment(length);
   allocation =
       ObjectInYoungGeneration(*cons) ? allocation : AllocationType::kOld;
   Handle<SeqString> result;
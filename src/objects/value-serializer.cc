@@ -40,6 +40,8 @@ namespace internal {
 // Version 12: regexp and string objects share normal string encoding
 // Version 13: host objects have an explicit tag (rather than handling all
 //             unknown tags)
+// Version 14: objects with the same map share a shape, so that their keys are
+//             written only once
 //
 // WARNING: Increasing this value is a change which cannot safely be rolled
 // back without breaking compatibility with data stored on disk. It is
@@ -48,7 +50,7 @@ namespace internal {
 //
 // Recent changes are routinely reverted in preparation for branch, and this
 // has been the cause of at least one bug in the past.
-static const uint32_t kLatestVersion = 13;
+static const uint32_t kLatestVersion = 14;
 static_assert(kLatestVersion == v8::CurrentValueSerializerFormatVersion(),
               "Exported format version must match latest version.");
 
@@ -98,6 +100,12 @@ enum class SerializationTag : uint8_t {
   kBeginJSObject = 'o',
   // End of a JS object. numProperties:uint32_t
   kEndJSObject = '{',
+  // A JS object whose keys are described by a shape. shapeID:uint32_t
+  // The first object of each shape also defines it: if shapeID is the number
+  // of shapes defined so far, it is followed by numKeys:uint32_t and the keys.
+  // Then one value per key follows, or kTheHole if the property disappeared
+  // while serializing (in which case it is skipped). Introduced in version 14.
+  kBeginShapedJSObject = 'O',
   // Beginning of a sparse JS array. length:uint32_t
   // Elements and properties are written as key/value pairs, like objects.
   kBeginSparseJSArray = 'a',
@@ -155,6 +163,10 @@ enum class SerializationTag : uint8_t {
   // A list of (subtag: ErrorTag, [subtag dependent data]). See ErrorTag for
   // details.
   kError = 'r',
+  // An external string transfer. transferID:uint32_t
+  // Only written when the delegate asks for it, so values containing it are
+  // never persisted and this doesn't require a new format version.
+  kExternalStringTransfer = 'E',
 
   // The following tags are reserved because they were in use in Chromium before
   // the kHostObject tag was introduced in format version 13, at
@@ -236,7 +248,8 @@ ValueSerializer::ValueSerializer(Isolate* isolate,
       zone_(isolate->allocator(), ZONE_NAME),
       id_map_(isolate->heap(), ZoneAllocationPolicy(&zone_)),
       array_buffer_transfer_map_(isolate->heap(),
-                                 ZoneAllocationPolicy(&zone_)) {}
+                                 ZoneAllocationPolicy(&zone_)),
+      shape_map_(isolate->heap(), ZoneAllocationPolicy(&zone_)) {}
 
 ValueSerializer::~ValueSerializer() {
   if (buffer_) {
@@ -428,7 +441,12 @@ Maybe<bool> ValueSerializer::WriteObject(Handle<Object> object) {
     }
     default:
       if (object->IsString()) {
-        WriteString(Handle<String>::cast(object));
+        Handle<String> string = Handle<String>::cast(object);
+        bool transferred;
+        if (!TryWriteExternalStringTransfer(string).To(&transferred)) {
+          return Nothing<bool>();
+        }
+        if (!transferred) WriteString(string);
         return ThrowIfOutOfMemory();
       } else if (object->IsJSReceiver()) {
         return WriteJSReceiver(Handle<JSReceiver>::cast(object));
@@ -498,6 +516,19 @@ void ValueSerializer::WriteString(Handle<String> string) {
   }
 }
 
+Maybe<bool> ValueSerializer::TryWriteExternalStringTransfer(
+    Handle<String> string) {
+  if (delegate_ == nullptr || !string->IsExternalString()) return Just(false);
+  Maybe<uint32_t> transfer_id = delegate_->GetExternalStringTransferId(
+      reinterpret_cast<v8::Isolate*>(isolate_), Utils::ToLocal(string));
+  RETURN_VALUE_IF_SCHEDULED_EXCEPTION(isolate_, Nothing<bool>());
+  uint32_t id = 0;
+  if (!transfer_id.To(&id)) return Just(false);
+  WriteTag(SerializationTag::kExternalStringTransfer);
+  WriteVarint<uint32_t>(id);
+  return Just(true);
+}
+
 Maybe<bool> ValueSerializer::WriteJSReceiver(Handle<JSReceiver> receiver) {
   // If the object has already been serialized, just write its ID.
   uint32_t* id_map_entry = id_map_.Get(receiver);
@@ -574,6 +605,14 @@ Maybe<bool> ValueSerializer::WriteJSReceiver(Handle<JSReceiver> receiver) {
   return Nothing<bool>();
 }
 
+// Whether the own {descriptor} of {map} is part of the map's shape, i.e. is an
+// enumerable string key.
+static bool IsShapeKey(Map map, InternalIndex descriptor) {
+  DescriptorArray descriptors = map.instance_descriptors();
+  return descriptors.GetKey(descriptor).IsString() &&
+         !descriptors.GetDetails(descriptor).IsDontEnum();
+}
+
 Maybe<bool> ValueSerializer::WriteJSObject(Handle<JSObject> object) {
   DCHECK(!object->map().IsCustomElementsReceiverMap());
   const bool can_serialize_fast =
@@ -581,20 +620,45 @@ Maybe<bool> ValueSerializer::WriteJSObject(Handle<JSObject> object) {
   if (!can_serialize_fast) return WriteJSObjectSlow(object);
 
   Handle<Map> map(object->map(), isolate_);
-  WriteTag(SerializationTag::kBeginJSObject);
+  if (map->NumberOfOwnDescriptors() == 0) {
+    WriteTag(SerializationTag::kBeginJSObject);
+    WriteTag(SerializationTag::kEndJSObject);
+    WriteVarint<uint32_t>(0);
+    return ThrowIfOutOfMemory();
+  }
+
+  // Objects with the same map have the same enumerable string keys, so they
+  // are written only for the first object of each map. As with object IDs,
+  // ID+1 is stored in the map.
+  WriteTag(SerializationTag::kBeginShapedJSObject);
+  uint32_t* shape_map_entry = shape_map_.Get(map);
+  if (uint32_t shape_id = *shape_map_entry) {
+    WriteVarint<uint32_t>(shape_id - 1);
+  } else {
+    *shape_map_entry = next_shape_id_ + 1;
+    WriteVarint<uint32_t>(next_shape_id_++);
+    uint32_t num_keys = 0;
+    for (InternalIndex i : map->IterateOwnDescriptors()) {
+      if (IsShapeKey(*map, i)) num_keys++;
+    }
+    WriteVarint<uint32_t>(num_keys);
+    for (InternalIndex i : map->IterateOwnDescriptors()) {
+      if (!IsShapeKey(*map, i)) continue;
+      Handle<Name> key(map->instance_descriptors().GetKey(i), isolate_);
+      if (!WriteObject(key).FromMaybe(false)) return Nothing<bool>();
+    }
+  }
 
   // Write out fast properties as long as they are only data properties and the
   // map doesn't change.
-  uint32_t properties_written = 0;
   bool map_changed = false;
   for (InternalIndex i : map->IterateOwnDescriptors()) {
+    if (!IsShapeKey(*map, i)) continue;
     Handle<Name> key(map->instance_descriptors().GetKey(i), isolate_);
-    if (!key->IsString()) continue;
     PropertyDetails details = map->instance_descriptors().GetDetails(i);
-    if (details.IsDontEnum()) continue;
 
     Handle<Object> value;
-    if (V8_LIKELY(!map_changed)) map_changed = *map == object->map();
+    if (V8_LIKELY(!map_changed)) map_changed = *map != object->map();
     if (V8_LIKELY(!map_changed && details.location() == kField)) {
       DCHECK_EQ(kData, details.kind());
       FieldIndex field_index = FieldIndex::ForDescriptor(*map, i);
@@ -605,19 +669,15 @@ Maybe<bool> ValueSerializer::WriteJSObject(Handle<JSObject> object) {
       // If the property is no longer found, do not serialize it.
       // This could happen if a getter deleted the property.
       LookupIterator it(isolate_, object, key, LookupIterator::OWN);
-      if (!it.IsFound()) continue;
+      if (!it.IsFound()) {
+        WriteTag(SerializationTag::kTheHole);
+        continue;
+      }
       if (!Object::GetProperty(&it).ToHandle(&value)) return Nothing<bool>();
     }
 
-    if (!WriteObject(key).FromMaybe(false) ||
-        !WriteObject(value).FromMaybe(false)) {
-      return Nothing<bool>();
-    }
-    properties_written++;
+    if (!WriteObject(value).FromMaybe(false)) return Nothing<bool>();
   }
-
-  WriteTag(SerializationTag::kEndJSObject);
-  WriteVarint<uint32_t>(properties_written);
   return ThrowIfOutOfMemory();
 }
 
@@ -1078,10 +1138,13 @@ ValueDeserializer::ValueDeserializer(Isolate* isolate,
       position_(data.begin()),
       end_(data.begin() + data.length()),
       id_map_(isolate->global_handles()->Create(
+          ReadOnlyRoots(isolate_).empty_fixed_array())),
+      shapes_(isolate->global_handles()->Create(
           ReadOnlyRoots(isolate_).empty_fixed_array())) {}
 
 ValueDeserializer::~ValueDeserializer() {
   GlobalHandles::Destroy(id_map_.location());
+  GlobalHandles::Destroy(shapes_.location());
 
   Handle<Object> transfer_map_handle;
   if (array_buffer_transfer_map_.ToHandle(&transfer_map_handle)) {
@@ -1285,6 +1348,8 @@ MaybeHandle<Object> ValueDeserializer::ReadObjectInternal() {
       return ReadOneByteString();
     case SerializationTag::kTwoByteString:
       return ReadTwoByteString();
+    case SerializationTag::kExternalStringTransfer:
+      return ReadExternalStringTransfer();
     case SerializationTag::kObjectReference: {
       uint32_t id;
       if (!ReadVarint<uint32_t>().To(&id)) return MaybeHandle<Object>();
@@ -1292,6 +1357,8 @@ MaybeHandle<Object> ValueDeserializer::ReadObjectInternal() {
     }
     case SerializationTag::kBeginJSObject:
       return ReadJSObject();
+    case SerializationTag::kBeginShapedJSObject:
+      return ReadShapedJSObject();
     case SerializationTag::kBeginSparseJSArray:
       return ReadSparseJSArray();
     case SerializationTag::kBeginDenseJSArray:
@@ -1481,6 +1548,76 @@ MaybeHandle<JSObject> ValueDeserializer::ReadJSObject() {
   return scope.CloseAndEscape(object);
 }
 
+MaybeHandle<JSObject> ValueDeserializer::ReadShapedJSObject() {
+  // If we are at the end of the stack, abort. This function may recurse.
+  STACK_CHECK(isolate_, MaybeHandle<JSObject>());
+
+  uint32_t id = next_id_++;
+  HandleScope scope(isolate_);
+  Handle<FixedArray> shape;
+  if (!ReadShape().ToHandle(&shape)) return MaybeHandle<JSObject>();
+  Handle<JSObject> object =
+      isolate_->factory()->NewJSObject(isolate_->object_function());
+  AddObjectWithID(id, object);
+
+  int num_keys = shape->length() - kShapeKeysStartIndex;
+  std::vector<Handle<Object>> values;
+  values.reserve(num_keys);
+  for (int i = 0; i < num_keys; i++) {
+    SerializationTag tag;
+    if (PeekTag().To(&tag) && tag == SerializationTag::kTheHole) {
+      ConsumeTag(SerializationTag::kTheHole);
+      values.push_back(isolate_->factory()->the_hole_value());
+      continue;
+    }
+    Handle<Object> value;
+    if (!ReadObject().ToHandle(&value)) return MaybeHandle<JSObject>();
+    values.push_back(value);
+  }
+  if (!SetShapedProperties(object, shape, values).FromMaybe(false)) {
+    return MaybeHandle<JSObject>();
+  }
+
+  DCHECK(HasObjectWithID(id));
+  return scope.CloseAndEscape(object);
+}
+
+MaybeHandle<FixedArray> ValueDeserializer::ReadShape() {
+  uint32_t shape_id;
+  if (!ReadVarint<uint32_t>().To(&shape_id) || shape_id > next_shape_id_) {
+    return MaybeHandle<FixedArray>();
+  }
+  if (shape_id < next_shape_id_) {
+    return handle(FixedArray::cast(shapes_->get(shape_id)), isolate_);
+  }
+
+  // The shape is defined here. Each key takes at least one byte.
+  uint32_t num_keys;
+  if (!ReadVarint<uint32_t>().To(&num_keys) ||
+      num_keys > static_cast<size_t>(end_ - position_)) {
+    return MaybeHandle<FixedArray>();
+  }
+  Handle<FixedArray> shape =
+      isolate_->factory()->NewFixedArray(kShapeKeysStartIndex + num_keys);
+  for (uint32_t i = 0; i < num_keys; i++) {
+    Handle<Object> key;
+    if (!ReadObject().ToHandle(&key) || !key->IsString()) {
+      return MaybeHandle<FixedArray>();
+    }
+    key = isolate_->factory()->InternalizeString(Handle<String>::cast(key));
+    shape->set(kShapeKeysStartIndex + i, *key);
+  }
+  // Reading the keys cannot define other shapes without failing above.
+  DCHECK_EQ(shape_id, next_shape_id_);
+  Handle<FixedArray> new_array =
+      FixedArray::SetAndGrow(isolate_, shapes_, next_shape_id_++, shape);
+  if (!new_array.is_identical_to(shapes_)) {
+    GlobalHandles::Destroy(shapes_.location());
+    shapes_ = isolate_->global_handles()->Create(*new_array);
+  }
+  return shape;
+}
+
 MaybeHandle<JSArray> ValueDeserializer::ReadSparseJSArray() {
   // If we are at the end of the stack, abort. This function may recurse.
   STACK_CHECK(isolate_, MaybeHandle<JSArray>());
@@ -1921,6 +2058,21 @@ MaybeHandle<JSObject> ValueDeserializer::ReadWasmModuleTransfer() {
   return module;
 }
 
+MaybeHandle<String> ValueDeserializer::ReadExternalStringTransfer() {
+  uint32_t transfer_id = 0;
+  Local<String> string;
+  if (!ReadVarint<uint32_t>().To(&transfer_id) || delegate_ == nullptr ||
+      !delegate_
+           ->GetExternalStringFromId(reinterpret_cast<v8::Isolate*>(isolate_),
+                                     transfer_id)
+           .ToLocal(&string)) {
+    RETURN_EXCEPTION_IF_SCHEDULED_EXCEPTION(isolate_, String);
+    return MaybeHandle<String>();
+  }
+  // Strings are not assigned object IDs, so there is nothing to record.
+  return Utils::OpenHandle(*string);
+}
+
 MaybeHandle<WasmMemoryObject> ValueDeserializer::ReadWasmMemory() {
   uint32_t id = next_id_++;
 
@@ -1984,6 +2136,111 @@ static void CommitProperties(Handle<JSObject> object, Handle<Map> map,
   }
 }
 
+// Returns true if {value} can be stored into the field {descriptor} of
+// {target}, generalizing the field type if necessary.
+static bool PrepareFieldForValue(Isolate* isolate, Handle<Map> target,
+                                 InternalIndex descriptor,
+                                 Handle<Object> value) {
+  PropertyDetails details =
+      target->instance_descriptors().GetDetails(descriptor);
+  Representation expected_representation = details.representation();
+  if (!value->FitsRepresentation(expected_representation)) return false;
+  if (expected_representation.IsHeapObject() &&
+      !target->instance_descriptors().GetFieldType(descriptor).NowContains(
+          value)) {
+    Handle<FieldType> value_type =
+        value->OptimalType(isolate, expected_representation);
+    Map::GeneralizeField(isolate, target, descriptor, details.constness(),
+                         expected_representation, value_type);
+  }
+  DCHECK(target->instance_descriptors()
+             .GetFieldType(descriptor)
+             .NowContains(value));
+  return true;
+}
+
+// Returns true if {values} can be stored into a fresh object with {map}
+// without changing any field representation or type.
+static bool ValuesFitMap(Isolate* isolate, Map map,
+                         const std::vector<Handle<Object>>& values) {
+  DisallowHeapAllocation no_gc;
+  if (map.is_deprecated()) return false;
+  DescriptorArray descriptors = map.instance_descriptors();
+  for (InternalIndex i : map.IterateOwnDescriptors()) {
+    Object value = *values[i.raw_value()];
+    PropertyDetails details = descriptors.GetDetails(i);
+    if (details.location() != kField || value.IsTheHole(isolate) ||
+        !value.FitsRepresentation(details.representation()) ||
+        (details.representation().IsHeapObject() &&
+         !descriptors.GetFieldType(i).NowContains(value))) {
+      return false;
+    }
+  }
+  return true;
+}
+
+Maybe<bool> ValueDeserializer::SetShapedProperties(
+    Handle<JSObject> object, Handle<FixedArray> shape,
+    const std::vector<Handle<Object>>& values) {
+  // Objects following the first one of a shape usually end up with the same
+  // map, which can then be installed right away.
+  Object cached_map = shape->get(kShapeMapIndex);
+  if (cached_map.IsMap() &&
+      ValuesFitMap(isolate_, Map::cast(cached_map), values)) {
+    CommitProperties(object, handle(Map::cast(cached_map), isolate_), values);
+    return Just(true);
+  }
+
+  // Otherwise follow (or create) the transitions for the keys, as
+  // ReadJSObjectProperties does.
+  Handle<Map> map(object->map(), isolate_);
+  DCHECK(!map->is_dictionary_map());
+  DCHECK_EQ(0, map->instance_descriptors().number_of_descriptors());
+  std::vector<Handle<Object>> properties;
+  properties.reserve(values.size());
+  size_t i = 0;
+  for (; i < values.size(); i++) {
+    if (values[i]->IsTheHole(isolate_)) break;
+    Handle<String> key(String::cast(shape->get(kShapeKeysStartIndex + i)),
+                       isolate_);
+    Handle<Map> target;
+    if (!TransitionsAccessor(isolate_, map)
+             .FindTransitionToField(key)
+             .ToHandle(&target) ||
+        !PrepareFieldForValue(isolate_, target,
+                              InternalIndex(properties.size()), values[i])) {
+      break;
+    }
+    properties.push_back(values[i]);
+    map = target;
+  }
+  CommitProperties(object, map, properties);
+
+  bool has_holes = false;
+  for (; i < values.size(); i++) {
+    if (values[i]->IsTheHole(isolate_)) {
+      has_holes = true;
+      continue;
+    }
+    Handle<String> key(String::cast(shape->get(kShapeKeysStartIndex + i)),
+                       isolate_);
+    LookupIterator::Key lookup_key(isolate_, key);
+    LookupIterator it(isolate_, object, lookup_key, LookupIterator::OWN);
+    if (it.state() != LookupIterator::NOT_FOUND ||
+        JSObject::DefineOwnPropertyIgnoreAttributes(&it, values[i], NONE)
+            .is_null()) {
+      return Nothing<bool>();
+    }
+  }
+
+  if (!has_holes && object->HasFastProperties() &&
+      object->map().NumberOfOwnDescriptors() ==
+          static_cast<int>(values.size())) {
+    shape->set(kShapeMapIndex, object->map());
+  }
+  return Just(true);
+}
+
 static bool IsValidObjectKey(Handle<Object> value) {
   return value->IsName() || value->IsNumber();
 }
@@ -2048,23 +2305,7 @@ Maybe<uint32_t> ValueDeserializer::ReadJSObjectProperties(
       // that we can copy them all at once. Otherwise, stop transitioning.
       if (transitioning) {
         InternalIndex descriptor(properties.size());
-        PropertyDetails details =
-            target->instance_descriptors().GetDetails(descriptor);
-        Representation expected_representation = details.representation();
-        if (value->FitsRepresentation(expected_representation)) {
-          if (expected_representation.IsHeapObject() &&
-              !target->instance_descriptors()
-                   .GetFieldType(descriptor)
-                   .NowContains(value)) {
-            Handle<FieldType> value_type =
-                value->OptimalType(isolate_, expected_representation);
-            Map::GeneralizeField(isolate_, target, descriptor,
-                                 details.constness(), expected_representation,
-                                 value_type);
-          }
-          DCHECK(target->instance_descriptors()
-                     .GetFieldType(descriptor)
-                     .NowContains(value));
+        if (PrepareFieldForValue(isolate_, target, descriptor, value)) {
           properties.push_back(value);
           map = target;
           continue;
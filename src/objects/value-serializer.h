@@ -112,6 +112,10 @@ class ValueSerializer {
   void WriteHeapNumber(HeapNumber number);
   void WriteBigInt(BigInt bigint);
   void WriteString(Handle<String> string);
+  // Writes only a transfer ID if the delegate provides one for the external
+  // {string}. Returns false if the contents need to be written instead.
+  Maybe<bool> TryWriteExternalStringTransfer(Handle<String> string)
+      V8_WARN_UNUSED_RESULT;
   Maybe<bool> WriteJSReceiver(Handle<JSReceiver> receiver)
       V8_WARN_UNUSED_RESULT;
   Maybe<bool> WriteJSObject(Handle<JSObject> object) V8_WARN_UNUSED_RESULT;
@@ -169,6 +173,10 @@ class ValueSerializer {
   // A similar map, for transferred array buffers.
   IdentityMap<uint32_t, ZoneAllocationPolicy> array_buffer_transfer_map_;
 
+  // Maps the maps of objects written as shaped objects to their shape ID+1.
+  IdentityMap<uint32_t, ZoneAllocationPolicy> shape_map_;
+  uint32_t next_shape_id_ = 0;
+
   DISALLOW_COPY_AND_ASSIGN(ValueSerializer);
 };
 
@@ -257,6 +265,9 @@ class ValueDeserializer {
   MaybeHandle<String> ReadOneByteString() V8_WARN_UNUSED_RESULT;
   MaybeHandle<String> ReadTwoByteString() V8_WARN_UNUSED_RESULT;
   MaybeHandle<JSObject> ReadJSObject() V8_WARN_UNUSED_RESULT;
+  MaybeHandle<JSObject> ReadShapedJSObject() V8_WARN_UNUSED_RESULT;
+  // Reads a shape ID, and the shape's keys if it is defined here.
+  MaybeHandle<FixedArray> ReadShape() V8_WARN_UNUSED_RESULT;
   MaybeHandle<JSArray> ReadSparseJSArray() V8_WARN_UNUSED_RESULT;
   MaybeHandle<JSArray> ReadDenseJSArray() V8_WARN_UNUSED_RESULT;
   MaybeHandle<JSDate> ReadJSDate() V8_WARN_UNUSED_RESULT;
@@ -273,6 +284,7 @@ class ValueDeserializer {
       Handle<JSArrayBuffer> buffer) V8_WARN_UNUSED_RESULT;
   MaybeHandle<Object> ReadJSError() V8_WARN_UNUSED_RESULT;
   MaybeHandle<JSObject> ReadWasmModuleTransfer() V8_WARN_UNUSED_RESULT;
+  MaybeHandle<String> ReadExternalStringTransfer() V8_WARN_UNUSED_RESULT;
   MaybeHandle<WasmMemoryObject> ReadWasmMemory() V8_WARN_UNUSED_RESULT;
   MaybeHandle<JSObject> ReadHostObject() V8_WARN_UNUSED_RESULT;
 
@@ -284,6 +296,15 @@ class ValueDeserializer {
                                          SerializationTag end_tag,
                                          bool can_use_transitions);
 
+  /*
+   * Defines the keys of {shape} with the corresponding {values} on the fresh
+   * {object}, skipping holes.
+   */
+  Maybe<bool> SetShapedProperties(Handle<JSObject> object,
+                                  Handle<FixedArray> shape,
+                                  const std::vector<Handle<Object>>& values)
+      V8_WARN_UNUSED_RESULT;
+
   // Manipulating the map from IDs to reified objects.
   bool HasObjectWithID(uint32_t id);
   MaybeHandle<JSReceiver> GetObjectWithID(uint32_t id);
@@ -296,8 +317,15 @@ class ValueDeserializer {
   uint32_t version_ = 0;
   uint32_t next_id_ = 0;
 
+  // Shapes are FixedArrays holding the map last used for objects of the
+  // shape (or undefined), followed by the internalized keys.
+  static const int kShapeMapIndex = 0;
+  static const int kShapeKeysStartIndex = 1;
+  uint32_t next_shape_id_ = 0;
+
   // Always global handles.
   Handle<FixedArray> id_map_;
+  Handle<FixedArray> shapes_;
   MaybeHandle<SimpleNumberDictionary> array_buffer_transfer_map_;
 
   DISALLOW_COPY_AND_ASSIGN(ValueDeserializer);
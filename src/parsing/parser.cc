@@ -2369,7 +2369,8 @@ FunctionLiteral* Parser::ParseFunctionLiteral(
   }
 
   FunctionLiteral::EagerCompileHint eager_compile_hint =
-      function_state_->next_function_is_likely_called() || is_wrapped
+      function_state_->next_function_is_likely_called() || is_wrapped ||
+              scanner()->all_functions_called_on_load()
           ? FunctionLiteral::kShouldEagerCompile
           : default_eager_compile_hint();
 
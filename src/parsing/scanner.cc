@@ -11,6 +11,7 @@
 #include <cmath>
 
 #include "src/ast/ast-value-factory.h"
+#include "src/flags/flags.h"
 #include "src/numbers/conversions-inl.h"
 #include "src/objects/bigint.h"
 #include "src/parsing/parse-info.h"
@@ -208,7 +209,7 @@ Token::Value Scanner::SkipSingleLineComment() {
   // separately by the lexical grammar and becomes part of the
   // stream of input elements for the syntactic grammar (see
   // ECMA-262, section 7.4).
-  AdvanceUntil([](uc32 c0_) { return unibrow::IsLineTerminator(c0_); });
+  c0_ = source_->AdvanceUntilLineTerminator();
 
   return Token::WHITESPACE;
 }
@@ -237,6 +238,11 @@ void Scanner::TryToParseSourceURLComment() {
   }
   if (!name.is_one_byte()) return;
   Vector<const uint8_t> name_literal = name.one_byte_literal();
+  if (name_literal == StaticOneByteVector("allFunctionsCalledOnLoad")) {
+    // This magic comment has no value.
+    if (FLAG_compile_hints_magic) all_functions_called_on_load_ = true;
+    return;
+  }
   LiteralBuffer* value;
   if (name_literal == StaticOneByteVector("sourceURL")) {
     value = &source_url_;
@@ -8,6 +8,7 @@
 #define V8_PARSING_SCANNER_H_
 
 #include <algorithm>
+#include <cstring>
 #include <memory>
 
 #include "include/v8.h"
@@ -93,6 +94,30 @@ class Utf16CharacterStream {
     }
   }
 
+  // Same as AdvanceUntil(unibrow::IsLineTerminator), but skips over blocks
+  // of four code units at once while none of them is a line terminator.
+  V8_INLINE uc32 AdvanceUntilLineTerminator() {
+    while (true) {
+      const uint16_t* cursor =
+          SkipNonLineTerminatorWords(buffer_cursor_, buffer_end_);
+      auto next_cursor_pos =
+          std::find_if(cursor, buffer_end_, [](uint16_t raw_c0_) {
+            return unibrow::IsLineTerminator(static_cast<uc32>(raw_c0_));
+          });
+
+      if (next_cursor_pos == buffer_end_) {
+        buffer_cursor_ = buffer_end_;
+        if (!ReadBlockChecked()) {
+          buffer_cursor_++;
+          return kEndOfInput;
+        }
+      } else {
+        buffer_cursor_ = next_cursor_pos + 1;
+        return static_cast<uc32>(*next_cursor_pos);
+      }
+    }
+  }
+
   // Go back one by one character in the input stream.
   // This undoes the most recent Advance().
   inline void Back() {
@@ -150,6 +175,28 @@ class Utf16CharacterStream {
         buffer_pos_(buffer_pos) {}
   Utf16CharacterStream() : Utf16CharacterStream(nullptr, nullptr, nullptr, 0) {}
 
+  // Returns the first position in [start, end) from which a line terminator
+  // may follow, looking at four code units per step. Each 16-bit lane is
+  // tested for being below '\r' + 1 (covers '\n' and '\r') or for being
+  // U+2028 / U+2029, using the usual "has less than" bit trick.
+  static V8_INLINE const uint16_t* SkipNonLineTerminatorWords(
+      const uint16_t* start, const uint16_t* end) {
+    constexpr uint64_t kOnes = 0x0001000100010001;
+    constexpr uint64_t kHighBits = 0x8000800080008000;
+    constexpr uint64_t kParagraphSeparatorMask = 0x2028202820282028;
+    constexpr size_t kStep = sizeof(uint64_t) / sizeof(uint16_t);
+    while (static_cast<size_t>(end - start) >= kStep) {
+      uint64_t word;
+      std::memcpy(&word, start, sizeof(word));
+      uint64_t separators = word ^ kParagraphSeparatorMask;
+      uint64_t candidates = ((word - kOnes * ('\r' + 1)) & ~word) |
+                            ((separators - kOnes * 2) & ~separators);
+      if ((candidates & kHighBits) != 0) break;
+      start += kStep;
+    }
+    return start;
+  }
+
   bool ReadBlockChecked() {
     size_t position = pos();
     USE(position);
@@ -414,6 +461,12 @@ class V8_EXPORT_PRIVATE Scanner {
 
   bool FoundHtmlComment() const { return found_html_comment_; }
 
+  // Whether an //# allFunctionsCalledOnLoad magic comment has been seen. The
+  // embedder uses it to mark scripts whose functions all run during startup.
+  bool all_functions_called_on_load() const {
+    return all_functions_called_on_load_;
+  }
+
   const Utf16CharacterStream* stream() const { return source_; }
 
  private:
@@ -725,6 +778,8 @@ class V8_EXPORT_PRIVATE Scanner {
   // Whether this scanner encountered an HTML comment.
   bool found_html_comment_;
 
+  bool all_functions_called_on_load_ = false;
+
   // Values parsed from magic comments.
   LiteralBuffer source_url_;
   LiteralBuffer source_mapping_url_;
@@ -38,6 +38,9 @@ class HeapProfiler : public HeapObjectAllocationTracker {
   void StopSamplingHeapProfiler();
   bool is_sampling_allocations() { return !!sampling_heap_profiler_; }
   AllocationProfile* GetAllocationProfile();
+  SamplingHeapProfiler* sampling_heap_profiler() const {
+    return sampling_heap_profiler_.get();
+  }
 
   void StartHeapObjectsTracking(bool track_allocations);
   void StopHeapObjectsTracking();
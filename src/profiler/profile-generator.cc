@@ -536,13 +536,24 @@ void CpuProfile::AddPath(base::TimeTicks timestamp,
   ProfileNode* top_frame_node = top_down_.AddPathFromEnd(
       path, src_line, update_stats, options_.mode(), context_filter_.get());
 
+  bool const keep_latest_samples =
+      options_.keep_latest_samples() && options_.max_samples() > 0 &&
+      options_.max_samples() != CpuProfilingOptions::kNoSampleLimit;
   bool should_record_sample =
       !timestamp.IsNull() && timestamp >= start_time_ &&
       (options_.max_samples() == CpuProfilingOptions::kNoSampleLimit ||
-       samples_.size() < options_.max_samples());
-
-  if (should_record_sample)
+       samples_.size() < options_.max_samples() || keep_latest_samples);
+
+  if (should_record_sample) {
+    if (keep_latest_samples && samples_.size() >= options_.max_samples()) {
+      // Drop the oldest sample, making sure it has been streamed first.
+      if (streaming_next_sample_ == 0) StreamPendingTraceEvents();
+      DCHECK_LT(0, streaming_next_sample_);
+      samples_.pop_front();
+      streaming_next_sample_--;
+    }
     samples_.push_back({top_frame_node, timestamp, src_line});
+  }
 
   const int kSamplesFlushCount = 100;
   const int kNodesFlushCount = 10;
@@ -618,14 +629,15 @@ void CpuProfile::StreamPendingTraceEvents() {
     // correct CLOCK_BOOTTIME time values (for instance, producing
     // CLOCK_BOOTTIME time values in the middle of the suspended period).
     value->BeginArray("timeDeltas");
-    base::TimeTicks lastTimestamp =
-        streaming_next_sample_ ? samples_[streaming_next_sample_ - 1].timestamp
-                               : start_time();
+    base::TimeTicks lastTimestamp = streaming_last_timestamp_.IsNull()
+                                        ? start_time()
+                                        : streaming_last_timestamp_;
     for (size_t i = streaming_next_sample_; i < samples_.size(); ++i) {
       value->AppendInteger(static_cast<int>(
           (samples_[i].timestamp - lastTimestamp).InMicroseconds()));
       lastTimestamp = samples_[i].timestamp;
     }
+    streaming_last_timestamp_ = lastTimestamp;
     value->EndArray();
     bool has_non_zero_lines =
         std::any_of(samples_.begin() + streaming_next_sample_, samples_.end(),
@@ -922,9 +934,25 @@ void ProfileGenerator::SymbolizeTickSample(const TickSample& sample) {
           src_line = pc_entry->line_number();
         }
         src_line_not_found = false;
-        stack_trace.push_back({{pc_entry, src_line},
-                               reinterpret_cast<Address>(sample.top_context),
-                               true});
+
+        // Expand functions that were inlined into optimized code, so that the
+        // tick is attributed to the innermost function instead of the function
+        // owning the code. As for the frames below, the inline stack ends with
+        // the owning function itself, and the line number of the innermost
+        // frame is taken from the position table of |pc_entry|.
+        Address top_context = reinterpret_cast<Address>(sample.top_context);
+        const std::vector<CodeEntryAndLineNumber>* inline_stack =
+            pc_entry->GetInlineStack(pc_offset);
+        if (inline_stack) {
+          for (auto entry : *inline_stack) {
+            stack_trace.push_back({entry, top_context, true});
+          }
+          DCHECK(!inline_stack->empty());
+          size_t index = stack_trace.size() - inline_stack->size();
+          stack_trace[index].entry.line_number = src_line;
+        } else {
+          stack_trace.push_back({{pc_entry, src_line}, top_context, true});
+        }
 
         if (pc_entry->builtin_id() == Builtins::kFunctionPrototypeApply ||
             pc_entry->builtin_id() == Builtins::kFunctionPrototypeCall) {
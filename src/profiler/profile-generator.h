@@ -426,6 +426,9 @@ class CpuProfile {
   ProfileTree top_down_;
   CpuProfiler* const profiler_;
   size_t streaming_next_sample_;
+  // Timestamp of the last streamed sample, which may already have been dropped
+  // from {samples_} if the profile keeps only the latest samples.
+  base::TimeTicks streaming_last_timestamp_;
   uint32_t id_;
   // Number of microseconds worth of profiler ticks that should elapse before
   // the next sample is recorded.
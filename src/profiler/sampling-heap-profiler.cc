@@ -6,13 +6,14 @@
 
 #include <stdint.h>
 #include <memory>
+#include <sstream>
 
 #include "src/api/api-inl.h"
 #include "src/base/ieee754.h"
 #include "src/base/utils/random-number-generator.h"
 #include "src/execution/frames-inl.h"
 #include "src/execution/isolate.h"
-#include "src/heap/heap.h"
+#include "src/heap/heap-inl.h"
 #include "src/profiler/strings-storage.h"
 
 namespace v8 {
@@ -77,24 +78,31 @@ void SamplingHeapProfiler::SampleObject(Address soon_object, size_t size) {
   // Check if the area is iterable by confirming that it starts with a map.
   DCHECK((*ObjectSlot(soon_object)).IsMap());
 
-  HandleScope scope(isolate_);
-  HeapObject heap_object = HeapObject::FromAddress(soon_object);
-  Handle<Object> obj(heap_object, isolate_);
-
-  Local<v8::Value> loc = v8::Utils::ToLocal(obj);
-
   AllocationNode* node = AddStack();
   node->allocations_[size]++;
   auto sample =
-      std::make_unique<Sample>(size, node, loc, this, next_sample_id());
-  sample->global.SetWeak(sample.get(), OnWeakCallback,
-                         WeakCallbackType::kParameter);
+      std::make_unique<Sample>(size, node, soon_object, next_sample_id());
   samples_.emplace(sample.get(), std::move(sample));
 }
 
-void SamplingHeapProfiler::OnWeakCallback(
-    const WeakCallbackInfo<Sample>& data) {
-  Sample* sample = data.GetParameter();
+void SamplingHeapProfiler::ProcessSamples(WeakObjectRetainer* retainer,
+                                          bool young_only) {
+  for (auto it = samples_.begin(); it != samples_.end();) {
+    Sample* sample = it->first;
+    ++it;
+    HeapObject object = HeapObject::FromAddress(sample->object);
+    if (young_only && !Heap::InYoungGeneration(object)) continue;
+    Object retained = retainer->RetainAs(object);
+    if (retained.is_null()) {
+      // Erases {sample} but leaves {it} valid.
+      RemoveSample(sample);
+    } else {
+      sample->object = HeapObject::cast(retained).address();
+    }
+  }
+}
+
+void SamplingHeapProfiler::RemoveSample(Sample* sample) {
   AllocationNode* node = sample->owner;
   DCHECK_GT(node->allocations_[sample->size], 0);
   node->allocations_[sample->size]--;
@@ -109,7 +117,7 @@ void SamplingHeapProfiler::OnWeakCallback(
       node = parent;
     }
   }
-  sample->profiler->samples_.erase(sample);
+  samples_.erase(sample);
   // sample is deleted because its unique ptr was erased from samples_.
 }
 
@@ -128,6 +136,24 @@ SamplingHeapProfiler::AllocationNode* SamplingHeapProfiler::FindOrAddChildNode(
   return parent->AddChildNode(id, std::move(new_child));
 }
 
+SamplingHeapProfiler::AllocationNode* SamplingHeapProfiler::FindOrAddChildNode(
+    AllocationNode* parent, SharedFunctionInfo shared) {
+  int script_id = v8::UnboundScript::kNoScriptId;
+  if (shared.script().IsScript()) {
+    script_id = Script::cast(shared.script()).id();
+  }
+  int start_position = shared.StartPosition();
+  if (script_id != v8::UnboundScript::kNoScriptId) {
+    // Functions with a script are identified by their position, so the name
+    // has only to be interned when a new node is created.
+    AllocationNode* child = parent->FindChildNode(
+        AllocationNode::function_id(script_id, start_position, nullptr));
+    if (child) return child;
+  }
+  const char* name = names()->GetName(shared.DebugName());
+  return FindOrAddChildNode(parent, name, script_id, start_position);
+}
+
 SamplingHeapProfiler::AllocationNode* SamplingHeapProfiler::AddStack() {
   AllocationNode* node = &profile_root_;
 
@@ -189,14 +215,7 @@ SamplingHeapProfiler::AllocationNode* SamplingHeapProfiler::AddStack() {
   // We need to process the stack in reverse order as the top of the stack is
   // the first element in the list.
   for (auto it = stack.rbegin(); it != stack.rend(); ++it) {
-    SharedFunctionInfo shared = *it;
-    const char* name = this->names()->GetName(shared.DebugName());
-    int script_id = v8::UnboundScript::kNoScriptId;
-    if (shared.script().IsScript()) {
-      Script script = Script::cast(shared.script());
-      script_id = script.id();
-    }
-    node = FindOrAddChildNode(node, name, script_id, shared.StartPosition());
+    node = FindOrAddChildNode(node, *it);
   }
 
   if (found_arguments_marker_frames) {
@@ -245,6 +264,11 @@ v8::AllocationProfile::Node* SamplingHeapProfiler::TranslateAllocationNode(
       script_name, node->script_id_, node->script_position_, line, column,
       node->id_, std::vector<v8::AllocationProfile::Node*>(), allocations});
   v8::AllocationProfile::Node* current = &profile->nodes_.back();
+  current->growing_gc_count = node->growing_gc_count_;
+  current->retained_size_growth =
+      node->growing_gc_count_ > 0
+          ? node->retained_size_ - node->growth_base_size_
+          : 0;
   // The |children_| map may have nodes inserted into it during translation
   // because the translation may allocate strings on the JS heap that have
   // the potential to be sampled. That's ok since map iterators are not
@@ -292,5 +316,74 @@ SamplingHeapProfiler::BuildSamples() const {
   return samples;
 }
 
+size_t SamplingHeapProfiler::EstimatedSelfSize(
+    const AllocationNode* node) const {
+  size_t size = 0;
+  for (const auto& alloc : node->allocations_) {
+    size += alloc.first * ScaleSample(alloc.first, alloc.second).count;
+  }
+  return size;
+}
+
+void SamplingHeapProfiler::OnMarkCompactDone() {
+  if (!(flags_ & v8::HeapProfiler::kSamplingTrackRetainedGrowth)) return;
+  DisallowHeapAllocation no_gc;
+  UpdateRetainedGrowth(&profile_root_);
+}
+
+void SamplingHeapProfiler::UpdateRetainedGrowth(AllocationNode* node) {
+  size_t previous_size = node->retained_size_;
+  node->retained_size_ = EstimatedSelfSize(node);
+  if (node->retained_size_ > previous_size) {
+    if (node->growing_gc_count_ == 0) node->growth_base_size_ = previous_size;
+    node->growing_gc_count_++;
+    if (FLAG_trace_sampling_heap_growth &&
+        node->growing_gc_count_ >= FLAG_sampling_heap_growth_gcs) {
+      PrintGrowingNode(node);
+    }
+  } else {
+    node->growing_gc_count_ = 0;
+  }
+  for (const auto& it : node->children_) {
+    UpdateRetainedGrowth(it.second.get());
+  }
+}
+
+void SamplingHeapProfiler::PrintGrowingNode(const AllocationNode* node) const {
+  std::ostringstream stack;
+  for (const AllocationNode* frame = node; frame->parent_ != nullptr;
+       frame = frame->parent_) {
+    if (frame != node) stack << " <- ";
+    stack << (frame->name_[0] != '\0' ? frame->name_ : "(anonymous)");
+    if (frame->script_id_ != v8::UnboundScript::kNoScriptId) {
+      stack << " (" << frame->script_id_ << ":" << frame->script_position_
+            << ")";
+    }
+  }
+  isolate_->PrintWithTimestamp(
+      "Sampling heap growth: %zu -> %zu bytes over %d full GCs at %s\n",
+      node->growth_base_size_, node->retained_size_, node->growing_gc_count_,
+      stack.str().c_str());
+}
+
+std::map<InstanceType, SamplingHeapProfiler::InstanceTypeStats>
+SamplingHeapProfiler::GetStatsByInstanceType() const {
+  DisallowHeapAllocation no_gc;
+  std::map<InstanceType, InstanceTypeStats> result;
+  for (const auto& it : samples_) {
+    const Sample* sample = it.second.get();
+    // The type is only known once the object has been initialized, which is
+    // after it was sampled.
+    InstanceType type =
+        HeapObject::FromAddress(sample->object).map().instance_type();
+    InstanceTypeStats& stats = result[type];
+    unsigned int count = ScaleSample(sample->size, 1).count;
+    stats.sample_count++;
+    stats.estimated_count += count;
+    stats.estimated_size += count * sample->size;
+  }
+  return result;
+}
+
 }  // namespace internal
 }  // namespace v8
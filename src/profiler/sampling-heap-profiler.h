@@ -93,30 +93,41 @@ class SamplingHeapProfiler {
     const char* const name_;
     uint32_t id_;
     bool pinned_ = false;
+    // Estimated size of the live self allocations after the last full GC and
+    // the size before the current run of growing full GCs started. Only
+    // maintained with kSamplingTrackRetainedGrowth.
+    size_t retained_size_ = 0;
+    size_t growth_base_size_ = 0;
+    int growing_gc_count_ = 0;
 
     friend class SamplingHeapProfiler;
 
     DISALLOW_COPY_AND_ASSIGN(AllocationNode);
   };
 
+  // A sampled object is tracked by its address, which the GC updates or
+  // clears through ProcessSamples() instead of through a weak global handle.
   struct Sample {
-    Sample(size_t size_, AllocationNode* owner_, Local<Value> local_,
-           SamplingHeapProfiler* profiler_, uint64_t sample_id)
-        : size(size_),
-          owner(owner_),
-          global(reinterpret_cast<v8::Isolate*>(profiler_->isolate_), local_),
-          profiler(profiler_),
-          sample_id(sample_id) {}
+    Sample(size_t size_, AllocationNode* owner_, Address object_,
+           uint64_t sample_id)
+        : size(size_), owner(owner_), object(object_), sample_id(sample_id) {}
     const size_t size;
     AllocationNode* const owner;
-    Global<Value> global;
-    SamplingHeapProfiler* const profiler;
+    Address object;
     const uint64_t sample_id;
 
    private:
     DISALLOW_COPY_AND_ASSIGN(Sample);
   };
 
+  // Estimated number and size of the live sampled allocations of one
+  // InstanceType.
+  struct InstanceTypeStats {
+    size_t sample_count = 0;
+    size_t estimated_count = 0;
+    size_t estimated_size = 0;
+  };
+
   SamplingHeapProfiler(Heap* heap, StringsStorage* names, uint64_t rate,
                        int stack_depth, v8::HeapProfiler::SamplingFlags flags);
   ~SamplingHeapProfiler();
@@ -124,6 +135,22 @@ class SamplingHeapProfiler {
   v8::AllocationProfile* GetAllocationProfile();
   StringsStorage* names() const { return names_; }
 
+  // Called by the GC while processing weak references. Samples of objects
+  // the {retainer} does not retain are dropped, the others are updated to the
+  // objects' new addresses. With {young_only} samples of old objects are
+  // skipped.
+  void ProcessSamples(WeakObjectRetainer* retainer, bool young_only);
+
+  // Attributes the live samples to the instance types of the sampled objects.
+  std::map<InstanceType, InstanceTypeStats> GetStatsByInstanceType() const;
+
+  // Called by the heap at the end of every full GC, when the samples only
+  // refer to live objects. With kSamplingTrackRetainedGrowth the estimated
+  // retained size of each allocation node is compared with the one after the
+  // previous full GC, and with --trace-sampling-heap-growth nodes that grew
+  // for --sampling-heap-growth-gcs consecutive full GCs are printed.
+  void OnMarkCompactDone();
+
  private:
   class Observer : public AllocationObserver {
    public:
@@ -163,7 +190,9 @@ class SamplingHeapProfiler {
 
   AllocationNode* FindOrAddChildNode(AllocationNode* parent, const char* name,
                                      int script_id, int start_position);
-  static void OnWeakCallback(const WeakCallbackInfo<Sample>& data);
+  AllocationNode* FindOrAddChildNode(AllocationNode* parent,
+                                     SharedFunctionInfo shared);
+  void RemoveSample(Sample* sample);
 
   uint32_t next_node_id() { return ++last_node_id_; }
   uint64_t next_sample_id() { return ++last_sample_id_; }
@@ -180,6 +209,9 @@ class SamplingHeapProfiler {
       const std::map<int, Handle<Script>>& scripts);
   v8::AllocationProfile::Allocation ScaleSample(size_t size,
                                                 unsigned int count) const;
+  size_t EstimatedSelfSize(const AllocationNode* node) const;
+  void UpdateRetainedGrowth(AllocationNode* node);
+  void PrintGrowingNode(const AllocationNode* node) const;
   AllocationNode* AddStack();
 
   Isolate* const isolate_;
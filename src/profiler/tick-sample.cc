@@ -330,10 +330,15 @@ bool TickSample::GetStackSample(Isolate* v8_isolate, RegisterState* regs,
 
       // If the bytecode array is a heap object and the bytecode offset is a
       // Smi, use those, otherwise fall back to using the frame's pc.
+      // The address points one byte into the current bytecode rather than at
+      // its start. Frame addresses are treated like return addresses when
+      // looking up source positions, which resolve to the last position
+      // before the address; this way a bytecode is attributed its own source
+      // position instead of the one of the preceding bytecode.
       if (HAS_STRONG_HEAP_OBJECT_TAG(bytecode_array) &&
           HAS_SMI_TAG(bytecode_offset)) {
         frames[i++] = reinterpret_cast<void*>(
-            bytecode_array + i::Internals::SmiValue(bytecode_offset));
+            bytecode_array + i::Internals::SmiValue(bytecode_offset) + 1);
         continue;
       }
     }
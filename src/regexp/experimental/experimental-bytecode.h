@@ -0,0 +1,157 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_REGEXP_EXPERIMENTAL_EXPERIMENTAL_BYTECODE_H_
+#define V8_REGEXP_EXPERIMENTAL_EXPERIMENTAL_BYTECODE_H_
+
+#include <iosfwd>
+
+#include "src/base/logging.h"
+#include "src/regexp/regexp-ast.h"
+#include "src/utils/vector.h"
+
+// ----------------------------------------------------------------------------
+// Definition and semantics of the EXPERIMENTAL bytecode.
+// Background:
+// - Russ Cox's blog post series on regular expression matching, in particular
+//   https://swtch.com/~rsc/regexp/regexp2.html
+// - The re2 regular expression library: https://github.com/google/re2
+//
+// This comment describes the bytecode used by the experimental regexp engine
+// and its abstract semantics in terms of a VM.  An implementation of the
+// semantics that avoids exponential runtime can be found in
+// experimental-interpreter.cc.
+//
+// The experimental bytecode describes a non-deterministic finite automaton.
+// It runs on a multithreaded virtual machine (VM), i.e. in several threads
+// concurrently.  (These "threads" don't need to be actual operating system
+// threads.)  Apart from a list of threads, the VM maintains an immutable
+// shared input string which threads can read from.  Each thread is given by a
+// program counter (PC, index of the current instruction), a fixed number of
+// registers of indices into the input string, and a monotonically increasing
+// index which represents the current position within the input string.
+//
+// For the precise encoding of the instruction set, see the definition of
+// {RegExpInstruction} below.  Currently we support the following instructions:
+// - CONSUME_RANGE: Check whether the current character (a UTF-16 code unit)
+//   is in a given range and, if so, advance the position. Otherwise, the
+//   thread dies.
+// - ASSERTION: Continue only if the given zero-width assertion (e.g. a word
+//   boundary) holds at the current position, otherwise die.
+// - FORK: Spawn a new thread starting at the given PC with a copy of the
+//   current thread's registers. The new thread has lower priority than the
+//   current thread.
+// - JMP: Continue at the given PC.
+// - SET_REGISTER_TO_CP: Store the current position in the given register.
+// - CLEAR_REGISTER: Reset the given register to "undefined" (-1).
+// - ACCEPT: Stop this thread and signal a match with the thread's registers.
+// - FAIL: Stop this thread without a match.
+//
+// The VM runs threads in priority order.  The match that is reported is the
+// one of the highest priority thread that reaches ACCEPT, which coincides
+// with the result of a backtracking engine that explores alternatives in the
+// same order.
+// ----------------------------------------------------------------------------
+
+namespace v8 {
+namespace internal {
+
+struct RegExpInstruction {
+  enum Opcode : int32_t {
+    ACCEPT,
+    ASSERTION,
+    CLEAR_REGISTER,
+    CONSUME_RANGE,
+    FAIL,
+    FORK,
+    JMP,
+    SET_REGISTER_TO_CP,
+  };
+
+  struct Uc16Range {
+    uc16 min;  // Inclusive.
+    uc16 max;  // Inclusive.
+  };
+
+  static RegExpInstruction ConsumeRange(Uc16Range consume_range) {
+    RegExpInstruction result;
+    result.opcode = CONSUME_RANGE;
+    result.payload.consume_range = consume_range;
+    return result;
+  }
+
+  static RegExpInstruction ConsumeAnyChar() {
+    return ConsumeRange(Uc16Range{0x0000, 0xFFFF});
+  }
+
+  static RegExpInstruction Fork(int32_t alt_index) {
+    RegExpInstruction result;
+    result.opcode = FORK;
+    result.payload.pc = alt_index;
+    return result;
+  }
+
+  static RegExpInstruction Jmp(int32_t alt_index) {
+    RegExpInstruction result;
+    result.opcode = JMP;
+    result.payload.pc = alt_index;
+    return result;
+  }
+
+  static RegExpInstruction Accept() {
+    RegExpInstruction result;
+    result.opcode = ACCEPT;
+    return result;
+  }
+
+  static RegExpInstruction Fail() {
+    RegExpInstruction result;
+    result.opcode = FAIL;
+    return result;
+  }
+
+  static RegExpInstruction SetRegisterToCp(int32_t register_index) {
+    RegExpInstruction result;
+    result.opcode = SET_REGISTER_TO_CP;
+    result.payload.register_index = register_index;
+    return result;
+  }
+
+  static RegExpInstruction ClearRegister(int32_t register_index) {
+    RegExpInstruction result;
+    result.opcode = CLEAR_REGISTER;
+    result.payload.register_index = register_index;
+    return result;
+  }
+
+  static RegExpInstruction Assertion(RegExpAssertion::AssertionType t) {
+    RegExpInstruction result;
+    result.opcode = ASSERTION;
+    result.payload.assertion_type = t;
+    return result;
+  }
+
+  Opcode opcode;
+  union {
+    // Payload of CONSUME_RANGE:
+    Uc16Range consume_range;
+    // Payload of FORK and JMP, the next/forked program counter (pc):
+    int32_t pc;
+    // Payload of SET_REGISTER_TO_CP and CLEAR_REGISTER:
+    int32_t register_index;
+    // Payload of ASSERTION:
+    RegExpAssertion::AssertionType assertion_type;
+  } payload;
+  STATIC_ASSERT(sizeof(payload) == 4);
+};
+STATIC_ASSERT(sizeof(RegExpInstruction) == 8);
+
+std::ostream& operator<<(std::ostream& os, const RegExpInstruction& inst);
+std::ostream& operator<<(std::ostream& os,
+                         Vector<const RegExpInstruction> insts);
+
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_REGEXP_EXPERIMENTAL_EXPERIMENTAL_BYTECODE_H_
@@ -0,0 +1,555 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/regexp/experimental/experimental-compiler.h"
+
+#include "src/regexp/regexp-compiler.h"
+#include "src/zone/zone-list-inl.h"
+
+namespace v8 {
+namespace internal {
+
+namespace {
+
+// Quantifiers are compiled by replicating their body, so the size of the
+// generated program grows with the product of the replication factors of
+// nested quantifiers.  We bound this product.
+constexpr int kMaxReplicationFactor = 16;
+
+// Without the unicode flag, the input consists of UTF-16 code units.
+constexpr uc32 kMaxChar = static_cast<uc32>(kMaxUtf16CodeUnit);
+
+class CanBeHandledVisitor final : private RegExpVisitor {
+  // Visitor to implement {ExperimentalRegExpCompiler::CanBeHandled}.
+ public:
+  static bool Check(RegExpTree* tree, JSRegExp::Flags flags) {
+    if (!AreSuitableFlags(flags)) return false;
+    CanBeHandledVisitor visitor;
+    tree->Accept(&visitor, nullptr);
+    return visitor.result_;
+  }
+
+ private:
+  CanBeHandledVisitor() = default;
+
+  static bool AreSuitableFlags(JSRegExp::Flags flags) {
+    // Case-insensitive matching and unicode mode need case folding and
+    // surrogate pair handling, which the bytecode cannot express yet.
+    return !IgnoreCase(flags) && !IsUnicode(flags);
+  }
+
+  void* VisitDisjunction(RegExpDisjunction* node, void*) override {
+    for (RegExpTree* alt : *node->alternatives()) {
+      alt->Accept(this, nullptr);
+      if (!result_) return nullptr;
+    }
+    return nullptr;
+  }
+
+  void* VisitAlternative(RegExpAlternative* node, void*) override {
+    for (RegExpTree* child : *node->nodes()) {
+      child->Accept(this, nullptr);
+      if (!result_) return nullptr;
+    }
+    return nullptr;
+  }
+
+  void* VisitCharacterClass(RegExpCharacterClass* node, void*) override {
+    result_ = result_ && AreSuitableFlags(node->flags());
+    return nullptr;
+  }
+
+  void* VisitAssertion(RegExpAssertion* node, void*) override {
+    result_ = result_ && AreSuitableFlags(node->flags());
+    return nullptr;
+  }
+
+  void* VisitAtom(RegExpAtom* node, void*) override {
+    result_ = result_ && AreSuitableFlags(node->flags());
+    return nullptr;
+  }
+
+  void* VisitText(RegExpText* node, void*) override {
+    for (TextElement& el : *node->elements()) {
+      el.tree()->Accept(this, nullptr);
+      if (!result_) return nullptr;
+    }
+    return nullptr;
+  }
+
+  void* VisitQuantifier(RegExpQuantifier* node, void*) override {
+    // Possessive quantifiers are not part of the language and cannot be
+    // expressed without backtracking control.
+    if (node->is_possessive()) {
+      result_ = false;
+      return nullptr;
+    }
+
+    // The body is replicated once per mandatory iteration and once per
+    // optional iteration (or once altogether for an unbounded loop).
+    int local_replication = node->max() == RegExpTree::kInfinity
+                                ? node->min() + 1
+                                : std::max(1, node->max());
+    if (local_replication > kMaxReplicationFactor ||
+        replication_factor_ > kMaxReplicationFactor / local_replication) {
+      result_ = false;
+      return nullptr;
+    }
+
+    int before_replication_factor = replication_factor_;
+    replication_factor_ *= local_replication;
+    node->body()->Accept(this, nullptr);
+    replication_factor_ = before_replication_factor;
+    return nullptr;
+  }
+
+  void* VisitCapture(RegExpCapture* node, void*) override {
+    node->body()->Accept(this, nullptr);
+    return nullptr;
+  }
+
+  void* VisitGroup(RegExpGroup* node, void*) override {
+    node->body()->Accept(this, nullptr);
+    return nullptr;
+  }
+
+  void* VisitLookaround(RegExpLookaround* node, void*) override {
+    // Lookarounds would need a separate automaton run per assertion.
+    result_ = false;
+    return nullptr;
+  }
+
+  void* VisitBackReference(RegExpBackReference* node, void*) override {
+    // This can't be implemented without backtracking.
+    result_ = false;
+    return nullptr;
+  }
+
+  void* VisitEmpty(RegExpEmpty* node, void*) override { return nullptr; }
+
+  int replication_factor_ = 1;
+  bool result_ = true;
+};
+
+}  // namespace
+
+bool ExperimentalRegExpCompiler::CanBeHandled(RegExpTree* tree,
+                                              JSRegExp::Flags flags) {
+  return CanBeHandledVisitor::Check(tree, flags);
+}
+
+namespace {
+
+// A label in bytecode which starts with no known address. The address *must*
+// be bound with {Bind} before the label goes out of scope. While unbound, the
+// FORK and JMP instructions that refer to the label form a linked list
+// through their {payload.pc}.
+class BytecodeLabel {
+ public:
+  BytecodeLabel() = default;
+  ~BytecodeLabel() { DCHECK(is_bound_); }
+
+ private:
+  friend class BytecodeAssembler;
+
+  bool is_bound_ = false;
+  // If bound, the index of the label. Otherwise the index of the last
+  // instruction referring to it, or -1.
+  int index_ = -1;
+
+  DISALLOW_COPY_AND_ASSIGN(BytecodeLabel);
+};
+
+class BytecodeAssembler {
+ public:
+  explicit BytecodeAssembler(Zone* zone) : zone_(zone), code_(0, zone) {}
+
+  ZoneList<RegExpInstruction> IntoCode() && { return std::move(code_); }
+
+  void Accept() { code_.Add(RegExpInstruction::Accept(), zone_); }
+
+  void Assertion(RegExpAssertion::AssertionType t) {
+    code_.Add(RegExpInstruction::Assertion(t), zone_);
+  }
+
+  void ClearRegister(int32_t register_index) {
+    code_.Add(RegExpInstruction::ClearRegister(register_index), zone_);
+  }
+
+  void ConsumeRange(uc16 from, uc16 to) {
+    code_.Add(RegExpInstruction::ConsumeRange({from, to}), zone_);
+  }
+
+  void ConsumeAnyChar() {
+    code_.Add(RegExpInstruction::ConsumeAnyChar(), zone_);
+  }
+
+  void Fork(BytecodeLabel& target) {
+    LabelledInstrImpl(RegExpInstruction::Opcode::FORK, target);
+  }
+
+  void Jmp(BytecodeLabel& target) {
+    LabelledInstrImpl(RegExpInstruction::Opcode::JMP, target);
+  }
+
+  void SetRegisterToCp(int32_t register_index) {
+    code_.Add(RegExpInstruction::SetRegisterToCp(register_index), zone_);
+  }
+
+  void Bind(BytecodeLabel& target) {
+    DCHECK(!target.is_bound_);
+    int index = code_.length();
+    while (target.index_ != -1) {
+      RegExpInstruction& inst = code_[target.index_];
+      DCHECK(inst.opcode == RegExpInstruction::FORK ||
+             inst.opcode == RegExpInstruction::JMP);
+      target.index_ = inst.payload.pc;
+      inst.payload.pc = index;
+    }
+    target.is_bound_ = true;
+    target.index_ = index;
+  }
+
+  void Fail() { code_.Add(RegExpInstruction::Fail(), zone_); }
+
+ private:
+  void LabelledInstrImpl(RegExpInstruction::Opcode op, BytecodeLabel& target) {
+    RegExpInstruction result;
+    result.opcode = op;
+    // For an unbound label, link the new instruction into its patch list.
+    result.payload.pc = target.index_;
+    if (!target.is_bound_) target.index_ = code_.length();
+    code_.Add(result, zone_);
+  }
+
+  Zone* zone_;
+  ZoneList<RegExpInstruction> code_;
+};
+
+class CompileVisitor final : private RegExpVisitor {
+ public:
+  static ZoneList<RegExpInstruction> Compile(RegExpTree* tree,
+                                             JSRegExp::Flags flags,
+                                             Zone* zone) {
+    CompileVisitor compiler(zone);
+
+    if (!IsSticky(flags) && !tree->IsAnchoredAtStart()) {
+      // The match is not anchored, i.e. may start at any input position, so
+      // we emit a preamble corresponding to /.*?/.  This skips an arbitrary
+      // prefix in the input non-greedily.
+      compiler.CompileNonGreedyStar(
+          [&]() { compiler.assembler_.ConsumeAnyChar(); });
+    }
+
+    compiler.assembler_.SetRegisterToCp(0);
+    tree->Accept(&compiler, nullptr);
+    compiler.assembler_.SetRegisterToCp(1);
+    compiler.assembler_.Accept();
+
+    return std::move(compiler.assembler_).IntoCode();
+  }
+
+ private:
+  explicit CompileVisitor(Zone* zone) : zone_(zone), assembler_(zone) {}
+
+  // Generate a disjunction of code fragments compiled by a function {gen_alt}.
+  // {gen_alt} is called repeatedly with argument {i = 0, 1, ..., alt_num - 1}
+  // and should build code corresponding to the ith alternative.
+  template <class F>
+  void CompileDisjunction(int alt_num, F&& gen_alt) {
+    // An alternative a1 | ... | an is compiled into
+    //
+    //     FORK tail1
+    //     <a1>
+    //     JMP end
+    //   tail1:
+    //     FORK tail2
+    //     <a2>
+    //     JMP end
+    //   tail2:
+    //     ...
+    //     ...
+    //   tail{n - 1}:
+    //     <an>
+    //   end:
+    //
+    // By the semantics of the FORK instruction (see experimental-bytecode.h),
+    // a forked thread has lower priority than the thread that
+    // spawned it.  This means that with the code we're generating here, the
+    // thread matching the alternative a1 has indeed highest priority, followed
+    // by the thread for a2 and so on.
+
+    if (alt_num == 0) {
+      // The empty disjunction (e.g. the character class [^\s\S]).  This can
+      // never match.
+      assembler_.Fail();
+      return;
+    }
+
+    BytecodeLabel end;
+
+    for (int i = 0; i != alt_num - 1; ++i) {
+      BytecodeLabel tail;
+      assembler_.Fork(tail);
+      gen_alt(i);
+      assembler_.Jmp(end);
+      assembler_.Bind(tail);
+    }
+
+    gen_alt(alt_num - 1);
+
+    assembler_.Bind(end);
+  }
+
+  void* VisitDisjunction(RegExpDisjunction* node, void*) override {
+    ZoneList<RegExpTree*>& alts = *node->alternatives();
+    CompileDisjunction(alts.length(),
+                       [&](int i) { alts[i]->Accept(this, nullptr); });
+    return nullptr;
+  }
+
+  void* VisitAlternative(RegExpAlternative* node, void*) override {
+    for (RegExpTree* child : *node->nodes()) {
+      child->Accept(this, nullptr);
+    }
+    return nullptr;
+  }
+
+  void* VisitAssertion(RegExpAssertion* node, void*) override {
+    assembler_.Assertion(node->assertion_type());
+    return nullptr;
+  }
+
+  void* VisitCharacterClass(RegExpCharacterClass* node, void*) override {
+    // A character class is compiled as disjunction over its CharacterRanges.
+    ZoneList<CharacterRange>* ranges = node->ranges(zone_);
+    CharacterRange::Canonicalize(ranges);
+    if (node->is_negated()) {
+      // The complement of a disjoint, non-adjacent (i.e. canonicalized)
+      // union of k intervals is a union of at most k + 1 intervals.
+      ZoneList<CharacterRange>* negated =
+          zone_->New<ZoneList<CharacterRange>>(ranges->length() + 1, zone_);
+      CharacterRange::Negate(ranges, negated, zone_);
+      DCHECK_LE(negated->length(), ranges->length() + 1);
+      ranges = negated;
+    }
+
+    // Ranges beyond {kMaxChar} can never match and are cut off.  Ranges are
+    // sorted, so we can stop at the first range that starts above it.
+    int range_count = 0;
+    while (range_count != ranges->length() &&
+           ranges->at(range_count).from() <= kMaxChar) {
+      ++range_count;
+    }
+
+    CompileDisjunction(range_count, [&](int i) {
+      CharacterRange& range = ranges->at(i);
+      uc16 from = static_cast<uc16>(range.from());
+      uc16 to = static_cast<uc16>(std::min(range.to(), kMaxChar));
+      assembler_.ConsumeRange(from, to);
+    });
+    return nullptr;
+  }
+
+  void* VisitAtom(RegExpAtom* node, void*) override {
+    for (uc16 c : node->data()) {
+      assembler_.ConsumeRange(c, c);
+    }
+    return nullptr;
+  }
+
+  void ClearRegisters(Interval indices) {
+    if (indices.is_empty()) return;
+    DCHECK_EQ(indices.from() % 2, 0);
+    DCHECK_EQ(indices.to() % 2, 1);
+    for (int i = indices.from(); i <= indices.to(); ++i) {
+      assembler_.ClearRegister(i);
+    }
+  }
+
+  // Emit bytecode corresponding to /<emit_body>*/.
+  template <class F>
+  void CompileGreedyStar(F&& emit_body) {
+    // This is compiled into
+    //
+    //   begin:
+    //     FORK end
+    //     <body>
+    //     JMP begin
+    //   end:
+    //     ...
+    //
+    // This is greedy because a forked thread has lower priority than the
+    // thread that spawned it.
+    BytecodeLabel begin;
+    BytecodeLabel end;
+
+    assembler_.Bind(begin);
+    assembler_.Fork(end);
+    emit_body();
+    assembler_.Jmp(begin);
+
+    assembler_.Bind(end);
+  }
+
+  // Emit bytecode corresponding to /<emit_body>*?/.
+  template <class F>
+  void CompileNonGreedyStar(F&& emit_body) {
+    // This is compiled into
+    //
+    //     FORK body
+    //     JMP end
+    //   body:
+    //     <body>
+    //     FORK body
+    //     JMP end
+    //   end:
+    //     ...
+
+    BytecodeLabel body;
+    BytecodeLabel end;
+
+    assembler_.Fork(body);
+    assembler_.Jmp(end);
+
+    assembler_.Bind(body);
+    emit_body();
+    assembler_.Fork(body);
+    assembler_.Jmp(end);
+
+    assembler_.Bind(end);
+  }
+
+  // Emit bytecode corresponding to /<emit_body>{0, max_repetition_num}/.
+  template <class F>
+  void CompileGreedyRepetition(F&& emit_body, int max_repetition_num) {
+    // This is compiled into
+    //
+    //     FORK end
+    //     <body>
+    //     FORK end
+    //     <body>
+    //     ...
+    //     ...
+    //     FORK end
+    //     <body>
+    //   end:
+    //     ...
+
+    BytecodeLabel end;
+    for (int i = 0; i != max_repetition_num; ++i) {
+      assembler_.Fork(end);
+      emit_body();
+    }
+    assembler_.Bind(end);
+  }
+
+  // Emit bytecode corresponding to /<emit_body>{0, max_repetition_num}?/.
+  template <class F>
+  void CompileNonGreedyRepetition(F&& emit_body, int max_repetition_num) {
+    // This is compiled into
+    //
+    //     FORK body0
+    //     JMP end
+    //   body0:
+    //     <body>
+    //     FORK body1
+    //     JMP end
+    //   body1:
+    //     <body>
+    //     ...
+    //     ...
+    //   body{max_repetition_num - 1}:
+    //     <body>
+    //   end:
+    //     ...
+
+    BytecodeLabel end;
+    for (int i = 0; i != max_repetition_num; ++i) {
+      BytecodeLabel body;
+      assembler_.Fork(body);
+      assembler_.Jmp(end);
+
+      assembler_.Bind(body);
+      emit_body();
+    }
+    assembler_.Bind(end);
+  }
+
+  void* VisitQuantifier(RegExpQuantifier* node, void*) override {
+    // Emit the body, but clear the capture registers occurring in the body
+    // first, since each iteration starts with fresh captures.
+    Interval body_registers = node->body()->CaptureRegisters();
+    auto emit_body = [&]() {
+      ClearRegisters(body_registers);
+      node->body()->Accept(this, nullptr);
+    };
+
+    // First repeat the body {min()} times.
+    for (int i = 0; i != node->min(); ++i) emit_body();
+
+    DCHECK(!node->is_possessive());
+    if (node->is_greedy()) {
+      if (node->max() == RegExpTree::kInfinity) {
+        CompileGreedyStar(emit_body);
+      } else {
+        CompileGreedyRepetition(emit_body, node->max() - node->min());
+      }
+    } else {
+      DCHECK(node->is_non_greedy());
+      if (node->max() == RegExpTree::kInfinity) {
+        CompileNonGreedyStar(emit_body);
+      } else {
+        CompileNonGreedyRepetition(emit_body, node->max() - node->min());
+      }
+    }
+    return nullptr;
+  }
+
+  void* VisitCapture(RegExpCapture* node, void*) override {
+    int index = node->index();
+    int start_register = RegExpCapture::StartRegister(index);
+    int end_register = RegExpCapture::EndRegister(index);
+    assembler_.SetRegisterToCp(start_register);
+    node->body()->Accept(this, nullptr);
+    assembler_.SetRegisterToCp(end_register);
+    return nullptr;
+  }
+
+  void* VisitGroup(RegExpGroup* node, void*) override {
+    node->body()->Accept(this, nullptr);
+    return nullptr;
+  }
+
+  void* VisitLookaround(RegExpLookaround* node, void*) override {
+    UNREACHABLE();
+  }
+
+  void* VisitBackReference(RegExpBackReference* node, void*) override {
+    UNREACHABLE();
+  }
+
+  void* VisitEmpty(RegExpEmpty* node, void*) override { return nullptr; }
+
+  void* VisitText(RegExpText* node, void*) override {
+    for (TextElement& text_el : *node->elements()) {
+      text_el.tree()->Accept(this, nullptr);
+    }
+    return nullptr;
+  }
+
+ private:
+  Zone* zone_;
+  BytecodeAssembler assembler_;
+};
+
+}  // namespace
+
+ZoneList<RegExpInstruction> ExperimentalRegExpCompiler::Compile(
+    RegExpTree* tree, JSRegExp::Flags flags, Zone* zone) {
+  return CompileVisitor::Compile(tree, flags, zone);
+}
+
+}  // namespace internal
+}  // namespace v8
@@ -0,0 +1,327 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/regexp/experimental/experimental-interpreter.h"
+
+#include "src/base/optional.h"
+#include "src/objects/fixed-array-inl.h"
+#include "src/objects/objects-inl.h"
+#include "src/objects/string-inl.h"
+#include "src/strings/char-predicates-inl.h"
+#include "src/zone/zone-list-inl.h"
+#include "src/zone/zone.h"
+
+namespace v8 {
+namespace internal {
+
+namespace {
+
+constexpr int kUndefinedRegisterValue = -1;
+
+template <class Character>
+bool SatisfiesAssertion(RegExpAssertion::AssertionType type,
+                        Vector<const Character> context, int position) {
+  DCHECK_LE(position, context.length());
+  DCHECK_GE(position, 0);
+
+  switch (type) {
+    case RegExpAssertion::START_OF_INPUT:
+      return position == 0;
+    case RegExpAssertion::END_OF_INPUT:
+      return position == context.length();
+    case RegExpAssertion::START_OF_LINE:
+      if (position == 0) return true;
+      return IsRegExpNewline(context[position - 1]);
+    case RegExpAssertion::END_OF_LINE:
+      if (position == context.length()) return true;
+      return IsRegExpNewline(context[position]);
+    case RegExpAssertion::BOUNDARY:
+    case RegExpAssertion::NON_BOUNDARY: {
+      bool word_before = position != 0 && IsRegExpWord(context[position - 1]);
+      bool word_after =
+          position != context.length() && IsRegExpWord(context[position]);
+      bool is_boundary = word_before != word_after;
+      return type == RegExpAssertion::BOUNDARY ? is_boundary : !is_boundary;
+    }
+  }
+  UNREACHABLE();
+}
+
+// A thread of the NFA simulation: The index of the instruction it executes
+// next, plus its own set of registers.
+struct InterpreterThread {
+  int pc;
+  int* register_array_begin;
+};
+
+template <class Character>
+class NfaInterpreter {
+  // Executes a bytecode program in breadth-first mode, without backtracking.
+  // {Character} can be instantiated with {uint8_t} or {uc16} for one byte or
+  // two byte input strings.
+  //
+  // In contrast to the backtracking implementation, this has linear time
+  // complexity in the input length (for a fixed bytecode program).  Each
+  // instruction is executed at most once per input position, so there are at
+  // most {bytecode.length()} threads alive at any time.
+  //
+  // The threads are kept in priority order: Every step, the highest priority
+  // thread runs until it consumes a character or dies, then the next one
+  // executes, and so on.  When a thread reaches ACCEPT, all lower priority
+  // threads are discarded; the match of the highest priority thread that
+  // accepts is reported, which is the match a backtracking engine would find.
+ public:
+  NfaInterpreter(Vector<const RegExpInstruction> bytecode,
+                 int register_count_per_match, Vector<const Character> input,
+                 int input_index, Zone* zone)
+      : bytecode_(bytecode),
+        register_count_per_match_(register_count_per_match),
+        input_(input),
+        input_index_(input_index),
+        pc_last_input_index_(zone->NewArray<int>(bytecode.length()),
+                             bytecode.length()),
+        active_threads_(0, zone),
+        blocked_threads_(0, zone),
+        free_register_arrays_(0, zone),
+        zone_(zone) {
+    DCHECK(!bytecode_.empty());
+    DCHECK_GE(input_index_, 0);
+    DCHECK_LE(input_index_, input_.length());
+  }
+
+  // Finds up to {output_register_count / register_count_per_match_} matches
+  // and writes their registers to {output_registers}.  Returns the number of
+  // matches found.
+  int FindMatches(int32_t* output_registers, int output_register_count) {
+    const int max_match_num = output_register_count / register_count_per_match_;
+
+    int match_num = 0;
+    while (match_num != max_match_num) {
+      int32_t* output =
+          output_registers + match_num * register_count_per_match_;
+      if (!FindNextMatch(output)) break;
+      ++match_num;
+
+      int match_begin = output[0];
+      int match_end = output[1];
+      if (match_begin == match_end) {
+        // Zero-length match.  Advance by one code unit, or stop at the end.
+        if (match_end == input_.length()) break;
+        input_index_ = match_end + 1;
+      } else {
+        input_index_ = match_end;
+      }
+    }
+    return match_num;
+  }
+
+ private:
+  // Finds the next match starting at {input_index_}, if any.  On success,
+  // writes its registers to {output} and returns true.
+  bool FindNextMatch(int32_t* output) {
+    // Forget about the threads and visited instructions of the previous
+    // search; it may have advanced past the new start position.
+    for (int& pc_last_input_index : pc_last_input_index_) {
+      pc_last_input_index = -1;
+    }
+    DCHECK(active_threads_.is_empty());
+    DCHECK(blocked_threads_.is_empty());
+    DCHECK_NULL(best_match_registers_);
+
+    int* register_array = NewRegisterArray();
+    for (int i = 0; i != register_count_per_match_; ++i) {
+      register_array[i] = kUndefinedRegisterValue;
+    }
+    active_threads_.Add(InterpreterThread{0, register_array}, zone_);
+
+    while (true) {
+      // Run the active threads at the current input position until they all
+      // block on a CONSUME_RANGE instruction or die.
+      RunActiveThreads();
+
+      // If no thread can continue, or if we're at the end of the input, we're
+      // done.
+      if (blocked_threads_.is_empty() || input_index_ == input_.length()) {
+        break;
+      }
+
+      // Advance the blocked threads that accept the current character, in
+      // priority order.  {active_threads_} is used as a stack, so we push the
+      // highest priority thread last.
+      Character c = input_[input_index_];
+      for (int i = blocked_threads_.length() - 1; i >= 0; --i) {
+        InterpreterThread t = blocked_threads_[i];
+        RegExpInstruction::Uc16Range range =
+            bytecode_[t.pc].payload.consume_range;
+        if (range.min <= c && c <= range.max) {
+          ++t.pc;
+          active_threads_.Add(t, zone_);
+        } else {
+          DestroyThread(t);
+        }
+      }
+      blocked_threads_.Rewind(0);
+      ++input_index_;
+    }
+
+    for (InterpreterThread t : blocked_threads_) DestroyThread(t);
+    blocked_threads_.Rewind(0);
+
+    if (best_match_registers_ == nullptr) return false;
+
+    for (int i = 0; i != register_count_per_match_; ++i) {
+      output[i] = best_match_registers_[i];
+    }
+    FreeRegisterArray(best_match_registers_);
+    best_match_registers_ = nullptr;
+    return true;
+  }
+
+  void RunActiveThreads() {
+    while (!active_threads_.is_empty()) {
+      InterpreterThread t = active_threads_.RemoveLast();
+      if (RunActiveThread(t)) {
+        // The thread accepted.  All remaining active threads have lower
+        // priority and can't produce a better match.
+        for (InterpreterThread lower : active_threads_) DestroyThread(lower);
+        active_threads_.Rewind(0);
+        return;
+      }
+    }
+  }
+
+  // Runs {t} until it blocks on a CONSUME_RANGE instruction, dies, or
+  // accepts.  Returns true iff it accepted.
+  bool RunActiveThread(InterpreterThread t) {
+    while (true) {
+      // If another thread of higher priority has already executed this
+      // instruction at the current input position, {t} can't do better.
+      if (pc_last_input_index_[t.pc] == input_index_) {
+        DestroyThread(t);
+        return false;
+      }
+      pc_last_input_index_[t.pc] = input_index_;
+
+      const RegExpInstruction& inst = bytecode_[t.pc];
+      switch (inst.opcode) {
+        case RegExpInstruction::CONSUME_RANGE:
+          blocked_threads_.Add(t, zone_);
+          return false;
+        case RegExpInstruction::ASSERTION:
+          if (!SatisfiesAssertion(inst.payload.assertion_type, input_,
+                                  input_index_)) {
+            DestroyThread(t);
+            return false;
+          }
+          ++t.pc;
+          break;
+        case RegExpInstruction::FORK: {
+          InterpreterThread fork{inst.payload.pc,
+                                 NewRegisterArrayCopy(t.register_array_begin)};
+          active_threads_.Add(fork, zone_);
+          ++t.pc;
+          break;
+        }
+        case RegExpInstruction::JMP:
+          t.pc = inst.payload.pc;
+          break;
+        case RegExpInstruction::SET_REGISTER_TO_CP:
+          t.register_array_begin[inst.payload.register_index] = input_index_;
+          ++t.pc;
+          break;
+        case RegExpInstruction::CLEAR_REGISTER:
+          t.register_array_begin[inst.payload.register_index] =
+              kUndefinedRegisterValue;
+          ++t.pc;
+          break;
+        case RegExpInstruction::FAIL:
+          DestroyThread(t);
+          return false;
+        case RegExpInstruction::ACCEPT:
+          // Any previous match was found by a thread of lower priority.
+          if (best_match_registers_ != nullptr) {
+            FreeRegisterArray(best_match_registers_);
+          }
+          best_match_registers_ = t.register_array_begin;
+          return true;
+      }
+    }
+  }
+
+  int* NewRegisterArray() {
+    if (!free_register_arrays_.is_empty()) {
+      return free_register_arrays_.RemoveLast();
+    }
+    return zone_->NewArray<int>(register_count_per_match_);
+  }
+
+  int* NewRegisterArrayCopy(int* registers) {
+    int* result = NewRegisterArray();
+    for (int i = 0; i != register_count_per_match_; ++i) {
+      result[i] = registers[i];
+    }
+    return result;
+  }
+
+  // Register arrays are recycled, so that the memory use is bounded by the
+  // number of threads that are alive at the same time.
+  void FreeRegisterArray(int* register_array) {
+    free_register_arrays_.Add(register_array, zone_);
+  }
+
+  void DestroyThread(InterpreterThread t) {
+    FreeRegisterArray(t.register_array_begin);
+  }
+
+  const Vector<const RegExpInstruction> bytecode_;
+  const int register_count_per_match_;
+  const Vector<const Character> input_;
+  int input_index_;
+
+  // For each instruction, the last input position at which a thread executed
+  // it, or -1.
+  Vector<int> pc_last_input_index_;
+
+  // Threads that still need to run at the current input position, used as a
+  // stack: the highest priority thread is at the end.
+  ZoneList<InterpreterThread> active_threads_;
+  // Threads blocked on a CONSUME_RANGE instruction at the current input
+  // position, in priority order: the highest priority thread comes first.
+  ZoneList<InterpreterThread> blocked_threads_;
+
+  ZoneList<int*> free_register_arrays_;
+
+  // The registers of the best match found so far, or nullptr.
+  int* best_match_registers_ = nullptr;
+
+  Zone* zone_;
+};
+
+}  // namespace
+
+int ExperimentalRegExpInterpreter::FindMatches(
+    Vector<const RegExpInstruction> bytecode, int register_count_per_match,
+    String input, int start_index, int32_t* output_registers,
+    int output_register_count, Zone* zone) {
+  DisallowHeapAllocation no_gc;
+
+  DCHECK(input.IsFlat());
+  String::FlatContent input_content = input.GetFlatContent(no_gc);
+
+  if (input_content.IsOneByte()) {
+    NfaInterpreter<uint8_t> interpreter(
+        bytecode, register_count_per_match, input_content.ToOneByteVector(),
+        start_index, zone);
+    return interpreter.FindMatches(output_registers, output_register_count);
+  } else {
+    DCHECK(input_content.IsTwoByte());
+    NfaInterpreter<uc16> interpreter(bytecode, register_count_per_match,
+                                     input_content.ToUC16Vector(), start_index,
+                                     zone);
+    return interpreter.FindMatches(output_registers, output_register_count);
+  }
+}
+
+}  // namespace internal
+}  // namespace v8
@@ -0,0 +1,36 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_REGEXP_EXPERIMENTAL_EXPERIMENTAL_INTERPRETER_H_
+#define V8_REGEXP_EXPERIMENTAL_EXPERIMENTAL_INTERPRETER_H_
+
+#include "src/base/macros.h"
+#include "src/regexp/experimental/experimental-bytecode.h"
+#include "src/utils/vector.h"
+
+namespace v8 {
+namespace internal {
+
+class String;
+class Zone;
+
+class ExperimentalRegExpInterpreter final : public AllStatic {
+ public:
+  // Executes a bytecode program in breadth-first NFA mode, without
+  // backtracking, to find matching substrings.  Tries to find up to
+  // {output_register_count / register_count_per_match} matches in {input},
+  // starting at {start_index}.  Returns the actual number of matches found.
+  // The registers of the matches are written to {output_registers}, one block
+  // of {register_count_per_match} registers per match.  The running time is
+  // O(input length * bytecode length) per match.
+  static int FindMatches(Vector<const RegExpInstruction> bytecode,
+                         int register_count_per_match, String input,
+                         int start_index, int32_t* output_registers,
+                         int output_register_count, Zone* zone);
+};
+
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_REGEXP_EXPERIMENTAL_EXPERIMENTAL_INTERPRETER_H_
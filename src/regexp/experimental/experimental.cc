@@ -0,0 +1,200 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/regexp/experimental/experimental.h"
+
+#include "src/logging/counters.h"
+#include "src/objects/js-regexp-inl.h"
+#include "src/regexp/experimental/experimental-compiler.h"
+#include "src/regexp/experimental/experimental-interpreter.h"
+#include "src/regexp/regexp-parser.h"
+#include "src/utils/ostreams.h"
+
+namespace v8 {
+namespace internal {
+
+bool ExperimentalRegExp::CanBeHandled(RegExpTree* tree,
+                                      JSRegExp::Flags flags) {
+  return ExperimentalRegExpCompiler::CanBeHandled(tree, flags);
+}
+
+void ExperimentalRegExp::Initialize(Isolate* isolate, Handle<JSRegExp> re,
+                                    Handle<String> pattern,
+                                    JSRegExp::Flags flags,
+                                    RegExpCompileData* parse_result,
+                                    Zone* zone, uint32_t backtrack_limit) {
+  DCHECK(FLAG_enable_experimental_regexp_engine);
+  DCHECK(CanBeHandled(parse_result->tree, flags));
+
+  ZoneList<RegExpInstruction> bytecode =
+      ExperimentalRegExpCompiler::Compile(parse_result->tree, flags, zone);
+
+  if (FLAG_trace_experimental_regexp_engine) {
+    StdoutStream{} << "Compiled experimental bytecode for /"
+                   << pattern->ToCString().get() << "/:" << std::endl
+                   << bytecode.ToConstVector() << std::endl;
+  }
+
+  // The bytecode does not depend on the subject encoding, so both slots share
+  // the same array.
+  int byte_length = sizeof(RegExpInstruction) * bytecode.length();
+  Handle<ByteArray> bytecode_array =
+      isolate->factory()->NewByteArray(byte_length, AllocationType::kOld);
+  bytecode_array->copy_in(0, reinterpret_cast<byte*>(bytecode.begin()),
+                          byte_length);
+
+  isolate->factory()->SetRegExpIrregexpData(re, JSRegExp::EXPERIMENTAL,
+                                            pattern, flags,
+                                            parse_result->capture_count,
+                                            backtrack_limit);
+  re->SetDataAt(JSRegExp::kIrregexpLatin1BytecodeIndex, *bytecode_array);
+  re->SetDataAt(JSRegExp::kIrregexpUC16BytecodeIndex, *bytecode_array);
+  re->SetDataAt(
+      JSRegExp::kIrregexpMaxRegisterCountIndex,
+      Smi::FromInt(
+          JSRegExp::RegistersForCaptureCount(parse_result->capture_count)));
+  if (parse_result->capture_name_map.is_null()) {
+    re->SetDataAt(JSRegExp::kIrregexpCaptureNameMapIndex, Smi::zero());
+  } else {
+    re->SetDataAt(JSRegExp::kIrregexpCaptureNameMapIndex,
+                  *parse_result->capture_name_map);
+  }
+}
+
+namespace {
+
+int ExecRawImpl(Isolate* isolate, Vector<const RegExpInstruction> bytecode,
+                int register_count_per_match, String subject,
+                int32_t* output_registers, int32_t output_register_count,
+                int32_t subject_index) {
+  DisallowHeapAllocation no_gc;
+  Zone zone(isolate->allocator(), ZONE_NAME);
+  return ExperimentalRegExpInterpreter::FindMatches(
+      bytecode, register_count_per_match, subject, subject_index,
+      output_registers, output_register_count, &zone);
+}
+
+// Allocates the output registers for a single match and runs {exec_raw} on
+// them, like IrregexpExec.
+template <typename ExecRawFunction>
+MaybeHandle<Object> ExecWithOutputRegisters(
+    Isolate* isolate, Handle<JSRegExp> regexp, Handle<String> subject,
+    Handle<RegExpMatchInfo> last_match_info, ExecRawFunction exec_raw) {
+  int capture_count = regexp->CaptureCount();
+  int output_register_count = JSRegExp::RegistersForCaptureCount(capture_count);
+
+  int32_t* output_registers;
+  std::unique_ptr<int32_t[]> output_registers_release;
+  if (output_register_count <= Isolate::kJSRegexpStaticOffsetsVectorSize) {
+    output_registers = isolate->jsregexp_static_offsets_vector();
+  } else {
+    output_registers = NewArray<int32_t>(output_register_count);
+    output_registers_release.reset(output_registers);
+  }
+
+  int num_matches = exec_raw(output_registers, output_register_count);
+
+  if (num_matches == RegExp::RE_EXCEPTION) {
+    DCHECK(isolate->has_pending_exception());
+    return MaybeHandle<Object>();
+  }
+  if (num_matches == 0) return isolate->factory()->null_value();
+
+  DCHECK_EQ(num_matches, 1);
+  return RegExp::SetLastMatchInfo(isolate, last_match_info, subject,
+                                  capture_count, output_registers);
+}
+
+}  // namespace
+
+int ExperimentalRegExp::ExecRaw(Isolate* isolate, JSRegExp regexp,
+                                String subject, int32_t* output_registers,
+                                int32_t output_register_count,
+                                int32_t subject_index) {
+  DisallowHeapAllocation no_gc;
+  DCHECK_EQ(regexp.TypeTag(), JSRegExp::EXPERIMENTAL);
+
+  ByteArray bytecode =
+      ByteArray::cast(regexp.DataAt(JSRegExp::kIrregexpLatin1BytecodeIndex));
+  STATIC_ASSERT(alignof(RegExpInstruction) <= kTaggedSize);
+  Vector<const RegExpInstruction> instructions(
+      reinterpret_cast<const RegExpInstruction*>(
+          bytecode.GetDataStartAddress()),
+      bytecode.length() / sizeof(RegExpInstruction));
+
+  int register_count_per_match =
+      JSRegExp::RegistersForCaptureCount(regexp.CaptureCount());
+
+  return ExecRawImpl(isolate, instructions, register_count_per_match, subject,
+                     output_registers, output_register_count, subject_index);
+}
+
+MaybeHandle<Object> ExperimentalRegExp::Exec(
+    Isolate* isolate, Handle<JSRegExp> regexp, Handle<String> subject,
+    int index, Handle<RegExpMatchInfo> last_match_info) {
+  DCHECK_EQ(regexp->TypeTag(), JSRegExp::EXPERIMENTAL);
+
+  subject = String::Flatten(isolate, subject);
+  return ExecWithOutputRegisters(
+      isolate, regexp, subject, last_match_info,
+      [&](int32_t* output_registers, int output_register_count) {
+        return ExecRaw(isolate, *regexp, *subject, output_registers,
+                       output_register_count, index);
+      });
+}
+
+int ExperimentalRegExp::OneshotExecRaw(Isolate* isolate,
+                                       Handle<JSRegExp> regexp,
+                                       Handle<String> subject,
+                                       int32_t* output_registers,
+                                       int32_t output_register_count,
+                                       int32_t subject_index) {
+  DCHECK(FLAG_enable_experimental_regexp_engine_on_excessive_backtracks);
+  DCHECK(subject->IsFlat());
+  isolate->counters()->regexp_fallbacks_to_experimental()->Increment();
+
+  if (FLAG_trace_experimental_regexp_engine) {
+    StdoutStream{} << "Falling back to the experimental engine for /"
+                   << regexp->Pattern().ToCString().get() << "/"
+                   << std::endl;
+  }
+
+  // The pattern has been parsed successfully before, so parsing can only fail
+  // because of a stack overflow, in which case the exception is pending.
+  Zone zone(isolate->allocator(), ZONE_NAME);
+  RegExpCompileData parse_result;
+  FlatStringReader reader(isolate, handle(regexp->Pattern(), isolate));
+  JSRegExp::Flags flags = regexp->GetFlags();
+  if (!RegExpParser::ParseRegExp(isolate, &zone, &reader, flags,
+                                 &parse_result)) {
+    DCHECK_EQ(parse_result.error, RegExpError::kStackOverflow);
+    if (!isolate->has_pending_exception()) isolate->StackOverflow();
+    return RegExp::RE_EXCEPTION;
+  }
+
+  DCHECK(CanBeHandled(parse_result.tree, flags));
+  ZoneList<RegExpInstruction> bytecode =
+      ExperimentalRegExpCompiler::Compile(parse_result.tree, flags, &zone);
+
+  int register_count_per_match =
+      JSRegExp::RegistersForCaptureCount(regexp->CaptureCount());
+  return ExecRawImpl(isolate, bytecode.ToConstVector(),
+                     register_count_per_match, *subject, output_registers,
+                     output_register_count, subject_index);
+}
+
+MaybeHandle<Object> ExperimentalRegExp::OneshotExec(
+    Isolate* isolate, Handle<JSRegExp> regexp, Handle<String> subject,
+    int index, Handle<RegExpMatchInfo> last_match_info) {
+  subject = String::Flatten(isolate, subject);
+  return ExecWithOutputRegisters(
+      isolate, regexp, subject, last_match_info,
+      [&](int32_t* output_registers, int output_register_count) {
+        return OneshotExecRaw(isolate, regexp, subject, output_registers,
+                              output_register_count, index);
+      });
+}
+
+}  // namespace internal
+}  // namespace v8
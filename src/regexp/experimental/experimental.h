@@ -0,0 +1,67 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_REGEXP_EXPERIMENTAL_EXPERIMENTAL_H_
+#define V8_REGEXP_EXPERIMENTAL_EXPERIMENTAL_H_
+
+#include "src/regexp/regexp.h"
+
+namespace v8 {
+namespace internal {
+
+// The experimental regexp engine simulates an NFA (a Pike VM) instead of
+// backtracking, so its running time is linear in the subject length.  It can
+// only handle patterns without back references and lookarounds, see
+// {CanBeHandled}.  With --enable-experimental-regexp-engine, every regexp it
+// can handle is compiled for it (tagged JSRegExp::EXPERIMENTAL).  With
+// --enable-experimental-regexp-engine-on-excessive-backtracks, irregexp hands
+// a match over to the {Oneshot*} functions once it exceeds its backtrack
+// limit.
+class ExperimentalRegExp final : public AllStatic {
+ public:
+  // Initialization & Compilation
+  // -------------------------------------------------------------------------
+  // Checks whether a parsed regexp pattern can be compiled and executed by
+  // the experimental engine.
+  static bool CanBeHandled(RegExpTree* tree, JSRegExp::Flags flags);
+
+  // Compiles the parsed pattern in {parse_result} and prepares the JSRegExp
+  // object with the resulting bytecode.  The pattern must be handleable, see
+  // {CanBeHandled}.
+  static void Initialize(Isolate* isolate, Handle<JSRegExp> re,
+                         Handle<String> pattern, JSRegExp::Flags flags,
+                         RegExpCompileData* parse_result, Zone* zone,
+                         uint32_t backtrack_limit);
+
+  // Execution
+  // -------------------------------------------------------------------------
+  // Finds as many matches as fit into {output_registers}, starting at
+  // {subject_index}.  Returns the number of matches found.
+  static int ExecRaw(Isolate* isolate, JSRegExp regexp, String subject,
+                     int32_t* output_registers, int32_t output_register_count,
+                     int32_t subject_index);
+
+  // On a successful match, the result is the updated {last_match_info}.  On a
+  // failure, the result is the null value.
+  V8_WARN_UNUSED_RESULT static MaybeHandle<Object> Exec(
+      Isolate* isolate, Handle<JSRegExp> regexp, Handle<String> subject,
+      int index, Handle<RegExpMatchInfo> last_match_info);
+
+  // Compile and execute a regexp that is not tagged EXPERIMENTAL, without
+  // storing the bytecode on the regexp.  Used when irregexp exceeds its
+  // backtrack limit.  Returns RE_EXCEPTION if compilation fails with a stack
+  // overflow, and the number of matches found otherwise.
+  static int OneshotExecRaw(Isolate* isolate, Handle<JSRegExp> regexp,
+                            Handle<String> subject, int32_t* output_registers,
+                            int32_t output_register_count,
+                            int32_t subject_index);
+  V8_WARN_UNUSED_RESULT static MaybeHandle<Object> OneshotExec(
+      Isolate* isolate, Handle<JSRegExp> regexp, Handle<String> subject,
+      int index, Handle<RegExpMatchInfo> last_match_info);
+};
+
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_REGEXP_EXPERIMENTAL_EXPERIMENTAL_H_
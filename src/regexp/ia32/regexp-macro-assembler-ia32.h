@@ -190,6 +190,7 @@ class V8_EXPORT_PRIVATE RegExpMacroAssemblerIA32
   Label success_label_;
   Label backtrack_label_;
   Label exit_label_;
+  Label fallback_label_;
   Label check_preempt_label_;
   Label stack_overflow_label_;
 };
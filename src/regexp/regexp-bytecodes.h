@@ -41,7 +41,7 @@ STATIC_ASSERT(1 << BYTECODE_SHIFT > BYTECODE_MASK);
   V(SET_REGISTER, 8, 8)       /* bc8 reg_idx24 value32                      */ \
   V(ADVANCE_REGISTER, 9, 8)   /* bc8 reg_idx24 value32                      */ \
   V(POP_CP, 10, 4)            /* bc8 pad24                                  */ \
-  V(POP_BT, 11, 4)            /* bc8 pad24                                  */ \
+  V(POP_BT, 11, 4)            /* bc8 limit_result_code24                    */ \
   V(POP_REGISTER, 12, 4)      /* bc8 reg_idx24                              */ \
   V(FAIL, 13, 4)              /* bc8 pad24                                  */ \
   V(SUCCEED, 14, 4)           /* bc8 pad24                                  */ \
@@ -721,6 +721,52 @@ void RegExpDisjunction::FixSingleCharacterDisjunctions(
   alternatives->Rewind(write_posn);  // Trim end of array.
 }
 
+namespace {
+
+// Choices with more alternatives than this are split up by
+// BalanceAlternatives.
+constexpr int kMaxAlternativesPerChoice = 8;
+
+RegExpTree* BalancedDisjunction(Zone* zone,
+                                ZoneList<RegExpTree*>* alternatives, int from,
+                                int to) {
+  int length = to - from;
+  DCHECK_LT(0, length);
+  if (length == 1) return alternatives->at(from);
+  ZoneList<RegExpTree*>* list;
+  if (length <= kMaxAlternativesPerChoice) {
+    list = zone->New<ZoneList<RegExpTree*>>(length, zone);
+    for (int i = from; i < to; i++) list->Add(alternatives->at(i), zone);
+  } else {
+    int middle = from + length / 2;
+    list = zone->New<ZoneList<RegExpTree*>>(2, zone);
+    list->Add(BalancedDisjunction(zone, alternatives, from, middle), zone);
+    list->Add(BalancedDisjunction(zone, alternatives, middle, to), zone);
+  }
+  return zone->New<RegExpDisjunction>(list);
+}
+
+}  // namespace
+
+// Optimizes a|b|c|d to (?:a|b)|(?:c|d), for long lists of alternatives.
+// Nesting disjunctions does not change what they match, and once runs of
+// atoms have been sorted by their first character, the quick check of each
+// nested choice rejects all of its alternatives at once in most cases. This
+// turns the linear number of alternatives tried per position for large
+// literal alternations into a logarithmic one.
+void RegExpDisjunction::BalanceAlternatives(RegExpCompiler* compiler) {
+  Zone* zone = compiler->zone();
+  ZoneList<RegExpTree*>* alternatives = this->alternatives();
+  int length = alternatives->length();
+  DCHECK_LT(kMaxAlternativesPerChoice, length);
+  int middle = length / 2;
+  RegExpTree* lower = BalancedDisjunction(zone, alternatives, 0, middle);
+  RegExpTree* upper = BalancedDisjunction(zone, alternatives, middle, length);
+  alternatives->at(0) = lower;
+  alternatives->at(1) = upper;
+  alternatives->Rewind(2);
+}
+
 RegExpNode* RegExpDisjunction::ToNode(RegExpCompiler* compiler,
                                       RegExpNode* on_success) {
   ZoneList<RegExpTree*>* alternatives = this->alternatives();
@@ -732,6 +778,10 @@ RegExpNode* RegExpDisjunction::ToNode(RegExpCompiler* compiler,
     if (alternatives->length() == 1) {
       return alternatives->at(0)->ToNode(compiler, on_success);
     }
+    if (found_consecutive_atoms &&
+        alternatives->length() > kMaxAlternativesPerChoice) {
+      BalanceAlternatives(compiler);
+    }
   }
 
   int length = alternatives->length();
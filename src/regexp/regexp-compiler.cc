@@ -2863,6 +2863,18 @@ void BoyerMooreLookahead::EmitSkipInstructions(RegExpMacroAssembler* masm) {
 
   int lookahead_width = max_lookahead + 1 - min_lookahead;
 
+  // A vectorized scan for the characters that rule out a skip lands on a
+  // position no later than the skip loops below, and every position it skips
+  // is one that the skip loops would skip as well.  It runs first; the scalar
+  // code then deals with the candidate it stops at and the end of the input.
+  if (found_single_character && FLAG_regexp_simd) {
+    const uc16 c = single_character;
+    const uc16 mask = max_char_ > kSize ? RegExpMacroAssembler::kTableMask
+                                        : String::kMaxUtf16CodeUnit;
+    masm->SkipUntilOneOfMaskedCharactersUseSimd(
+        max_lookahead, Vector<const uc16>(&c, 1), mask);
+  }
+
   if (found_single_character && lookahead_width == 1 && max_lookahead < 3) {
     // The mask-compare can probably handle this better.
     return;
@@ -2891,6 +2903,28 @@ void BoyerMooreLookahead::EmitSkipInstructions(RegExpMacroAssembler* masm) {
       GetSkipTable(min_lookahead, max_lookahead, boolean_skip_table);
   DCHECK_NE(0, skip_distance);
 
+  if (FLAG_regexp_simd) {
+    // Vectorize the scan if only a few characters rule out a skip, e.g. when
+    // the pattern starts with a literal.  CheckBitInTable masks the current
+    // character with kTableMask, so the vectorized scan does as well.
+    constexpr int kMaxChars = RegExpMacroAssembler::kMaxSimdSkipCharacters;
+    uc16 chars[kMaxChars];
+    int char_count = 0;
+    for (int i = 0; i < kSize; i++) {
+      if (boolean_skip_table->get(i) == 0) continue;
+      if (char_count == kMaxChars) {
+        char_count = 0;  // Too many characters.
+        break;
+      }
+      chars[char_count++] = i;
+    }
+    if (char_count > 0) {
+      masm->SkipUntilOneOfMaskedCharactersUseSimd(
+          max_lookahead, Vector<const uc16>(chars, char_count),
+          RegExpMacroAssembler::kTableMask);
+    }
+  }
+
   Label cont, again;
   masm->Bind(&again);
   masm->LoadCurrentCharacter(max_lookahead, &cont, true);
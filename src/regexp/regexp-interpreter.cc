@@ -521,8 +521,12 @@ IrregexpInterpreter::Result RawMatch(
     BYTECODE(POP_BT) {
       STATIC_ASSERT(JSRegExp::kNoBacktrackLimit == 0);
       if (++backtrack_count == backtrack_limit) {
-        // Exceeded limits are treated as a failed match.
-        return IrregexpInterpreter::FAILURE;
+        // Exceeded limits are treated as a failed match, or fall back to the
+        // experimental engine, as encoded in the operand.
+        int return_code = LoadPacked24Signed(insn);
+        DCHECK(return_code == IrregexpInterpreter::FAILURE ||
+               return_code == IrregexpInterpreter::FALLBACK_TO_EXPERIMENTAL);
+        return static_cast<IrregexpInterpreter::Result>(return_code);
       }
 
       IrregexpInterpreter::Result return_code =
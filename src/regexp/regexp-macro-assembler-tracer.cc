@@ -342,6 +342,17 @@ void RegExpMacroAssemblerTracer::CheckBitInTable(
   assembler_->CheckBitInTable(table, on_bit_set);
 }
 
+bool RegExpMacroAssemblerTracer::SkipUntilOneOfMaskedCharactersUseSimd(
+    int cp_offset, Vector<const uc16> chars, uc16 mask) {
+  bool supported = assembler_->SkipUntilOneOfMaskedCharactersUseSimd(
+      cp_offset, chars, mask);
+  PrintF(" SkipUntilOneOfMaskedCharactersUseSimd(cp_offset=%d, mask=0x%04x,",
+         cp_offset, mask);
+  for (uc16 c : chars) PrintF(" 0x%04x", c);
+  PrintF("): %s;\n", supported ? "true" : "false");
+  return supported;
+}
+
 
 void RegExpMacroAssemblerTracer::CheckNotBackReference(int start_reg,
                                                        bool read_backward,
@@ -44,6 +44,9 @@ class RegExpMacroAssemblerTracer: public RegExpMacroAssembler {
   void CheckCharacterNotInRange(uc16 from, uc16 to,
                                 Label* on_not_in_range) override;
   void CheckBitInTable(Handle<ByteArray> table, Label* on_bit_set) override;
+  bool SkipUntilOneOfMaskedCharactersUseSimd(int cp_offset,
+                                             Vector<const uc16> chars,
+                                             uc16 mask) override;
   void CheckPosition(int cp_offset, Label* on_outside_input) override;
   bool CheckSpecialCharacterClass(uc16 type, Label* on_no_match) override;
   void Fail() override;
@@ -115,6 +115,18 @@ class RegExpMacroAssembler {
   // array, and if the found byte is non-zero, we jump to the on_bit_set label.
   virtual void CheckBitInTable(Handle<ByteArray> table, Label* on_bit_set) = 0;
 
+  // Emits a vectorized loop that advances the current position while the
+  // character at {cp_offset}, and'ed with {mask}, is none of {chars}.  The
+  // loop stops at the first position where it is one of {chars}, or when too
+  // few characters are left for a full vector, so the caller still has to
+  // check the remaining positions.  Returns false, without emitting code, if
+  // the assembler has no vectorized implementation.
+  static constexpr int kMaxSimdSkipCharacters = 2;
+  virtual bool SkipUntilOneOfMaskedCharactersUseSimd(
+      int cp_offset, Vector<const uc16> chars, uc16 mask) {
+    return false;
+  }
+
   // Checks whether the given offset from the current position is before
   // the end of the string.  May overwrite the current character.
   virtual void CheckPosition(int cp_offset, Label* on_outside_input);
@@ -187,6 +199,10 @@ class RegExpMacroAssembler {
     backtrack_limit_ = backtrack_limit;
   }
 
+  // Set whether exceeding the backtrack limit hands the match over to the
+  // experimental engine instead of failing it.
+  void set_can_fallback(bool val) { can_fallback_ = val; }
+
   enum GlobalMode {
     NOT_GLOBAL,
     GLOBAL_NO_ZERO_LENGTH_CHECK,
@@ -211,9 +227,12 @@ class RegExpMacroAssembler {
   }
   uint32_t backtrack_limit() const { return backtrack_limit_; }
 
+  bool can_fallback() const { return can_fallback_; }
+
  private:
   bool slow_safe_compiler_;
   uint32_t backtrack_limit_ = JSRegExp::kNoBacktrackLimit;
+  bool can_fallback_ = false;
   GlobalMode global_mode_;
   Isolate* isolate_;
   Zone* zone_;
@@ -233,11 +252,14 @@ class NativeRegExpMacroAssembler: public RegExpMacroAssembler {
   // FAILURE: Matching failed.
   // SUCCESS: Matching succeeded, and the output array has been filled with
   //        capture positions.
+  // FALLBACK_TO_EXPERIMENTAL: Execution exceeded the backtrack limit, and the
+  //        match should be computed by the experimental regexp engine.
   enum Result {
     FAILURE = RegExp::kInternalRegExpFailure,
     SUCCESS = RegExp::kInternalRegExpSuccess,
     EXCEPTION = RegExp::kInternalRegExpException,
     RETRY = RegExp::kInternalRegExpRetry,
+    FALLBACK_TO_EXPERIMENTAL = RegExp::kInternalRegExpFallbackToExperimental,
   };
 
   NativeRegExpMacroAssembler(Isolate* isolate, Zone* zone);
@@ -6,8 +6,11 @@
 
 #include "src/codegen/compilation-cache.h"
 #include "src/diagnostics/code-tracer.h"
+#include "src/handles/global-handles.h"
 #include "src/heap/heap-inl.h"
+#include "src/init/v8.h"
 #include "src/objects/js-regexp-inl.h"
+#include "src/regexp/experimental/experimental.h"
 #include "src/regexp/regexp-bytecode-generator.h"
 #include "src/regexp/regexp-bytecodes.h"
 #include "src/regexp/regexp-compiler.h"
@@ -17,6 +20,7 @@
 #include "src/regexp/regexp-macro-assembler-tracer.h"
 #include "src/regexp/regexp-parser.h"
 #include "src/strings/string-search.h"
+#include "src/tasks/cancelable-task.h"
 #include "src/utils/ostreams.h"
 
 namespace v8 {
@@ -73,6 +77,11 @@ class RegExpImpl final : public AllStatic {
                                             Handle<String> sample_subject,
                                             bool is_one_byte);
 
+  // Posts a task that compiles native code for all encodings the regexp has
+  // bytecode for. The regexp keeps using the interpreter until then.
+  static void PostTierUpTask(Isolate* isolate, Handle<JSRegExp> re);
+  static void TierUpFromTask(Isolate* isolate, Handle<JSRegExp> re);
+
   // Returns true on success, false on failure.
   static bool Compile(Isolate* isolate, Zone* zone, RegExpCompileData* input,
                       JSRegExp::Flags flags, Handle<String> pattern,
@@ -171,6 +180,18 @@ MaybeHandle<Object> RegExp::Compile(Isolate* isolate, Handle<JSRegExp> re,
     return ThrowRegExpException(isolate, re, pattern, parse_result.error);
   }
 
+  if (FLAG_enable_experimental_regexp_engine_on_excessive_backtracks &&
+      ExperimentalRegExp::CanBeHandled(parse_result.tree, flags)) {
+    // Bound the backtracks of irregexp; once the budget is used up, the match
+    // is computed by the linear-time engine instead.
+    if (backtrack_limit == JSRegExp::kNoBacktrackLimit) {
+      backtrack_limit = FLAG_regexp_backtracks_before_fallback;
+    } else {
+      backtrack_limit =
+          std::min(backtrack_limit, FLAG_regexp_backtracks_before_fallback);
+    }
+  }
+
   bool has_been_compiled = false;
 
   if (parse_result.simple && !IgnoreCase(flags) && !IsSticky(flags) &&
@@ -192,8 +213,17 @@ MaybeHandle<Object> RegExp::Compile(Isolate* isolate, Handle<JSRegExp> re,
     }
   }
   if (!has_been_compiled) {
-    RegExpImpl::IrregexpInitialize(isolate, re, pattern, flags,
-                                   parse_result.capture_count, backtrack_limit);
+    if (FLAG_enable_experimental_regexp_engine &&
+        ExperimentalRegExp::CanBeHandled(parse_result.tree, flags)) {
+      // Atoms are still handled above since a plain string search is faster
+      // than simulating the NFA.
+      ExperimentalRegExp::Initialize(isolate, re, pattern, flags,
+                                     &parse_result, &zone, backtrack_limit);
+    } else {
+      RegExpImpl::IrregexpInitialize(isolate, re, pattern, flags,
+                                     parse_result.capture_count,
+                                     backtrack_limit);
+    }
   }
   DCHECK(re->data().IsFixedArray());
   // Compilation succeeded so the data is set on the regexp
@@ -218,6 +248,9 @@ MaybeHandle<Object> RegExp::Exec(Isolate* isolate, Handle<JSRegExp> regexp,
       return RegExpImpl::IrregexpExec(isolate, regexp, subject, index,
                                       last_match_info);
     }
+    case JSRegExp::EXPERIMENTAL:
+      return ExperimentalRegExp::Exec(isolate, regexp, subject, index,
+                                      last_match_info);
     default:
       UNREACHABLE();
   }
@@ -343,9 +376,76 @@ bool RegExpImpl::EnsureCompiledIrregexp(Isolate* isolate, Handle<JSRegExp> re,
 
   DCHECK_IMPLIES(needs_tier_up_compilation, bytecode.IsByteArray());
 
+  if (needs_tier_up_compilation && FLAG_regexp_tier_up_in_task) {
+    PostTierUpTask(isolate, re);
+    return true;
+  }
+
   return CompileIrregexp(isolate, re, sample_subject, is_one_byte);
 }
 
+namespace {
+
+class RegExpTierUpTask final : public CancelableTask {
+ public:
+  RegExpTierUpTask(Isolate* isolate, Handle<JSRegExp> regexp)
+      : CancelableTask(isolate), isolate_(isolate), regexp_(regexp) {}
+
+  void RunInternal() override {
+    {
+      HandleScope scope(isolate_);
+      RegExpImpl::TierUpFromTask(isolate_,
+                                 Handle<JSRegExp>(*regexp_, isolate_));
+    }
+    // The global handle is only released when the task runs. Canceled tasks
+    // may outlive the isolate, which frees the handle on teardown.
+    GlobalHandles::Destroy(regexp_.location());
+  }
+
+ private:
+  Isolate* const isolate_;
+  Handle<JSRegExp> regexp_;
+
+  DISALLOW_COPY_AND_ASSIGN(RegExpTierUpTask);
+};
+
+}  // namespace
+
+// static
+void RegExpImpl::PostTierUpTask(Isolate* isolate, Handle<JSRegExp> re) {
+  DCHECK(re->MarkedForTierUp());
+  re->MarkTierUpPending();
+  if (FLAG_trace_regexp_tier_up) {
+    PrintF("JSRegExp object %p posts tier-up task\n",
+           reinterpret_cast<void*>(re->ptr()));
+  }
+  auto taskrunner = V8::GetCurrentPlatform()->GetForegroundTaskRunner(
+      reinterpret_cast<v8::Isolate*>(isolate));
+  taskrunner->PostTask(std::make_unique<RegExpTierUpTask>(
+      isolate, isolate->global_handles()->Create(*re)));
+}
+
+// static
+void RegExpImpl::TierUpFromTask(Isolate* isolate, Handle<JSRegExp> re) {
+  // The regexp may have been recompiled, or tiered up synchronously, in the
+  // meantime.
+  if (re->TypeTag() != JSRegExp::IRREGEXP || !re->TierUpPending()) return;
+  // Mark the regexp for tier-up so that native code is produced below.
+  FixedArray::cast(re->data())
+      .set(JSRegExp::kIrregexpTicksUntilTierUpIndex, Smi::zero());
+  Handle<String> sample_subject = isolate->factory()->empty_string();
+  for (bool is_one_byte : {true, false}) {
+    if (!re->Bytecode(is_one_byte).IsByteArray()) continue;
+    if (!CompileIrregexp(isolate, re, sample_subject, is_one_byte)) {
+      // Leave the regexp marked for tier-up. The next execution recompiles
+      // synchronously and reports the error to its caller.
+      DCHECK(isolate->has_pending_exception());
+      isolate->clear_pending_exception();
+      return;
+    }
+  }
+}
+
 #ifdef DEBUG
 namespace {
 
@@ -537,6 +637,8 @@ int RegExpImpl::IrregexpExecRaw(Isolate* isolate, Handle<JSRegExp> regexp,
                       RegExp::RE_FAILURE);
         STATIC_ASSERT(static_cast<int>(NativeRegExpMacroAssembler::EXCEPTION) ==
                       RegExp::RE_EXCEPTION);
+        STATIC_ASSERT(NativeRegExpMacroAssembler::FALLBACK_TO_EXPERIMENTAL ==
+                      static_cast<int>(RegExp::RE_FALLBACK_TO_EXPERIMENTAL));
         return res;
       }
       // If result is RETRY, the string has changed representation, and we
@@ -562,6 +664,7 @@ int RegExpImpl::IrregexpExecRaw(Isolate* isolate, Handle<JSRegExp> regexp,
         case IrregexpInterpreter::SUCCESS:
         case IrregexpInterpreter::EXCEPTION:
         case IrregexpInterpreter::FAILURE:
+        case IrregexpInterpreter::FALLBACK_TO_EXPERIMENTAL:
           return result;
         case IrregexpInterpreter::RETRY:
           // The string has changed representation, and we must restart the
@@ -636,6 +739,10 @@ MaybeHandle<Object> RegExpImpl::IrregexpExec(
     DCHECK(isolate->has_pending_exception());
     return MaybeHandle<Object>();
   }
+  if (res == RegExp::RE_FALLBACK_TO_EXPERIMENTAL) {
+    return ExperimentalRegExp::OneshotExec(isolate, regexp, subject,
+                                           previous_index, last_match_info);
+  }
   DCHECK(res == RegExp::RE_FAILURE);
   return isolate->factory()->null_value();
 }
@@ -792,6 +899,9 @@ bool RegExpImpl::Compile(Isolate* isolate, Zone* zone, RegExpCompileData* data,
 
   macro_assembler->set_slow_safe(TooMuchRegExpCode(isolate, pattern));
   macro_assembler->set_backtrack_limit(backtrack_limit);
+  macro_assembler->set_can_fallback(
+      FLAG_enable_experimental_regexp_engine_on_excessive_backtracks &&
+      ExperimentalRegExp::CanBeHandled(data->tree, flags));
 
   // Inserted here, instead of in Assembler, because it depends on information
   // in the AST that isn't replicated in the Node structure.
@@ -876,6 +986,12 @@ RegExpGlobalCache::RegExpGlobalCache(Handle<JSRegExp> regexp,
     registers_per_match_ = kAtomRegistersPerMatch;
     // There is no distinction between interpreted and native for atom regexps.
     interpreted = false;
+  } else if (regexp_->TypeTag() == JSRegExp::EXPERIMENTAL) {
+    registers_per_match_ =
+        JSRegExp::RegistersForCaptureCount(regexp_->CaptureCount());
+    // The experimental engine finds several matches per call, like native
+    // irregexp code.
+    interpreted = false;
   } else {
     registers_per_match_ = RegExp::IrregexpPrepare(isolate_, regexp_, subject_);
     if (registers_per_match_ < 0) {
@@ -961,9 +1077,20 @@ int32_t* RegExpGlobalCache::FetchNext() {
         num_matches_ = 0;  // Signal failed match.
         return nullptr;
       }
-      num_matches_ = RegExpImpl::IrregexpExecRaw(
-          isolate_, regexp_, subject_, last_end_index, register_array_,
-          register_array_size_);
+      if (regexp_->TypeTag() == JSRegExp::EXPERIMENTAL) {
+        num_matches_ = ExperimentalRegExp::ExecRaw(
+            isolate_, *regexp_, *subject_, register_array_,
+            register_array_size_, last_end_index);
+      } else {
+        num_matches_ = RegExpImpl::IrregexpExecRaw(
+            isolate_, regexp_, subject_, last_end_index, register_array_,
+            register_array_size_);
+        if (num_matches_ == RegExp::RE_FALLBACK_TO_EXPERIMENTAL) {
+          num_matches_ = ExperimentalRegExp::OneshotExecRaw(
+              isolate_, regexp_, subject_, register_array_,
+              register_array_size_, last_end_index);
+        }
+      }
     }
 
     if (num_matches_ <= 0) return nullptr;
@@ -157,8 +157,12 @@ void RegExpMacroAssemblerX64::Backtrack() {
     __ cmpq(Operand(rbp, kBacktrackCount), Immediate(backtrack_limit()));
     __ j(not_equal, &next);
 
-    // Exceeded limits are treated as a failed match.
-    Fail();
+    if (can_fallback()) {
+      __ jmp(&fallback_label_);
+    } else {
+      // Exceeded limits are treated as a failed match.
+      Fail();
+    }
 
     __ bind(&next);
   }
@@ -541,6 +545,70 @@ void RegExpMacroAssemblerX64::CheckBitInTable(
   BranchOrBacktrack(not_equal, on_bit_set);
 }
 
+void RegExpMacroAssemblerX64::BroadcastCharacter(XMMRegister dst, uc16 c) {
+  __ movl(rax, Immediate(c));
+  __ movd(dst, rax);
+  if (mode_ == LATIN1) __ punpcklbw(dst, dst);
+  __ pshuflw(dst, dst, 0);
+  __ pshufd(dst, dst, 0);
+}
+
+bool RegExpMacroAssemblerX64::SkipUntilOneOfMaskedCharactersUseSimd(
+    int cp_offset, Vector<const uc16> chars, uc16 mask) {
+  DCHECK(!chars.empty());
+  DCHECK_LE(chars.length(), kMaxSimdSkipCharacters);
+  // Only SSE2 is used, which every x64 CPU supports.  Only caller-saved XMM
+  // registers are used: xmm0 holds the loaded characters, xmm1 the mask,
+  // xmm2 and xmm3 the characters searched for, and xmm4 the second compare.
+  static constexpr int kVectorSize = kSimd128Size;
+  const int offset = cp_offset * char_size();
+  const uc16 char_mask =
+      mode_ == LATIN1 ? String::kMaxOneByteCharCode : String::kMaxUtf16CodeUnit;
+  const bool needs_mask = (mask & char_mask) != char_mask;
+
+  if (needs_mask) BroadcastCharacter(xmm1, mask & char_mask);
+  BroadcastCharacter(xmm2, chars[0] & mask);
+  if (chars.length() > 1) BroadcastCharacter(xmm3, chars[1] & mask);
+
+  Label loop, found, done;
+  __ bind(&loop);
+  // Stop once the vector at {cp_offset} would extend past the end of input.
+  __ leaq(rax, Operand(rdi, offset + kVectorSize));
+  __ cmpq(rax, Immediate(0));
+  __ j(greater, &done);
+
+  __ movdqu(xmm0, Operand(rsi, rdi, times_1, offset));
+  if (needs_mask) __ pand(xmm0, xmm1);
+  if (chars.length() > 1) {
+    __ movaps(xmm4, xmm0);
+    if (mode_ == LATIN1) {
+      __ pcmpeqb(xmm4, xmm3);
+    } else {
+      __ pcmpeqw(xmm4, xmm3);
+    }
+  }
+  if (mode_ == LATIN1) {
+    __ pcmpeqb(xmm0, xmm2);
+  } else {
+    __ pcmpeqw(xmm0, xmm2);
+  }
+  if (chars.length() > 1) __ por(xmm0, xmm4);
+  __ pmovmskb(rax, xmm0);
+  __ testl(rax, rax);
+  __ j(not_zero, &found);
+  __ addq(rdi, Immediate(kVectorSize));
+  __ jmp(&loop);
+
+  // The lowest set bit is the first byte of the first matching character,
+  // so its index is the byte distance to the new current position.
+  __ bind(&found);
+  __ bsfl(rax, rax);
+  __ addq(rdi, rax);
+
+  __ bind(&done);
+  return true;
+}
+
 
 bool RegExpMacroAssemblerX64::CheckSpecialCharacterClass(uc16 type,
                                                          Label* on_no_match) {
@@ -999,6 +1067,11 @@ Handle<HeapObject> RegExpMacroAssemblerX64::GetCode(Handle<String> source) {
     __ Set(rax, EXCEPTION);
     __ jmp(&return_rax);
   }
+  if (fallback_label_.is_linked()) {
+    __ bind(&fallback_label_);
+    __ Set(rax, FALLBACK_TO_EXPERIMENTAL);
+    __ jmp(&return_rax);
+  }
 
   FixupCodeRelativePositions();
 
@@ -48,6 +48,9 @@ class V8_EXPORT_PRIVATE RegExpMacroAssemblerX64
   void CheckCharacterNotInRange(uc16 from, uc16 to,
                                 Label* on_not_in_range) override;
   void CheckBitInTable(Handle<ByteArray> table, Label* on_bit_set) override;
+  bool SkipUntilOneOfMaskedCharactersUseSimd(int cp_offset,
+                                             Vector<const uc16> chars,
+                                             uc16 mask) override;
 
   // Checks whether the given offset from the current position is before
   // the end of the string.
@@ -184,6 +187,9 @@ class V8_EXPORT_PRIVATE RegExpMacroAssemblerX64
   // Byte size of chars in the string to match (decided by the Mode argument)
   inline int char_size() { return static_cast<int>(mode_); }
 
+  // Fills all lanes of {dst} with the character {c}.  Clobbers rax.
+  void BroadcastCharacter(XMMRegister dst, uc16 c);
+
   // Equivalent to a conditional branch to the label, unless the label
   // is nullptr, in which case it is a conditional Backtrack.
   void BranchOrBacktrack(Condition condition, Label* to);
@@ -246,6 +252,7 @@ class V8_EXPORT_PRIVATE RegExpMacroAssemblerX64
   Label success_label_;
   Label backtrack_label_;
   Label exit_label_;
+  Label fallback_label_;
   Label check_preempt_label_;
   Label stack_overflow_label_;
 };
@@ -13,6 +13,7 @@
 #include "src/execution/isolate-inl.h"
 #include "src/execution/v8threads.h"
 #include "src/execution/vm-state-inl.h"
+#include "src/logging/metrics.h"
 #include "src/objects/js-array-buffer-inl.h"
 #include "src/objects/js-array-inl.h"
 #include "src/runtime/runtime-utils.h"
@@ -178,6 +179,20 @@ RUNTIME_FUNCTION(Runtime_NotifyDeoptimized) {
   DeoptimizeKind type = deoptimizer->deopt_kind();
   bool should_reuse_code = deoptimizer->should_reuse_code();
 
+  v8::metrics::FunctionDeoptimized event;
+  event.reason = DeoptimizeReasonToString(deoptimizer->deopt_reason());
+  event.eager = type == DeoptimizeKind::kEager;
+  event.soft = type == DeoptimizeKind::kSoft;
+  event.lazy = type == DeoptimizeKind::kLazy;
+  // Only eager and soft deopts invalidate the code below; lazy deopts happen
+  // for code that has already been marked for deoptimization.
+  event.code_discarded = !should_reuse_code && (event.eager || event.soft);
+  SharedFunctionInfo shared = function->shared();
+  if (shared.script().IsScript()) {
+    event.script_id = Script::cast(shared.script()).id();
+  }
+  event.function_start_position = shared.StartPosition();
+
   // TODO(turbofan): We currently need the native context to materialize
   // the arguments object, but only to get to its map.
   isolate->set_context(deoptimizer->function()->native_context());
@@ -191,6 +206,12 @@ RUNTIME_FUNCTION(Runtime_NotifyDeoptimized) {
   JavaScriptFrame* top_frame = top_it.frame();
   isolate->set_context(Context::cast(top_frame->context()));
 
+  if (isolate->metrics_recorder()->HasEmbedderRecorder()) {
+    isolate->metrics_recorder()->AddMainThreadEvent(
+        event, isolate->GetOrRegisterContextToken(
+                   handle(function->native_context(), isolate)));
+  }
+
   if (should_reuse_code) {
     optimized_code->increment_deoptimization_count();
     return ReadOnlyRoots(isolate).undefined_value();
@@ -12,6 +12,47 @@
 namespace v8 {
 namespace internal {
 
+namespace {
+
+// If |referrer| is a module that statically imports |specifier| and the
+// imported module has already been evaluated successfully, returns that
+// module. HostResolveImportedModule and HostImportModuleDynamically must
+// resolve the same (referrer, specifier) pair to the same module, so the
+// embedder callback can be skipped in this case.
+MaybeHandle<Module> TryGetEvaluatedStaticImport(Isolate* isolate,
+                                                Handle<Script> referrer,
+                                                Handle<Object> specifier) {
+  DisallowHeapAllocation no_gc;
+  if (!specifier->IsString()) return MaybeHandle<Module>();
+  if (!referrer->origin_options().IsModule()) return MaybeHandle<Module>();
+
+  // Functions created by the Function constructor inside a module refer to
+  // the module's script but don't have a module context.
+  Context context = isolate->context();
+  while (!context.IsModuleContext()) {
+    if (context.IsNativeContext()) return MaybeHandle<Module>();
+    context = context.previous();
+  }
+  SourceTextModule module = SourceTextModule::cast(context.extension());
+  if (module.script() != *referrer) return MaybeHandle<Module>();
+
+  FixedArray module_requests = module.info().module_requests();
+  for (int i = 0, n = module_requests.length(); i < n; ++i) {
+    if (!String::cast(module_requests.get(i)).Equals(String::cast(*specifier)))
+      continue;
+    Module requested = Module::cast(module.requested_modules().get(i));
+    if (requested.status() != Module::kEvaluated) break;
+    if (requested.IsSourceTextModule() &&
+        SourceTextModule::cast(requested).async_evaluating()) {
+      break;
+    }
+    return handle(requested, isolate);
+  }
+  return MaybeHandle<Module>();
+}
+
+}  // namespace
+
 RUNTIME_FUNCTION(Runtime_DynamicImportCall) {
   HandleScope scope(isolate);
   DCHECK_EQ(2, args.length());
@@ -24,6 +65,18 @@ RUNTIME_FUNCTION(Runtime_DynamicImportCall) {
     script = handle(Script::cast(script->eval_from_shared().script()), isolate);
   }
 
+  Handle<Module> module;
+  if (FLAG_dynamic_import_fast_path &&
+      TryGetEvaluatedStaticImport(isolate, script, specifier)
+          .ToHandle(&module)) {
+    Handle<JSModuleNamespace> ns = Module::GetModuleNamespace(isolate, module);
+    Handle<JSPromise> promise = isolate->factory()->NewJSPromise();
+    // Resolving may observe a "then" export of the namespace; any exception
+    // thrown by it rejects the promise as in the embedder path.
+    RETURN_FAILURE_ON_EXCEPTION(isolate, JSPromise::Resolve(promise, ns));
+    return *promise;
+  }
+
   RETURN_RESULT_OR_FAILURE(
       isolate,
       isolate->RunHostImportModuleDynamicallyCallback(script, specifier));
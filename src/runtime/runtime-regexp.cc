@@ -322,7 +322,7 @@ bool CompiledReplacement::Compile(Isolate* isolate, Handle<JSRegExp> regexp,
 
     FixedArray capture_name_map;
     if (capture_count > 0) {
-      DCHECK_EQ(regexp->TypeTag(), JSRegExp::IRREGEXP);
+      DCHECK_NE(regexp->TypeTag(), JSRegExp::ATOM);
       Object maybe_capture_name_map = regexp->CaptureNameMap();
       if (maybe_capture_name_map.IsFixedArray()) {
         capture_name_map = FixedArray::cast(maybe_capture_name_map);
@@ -602,6 +602,96 @@ V8_WARN_UNUSED_RESULT static Object StringReplaceGlobalAtomRegExpWithString(
   return *result;
 }
 
+// Replaces all matches of a non-atom regexp with a replacement string that
+// contains no $-patterns.  Instead of assembling the result from parts, the
+// match boundaries are collected first, so that the result string can be
+// allocated with its final length and written directly.
+template <typename ResultSeqString>
+V8_WARN_UNUSED_RESULT static Object StringReplaceGlobalRegExpWithSimpleString(
+    Isolate* isolate, Handle<String> subject, Handle<JSRegExp> regexp,
+    Handle<String> replacement, Handle<RegExpMatchInfo> last_match_info) {
+  DCHECK(subject->IsFlat());
+  DCHECK(replacement->IsFlat());
+
+  RegExpGlobalCache global_cache(regexp, subject, isolate);
+  if (global_cache.HasException()) return ReadOnlyRoots(isolate).exception();
+
+  std::vector<int>* indices = GetRewoundRegexpIndicesList(isolate);
+  int64_t matched_len = 0;
+  for (int32_t* current_match = global_cache.FetchNext();
+       current_match != nullptr; current_match = global_cache.FetchNext()) {
+    indices->push_back(current_match[0]);
+    indices->push_back(current_match[1]);
+    matched_len += current_match[1] - current_match[0];
+  }
+  if (global_cache.HasException()) return ReadOnlyRoots(isolate).exception();
+  if (indices->empty()) return *subject;
+
+  int subject_len = subject->length();
+  int replacement_len = replacement->length();
+  int64_t match_count = static_cast<int64_t>(indices->size() / 2);
+
+  // Detect integer overflow.
+  int64_t result_len_64 = static_cast<int64_t>(subject_len) - matched_len +
+                          static_cast<int64_t>(replacement_len) * match_count;
+  int result_len;
+  if (result_len_64 > static_cast<int64_t>(String::kMaxLength)) {
+    STATIC_ASSERT(String::kMaxLength < kMaxInt);
+    result_len = kMaxInt;  // Provoke exception.
+  } else {
+    result_len = static_cast<int>(result_len_64);
+  }
+
+  RegExp::SetLastMatchInfo(isolate, last_match_info, subject,
+                           regexp->CaptureCount(),
+                           global_cache.LastSuccessfulMatch());
+
+  if (result_len == 0) return ReadOnlyRoots(isolate).empty_string();
+
+  MaybeHandle<SeqString> maybe_res;
+  if (ResultSeqString::kHasOneByteEncoding) {
+    maybe_res = isolate->factory()->NewRawOneByteString(result_len);
+  } else {
+    maybe_res = isolate->factory()->NewRawTwoByteString(result_len);
+  }
+  Handle<SeqString> untyped_res;
+  ASSIGN_RETURN_FAILURE_ON_EXCEPTION(isolate, untyped_res, maybe_res);
+  Handle<ResultSeqString> result = Handle<ResultSeqString>::cast(untyped_res);
+
+  DisallowHeapAllocation no_gc;
+  int subject_pos = 0;
+  int result_pos = 0;
+  for (size_t i = 0; i < indices->size(); i += 2) {
+    int start = indices->at(i);
+    int end = indices->at(i + 1);
+
+    // Copy non-matched subject content.
+    if (subject_pos < start) {
+      String::WriteToFlat(*subject, result->GetChars(no_gc) + result_pos,
+                          subject_pos, start);
+      result_pos += start - subject_pos;
+    }
+
+    // Replace match.
+    if (replacement_len > 0) {
+      String::WriteToFlat(*replacement, result->GetChars(no_gc) + result_pos, 0,
+                          replacement_len);
+      result_pos += replacement_len;
+    }
+
+    subject_pos = end;
+  }
+  // Add remaining subject content at the end.
+  if (subject_pos < subject_len) {
+    String::WriteToFlat(*subject, result->GetChars(no_gc) + result_pos,
+                        subject_pos, subject_len);
+  }
+
+  TruncateRegexpIndicesList(isolate);
+
+  return *result;
+}
+
 V8_WARN_UNUSED_RESULT static Object StringReplaceGlobalRegExpWithString(
     Isolate* isolate, Handle<String> subject, Handle<JSRegExp> regexp,
     Handle<String> replacement, Handle<RegExpMatchInfo> last_match_info) {
@@ -638,6 +728,18 @@ V8_WARN_UNUSED_RESULT static Object StringReplaceGlobalRegExpWithString(
     }
   }
 
+  // Replacements without $-patterns are written straight into the result.
+  if (simple_replace) {
+    if (subject->IsOneByteRepresentation() &&
+        replacement->IsOneByteRepresentation()) {
+      return StringReplaceGlobalRegExpWithSimpleString<SeqOneByteString>(
+          isolate, subject, regexp, replacement, last_match_info);
+    } else {
+      return StringReplaceGlobalRegExpWithSimpleString<SeqTwoByteString>(
+          isolate, subject, regexp, replacement, last_match_info);
+    }
+  }
+
   RegExpGlobalCache global_cache(regexp, subject, isolate);
   if (global_cache.HasException()) return ReadOnlyRoots(isolate).exception();
 
@@ -891,7 +993,8 @@ class MatchInfoBackedMatch : public String::Match {
       : isolate_(isolate), match_info_(match_info) {
     subject_ = String::Flatten(isolate, subject);
 
-    if (regexp->TypeTag() == JSRegExp::IRREGEXP) {
+    if (regexp->TypeTag() == JSRegExp::IRREGEXP ||
+        regexp->TypeTag() == JSRegExp::EXPERIMENTAL) {
       Object o = regexp->CaptureNameMap();
       has_named_captures_ = o.IsFixedArray();
       if (has_named_captures_) {
@@ -1460,8 +1563,8 @@ RUNTIME_FUNCTION(Runtime_StringReplaceNonGlobalRegExpWithFunction) {
   bool has_named_captures = false;
   Handle<FixedArray> capture_map;
   if (m > 1) {
-    // The existence of capture groups implies IRREGEXP kind.
-    DCHECK_EQ(regexp->TypeTag(), JSRegExp::IRREGEXP);
+    // The existence of capture groups implies IRREGEXP or EXPERIMENTAL kind.
+    DCHECK_NE(regexp->TypeTag(), JSRegExp::ATOM);
 
     Object maybe_capture_map = regexp->CaptureNameMap();
     if (maybe_capture_map.IsFixedArray()) {
@@ -1250,6 +1250,28 @@ RUNTIME_FUNCTION(Runtime_RegexpHasNativeCode) {
   return isolate->heap()->ToBoolean(result);
 }
 
+RUNTIME_FUNCTION(Runtime_RegexpTypeTag) {
+  HandleScope scope(isolate);
+  DCHECK_EQ(1, args.length());
+  CONVERT_ARG_CHECKED(JSRegExp, regexp, 0);
+  const char* type_str;
+  switch (regexp.TypeTag()) {
+    case JSRegExp::NOT_COMPILED:
+      type_str = "NOT_COMPILED";
+      break;
+    case JSRegExp::ATOM:
+      type_str = "ATOM";
+      break;
+    case JSRegExp::IRREGEXP:
+      type_str = "IRREGEXP";
+      break;
+    case JSRegExp::EXPERIMENTAL:
+      type_str = "EXPERIMENTAL";
+      break;
+  }
+  return *isolate->factory()->NewStringFromAsciiChecked(type_str);
+}
+
 #define ELEMENTS_KIND_CHECK_RUNTIME_FUNCTION(Name)      \
   RUNTIME_FUNCTION(Runtime_Has##Name) {                 \
     CONVERT_ARG_CHECKED(JSObject, obj, 0);              \
@@ -1422,6 +1444,30 @@ RUNTIME_FUNCTION(Runtime_TypedArrayMaxLength) {
   return *isolate->factory()->NewNumber(JSTypedArray::kMaxLength);
 }
 
+// Returns the number of entries and loop iterations counted by Liftoff code of
+// the given function, as a two-element array. Requires
+// --wasm-liftoff-profiling.
+RUNTIME_FUNCTION(Runtime_WasmGetLiftoffProfile) {
+  HandleScope scope(isolate);
+  DCHECK_EQ(2, args.length());
+  CONVERT_ARG_HANDLE_CHECKED(WasmInstanceObject, instance, 0);
+  CONVERT_SMI_ARG_CHECKED(function_index, 1);
+  CHECK(FLAG_wasm_liftoff_profiling);
+  const wasm::WasmModule* module = instance->module();
+  CHECK_LE(static_cast<int>(module->num_imported_functions), function_index);
+  CHECK_GT(static_cast<int>(module->functions.size()), function_index);
+  auto* native_module = instance->module_object().native_module();
+  int declared_index = wasm::declared_function_index(module, function_index);
+  Handle<FixedArray> profile = isolate->factory()->NewFixedArray(2);
+  profile->set(0, *isolate->factory()->NewNumberFromUint(
+                      native_module->num_liftoff_function_calls_array()
+                          [declared_index]));
+  profile->set(1, *isolate->factory()->NewNumberFromUint(
+                      native_module->num_liftoff_loop_iterations_array()
+                          [declared_index]));
+  return *isolate->factory()->NewJSArrayWithElements(profile);
+}
+
 RUNTIME_FUNCTION(Runtime_WasmGetNumberOfInstances) {
   SealHandleScope shs(isolate);
   DCHECK_EQ(1, args.length());
@@ -74,6 +74,92 @@ bool CompareNum(T x, T y) {
   return false;
 }
 
+// Maps integers to unsigned keys with the same order.
+template <typename T>
+typename std::make_unsigned<T>::type ToSortKey(T value) {
+  using Key = typename std::make_unsigned<T>::type;
+  Key key = static_cast<Key>(value);
+  if (std::is_signed<T>::value) {
+    key ^= static_cast<Key>(Key{1} << (kBitsPerByte * sizeof(T) - 1));
+  }
+  return key;
+}
+
+template <typename T>
+T FromSortKey(typename std::make_unsigned<T>::type key) {
+  return static_cast<T>(ToSortKey(static_cast<T>(key)));
+}
+
+// Sorts 8- and 16-bit integers by counting the occurrences of each value.
+template <typename T>
+void CountingSort(T* data, size_t length) {
+  using Key = typename std::make_unsigned<T>::type;
+  constexpr size_t kNumberOfKeys = size_t{1} << (kBitsPerByte * sizeof(T));
+  std::vector<size_t> counts(kNumberOfKeys);
+  for (size_t i = 0; i < length; i++) counts[ToSortKey(data[i])]++;
+  T* out = data;
+  for (size_t key = 0; key < kNumberOfKeys; key++) {
+    out = std::fill_n(out, counts[key], FromSortKey<T>(static_cast<Key>(key)));
+  }
+  DCHECK_EQ(data + length, out);
+}
+
+// Sorts 32-bit integers with a least significant digit first radix sort on
+// bytes. Passes in which all keys have the same digit are skipped.
+template <typename T>
+void RadixSort(T* data, size_t length) {
+  using Key = typename std::make_unsigned<T>::type;
+  constexpr int kDigitBits = kBitsPerByte;
+  constexpr size_t kNumberOfDigits = size_t{1} << kDigitBits;
+  std::vector<Key> keys(length);
+  std::vector<Key> scratch(length);
+  for (size_t i = 0; i < length; i++) keys[i] = ToSortKey(data[i]);
+  for (int shift = 0; shift < static_cast<int>(kBitsPerByte * sizeof(T));
+       shift += kDigitBits) {
+    size_t offsets[kNumberOfDigits] = {0};
+    for (Key key : keys) offsets[(key >> shift) & (kNumberOfDigits - 1)]++;
+    if (std::find(std::begin(offsets), std::end(offsets), length) !=
+        std::end(offsets)) {
+      continue;
+    }
+    size_t offset = 0;
+    for (size_t& count : offsets) {
+      size_t next = offset + count;
+      count = offset;
+      offset = next;
+    }
+    for (Key key : keys) {
+      scratch[offsets[(key >> shift) & (kNumberOfDigits - 1)]++] = key;
+    }
+    keys.swap(scratch);
+  }
+  for (size_t i = 0; i < length; i++) data[i] = FromSortKey<T>(keys[i]);
+}
+
+// Sorts {data} without comparisons if that is faster than std::sort for its
+// element type and length. Returns false if {data} still needs to be sorted.
+template <typename T>
+bool TrySortWithoutComparisons(T* data, size_t length) {
+  return false;
+}
+
+// Below the minimum lengths, clearing and scanning the counts costs more than
+// the comparisons that are saved.
+#define SORT_WITHOUT_COMPARISONS(ctype, Sort, min_length)      \
+  template <>                                                  \
+  bool TrySortWithoutComparisons(ctype* data, size_t length) { \
+    if (length < min_length) return false;                     \
+    Sort(data, length);                                        \
+    return true;                                               \
+  }
+SORT_WITHOUT_COMPARISONS(int8_t, CountingSort, 256)
+SORT_WITHOUT_COMPARISONS(uint8_t, CountingSort, 256)
+SORT_WITHOUT_COMPARISONS(int16_t, CountingSort, 8192)
+SORT_WITHOUT_COMPARISONS(uint16_t, CountingSort, 8192)
+SORT_WITHOUT_COMPARISONS(int32_t, RadixSort, 256)
+SORT_WITHOUT_COMPARISONS(uint32_t, RadixSort, 256)
+#undef SORT_WITHOUT_COMPARISONS
+
 }  // namespace
 
 RUNTIME_FUNCTION(Runtime_TypedArraySortFast) {
@@ -132,7 +218,7 @@ RUNTIME_FUNCTION(Runtime_TypedArraySortFast) {
         /* TODO(ishell, v8:8875): See UnalignedSlot<T> for details. */     \
         std::sort(UnalignedSlot<ctype>(data),                              \
                   UnalignedSlot<ctype>(data + length));                    \
-      } else {                                                             \
+      } else if (!TrySortWithoutComparisons(data, length)) {               \
         std::sort(data, data + length);                                    \
       }                                                                    \
     }                                                                      \
@@ -34,6 +34,68 @@ ScriptData::ScriptData(const byte* data, int length)
   }
 }
 
+namespace {
+
+// Makes functions whose bytecode has not been executed for a while look
+// uncompiled for the duration of the scope, so that they are not included in
+// a code cache. Repeatedly producing caches after running the script lets the
+// cache converge on the functions that are really used, even if the script was
+// compiled eagerly. Controlled by --code-cache-trim-bytecode-age.
+class TrimColdFunctionsScope final {
+ public:
+  TrimColdFunctionsScope(Isolate* isolate, Handle<Script> script,
+                         Handle<SharedFunctionInfo> root) {
+    if (FLAG_code_cache_trim_bytecode_age <= 0) return;
+    std::vector<Handle<SharedFunctionInfo>> cold;
+    {
+      SharedFunctionInfo::ScriptIterator iter(isolate, *script);
+      for (SharedFunctionInfo sfi = iter.Next(); !sfi.is_null();
+           sfi = iter.Next()) {
+        if (sfi == *root || sfi.HasDebugInfo()) continue;
+        if (!sfi.function_data().IsBytecodeArray()) continue;
+        if (!sfi.CanDiscardCompiled()) continue;
+        if (sfi.GetBytecodeArray().bytecode_age() <
+            FLAG_code_cache_trim_bytecode_age) {
+          continue;
+        }
+        cold.push_back(handle(sfi, isolate));
+      }
+    }
+    for (Handle<SharedFunctionInfo> sfi : cold) {
+      Handle<UncompiledData> data =
+          isolate->factory()->NewUncompiledDataWithoutPreparseData(
+              handle(sfi->inferred_name(), isolate), sfi->StartPosition(),
+              sfi->EndPosition());
+      trimmed_.push_back(
+          {sfi, handle(sfi->function_data(), isolate),
+           handle(sfi->raw_outer_scope_info_or_feedback_metadata(), isolate)});
+      sfi->DiscardCompiledMetadata(isolate);
+      sfi->set_function_data(*data);
+    }
+  }
+
+  ~TrimColdFunctionsScope() {
+    for (const TrimmedFunction& function : trimmed_) {
+      function.sfi->set_raw_outer_scope_info_or_feedback_metadata(
+          *function.outer_scope_info_or_feedback_metadata);
+      function.sfi->set_function_data(*function.function_data);
+    }
+  }
+
+ private:
+  struct TrimmedFunction {
+    Handle<SharedFunctionInfo> sfi;
+    Handle<Object> function_data;
+    Handle<HeapObject> outer_scope_info_or_feedback_metadata;
+  };
+
+  std::vector<TrimmedFunction> trimmed_;
+
+  DISALLOW_COPY_AND_ASSIGN(TrimColdFunctionsScope);
+};
+
+}  // namespace
+
 CodeSerializer::CodeSerializer(Isolate* isolate, uint32_t source_hash)
     : Serializer(isolate, Snapshot::kDefaultSerializerFlags),
       source_hash_(source_hash) {
@@ -62,6 +124,8 @@ ScriptCompiler::CachedData* CodeSerializer::Serialize(
   // context independent.
   if (script->ContainsAsmModule()) return nullptr;
 
+  TrimColdFunctionsScope trim_cold_functions(isolate, script, info);
+
   // Serialize code object.
   Handle<String> source(String::cast(script->source()), isolate);
   CodeSerializer cs(isolate, SerializedCodeData::SourceHash(
@@ -293,6 +357,68 @@ class StressOffThreadDeserializeThread final : public base::Thread {
   const SerializedCodeData* scd_;
   OffThreadTransferMaybeHandle<SharedFunctionInfo> maybe_result_;
 };
+
+void FinalizeDeserialization(Isolate* isolate,
+                             Handle<SharedFunctionInfo> result,
+                             const base::ElapsedTimer& timer) {
+  const bool log_code_creation =
+      isolate->logger()->is_listening_to_code_events() ||
+      isolate->is_profiling() ||
+      isolate->code_event_dispatcher()->IsListeningToCodeEvents();
+
+#ifndef V8_TARGET_ARCH_ARM
+  if (V8_UNLIKELY(FLAG_interpreted_frames_native_stack))
+    CreateInterpreterDataForDeserializedCode(isolate, result,
+                                             log_code_creation);
+#endif  // V8_TARGET_ARCH_ARM
+
+  bool needs_source_positions = isolate->NeedsSourcePositionsForProfiling();
+
+  if (log_code_creation || FLAG_log_function_events) {
+    Handle<Script> script(Script::cast(result->script()), isolate);
+    Handle<String> name(script->name().IsString()
+                            ? String::cast(script->name())
+                            : ReadOnlyRoots(isolate).empty_string(),
+                        isolate);
+
+    if (FLAG_log_function_events) {
+      LOG(isolate,
+          FunctionEvent("deserialize", script->id(),
+                        timer.Elapsed().InMillisecondsF(),
+                        result->StartPosition(), result->EndPosition(), *name));
+    }
+    if (log_code_creation) {
+      Script::InitLineEnds(isolate, script);
+
+      SharedFunctionInfo::ScriptIterator iter(isolate, *script);
+      for (SharedFunctionInfo info = iter.Next(); !info.is_null();
+           info = iter.Next()) {
+        if (info.is_compiled()) {
+          Handle<SharedFunctionInfo> shared_info(info, isolate);
+          if (needs_source_positions) {
+            SharedFunctionInfo::EnsureSourcePositionsAvailable(isolate,
+                                                               shared_info);
+          }
+          DisallowHeapAllocation no_gc;
+          int line_num =
+              script->GetLineNumber(shared_info->StartPosition()) + 1;
+          int column_num =
+              script->GetColumnNumber(shared_info->StartPosition()) + 1;
+          PROFILE(isolate,
+                  CodeCreateEvent(CodeEventListener::SCRIPT_TAG,
+                                  handle(shared_info->abstract_code(), isolate),
+                                  shared_info, name, line_num, column_num));
+        }
+      }
+    }
+  }
+
+  if (needs_source_positions) {
+    Handle<Script> script(Script::cast(result->script()), isolate);
+    Script::InitLineEnds(isolate, script);
+  }
+}
+
 }  // namespace
 
 MaybeHandle<SharedFunctionInfo> CodeSerializer::Deserialize(
@@ -354,62 +480,79 @@ MaybeHandle<SharedFunctionInfo> CodeSerializer::Deserialize(
     PrintF("[Deserializing from %d bytes took %0.3f ms]\n", length, ms);
   }
 
-  const bool log_code_creation =
-      isolate->logger()->is_listening_to_code_events() ||
-      isolate->is_profiling() ||
-      isolate->code_event_dispatcher()->IsListeningToCodeEvents();
+  FinalizeDeserialization(isolate, result, timer);
 
-#ifndef V8_TARGET_ARCH_ARM
-  if (V8_UNLIKELY(FLAG_interpreted_frames_native_stack))
-    CreateInterpreterDataForDeserializedCode(isolate, result,
-                                             log_code_creation);
-#endif  // V8_TARGET_ARCH_ARM
+  return scope.CloseAndEscape(result);
+}
 
-  bool needs_source_positions = isolate->NeedsSourcePositionsForProfiling();
+// static
+OffThreadDeserializeData CodeSerializer::StartDeserializeOffThread(
+    OffThreadIsolate* isolate, ScriptData* cached_data) {
+  OffThreadDeserializeData result;
+  isolate->PinToCurrentThread();
+
+  const SerializedCodeData scd =
+      SerializedCodeData::FromCachedDataWithoutSource(
+          cached_data, &result.sanity_check_result);
+  if (result.sanity_check_result == SerializedCodeData::CHECK_SUCCESS) {
+    // The script source is fixed up in FinishOffThreadDeserialize.
+    MaybeHandle<SharedFunctionInfo> maybe_result =
+        ObjectDeserializer::DeserializeSharedFunctionInfoOffThread(
+            isolate, &scd, isolate->factory()->empty_string());
+    result.maybe_result = isolate->TransferHandle(maybe_result);
+  }
 
-  if (log_code_creation || FLAG_log_function_events) {
-    Handle<Script> script(Script::cast(result->script()), isolate);
-    Handle<String> name(script->name().IsString()
-                            ? String::cast(script->name())
-                            : ReadOnlyRoots(isolate).empty_string(),
-                        isolate);
+  isolate->FinishOffThread();
+  return result;
+}
 
-    if (FLAG_log_function_events) {
-      LOG(isolate,
-          FunctionEvent("deserialize", script->id(),
-                        timer.Elapsed().InMillisecondsF(),
-                        result->StartPosition(), result->EndPosition(), *name));
-    }
-    if (log_code_creation) {
-      Script::InitLineEnds(isolate, script);
+// static
+MaybeHandle<SharedFunctionInfo> CodeSerializer::FinishOffThreadDeserialize(
+    Isolate* isolate, OffThreadIsolate* off_thread_isolate,
+    OffThreadDeserializeData&& data, ScriptData* cached_data,
+    Handle<String> source, ScriptOriginOptions origin_options) {
+  base::ElapsedTimer timer;
+  if (FLAG_profile_deserialization || FLAG_log_function_events) timer.Start();
 
-      SharedFunctionInfo::ScriptIterator iter(isolate, *script);
-      for (SharedFunctionInfo info = iter.Next(); !info.is_null();
-           info = iter.Next()) {
-        if (info.is_compiled()) {
-          Handle<SharedFunctionInfo> shared_info(info, isolate);
-          if (needs_source_positions) {
-            SharedFunctionInfo::EnsureSourcePositionsAvailable(isolate,
-                                                               shared_info);
-          }
-          DisallowHeapAllocation no_gc;
-          int line_num =
-              script->GetLineNumber(shared_info->StartPosition()) + 1;
-          int column_num =
-              script->GetColumnNumber(shared_info->StartPosition()) + 1;
-          PROFILE(isolate,
-                  CodeCreateEvent(CodeEventListener::SCRIPT_TAG,
-                                  handle(shared_info->abstract_code(), isolate),
-                                  shared_info, name, line_num, column_num));
-        }
-      }
-    }
+  HandleScope scope(isolate);
+
+  // Make everything that was allocated off-thread visible to the GC, even if
+  // the result ends up being rejected.
+  off_thread_isolate->Publish(isolate);
+
+  SerializedCodeData::SanityCheckResult sanity_check_result =
+      data.sanity_check_result;
+  SerializedCodeData::FromPartiallySanityCheckedCachedData(
+      cached_data, SerializedCodeData::SourceHash(source, origin_options),
+      &sanity_check_result);
+  if (sanity_check_result != SerializedCodeData::CHECK_SUCCESS) {
+    if (FLAG_profile_deserialization) PrintF("[Cached code failed check]\n");
+    DCHECK(cached_data->rejected());
+    isolate->counters()->code_cache_reject_reason()->AddSample(
+        sanity_check_result);
+    return MaybeHandle<SharedFunctionInfo>();
   }
 
-  if (needs_source_positions) {
-    Handle<Script> script(Script::cast(result->script()), isolate);
-    Script::InitLineEnds(isolate, script);
+  Handle<SharedFunctionInfo> result;
+  if (!data.maybe_result.ToHandle().ToHandle(&result)) {
+    // Deserializing may fail if the reservations cannot be fulfilled.
+    if (FLAG_profile_deserialization) PrintF("[Deserializing failed]\n");
+    return MaybeHandle<SharedFunctionInfo>();
+  }
+
+  // Fix-up result script source.
+  Script::cast(result->script()).set_source(*source);
+
+  if (FLAG_profile_deserialization) {
+    double ms = timer.Elapsed().InMillisecondsF();
+    int length = cached_data->length();
+    PrintF("[Finishing off-thread deserialization from %d bytes took %0.3f "
+           "ms]\n",
+           length, ms);
   }
+
+  FinalizeDeserialization(isolate, result, timer);
+
   return scope.CloseAndEscape(result);
 }
 
@@ -461,16 +604,28 @@ SerializedCodeData::SerializedCodeData(const std::vector<byte>* payload,
 
 SerializedCodeData::SanityCheckResult SerializedCodeData::SanityCheck(
     uint32_t expected_source_hash) const {
+  SanityCheckResult result = SanityCheckWithoutSource();
+  if (result != CHECK_SUCCESS) return result;
+  return SanityCheckJustSource(expected_source_hash);
+}
+
+SerializedCodeData::SanityCheckResult SerializedCodeData::SanityCheckJustSource(
+    uint32_t expected_source_hash) const {
+  uint32_t source_hash = GetHeaderValue(kSourceHashOffset);
+  if (source_hash != expected_source_hash) return SOURCE_MISMATCH;
+  return CHECK_SUCCESS;
+}
+
+SerializedCodeData::SanityCheckResult
+SerializedCodeData::SanityCheckWithoutSource() const {
   if (this->size_ < kHeaderSize) return INVALID_HEADER;
   uint32_t magic_number = GetMagicNumber();
   if (magic_number != kMagicNumber) return MAGIC_NUMBER_MISMATCH;
   uint32_t version_hash = GetHeaderValue(kVersionHashOffset);
-  uint32_t source_hash = GetHeaderValue(kSourceHashOffset);
   uint32_t flags_hash = GetHeaderValue(kFlagHashOffset);
   uint32_t payload_length = GetHeaderValue(kPayloadLengthOffset);
   uint32_t c = GetHeaderValue(kChecksumOffset);
   if (version_hash != Version::Hash()) return VERSION_MISMATCH;
-  if (source_hash != expected_source_hash) return SOURCE_MISMATCH;
   if (flags_hash != FlagList::Hash()) return FLAGS_MISMATCH;
   uint32_t max_payload_length =
       this->size_ -
@@ -538,5 +693,37 @@ SerializedCodeData SerializedCodeData::FromCachedData(
   return scd;
 }
 
+SerializedCodeData SerializedCodeData::FromCachedDataWithoutSource(
+    ScriptData* cached_data, SanityCheckResult* rejection_result) {
+  DisallowHeapAllocation no_gc;
+  SerializedCodeData scd(cached_data);
+  *rejection_result = scd.SanityCheckWithoutSource();
+  if (*rejection_result != CHECK_SUCCESS) {
+    cached_data->Reject();
+    return SerializedCodeData(nullptr, 0);
+  }
+  return scd;
+}
+
+SerializedCodeData SerializedCodeData::FromPartiallySanityCheckedCachedData(
+    ScriptData* cached_data, uint32_t expected_source_hash,
+    SanityCheckResult* rejection_result) {
+  DisallowHeapAllocation no_gc;
+  // The previous call to FromCachedDataWithoutSource may have already rejected
+  // the cached data, so re-use the previous rejection result if it's not a
+  // success.
+  if (*rejection_result != CHECK_SUCCESS) {
+    DCHECK(cached_data->rejected());
+    return SerializedCodeData(nullptr, 0);
+  }
+  SerializedCodeData scd(cached_data);
+  *rejection_result = scd.SanityCheckJustSource(expected_source_hash);
+  if (*rejection_result != CHECK_SUCCESS) {
+    cached_data->Reject();
+    return SerializedCodeData(nullptr, 0);
+  }
+  return scd;
+}
+
 }  // namespace internal
 }  // namespace v8
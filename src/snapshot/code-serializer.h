@@ -6,11 +6,14 @@
 #define V8_SNAPSHOT_CODE_SERIALIZER_H_
 
 #include "src/base/macros.h"
+#include "src/execution/off-thread-isolate.h"
 #include "src/snapshot/serializer.h"
 
 namespace v8 {
 namespace internal {
 
+class OffThreadDeserializeData;
+
 class V8_EXPORT_PRIVATE ScriptData {
  public:
   ScriptData(const byte* data, int length);
@@ -54,6 +57,21 @@ class CodeSerializer : public Serializer {
       Isolate* isolate, ScriptData* cached_data, Handle<String> source,
       ScriptOriginOptions origin_options);
 
+  // Sanity checks and deserializes |cached_data| into |isolate|. Can be
+  // called on any thread. The source hash can only be checked once the source
+  // is known, in FinishOffThreadDeserialize.
+  V8_WARN_UNUSED_RESULT static OffThreadDeserializeData
+  StartDeserializeOffThread(OffThreadIsolate* isolate, ScriptData* cached_data);
+
+  // Publishes the objects deserialized in |off_thread_isolate| and finishes
+  // deserialization on the main thread.
+  V8_WARN_UNUSED_RESULT static MaybeHandle<SharedFunctionInfo>
+  FinishOffThreadDeserialize(Isolate* isolate,
+                             OffThreadIsolate* off_thread_isolate,
+                             OffThreadDeserializeData&& data,
+                             ScriptData* cached_data, Handle<String> source,
+                             ScriptOriginOptions origin_options);
+
   uint32_t source_hash() const { return source_hash_; }
 
  protected:
@@ -112,6 +130,13 @@ class SerializedCodeData : public SerializedData {
   static SerializedCodeData FromCachedData(ScriptData* cached_data,
                                            uint32_t expected_source_hash,
                                            SanityCheckResult* rejection_result);
+  // Used when consuming off-thread, where the source is not known yet. The
+  // source hash is checked by FromPartiallySanityCheckedCachedData later.
+  static SerializedCodeData FromCachedDataWithoutSource(
+      ScriptData* cached_data, SanityCheckResult* rejection_result);
+  static SerializedCodeData FromPartiallySanityCheckedCachedData(
+      ScriptData* cached_data, uint32_t expected_source_hash,
+      SanityCheckResult* rejection_result);
 
   // Used when producing.
   SerializedCodeData(const std::vector<byte>* payload,
@@ -136,6 +161,19 @@ class SerializedCodeData : public SerializedData {
   }
 
   SanityCheckResult SanityCheck(uint32_t expected_source_hash) const;
+  SanityCheckResult SanityCheckJustSource(uint32_t expected_source_hash) const;
+  SanityCheckResult SanityCheckWithoutSource() const;
+};
+
+// The result of CodeSerializer::StartDeserializeOffThread, to be passed to
+// CodeSerializer::FinishOffThreadDeserialize.
+class OffThreadDeserializeData {
+ private:
+  friend class CodeSerializer;
+
+  OffThreadTransferMaybeHandle<SharedFunctionInfo> maybe_result;
+  SerializedCodeData::SanityCheckResult sanity_check_result =
+      SerializedCodeData::CHECK_SUCCESS;
 };
 
 }  // namespace internal
@@ -4,6 +4,9 @@
 
 #include "src/snapshot/embedded/embedded-data.h"
 
+#include <numeric>
+
+#include "src/builtins/profile-data-reader.h"
 #include "src/codegen/assembler-inl.h"
 #include "src/codegen/callable.h"
 #include "src/objects/objects-inl.h"
@@ -25,7 +28,9 @@ Code InstructionStream::TryLookupCode(Isolate* isolate, Address address) {
   if (!PcIsOffHeap(isolate, address)) return Code();
 
   EmbeddedData d = EmbeddedData::FromBlob();
-  if (address < d.InstructionStartOfBuiltin(0)) return Code();
+  if (address < d.InstructionStartOfBuiltin(d.BuiltinAtLayoutPosition(0))) {
+    return Code();
+  }
 
   // Note: Addresses within the padding section between builtins (i.e. within
   // start + size <= address < start + padded_size) are interpreted as belonging
@@ -34,15 +39,16 @@ Code InstructionStream::TryLookupCode(Isolate* isolate, Address address) {
   int l = 0, r = Builtins::builtin_count;
   while (l < r) {
     const int mid = (l + r) / 2;
-    Address start = d.InstructionStartOfBuiltin(mid);
-    Address end = start + d.PaddedInstructionSizeOfBuiltin(mid);
+    const int builtin = d.BuiltinAtLayoutPosition(mid);
+    Address start = d.InstructionStartOfBuiltin(builtin);
+    Address end = start + d.PaddedInstructionSizeOfBuiltin(builtin);
 
     if (address < start) {
       r = mid;
     } else if (address >= end) {
       l = mid + 1;
     } else {
-      return isolate->builtins()->builtin(mid);
+      return isolate->builtins()->builtin(builtin);
     }
   }
 
@@ -198,6 +204,33 @@ void FinalizeEmbeddedCodeTargets(Isolate* isolate, EmbeddedData* blob) {
   }
 }
 
+// Returns the builtin ids in the order in which their instruction streams are
+// laid out in the blob. By default this is id order. With --reorder-builtins
+// and a profile passed in --turbo-profiling-log-file, builtins that executed
+// during profiling come first, hottest first, so that hot code shares as few
+// pages and cache lines as possible. Bytecode handlers always stay at the end
+// in id order since frames.cc expects them to be contiguous.
+std::vector<uint32_t> ComputeBuiltinLayoutOrder() {
+  std::vector<uint32_t> order(Builtins::builtin_count);
+  std::iota(order.begin(), order.end(), 0);
+  if (!FLAG_reorder_builtins || FLAG_turbo_profiling_log_file == nullptr) {
+    return order;
+  }
+
+  std::vector<uint64_t> hotness(Builtins::kFirstBytecodeHandler, 0);
+  for (int i = 0; i < Builtins::kFirstBytecodeHandler; i++) {
+    const ProfileDataFromFile* profile_data =
+        ProfileDataFromFile::TryRead(Builtins::name(i));
+    if (profile_data != nullptr) hotness[i] = profile_data->GetTotalCount();
+  }
+  std::stable_sort(order.begin(),
+                   order.begin() + Builtins::kFirstBytecodeHandler,
+                   [&hotness](uint32_t a, uint32_t b) {
+                     return hotness[a] > hotness[b];
+                   });
+  return order;
+}
+
 }  // namespace
 
 // static
@@ -206,10 +239,13 @@ EmbeddedData EmbeddedData::FromIsolate(Isolate* isolate) {
 
   // Store instruction stream lengths and offsets.
   std::vector<struct Metadata> metadata(kTableSize);
+  const std::vector<uint32_t> layout_order = ComputeBuiltinLayoutOrder();
+  DCHECK_EQ(kTableSize, layout_order.size());
 
   bool saw_unsafe_builtin = false;
   uint32_t raw_code_size = 0;
-  for (int i = 0; i < Builtins::builtin_count; i++) {
+  for (uint32_t id : layout_order) {
+    const int i = static_cast<int>(id);
     Code code = builtins->builtin(i);
 
     if (Builtins::IsIsolateIndependent(i)) {
@@ -246,8 +282,7 @@ EmbeddedData EmbeddedData::FromIsolate(Isolate* isolate) {
   const uint32_t blob_code_size = RawCodeOffset() + raw_code_size;
   uint8_t* const blob_code = new uint8_t[blob_code_size];
   uint8_t* const raw_code_start = blob_code + RawCodeOffset();
-  const uint32_t blob_metadata_size =
-      MetadataTableOffset() + MetadataTableSize();
+  const uint32_t blob_metadata_size = LayoutTableOffset() + LayoutTableSize();
   uint8_t* const blob_metadata = new uint8_t[blob_metadata_size];
 
   // Initially zap the entire blob, effectively padding the alignment area
@@ -265,6 +300,9 @@ EmbeddedData EmbeddedData::FromIsolate(Isolate* isolate) {
   DCHECK_EQ(MetadataTableSize(), sizeof(metadata[0]) * metadata.size());
   std::memcpy(blob_metadata + MetadataTableOffset(), metadata.data(),
               MetadataTableSize());
+  DCHECK_EQ(LayoutTableSize(), sizeof(layout_order[0]) * layout_order.size());
+  std::memcpy(blob_metadata + LayoutTableOffset(), layout_order.data(),
+              LayoutTableSize());
 
   // Write the raw data section.
   for (int i = 0; i < Builtins::builtin_count; i++) {
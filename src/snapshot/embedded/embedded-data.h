@@ -77,6 +77,15 @@ class EmbeddedData final {
 
   bool ContainsBuiltin(int i) const { return InstructionSizeOfBuiltin(i) > 0; }
 
+  // Returns the id of the builtin whose instruction stream is the
+  // {position}th one in the blob. Instruction start addresses are
+  // non-decreasing in layout order, but not necessarily in id order.
+  int BuiltinAtLayoutPosition(int position) const {
+    DCHECK_LE(0, position);
+    DCHECK_LT(position, Builtins::builtin_count);
+    return static_cast<int>(LayoutTable()[position]);
+  }
+
   uint32_t AddressForHashing(Address addr) {
     Address start = reinterpret_cast<Address>(code_);
     DCHECK(base::IsInRange(addr, start, start + code_size_));
@@ -115,6 +124,8 @@ class EmbeddedData final {
   // [1] hash of embedded-blob-relevant heap objects
   // [2] metadata of instruction stream 0
   // ... metadata
+  // [3] id of the builtin laid out first
+  // ... builtin ids in layout order
   //
   // code:
   // [0] instruction streams 0
@@ -133,6 +144,12 @@ class EmbeddedData final {
   static constexpr uint32_t MetadataTableSize() {
     return sizeof(struct Metadata) * kTableSize;
   }
+  static constexpr uint32_t LayoutTableOffset() {
+    return MetadataTableOffset() + MetadataTableSize();
+  }
+  static constexpr uint32_t LayoutTableSize() {
+    return kUInt32Size * kTableSize;
+  }
   static constexpr uint32_t RawCodeOffset() { return 0; }
 
  private:
@@ -152,6 +169,9 @@ class EmbeddedData final {
     return reinterpret_cast<const struct Metadata*>(metadata_ +
                                                     MetadataTableOffset());
   }
+  const uint32_t* LayoutTable() const {
+    return reinterpret_cast<const uint32_t*>(metadata_ + LayoutTableOffset());
+  }
   const uint8_t* RawCode() const { return code_ + RawCodeOffset(); }
 
   static constexpr int PadAndAlign(int size) {
@@ -180,7 +180,8 @@ class EmbeddedFileWriter : public EmbeddedFileWriterInterface {
     w->AlignToCodeAlignment();
     w->DeclareLabel(EmbeddedBlobCodeDataSymbol().c_str());
 
-    for (int i = 0; i < i::Builtins::builtin_count; i++) {
+    for (int p = 0; p < i::Builtins::builtin_count; p++) {
+      const int i = blob->BuiltinAtLayoutPosition(p);
       if (!blob->ContainsBuiltin(i)) continue;
 
       WriteBuiltin(w, blob, i);
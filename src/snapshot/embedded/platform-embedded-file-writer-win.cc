@@ -110,7 +110,9 @@ void EmitUnwindData(PlatformEmbeddedFileWriterWin* w,
   w->StartPdataSection();
   {
     Address prev_builtin_end_offset = 0;
-    for (int i = 0; i < Builtins::builtin_count; i++) {
+    for (int j = 0; j < Builtins::builtin_count; j++) {
+      // PDATA entries must be sorted by address.
+      const int i = blob->BuiltinAtLayoutPosition(j);
       // Some builtins are leaf functions from the point of view of Win64 stack
       // walking: they do not move the stack pointer and do not require a PDATA
       // entry because the return address can be retrieved from [rsp].
@@ -193,7 +195,9 @@ void EmitUnwindData(PlatformEmbeddedFileWriterWin* w,
   std::vector<int> code_chunks;
   std::vector<win64_unwindinfo::FrameOffsets> fp_adjustments;
 
-  for (int i = 0; i < Builtins::builtin_count; i++) {
+  for (int p = 0; p < Builtins::builtin_count; p++) {
+    // PDATA entries must be sorted by address.
+    const int i = blob->BuiltinAtLayoutPosition(p);
     if (!blob->ContainsBuiltin(i)) continue;
     if (unwind_infos[i].is_leaf_function()) continue;
 
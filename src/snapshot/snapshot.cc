@@ -6,9 +6,16 @@
 
 #include "src/snapshot/snapshot.h"
 
+#include <atomic>
+
+#include "include/v8-platform.h"
+#include "src/base/optional.h"
+#include "src/base/platform/mutex.h"
 #include "src/base/platform/platform.h"
+#include "src/base/platform/semaphore.h"
 #include "src/execution/isolate-inl.h"
 #include "src/init/bootstrapper.h"
+#include "src/init/v8.h"
 #include "src/logging/counters.h"
 #include "src/objects/js-regexp-inl.h"
 #include "src/snapshot/context-deserializer.h"
@@ -112,6 +119,70 @@ SnapshotData MaybeDecompress(const Vector<const byte>& snapshot_data) {
 #endif
 }
 
+#ifdef V8_SNAPSHOT_COMPRESSION
+namespace {
+
+// Decompresses a snapshot on a worker thread while the main thread is busy
+// with another one. If no worker has picked up the job by the time the result
+// is requested, the main thread decompresses it itself.
+class BackgroundDecompression final {
+ public:
+  explicit BackgroundDecompression(Vector<const byte> compressed_data)
+      : state_(std::make_shared<State>(compressed_data)) {
+    V8::GetCurrentPlatform()->CallOnWorkerThread(
+        std::make_unique<DecompressTask>(state_));
+  }
+
+  SnapshotData Get() {
+    if (state_->TryClaim()) {
+      state_->Run();
+    } else {
+      state_->done.Wait();
+    }
+    return std::move(*state_->result);
+  }
+
+ private:
+  struct State {
+    explicit State(Vector<const byte> compressed_data)
+        : compressed_data(compressed_data) {}
+
+    bool TryClaim() {
+      return !claimed.exchange(true, std::memory_order_relaxed);
+    }
+
+    void Run() {
+      result = std::make_unique<SnapshotData>(
+          SnapshotCompression::Decompress(compressed_data));
+    }
+
+    const Vector<const byte> compressed_data;
+    std::atomic<bool> claimed{false};
+    base::Semaphore done{0};
+    std::unique_ptr<SnapshotData> result;
+  };
+
+  class DecompressTask final : public v8::Task {
+   public:
+    explicit DecompressTask(std::shared_ptr<State> state)
+        : state_(std::move(state)) {}
+
+    void Run() final {
+      if (!state_->TryClaim()) return;
+      state_->Run();
+      state_->done.Signal();
+    }
+
+   private:
+    std::shared_ptr<State> state_;
+  };
+
+  std::shared_ptr<State> state_;
+};
+
+}  // namespace
+#endif  // V8_SNAPSHOT_COMPRESSION
+
 #ifdef DEBUG
 bool Snapshot::SnapshotIsValid(const v8::StartupData* snapshot_blob) {
   return SnapshotImpl::ExtractNumContexts(snapshot_blob) > 0;
@@ -152,8 +223,27 @@ bool Snapshot::Initialize(Isolate* isolate) {
   Vector<const byte> startup_data = SnapshotImpl::ExtractStartupData(blob);
   Vector<const byte> read_only_data = SnapshotImpl::ExtractReadOnlyData(blob);
 
+#ifdef V8_SNAPSHOT_COMPRESSION
+  base::ElapsedTimer decompression_timer;
+  decompression_timer.Start();
+  // The read-only snapshot is inflated on a worker thread while the main
+  // thread inflates the startup snapshot.
+  base::Optional<BackgroundDecompression> read_only_decompression;
+  if (FLAG_parallel_snapshot_decompression) {
+    read_only_decompression.emplace(read_only_data);
+  }
+#endif  // V8_SNAPSHOT_COMPRESSION
+
   SnapshotData startup_snapshot_data(MaybeDecompress(startup_data));
+#ifdef V8_SNAPSHOT_COMPRESSION
+  SnapshotData read_only_snapshot_data(read_only_decompression
+                                           ? read_only_decompression->Get()
+                                           : MaybeDecompress(read_only_data));
+  isolate->startup_metrics()->snapshot_decompression_wall_clock_duration_in_us =
+      decompression_timer.Elapsed().InMicroseconds();
+#else
   SnapshotData read_only_snapshot_data(MaybeDecompress(read_only_data));
+#endif  // V8_SNAPSHOT_COMPRESSION
 
   StartupDeserializer startup_deserializer(&startup_snapshot_data);
   ReadOnlyDeserializer read_only_deserializer(&read_only_snapshot_data);
@@ -202,7 +292,8 @@ MaybeHandle<Context> Snapshot::NewContextFromSnapshot(
 
 // static
 void Snapshot::ClearReconstructableDataForSerialization(
-    Isolate* isolate, bool clear_recompilable_data) {
+    Isolate* isolate, bool clear_recompilable_data, bool keep_feedback) {
+  DCHECK_IMPLIES(keep_feedback, !clear_recompilable_data);
   // Clear SFIs and JSRegExps.
 
   if (clear_recompilable_data) {
@@ -257,6 +348,17 @@ void Snapshot::ClearReconstructableDataForSerialization(
     // other hand, only checking for the feedback vector is not sufficient
     // because there can be multiple functions sharing the same feedback
     // vector. So we need all these checks.
+    if (keep_feedback && fun.has_feedback_vector() &&
+        fun.shared().HasBytecodeArray()) {
+      // Keep the feedback vector so that invocation counts and profiler ticks
+      // collected while warming up survive, and the function tiers up early
+      // after deserialization. Optimized code cannot be serialized, so fall
+      // back to the bytecode. Feedback slots are cleared by the
+      // ContextSerializer.
+      fun.feedback_vector().SetOptimizationMarker(OptimizationMarker::kNone);
+      fun.set_code(fun.shared().GetCode());
+      continue;
+    }
     if (fun.IsOptimized() || fun.IsInterpreted() ||
         !fun.raw_feedback_cell().value().IsUndefined()) {
       fun.raw_feedback_cell().set_value(
@@ -529,17 +631,48 @@ uint32_t SnapshotImpl::ExtractNumContexts(const v8::StartupData* data) {
   return num_contexts;
 }
 
+namespace {
+
+// Embedders that create many isolates from the same blob only need to pay for
+// checksum verification once. Remember the last blob that passed, keyed by
+// its location, size and expected checksum.
+struct VerifiedBlob {
+  const char* data = nullptr;
+  int raw_size = 0;
+  uint32_t checksum = 0;
+};
+
+base::LazyMutex verified_blob_mutex = LAZY_MUTEX_INITIALIZER;
+VerifiedBlob verified_blob;
+
+}  // namespace
+
 bool Snapshot::VerifyChecksum(const v8::StartupData* data) {
-  base::ElapsedTimer timer;
-  if (FLAG_profile_deserialization) timer.Start();
   uint32_t expected =
       SnapshotImpl::GetHeaderValue(data, SnapshotImpl::kChecksumOffset);
+  if (FLAG_cache_snapshot_checksum) {
+    base::MutexGuard guard(verified_blob_mutex.Pointer());
+    if (verified_blob.data == data->data &&
+        verified_blob.raw_size == data->raw_size &&
+        verified_blob.checksum == expected) {
+      return true;
+    }
+  }
+  base::ElapsedTimer timer;
+  if (FLAG_profile_deserialization) timer.Start();
   uint32_t result = Checksum(SnapshotImpl::ChecksummedContent(data));
   if (FLAG_profile_deserialization) {
     double ms = timer.Elapsed().InMillisecondsF();
     PrintF("[Verifying snapshot checksum took %0.3f ms]\n", ms);
   }
-  return result == expected;
+  if (result != expected) return false;
+  if (FLAG_cache_snapshot_checksum) {
+    base::MutexGuard guard(verified_blob_mutex.Pointer());
+    verified_blob.data = data->data;
+    verified_blob.raw_size = data->raw_size;
+    verified_blob.checksum = expected;
+  }
+  return true;
 }
 
 uint32_t SnapshotImpl::ExtractContextOffset(const v8::StartupData* data,
@@ -44,9 +44,12 @@ class Snapshot : public AllStatic {
   // In preparation for serialization, clear data from the given isolate's heap
   // that 1. can be reconstructed and 2. is not suitable for serialization. The
   // `clear_recompilable_data` flag controls whether compiled objects are
-  // cleared from shared function infos and regexp objects.
+  // cleared from shared function infos and regexp objects. If
+  // `keep_feedback` is set, functions that keep their bytecode also keep
+  // their feedback vectors, minus any optimized code.
   V8_EXPORT_PRIVATE static void ClearReconstructableDataForSerialization(
-      Isolate* isolate, bool clear_recompilable_data);
+      Isolate* isolate, bool clear_recompilable_data,
+      bool keep_feedback = false);
 
   // Serializes the given isolate and contexts. Each context may have an
   // associated callback to serialize internal fields. The default context must
@@ -10,6 +10,19 @@
 namespace v8 {
 namespace internal {
 
+namespace {
+// Returns the length of the run of ASCII characters starting at {cursor} if
+// it is long enough to be worth skipping a word at a time, and 0 otherwise.
+// Only valid between complete UTF-8 sequences.
+int AsciiRunLength(const uint8_t* cursor, const uint8_t* end,
+                   unibrow::Utf8::State state) {
+  if (state != unibrow::Utf8::State::kAccept) return 0;
+  if (end - cursor < static_cast<ptrdiff_t>(kIntptrSize)) return 0;
+  if (*cursor > unibrow::Utf8::kMaxOneByteChar) return 0;
+  return NonAsciiStart(cursor, static_cast<int>(end - cursor));
+}
+}  // namespace
+
 Utf8Decoder::Utf8Decoder(const Vector<const uint8_t>& chars)
     : encoding_(Encoding::kAscii),
       non_ascii_start_(NonAsciiStart(chars.begin(), chars.length())),
@@ -24,6 +37,12 @@ Utf8Decoder::Utf8Decoder(const Vector<const uint8_t>& chars)
   unibrow::Utf8::State state = unibrow::Utf8::State::kAccept;
 
   while (cursor < end) {
+    int ascii_length = AsciiRunLength(cursor, end, state);
+    if (ascii_length > 0) {
+      utf16_length_ += ascii_length;
+      cursor += ascii_length;
+      continue;
+    }
     unibrow::uchar t =
         unibrow::Utf8::ValueOfIncremental(&cursor, &state, &incomplete_char);
     if (t != unibrow::Utf8::kIncomplete) {
@@ -55,6 +74,13 @@ void Utf8Decoder::Decode(Char* out, const Vector<const uint8_t>& data) {
   const uint8_t* end = data.begin() + data.length();
 
   while (cursor < end) {
+    int ascii_length = AsciiRunLength(cursor, end, state);
+    if (ascii_length > 0) {
+      CopyChars(out, cursor, ascii_length);
+      out += ascii_length;
+      cursor += ascii_length;
+      continue;
+    }
     unibrow::uchar t =
         unibrow::Utf8::ValueOfIncremental(&cursor, &state, &incomplete_char);
     if (t != unibrow::Utf8::kIncomplete) {
@@ -301,6 +301,18 @@ inline int CompareCharsUnsigned(const lchar* lhs, const rchar* rhs,
     // strings on little-endian systems.
     return memcmp(lhs, rhs, chars);
   }
+  if (sizeof(*lhs) == sizeof(*rhs)) {
+    // Skip the common prefix one machine word at a time. The fixed-size
+    // memcmp compiles to a single (unaligned) load and compare per side, so
+    // this only tests equality; the order of the first differing characters
+    // is decided by the loop below.
+    const size_t kCharsPerWord = sizeof(uintptr_t) / sizeof(*lhs);
+    while (lhs + kCharsPerWord <= limit &&
+           memcmp(lhs, rhs, sizeof(uintptr_t)) == 0) {
+      lhs += kCharsPerWord;
+      rhs += kCharsPerWord;
+    }
+  }
   while (lhs < limit) {
     int r = static_cast<int>(*lhs) - static_cast<int>(*rhs);
     if (r != 0) return r;
@@ -416,6 +416,13 @@ int LiftoffAssembler::PrepareStackFrame() {
 
 void LiftoffAssembler::PrepareTailCall(int num_callee_stack_params,
                                        int stack_param_delta) {
+  // If no parameters are passed on the stack, the frame can just be dropped.
+  if (num_callee_stack_params == 0 && stack_param_delta == 0) {
+    mov(sp, fp);
+    Pop(lr, fp);
+    return;
+  }
+
   UseScratchRegisterScope temps(this);
   Register scratch = temps.Acquire();
 
@@ -533,17 +540,17 @@ void LiftoffAssembler::LoadConstant(LiftoffRegister reg, WasmValue value,
   }
 }
 
-void LiftoffAssembler::LoadFromInstance(Register dst, uint32_t offset,
-                                        int size) {
+void LiftoffAssembler::LoadFromInstance(Register dst, Register instance,
+                                        uint32_t offset, int size) {
   DCHECK_LE(offset, kMaxInt);
   DCHECK_EQ(4, size);
-  ldr(dst, liftoff::GetInstanceOperand());
-  ldr(dst, MemOperand(dst, offset));
+  ldr(dst, MemOperand(instance, offset));
 }
 
 void LiftoffAssembler::LoadTaggedPointerFromInstance(Register dst,
+                                                     Register instance,
                                                      uint32_t offset) {
-  LoadFromInstance(dst, offset, kTaggedSize);
+  LoadFromInstance(dst, instance, offset, kTaggedSize);
 }
 
 void LiftoffAssembler::SpillInstance(Register instance) {
@@ -183,6 +183,13 @@ int LiftoffAssembler::PrepareStackFrame() {
 
 void LiftoffAssembler::PrepareTailCall(int num_callee_stack_params,
                                        int stack_param_delta) {
+  // If no parameters are passed on the stack, the frame can just be dropped.
+  if (num_callee_stack_params == 0 && stack_param_delta == 0) {
+    Mov(sp, fp);
+    Pop<kAuthLR>(fp, lr);
+    return;
+  }
+
   UseScratchRegisterScope temps(this);
   Register scratch = temps.AcquireX();
 
@@ -306,23 +313,22 @@ void LiftoffAssembler::LoadConstant(LiftoffRegister reg, WasmValue value,
   }
 }
 
-void LiftoffAssembler::LoadFromInstance(Register dst, uint32_t offset,
-                                        int size) {
+void LiftoffAssembler::LoadFromInstance(Register dst, Register instance,
+                                        uint32_t offset, int size) {
   DCHECK_LE(offset, kMaxInt);
-  Ldr(dst, liftoff::GetInstanceOperand());
   DCHECK(size == 4 || size == 8);
   if (size == 4) {
-    Ldr(dst.W(), MemOperand(dst, offset));
+    Ldr(dst.W(), MemOperand(instance, offset));
   } else {
-    Ldr(dst, MemOperand(dst, offset));
+    Ldr(dst, MemOperand(instance, offset));
   }
 }
 
 void LiftoffAssembler::LoadTaggedPointerFromInstance(Register dst,
+                                                     Register instance,
                                                      uint32_t offset) {
   DCHECK_LE(offset, kMaxInt);
-  Ldr(dst, liftoff::GetInstanceOperand());
-  LoadTaggedPointerField(dst, MemOperand(dst, offset));
+  LoadTaggedPointerField(dst, MemOperand(instance, offset));
 }
 
 void LiftoffAssembler::SpillInstance(Register instance) {
@@ -587,6 +587,10 @@ void LiftoffAssembler::MergeFullStackWith(const CacheState& target,
   for (uint32_t i = 0, e = source.stack_height(); i < e; ++i) {
     transfers.TransferStackSlot(target.stack_state[i], source.stack_state[i]);
   }
+  transfers.Execute();
+  if (target.cached_instance != source.cached_instance) {
+    MergeCachedInstanceWith(target);
+  }
 }
 
 void LiftoffAssembler::MergeStackWith(const CacheState& target,
@@ -611,6 +615,19 @@ void LiftoffAssembler::MergeStackWith(const CacheState& target,
     transfers.TransferStackSlot(target.stack_state[target_stack_base + i],
                                 cache_state_.stack_state[stack_base + i]);
   }
+  transfers.Execute();
+  if (target.cached_instance != cache_state_.cached_instance) {
+    MergeCachedInstanceWith(target);
+  }
+}
+
+void LiftoffAssembler::MergeCachedInstanceWith(const CacheState& target) {
+  // The target state might expect the instance in a register (e.g. a loop
+  // header). All values are in their target locations already, so that
+  // register is free to be overwritten.
+  if (target.cached_instance != no_reg) {
+    FillInstanceInto(target.cached_instance);
+  }
 }
 
 void LiftoffAssembler::Spill(VarState* slot) {
@@ -740,6 +757,9 @@ void LiftoffAssembler::PrepareCall(const FunctionSig* sig,
   // Input 0 is the call target.
   constexpr size_t kInputShift = 1;
 
+  // The cached instance does not survive the call.
+  cache_state_.ClearCachedInstanceRegister();
+
   // Spill all cache slots which are not being used as parameters.
   for (VarState* it = cache_state_.stack_state.end() - 1 - num_params;
        it >= cache_state_.stack_state.begin() &&
@@ -971,6 +991,12 @@ bool LiftoffAssembler::ValidateCacheState() const {
     }
     used_regs.set(reg);
   }
+  if (cache_state_.cached_instance != no_reg) {
+    DCHECK(!used_regs.has(cache_state_.cached_instance));
+    ++register_use_count[LiftoffRegister(cache_state_.cached_instance)
+                             .liftoff_code()];
+    used_regs.set(cache_state_.cached_instance);
+  }
   bool valid = memcmp(register_use_count, cache_state_.register_use_count,
                       sizeof(register_use_count)) == 0 &&
                used_regs == cache_state_.used_registers;
@@ -988,6 +1014,12 @@ bool LiftoffAssembler::ValidateCacheState() const {
 
 LiftoffRegister LiftoffAssembler::SpillOneRegister(LiftoffRegList candidates,
                                                    LiftoffRegList pinned) {
+  // Dropping the cached instance is cheaper than spilling a value.
+  Register instance = cache_state_.cached_instance;
+  if (instance != no_reg && candidates.MaskOut(pinned).has(instance)) {
+    cache_state_.ClearCachedInstanceRegister();
+    return LiftoffRegister(instance);
+  }
   // Spill one cached value to free a register.
   LiftoffRegister spill_reg = cache_state_.GetNextSpillReg(candidates, pinned);
   SpillRegister(spill_reg);
@@ -1041,6 +1073,11 @@ LiftoffRegister LiftoffAssembler::SpillAdjacentFpRegisters(
 }
 
 void LiftoffAssembler::SpillRegister(LiftoffRegister reg) {
+  // The cached instance is never spilled, it can be reloaded from the frame.
+  if (reg.is_gp() && reg.gp() == cache_state_.cached_instance) {
+    cache_state_.ClearCachedInstanceRegister();
+    if (cache_state_.is_free(reg)) return;
+  }
   int remaining_uses = cache_state_.get_use_count(reg);
   DCHECK_LT(0, remaining_uses);
   for (uint32_t idx = cache_state_.stack_height() - 1;; --idx) {
@@ -139,6 +139,10 @@ class LiftoffAssembler : public TurboAssembler {
     LiftoffRegList used_registers;
     uint32_t register_use_count[kAfterMaxLiftoffRegCode] = {0};
     LiftoffRegList last_spilled_regs;
+    // Register holding a copy of the instance loaded from the frame, or
+    // {no_reg}. It counts as a used register, but is dropped (not spilled) if
+    // the register is needed otherwise, and on calls.
+    Register cached_instance = no_reg;
 
     bool has_unused_register(RegClass rc, LiftoffRegList pinned = {}) const {
       if (kNeedI64RegPair && rc == kGpRegPair) {
@@ -239,6 +243,23 @@ class LiftoffAssembler : public TurboAssembler {
     void reset_used_registers() {
       used_registers = {};
       memset(register_use_count, 0, sizeof(register_use_count));
+      cached_instance = no_reg;
+    }
+
+    // Tries to find an unused register for caching the instance. Returns
+    // {no_reg} if all registers (except {pinned}) are in use.
+    Register TrySetCachedInstanceRegister(LiftoffRegList pinned) {
+      DCHECK_EQ(no_reg, cached_instance);
+      if (!has_unused_register(kGpCacheRegList, pinned)) return no_reg;
+      cached_instance = unused_register(kGpCacheRegList, pinned).gp();
+      inc_used(LiftoffRegister(cached_instance));
+      return cached_instance;
+    }
+
+    void ClearCachedInstanceRegister() {
+      if (cached_instance == no_reg) return;
+      dec_used(LiftoffRegister(cached_instance));
+      cached_instance = no_reg;
     }
 
     LiftoffRegister GetNextSpillReg(LiftoffRegList candidates,
@@ -383,6 +404,8 @@ class LiftoffAssembler : public TurboAssembler {
 
   void MergeFullStackWith(const CacheState& target, const CacheState& source);
   void MergeStackWith(const CacheState& target, uint32_t arity);
+  // Loads the instance into the register in which {target} caches it, if any.
+  void MergeCachedInstanceWith(const CacheState& target);
 
   void Spill(VarState* slot);
   void SpillLocals();
@@ -474,8 +497,10 @@ class LiftoffAssembler : public TurboAssembler {
 
   inline void LoadConstant(LiftoffRegister, WasmValue,
                            RelocInfo::Mode rmode = RelocInfo::NONE);
-  inline void LoadFromInstance(Register dst, uint32_t offset, int size);
-  inline void LoadTaggedPointerFromInstance(Register dst, uint32_t offset);
+  inline void LoadFromInstance(Register dst, Register instance,
+                               uint32_t offset, int size);
+  inline void LoadTaggedPointerFromInstance(Register dst, Register instance,
+                                            uint32_t offset);
   inline void SpillInstance(Register instance);
   inline void FillInstanceInto(Register dst);
   inline void LoadTaggedPointer(Register dst, Register src_addr,
@@ -766,8 +766,11 @@ ExecutionTierPair GetRequestedExecutionTiers(
 
     case CompileMode::kTiering:
 
-      // Default tiering behaviour.
-      result.top_tier = ExecutionTier::kTurbofan;
+      // Default tiering behaviour. With dynamic tiering, functions are only
+      // recompiled with TurboFan once Liftoff code finds them hot (see
+      // {TriggerTierUp}).
+      result.top_tier = FLAG_wasm_dynamic_tiering ? result.baseline_tier
+                                                  : ExecutionTier::kTurbofan;
 
       // Check if compilation hints override default tiering behaviour.
       if (enabled_features.has_compilation_hints()) {
@@ -959,6 +962,16 @@ bool CompileLazy(Isolate* isolate, NativeModule* native_module,
   DCHECK(!native_module->lazy_compile_frozen());
   NativeModuleModificationScope native_module_modification_scope(native_module);
 
+  {
+    WasmCodeRefScope code_ref_scope;
+    if (WasmCode* code = DeserializeLazyFunction(native_module, func_index)) {
+      TRACE_LAZY("Deserialized wasm-function#%d.\n", func_index);
+      if (WasmCode::ShouldBeLogged(isolate)) code->LogCode(isolate);
+      counters->wasm_lazily_deserialized_functions()->Increment();
+      return true;
+    }
+  }
+
   TRACE_LAZY("Compiling wasm-function#%d.\n", func_index);
 
   CompilationStateImpl* compilation_state =
@@ -1020,6 +1033,7 @@ void TriggerTierUp(Isolate* isolate, NativeModule* native_module,
   WasmCompilationUnit tiering_unit{func_index, ExecutionTier::kTurbofan,
                                    kNoDebugging};
   compilation_state->AddTopTierCompilationUnit(tiering_unit);
+  isolate->counters()->wasm_tiered_up_functions()->Increment();
 }
 
 namespace {
@@ -1424,6 +1438,8 @@ class BackgroundCompileTask : public CancelableTask {
         task_id_(task_id) {}
 
   void RunInternal() override {
+    CpuTimeAccountingScope cpu_time_scope(
+        async_counters_.get(), Counters::CpuTimeCategory::kWasmBackground);
     ExecuteCompilationUnits(token_, async_counters_.get(), task_id_,
                             kBaselineOrTopTier);
   }
@@ -1915,7 +1931,7 @@ void AsyncCompileJob::StartBackgroundTask() {
   // If --wasm-num-compilation-tasks=0 is passed, do only spawn foreground
   // tasks. This is used to make timing deterministic.
   if (FLAG_wasm_num_compilation_tasks > 0) {
-    V8::GetCurrentPlatform()->CallOnWorkerThread(std::move(task));
+    isolate_->PostBackgroundTask(std::move(task));
   } else {
     foreground_task_runner_->PostTask(std::move(task));
   }
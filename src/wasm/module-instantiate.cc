@@ -212,6 +212,11 @@ class InstanceBuilder {
     Handle<String> module_name;
     Handle<String> import_name;
     Handle<Object> value;
+    // For callable function imports, the call kind and the ultimate target as
+    // computed by {compiler::ResolveWasmImportCall}. Resolving once here is
+    // shared by wrapper compilation and import processing.
+    compiler::WasmImportCallKind kind;
+    Handle<JSReceiver> target;
   };
 
   Isolate* isolate_;
@@ -283,7 +288,9 @@ class InstanceBuilder {
                                int import_index, int func_index,
                                Handle<String> module_name,
                                Handle<String> import_name,
-                               Handle<Object> value);
+                               Handle<Object> value,
+                               compiler::WasmImportCallKind kind,
+                               Handle<JSReceiver> js_receiver);
 
   // Initialize imported tables of type funcref.
   bool InitializeImportedIndirectFunctionTable(
@@ -925,7 +932,18 @@ void InstanceBuilder::SanitizeImports() {
       return;
     }
     Handle<Object> value = result.ToHandleChecked();
-    sanitized_imports_.push_back({module_name, import_name, value});
+    compiler::WasmImportCallKind kind =
+        compiler::WasmImportCallKind::kLinkError;
+    Handle<JSReceiver> target;
+    if (import.kind == kExternalFunction && value->IsCallable()) {
+      const FunctionSig* sig = module_->functions[import.index].sig;
+      auto resolved = compiler::ResolveWasmImportCall(
+          Handle<JSReceiver>::cast(value), sig, enabled_);
+      kind = resolved.first;
+      target = resolved.second;
+    }
+    sanitized_imports_.push_back({module_name, import_name, value, kind,
+                                  target});
   }
 }
 
@@ -949,27 +967,24 @@ bool InstanceBuilder::FindImportedMemory() {
 bool InstanceBuilder::ProcessImportedFunction(
     Handle<WasmInstanceObject> instance, int import_index, int func_index,
     Handle<String> module_name, Handle<String> import_name,
-    Handle<Object> value) {
+    Handle<Object> value, compiler::WasmImportCallKind kind,
+    Handle<JSReceiver> js_receiver) {
   // Function imports must be callable.
   if (!value->IsCallable()) {
     ReportLinkError("function import requires a callable", import_index,
                     module_name, import_name);
     return false;
   }
-  // Store any {WasmExternalFunction} callable in the instance before the call
-  // is resolved to preserve its identity. This handles exported functions as
-  // well as functions constructed via other means (e.g. WebAssembly.Function).
+  // Store any {WasmExternalFunction} callable in the instance, rather than the
+  // resolved target, to preserve its identity. This handles exported functions
+  // as well as functions constructed via other means (e.g.
+  // WebAssembly.Function).
   if (WasmExternalFunction::IsWasmExternalFunction(*value)) {
     WasmInstanceObject::SetWasmExternalFunction(
         isolate_, instance, func_index,
         Handle<WasmExternalFunction>::cast(value));
   }
-  auto js_receiver = Handle<JSReceiver>::cast(value);
   const FunctionSig* expected_sig = module_->functions[func_index].sig;
-  auto resolved =
-      compiler::ResolveWasmImportCall(js_receiver, expected_sig, enabled_);
-  compiler::WasmImportCallKind kind = resolved.first;
-  js_receiver = resolved.second;
   switch (kind) {
     case compiler::WasmImportCallKind::kLinkError:
       ReportLinkError("imported function does not match the expected type",
@@ -1340,26 +1355,22 @@ void InstanceBuilder::CompileImportWrappers(
   // when inserting a new WasmCode, since the key will already be there.
   ImportWrapperQueue import_wrapper_queue;
   for (int index = 0; index < num_imports; ++index) {
-    Handle<Object> value = sanitized_imports_[index].value;
-    if (module_->import_table[index].kind != kExternalFunction ||
-        !value->IsCallable()) {
-      continue;
-    }
-    auto js_receiver = Handle<JSReceiver>::cast(value);
-    uint32_t func_index = module_->import_table[index].index;
-    const FunctionSig* sig = module_->functions[func_index].sig;
-    auto resolved = compiler::ResolveWasmImportCall(js_receiver, sig, enabled_);
-    compiler::WasmImportCallKind kind = resolved.first;
+    if (module_->import_table[index].kind != kExternalFunction) continue;
+    // Non-callable imports are left as kLinkError by {SanitizeImports}.
+    const SanitizedImport& import = sanitized_imports_[index];
+    compiler::WasmImportCallKind kind = import.kind;
     if (kind == compiler::WasmImportCallKind::kWasmToWasm ||
         kind == compiler::WasmImportCallKind::kLinkError ||
         kind == compiler::WasmImportCallKind::kWasmToCapi) {
       continue;
     }
 
+    uint32_t func_index = module_->import_table[index].index;
+    const FunctionSig* sig = module_->functions[func_index].sig;
     int expected_arity = static_cast<int>(sig->parameter_count());
-    if (resolved.first ==
+    if (kind ==
         compiler::WasmImportCallKind::kJSFunctionArityMismatchSkipAdaptor) {
-      Handle<JSFunction> function = Handle<JSFunction>::cast(resolved.second);
+      Handle<JSFunction> function = Handle<JSFunction>::cast(import.target);
       SharedFunctionInfo shared = function->shared();
       expected_arity = shared.internal_formal_parameter_count();
     }
@@ -1414,7 +1425,9 @@ int InstanceBuilder::ProcessImports(Handle<WasmInstanceObject> instance) {
         uint32_t func_index = import.index;
         DCHECK_EQ(num_imported_functions, func_index);
         if (!ProcessImportedFunction(instance, index, func_index, module_name,
-                                     import_name, value)) {
+                                     import_name, value,
+                                     sanitized_imports_[index].kind,
+                                     sanitized_imports_[index].target)) {
           return -1;
         }
         num_imported_functions++;
@@ -104,6 +104,32 @@ bool TryMatchBlend(const uint8_t* shuffle) {
   return true;
 }
 
+bool TryMatchByteShiftRight(const uint8_t* shuffle, uint8_t* shift) {
+  uint8_t start = shuffle[0];
+  // The identity and shuffles starting with the second input don't match.
+  if (start == 0 || start >= kSimd128Size) return false;
+  int i = 0;
+  for (; i < kSimd128Size - start; ++i) {
+    if (shuffle[i] != start + i) return false;
+  }
+  for (; i < kSimd128Size; ++i) {
+    if (shuffle[i] < kSimd128Size) return false;
+  }
+  *shift = start;
+  return true;
+}
+
+bool TryMatchByteShiftLeft(const uint8_t* shuffle, uint8_t* shift) {
+  int start = 0;
+  while (start < kSimd128Size && shuffle[start] < kSimd128Size) ++start;
+  if (start == 0 || start == kSimd128Size) return false;
+  for (int i = start; i < kSimd128Size; ++i) {
+    if (shuffle[i] != kSimd128Size + i - start) return false;
+  }
+  *shift = start;
+  return true;
+}
+
 }  // namespace wasm
 }  // namespace internal
 }  // namespace v8
@@ -53,6 +53,18 @@ bool TryMatchConcat(const uint8_t* shuffle, uint8_t* offset);
 
 bool TryMatchBlend(const uint8_t* shuffle);
 
+// Tries to match a canonicalized shuffle to a whole-register byte shift, in
+// case the second input of the shuffle is known to be zero. The lanes taken
+// from the second input may have any index in [16 .. 31]. Returns the number
+// of bytes to shift by.
+// E.g. [4 5 .. 15 16 16 16 16] shifts the first input right by 4 bytes.
+bool TryMatchByteShiftRight(const uint8_t* shuffle, uint8_t* shift);
+
+// Same as above for a left shift of the second input, in case the first input
+// is known to be zero.
+// E.g. [0 0 0 0 16 17 .. 27] shifts the second input left by 4 bytes.
+bool TryMatchByteShiftLeft(const uint8_t* shuffle, uint8_t* shift);
+
 }  // namespace wasm
 }  // namespace internal
 }  // namespace v8
@@ -31,6 +31,7 @@
 #include "src/wasm/wasm-module.h"
 #include "src/wasm/wasm-objects-inl.h"
 #include "src/wasm/wasm-objects.h"
+#include "src/wasm/wasm-serialization.h"
 
 #if defined(V8_OS_WIN64)
 #include "src/diagnostics/unwinding-info-win64.h"
@@ -108,7 +109,8 @@ base::AddressRegion DisjointAllocationPool::Allocate(size_t size) {
 }
 
 base::AddressRegion DisjointAllocationPool::AllocateInRegion(
-    size_t size, base::AddressRegion region) {
+    size_t size, base::AddressRegion region,
+    base::AddressRegion* containing_region) {
   // Get an iterator to the first contained region whose start address is not
   // smaller than the start address of {region}. Start the search from the
   // region one before that (the last one whose start address is smaller).
@@ -120,6 +122,7 @@ base::AddressRegion DisjointAllocationPool::AllocateInRegion(
     if (size > overlap.size()) continue;
     base::AddressRegion ret{overlap.begin(), size};
     base::AddressRegion old = *it;
+    if (containing_region) *containing_region = old;
     auto insert_pos = regions_.erase(it);
     if (size == old.size()) {
       // We use the full region --> nothing to add back.
@@ -622,8 +625,22 @@ Vector<byte> WasmCodeAllocator::AllocateForCodeInRegion(
   DCHECK_LT(0, size);
   v8::PageAllocator* page_allocator = GetPlatformPageAllocator();
   size = RoundUp<kCodeAlignment>(size);
-  base::AddressRegion code_space =
-      free_code_space_.AllocateInRegion(size, region);
+  base::AddressRegion code_space;
+  if (FLAG_wasm_reuse_freed_code_space) {
+    code_space = AllocateFromFreedCodeSpace(size, region);
+    if (!code_space.is_empty()) {
+      // The region is still part of {allocated_code_space_}, and its pages
+      // have been committed by {AllocateFromFreedCodeSpace}.
+      generated_code_size_.fetch_add(code_space.size(),
+                                     std::memory_order_relaxed);
+      reused_code_size_.fetch_add(code_space.size(),
+                                  std::memory_order_relaxed);
+      TRACE_HEAP("Code alloc for %p (reused): 0x%" PRIxPTR ",+%zu\n", this,
+                 code_space.begin(), size);
+      return {reinterpret_cast<byte*>(code_space.begin()), code_space.size()};
+    }
+  }
+  code_space = free_code_space_.AllocateInRegion(size, region);
   if (code_space.is_empty()) {
     if (region.size() < std::numeric_limits<size_t>::max()) {
       V8::FatalProcessOutOfMemory(nullptr, "wasm code reservation in region");
@@ -731,17 +748,45 @@ bool WasmCodeAllocator::SetExecutable(bool executable) {
   return true;
 }
 
-void WasmCodeAllocator::FreeCode(Vector<WasmCode* const> codes) {
-  // Zap code area and collect freed code regions.
-  DisjointAllocationPool freed_regions;
+base::AddressRegion WasmCodeAllocator::AllocateFromFreedCodeSpace(
+    size_t size, base::AddressRegion region) {
+  DCHECK(!mutex_.TryLock());
+  base::AddressRegion freed_region;
+  base::AddressRegion code_space =
+      freed_code_space_.AllocateInRegion(size, region, &freed_region);
+  if (code_space.is_empty()) return {};
+  DCHECK(IsAligned(code_space.begin(), kCodeAlignment));
+
+  // {FreeCode} discarded exactly the pages which are fully contained in
+  // {freed_region}. Recommit those which overlap the new allocation; the
+  // remaining (partial) pages are still committed.
+  size_t commit_page_size = GetPlatformPageAllocator()->CommitPageSize();
+  Address commit_start =
+      std::max(RoundUp(freed_region.begin(), commit_page_size),
+               RoundDown(code_space.begin(), commit_page_size));
+  Address commit_end = std::min(RoundDown(freed_region.end(), commit_page_size),
+                                RoundUp(code_space.end(), commit_page_size));
+  if (commit_start < commit_end) {
+    committed_code_space_.fetch_add(commit_end - commit_start);
+    DCHECK_LE(committed_code_space_.load(), kMaxWasmCodeMemory);
+    for (base::AddressRegion split_range : SplitRangeByReservationsIfNeeded(
+             {commit_start, commit_end - commit_start}, owned_code_space_)) {
+      if (!code_manager_->Commit(split_range)) {
+        V8::FatalProcessOutOfMemory(nullptr, "wasm code commit");
+        UNREACHABLE();
+      }
+    }
+  }
+  return code_space;
+}
+
+void WasmCodeAllocator::FreeCode(DisjointAllocationPool freed_regions) {
+  // Zap code area.
   size_t code_size = 0;
-  for (WasmCode* code : codes) {
-    ZapCode(code->instruction_start(), code->instructions().size());
-    FlushInstructionCache(code->instruction_start(),
-                          code->instructions().size());
-    code_size += code->instructions().size();
-    freed_regions.Merge(base::AddressRegion{code->instruction_start(),
-                                            code->instructions().size()});
+  for (auto region : freed_regions.regions()) {
+    ZapCode(region.begin(), region.size());
+    FlushInstructionCache(region.begin(), region.size());
+    code_size += region.size();
   }
   freed_code_size_.fetch_add(code_size);
 
@@ -801,6 +846,10 @@ NativeModule::NativeModule(WasmEngine* engine, const WasmFeatures& enabled,
         std::make_unique<WasmCode*[]>(module_->num_declared_functions);
     num_liftoff_function_calls_ =
         std::make_unique<uint32_t[]>(module_->num_declared_functions);
+    if (FLAG_wasm_liftoff_profiling) {
+      num_liftoff_loop_iterations_ =
+          std::make_unique<uint32_t[]>(module_->num_declared_functions);
+    }
   }
   code_allocator_.Init(this);
 }
@@ -1171,6 +1220,29 @@ bool NativeModule::HasCode(uint32_t index) const {
   return code_table_[declared_function_index(module(), index)] != nullptr;
 }
 
+void NativeModule::PrintCompilationHints() {
+  constexpr auto kLazy =
+      static_cast<uint8_t>(WasmCompilationHintStrategy::kLazy);
+  constexpr auto kLazyBaselineEagerTopTier = static_cast<uint8_t>(
+      WasmCompilationHintStrategy::kLazyBaselineEagerTopTier);
+  constexpr auto kBaseline =
+      static_cast<uint8_t>(WasmCompilationHintTier::kBaseline);
+  constexpr auto kOptimized =
+      static_cast<uint8_t>(WasmCompilationHintTier::kOptimized);
+  std::vector<WasmCode*> code_table = SnapshotCodeTable();
+  PrintF("[wasm-compilation-hints] %zu ", code_table.size());
+  for (WasmCode* code : code_table) {
+    uint8_t hint = kLazy;
+    if (code != nullptr && code->tier() == ExecutionTier::kTurbofan) {
+      hint = kLazyBaselineEagerTopTier | kBaseline << 2 | kOptimized << 4;
+    } else if (code != nullptr) {
+      hint = kLazy | kBaseline << 2 | kBaseline << 4;
+    }
+    PrintF("%02x", hint);
+  }
+  PrintF("\n");
+}
+
 bool NativeModule::HasCodeWithTier(uint32_t index, ExecutionTier tier) const {
   base::MutexGuard guard(&allocation_mutex_);
   return code_table_[declared_function_index(module(), index)] != nullptr &&
@@ -1186,6 +1258,11 @@ WasmModuleSourceMap* NativeModule::GetWasmSourceMap() const {
   return source_map_.get();
 }
 
+void NativeModule::SetLazyDeserializationData(
+    std::unique_ptr<LazyDeserializationData> data) {
+  lazy_deserialization_data_ = std::move(data);
+}
+
 WasmCode* NativeModule::CreateEmptyJumpTableInRegion(
     int jump_table_size, base::AddressRegion region,
     const WasmCodeAllocator::OptionalLock& allocator_lock) {
@@ -1506,6 +1583,7 @@ NativeModule::~NativeModule() {
   // Cancel all background compilation before resetting any field of the
   // NativeModule or freeing anything.
   compilation_state_->AbortCompilation();
+  if (FLAG_wasm_print_compilation_hints) PrintCompilationHints();
   engine_->FreeNativeModule(this);
   // Free the import wrapper cache before releasing the {WasmCode} objects in
   // {owned_code_}. The destructor of {WasmImportWrapperCache} still needs to
@@ -1805,6 +1883,12 @@ void NativeModule::SampleCodeSize(
         int freed_percent = static_cast<int>(100 * freed_size / generated_size);
         counters->wasm_module_freed_code_size_percent()->AddSample(
             freed_percent);
+        size_t reused_size = code_allocator_.reused_code_size();
+        DCHECK_LE(reused_size, generated_size);
+        int reused_percent =
+            static_cast<int>(100 * reused_size / generated_size);
+        counters->wasm_module_reused_code_size_percent()->AddSample(
+            reused_percent);
       }
       break;
     }
@@ -1897,22 +1981,34 @@ std::vector<int> NativeModule::FindFunctionsToRecompile(
 }
 
 void NativeModule::FreeCode(Vector<WasmCode* const> codes) {
-  // Free the code space.
-  code_allocator_.FreeCode(codes);
+  // Collect the code regions while the {WasmCode} objects are still alive.
+  DisjointAllocationPool freed_regions;
+  for (WasmCode* code : codes) {
+    freed_regions.Merge(base::AddressRegion{code->instruction_start(),
+                                            code->instructions().size()});
+  }
 
   DebugInfo* debug_info = nullptr;
   {
     base::MutexGuard guard(&allocation_mutex_);
     debug_info = debug_info_.get();
+  }
+  // Remove debug side tables for all removed code objects, without holding our
+  // lock. This is to avoid lock order inversion.
+  if (debug_info) debug_info->RemoveDebugSideTables(codes);
+
+  {
+    base::MutexGuard guard(&allocation_mutex_);
     // Free the {WasmCode} objects. This will also unregister trap handler data.
     for (WasmCode* code : codes) {
       DCHECK_EQ(1, owned_code_.count(code->instruction_start()));
       owned_code_.erase(code->instruction_start());
     }
   }
-  // Remove debug side tables for all removed code objects, after releasing our
-  // lock. This is to avoid lock order inversion.
-  if (debug_info) debug_info->RemoveDebugSideTables(codes);
+
+  // Free the code space. This must happen after the {WasmCode} objects are
+  // gone, since the space can be reused for new code immediately.
+  code_allocator_.FreeCode(std::move(freed_regions));
 }
 
 size_t NativeModule::GetNumberOfCodeSpacesForTesting() const {
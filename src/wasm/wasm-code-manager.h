@@ -37,6 +37,7 @@ class Isolate;
 namespace wasm {
 
 class DebugInfo;
+class LazyDeserializationData;
 class NativeModule;
 class WasmCodeManager;
 struct WasmCompilationResult;
@@ -103,8 +104,11 @@ class V8_EXPORT_PRIVATE DisjointAllocationPool final {
   base::AddressRegion Allocate(size_t size);
 
   // Allocate a contiguous region of size {size} within {region}. Return an
-  // empty pool on failure.
-  base::AddressRegion AllocateInRegion(size_t size, base::AddressRegion);
+  // empty pool on failure. If {containing_region} is given, it receives the
+  // region of this pool the allocation was taken from (before splitting it).
+  base::AddressRegion AllocateInRegion(
+      size_t size, base::AddressRegion,
+      base::AddressRegion* containing_region = nullptr);
 
   bool IsEmpty() const { return regions_.empty(); }
 
@@ -401,6 +405,9 @@ class WasmCodeAllocator {
   size_t freed_code_size() const {
     return freed_code_size_.load(std::memory_order_acquire);
   }
+  size_t reused_code_size() const {
+    return reused_code_size_.load(std::memory_order_acquire);
+  }
 
   // Allocate code space. Returns a valid buffer or fails with OOM (crash).
   Vector<byte> AllocateForCode(NativeModule*, size_t size);
@@ -415,13 +422,21 @@ class WasmCodeAllocator {
   // {executable} is false). Returns true on success.
   V8_EXPORT_PRIVATE bool SetExecutable(bool executable);
 
-  // Free memory pages of all given code objects. Used for wasm code GC.
-  void FreeCode(Vector<WasmCode* const>);
+  // Free memory pages of the given code regions. Used for wasm code GC. The
+  // regions can be reused for new code right away, so the {WasmCode} objects
+  // living there must be gone already.
+  void FreeCode(DisjointAllocationPool freed_regions);
 
   // Retrieve the number of separately reserved code spaces.
   size_t GetNumCodeSpaces() const;
 
  private:
+  // Allocate {size} bytes within {region} from {freed_code_space_}, and
+  // recommit the pages that were discarded when the code was freed. Returns
+  // an empty region if nothing fits.
+  base::AddressRegion AllocateFromFreedCodeSpace(size_t size,
+                                                 base::AddressRegion region);
+
   // The engine-wide wasm code manager.
   WasmCodeManager* const code_manager_;
 
@@ -436,7 +451,9 @@ class WasmCodeAllocator {
   // Code space that was allocated for code (subset of {owned_code_space_}).
   DisjointAllocationPool allocated_code_space_;
   // Code space that was allocated before but is dead now. Full pages within
-  // this region are discarded. It's still a subset of {owned_code_space_}.
+  // this region are discarded. It's still a subset of {owned_code_space_} and
+  // of {allocated_code_space_}, and is used for new allocations before
+  // {free_code_space_} (see --wasm-reuse-freed-code-space).
   DisjointAllocationPool freed_code_space_;
   std::vector<VirtualMemory> owned_code_space_;
 
@@ -446,6 +463,7 @@ class WasmCodeAllocator {
   std::atomic<size_t> committed_code_space_{0};
   std::atomic<size_t> generated_code_size_{0};
   std::atomic<size_t> freed_code_size_{0};
+  std::atomic<size_t> reused_code_size_{0};
 
   bool is_executable_ = false;
 
@@ -504,6 +522,13 @@ class V8_EXPORT_PRIVATE NativeModule final {
   void SetWasmSourceMap(std::unique_ptr<WasmModuleSourceMap> source_map);
   WasmModuleSourceMap* GetWasmSourceMap() const;
 
+  // Serialized code of functions which are deserialized on their first call,
+  // see --wasm-lazy-deserialization. Set before the module is shared.
+  void SetLazyDeserializationData(std::unique_ptr<LazyDeserializationData>);
+  LazyDeserializationData* lazy_deserialization_data() const {
+    return lazy_deserialization_data_.get();
+  }
+
   Address jump_table_start() const {
     return main_jump_table_ ? main_jump_table_->instruction_start()
                             : kNullAddress;
@@ -552,6 +577,13 @@ class V8_EXPORT_PRIVATE NativeModule final {
 
   void LogWasmCodes(Isolate* isolate);
 
+  // Prints one compilation hint byte per declared function, in the format of
+  // the "compilationHints" custom section. With lazy compilation and dynamic
+  // tiering, functions that never ran get a lazy hint, functions that only ran
+  // in Liftoff stay in Liftoff, and functions that tiered up compile their top
+  // tier eagerly. See tools/wasm-compilation-hints.
+  void PrintCompilationHints();
+
   CompilationState* compilation_state() { return compilation_state_.get(); }
 
   // Create a {CompilationEnv} object for compilation. The caller has to ensure
@@ -646,6 +678,12 @@ class V8_EXPORT_PRIVATE NativeModule final {
     return num_liftoff_function_calls_.get();
   }
 
+  // Number of loop iterations per declared function, summed over all loops of
+  // the function. Only updated by Liftoff code with --wasm-liftoff-profiling.
+  uint32_t* num_liftoff_loop_iterations_array() {
+    return num_liftoff_loop_iterations_.get();
+  }
+
  private:
   friend class WasmCode;
   friend class WasmCodeAllocator;
@@ -706,6 +744,8 @@ class V8_EXPORT_PRIVATE NativeModule final {
 
   std::unique_ptr<WasmModuleSourceMap> source_map_;
 
+  std::unique_ptr<LazyDeserializationData> lazy_deserialization_data_;
+
   // Wire bytes, held in a shared_ptr so they can be kept alive by the
   // {WireBytesStorage}, held by background compile tasks.
   std::shared_ptr<OwnedVector<const uint8_t>> wire_bytes_;
@@ -733,6 +773,9 @@ class V8_EXPORT_PRIVATE NativeModule final {
   // Array to handle number of function calls.
   std::unique_ptr<uint32_t[]> num_liftoff_function_calls_;
 
+  // Array to count loop iterations with --wasm-liftoff-profiling.
+  std::unique_ptr<uint32_t[]> num_liftoff_loop_iterations_;
+
   // This mutex protects concurrent calls to {AddCode} and friends.
   mutable base::Mutex allocation_mutex_;
 
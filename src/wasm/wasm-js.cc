@@ -11,6 +11,7 @@
 #include "src/api/api-natives.h"
 #include "src/ast/ast.h"
 #include "src/base/overflowing-math.h"
+#include "src/builtins/accessors.h"
 #include "src/common/assert-scope.h"
 #include "src/execution/execution.h"
 #include "src/execution/isolate.h"
@@ -18,6 +19,7 @@
 #include "src/heap/factory.h"
 #include "src/init/v8.h"
 #include "src/objects/js-promise-inl.h"
+#include "src/objects/lookup.h"
 #include "src/objects/objects-inl.h"
 #include "src/objects/templates.h"
 #include "src/parsing/parse-info.h"
@@ -2067,6 +2069,37 @@ void SetDummyInstanceTemplate(Isolate* isolate, Handle<JSFunction> fun) {
       instance_template);
 }
 
+namespace {
+
+// Getter of the WebAssembly property defined by {WasmJs::InstallLazily}. Sets
+// up the API in the global object's context, which replaces the accessor with
+// the namespace object.
+void WebAssemblyNamespaceGetter(
+    v8::Local<v8::Name> property,
+    const v8::PropertyCallbackInfo<v8::Value>& info) {
+  i::Isolate* isolate = reinterpret_cast<i::Isolate*>(info.GetIsolate());
+  HandleScope scope(isolate);
+  Handle<JSGlobalObject> global =
+      Handle<JSGlobalObject>::cast(Utils::OpenHandle(*info.Holder()));
+  {
+    SaveAndSwitchContext save(isolate, global->native_context());
+    WasmJs::Install(isolate, false);
+  }
+  Handle<Object> result =
+      JSObject::GetDataProperty(global, Utils::OpenHandle(*property));
+  info.GetReturnValue().Set(Utils::ToLocal(result));
+}
+
+bool IsLazyNamespaceAccessor(LookupIterator* it) {
+  if (it->state() != LookupIterator::ACCESSOR) return false;
+  Handle<Object> accessors = it->GetAccessors();
+  if (!accessors->IsAccessorInfo()) return false;
+  return v8::ToCData<Address>(AccessorInfo::cast(*accessors).getter()) ==
+         FUNCTION_ADDR(WebAssemblyNamespaceGetter);
+}
+
+}  // namespace
+
 // static
 void WasmJs::Install(Isolate* isolate, bool exposed_on_global_object) {
   Handle<JSGlobalObject> global = isolate->global_object();
@@ -2108,8 +2141,15 @@ void WasmJs::Install(Isolate* isolate, bool exposed_on_global_object) {
                 WebAssemblyInstantiateStreaming, 1);
   }
 
-  // Expose the API on the global object if configured to do so.
-  if (exposed_on_global_object) {
+  // Expose the API on the global object if configured to do so, or if it is
+  // still waiting to be set up on first access.
+  LookupIterator it(isolate, global, name,
+                    LookupIterator::OWN_SKIP_INTERCEPTOR);
+  if (IsLazyNamespaceAccessor(&it)) {
+    Accessors::ReplaceAccessorWithDataProperty(global, global, name,
+                                               webassembly)
+        .Check();
+  } else if (exposed_on_global_object) {
     JSObject::AddProperty(isolate, global, name, webassembly, DONT_ENUM);
   }
 
@@ -2275,6 +2315,24 @@ void WasmJs::Install(Isolate* isolate, bool exposed_on_global_object) {
                         runtime_error, DONT_ENUM);
 }
 
+// static
+void WasmJs::InstallLazily(Isolate* isolate) {
+  Handle<JSGlobalObject> global = isolate->global_object();
+  Handle<Context> context(global->native_context(), isolate);
+  if (!context->get(Context::WASM_MODULE_CONSTRUCTOR_INDEX)
+           .IsUndefined(isolate)) {
+    return;
+  }
+
+  Handle<String> name = v8_str(isolate, "WebAssembly");
+  Handle<AccessorInfo> info = Accessors::MakeAccessor(
+      isolate, name, &WebAssemblyNamespaceGetter, nullptr);
+  // Setting up the API is not observable, so the first read can happen during
+  // side-effect free debug evaluation.
+  info->set_getter_side_effect_type(SideEffectType::kHasNoSideEffect);
+  JSObject::SetAccessor(global, name, info, DONT_ENUM).Check();
+}
+
 #undef ASSIGN
 #undef EXTRACT_THIS
 
@@ -17,8 +17,16 @@ class StreamingDecoder;
 // Exposes a WebAssembly API to JavaScript through the V8 API.
 class WasmJs {
  public:
+  // Sets up the JS API in the current context, unless that was done already.
+  // The Wasm object factories call this with {exposed_on_global_object} set
+  // to false, since the constructors and maps they use only exist after it.
   V8_EXPORT_PRIVATE static void Install(Isolate* isolate,
                                         bool exposed_on_global_object);
+
+  // Defines the WebAssembly property of the current context's global object
+  // as an accessor that calls {Install} when first read. Until then, or until
+  // the first Wasm object is created, no part of the API is allocated.
+  V8_EXPORT_PRIVATE static void InstallLazily(Isolate* isolate);
 };
 
 }  // namespace internal
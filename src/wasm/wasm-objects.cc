@@ -24,6 +24,7 @@
 #include "src/wasm/value-type.h"
 #include "src/wasm/wasm-code-manager.h"
 #include "src/wasm/wasm-engine.h"
+#include "src/wasm/wasm-js.h"
 #include "src/wasm/wasm-limits.h"
 #include "src/wasm/wasm-module.h"
 #include "src/wasm/wasm-objects-inl.h"
@@ -178,6 +179,7 @@ Handle<WasmModuleObject> WasmModuleObject::New(
     managed_native_module = Managed<wasm::NativeModule>::FromSharedPtr(
         isolate, memory_estimate, std::move(native_module));
   }
+  WasmJs::Install(isolate, false);
   Handle<WasmModuleObject> module_object = Handle<WasmModuleObject>::cast(
       isolate->factory()->NewJSObject(isolate->wasm_module_constructor()));
   module_object->set_export_wrappers(*export_wrappers);
@@ -277,6 +279,7 @@ Handle<WasmTableObject> WasmTableObject::New(Isolate* isolate,
     max = isolate->factory()->undefined_value();
   }
 
+  WasmJs::Install(isolate, false);
   Handle<JSFunction> table_ctor(
       isolate->native_context()->wasm_table_constructor(), isolate);
   auto table_obj = Handle<WasmTableObject>::cast(
@@ -772,6 +775,7 @@ Handle<WasmMemoryObject> WasmMemoryObject::New(
     buffer = isolate->factory()->NewJSArrayBuffer(std::move(backing_store));
   }
 
+  WasmJs::Install(isolate, false);
   Handle<JSFunction> memory_ctor(
       isolate->native_context()->wasm_memory_constructor(), isolate);
 
@@ -918,9 +922,13 @@ int32_t WasmMemoryObject::Grow(Isolate* isolate,
   }
 
   size_t new_pages = old_pages + pages;
-  // Try allocating a new backing store and copying.
+  // Try allocating a new backing store and copying. Reserve capacity for at
+  // least doubling the memory, so that repeated small grows don't copy the
+  // whole memory each time.
+  size_t reserve_pages =
+      std::min(size_t{maximum_pages}, std::max(new_pages, 2 * old_pages));
   std::unique_ptr<BackingStore> new_backing_store =
-      backing_store->CopyWasmMemory(isolate, new_pages);
+      backing_store->CopyWasmMemory(isolate, new_pages, reserve_pages);
   if (!new_backing_store) {
     // Crash on out-of-memory if the correctness fuzzer is running.
     if (FLAG_correctness_fuzzer_suppressions) {
@@ -942,6 +950,7 @@ MaybeHandle<WasmGlobalObject> WasmGlobalObject::New(
     Isolate* isolate, MaybeHandle<JSArrayBuffer> maybe_untagged_buffer,
     MaybeHandle<FixedArray> maybe_tagged_buffer, wasm::ValueType type,
     int32_t offset, bool is_mutable) {
+  WasmJs::Install(isolate, false);
   Handle<JSFunction> global_ctor(
       isolate->native_context()->wasm_global_constructor(), isolate);
   auto global_obj = Handle<WasmGlobalObject>::cast(
@@ -1176,6 +1185,7 @@ const WasmModule* WasmInstanceObject::module() {
 
 Handle<WasmInstanceObject> WasmInstanceObject::New(
     Isolate* isolate, Handle<WasmModuleObject> module_object) {
+  WasmJs::Install(isolate, false);
   Handle<JSFunction> instance_cons(
       isolate->native_context()->wasm_instance_constructor(), isolate);
   Handle<JSObject> instance_object =
@@ -1222,6 +1232,8 @@ Handle<WasmInstanceObject> WasmInstanceObject::New(
   instance->set_managed_object_maps(*isolate->factory()->empty_fixed_array());
   instance->set_num_liftoff_function_calls_array(
       module_object->native_module()->num_liftoff_function_calls_array());
+  instance->set_num_liftoff_loop_iterations_array(
+      module_object->native_module()->num_liftoff_loop_iterations_array());
 
   // Insert the new instance into the scripts weak list of instances. This list
   // is used for breakpoints affecting all instances belonging to the script.
@@ -1589,6 +1601,7 @@ wasm::WasmValue WasmInstanceObject::GetGlobalValue(
 Handle<WasmExceptionObject> WasmExceptionObject::New(
     Isolate* isolate, const wasm::FunctionSig* sig,
     Handle<HeapObject> exception_tag) {
+  WasmJs::Install(isolate, false);
   Handle<JSFunction> exception_cons(
       isolate->native_context()->wasm_exception_constructor(), isolate);
 
@@ -1841,6 +1854,7 @@ Handle<WasmExportedFunction> WasmExportedFunction::New(
                    Vector<uint8_t>::cast(buffer.SubVector(0, length)))
                .ToHandleChecked();
   }
+  WasmJs::Install(isolate, false);
   Handle<Map> function_map;
   switch (instance->module()->origin) {
     case wasm::kWasmOrigin:
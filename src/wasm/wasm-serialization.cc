@@ -430,8 +430,20 @@ bool NativeModuleSerializer::Write(Writer* writer) {
 }
 
 WasmSerializer::WasmSerializer(NativeModule* native_module)
-    : native_module_(native_module),
-      code_table_(native_module->SnapshotCodeTable()) {}
+    : native_module_(native_module) {
+  // Functions still waiting for lazy deserialization have no code yet.
+  // Deserialize them now so that they are part of the snapshot.
+  if (native_module->lazy_deserialization_data()) {
+    NativeModuleModificationScope modification_scope(native_module);
+    WasmCodeRefScope code_ref_scope;
+    for (uint32_t i = native_module->num_imported_functions(),
+                  e = native_module->num_functions();
+         i < e; ++i) {
+      DeserializeLazyFunction(native_module, i);
+    }
+  }
+  code_table_ = native_module->SnapshotCodeTable();
+}
 
 size_t WasmSerializer::GetSerializedNativeModuleSize() const {
   NativeModuleSerializer serializer(native_module_, VectorOf(code_table_));
@@ -457,10 +469,12 @@ class V8_EXPORT_PRIVATE NativeModuleDeserializer {
   explicit NativeModuleDeserializer(NativeModule*);
 
   bool Read(Reader* reader);
+  WasmCode* ReadLazyCode(LazyDeserializationData* lazy_data, int fn_index);
 
  private:
   bool ReadHeader(Reader* reader);
   bool ReadCode(int fn_index, Reader* reader);
+  size_t SkipCode(Reader* reader);
 
   NativeModule* const native_module_;
   bool read_called_;
@@ -475,9 +489,25 @@ bool NativeModuleDeserializer::Read(Reader* reader) {
   DCHECK(!read_called_);
   read_called_ = true;
 
+  Vector<const byte> serialized_functions = reader->current_buffer();
   if (!ReadHeader(reader)) return false;
   uint32_t total_fns = native_module_->num_functions();
   uint32_t first_wasm_fn = native_module_->num_imported_functions();
+  if (FLAG_wasm_lazy_deserialization) {
+    // Only record where the code of each function starts, and keep a copy of
+    // the serialized data around to deserialize functions on first call.
+    std::vector<size_t> offsets(total_fns - first_wasm_fn);
+    for (uint32_t i = first_wasm_fn; i < total_fns; ++i) {
+      offsets[i - first_wasm_fn] = SkipCode(reader);
+      native_module_->UseLazyStub(i);
+    }
+    if (reader->current_size() != 0) return false;
+    native_module_->SetLazyDeserializationData(
+        std::make_unique<LazyDeserializationData>(
+            OwnedVector<const uint8_t>::Of(serialized_functions),
+            std::move(offsets)));
+    return true;
+  }
   WasmCodeRefScope wasm_code_ref_scope;
   for (uint32_t i = first_wasm_fn; i < total_fns; ++i) {
     if (!ReadCode(i, reader)) return false;
@@ -492,6 +522,40 @@ bool NativeModuleDeserializer::ReadHeader(Reader* reader) {
          imports == native_module_->num_imported_functions();
 }
 
+WasmCode* NativeModuleDeserializer::ReadLazyCode(
+    LazyDeserializationData* lazy_data, int fn_index) {
+  base::MutexGuard guard(&lazy_data->mutex_);
+  size_t& offset = lazy_data->offsets_[declared_function_index(
+      native_module_->module(), fn_index)];
+  if (offset == 0) return nullptr;
+  Reader reader(lazy_data->data_.as_vector() + offset);
+  offset = 0;
+  // The function might have been compiled in the meantime, e.g. for debugging.
+  if (native_module_->HasCode(fn_index)) return nullptr;
+  ReadCode(fn_index, &reader);
+  return native_module_->GetCode(fn_index);
+}
+
+// Skips over the serialized code of one function and returns its offset from
+// the start of the serialized functions, or 0 if the function has no code.
+// Keep in sync with {NativeModuleSerializer::WriteCode}.
+size_t NativeModuleDeserializer::SkipCode(Reader* reader) {
+  size_t offset = reader->bytes_read();
+  bool has_code = reader->Read<bool>();
+  if (!has_code) return 0;
+  // Constant pool, safepoint table, handler table and code comment offsets,
+  // unpadded binary size, stack slot count and tagged parameter slots.
+  reader->Skip(7 * sizeof(int));
+  int code_size = reader->Read<int>();
+  int reloc_size = reader->Read<int>();
+  int source_position_size = reader->Read<int>();
+  int protected_instructions_size = reader->Read<int>();
+  reader->Skip(sizeof(WasmCode::Kind) + sizeof(ExecutionTier));
+  reader->Skip(code_size + reloc_size + source_position_size +
+               protected_instructions_size);
+  return offset;
+}
+
 bool NativeModuleDeserializer::ReadCode(int fn_index, Reader* reader) {
   bool has_code = reader->Read<bool>();
   if (!has_code) {
@@ -583,6 +647,15 @@ bool NativeModuleDeserializer::ReadCode(int fn_index, Reader* reader) {
   return true;
 }
 
+WasmCode* DeserializeLazyFunction(NativeModule* native_module,
+                                  int func_index) {
+  LazyDeserializationData* lazy_data =
+      native_module->lazy_deserialization_data();
+  if (lazy_data == nullptr) return nullptr;
+  NativeModuleDeserializer deserializer(native_module);
+  return deserializer.ReadLazyCode(lazy_data, func_index);
+}
+
 bool IsSupportedVersion(Vector<const byte> header) {
   if (header.size() < WasmSerializer::kHeaderSize) return false;
   byte current_version[WasmSerializer::kHeaderSize];
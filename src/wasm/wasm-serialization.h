@@ -5,6 +5,7 @@
 #ifndef V8_WASM_WASM_SERIALIZATION_H_
 #define V8_WASM_WASM_SERIALIZATION_H_
 
+#include "src/base/platform/mutex.h"
 #include "src/wasm/wasm-objects.h"
 
 namespace v8 {
@@ -45,6 +46,37 @@ class V8_EXPORT_PRIVATE WasmSerializer {
   std::vector<WasmCode*> code_table_;
 };
 
+// Serialized code retained by a {NativeModule} deserialized with
+// --wasm-lazy-deserialization. All functions start out with the lazy compile
+// stub, and the first call of a function deserializes its code instead of
+// compiling it.
+class LazyDeserializationData {
+ public:
+  LazyDeserializationData(OwnedVector<const uint8_t> data,
+                          std::vector<size_t> offsets)
+      : data_(std::move(data)), offsets_(std::move(offsets)) {}
+
+ private:
+  friend class NativeModuleDeserializer;
+
+  // Protects {offsets_}; held while a function is being deserialized.
+  base::Mutex mutex_;
+  // The serialized functions, without the version header.
+  const OwnedVector<const uint8_t> data_;
+  // Offset of the serialized code of each declared function in {data_}, or 0
+  // if the function has no pending code.
+  std::vector<size_t> offsets_;
+
+  DISALLOW_COPY_AND_ASSIGN(LazyDeserializationData);
+};
+
+// Deserializes the pending code of function {func_index} if the module was
+// deserialized lazily. Returns nullptr if there is no pending code, i.e. the
+// function needs to be compiled. Must be called inside a
+// {WasmCodeRefScope} and a {NativeModuleModificationScope}.
+V8_EXPORT_PRIVATE WasmCode* DeserializeLazyFunction(NativeModule*,
+                                                    int func_index);
+
 // Support for deserializing WebAssembly {NativeModule} objects.
 // Checks the version header of the data against the current version.
 bool IsSupportedVersion(Vector<const byte> data);
@@ -9,9 +9,11 @@
 #include "src/base/bounded-page-allocator.h"
 #include "src/base/logging.h"
 #include "src/base/macros.h"
+#include "src/flags/flags.h"
 #include "src/utils/allocation.h"
 #include "src/zone/zone-fwd.h"
 #include "src/zone/zone-segment.h"
+#include "src/zone/zone.h"
 
 namespace v8 {
 namespace internal {
@@ -68,18 +70,54 @@ AccountingAllocator::AccountingAllocator() {
   }
 }
 
-AccountingAllocator::~AccountingAllocator() = default;
+AccountingAllocator::~AccountingAllocator() { ReleasePooledSegments(); }
+
+// static
+size_t AccountingAllocator::SegmentPoolClassSize(int size_class) {
+  DCHECK_LE(0, size_class);
+  DCHECK_LT(size_class, kSegmentPoolSizeClasses);
+  return Zone::kMinimumSegmentSize << size_class;
+}
+
+// static
+int AccountingAllocator::SegmentPoolSizeClass(size_t bytes) {
+  STATIC_ASSERT(Zone::kMinimumSegmentSize << (kSegmentPoolSizeClasses - 1) ==
+                Zone::kMaximumSegmentSize);
+  for (int size_class = 0; size_class < kSegmentPoolSizeClasses;
+       size_class++) {
+    if (bytes <= SegmentPoolClassSize(size_class)) return size_class;
+  }
+  return -1;
+}
 
 Segment* AccountingAllocator::AllocateSegment(size_t bytes,
                                               bool supports_compression) {
-  void* memory;
+  void* memory = nullptr;
   if (COMPRESS_ZONES_BOOL && supports_compression) {
     bytes = RoundUp(bytes, kZonePageSize);
     memory = AllocatePages(bounded_page_allocator_.get(), nullptr, bytes,
                            kZonePageSize, PageAllocator::kReadWrite);
 
   } else {
-    memory = AllocWithRetry(bytes);
+    int size_class = SegmentPoolSizeClass(bytes);
+    if (size_class >= 0) {
+      bytes = SegmentPoolClassSize(size_class);
+      base::MutexGuard guard(&pool_mutex_);
+      std::vector<void*>& pool = segment_pool_[size_class];
+      if (!pool.empty()) {
+        memory = pool.back();
+        pool.pop_back();
+        pooled_memory_.fetch_sub(bytes, std::memory_order_relaxed);
+      }
+    }
+    if (memory != nullptr) {
+      segment_pool_hits_.fetch_add(1, std::memory_order_relaxed);
+    } else {
+      if (size_class >= 0) {
+        segment_pool_misses_.fetch_add(1, std::memory_order_relaxed);
+      }
+      memory = AllocWithRetry(bytes);
+    }
   }
   if (memory == nullptr) return nullptr;
 
@@ -104,9 +142,28 @@ void AccountingAllocator::ReturnSegment(Segment* segment,
     CHECK(FreePages(bounded_page_allocator_.get(), segment, segment_size));
 
   } else {
+    int size_class = SegmentPoolSizeClass(segment_size);
+    if (size_class >= 0 && segment_size == SegmentPoolClassSize(size_class)) {
+      base::MutexGuard guard(&pool_mutex_);
+      std::vector<void*>& pool = segment_pool_[size_class];
+      if (pool.size() < static_cast<size_t>(FLAG_zone_segment_pool_size)) {
+        pool.push_back(segment);
+        pooled_memory_.fetch_add(segment_size, std::memory_order_relaxed);
+        return;
+      }
+    }
     free(segment);
   }
 }
 
+void AccountingAllocator::ReleasePooledSegments() {
+  base::MutexGuard guard(&pool_mutex_);
+  for (std::vector<void*>& pool : segment_pool_) {
+    for (void* memory : pool) free(memory);
+    pool.clear();
+  }
+  pooled_memory_.store(0, std::memory_order_relaxed);
+}
+
 }  // namespace internal
 }  // namespace v8
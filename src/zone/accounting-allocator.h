@@ -7,8 +7,10 @@
 
 #include <atomic>
 #include <memory>
+#include <vector>
 
 #include "src/base/macros.h"
+#include "src/base/platform/mutex.h"
 #include "src/logging/tracing-flags.h"
 
 namespace v8 {
@@ -35,6 +37,23 @@ class V8_EXPORT_PRIVATE AccountingAllocator {
   // them if the pool is already full or memory pressure is high.
   void ReturnSegment(Segment* memory, bool supports_compression);
 
+  // Frees all segments kept in the pool, e.g. on memory pressure.
+  void ReleasePooledSegments();
+
+  // Number of segment allocations that were served from the pool and that
+  // had to go to malloc although they had a pooled size.
+  size_t GetSegmentPoolHits() const {
+    return segment_pool_hits_.load(std::memory_order_relaxed);
+  }
+  size_t GetSegmentPoolMisses() const {
+    return segment_pool_misses_.load(std::memory_order_relaxed);
+  }
+
+  // Size of the free segments currently kept in the pool.
+  size_t GetPooledMemory() const {
+    return pooled_memory_.load(std::memory_order_relaxed);
+  }
+
   size_t GetCurrentMemoryUsage() const {
     return current_memory_usage_.load(std::memory_order_relaxed);
   }
@@ -70,6 +89,24 @@ class V8_EXPORT_PRIVATE AccountingAllocator {
   std::unique_ptr<VirtualMemory> reserved_area_;
   std::unique_ptr<base::BoundedPageAllocator> bounded_page_allocator_;
 
+  // Free segments that are reused by the next zones instead of going back to
+  // malloc. Zones grow their segments from Zone::kMinimumSegmentSize up to
+  // Zone::kMaximumSegmentSize, so these requests are rounded up to one of the
+  // power of two size classes in between and pooled per size class, each
+  // holding up to --zone-segment-pool-size segments.
+  static constexpr int kSegmentPoolSizeClasses = 3;
+
+  // Returns the size class for a segment of {bytes}, or -1 if segments of
+  // that size are not pooled.
+  static int SegmentPoolSizeClass(size_t bytes);
+  static size_t SegmentPoolClassSize(int size_class);
+
+  base::Mutex pool_mutex_;
+  std::vector<void*> segment_pool_[kSegmentPoolSizeClasses];
+  std::atomic<size_t> pooled_memory_{0};
+  std::atomic<size_t> segment_pool_hits_{0};
+  std::atomic<size_t> segment_pool_misses_{0};
+
   DISALLOW_COPY_AND_ASSIGN(AccountingAllocator);
 };
 
@@ -178,6 +178,12 @@ class V8_EXPORT_PRIVATE Zone final {
 
   AccountingAllocator* allocator() const { return allocator_; }
 
+  // Never allocate segments smaller than this size in bytes.
+  static const size_t kMinimumSegmentSize = 8 * KB;
+
+  // Never allocate segments larger than this size in bytes.
+  static const size_t kMaximumSegmentSize = 32 * KB;
+
 #ifdef V8_ENABLE_PRECISE_ZONE_STATS
   const TypeStats& type_stats() const { return type_stats_; }
 #endif
@@ -191,12 +197,6 @@ class V8_EXPORT_PRIVATE Zone final {
   // All pointers returned from New() are 8-byte aligned.
   static const size_t kAlignmentInBytes = 8;
 
-  // Never allocate segments smaller than this size in bytes.
-  static const size_t kMinimumSegmentSize = 8 * KB;
-
-  // Never allocate segments larger than this size in bytes.
-  static const size_t kMaximumSegmentSize = 32 * KB;
-
   // Report zone excess when allocation exceeds this limit.
   static const size_t kExcessLimit = 256 * MB;
 
@@ -2,8 +2,11 @@
 // Use of this source code is governed by a BSD-style license that can be
 // found in the LICENSE file.
 
+#include <memory>
+
 #include "include/cppgc/allocation.h"
 #include "include/cppgc/garbage-collected.h"
+#include "include/cppgc/platform.h"
 #include "src/heap/cppgc/globals.h"
 #include "src/heap/cppgc/heap.h"
 #include "test/benchmarks/cpp/cppgc/utils.h"
@@ -44,6 +47,53 @@ BENCHMARK_F(Allocate, Large)(benchmark::State& st) {
   st.SetBytesProcessed(st.iterations() * sizeof(LargeObject));
 }
 
+template <size_t kPayloadSize>
+class SizedObject final
+    : public cppgc::GarbageCollected<SizedObject<kPayloadSize>> {
+ public:
+  void Trace(cppgc::Visitor*) const {}
+  char padding[kPayloadSize];
+};
+
+std::shared_ptr<testing::TestPlatform> GetSharedPlatform() {
+  static std::shared_ptr<testing::TestPlatform> platform = [] {
+    auto platform = std::make_shared<testing::TestPlatform>();
+    cppgc::InitializeProcess(platform->GetPageAllocator());
+    return platform;
+  }();
+  return platform;
+}
+
+// Measures allocation throughput of |T| with one heap per thread. Heaps are
+// bound to a single mutator thread, so this reports how the per-heap fast
+// path and process-wide state (page allocator, GCInfo table) scale with the
+// number of allocating threads.
+template <typename T>
+void AllocateOnThreadLocalHeap(benchmark::State& st) {
+  std::unique_ptr<cppgc::Heap> heap = cppgc::Heap::Create(GetSharedPlatform());
+  {
+    Heap::NoGCScope no_gc(*Heap::From(heap.get()));
+    for (auto _ : st) {
+      benchmark::DoNotOptimize(
+          cppgc::MakeGarbageCollected<T>(heap->GetAllocationHandle()));
+    }
+  }
+  st.SetBytesProcessed(st.iterations() * sizeof(T));
+}
+
+BENCHMARK_TEMPLATE(AllocateOnThreadLocalHeap, SizedObject<16>)
+    ->ThreadRange(1, 16)
+    ->UseRealTime();
+BENCHMARK_TEMPLATE(AllocateOnThreadLocalHeap, SizedObject<48>)
+    ->ThreadRange(1, 16)
+    ->UseRealTime();
+BENCHMARK_TEMPLATE(AllocateOnThreadLocalHeap, SizedObject<112>)
+    ->ThreadRange(1, 16)
+    ->UseRealTime();
+BENCHMARK_TEMPLATE(AllocateOnThreadLocalHeap, SizedObject<240>)
+    ->ThreadRange(1, 16)
+    ->UseRealTime();
+
 }  // namespace
 }  // namespace internal
 }  // namespace cppgc
@@ -0,0 +1,72 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include <string>
+
+#include "include/v8.h"
+#include "test/benchmarks/cpp/engine/utils.h"
+#include "third_party/google_benchmark/src/include/benchmark/benchmark.h"
+
+namespace v8 {
+namespace benchmarking {
+namespace {
+
+using GC = BenchmarkWithContext;
+
+// Creates {st.range(0)} linked lists of small objects that stay reachable
+// through the global "retained".
+const char kSyntheticHeapSource[] =
+    "var retained = [];"
+    "function allocate(lists, length) {"
+    "  for (var i = 0; i < lists; i++) {"
+    "    var head = null;"
+    "    for (var j = 0; j < length; j++) {"
+    "      head = {next: head, value: j, name: 'n' + j};"
+    "    }"
+    "    retained.push(head);"
+    "  }"
+    "}";
+
+// Scavenge of a young generation holding {st.range(0)} lists of 100 live
+// objects. The heap is refilled outside of the timed region.
+BENCHMARK_DEFINE_F(GC, Scavenge)(benchmark::State& st) {
+  HandleScope handle_scope(isolate());
+  Run(kSyntheticHeapSource);
+  std::string refill =
+      "retained = []; allocate(" + std::to_string(st.range(0)) + ", 100);";
+  for (auto _ : st) {
+    st.PauseTiming();
+    {
+      HandleScope iteration_scope(isolate());
+      Run(refill.c_str());
+    }
+    st.ResumeTiming();
+    isolate()->RequestGarbageCollectionForTesting(
+        Isolate::kMinorGarbageCollection);
+  }
+}
+BENCHMARK_REGISTER_F(GC, Scavenge)->Arg(10)->Arg(100)->Arg(1000);
+
+// Full mark-compact of a heap that retains {st.range(0)} lists of 1000
+// objects across all iterations.
+BENCHMARK_DEFINE_F(GC, MarkCompact)(benchmark::State& st) {
+  HandleScope handle_scope(isolate());
+  Run(kSyntheticHeapSource);
+  std::string setup = "allocate(" + std::to_string(st.range(0)) + ", 1000);";
+  Run(setup.c_str());
+  isolate()->RequestGarbageCollectionForTesting(
+      Isolate::kFullGarbageCollection);
+  for (auto _ : st) {
+    isolate()->RequestGarbageCollectionForTesting(
+        Isolate::kFullGarbageCollection);
+  }
+  HeapStatistics stats;
+  isolate()->GetHeapStatistics(&stats);
+  st.counters["used_heap_size"] = static_cast<double>(stats.used_heap_size());
+}
+BENCHMARK_REGISTER_F(GC, MarkCompact)->Arg(10)->Arg(100)->Arg(1000);
+
+}  // namespace
+}  // namespace benchmarking
+}  // namespace v8
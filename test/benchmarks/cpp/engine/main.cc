@@ -0,0 +1,32 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include <memory>
+
+#include "include/libplatform/libplatform.h"
+#include "include/v8.h"
+#include "third_party/google_benchmark/src/include/benchmark/benchmark.h"
+
+// Runs the engine benchmarks. V8 flags are consumed first so the remaining
+// arguments can be handed to Google Benchmark, e.g. --benchmark_filter or
+// --benchmark_format=json / --benchmark_out=<file> for machine-readable
+// results. --predictable is on by default to keep runs comparable; it can
+// be overridden with --no-predictable.
+int main(int argc, char** argv) {
+  v8::V8::SetFlagsFromString("--predictable --expose-gc");
+  v8::V8::SetFlagsFromCommandLine(&argc, argv, true);
+  v8::V8::InitializeICUDefaultLocation(argv[0]);
+  v8::V8::InitializeExternalStartupData(argv[0]);
+  std::unique_ptr<v8::Platform> platform = v8::platform::NewDefaultPlatform();
+  v8::V8::InitializePlatform(platform.get());
+  v8::V8::Initialize();
+
+  benchmark::Initialize(&argc, argv);
+  if (benchmark::ReportUnrecognizedArguments(argc, argv)) return 1;
+  benchmark::RunSpecifiedBenchmarks();
+
+  v8::V8::Dispose();
+  v8::V8::ShutdownPlatform();
+  return 0;
+}
@@ -0,0 +1,171 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+#include "include/v8.h"
+#include "test/benchmarks/cpp/engine/utils.h"
+#include "third_party/google_benchmark/src/include/benchmark/benchmark.h"
+
+namespace v8 {
+namespace benchmarking {
+namespace {
+
+using Runtime = BenchmarkWithContext;
+
+// An array of 1000 small records with numbers, strings and nested arrays.
+const char kJsonObjectSource[] =
+    "Array.from({length: 1000}, (_, i) => ({"
+    "  id: i, name: 'item' + i, price: i * 1.25, tags: ['a', 'b', 'c'],"
+    "  nested: {active: i % 2 == 0, ratio: i / 1000}"
+    "}))";
+
+BENCHMARK_F(Runtime, JsonParse)(benchmark::State& st) {
+  HandleScope handle_scope(isolate());
+  Local<String> json =
+      JSON::Stringify(context(), Run(kJsonObjectSource)).ToLocalChecked();
+  for (auto _ : st) {
+    HandleScope iteration_scope(isolate());
+    benchmark::DoNotOptimize(JSON::Parse(context(), json).ToLocalChecked());
+  }
+  st.SetBytesProcessed(st.iterations() * json->Utf8Length(isolate()));
+}
+
+BENCHMARK_F(Runtime, JsonStringify)(benchmark::State& st) {
+  HandleScope handle_scope(isolate());
+  Local<Value> value = Run(kJsonObjectSource);
+  for (auto _ : st) {
+    HandleScope iteration_scope(isolate());
+    benchmark::DoNotOptimize(
+        JSON::Stringify(context(), value).ToLocalChecked());
+  }
+}
+
+// Looks up strings that are already in the string table.
+BENCHMARK_F(Runtime, InternalizeExistingString)(benchmark::State& st) {
+  HandleScope handle_scope(isolate());
+  static const int kCount = 1000;
+  std::vector<std::string> names;
+  for (int i = 0; i < kCount; i++) {
+    names.push_back("property_name_" + std::to_string(i));
+    String::NewFromUtf8(isolate(), names.back().c_str(),
+                        NewStringType::kInternalized)
+        .ToLocalChecked();
+  }
+  for (auto _ : st) {
+    HandleScope iteration_scope(isolate());
+    for (const std::string& name : names) {
+      benchmark::DoNotOptimize(
+          String::NewFromUtf8(isolate(), name.c_str(),
+                              NewStringType::kInternalized)
+              .ToLocalChecked());
+    }
+  }
+  st.SetItemsProcessed(st.iterations() * kCount);
+}
+
+// Inserts strings that are not yet in the string table.
+BENCHMARK_F(Runtime, InternalizeNewString)(benchmark::State& st) {
+  HandleScope handle_scope(isolate());
+  static const int kCount = 1000;
+  int next = 0;
+  for (auto _ : st) {
+    st.PauseTiming();
+    std::vector<std::string> names;
+    for (int i = 0; i < kCount; i++) {
+      names.push_back("fresh_name_" + std::to_string(next++));
+    }
+    st.ResumeTiming();
+    HandleScope iteration_scope(isolate());
+    for (const std::string& name : names) {
+      benchmark::DoNotOptimize(
+          String::NewFromUtf8(isolate(), name.c_str(),
+                              NewStringType::kInternalized)
+              .ToLocalChecked());
+    }
+  }
+  st.SetItemsProcessed(st.iterations() * kCount);
+}
+
+BENCHMARK_F(Runtime, ValueSerializerRoundTrip)(benchmark::State& st) {
+  HandleScope handle_scope(isolate());
+  Local<Value> value = Run(kJsonObjectSource);
+  size_t size = 0;
+  for (auto _ : st) {
+    HandleScope iteration_scope(isolate());
+    ValueSerializer serializer(isolate());
+    serializer.WriteHeader();
+    CHECK(serializer.WriteValue(context(), value).FromJust());
+    std::pair<uint8_t*, size_t> buffer = serializer.Release();
+    {
+      ValueDeserializer deserializer(isolate(), buffer.first, buffer.second);
+      CHECK(deserializer.ReadHeader(context()).FromJust());
+      benchmark::DoNotOptimize(
+          deserializer.ReadValue(context()).ToLocalChecked());
+    }
+    size = buffer.second;
+    // The default delegate allocates the buffer with realloc.
+    free(buffer.first);
+  }
+  st.SetBytesProcessed(st.iterations() * size);
+}
+
+// Property loads and stores in a JavaScript loop. The benchmark argument is
+// the number of distinct object shapes seen by the access site, which selects
+// between monomorphic, polymorphic and megamorphic inline caches.
+class PropertyAccess : public Runtime {
+ protected:
+  static const int kObjects = 64;
+  static const int kRounds = 100;
+
+  static std::string Source(int64_t shapes, bool store) {
+    std::string source = "var objects = [];\n";
+    source += "for (var i = 0; i < " + std::to_string(kObjects) + "; i++) {\n";
+    source += "  var o = {};\n";
+    source += "  o['p' + (i % " + std::to_string(shapes) + ")] = i;\n";
+    source += "  o.x = i;\n";
+    source += "  objects.push(o);\n";
+    source += "}\n";
+    source += "(function() {\n";
+    source += "  var sum = 0;\n";
+    source += "  for (var n = 0; n < " + std::to_string(kRounds) + "; n++) {\n";
+    source += "    for (var i = 0; i < objects.length; i++) {\n";
+    source += store ? "      objects[i].x = n;\n"
+                    : "      sum += objects[i].x;\n";
+    source += "    }\n";
+    source += "  }\n";
+    source += "  return sum;\n";
+    source += "})";
+    return source;
+  }
+
+  void RunAccess(benchmark::State& st, bool store) {
+    HandleScope handle_scope(isolate());
+    Local<Function> function =
+        Run(Source(st.range(0), store).c_str()).As<Function>();
+    for (auto _ : st) {
+      HandleScope iteration_scope(isolate());
+      benchmark::DoNotOptimize(
+          function->Call(context(), context()->Global(), 0, nullptr)
+              .ToLocalChecked());
+    }
+    st.SetItemsProcessed(st.iterations() * kObjects * kRounds);
+  }
+};
+
+BENCHMARK_DEFINE_F(PropertyAccess, Load)(benchmark::State& st) {
+  RunAccess(st, false);
+}
+BENCHMARK_REGISTER_F(PropertyAccess, Load)->Arg(1)->Arg(4)->Arg(16);
+
+BENCHMARK_DEFINE_F(PropertyAccess, Store)(benchmark::State& st) {
+  RunAccess(st, true);
+}
+BENCHMARK_REGISTER_F(PropertyAccess, Store)->Arg(1)->Arg(4)->Arg(16);
+
+}  // namespace
+}  // namespace benchmarking
+}  // namespace v8
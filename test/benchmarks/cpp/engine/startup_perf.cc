@@ -0,0 +1,92 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include <memory>
+#include <string>
+
+#include "include/v8.h"
+#include "src/codegen/compilation-cache.h"
+#include "src/execution/isolate.h"
+#include "test/benchmarks/cpp/engine/utils.h"
+#include "third_party/google_benchmark/src/include/benchmark/benchmark.h"
+
+namespace v8 {
+namespace benchmarking {
+namespace {
+
+using Startup = BenchmarkWithIsolate;
+using CodeCache = BenchmarkWithContext;
+
+BENCHMARK_F(Startup, IsolateNew)(benchmark::State& st) {
+  Isolate::CreateParams create_params;
+  create_params.array_buffer_allocator = allocator();
+  for (auto _ : st) {
+    Isolate* isolate = Isolate::New(create_params);
+    isolate->Dispose();
+  }
+}
+
+BENCHMARK_F(Startup, ContextNew)(benchmark::State& st) {
+  Isolate::Scope isolate_scope(isolate());
+  for (auto _ : st) {
+    HandleScope handle_scope(isolate());
+    benchmark::DoNotOptimize(Context::New(isolate()));
+    // Keep the heap from growing across iterations so that every context is
+    // created under comparable conditions.
+    st.PauseTiming();
+    isolate()->ContextDisposedNotification();
+    isolate()->LowMemoryNotification();
+    st.ResumeTiming();
+  }
+}
+
+std::string CodeCacheSource() {
+  std::string source;
+  for (int i = 0; i < 100; i++) {
+    std::string index = std::to_string(i);
+    source += "function f" + index + "(a, b) {\n" +
+              "  let sum = 0;\n" +
+              "  for (let i = 0; i < a.length; i++) sum += a[i] * b;\n" +
+              "  return { index: " + index + ", sum };\n" + "}\n";
+  }
+  return source;
+}
+
+BENCHMARK_F(CodeCache, Deserialization)(benchmark::State& st) {
+  HandleScope handle_scope(isolate());
+  // The compilation cache would otherwise answer every lookup after the
+  // first one without touching the code cache.
+  reinterpret_cast<internal::Isolate*>(isolate())
+      ->compilation_cache()
+      ->DisableScriptAndEval();
+  Local<String> source = NewString(CodeCacheSource().c_str());
+  std::unique_ptr<ScriptCompiler::CachedData> cache;
+  {
+    ScriptCompiler::Source script_source(source);
+    Local<UnboundScript> script =
+        ScriptCompiler::CompileUnboundScript(isolate(), &script_source,
+                                             ScriptCompiler::kEagerCompile)
+            .ToLocalChecked();
+    cache.reset(ScriptCompiler::CreateCodeCache(script));
+  }
+
+  for (auto _ : st) {
+    HandleScope iteration_scope(isolate());
+    // Source takes ownership of the CachedData but not of the buffer.
+    ScriptCompiler::Source script_source(
+        source, new ScriptCompiler::CachedData(
+                    cache->data, cache->length,
+                    ScriptCompiler::CachedData::BufferNotOwned));
+    benchmark::DoNotOptimize(
+        ScriptCompiler::CompileUnboundScript(isolate(), &script_source,
+                                             ScriptCompiler::kConsumeCodeCache)
+            .ToLocalChecked());
+    CHECK(!script_source.GetCachedData()->rejected);
+  }
+  st.SetBytesProcessed(st.iterations() * cache->length);
+}
+
+}  // namespace
+}  // namespace benchmarking
+}  // namespace v8
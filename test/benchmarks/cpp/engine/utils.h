@@ -0,0 +1,83 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef TEST_BENCHMARK_CPP_ENGINE_UTILS_H_
+#define TEST_BENCHMARK_CPP_ENGINE_UTILS_H_
+
+#include "include/v8.h"
+#include "src/base/logging.h"
+#include "third_party/google_benchmark/src/include/benchmark/benchmark.h"
+
+namespace v8 {
+namespace benchmarking {
+
+// Fixture providing a fresh isolate for every benchmark run. The process
+// wide V8 and platform setup is done in main.cc.
+class BenchmarkWithIsolate : public benchmark::Fixture {
+ protected:
+  void SetUp(const ::benchmark::State& state) override {
+    allocator_.reset(ArrayBuffer::Allocator::NewDefaultAllocator());
+    Isolate::CreateParams create_params;
+    create_params.array_buffer_allocator = allocator_.get();
+    isolate_ = Isolate::New(create_params);
+  }
+
+  void TearDown(const ::benchmark::State& state) override {
+    isolate_->Dispose();
+    isolate_ = nullptr;
+    allocator_.reset();
+  }
+
+  Isolate* isolate() const { return isolate_; }
+  ArrayBuffer::Allocator* allocator() const { return allocator_.get(); }
+
+ private:
+  std::unique_ptr<ArrayBuffer::Allocator> allocator_;
+  Isolate* isolate_ = nullptr;
+};
+
+// Fixture that additionally enters a context on the isolate. Benchmarks
+// still need to open a HandleScope for the handles they create.
+class BenchmarkWithContext : public BenchmarkWithIsolate {
+ protected:
+  void SetUp(const ::benchmark::State& state) override {
+    BenchmarkWithIsolate::SetUp(state);
+    isolate()->Enter();
+    HandleScope handle_scope(isolate());
+    context_.Reset(isolate(), Context::New(isolate()));
+    context()->Enter();
+  }
+
+  void TearDown(const ::benchmark::State& state) override {
+    {
+      HandleScope handle_scope(isolate());
+      context()->Exit();
+    }
+    context_.Reset();
+    isolate()->Exit();
+    BenchmarkWithIsolate::TearDown(state);
+  }
+
+  Local<Context> context() const { return context_.Get(isolate()); }
+
+  Local<String> NewString(const char* source) const {
+    return String::NewFromUtf8(isolate(), source).ToLocalChecked();
+  }
+
+  // Compiles and runs {source} in the current context. The caller has to
+  // provide a HandleScope.
+  Local<Value> Run(const char* source) const {
+    Local<Script> script =
+        Script::Compile(context(), NewString(source)).ToLocalChecked();
+    return script->Run(context()).ToLocalChecked();
+  }
+
+ private:
+  Global<Context> context_;
+};
+
+}  // namespace benchmarking
+}  // namespace v8
+
+#endif  // TEST_BENCHMARK_CPP_ENGINE_UTILS_H_
@@ -0,0 +1,84 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "include/v8.h"
+#include "src/execution/isolate.h"
+#include "src/wasm/wasm-module-builder.h"
+#include "src/wasm/wasm-opcodes.h"
+#include "src/zone/accounting-allocator.h"
+#include "src/zone/zone.h"
+#include "test/benchmarks/cpp/engine/utils.h"
+#include "test/common/wasm/flag-utils.h"
+#include "test/common/wasm/test-signatures.h"
+#include "test/common/wasm/wasm-macro-gen.h"
+#include "test/common/wasm/wasm-module-runner.h"
+#include "third_party/google_benchmark/src/include/benchmark/benchmark.h"
+
+namespace v8 {
+namespace internal {
+namespace wasm {
+namespace {
+
+// Synchronous compilation throughput of a module with {st.range(0)}
+// functions, each containing a small counting loop.
+class WasmCompile : public v8::benchmarking::BenchmarkWithContext {
+ protected:
+  // {seed} ends up in every function body so that no two iterations compile
+  // identical wire bytes, which would be served by the native module cache.
+  static void BuildWireBytes(Zone* zone, ZoneBuffer* buffer, int functions,
+                             int seed) {
+    WasmModuleBuilder* builder = zone->New<WasmModuleBuilder>(zone);
+    TestSignatures sigs;
+    for (int i = 0; i < functions; i++) {
+      WasmFunctionBuilder* f = builder->AddFunction(sigs.i_i());
+      byte code[] = {
+          WASM_LOOP(WASM_BR_IF(
+              0, WASM_TEE_LOCAL(0, WASM_I32_SUB(WASM_GET_LOCAL(0),
+                                                WASM_ONE)))),
+          WASM_I32_ADD(WASM_GET_LOCAL(0), WASM_I32V(seed)), kExprEnd};
+      f->EmitCode(code, sizeof(code));
+    }
+    builder->WriteTo(buffer);
+  }
+
+  void RunCompile(benchmark::State& st, bool liftoff) {
+    FlagScope<bool> liftoff_scope(&FLAG_liftoff, liftoff);
+    FlagScope<bool> no_tier_up(&FLAG_wasm_tier_up, false);
+    Isolate* i_isolate = reinterpret_cast<Isolate*>(isolate());
+    AccountingAllocator allocator;
+    int seed = 0;
+    size_t bytes = 0;
+    for (auto _ : st) {
+      st.PauseTiming();
+      Zone zone(&allocator, ZONE_NAME);
+      ZoneBuffer buffer(&zone);
+      BuildWireBytes(&zone, &buffer, static_cast<int>(st.range(0)), seed++);
+      bytes = buffer.size();
+      st.ResumeTiming();
+
+      v8::HandleScope handle_scope(isolate());
+      ErrorThrower thrower(i_isolate, "WasmCompile");
+      ModuleWireBytes wire_bytes(buffer.begin(), buffer.end());
+      benchmark::DoNotOptimize(
+          testing::CompileForTesting(i_isolate, &thrower, wire_bytes)
+              .ToHandleChecked());
+    }
+    st.SetBytesProcessed(st.iterations() * bytes);
+  }
+};
+
+BENCHMARK_DEFINE_F(WasmCompile, Liftoff)(benchmark::State& st) {
+  RunCompile(st, true);
+}
+BENCHMARK_REGISTER_F(WasmCompile, Liftoff)->Arg(10)->Arg(100)->Arg(1000);
+
+BENCHMARK_DEFINE_F(WasmCompile, TurboFan)(benchmark::State& st) {
+  RunCompile(st, false);
+}
+BENCHMARK_REGISTER_F(WasmCompile, TurboFan)->Arg(10)->Arg(100)->Arg(1000);
+
+}  // namespace
+}  // namespace wasm
+}  // namespace internal
+}  // namespace v8
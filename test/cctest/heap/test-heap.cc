@@ -1187,6 +1187,61 @@ TEST(TestBytecodeFlushing) {
   }
 }
 
+TEST(TestBytecodeFlushingWhenReducingMemory) {
+#ifndef V8_LITE_MODE
+  FLAG_opt = false;
+  FLAG_always_opt = false;
+  i::FLAG_optimize_for_size = false;
+#endif  // V8_LITE_MODE
+  i::FLAG_flush_bytecode = true;
+  i::FLAG_allow_natives_syntax = true;
+
+  CcTest::InitializeVM();
+  v8::Isolate* isolate = CcTest::isolate();
+  Isolate* i_isolate = CcTest::i_isolate();
+  Factory* factory = i_isolate->factory();
+
+  {
+    v8::HandleScope scope(isolate);
+    v8::Context::New(isolate)->Enter();
+    const char* source =
+        "function foo() {"
+        "  var x = 42;"
+        "  var y = 42;"
+        "  var z = x + y;"
+        "};"
+        "foo()";
+    Handle<String> foo_name = factory->InternalizeUtf8String("foo");
+
+    {
+      v8::HandleScope scope(isolate);
+      CompileRun(source);
+    }
+
+    Handle<Object> func_value =
+        Object::GetProperty(i_isolate, i_isolate->global_object(), foo_name)
+            .ToHandleChecked();
+    CHECK(func_value->IsJSFunction());
+    Handle<JSFunction> function = Handle<JSFunction>::cast(func_value);
+    CHECK(function->shared().is_compiled());
+
+    // The first GC ages the bytecode. Bytecode that has not been executed
+    // since then is flushed by the next GC that reduces memory, long before
+    // regular GCs would consider it old.
+    CcTest::heap()->CollectAllGarbage(Heap::kReduceMemoryFootprintMask,
+                                      GarbageCollectionReason::kTesting);
+    CHECK(function->shared().is_compiled());
+    CcTest::heap()->CollectAllGarbage(Heap::kReduceMemoryFootprintMask,
+                                      GarbageCollectionReason::kTesting);
+    CHECK(!function->shared().is_compiled());
+    CHECK(!function->is_compiled());
+
+    CompileRun("foo()");
+    CHECK(function->shared().is_compiled());
+    CHECK(function->is_compiled());
+  }
+}
+
 HEAP_TEST(Regress10560) {
   i::FLAG_flush_bytecode = true;
   i::FLAG_allow_natives_syntax = true;
@@ -1457,6 +1512,60 @@ TEST(CompilationCacheCachingBehavior) {
   }
 }
 
+TEST(CompilationCacheRetainsOldEvalEntries) {
+  // If we do not have the compilation cache turned off, this test is invalid.
+  if (!FLAG_compilation_cache) {
+    return;
+  }
+  FLAG_compilation_cache_eval_retained_entries = 16;
+  CcTest::InitializeVM();
+  Isolate* isolate = CcTest::i_isolate();
+  Factory* factory = isolate->factory();
+  CompilationCache* compilation_cache = isolate->compilation_cache();
+
+  v8::HandleScope scope(CcTest::isolate());
+  const char* raw_source = "(function() { return 42; })";
+  Handle<String> source = factory->InternalizeUtf8String(raw_source);
+  Handle<Context> native_context = isolate->native_context();
+  Handle<SharedFunctionInfo> outer_info(
+      native_context->empty_function().shared(), isolate);
+
+  // Indirect eval compiles in the native context. The second compile
+  // replaces the hash probe of the first one with the actual entry.
+  {
+    v8::HandleScope scope(CcTest::isolate());
+    CompileRun(
+        "var src = '(function() { return 42; })';"
+        "(0, eval)(src);"
+        "(0, eval)(src);");
+  }
+
+  {
+    v8::HandleScope scope(CcTest::isolate());
+    InfoCellPair cached = compilation_cache->LookupEval(
+        source, outer_info, native_context, LanguageMode::kSloppy, 0);
+    CHECK(cached.has_shared());
+
+    // Progress code age until it's old and ready for GC.
+    Handle<SharedFunctionInfo> shared(cached.shared(), isolate);
+    CHECK(shared->HasBytecodeArray());
+    const int kAgingThreshold = 6;
+    for (int i = 0; i < kAgingThreshold; i++) {
+      shared->GetBytecodeArray().MakeOlder();
+    }
+  }
+
+  CcTest::CollectAllGarbage();
+
+  {
+    v8::HandleScope scope(CcTest::isolate());
+    // The entry is retained since the cache is below its retention limit.
+    InfoCellPair cached = compilation_cache->LookupEval(
+        source, outer_info, native_context, LanguageMode::kSloppy, 0);
+    CHECK(cached.has_shared());
+  }
+}
+
 
 static void OptimizeEmptyFunction(const char* name) {
   HandleScope scope(CcTest::i_isolate());
@@ -5107,6 +5216,46 @@ HEAP_TEST(NumberStringCacheSize) {
            heap->number_string_cache().length());
 }
 
+HEAP_TEST(NumberStringCacheGrowsAdaptively) {
+  CcTest::InitializeVM();
+  Isolate* isolate = CcTest::i_isolate();
+  Factory* factory = isolate->factory();
+  Heap* heap = isolate->heap();
+  HandleScope scope(isolate);
+  heap->set_number_string_cache(*factory->NewFixedArray(
+      Heap::kInitialNumberStringCacheSize * 2, AllocationType::kOld));
+  heap->number_string_cache_collisions_ = 0;
+
+  // Smis that are multiples of the initial capacity all hash to the same
+  // entry. The cache only grows after a number of collisions.
+  const int kEntries = Heap::kInitialNumberStringCacheSize;
+  const int kCollisionsToGrow =
+      kEntries / Heap::kNumberStringCacheCollisionsPerEntry;
+  factory->NumberToString(handle(Smi::FromInt(1), isolate));
+  for (int i = 0; i < kCollisionsToGrow; i++) {
+    factory->NumberToString(handle(Smi::FromInt(i * kEntries), isolate));
+    CHECK_EQ(kEntries * 2, heap->number_string_cache().length());
+  }
+  factory->NumberToString(
+      handle(Smi::FromInt(kCollisionsToGrow * kEntries), isolate));
+  int grown_length = heap->number_string_cache().length();
+  CHECK_EQ(
+      Min(kEntries * 2 * Heap::kNumberStringCacheGrowthFactor,
+          heap->MaxNumberToStringCacheSize()),
+      grown_length);
+
+  // Existing entries are rehashed into the grown cache.
+  int hash = 1 & ((grown_length >> 1) - 1);
+  CHECK_EQ(Smi::FromInt(1), heap->number_string_cache().get(hash * 2));
+
+  // The cache never grows past its maximum size.
+  for (int i = 0; i < heap->MaxNumberToStringCacheSize(); i++) {
+    factory->NumberToString(handle(Smi::FromInt(i * kEntries), isolate));
+  }
+  CHECK_EQ(heap->MaxNumberToStringCacheSize(),
+           heap->number_string_cache().length());
+}
+
 
 TEST(Regress3877) {
   CcTest::InitializeVM();
@@ -6838,6 +6987,70 @@ UNINITIALIZED_TEST(OutOfMemoryLargeObjects) {
   reinterpret_cast<v8::Isolate*>(isolate)->Dispose();
 }
 
+struct SoftHeapLimitState {
+  int invocations;
+  size_t heap_size;
+  size_t current_heap_limit;
+};
+
+void SoftHeapLimitCallback(void* raw_state, size_t heap_size,
+                           size_t current_heap_limit) {
+  SoftHeapLimitState* state = static_cast<SoftHeapLimitState*>(raw_state);
+  state->invocations++;
+  state->heap_size = heap_size;
+  state->current_heap_limit = current_heap_limit;
+}
+
+size_t UnexpectedNearHeapLimitCallback(void* data, size_t current_heap_limit,
+                                       size_t initial_heap_limit) {
+  CHECK_WITH_MSG(false, "Soft heap limit callback was not invoked in time");
+  return current_heap_limit;
+}
+
+UNINITIALIZED_TEST(SoftHeapLimit) {
+  if (FLAG_stress_incremental_marking) return;
+#ifdef VERIFY_HEAP
+  if (FLAG_verify_heap) return;
+#endif
+  const size_t kOldGenerationLimit = 50 * MB;
+  FLAG_max_old_space_size = kOldGenerationLimit / MB;
+  v8::Isolate::CreateParams create_params;
+  create_params.array_buffer_allocator = CcTest::array_buffer_allocator();
+  v8::Isolate* v8_isolate = v8::Isolate::New(create_params);
+  Isolate* isolate = reinterpret_cast<Isolate*>(v8_isolate);
+  Heap* heap = isolate->heap();
+  Factory* factory = isolate->factory();
+  SoftHeapLimitState state = {0, 0, 0};
+  heap->AddNearHeapLimitCallback(UnexpectedNearHeapLimitCallback, nullptr);
+  v8_isolate->SetSoftHeapLimitCallback(SoftHeapLimitCallback, &state, 0.5);
+  {
+    HandleScope handle_scope(isolate);
+    while (state.invocations == 0) {
+      factory->NewFixedArray(100);
+    }
+    CHECK_LT(state.current_heap_limit / 2, state.heap_size);
+    CHECK_GT(state.current_heap_limit, state.heap_size);
+    CHECK(heap->ShouldOptimizeForMemoryUsage());
+
+    // The callback is not invoked again while the limit stays exceeded.
+    CcTest::CollectAllGarbage(isolate);
+    CHECK_EQ(1, state.invocations);
+  }
+
+  // Once the heap size drops below the soft limit, the callback is invoked
+  // again the next time the limit is exceeded.
+  CcTest::CollectAllGarbage(isolate);
+  {
+    HandleScope handle_scope(isolate);
+    while (state.invocations == 1) {
+      factory->NewFixedArray(100);
+    }
+  }
+  v8_isolate->SetSoftHeapLimitCallback(nullptr, nullptr, 0.5);
+  heap->RemoveNearHeapLimitCallback(UnexpectedNearHeapLimitCallback, 0);
+  v8_isolate->Dispose();
+}
+
 UNINITIALIZED_TEST(RestoreHeapLimit) {
   if (FLAG_stress_incremental_marking) return;
 #ifdef VERIFY_HEAP
@@ -7156,6 +7369,55 @@ TEST(GarbageCollectionWithLocalHeap) {
   CcTest::CollectGarbage(OLD_SPACE);
 }
 
+TEST(JsonParsePretenuringWithHighSurvival) {
+  FLAG_json_parse_pretenure_threshold = 16;
+  ManualGCScope manual_gc_scope;
+  CcTest::InitializeVM();
+  Isolate* isolate = CcTest::i_isolate();
+  Heap* heap = isolate->heap();
+  HandleScope handle_scope(isolate);
+  v8::HandleScope scope(CcTest::isolate());
+  const char* source = "JSON.parse('[{\"a\":\"some string\"},[1,2,3]]')";
+
+  heap->tracer()->ResetSurvivalEvents();
+  Handle<Object> young = v8::Utils::OpenHandle(*CompileRun(source));
+  CHECK(Heap::InYoungGeneration(*young));
+
+  heap->tracer()->AddSurvivalRatio(100.0);
+  Handle<Object> old = v8::Utils::OpenHandle(*CompileRun(source));
+  CHECK(!Heap::InYoungGeneration(*old));
+  Handle<Object> element =
+      JSReceiver::GetElement(isolate, Handle<JSReceiver>::cast(old), 0)
+          .ToHandleChecked();
+  CHECK(!Heap::InYoungGeneration(*element));
+  heap->tracer()->ResetSurvivalEvents();
+}
+
+TEST(YoungSurvivorsByInstanceType) {
+  FLAG_track_young_survivors_by_type = true;
+  ManualGCScope manual_gc_scope;
+  CcTest::InitializeVM();
+  Isolate* isolate = CcTest::i_isolate();
+  Heap* heap = isolate->heap();
+  Factory* factory = isolate->factory();
+  HandleScope handle_scope(isolate);
+
+  Handle<FixedArray> survivor = factory->NewFixedArray(16);
+  CHECK(Heap::InYoungGeneration(*survivor));
+  CcTest::CollectGarbage(NEW_SPACE);
+
+  const SurvivorStatsByType::Entry entry =
+      heap->YoungSurvivorsAtLastGC(FIXED_ARRAY_TYPE);
+  CHECK_LE(1u, entry.count);
+  CHECK_LE(static_cast<size_t>(survivor->Size()), entry.size);
+
+  v8::HeapObjectStatistics statistics;
+  CHECK(CcTest::isolate()->GetYoungSurvivorStatisticsAtLastGC(
+      &statistics, FIXED_ARRAY_TYPE));
+  CHECK_EQ(entry.size, statistics.object_size());
+  CHECK_EQ(0, strcmp("FIXED_ARRAY_TYPE", statistics.object_type()));
+}
+
 TEST(Regress10698) {
   ManualGCScope manual_gc_scope;
   CcTest::InitializeVM();
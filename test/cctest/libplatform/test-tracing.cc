@@ -635,7 +635,9 @@ class TestListener : public TraceEventListener {
 
 class TracingTestHarness {
  public:
-  TracingTestHarness() {
+  explicit TracingTestHarness(
+      TracingController::OutputFormat format =
+          TracingController::OutputFormat::kJSON) {
     old_platform_ = i::V8::GetCurrentPlatform();
     default_platform_ = v8::platform::NewDefaultPlatform();
     i::V8::SetPlatformForTesting(default_platform_.get());
@@ -645,7 +647,7 @@ class TracingTestHarness {
     static_cast<v8::platform::DefaultPlatform*>(default_platform_.get())
         ->SetTracingController(std::move(tracing));
 
-    tracing_controller_->InitializeForPerfetto(&perfetto_json_stream_);
+    tracing_controller_->InitializeForPerfetto(&perfetto_json_stream_, format);
     tracing_controller_->SetTraceEventListenerForTesting(&listener_);
   }
 
@@ -834,6 +836,27 @@ TEST(MultipleArgsAndCopy) {
   for (size_t i = 0; i < 20; i++) CHECK_EQ("E:.", harness.get_event(24 + i));
 }
 
+TEST(ProtoOutput) {
+  TracingTestHarness harness(TracingController::OutputFormat::kProto);
+  harness.StartTracing();
+
+  {
+    TRACE_EVENT0("v8", "test1");
+    TRACE_EVENT1("v8", "test2", "arg1", 42);
+  }
+
+  harness.StopTracing();
+
+  // The stream holds the binary trace, which decodes to the same events.
+  std::string proto = harness.perfetto_json_stream();
+  TestListener listener;
+  listener.ParseFromArray(std::vector<char>(proto.begin(), proto.end()));
+  CHECK_EQ(harness.events_size(), listener.events_size());
+  CHECK_EQ(4, listener.events_size());
+  CHECK_EQ("B:v8.test1", listener.get_event(0));
+  CHECK_EQ("B:v8.test2(arg1=(int)42)", listener.get_event(1));
+}
+
 TEST(JsonIntegrationTest) {
   // Check that tricky values are rendered correctly in the JSON output.
   double big_num = 1e100;
@@ -105,5 +105,29 @@ TEST(AllThePushbacks) {
   }
 }
 
+TEST(SingleLineCommentTerminators) {
+  // Place each line terminator at every offset within a block of four code
+  // units, so that all lanes of the word-at-a-time skipping are exercised.
+  const uint16_t terminators[] = {'\n', '\r', 0x2028, 0x2029};
+  for (uint16_t terminator : terminators) {
+    for (size_t comment_length = 0; comment_length < 12; comment_length++) {
+      std::vector<uint16_t> source = {'/', '/'};
+      for (size_t i = 0; i < comment_length; i++) {
+        source.push_back(i % 3 == 0 ? '\t' : 'a' + (i % 26));
+      }
+      source.push_back(terminator);
+      source.push_back('x');
+
+      auto stream = ScannerStream::ForTesting(source.data(), source.size());
+      Scanner scanner(stream.get(),
+                      UnoptimizedCompileFlags::ForTest(CcTest::i_isolate()));
+      scanner.Initialize();
+      CHECK_TOK(Token::IDENTIFIER, scanner.Next());
+      CHECK_EQ(static_cast<int>(source.size()) - 1, scanner.location().beg_pos);
+      CHECK_TOK(Token::EOS, scanner.Next());
+    }
+  }
+}
+
 }  // namespace internal
 }  // namespace v8
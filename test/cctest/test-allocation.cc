@@ -22,6 +22,7 @@ using v8::Task;
 
 #include "src/utils/allocation.h"
 #include "src/zone/accounting-allocator.h"
+#include "src/zone/zone.h"
 
 // ASAN isn't configured to return nullptr, so skip all of these tests.
 #if !defined(V8_USE_ADDRESS_SANITIZER) && !defined(MEMORY_SANITIZER) && \
@@ -135,6 +136,80 @@ TEST(AccountingAllocatorCurrentAndMax) {
   CHECK(!platform.oom_callback_called);
 }
 
+TEST(AccountingAllocatorReusesPooledSegments) {
+  AllocationPlatform platform;
+  v8::internal::AccountingAllocator allocator;
+  const bool support_compression = false;
+  const size_t size = v8::internal::Zone::kMinimumSegmentSize;
+  v8::internal::Segment* segment =
+      allocator.AllocateSegment(size, support_compression);
+  CHECK_NOT_NULL(segment);
+  allocator.ReturnSegment(segment, support_compression);
+  // Pooled segments do not count as used memory.
+  CHECK_EQ(0, allocator.GetCurrentMemoryUsage());
+
+  v8::internal::Segment* reused =
+      allocator.AllocateSegment(size, support_compression);
+  CHECK_EQ(segment, reused);
+  CHECK_EQ(size, reused->total_size());
+  CHECK_EQ(size, allocator.GetCurrentMemoryUsage());
+  allocator.ReturnSegment(reused, support_compression);
+
+  allocator.ReleasePooledSegments();
+  v8::internal::Segment* fresh =
+      allocator.AllocateSegment(size, support_compression);
+  CHECK_NOT_NULL(fresh);
+  allocator.ReturnSegment(fresh, support_compression);
+  CHECK(!platform.oom_callback_called);
+}
+
+TEST(AccountingAllocatorPoolsSegmentSizeClasses) {
+  AllocationPlatform platform;
+  v8::internal::AccountingAllocator allocator;
+  const bool support_compression = false;
+  const size_t min_size = v8::internal::Zone::kMinimumSegmentSize;
+  const size_t max_size = v8::internal::Zone::kMaximumSegmentSize;
+
+  // Sizes between the size classes are rounded up.
+  v8::internal::Segment* segment =
+      allocator.AllocateSegment(min_size + 1, support_compression);
+  CHECK_NOT_NULL(segment);
+  CHECK_EQ(2 * min_size, segment->total_size());
+  CHECK_EQ(0, allocator.GetSegmentPoolHits());
+  CHECK_EQ(1, allocator.GetSegmentPoolMisses());
+  allocator.ReturnSegment(segment, support_compression);
+  CHECK_EQ(2 * min_size, allocator.GetPooledMemory());
+
+  // A segment of the same size class is served from the pool, one of another
+  // size class is not.
+  v8::internal::Segment* reused =
+      allocator.AllocateSegment(2 * min_size, support_compression);
+  CHECK_EQ(segment, reused);
+  CHECK_EQ(1, allocator.GetSegmentPoolHits());
+  CHECK_EQ(0, allocator.GetPooledMemory());
+  v8::internal::Segment* other =
+      allocator.AllocateSegment(max_size, support_compression);
+  CHECK_EQ(max_size, other->total_size());
+  CHECK_EQ(2, allocator.GetSegmentPoolMisses());
+
+  // Segments larger than the largest size class are neither rounded up nor
+  // pooled.
+  v8::internal::Segment* large =
+      allocator.AllocateSegment(max_size + 1, support_compression);
+  CHECK_EQ(max_size + 1, large->total_size());
+  CHECK_EQ(2, allocator.GetSegmentPoolMisses());
+
+  allocator.ReturnSegment(reused, support_compression);
+  allocator.ReturnSegment(other, support_compression);
+  allocator.ReturnSegment(large, support_compression);
+  CHECK_EQ(2 * min_size + max_size, allocator.GetPooledMemory());
+  CHECK_EQ(0, allocator.GetCurrentMemoryUsage());
+
+  allocator.ReleasePooledSegments();
+  CHECK_EQ(0, allocator.GetPooledMemory());
+  CHECK(!platform.oom_callback_called);
+}
+
 TEST(MallocedOperatorNewOOM) {
   AllocationPlatform platform;
   CHECK(!platform.oom_callback_called);
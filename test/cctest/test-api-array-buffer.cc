@@ -933,3 +933,60 @@ TEST(BackingStore_ReallocateShared) {
       v8::BackingStore::Reallocate(isolate, std::move(backing_store), 10);
   CHECK(new_backing_store->IsShared());
 }
+
+class BatchingAllocator final : public v8::ArrayBuffer::Allocator {
+ public:
+  BatchingAllocator() : allocator_(NewDefaultAllocator()) {}
+
+  void* Allocate(size_t length) override {
+    return allocator_->Allocate(length);
+  }
+  void* AllocateUninitialized(size_t length) override {
+    return allocator_->AllocateUninitialized(length);
+  }
+  void Free(void* data, size_t length) override {
+    allocator_->Free(data, length);
+  }
+  void FreeBatch(void** data, const size_t* lengths, size_t count) override {
+    batch_count_++;
+    batched_blocks_ += count;
+    v8::ArrayBuffer::Allocator::FreeBatch(data, lengths, count);
+  }
+
+  size_t batch_count() const { return batch_count_; }
+  size_t batched_blocks() const { return batched_blocks_; }
+
+ private:
+  std::unique_ptr<v8::ArrayBuffer::Allocator> allocator_;
+  size_t batch_count_ = 0;
+  size_t batched_blocks_ = 0;
+};
+
+TEST(ArrayBuffer_BatchFreeDuringSweeping) {
+  if (!V8_ARRAY_BUFFER_EXTENSION_BOOL) return;
+  i::FLAG_concurrent_array_buffer_sweeping = false;
+  i::FLAG_batch_array_buffer_free = true;
+  const size_t kBuffers = 16;
+  std::shared_ptr<BatchingAllocator> allocator =
+      std::make_shared<BatchingAllocator>();
+
+  v8::Isolate::CreateParams create_params;
+  create_params.array_buffer_allocator_shared = allocator;
+  v8::Isolate* isolate = v8::Isolate::New(create_params);
+  {
+    v8::Isolate::Scope isolate_scope(isolate);
+    v8::HandleScope handle_scope(isolate);
+    v8::Context::Scope context_scope(Context::New(isolate));
+    {
+      v8::HandleScope inner_scope(isolate);
+      for (size_t i = 0; i < kBuffers; i++) {
+        v8::ArrayBuffer::New(isolate, 64);
+      }
+    }
+    reinterpret_cast<i::Isolate*>(isolate)->heap()->CollectAllAvailableGarbage(
+        i::GarbageCollectionReason::kTesting);
+    CHECK_LE(1, allocator->batch_count());
+    CHECK_LE(kBuffers, allocator->batched_blocks());
+  }
+  isolate->Dispose();
+}
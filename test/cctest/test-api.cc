@@ -53,6 +53,7 @@
 #include "src/heap/heap-inl.h"
 #include "src/heap/incremental-marking.h"
 #include "src/heap/local-allocator.h"
+#include "src/ic/stub-cache.h"
 #include "src/logging/metrics.h"
 #include "src/objects/feedback-vector-inl.h"
 #include "src/objects/feedback-vector.h"
@@ -4943,6 +4944,75 @@ THREADED_TEST(Array) {
                   .FromJust());
 }
 
+namespace {
+
+v8::Array::CallbackResult SumUntilNegative(uint32_t index,
+                                           Local<Value> element, void* data) {
+  double value = element.As<v8::Number>()->Value();
+  if (value < 0) return v8::Array::CallbackResult::kBreak;
+  *reinterpret_cast<double*>(data) += value;
+  return v8::Array::CallbackResult::kContinue;
+}
+
+v8::Array::CallbackResult ThrowAtIndexOne(uint32_t index, Local<Value> element,
+                                          void* data) {
+  if (index < 1) return v8::Array::CallbackResult::kContinue;
+  CcTest::isolate()->ThrowException(v8_str("stop"));
+  return v8::Array::CallbackResult::kException;
+}
+
+}  // namespace
+
+THREADED_TEST(ArrayBulkAccess) {
+  LocalContext context;
+  v8::Isolate* isolate = context->GetIsolate();
+  v8::HandleScope scope(isolate);
+
+  const double doubles[] = {1.5, 2, -0.5, 4};
+  Local<v8::Array> array = v8::Array::New(isolate, doubles, 4);
+  CHECK_EQ(4u, array->Length());
+  CHECK(Utils::OpenHandle(*array)->HasDoubleElements());
+  double copied[4];
+  CHECK(array->CopyElementsTo(0, 4, copied));
+  for (int i = 0; i < 4; i++) CHECK_EQ(doubles[i], copied[i]);
+  CHECK(array->CopyElementsTo(1, 2, copied));
+  CHECK_EQ(2, copied[0]);
+  CHECK_EQ(-0.5, copied[1]);
+  CHECK(!array->CopyElementsTo(3, 2, copied));
+
+  // Smi elements can be copied as doubles too, but holes and objects cannot.
+  Local<v8::Array> smis = CompileRun("[1, 2, 3]").As<v8::Array>();
+  CHECK(smis->CopyElementsTo(0, 3, copied));
+  CHECK_EQ(3, copied[2]);
+  CHECK(!CompileRun("[1, , 3]").As<v8::Array>()->CopyElementsTo(0, 3, copied));
+  CHECK(!CompileRun("[1, {}]").As<v8::Array>()->CopyElementsTo(0, 2, copied));
+
+  // Holes are looked up on the prototype chain.
+  Local<v8::Array> holey = CompileRun(
+                               "Array.prototype[1] = 'proto';"
+                               "var holey = [{}, , 'c'];"
+                               "holey")
+                               .As<v8::Array>();
+  Local<Value> values[4];
+  CHECK(holey->CopyElementsTo(context.local(), 0, 4, values).FromJust());
+  CHECK(values[0]->IsObject());
+  CHECK(v8_str("proto")->SameValue(values[1]));
+  CHECK(v8_str("c")->SameValue(values[2]));
+  CHECK(values[3]->IsUndefined());
+  CompileRun("delete Array.prototype[1];");
+
+  double sum = 0;
+  CHECK(array->Iterate(context.local(), SumUntilNegative, &sum).IsJust());
+  CHECK_EQ(3.5, sum);
+  sum = 0;
+  CHECK(smis->Iterate(context.local(), SumUntilNegative, &sum).IsJust());
+  CHECK_EQ(6, sum);
+
+  v8::TryCatch try_catch(isolate);
+  CHECK(smis->Iterate(context.local(), ThrowAtIndexOne, nullptr).IsNothing());
+  CHECK(try_catch.HasCaught());
+}
+
 
 void HandleF(const v8::FunctionCallbackInfo<v8::Value>& args) {
   v8::EscapableHandleScope scope(args.GetIsolate());
@@ -16629,6 +16699,74 @@ TEST(GetHeapSpaceStatistics) {
   CHECK_EQ(total_physical_size, heap_statistics.total_physical_size());
 }
 
+TEST(GetMapTransitionStatistics) {
+  LocalContext c1;
+  v8::Isolate* isolate = c1->GetIsolate();
+  v8::HandleScope scope(isolate);
+  CHECK(!isolate->GetMapTransitionStatistics(nullptr));
+
+  v8::MapTransitionStatistics before;
+  CHECK(isolate->GetMapTransitionStatistics(&before));
+  CHECK_LT(0u, before.number_of_maps());
+  CHECK_LE(before.number_of_root_maps(), before.number_of_maps());
+
+  // A chain of 40 property transitions that fans out into 10 siblings at
+  // the end, plus a dictionary-mode object.
+  CompileRun(
+      "var chain = '';"
+      "for (var j = 0; j < 40; j++) chain += 'o.chain_property_' + j + '=0;';"
+      "var objects = [];"
+      "for (var i = 0; i < 10; i++) {"
+      "  var o = {};"
+      "  new Function('o', chain + 'o.leaf_' + i + '=0;')(o);"
+      "  objects.push(o);"
+      "}"
+      "var dict = {a: 1, b: 2};"
+      "delete dict.a;");
+
+  v8::MapTransitionStatistics after;
+  CHECK(isolate->GetMapTransitionStatistics(&after));
+  CHECK_LT(before.number_of_maps() + 40, after.number_of_maps());
+  CHECK_LE(41u, after.max_transition_depth());
+  CHECK_LE(10u, after.max_transitions_per_map());
+  CHECK_LT(0u, after.number_of_dictionary_maps());
+}
+
+TEST(GetCpuTimeStatistics) {
+  i::FLAG_account_isolate_cpu_time = true;
+  v8::Isolate::CreateParams create_params;
+  create_params.array_buffer_allocator = CcTest::array_buffer_allocator();
+  v8::Isolate* isolate = v8::Isolate::New(create_params);
+  CHECK(!isolate->GetCpuTimeStatistics(nullptr));
+
+  v8::CpuTimeStatistics inside;
+  {
+    v8::Isolate::Scope isolate_scope(isolate);
+    v8::HandleScope handle_scope(isolate);
+    v8::Local<v8::Context> context = v8::Context::New(isolate);
+    v8::Context::Scope context_scope(context);
+    CompileRun(
+        "var start = Date.now();"
+        "var x = 0;"
+        "while (Date.now() - start < 20) x++;");
+    isolate->SetBackgroundTasksThrottled(true);
+    reinterpret_cast<i::Isolate*>(isolate)->heap()->CollectAllGarbage(
+        i::Heap::kNoGCFlags, i::GarbageCollectionReason::kTesting);
+    isolate->SetBackgroundTasksThrottled(false);
+    CHECK(isolate->GetCpuTimeStatistics(&inside));
+  }
+  if (v8::base::ThreadTicks::IsSupported()) {
+    CHECK_LT(0, inside.main_thread_cpu_time_us());
+  }
+  CHECK_LE(inside.main_thread_cpu_time_us(), inside.total_cpu_time_us());
+
+  v8::CpuTimeStatistics outside;
+  CHECK(isolate->GetCpuTimeStatistics(&outside));
+  CHECK_LE(inside.main_thread_cpu_time_us(),
+           outside.main_thread_cpu_time_us());
+  isolate->Dispose();
+}
+
 TEST(NumberOfNativeContexts) {
   static const size_t kNumTestContexts = 10;
   i::Isolate* isolate = CcTest::i_isolate();
@@ -20989,6 +21127,59 @@ THREADED_TEST(JSONParseArray) {
                      i::PACKED_ELEMENTS);
 }
 
+THREADED_TEST(JSONParseUtf8) {
+  LocalContext context;
+  v8::Isolate* isolate = context->GetIsolate();
+  HandleScope scope(isolate);
+  Local<Object> global = context->Global();
+
+  // ASCII input is parsed in place. The buffer may go away right after.
+  {
+    char* ascii = i::StrDup("{\"x\":[1,\"abc\"]}");
+    Local<Value> obj =
+        v8::JSON::ParseUtf8(context.local(), ascii, strlen(ascii))
+            .ToLocalChecked();
+    memset(ascii, 'z', strlen(ascii));
+    i::DeleteArray(ascii);
+    CcTest::CollectAllGarbage();
+    global->Set(context.local(), v8_str("obj"), obj).FromJust();
+    ExpectString("JSON.stringify(obj)", "{\"x\":[1,\"abc\"]}");
+  }
+
+  // Non-ASCII input is decoded.
+  {
+    const char utf8[] = "[\"\xCF\x80\", \"\xC3\xA9\"]";
+    Local<Value> obj =
+        v8::JSON::ParseUtf8(context.local(), utf8, strlen(utf8))
+            .ToLocalChecked();
+    global->Set(context.local(), v8_str("obj"), obj).FromJust();
+    ExpectInt32("obj[0].charCodeAt(0)", 0x3C0);
+    ExpectInt32("obj[1].charCodeAt(0)", 0xE9);
+  }
+
+  // Syntax errors are reported against a copy of the source.
+  {
+    v8::TryCatch try_catch(isolate);
+    char* invalid = i::StrDup("{\"x\":}");
+    CHECK(v8::JSON::ParseUtf8(context.local(), invalid, strlen(invalid))
+              .IsEmpty());
+    i::DeleteArray(invalid);
+    CHECK(try_catch.HasCaught());
+    Local<v8::Message> message = try_catch.Message();
+    v8::String::Utf8Value line(isolate,
+                               message->GetSourceLine(context.local())
+                                   .ToLocalChecked());
+    CHECK_EQ(0, strcmp("{\"x\":}", *line));
+  }
+
+  // Empty input is a syntax error, too.
+  {
+    v8::TryCatch try_catch(isolate);
+    CHECK(v8::JSON::ParseUtf8(context.local(), "", 0).IsEmpty());
+    CHECK(try_catch.HasCaught());
+  }
+}
+
 THREADED_TEST(JSONStringifyObject) {
   LocalContext context;
   HandleScope scope(context->GetIsolate());
@@ -21966,6 +22157,74 @@ THREADED_TEST(ObjectNew) {
   }
 }
 
+namespace {
+
+void CheckOwnProperties(LocalContext* env, Local<v8::Object> obj,
+                        const char** names, Local<v8::Value>* values,
+                        uint32_t length) {
+  Local<Array> keys = obj->GetOwnPropertyNames(env->local()).ToLocalChecked();
+  CHECK_EQ(length, keys->Length());
+  for (uint32_t i = 0; i < length; ++i) {
+    CHECK(v8_str(names[i])->SameValue(
+        keys->Get(env->local(), i).ToLocalChecked()));
+    CHECK(values[i]->SameValue(
+        obj->Get(env->local(), v8_str(names[i])).ToLocalChecked()));
+  }
+}
+
+}  // namespace
+
+THREADED_TEST(ObjectNewWithShape) {
+  LocalContext env;
+  v8::Isolate* isolate = env->GetIsolate();
+  v8::HandleScope scope(isolate);
+  const char* names[] = {"a", "b", "c"};
+  Local<v8::Object> shape =
+      CompileRun("({a: 1, b: 'x', c: 2.5})").As<v8::Object>();
+  {
+    // Values that fit the fields of the shape reuse its map.
+    Local<v8::Value> values[] = {v8_num(2), v8_str("y"), v8_num(3.5)};
+    Local<v8::Object> obj =
+        v8::Object::NewWithShape(isolate, shape, values, arraysize(values));
+    Verify(isolate, obj);
+    CHECK_EQ(Utils::OpenHandle(*obj)->map(),
+             Utils::OpenHandle(*shape)->map());
+    CHECK(obj->GetPrototype()->SameValue(shape->GetPrototype()));
+    CheckOwnProperties(&env, obj, names, values, arraysize(values));
+    CHECK(v8_num(1)->SameValue(
+        shape->Get(env.local(), v8_str("a")).ToLocalChecked()));
+  }
+  {
+    // A double in a Smi field and a Smi in a double field.
+    Local<v8::Value> values[] = {v8_num(1.5), v8_num(7), v8_num(4)};
+    Local<v8::Object> obj =
+        v8::Object::NewWithShape(isolate, shape, values, arraysize(values));
+    Verify(isolate, obj);
+    CheckOwnProperties(&env, obj, names, values, arraysize(values));
+  }
+  {
+    // Objects with more properties than in-object fields, and a prototype.
+    const char* many_names[] = {"p0", "p1", "p2", "p3", "p4", "p5", "p6"};
+    Local<v8::Object> many = CompileRun(
+                                 "var many = Object.create({proto: true});"
+                                 "many.p0 = 0; many.p1 = 1; many.p2 = 2;"
+                                 "many.p3 = 3; many.p4 = 4; many.p5 = 5;"
+                                 "many.p6 = {};"
+                                 "many")
+                                 .As<v8::Object>();
+    for (int i = 0; i < 3; ++i) {
+      Local<v8::Value> values[] = {v8_num(i),     v8_num(i + 1), v8_num(i + 2),
+                                   v8_num(i + 3), v8_num(i + 4), v8_num(i + 5),
+                                   v8_str("last")};
+      Local<v8::Object> obj =
+          v8::Object::NewWithShape(isolate, many, values, arraysize(values));
+      Verify(isolate, obj);
+      CHECK(obj->GetPrototype()->SameValue(many->GetPrototype()));
+      CheckOwnProperties(&env, obj, many_names, values, arraysize(values));
+    }
+  }
+}
+
 TEST(EscapableHandleScope) {
   HandleScope outer_scope(CcTest::isolate());
   LocalContext context;
@@ -23776,6 +24035,75 @@ TEST(StreamingWithHarmonyScopes) {
   delete[] full_source;
 }
 
+namespace {
+
+Local<Module> streamed_dependency;
+
+v8::MaybeLocal<Module> StreamedDependencyResolveCallback(
+    Local<Context> context, Local<String> specifier, Local<Module> referrer) {
+  CHECK(specifier->StrictEquals(v8_str("dep.mjs")));
+  return streamed_dependency;
+}
+
+Local<Module> CompileStreamedModule(LocalContext* env,
+                                    v8::ScriptCompiler::StreamedSource* source,
+                                    const char** chunks, const char* name) {
+  v8::ScriptOrigin origin(v8_str(name), Local<v8::Integer>(),
+                          Local<v8::Integer>(), Local<v8::Boolean>(),
+                          Local<v8::Integer>(), Local<v8::Value>(),
+                          Local<v8::Boolean>(), Local<v8::Boolean>(),
+                          True((*env)->GetIsolate()));
+  char* full_source = TestSourceStream::FullSourceString(chunks);
+  Local<Module> module =
+      v8::ScriptCompiler::CompileModule(env->local(), source,
+                                        v8_str(full_source), origin)
+          .ToLocalChecked();
+  delete[] full_source;
+  return module;
+}
+
+}  // namespace
+
+TEST(StreamingModuleGraph) {
+  LocalContext env;
+  v8::Isolate* isolate = env->GetIsolate();
+  v8::HandleScope scope(isolate);
+  v8::TryCatch try_catch(isolate);
+
+  const char* dependency_chunks[] = {"export let a = 1", "3;", nullptr};
+  const char* main_chunks[] = {"import {a} from 'dep.mjs';",
+                               "globalThis.result = a;", nullptr};
+
+  // Stream both modules of the graph before compiling either of them.
+  v8::ScriptCompiler::StreamedSource dependency_source(
+      std::make_unique<TestSourceStream>(dependency_chunks),
+      v8::ScriptCompiler::StreamedSource::ONE_BYTE);
+  v8::ScriptCompiler::StreamedSource main_source(
+      std::make_unique<TestSourceStream>(main_chunks),
+      v8::ScriptCompiler::StreamedSource::ONE_BYTE);
+  std::unique_ptr<v8::ScriptCompiler::ScriptStreamingTask> dependency_task(
+      v8::ScriptCompiler::StartStreaming(isolate, &dependency_source,
+                                         v8::ScriptType::kModule));
+  std::unique_ptr<v8::ScriptCompiler::ScriptStreamingTask> main_task(
+      v8::ScriptCompiler::StartStreaming(isolate, &main_source,
+                                         v8::ScriptType::kModule));
+  dependency_task->Run();
+  main_task->Run();
+  CHECK(!try_catch.HasCaught());
+
+  streamed_dependency = CompileStreamedModule(&env, &dependency_source,
+                                              dependency_chunks, "dep.mjs");
+  Local<Module> main =
+      CompileStreamedModule(&env, &main_source, main_chunks, "main.mjs");
+  CHECK_EQ(1, main->GetModuleRequestsLength());
+  CHECK(main->InstantiateModule(env.local(), StreamedDependencyResolveCallback)
+            .FromJust());
+  CHECK(!main->Evaluate(env.local()).IsEmpty());
+  CHECK(!try_catch.HasCaught());
+  CHECK_EQ(13, CompileRun("result")->Int32Value(env.local()).FromJust());
+  streamed_dependency = Local<Module>();
+}
+
 
 TEST(CodeCache) {
   v8::Isolate::CreateParams create_params;
@@ -27684,6 +28012,64 @@ void CallWithUnexpectedObjectType(v8::Local<v8::Value> receiver) {
   CHECK(checker.DidCallSlow());
 }
 
+// Records the length and the first byte of the typed array, DataView or
+// string passed to the fast callback.
+template <typename T>
+struct ApiSequenceChecker : BasicApiChecker<T*, ApiSequenceChecker<T>> {
+  static void FastCallback(v8::ApiObject receiver, T* argument,
+                           int* fallback) {
+    v8::Object* receiver_obj = reinterpret_cast<v8::Object*>(&receiver);
+    ApiSequenceChecker<T>* checker =
+        GetInternalField<ApiSequenceChecker<T>, kV8WrapperObjectIndex>(
+            receiver_obj);
+    checker->result_ |= ApiCheckerResult::kFastCalled;
+    checker->length_ = GetLength(argument);
+    checker->first_byte_ =
+        checker->length_ > 0 ? *static_cast<const char*>(argument->data) : 0;
+  }
+
+  static void SlowCallback(const v8::FunctionCallbackInfo<v8::Value>& info) {
+    v8::Object* receiver_obj = v8::Object::Cast(*info.Holder());
+    ApiSequenceChecker<T>* checker =
+        GetInternalField<ApiSequenceChecker<T>, kV8WrapperObjectIndex>(
+            receiver_obj);
+    checker->result_ |= ApiCheckerResult::kSlowCalled;
+  }
+
+  static size_t GetLength(v8::FastApiArrayBufferView* view) {
+    return view->byte_length;
+  }
+  static size_t GetLength(v8::FastOneByteString* string) {
+    return string->length;
+  }
+
+  size_t length_ = 0;
+  char first_byte_ = 0;
+};
+
+template <typename T>
+void CallWithSequence(const char* value_source, bool expect_fast_call,
+                      size_t expected_length = 0,
+                      char expected_first_byte = 0) {
+  LocalContext env;
+  ApiSequenceChecker<T> checker;
+  SetupTest(CompileRun(value_source), &env, &checker,
+            "function func(arg) { receiver.api_func(arg); }"
+            "%PrepareFunctionForOptimization(func);"
+            "func(value);");
+  CHECK(checker.DidCallSlow());
+  checker.result_ = ApiCheckerResult::kNotCalled;
+  CompileRun(
+      "%OptimizeFunctionOnNextCall(func);"
+      "func(value);");
+  CHECK_EQ(expect_fast_call, checker.DidCallFast());
+  CHECK_EQ(!expect_fast_call, checker.DidCallSlow());
+  if (expect_fast_call) {
+    CHECK_EQ(expected_length, checker.length_);
+    CHECK_EQ(expected_first_byte, checker.first_byte_);
+  }
+}
+
 class TestCFunctionInfo : public v8::CFunctionInfo {
   const v8::CTypeInfo& ReturnInfo() const override {
     static v8::CTypeInfo return_info =
@@ -27720,6 +28106,32 @@ void CheckDynamicTypeInfo() {
   CHECK_EQ(c_func.ArgumentInfo(1).GetType(), v8::CTypeInfo::Type::kBool);
   CHECK_EQ(c_func.ReturnInfo().GetType(), v8::CTypeInfo::Type::kVoid);
 }
+
+template <typename T>
+void CallFromInterpreterAndCheck(T expected_value,
+                                 ApiCheckerResultFlags expected_path,
+                                 v8::Local<v8::Value> initial_value,
+                                 bool raise_exception = false) {
+  LocalContext env;
+  ApiNumberChecker<T> checker(expected_value, raise_exception);
+
+  bool has_caught = SetupTest<T, ApiNumberChecker<T>>(
+      initial_value, &env, &checker,
+      "function func(arg) { return receiver.api_func(arg); }"
+      "func(value);");
+
+  CHECK_EQ(raise_exception, has_caught);
+  CHECK_EQ(expected_path == ApiCheckerResult::kSlowCalled,
+           !checker.DidCallFast());
+  CHECK_EQ(expected_path == ApiCheckerResult::kFastCalled,
+           !checker.DidCallSlow());
+  if (expected_path & ApiCheckerResult::kFastCalled) {
+    CHECK_EQ(checker.fast_value_, expected_value);
+  }
+  if (expected_path & ApiCheckerResult::kSlowCalled && !raise_exception) {
+    CHECK_EQ(checker.slow_value_.ToChecked(), expected_value);
+  }
+}
 }  // namespace
 #endif  // V8_LITE_MODE
 
@@ -27878,6 +28290,26 @@ TEST(FastApiCalls) {
   CallWithUnexpectedObjectType(v8_str("str"));
   CallWithUnexpectedObjectType(CompileRun("new Proxy({}, {});"));
 
+  // Typed arrays and DataViews
+  CallWithSequence<v8::FastApiArrayBufferView>("new Uint8Array([7, 8, 9])",
+                                               true, 3, 7);
+  CallWithSequence<v8::FastApiArrayBufferView>(
+      "new Uint16Array(new ArrayBuffer(256), 32, 4)", true, 8, 0);
+  CallWithSequence<v8::FastApiArrayBufferView>(
+      "new DataView(new Uint8Array([5, 6]).buffer, 1)", true, 1, 6);
+  CallWithSequence<v8::FastApiArrayBufferView>(
+      "(() => { let a = new Uint8Array(4); %ArrayBufferDetach(a.buffer);"
+      "  return a; })()",
+      false);
+  CallWithSequence<v8::FastApiArrayBufferView>("[1, 2, 3]", false);
+  CallWithSequence<v8::FastApiArrayBufferView>("42", false);
+
+  // One-byte strings
+  CallWithSequence<v8::FastOneByteString>("'abc'", true, 3, 'a');
+  CallWithSequence<v8::FastOneByteString>("''", true, 0, 0);
+  CallWithSequence<v8::FastOneByteString>("'\\u1234bc'", false);
+  CallWithSequence<v8::FastOneByteString>("({})", false);
+
   // TODO(mslekova): Add corner cases for 64-bit values.
   // TODO(mslekova): Add main cases for float and double.
   // TODO(mslekova): Restructure the tests so that the fast optimized calls
@@ -27886,6 +28318,50 @@ TEST(FastApiCalls) {
 #endif  // V8_LITE_MODE
 }
 
+TEST(FastApiCallsFromBuiltins) {
+#if !defined(V8_LITE_MODE) && (V8_HOST_ARCH_X64 || V8_HOST_ARCH_ARM64)
+  i::FLAG_fast_api_calls_from_builtins = true;
+  i::FLAG_opt = false;
+  i::FLAG_always_opt = false;
+
+  v8::Isolate* isolate = CcTest::isolate();
+  i::Isolate* i_isolate = reinterpret_cast<i::Isolate*>(isolate);
+  i_isolate->set_embedder_wrapper_type_index(kV8WrapperTypeIndex);
+  i_isolate->set_embedder_wrapper_object_index(kV8WrapperObjectIndex);
+
+  v8::HandleScope scope(isolate);
+  LocalContext env;
+
+  // Calls from unoptimized code take the fast path if the argument matches.
+  CallFromInterpreterAndCheck<int32_t>(-42, ApiCheckerResult::kFastCalled,
+                                       v8_num(-42));
+  CallFromInterpreterAndCheck<int32_t>(3, ApiCheckerResult::kFastCalled,
+                                       v8_num(3.5));
+  CallFromInterpreterAndCheck<uint32_t>(i::Smi::kMaxValue,
+                                        ApiCheckerResult::kFastCalled,
+                                        v8_num(i::Smi::kMaxValue));
+  CallFromInterpreterAndCheck<bool>(true, ApiCheckerResult::kFastCalled,
+                                    v8::Boolean::New(isolate, true));
+  CallFromInterpreterAndCheck<int64_t>(
+      static_cast<int64_t>(i::Smi::kMaxValue) + 1,
+      ApiCheckerResult::kFastCalled,
+      v8_num(static_cast<int64_t>(i::Smi::kMaxValue) + 1));
+
+  // Mismatching arguments go to the slow callback.
+  CallFromInterpreterAndCheck<int32_t>(42, ApiCheckerResult::kSlowCalled,
+                                       v8_str("42"));
+  CallFromInterpreterAndCheck<bool>(true, ApiCheckerResult::kSlowCalled,
+                                    v8_num(1));
+  CallFromInterpreterAndCheck<int64_t>(0, ApiCheckerResult::kSlowCalled,
+                                       v8_num(0.5));
+
+  // A fallback requested by the fast callback calls the slow callback.
+  CallFromInterpreterAndCheck<int32_t>(
+      42, ApiCheckerResult::kFastCalled | ApiCheckerResult::kSlowCalled,
+      v8_num(42), true);
+#endif  // !defined(V8_LITE_MODE) && (V8_HOST_ARCH_X64 || V8_HOST_ARCH_ARM64)
+}
+
 THREADED_TEST(GetContextByToken) {
   using v8::Context;
   using v8::Local;
@@ -28049,6 +28525,258 @@ TEST(TriggerDelayedMainThreadMetricsEvent) {
   CHECK_EQ(recorder->count_, 1);  // Unchanged.
 }
 
+namespace {
+
+class DeoptMetricsRecorder : public v8::metrics::Recorder {
+ public:
+  size_t count_ = 0;
+  v8::metrics::FunctionDeoptimized last_event_;
+
+  void AddMainThreadEvent(const v8::metrics::FunctionDeoptimized& event,
+                          v8::Context::Token token) override {
+    ++count_;
+    last_event_ = event;
+  }
+};
+
+}  // namespace
+
+TEST(FunctionDeoptimizedMetricsEvent) {
+  if (!i::FLAG_opt || i::FLAG_always_opt) return;
+  i::FLAG_allow_natives_syntax = true;
+  v8::Isolate* iso = CcTest::isolate();
+  std::shared_ptr<DeoptMetricsRecorder> recorder =
+      std::make_shared<DeoptMetricsRecorder>();
+  iso->SetMetricsRecorder(recorder);
+  LocalContext env;
+  v8::HandleScope scope(iso);
+
+  CompileRun(
+      "function f(x) { return x + 1; }"
+      "%PrepareFunctionForOptimization(f);"
+      "f(1); f(2);"
+      "%OptimizeFunctionOnNextCall(f);"
+      "f(3);");
+  CHECK_EQ(0, recorder->count_);
+
+  // Passing a string fails the Smi speculation and deopts eagerly.
+  CompileRun("f('a');");
+  CHECK_EQ(1, recorder->count_);
+  CHECK(recorder->last_event_.eager);
+  CHECK(!recorder->last_event_.lazy);
+  CHECK(recorder->last_event_.code_discarded);
+  CHECK_NOT_NULL(recorder->last_event_.reason);
+  CHECK_LE(0, recorder->last_event_.script_id);
+  CHECK_EQ(10, recorder->last_event_.function_start_position);
+}
+
+namespace {
+
+class StartupMetricsRecorder : public v8::metrics::Recorder {
+ public:
+  size_t isolate_events_ = 0;
+  size_t context_events_ = 0;
+  v8::metrics::IsolateStartup isolate_event_;
+  v8::metrics::ContextCreated context_event_;
+
+  void AddThreadSafeEvent(const v8::metrics::IsolateStartup& event) override {
+    ++isolate_events_;
+    isolate_event_ = event;
+  }
+  void AddMainThreadEvent(const v8::metrics::ContextCreated& event,
+                          v8::Context::Token token) override {
+    ++context_events_;
+    context_event_ = event;
+  }
+};
+
+}  // namespace
+
+TEST(StartupMetricsEvents) {
+  v8::Isolate* iso = CcTest::isolate();
+  std::shared_ptr<StartupMetricsRecorder> recorder =
+      std::make_shared<StartupMetricsRecorder>();
+  // Installing the recorder reports the setup of the existing isolate.
+  iso->SetMetricsRecorder(recorder);
+  CHECK_EQ(1, recorder->isolate_events_);
+  const v8::metrics::IsolateStartup& startup = recorder->isolate_event_;
+  CHECK_LE(0, startup.heap_setup_wall_clock_duration_in_us);
+  CHECK_LE(0, startup.builtins_setup_wall_clock_duration_in_us);
+  CHECK_LE(startup.heap_setup_wall_clock_duration_in_us +
+               startup.read_only_heap_setup_wall_clock_duration_in_us +
+               startup.builtins_setup_wall_clock_duration_in_us,
+           startup.total_wall_clock_duration_in_us);
+  CHECK_EQ(startup.from_snapshot,
+           startup.startup_deserialization_wall_clock_duration_in_us >= 0);
+
+  CHECK_EQ(0, recorder->context_events_);
+  LocalContext env;
+  CHECK_EQ(1, recorder->context_events_);
+  const v8::metrics::ContextCreated& context = recorder->context_event_;
+  CHECK_LE(0, context.extensions_wall_clock_duration_in_us);
+  CHECK_LE(context.extensions_wall_clock_duration_in_us,
+           context.total_wall_clock_duration_in_us);
+  if (context.from_snapshot) {
+    CHECK_LE(0, context.context_deserialization_wall_clock_duration_in_us);
+    CHECK_EQ(-1, context.bootstrapping_wall_clock_duration_in_us);
+  } else {
+    CHECK_LE(0, context.bootstrapping_wall_clock_duration_in_us);
+    CHECK_EQ(-1, context.context_deserialization_wall_clock_duration_in_us);
+  }
+}
+
+namespace {
+
+class MegamorphicFeedbackMetricsRecorder : public v8::metrics::Recorder {
+ public:
+  size_t count_ = 0;
+  v8::metrics::FeedbackBecameMegamorphic last_event_;
+
+  void AddMainThreadEvent(const v8::metrics::FeedbackBecameMegamorphic& event,
+                          v8::Context::Token token) override {
+    ++count_;
+    last_event_ = event;
+  }
+};
+
+}  // namespace
+
+TEST(FeedbackBecameMegamorphicMetricsEvent) {
+  if (!i::FLAG_use_ic) return;
+  i::FLAG_allow_natives_syntax = true;
+  v8::Isolate* iso = CcTest::isolate();
+  std::shared_ptr<MegamorphicFeedbackMetricsRecorder> recorder =
+      std::make_shared<MegamorphicFeedbackMetricsRecorder>();
+  iso->SetMetricsRecorder(recorder);
+  LocalContext env;
+  v8::HandleScope scope(iso);
+
+  CompileRun(
+      "function g(o) { return o.x; }"
+      "%EnsureFeedbackVectorForFunction(g);"
+      "g({x: 1}); g({x: 1, a: 1}); g({x: 1, b: 1}); g({x: 1, c: 1});");
+  CHECK_EQ(0, recorder->count_);
+
+  // The fifth map exceeds the polymorphism limit.
+  CompileRun("g({x: 1, d: 1});");
+  CHECK_EQ(1, recorder->count_);
+  CHECK_EQ(0, strcmp("LoadProperty", recorder->last_event_.slot_kind));
+  CHECK_LE(0, recorder->last_event_.script_id);
+  CHECK_EQ(10, recorder->last_event_.function_start_position);
+
+  // Staying megamorphic does not report again.
+  CompileRun("g({x: 1, e: 1});");
+  CHECK_EQ(1, recorder->count_);
+}
+
+namespace {
+
+class StubCacheMetricsRecorder : public v8::metrics::Recorder {
+ public:
+  size_t load_events_ = 0;
+  size_t load_updates_ = 0;
+  v8::metrics::MegamorphicStubCacheUsage last_load_event_;
+
+  void AddThreadSafeEvent(
+      const v8::metrics::MegamorphicStubCacheUsage& event) override {
+    if (event.store) return;
+    ++load_events_;
+    load_updates_ += event.updates;
+    last_load_event_ = event;
+  }
+};
+
+}  // namespace
+
+TEST(MegamorphicStubCacheUsageMetricsEvent) {
+  v8::Isolate* iso = CcTest::isolate();
+  std::shared_ptr<StubCacheMetricsRecorder> recorder =
+      std::make_shared<StubCacheMetricsRecorder>();
+  iso->SetMetricsRecorder(recorder);
+  LocalContext env;
+  v8::HandleScope scope(iso);
+
+  // Make the load in {f} megamorphic.
+  CompileRun(
+      "function f(o) { return o.x; }"
+      "for (let i = 0; i < 20; i++) {"
+      "  const o = {x: i};"
+      "  o['y' + i] = i;"
+      "  f(o);"
+      "}");
+  CcTest::CollectAllGarbage();
+  CHECK_LT(0u, recorder->load_events_);
+  CHECK_LT(0u, recorder->load_updates_);
+  const v8::metrics::MegamorphicStubCacheUsage& event =
+      recorder->last_load_event_;
+  CHECK_EQ(static_cast<size_t>(i::StubCache::kPrimaryTableSize),
+           event.primary_entries);
+  CHECK_EQ(static_cast<size_t>(i::StubCache::kSecondaryTableSize),
+           event.secondary_entries);
+  CHECK_LT(0u, event.primary_entries_used);
+  CHECK_LE(event.primary_entries_used, event.primary_entries);
+  CHECK_LE(event.evictions, event.updates);
+
+  // Nothing is reported for a cache that wasn't updated since it was cleared.
+  size_t load_events = recorder->load_events_;
+  CcTest::CollectAllGarbage();
+  CHECK_EQ(load_events, recorder->load_events_);
+}
+
+namespace {
+
+class RuntimeCallStatsMetricsRecorder : public v8::metrics::Recorder {
+ public:
+  size_t events_ = 0;
+  v8::metrics::RuntimeCallStatsSample last_event_;
+
+  void AddThreadSafeEvent(
+      const v8::metrics::RuntimeCallStatsSample& event) override {
+    ++events_;
+    last_event_ = event;
+  }
+};
+
+}  // namespace
+
+TEST(RuntimeCallStatsSampleMetricsEvent) {
+  i::FLAG_runtime_call_stats_sampling_interval = 1;
+  i::FLAG_runtime_call_stats_sampling_window = 20;
+  v8::Isolate::CreateParams create_params;
+  create_params.array_buffer_allocator = CcTest::array_buffer_allocator();
+  v8::Isolate* iso = v8::Isolate::New(create_params);
+  std::shared_ptr<RuntimeCallStatsMetricsRecorder> recorder =
+      std::make_shared<RuntimeCallStatsMetricsRecorder>();
+  iso->SetMetricsRecorder(recorder);
+  {
+    v8::Isolate::Scope isolate_scope(iso);
+    v8::HandleScope scope(iso);
+    v8::Local<v8::Context> context = v8::Context::New(iso);
+    v8::Context::Scope context_scope(context);
+    // Keep compiling new code until a window with counters was reported.
+    for (int i = 0; recorder->last_event_.counters.empty(); i++) {
+      i::EmbeddedVector<char, 64> source;
+      i::SNPrintF(source, "function f%d(a) { return a + %d; } f%d(1);", i, i,
+                  i);
+      CompileRun(source.begin());
+      v8::platform::PumpMessageLoop(i::V8::GetCurrentPlatform(), iso);
+    }
+  }
+  const v8::metrics::RuntimeCallStatsSample& event = recorder->last_event_;
+  CHECK_LT(0u, event.window_count);
+  CHECK_LT(0, event.sampled_wall_clock_time_in_us);
+  for (const v8::metrics::RuntimeCallStatsCounter& counter : event.counters) {
+    CHECK_NOT_NULL(counter.name);
+    CHECK_LT(0, counter.count);
+  }
+
+  // The final result is reported when the isolate is disposed.
+  size_t events = recorder->events_;
+  iso->Dispose();
+  CHECK_LT(events, recorder->events_);
+  i::FLAG_runtime_call_stats_sampling_interval = 0;
+}
+
 TEST(TriggerThreadSafeMetricsEvent) {
   // Set up isolate and context.
   v8::Isolate* iso = CcTest::isolate();
@@ -146,22 +146,13 @@ TEST(NumberToString) {
   };
   // clang-format on
 
-  const int kFullCacheSize = isolate->heap()->MaxNumberToStringCacheSize();
   const int test_count = arraysize(inputs);
   for (int i = 0; i < test_count; i++) {
-    int cache_length_before_addition = factory->number_string_cache()->length();
     Handle<Object> input = factory->NewNumber(inputs[i]);
     Handle<String> expected = factory->NumberToString(input);
 
+    // The entry is added to the cache even if the cache was resized.
     Handle<Object> result = ft.Call(input).ToHandleChecked();
-    if (result->IsUndefined(isolate)) {
-      // Query may fail if cache was resized, in which case the entry is not
-      // added to the cache.
-      CHECK_LT(cache_length_before_addition, kFullCacheSize);
-      CHECK_EQ(factory->number_string_cache()->length(), kFullCacheSize);
-      expected = factory->NumberToString(input);
-      result = ft.Call(input).ToHandleChecked();
-    }
     CHECK(!result->IsUndefined(isolate));
     CHECK_EQ(*expected, *result);
   }
@@ -3256,6 +3256,41 @@ TEST(SampleLimit) {
   CHECK_EQ(profile->GetSamplesCount(), 50);
 }
 
+// Tests that a CpuProfile keeping only the latest samples drops the oldest
+// sample for every new one once its sample limit is reached.
+TEST(SampleLimitKeepLatestSamples) {
+  LocalContext env;
+  i::Isolate* isolate = CcTest::i_isolate();
+  i::HandleScope scope(isolate);
+
+  CpuProfilesCollection* profiles = new CpuProfilesCollection(isolate);
+  ProfilerCodeObserver code_observer(isolate);
+  ProfileGenerator* generator =
+      new ProfileGenerator(profiles, code_observer.code_map());
+  ProfilerEventsProcessor* processor =
+      new SamplingEventsProcessor(isolate, generator, &code_observer,
+                                  v8::base::TimeDelta::FromMicroseconds(1),
+                                  /* use_precise_sampling */ true);
+  CpuProfiler profiler(isolate, kDebugNaming, kLazyLogging, profiles, generator,
+                       processor);
+
+  CpuProfile profile(&profiler, "",
+                     {v8::CpuProfilingMode::kLeafNodeLineNumbers, 3, 0,
+                      v8::MaybeLocal<v8::Context>(), true});
+  base::TimeTicks start = base::TimeTicks::HighResolutionNow();
+  for (int i = 1; i <= 10; i++) {
+    profile.AddPath(start + base::TimeDelta::FromMicroseconds(i),
+                    ProfileStackTrace(), i, true, base::TimeDelta());
+  }
+
+  CHECK_EQ(3, profile.samples_count());
+  for (int i = 0; i < 3; i++) {
+    CHECK_EQ(8 + i, profile.sample(i).line);
+    CHECK(start + base::TimeDelta::FromMicroseconds(8 + i) ==
+          profile.sample(i).timestamp);
+  }
+}
+
 // Tests that a CpuProfile instance subsamples from a stream of tick samples
 // appropriately.
 TEST(ProflilerSubsampling) {
@@ -167,6 +167,41 @@ TEST(DaylightSavingsTime) {
   CheckDST(august_20);
 }
 
+namespace {
+// One hour of daylight savings time in the second half of every period of
+// 100 days.
+int OffsetForTime(int64_t time_ms) {
+  int64_t period = 100 * DateCache::kMsPerDay;
+  return time_ms % period < period / 2 ? 0 : 3600 * 1000;
+}
+
+class CountingDateCache : public DateCache {
+ public:
+  int os_calls() const { return os_calls_; }
+
+ protected:
+  int GetLocalOffsetFromOS(int64_t time_ms, bool is_utc) override {
+    os_calls_++;
+    return OffsetForTime(time_ms);
+  }
+
+ private:
+  int os_calls_ = 0;
+};
+}  // anonymous namespace
+
+TEST(LocalOffsetCache) {
+  CountingDateCache date_cache;
+  const int64_t kStart = int64_t{1557288964845};
+  for (int64_t time = kStart; time < kStart + 365 * DateCache::kMsPerDay;
+       time += 60 * 1000) {
+    CHECK_EQ(OffsetForTime(time), date_cache.LocalOffsetInMs(time, true));
+  }
+  // Each 19 day step and each offset change needs a few queries; all other
+  // lookups must be cache hits.
+  CHECK_LT(date_cache.os_calls(), 365);
+}
+
 namespace {
 int legacy_parse_count = 0;
 void DateParseLegacyCounterCallback(v8::Isolate* isolate,
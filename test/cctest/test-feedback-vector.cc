@@ -7,6 +7,7 @@
 
 #include "src/api/api-inl.h"
 #include "src/codegen/macro-assembler.h"
+#include "src/debug/debug-interface.h"
 #include "src/debug/debug.h"
 #include "src/execution/execution.h"
 #include "src/handles/global-handles.h"
@@ -804,6 +805,49 @@ TEST(StoreOwnIC) {
   CHECK_EQ(MONOMORPHIC, nexus.ic_state());
 }
 
+TEST(GetFeedbackSummary) {
+  if (!i::FLAG_use_ic) return;
+  if (i::FLAG_always_opt) return;
+  FLAG_allow_natives_syntax = true;
+
+  CcTest::InitializeVM();
+  LocalContext context;
+  v8::HandleScope scope(context->GetIsolate());
+
+  CompileRun(
+      "function f(a) {"
+      "  return a.x;"
+      "}");
+  v8::Local<v8::Function> f = v8::Local<v8::Function>::Cast(
+      context->Global()
+          ->Get(context.local(), v8_str("f"))
+          .ToLocalChecked());
+  v8::debug::FeedbackSummary summary = v8::debug::GetFeedbackSummary(f);
+  CHECK_EQ(0, summary.slot_count);
+
+  CompileRun("%EnsureFeedbackVectorForFunction(f);");
+  summary = v8::debug::GetFeedbackSummary(f);
+  CHECK_EQ(1, summary.slot_count);
+  CHECK_EQ(1, summary.uninitialized);
+  CHECK_EQ(0, summary.invocation_count);
+
+  CompileRun("f({x: 1}); f({x: 2});");
+  summary = v8::debug::GetFeedbackSummary(f);
+  CHECK_EQ(1, summary.monomorphic);
+  CHECK_EQ(2, summary.invocation_count);
+
+  CompileRun("f({x: 1, a: 1}); f({x: 1, b: 1});");
+  summary = v8::debug::GetFeedbackSummary(f);
+  CHECK_EQ(1, summary.polymorphic);
+
+  CompileRun("f({x: 1, c: 1}); f({x: 1, d: 1}); f({x: 1, e: 1});");
+  summary = v8::debug::GetFeedbackSummary(f);
+  CHECK_EQ(1, summary.slot_count);
+  CHECK_EQ(1, summary.megamorphic);
+  CHECK_EQ(0, summary.monomorphic + summary.polymorphic);
+  CHECK(!summary.has_optimized_code);
+}
+
 }  // namespace
 
 }  // namespace internal
@@ -37,6 +37,7 @@
 #include "src/api/api-inl.h"
 #include "src/base/hashmap.h"
 #include "src/base/optional.h"
+#include "src/base/platform/platform.h"
 #include "src/codegen/assembler-inl.h"
 #include "src/debug/debug.h"
 #include "src/heap/heap-inl.h"
@@ -44,6 +45,7 @@
 #include "src/profiler/allocation-tracker.h"
 #include "src/profiler/heap-profiler.h"
 #include "src/profiler/heap-snapshot-generator-inl.h"
+#include "src/profiler/sampling-heap-profiler.h"
 #include "test/cctest/cctest.h"
 #include "test/cctest/collector.h"
 #include "test/cctest/heap/heap-utils.h"
@@ -1185,6 +1187,57 @@ TEST(HeapSnapshotJSONSerialization) {
 }
 
 
+namespace {
+
+class SnapshotSerializerThread final : public v8::base::Thread {
+ public:
+  SnapshotSerializerThread(const v8::HeapSnapshot* snapshot,
+                           TestJSONStream* stream)
+      : Thread(Options("SnapshotSerializerThread")),
+        snapshot_(snapshot),
+        stream_(stream) {}
+
+  void Run() override {
+    snapshot_->Serialize(stream_, v8::HeapSnapshot::kJSON);
+  }
+
+ private:
+  const v8::HeapSnapshot* snapshot_;
+  TestJSONStream* stream_;
+};
+
+}  // namespace
+
+TEST(HeapSnapshotJSONSerializationOnBackgroundThread) {
+  LocalContext env;
+  v8::HandleScope scope(env->GetIsolate());
+  v8::HeapProfiler* heap_profiler = env->GetIsolate()->GetHeapProfiler();
+  CompileRun(
+      "function A(s) { this.s = s; }\n"
+      "var a = [];\n"
+      "for (var i = 0; i < 1000; i++) a.push(new A('s' + i));\n");
+  const v8::HeapSnapshot* snapshot = heap_profiler->TakeHeapSnapshot();
+  CHECK(ValidateSnapshot(snapshot));
+
+  TestJSONStream background_stream;
+  SnapshotSerializerThread thread(snapshot, &background_stream);
+  CHECK(thread.Start());
+  // Keep mutating the heap while the snapshot is serialized.
+  CompileRun("for (var i = 0; i < 1000; i++) a[i] = new A('t' + i);");
+  thread.Join();
+  CHECK_EQ(1, background_stream.eos_signaled());
+
+  TestJSONStream main_thread_stream;
+  snapshot->Serialize(&main_thread_stream, v8::HeapSnapshot::kJSON);
+  CHECK_EQ(main_thread_stream.size(), background_stream.size());
+  i::ScopedVector<char> background_json(background_stream.size());
+  background_stream.WriteTo(background_json);
+  i::ScopedVector<char> main_thread_json(main_thread_stream.size());
+  main_thread_stream.WriteTo(main_thread_json);
+  CHECK_EQ(0, memcmp(background_json.begin(), main_thread_json.begin(),
+                     background_json.length()));
+}
+
 TEST(HeapSnapshotJSONSerializationAborting) {
   LocalContext env;
   v8::HandleScope scope(env->GetIsolate());
@@ -3986,6 +4039,96 @@ TEST(SamplingHeapProfilerLargeInterval) {
   heap_profiler->StopSamplingHeapProfiler();
 }
 
+TEST(SamplingHeapProfilerInstanceTypes) {
+  v8::HandleScope scope(CcTest::isolate());
+  LocalContext env;
+  i::Isolate* isolate = CcTest::i_isolate();
+  v8::HeapProfiler* heap_profiler = env->GetIsolate()->GetHeapProfiler();
+
+  // Suppress randomness to avoid flakiness in tests.
+  v8::internal::FLAG_sampling_heap_profiler_suppress_randomness = true;
+
+  heap_profiler->StartSamplingHeapProfiler(64);
+  CompileRun(
+      "var retained = [];\n"
+      "for (var i = 0; i < 1024; i++) retained.push(new Array(4));\n");
+
+  i::SamplingHeapProfiler* profiler =
+      isolate->heap_profiler()->sampling_heap_profiler();
+  CHECK_NOT_NULL(profiler);
+  // The scavenge moves the young arrays and drops samples of temporary ones.
+  CcTest::CollectGarbage(i::NEW_SPACE);
+  size_t array_samples = profiler->GetStatsByInstanceType()[i::JS_ARRAY_TYPE]
+                             .sample_count;
+  CHECK_LT(0, array_samples);
+
+  // Samples of live objects follow the objects when they are moved.
+  CcTest::CollectGarbage(i::NEW_SPACE);
+  CcTest::CollectAllGarbage();
+  auto stats = profiler->GetStatsByInstanceType();
+  CHECK_EQ(array_samples, stats[i::JS_ARRAY_TYPE].sample_count);
+  CHECK_LE(stats[i::JS_ARRAY_TYPE].sample_count,
+           stats[i::JS_ARRAY_TYPE].estimated_count);
+
+  // Samples of dead objects are dropped.
+  CompileRun("retained = null;");
+  CcTest::CollectAllGarbage();
+  CHECK_GT(array_samples, profiler->GetStatsByInstanceType()[i::JS_ARRAY_TYPE]
+                              .sample_count);
+
+  heap_profiler->StopSamplingHeapProfiler();
+}
+
+TEST(SamplingHeapProfilerRetainedGrowth) {
+  v8::HandleScope scope(CcTest::isolate());
+  LocalContext env;
+  v8::HeapProfiler* heap_profiler = env->GetIsolate()->GetHeapProfiler();
+
+  // Turn off always_opt. Inlining can cause stack traces to be shorter than
+  // what we expect in this test.
+  v8::internal::FLAG_always_opt = false;
+
+  // Suppress randomness to avoid flakiness in tests.
+  v8::internal::FLAG_sampling_heap_profiler_suppress_randomness = true;
+
+  heap_profiler->StartSamplingHeapProfiler(
+      256, 16, v8::HeapProfiler::kSamplingTrackRetainedGrowth);
+  CompileRun(
+      "var kept = [];\n"
+      "var leaked = [];\n"
+      "function keep() {\n"
+      "  for (var i = 0; i < 256; i++) kept.push(new Array(16));\n"
+      "}\n"
+      "function leak() {\n"
+      "  for (var i = 0; i < 256; i++) leaked.push(new Array(16));\n"
+      "}\n"
+      "keep();");
+  for (int i = 0; i < 4; i++) {
+    CompileRun("leak();");
+    CcTest::CollectAllGarbage();
+  }
+
+  std::unique_ptr<v8::AllocationProfile> profile(
+      heap_profiler->GetAllocationProfile());
+  CHECK(profile);
+  const char* leak_names[] = {"", "leak"};
+  auto node_leak = FindAllocationProfileNode(env->GetIsolate(), profile.get(),
+                                             ArrayVector(leak_names));
+  CHECK(node_leak);
+  CHECK_LT(0, node_leak->growing_gc_count);
+  CHECK_LT(0u, node_leak->retained_size_growth);
+
+  // The size retained by keep() only grew up to the first full GC.
+  const char* keep_names[] = {"", "keep"};
+  auto node_keep = FindAllocationProfileNode(env->GetIsolate(), profile.get(),
+                                             ArrayVector(keep_names));
+  CHECK(node_keep);
+  CHECK_EQ(0, node_keep->growing_gc_count);
+  CHECK_EQ(0u, node_keep->retained_size_growth);
+
+  heap_profiler->StopSamplingHeapProfiler();
+}
+
 TEST(HeapSnapshotPrototypeNotJSReceiver) {
   LocalContext env;
   v8::HandleScope scope(env->GetIsolate());
@@ -35,6 +35,7 @@
 #include "src/codegen/compilation-cache.h"
 #include "src/execution/execution.h"
 #include "src/execution/isolate.h"
+#include "src/execution/v8threads.h"
 #include "src/objects/objects-inl.h"
 #include "src/strings/unicode-inl.h"
 #include "src/utils/utils.h"
@@ -875,6 +876,84 @@ TEST(LockUnlockLockDefaultIsolateMultithreaded) {
   StartJoinAndDeleteThreads(threads);
 }
 
+class MigratingThread : public JoinableThread {
+ public:
+  MigratingThread(v8::Isolate* isolate, v8::Local<v8::Context> context,
+                  bool keep_handles)
+      : JoinableThread("MigratingThread"),
+        isolate_(isolate),
+        context_(isolate, context),
+        keep_handles_(keep_handles) {}
+
+  void Run() override {
+    static const int kHandOffs = 20;
+    v8::Locker locker(isolate_);
+    v8::Isolate::Scope isolate_scope(isolate_);
+    for (int i = 0; i < kHandOffs; i++) {
+      if (keep_handles_) {
+        // The handle scope and the entered context keep this thread from
+        // being idle, so its state is archived while it is unlocked.
+        v8::HandleScope handle_scope(isolate_);
+        v8::Local<v8::Context> context =
+            v8::Local<v8::Context>::New(isolate_, context_);
+        v8::Context::Scope context_scope(context);
+        v8::Local<v8::Value> value = CompileRun("({answer: 42})");
+        {
+          v8::Unlocker unlocker(isolate_);
+          CHECK(!v8::Locker::IsLocked(isolate_));
+        }
+        CHECK_EQ(42, value.As<v8::Object>()
+                         ->Get(context, v8_str("answer"))
+                         .ToLocalChecked()
+                         ->Int32Value(context)
+                         .FromJust());
+        CalcFibAndCheck(context);
+      } else {
+        {
+          v8::HandleScope handle_scope(isolate_);
+          v8::Local<v8::Context> context =
+              v8::Local<v8::Context>::New(isolate_, context_);
+          v8::Context::Scope context_scope(context);
+          CalcFibAndCheck(context);
+        }
+        // Nothing is left on this thread, so it is released without
+        // archiving its state.
+        CHECK(reinterpret_cast<i::Isolate*>(isolate_)
+                  ->thread_manager()
+                  ->IsCurrentThreadIdle());
+        v8::Unlocker unlocker(isolate_);
+      }
+    }
+  }
+
+ private:
+  v8::Isolate* isolate_;
+  v8::Persistent<v8::Context> context_;
+  bool keep_handles_;
+};
+
+// Hands an isolate back and forth between idle threads and threads that keep
+// handles alive while they are unlocked.
+TEST(LockerUnlockerMigration) {
+  const int kNThreads = 10;
+  v8::Isolate::CreateParams create_params;
+  create_params.array_buffer_allocator = CcTest::array_buffer_allocator();
+  v8::Isolate* isolate = v8::Isolate::New(create_params);
+  std::vector<JoinableThread*> threads;
+  threads.reserve(kNThreads);
+  {
+    v8::Locker locker_(isolate);
+    v8::Isolate::Scope isolate_scope(isolate);
+    v8::HandleScope handle_scope(isolate);
+    v8::Local<v8::Context> context = v8::Context::New(isolate);
+    for (int i = 0; i < kNThreads; i++) {
+      threads.push_back(new MigratingThread(isolate, context, i % 2 == 0));
+    }
+  }
+  StartJoinAndDeleteThreads(threads);
+  isolate->Dispose();
+}
+
 
 TEST(Regress1433) {
   for (int i = 0; i < 10; i++) {
@@ -604,6 +604,38 @@ TEST(OrderedHashMapDuplicateHashCode) {
   CHECK(OrderedHashMap::HasKey(isolate, *map, *key2));
 }
 
+TEST(OrderedHashMapFindEntryByValue) {
+  LocalContext context;
+  Isolate* isolate = GetIsolateFrom(&context);
+  Factory* factory = isolate->factory();
+  HandleScope scope(isolate);
+
+  Handle<OrderedHashMap> map = factory->NewOrderedHashMap();
+  Handle<JSObject> value = factory->NewJSObjectWithNullProto();
+  // Grow the table past its initial bucket count.
+  for (int i = 0; i < 20; i++) {
+    Handle<Smi> key(Smi::FromInt(i), isolate);
+    map = OrderedHashMap::Add(isolate, map, key, value).ToHandleChecked();
+  }
+  Handle<Object> number = factory->NewHeapNumber(1.5);
+  Handle<String> string = factory->NewStringFromAsciiChecked("key");
+  map = OrderedHashMap::Add(isolate, map, number, value).ToHandleChecked();
+  map = OrderedHashMap::Add(isolate, map, string, value).ToHandleChecked();
+  Verify(isolate, map);
+  CHECK_LT(2, map->NumberOfBuckets());
+  CHECK_EQ(22, map->NumberOfElements());
+
+  // Keys that are equal but not identical are still found.
+  CHECK(OrderedHashMap::HasKey(isolate, *map, *factory->NewHeapNumber(1.5)));
+  CHECK(OrderedHashMap::HasKey(isolate, *map,
+                               *factory->NewStringFromAsciiChecked("key")));
+  CHECK(!OrderedHashMap::HasKey(isolate, *map, *factory->NewHeapNumber(2.5)));
+  for (int i = 0; i < 20; i++) {
+    CHECK(OrderedHashMap::HasKey(isolate, *map, Smi::FromInt(i)));
+  }
+  CHECK(!OrderedHashMap::HasKey(isolate, *map, Smi::FromInt(20)));
+}
+
 TEST(OrderedHashMapDeletion) {
   LocalContext context;
   Isolate* isolate = GetIsolateFrom(&context);
@@ -11830,6 +11830,27 @@ TEST(LogicalAssignmentDestructuringErrors) {
                     arraysize(flags));
 }
 
+TEST(AllFunctionsCalledOnLoadMagicComment) {
+  if (!i::FLAG_lazy) return;
+  i::FLAG_compile_hints_magic = true;
+  LocalContext env;
+  v8::HandleScope scope(CcTest::isolate());
+
+  auto is_compiled = [](v8::Local<v8::Value> value) {
+    i::Handle<i::JSFunction> f =
+        i::Handle<i::JSFunction>::cast(v8::Utils::OpenHandle(*value));
+    return f->shared().is_compiled();
+  };
+
+  CHECK(!is_compiled(CompileRun("function lazy_f() { return 1; }; lazy_f")));
+  CHECK(is_compiled(
+      CompileRun("//# allFunctionsCalledOnLoad\n"
+                 "function eager_f() { return 1; }; eager_f")));
+  CHECK(is_compiled(
+      CompileRun("//# allFunctionsCalledOnLoad\n"
+                 "var eager_g = function() { return 2; }; eager_g")));
+}
+
 }  // namespace test_parsing
 }  // namespace internal
 }  // namespace v8
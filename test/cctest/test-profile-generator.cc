@@ -29,6 +29,7 @@
 
 #include "include/v8-profiler.h"
 #include "src/api/api-inl.h"
+#include "src/codegen/source-position.h"
 #include "src/init/v8.h"
 #include "src/logging/log.h"
 #include "src/objects/objects-inl.h"
@@ -437,6 +438,64 @@ TEST(SymbolizeTickSample) {
   CHECK_EQ(entry1, node4->entry());
 }
 
+TEST(SymbolizeTickSampleInlinedTopFrame) {
+  TestSetup test_setup;
+  i::Isolate* isolate = CcTest::i_isolate();
+  CpuProfilesCollection profiles(isolate);
+  CpuProfiler profiler(isolate);
+  profiles.set_cpu_profiler(&profiler);
+  profiles.StartProfiling("");
+  CodeMap code_map;
+  ProfileGenerator generator(&profiles, &code_map);
+
+  // Code of "outer" with "inner" inlined at pc offsets [0x10, 0x20).
+  const char* kOuterName = "outer";
+  const char* kEmpty = CodeEntry::kEmptyResourceName;
+  const int kInliningId = 0;
+  std::unique_ptr<SourcePositionTable> line_table(new SourcePositionTable());
+  line_table->SetPosition(0, 1, SourcePosition::kNotInlined);
+  line_table->SetPosition(0x10, 7, kInliningId);
+  line_table->SetPosition(0x20, 3, SourcePosition::kNotInlined);
+  CodeEntry* outer = new CodeEntry(i::Logger::FUNCTION_TAG, kOuterName,
+                                   kEmpty, 1, 1, std::move(line_table));
+
+  std::unordered_set<std::unique_ptr<CodeEntry>, CodeEntry::Hasher,
+                     CodeEntry::Equals>
+      inline_entries;
+  std::unique_ptr<CodeEntry> inner_entry = std::make_unique<CodeEntry>(
+      i::Logger::FUNCTION_TAG, "inner", kEmpty, 6, 1);
+  std::unique_ptr<CodeEntry> outer_entry = std::make_unique<CodeEntry>(
+      i::Logger::FUNCTION_TAG, kOuterName, kEmpty, 1, 1);
+  CodeEntry* inner = inner_entry.get();
+  std::unordered_map<int, std::vector<CodeEntryAndLineNumber>> inline_stacks;
+  inline_stacks[kInliningId] = {{inner, 7}, {outer_entry.get(), 2}};
+  inline_entries.insert(std::move(inner_entry));
+  inline_entries.insert(std::move(outer_entry));
+  outer->SetInlineStacks(std::move(inline_entries), std::move(inline_stacks));
+  generator.code_map()->AddCode(ToAddress(0x1500), outer, 0x100);
+
+  // A tick in the inlined code is attributed to "inner" called by "outer".
+  TickSample sample;
+  sample.pc = ToPointer(0x1515);
+  sample.tos = ToPointer(0x1500);
+  sample.frames_count = 0;
+  generator.SymbolizeTickSample(sample);
+
+  CpuProfile* profile = profiles.StopProfiling("");
+  CHECK(profile);
+  ProfileTreeTestHelper top_down_test_helper(profile->top_down());
+  ProfileNode* outer_node = top_down_test_helper.Walk(outer);
+  CHECK(outer_node);
+  CHECK_EQ(0u, outer_node->self_ticks());
+  ProfileNode* inner_node = top_down_test_helper.Walk(outer, inner);
+  CHECK(inner_node);
+  CHECK_EQ(1u, inner_node->self_ticks());
+  CHECK_EQ(1u, inner_node->GetHitLineCount());
+  v8::CpuProfileNode::LineTick line_tick;
+  CHECK(inner_node->GetLineTicks(&line_tick, 1));
+  CHECK_EQ(7, line_tick.line);
+}
+
 static void CheckNodeIds(const ProfileNode* node, unsigned* expectedId) {
   CHECK_EQ((*expectedId)++, node->id());
   for (const ProfileNode* child : *node->children()) {
@@ -843,6 +843,53 @@ UNINITIALIZED_TEST(CustomSnapshotDataBlobWithIrregexpCodeClearCode) {
       v8::SnapshotCreator::FunctionCodeHandling::kClear);
 }
 
+UNINITIALIZED_TEST(CustomSnapshotDataBlobKeepFeedback) {
+  DisableAlwaysOpt();
+  const char* source =
+      "function f(x) { return x + 1; }\n"
+      "for (var i = 0; i < 1000; i++) f(i);\n"
+      "function g() { return 0; }\n";
+
+  DisableEmbeddedBlobRefcounting();
+  v8::StartupData data1 = CreateSnapshotDataBlobInternal(
+      v8::SnapshotCreator::FunctionCodeHandling::kKeepWithFeedback, source);
+
+  v8::Isolate::CreateParams params1;
+  params1.snapshot_blob = &data1;
+  params1.array_buffer_allocator = CcTest::array_buffer_allocator();
+
+  // Test-appropriate equivalent of v8::Isolate::New.
+  v8::Isolate* isolate1 = TestSerializer::NewIsolate(params1);
+  {
+    v8::Isolate::Scope i_scope(isolate1);
+    v8::HandleScope h_scope(isolate1);
+    v8::Local<v8::Context> context = v8::Context::New(isolate1);
+    v8::Context::Scope c_scope(context);
+    {
+      // The warmed up function keeps its feedback vector and invocation
+      // count, but not its optimized code.
+      i::Handle<i::JSFunction> f = i::Handle<i::JSFunction>::cast(
+          Utils::OpenHandle(*CompileRun("f")));
+      CHECK(f->shared().HasBytecodeArray());
+      CHECK(f->has_feedback_vector());
+      CHECK(!f->feedback_vector().has_optimized_code());
+      CHECK_LT(0, f->feedback_vector().invocation_count());
+    }
+    {
+      // A function that never ran has no feedback to keep.
+      i::Handle<i::JSFunction> g = i::Handle<i::JSFunction>::cast(
+          Utils::OpenHandle(*CompileRun("g")));
+      CHECK(!g->has_feedback_vector());
+    }
+    v8::Maybe<int32_t> result =
+        CompileRun("f(41)")->Int32Value(isolate1->GetCurrentContext());
+    CHECK_EQ(42, result.FromJust());
+  }
+  isolate1->Dispose();
+  delete[] data1.data;  // We can dispose of the snapshot blob now.
+  FreeCurrentEmbeddedBlob();
+}
+
 UNINITIALIZED_TEST(SnapshotChecksum) {
   DisableAlwaysOpt();
   const char* source1 = "function f() { return 42; }";
@@ -2421,6 +2468,101 @@ TEST(CodeSerializerIsolatesEager) {
   isolate2->Dispose();
 }
 
+namespace {
+
+class ConsumeCodeCacheThread final : public v8::base::Thread {
+ public:
+  explicit ConsumeCodeCacheThread(
+      v8::ScriptCompiler::ConsumeCodeCacheTask* task)
+      : Thread(base::Thread::Options("ConsumeCodeCacheThread")), task_(task) {}
+
+  void Run() final { task_->Run(); }
+
+ private:
+  v8::ScriptCompiler::ConsumeCodeCacheTask* task_;
+};
+
+}  // namespace
+
+TEST(CodeSerializerOffThreadDeserialize) {
+  const char* source = "function f() { return 'abc'; }; f() + 'def'";
+  v8::ScriptCompiler::CachedData* cache = CompileRunAndProduceCache(source);
+
+  v8::Isolate::CreateParams create_params;
+  create_params.array_buffer_allocator = CcTest::array_buffer_allocator();
+  v8::Isolate* isolate2 = v8::Isolate::New(create_params);
+  {
+    v8::Isolate::Scope iscope(isolate2);
+    v8::HandleScope scope(isolate2);
+    v8::Local<v8::Context> context = v8::Context::New(isolate2);
+    v8::Context::Scope context_scope(context);
+
+    v8::ScriptCompiler::ConsumeCodeCacheTask* task =
+        v8::ScriptCompiler::StartConsumingCodeCache(
+            isolate2, std::make_unique<v8::ScriptCompiler::CachedData>(
+                          cache->data, cache->length,
+                          v8::ScriptCompiler::CachedData::BufferNotOwned));
+    ConsumeCodeCacheThread thread(task);
+    CHECK(thread.Start());
+    thread.Join();
+
+    v8::ScriptOrigin origin(v8_str("test"));
+    v8::ScriptCompiler::Source source_obj(v8_str(source), origin, cache, task);
+    v8::Local<v8::UnboundScript> script;
+    {
+      DisallowCompilation no_compile(reinterpret_cast<Isolate*>(isolate2));
+      script = v8::ScriptCompiler::CompileUnboundScript(
+                   isolate2, &source_obj, v8::ScriptCompiler::kConsumeCodeCache)
+                   .ToLocalChecked();
+    }
+    CHECK(!cache->rejected);
+    v8::Local<v8::Value> result =
+        script->BindToCurrentContext()->Run(context).ToLocalChecked();
+    CHECK(result->Equals(context, v8_str("abcdef")).FromJust());
+  }
+  isolate2->Dispose();
+}
+
+TEST(CodeSerializerOffThreadDeserializeRejected) {
+  const char* source = "function f() { return 'abc'; }; f() + 'def'";
+  v8::ScriptCompiler::CachedData* cache = CompileRunAndProduceCache(source);
+
+  v8::Isolate::CreateParams create_params;
+  create_params.array_buffer_allocator = CcTest::array_buffer_allocator();
+  v8::Isolate* isolate2 = v8::Isolate::New(create_params);
+  {
+    v8::Isolate::Scope iscope(isolate2);
+    v8::HandleScope scope(isolate2);
+    v8::Local<v8::Context> context = v8::Context::New(isolate2);
+    v8::Context::Scope context_scope(context);
+
+    v8::ScriptCompiler::ConsumeCodeCacheTask* task =
+        v8::ScriptCompiler::StartConsumingCodeCache(
+            isolate2, std::make_unique<v8::ScriptCompiler::CachedData>(
+                          cache->data, cache->length,
+                          v8::ScriptCompiler::CachedData::BufferNotOwned));
+    ConsumeCodeCacheThread thread(task);
+    CHECK(thread.Start());
+    thread.Join();
+
+    // The source hash only depends on the length, so a source of a different
+    // length is only detected when finishing on the main thread.
+    const char* other_source = "function f() { return 'abc'; }; f() + 'xyz!'";
+    v8::ScriptOrigin origin(v8_str("test"));
+    v8::ScriptCompiler::Source source_obj(v8_str(other_source), origin, cache,
+                                          task);
+    v8::Local<v8::UnboundScript> script =
+        v8::ScriptCompiler::CompileUnboundScript(
+            isolate2, &source_obj, v8::ScriptCompiler::kConsumeCodeCache)
+            .ToLocalChecked();
+    CHECK(cache->rejected);
+    v8::Local<v8::Value> result =
+        script->BindToCurrentContext()->Run(context).ToLocalChecked();
+    CHECK(result->Equals(context, v8_str("abcxyz!")).FromJust());
+  }
+  isolate2->Dispose();
+}
+
 TEST(CodeSerializerAfterExecute) {
   // We test that no compilations happen when running this code. Forcing
   // to always optimize breaks this test.
@@ -2477,6 +2619,74 @@ TEST(CodeSerializerAfterExecute) {
   FLAG_always_opt = prev_always_opt_value;
 }
 
+TEST(CodeSerializerTrimColdFunctions) {
+  FLAG_code_cache_trim_bytecode_age = BytecodeArray::kIsOldBytecodeAge;
+  FLAG_always_opt = false;
+  const char* source =
+      "function hot() { return 'abc'; }"
+      "function cold() { return 'def'; }"
+      "hot()";
+
+  v8::ScriptCompiler::CachedData* cache;
+  v8::Isolate::CreateParams create_params;
+  create_params.array_buffer_allocator = CcTest::array_buffer_allocator();
+  v8::Isolate* isolate1 = v8::Isolate::New(create_params);
+  {
+    v8::Isolate::Scope iscope(isolate1);
+    v8::HandleScope scope(isolate1);
+    v8::Local<v8::Context> context = v8::Context::New(isolate1);
+    v8::Context::Scope context_scope(context);
+
+    v8::ScriptOrigin origin(v8_str("test"));
+    v8::ScriptCompiler::Source source_obj(v8_str(source), origin);
+    v8::Local<v8::UnboundScript> script =
+        v8::ScriptCompiler::CompileUnboundScript(
+            isolate1, &source_obj, v8::ScriptCompiler::kEagerCompile)
+            .ToLocalChecked();
+    script->BindToCurrentContext()->Run(context).ToLocalChecked();
+
+    // Pretend that {cold} has not run for a long time.
+    Handle<JSFunction> cold = Handle<JSFunction>::cast(v8::Utils::OpenHandle(
+        *context->Global()->Get(context, v8_str("cold")).ToLocalChecked()));
+    CHECK(cold->shared().HasBytecodeArray());
+    cold->shared().GetBytecodeArray().set_bytecode_age(
+        BytecodeArray::kIsOldBytecodeAge);
+
+    cache = ScriptCompiler::CreateCodeCache(script);
+    CHECK(cache);
+    // The live function is left untouched.
+    CHECK(cold->shared().HasBytecodeArray());
+  }
+  isolate1->Dispose();
+
+  v8::Isolate* isolate2 = v8::Isolate::New(create_params);
+  {
+    v8::Isolate::Scope iscope(isolate2);
+    v8::HandleScope scope(isolate2);
+    v8::Local<v8::Context> context = v8::Context::New(isolate2);
+    v8::Context::Scope context_scope(context);
+
+    v8::ScriptOrigin origin(v8_str("test"));
+    v8::ScriptCompiler::Source source_obj(v8_str(source), origin, cache);
+    v8::Local<v8::UnboundScript> script =
+        v8::ScriptCompiler::CompileUnboundScript(
+            isolate2, &source_obj, v8::ScriptCompiler::kConsumeCodeCache)
+            .ToLocalChecked();
+    CHECK(!cache->rejected);
+    script->BindToCurrentContext()->Run(context).ToLocalChecked();
+
+    auto get_function = [&](const char* name) {
+      return Handle<JSFunction>::cast(v8::Utils::OpenHandle(
+          *context->Global()->Get(context, v8_str(name)).ToLocalChecked()));
+    };
+    CHECK(get_function("hot")->shared().is_compiled());
+    CHECK(!get_function("cold")->shared().is_compiled());
+    v8::Local<v8::Value> result = CompileRun("cold()");
+    CHECK(result->Equals(context, v8_str("def")).FromJust());
+  }
+  isolate2->Dispose();
+}
+
 TEST(CodeSerializerFlagChange) {
   const char* source = "function f() { return 'abc'; }; f() + 'def'";
   v8::ScriptCompiler::CachedData* cache = CompileRunAndProduceCache(source);
@@ -957,6 +957,52 @@ TEST(Utf8Conversion) {
   }
 }
 
+TEST(Utf8ConversionOfRopes) {
+  CcTest::InitializeVM();
+  v8::Isolate* isolate = CcTest::isolate();
+  v8::HandleScope handle_scope(isolate);
+  // The surrogate pair U+1F600 is split between the two halves of the rope.
+  const uint16_t left_chars[] = {'a', 'b', 'c', 'd', 'e', 'f', 'g', 0xD83D};
+  const uint16_t right_chars[] = {0xDE00, 'h', 'i', 'j', 'k', 'l', 'm', 'n'};
+  v8::Local<v8::String> left =
+      v8::String::NewFromTwoByte(isolate, left_chars,
+                                 v8::NewStringType::kNormal, 8)
+          .ToLocalChecked();
+  v8::Local<v8::String> right =
+      v8::String::NewFromTwoByte(isolate, right_chars,
+                                 v8::NewStringType::kNormal, 8)
+          .ToLocalChecked();
+  v8::Local<v8::String> rope = v8::String::Concat(
+      isolate, v8::String::Concat(isolate, left, v8_str("0123456789")),
+      right);
+  CHECK(v8::Utils::OpenHandle(*rope)->IsConsString());
+  const char expected[] = "abcdefg\xF0\x9F\x98\x80" "0123456789hijklmn";
+  const int expected_length = static_cast<int>(strlen(expected));
+  CHECK_EQ(expected_length, rope->Utf8Length(isolate));
+
+  char buffer[64];
+  int chars_written;
+  int written = rope->WriteUtf8(isolate, buffer, expected_length + 1,
+                                &chars_written);
+  CHECK_EQ(expected_length + 1, written);
+  CHECK_EQ(rope->Length(), chars_written);
+  CHECK_EQ(0, strcmp(expected, buffer));
+  // Writing the whole rope does not flatten it.
+  CHECK(!v8::Utils::OpenHandle(*rope)->IsFlat());
+
+  // Without room for the null terminator.
+  memset(buffer, 'x', sizeof(buffer));
+  written = rope->WriteUtf8(isolate, buffer, expected_length, &chars_written);
+  CHECK_EQ(expected_length, written);
+  CHECK_EQ('x', buffer[expected_length]);
+
+  // Truncated writes go through the flat path.
+  written = rope->WriteUtf8(isolate, buffer, 9, &chars_written);
+  CHECK_EQ(7, written);
+  CHECK_EQ(7, chars_written);
+  CHECK_EQ(0, strncmp(expected, buffer, 7));
+}
+
 TEST(Utf8ConversionPerf) {
   // Smoke test for converting strings to utf-8.
   LocalContext context;
@@ -33,6 +33,7 @@
 #include "src/numbers/bignum.h"
 #include "src/numbers/diy-fp.h"
 #include "src/numbers/double.h"
+#include "src/numbers/eisel-lemire.h"
 #include "src/numbers/strtod.h"
 #include "test/cctest/cctest.h"
 
@@ -475,6 +476,38 @@ TEST(RandomStrtod) {
   }
 }
 
+TEST(EiselLemireStrtod) {
+  double result;
+  CHECK(EiselLemireStrtod(1, 0, &result));
+  CHECK_EQ(1.0, result);
+  CHECK(EiselLemireStrtod(17976931348623157, 292, &result));
+  CHECK_EQ(1.7976931348623157e308, result);
+  CHECK(EiselLemireStrtod(22250738585072014, -324, &result));
+  CHECK_EQ(2.2250738585072014e-308, result);
+  // Exactly halfway between two doubles.
+  CHECK(!EiselLemireStrtod(9007199254740993, 0, &result));
+  // Subnormals and overflow are left to the slow path.
+  CHECK(!EiselLemireStrtod(5, -324, &result));
+  CHECK(!EiselLemireStrtod(1, 309, &result));
+
+  v8::base::RandomNumberGenerator rng;
+  char buffer[kBufferSize];
+  for (int length = 1; length <= 19; length++) {
+    for (int i = 0; i < 100; ++i) {
+      int pos = 0;
+      buffer[pos++] = rng.NextInt(9) + '1';
+      for (int j = 1; j < length; ++j) {
+        buffer[pos++] = rng.NextInt(10) + '0';
+      }
+      buffer[pos] = '\0';
+      uint64_t significand = strtoull(buffer, nullptr, 10);
+      int exponent = rng.NextInt(300 * 2 + 1) - 300;
+      if (!EiselLemireStrtod(significand, exponent, &result)) continue;
+      CHECK(CheckDouble(Vector<const char>(buffer, pos), exponent, result));
+    }
+  }
+}
+
 }  // namespace test_strtod
 }  // namespace internal
 }  // namespace v8
@@ -255,6 +255,40 @@ TEST(DeserializeWireBytesAndSerializedDataInvalid) {
   test.CollectGarbage();
 }
 
+TEST(DeserializeLazily) {
+  WasmSerializationTest test;
+  {
+    FlagScope<bool> lazy_deserialization(&FLAG_wasm_lazy_deserialization, true);
+    HandleScope scope(CcTest::i_isolate());
+    Handle<WasmModuleObject> module_object;
+    CHECK(test.Deserialize().ToHandle(&module_object));
+    NativeModule* native_module = module_object->native_module();
+    uint32_t func_index = native_module->num_imported_functions();
+    CHECK(!native_module->HasCode(func_index));
+    // Running the (cached) module deserializes the function on its first call.
+    test.DeserializeAndRun();
+    CHECK(native_module->HasCode(func_index));
+  }
+  test.CollectGarbage();
+}
+
+TEST(SerializeLazilyDeserializedModule) {
+  WasmSerializationTest test;
+  {
+    FlagScope<bool> lazy_deserialization(&FLAG_wasm_lazy_deserialization, true);
+    HandleScope scope(CcTest::i_isolate());
+    Handle<WasmModuleObject> module_object;
+    CHECK(test.Deserialize().ToHandle(&module_object));
+    NativeModule* native_module = module_object->native_module();
+    uint32_t func_index = native_module->num_imported_functions();
+    CHECK(!native_module->HasCode(func_index));
+    // Serializing deserializes all pending functions first.
+    WasmSerializer serializer(native_module);
+    CHECK(native_module->HasCode(func_index));
+  }
+  test.CollectGarbage();
+}
+
 bool False(v8::Local<v8::Context> context, v8::Local<v8::String> source) {
   return false;
 }
@@ -0,0 +1,52 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax
+
+let {session, contextGroup, Protocol} = InspectorTest.start(
+    'Checks that a breakpoint on a builtin only deopts code calling it.');
+
+contextGroup.addScript(`
+  function callsPush(a) {
+    a.push(1);
+    return a.length;
+  }
+  function unrelated(x) {
+    return x + 1;
+  }
+  function isOptimized(f) {
+    return (%GetOptimizationStatus(f) & 16) !== 0;
+  }
+  %PrepareFunctionForOptimization(callsPush);
+  callsPush([]);
+  callsPush([]);
+  %OptimizeFunctionOnNextCall(callsPush);
+  callsPush([]);
+  %PrepareFunctionForOptimization(unrelated);
+  unrelated(1);
+  unrelated(2);
+  %OptimizeFunctionOnNextCall(unrelated);
+  unrelated(3);
+  //# sourceURL=test.js
+`);
+
+(async function test() {
+  Protocol.Debugger.enable();
+  const before =
+      await Protocol.Runtime.evaluate({expression: 'isOptimized(unrelated)'});
+  const {result: {result: {objectId}}} =
+      await Protocol.Runtime.evaluate({expression: 'Array.prototype.push'});
+  InspectorTest.log('set breakpoint on Array.prototype.push');
+  await Protocol.Debugger.setBreakpointOnFunctionCall({objectId});
+  const after =
+      await Protocol.Runtime.evaluate({expression: 'isOptimized(unrelated)'});
+  InspectorTest.log('unrelated function kept its code: ' +
+      (before.result.result.value === after.result.result.value));
+  InspectorTest.log('call optimized function calling push');
+  Protocol.Runtime.evaluate({expression: 'callsPush([])'});
+  const {params: {callFrames}} = await Protocol.Debugger.oncePaused();
+  InspectorTest.log(`paused in ${callFrames[0].functionName}`);
+  await Protocol.Debugger.resume();
+  InspectorTest.completeTest();
+})();
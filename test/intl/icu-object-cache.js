@@ -0,0 +1,33 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --icu-object-cache-size=2
+
+// toLocaleString and localeCompare cache ICU objects per locale string. Check
+// that the results match freshly constructed formatters while entries get
+// evicted from the small cache.
+const locales = ['en', 'de', 'ar-EG', 'ja', 'de', 'en', 'hi-IN', 'en'];
+const date = new Date(Date.UTC(2019, 4, 8, 4, 16, 4, 845));
+for (let i = 0; i < 3; i++) {
+  for (const locale of locales) {
+    assertEquals(new Intl.NumberFormat(locale).format(1234567.891),
+                 (1234567.891).toLocaleString(locale));
+    assertEquals(new Intl.DateTimeFormat(locale).format(date),
+                 date.toLocaleDateString(locale));
+    assertEquals(
+        new Intl.Collator(locale).compare('a', 'B'),
+        'a'.localeCompare('B', locale));
+  }
+}
+
+// The default locale and invalid locales are not mixed up with the cached
+// entries.
+assertEquals(new Intl.NumberFormat().format(1.5), (1.5).toLocaleString());
+assertThrows(() => (1.5).toLocaleString(''), RangeError);
+assertThrows(() => (1.5).toLocaleString('en\0'), RangeError);
+assertThrows(() => 'a'.localeCompare('b', ''), RangeError);
+
+// Options bypass the cache.
+assertEquals('12%', (0.12).toLocaleString('en', {style: 'percent'}));
+assertEquals('0.12', (0.12).toLocaleString('en'));
@@ -0,0 +1,96 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Throughput of i8x16.shuffle patterns that map to different instruction
+// sequences in the backends. Each benchmark runs a loop that repeatedly
+// shuffles a v128 value with itself, with a second value loaded from memory,
+// or with zero.
+
+const kIterations = 100000;
+
+const kSame = 0;
+const kOther = 1;
+const kZero = 2;
+
+function range(from, length) {
+  return Array.from({length: length}, (_, i) => from + i);
+}
+
+const shuffles = [
+  ['Swizzle32x4', kSame,
+   [12, 13, 14, 15, 8, 9, 10, 11, 4, 5, 6, 7, 0, 1, 2, 3]],
+  ['Shuffle32x4', kOther,
+   [4, 5, 6, 7, 16, 17, 18, 19, 12, 13, 14, 15, 24, 25, 26, 27]],
+  ['Blend32x4', kOther,
+   [0, 1, 2, 3, 20, 21, 22, 23, 8, 9, 10, 11, 28, 29, 30, 31]],
+  ['UnpackLow8x16', kOther,
+   [0, 16, 1, 17, 2, 18, 3, 19, 4, 20, 5, 21, 6, 22, 7, 23]],
+  ['Concat', kOther, range(4, 16)],
+  ['ByteShiftRight', kZero, range(4, 12).concat([16, 16, 16, 16])],
+  ['ByteShiftLeft', kZero, [16, 16, 16, 16].concat(range(0, 12))],
+  ['Reverse8x8', kSame,
+   [7, 6, 5, 4, 3, 2, 1, 0, 15, 14, 13, 12, 11, 10, 9, 8]],
+  ['Generic', kOther,
+   [3, 30, 7, 1, 18, 12, 9, 25, 0, 14, 22, 5, 31, 10, 16, 2]],
+];
+
+// Encodes a module exporting a function "run" that applies {shuffle}
+// {iterations} times to the vector at memory offset 0, stores the result
+// and returns its first i32 lane.
+function moduleBytes(second_input, shuffle) {
+  const kSimdPrefix = 0xfd;
+  let second;
+  switch (second_input) {
+    case kSame:
+      second = [0x20, 1];  // local.get 1
+      break;
+    case kOther:
+      second = [0x20, 2];  // local.get 2
+      break;
+    case kZero:
+      second = [kSimdPrefix, 0x0c].concat(new Array(16).fill(0));  // v128.const
+      break;
+  }
+  const code = [
+    1, 2, 0x7b,                        // two v128 locals
+    0x41, 0, kSimdPrefix, 0x00, 4, 0,  // v128.load [0]
+    0x21, 1,                           // local.set 1
+    0x41, 0, kSimdPrefix, 0x00, 4, 16, // v128.load [16]
+    0x21, 2,                           // local.set 2
+    0x03, 0x40,                        // loop
+    0x20, 1,                           // local.get 1
+    ...second,
+    kSimdPrefix, 0x0d, ...shuffle,     // i8x16.shuffle
+    0x21, 1,                           // local.set 1
+    0x20, 0, 0x41, 1, 0x6b,            // local.get 0, i32.const 1, i32.sub
+    0x22, 0,                           // local.tee 0
+    0x0d, 0,                           // br_if 0
+    0x0b,                              // end
+    0x41, 0, 0x20, 1,                  // i32.const 0, local.get 1
+    kSimdPrefix, 0x0b, 4, 0,           // v128.store [0]
+    0x41, 0, 0x28, 2, 0,               // i32.load [0]
+    0x0b                               // end
+  ];
+  return new Uint8Array([
+    0x00, 0x61, 0x73, 0x6d, 0x01, 0x00, 0x00, 0x00,  // magic and version
+    1, 6, 1, 0x60, 1, 0x7f, 1, 0x7f,                 // type [i32] -> [i32]
+    3, 2, 1, 0,                                      // function
+    5, 3, 1, 0, 1,                                   // memory 0 1
+    7, 7, 1, 3, 0x72, 0x75, 0x6e, 0, 0,              // export "run"
+    10, code.length + 2, 1, code.length, ...code     // code
+  ]);
+}
+
+function createBenchmark(second_input, shuffle) {
+  const instance = new WebAssembly.Instance(
+      new WebAssembly.Module(moduleBytes(second_input, shuffle)));
+  return () => instance.exports.run(kIterations);
+}
+
+for (const [name, second_input, shuffle] of shuffles) {
+  new BenchmarkSuite(name, [1000], [
+    new Benchmark(name, false, false, 0,
+                  createBenchmark(second_input, shuffle)),
+  ]);
+}
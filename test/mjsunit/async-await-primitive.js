@@ -0,0 +1,62 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Awaiting primitives resumes after exactly one microtask.
+
+(function TestInterleaving() {
+  const log = [];
+  const values = [1, 1.5, 'str', undefined, null, true, Symbol(), 1n];
+
+  async function run() {
+    for (const value of values) {
+      const result = await value;
+      assertSame(value, result);
+      log.push(typeof value);
+    }
+  }
+
+  run();
+  let p = Promise.resolve();
+  for (let i = 0; i < values.length; i++) {
+    p = p.then(() => log.push(i));
+  }
+  assertPromiseResult(p.then(() => {
+    assertEquals([
+      'number', 0, 'number', 1, 'string', 2, 'undefined', 3, 'object', 4,
+      'boolean', 5, 'symbol', 6, 'bigint', 7
+    ], log);
+  }));
+})();
+
+(function TestAsyncGenerator() {
+  const log = [];
+
+  async function* gen() {
+    log.push(await 1);
+    yield await 'a';
+    log.push(await undefined);
+  }
+
+  const it = gen();
+  assertPromiseResult(
+      it.next()
+          .then(result => {
+            assertEquals({value: 'a', done: false}, result);
+            return it.next();
+          })
+          .then(result => {
+            assertEquals({value: undefined, done: true}, result);
+            assertEquals([1, undefined], log);
+          }));
+})();
+
+(function TestThrowAfterAwait() {
+  async function f() {
+    await 42;
+    throw new Error('after');
+  }
+  assertPromiseResult(f(), assertUnreachable, e => {
+    assertEquals('after', e.message);
+  });
+})();
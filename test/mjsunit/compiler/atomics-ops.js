@@ -0,0 +1,81 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --harmony-sharedarraybuffer --opt --no-always-opt
+
+// Check that the Atomics operations inlined into optimized code behave like
+// the builtins for all integer element types.
+
+const kTypes = [
+  Int8Array, Uint8Array, Int16Array, Uint16Array, Int32Array, Uint32Array
+];
+
+for (const Type of kTypes) {
+  const sab = new SharedArrayBuffer(Type.BYTES_PER_ELEMENT * 8);
+  const ta = new Type(sab);
+  const ref = new Type(8);
+
+  function ops(a, i, v) {
+    const results = [];
+    results.push(Atomics.store(a, i, v));
+    results.push(Atomics.add(a, i, 3));
+    results.push(Atomics.sub(a, i, 1));
+    results.push(Atomics.and(a, i, 0x7e));
+    results.push(Atomics.or(a, i, 0x81));
+    results.push(Atomics.xor(a, i, 0xff));
+    results.push(Atomics.exchange(a, i, -1));
+    results.push(Atomics.compareExchange(a, i, -1, v));
+    results.push(Atomics.compareExchange(a, i, 42, 0));
+    results.push(Atomics.load(a, i));
+    return results;
+  }
+
+  const expected = [];
+  for (let i = 0; i < 8; ++i) expected.push(ops(ref, i, i * 37 - 100));
+
+  %PrepareFunctionForOptimization(ops);
+  ops(ta, 0, 1);
+  ops(ta, 1, 2);
+  %OptimizeFunctionOnNextCall(ops);
+  for (let i = 0; i < 8; ++i) {
+    assertEquals(expected[i], ops(ta, i, i * 37 - 100));
+  }
+  assertOptimized(ops);
+  assertEquals(ref, new Type(ta.buffer.slice()));
+
+  // Out of bounds accesses throw like in the builtins.
+  assertThrows(() => ops(ta, 8, 0), RangeError);
+}
+
+// Atomics.store returns the value converted by ToIntegerOrInfinity.
+(function() {
+  const ta = new Int32Array(new SharedArrayBuffer(16));
+  function store(i, v) { return Atomics.store(ta, i, v); }
+
+  %PrepareFunctionForOptimization(store);
+  assertEquals(1, store(0, 1));
+  %OptimizeFunctionOnNextCall(store);
+  assertEquals(2, store(1, 2));
+  assertOptimized(store);
+  assertEquals(3, store(2, 3.5));
+  assertEquals(3, ta[2]);
+  assertEquals(0, store(3, -0));
+  assertTrue(Object.is(0, store(3, -0)));
+})();
+
+// Atomics operations in a loop.
+(function() {
+  const ta = new Int32Array(new SharedArrayBuffer(16));
+  function sum(n) {
+    for (let i = 0; i < n; ++i) Atomics.add(ta, i & 3, i);
+    return Atomics.load(ta, 0) + Atomics.load(ta, 1) + Atomics.load(ta, 2) +
+        Atomics.load(ta, 3);
+  }
+
+  %PrepareFunctionForOptimization(sum);
+  assertEquals(45, sum(10));
+  %OptimizeFunctionOnNextCall(sum);
+  assertEquals(90, sum(10));
+  assertOptimized(sum);
+})();
@@ -0,0 +1,64 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --turbo-elide-bounded-loop-stack-checks
+// Flags: --turbo-bounded-loop-max-iterations=100
+
+// Loops whose stack checks may be removed must still compute the same
+// results, including loops that exit early or have bounds outside the limit.
+
+function sumUp() {
+  let sum = 0;
+  for (let i = 0; i < 16; i++) sum += i;
+  return sum;
+}
+%PrepareFunctionForOptimization(sumUp);
+assertEquals(120, sumUp());
+%OptimizeFunctionOnNextCall(sumUp);
+assertEquals(120, sumUp());
+
+function sumDown() {
+  let sum = 0;
+  for (let i = 16; i > 0; i -= 2) sum += i;
+  return sum;
+}
+%PrepareFunctionForOptimization(sumDown);
+assertEquals(72, sumDown());
+%OptimizeFunctionOnNextCall(sumDown);
+assertEquals(72, sumDown());
+
+function nested(n) {
+  let sum = 0;
+  for (let i = 0; i <= 3; i++) {
+    // The inner loop isn't bounded by a constant and keeps its check.
+    for (let j = 0; j < n; j++) sum += i * j;
+  }
+  return sum;
+}
+%PrepareFunctionForOptimization(nested);
+assertEquals(6 * 45, nested(10));
+%OptimizeFunctionOnNextCall(nested);
+assertEquals(6 * 45, nested(10));
+
+function earlyExit(a) {
+  for (let i = 0; i < 50; i++) {
+    if (a[i] === undefined) return i;
+  }
+  return -1;
+}
+%PrepareFunctionForOptimization(earlyExit);
+assertEquals(3, earlyExit([1, 2, 3]));
+%OptimizeFunctionOnNextCall(earlyExit);
+assertEquals(3, earlyExit([1, 2, 3]));
+assertEquals(-1, earlyExit(new Array(60).fill(0)));
+
+function tooLong() {
+  let sum = 0;
+  for (let i = 0; i < 1000; i++) sum += i;
+  return sum;
+}
+%PrepareFunctionForOptimization(tooLong);
+assertEquals(499500, tooLong());
+%OptimizeFunctionOnNextCall(tooLong);
+assertEquals(499500, tooLong());
@@ -0,0 +1,85 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax
+
+(function testMapEntries() {
+  function foo(map) {
+    let result = 0;
+    for (const [k, v] of map) result += k * v;
+    return result;
+  }
+
+  const map = new Map([[1, 2], [3, 4], [5, 6]]);
+  %PrepareFunctionForOptimization(foo);
+  assertEquals(44, foo(map));
+  assertEquals(44, foo(map));
+  %OptimizeFunctionOnNextCall(foo);
+  assertEquals(44, foo(map));
+  map.set(7, 8);
+  assertEquals(100, foo(map));
+})();
+
+(function testSetEntries() {
+  function foo(set) {
+    let result = 0;
+    for (const [a, b] of set.entries()) result += a + b;
+    return result;
+  }
+
+  const set = new Set([1, 2, 3]);
+  %PrepareFunctionForOptimization(foo);
+  assertEquals(12, foo(set));
+  assertEquals(12, foo(set));
+  %OptimizeFunctionOnNextCall(foo);
+  assertEquals(12, foo(set));
+})();
+
+(function testMapMutationDuringIteration() {
+  function foo(map) {
+    const keys = [];
+    for (const k of map.keys()) {
+      keys.push(k);
+      if (k === 1) map.delete(2);
+      if (k === 3) map.set(4, 4);
+    }
+    return keys;
+  }
+
+  %PrepareFunctionForOptimization(foo);
+  assertEquals([1, 3, 4], foo(new Map([[1, 1], [2, 2], [3, 3]])));
+  assertEquals([1, 3, 4], foo(new Map([[1, 1], [2, 2], [3, 3]])));
+  %OptimizeFunctionOnNextCall(foo);
+  assertEquals([1, 3, 4], foo(new Map([[1, 1], [2, 2], [3, 3]])));
+})();
+
+(function testString() {
+  function foo(s) {
+    let result = "";
+    for (const c of s) result = c + result;
+    return result;
+  }
+
+  %PrepareFunctionForOptimization(foo);
+  assertEquals("cba", foo("abc"));
+  assertEquals("cba", foo("abc"));
+  %OptimizeFunctionOnNextCall(foo);
+  assertEquals("cba", foo("abc"));
+  assertEquals("\u{1F600}a", foo("a\u{1F600}"));
+})();
+
+(function testArray() {
+  function foo(a) {
+    let result = 0;
+    for (const x of a) result += x;
+    return result;
+  }
+
+  %PrepareFunctionForOptimization(foo);
+  assertEquals(6, foo([1, 2, 3]));
+  assertEquals(6, foo([1, 2, 3]));
+  %OptimizeFunctionOnNextCall(foo);
+  assertEquals(6, foo([1, 2, 3]));
+  assertEquals(6.5, foo([1, 2, 3.5]));
+})();
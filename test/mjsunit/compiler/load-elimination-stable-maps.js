@@ -0,0 +1,57 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax
+
+// Map checks on objects with stable maps survive calls and loop back-edges.
+// Make sure we still notice when the callee changes the map.
+
+let mutate = false;
+function g(o) {
+  if (mutate) {
+    delete o.x;
+    o.x = 'changed';
+  }
+}
+%NeverOptimizeFunction(g);
+
+function f(o) {
+  let result = '';
+  for (let i = 0; i < 3; i++) {
+    result += o.x;
+    g(o);
+  }
+  return result;
+}
+
+function makeObject() {
+  return {x: 1};
+}
+
+%PrepareFunctionForOptimization(f);
+assertEquals('111', f(makeObject()));
+assertEquals('111', f(makeObject()));
+%OptimizeFunctionOnNextCall(f);
+assertEquals('111', f(makeObject()));
+mutate = true;
+assertEquals('1changedchanged', f(makeObject()));
+mutate = false;
+assertEquals('111', f(makeObject()));
+
+// The same with the map changing in the loop itself.
+function h(o, n) {
+  let result = 0;
+  for (let i = 0; i < n; i++) {
+    result += o.x;
+    if (i == 1) o.y = 1;
+  }
+  return result;
+}
+
+%PrepareFunctionForOptimization(h);
+assertEquals(2, h(makeObject(), 2));
+assertEquals(2, h(makeObject(), 2));
+%OptimizeFunctionOnNextCall(h);
+assertEquals(2, h(makeObject(), 2));
+assertEquals(3, h(makeObject(), 3));
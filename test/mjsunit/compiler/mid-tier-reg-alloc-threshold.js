@@ -0,0 +1,18 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --mid-tier-reg-alloc-instruction-threshold=1
+
+function sum(a, b, c) {
+  let result = 0;
+  for (let i = 0; i < a; i++) {
+    result += i * b + c;
+  }
+  return result;
+}
+
+%PrepareFunctionForOptimization(sum);
+assertEquals(sum(10, 2, 3), 120);
+%OptimizeFunctionOnNextCall(sum);
+assertEquals(sum(10, 2, 3), 120);
@@ -0,0 +1,58 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --harmony-private-methods --allow-natives-syntax
+
+(function testInstanceAccessors() {
+  class A {
+    #value = 1;
+    get #a() { return this.#value; }
+    set #a(v) { this.#value = v; }
+
+    increment() { return ++this.#a; }
+  }
+
+  const a = new A();
+  %PrepareFunctionForOptimization(a.increment);
+  assertEquals(2, a.increment());
+  assertEquals(3, a.increment());
+  %OptimizeFunctionOnNextCall(a.increment);
+  assertEquals(4, a.increment());
+  assertThrows(() => a.increment.call({}), TypeError);
+})();
+
+(function testStaticAccessors() {
+  class B {
+    static #value = 1;
+    static get #b() { return B.#value; }
+    static set #b(v) { B.#value = v; }
+
+    static increment() { return ++B.#b; }
+  }
+
+  %PrepareFunctionForOptimization(B.increment);
+  assertEquals(2, B.increment());
+  assertEquals(3, B.increment());
+  %OptimizeFunctionOnNextCall(B.increment);
+  assertEquals(4, B.increment());
+})();
+
+(function testGetterOnlyAndSetterOnly() {
+  class C {
+    get #g() { return 42; }
+    set #s(v) { this.stored = v; }
+
+    run() {
+      this.#s = this.#g;
+      return this.stored;
+    }
+  }
+
+  const c = new C();
+  %PrepareFunctionForOptimization(c.run);
+  assertEquals(42, c.run());
+  assertEquals(42, c.run());
+  %OptimizeFunctionOnNextCall(c.run);
+  assertEquals(42, c.run());
+})();
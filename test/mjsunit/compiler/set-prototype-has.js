@@ -0,0 +1,63 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax
+
+// Lookups with int32 keys, which take the inline path.
+(() => {
+  const set = new Set([1, 2, -3, 1.5, 2 ** 40]);
+  function has(i) {
+    return set.has(i | 0);
+  }
+
+  %PrepareFunctionForOptimization(has);
+  assertTrue(has(1));
+  assertFalse(has(4));
+  %OptimizeFunctionOnNextCall(has);
+  assertTrue(has(1));
+  assertTrue(has(2));
+  assertTrue(has(-3));
+  assertFalse(has(0));
+  assertFalse(has(4));
+})();
+
+// Lookups with arbitrary keys, which call the FindOrderedHashSetEntry
+// builtin.
+(() => {
+  const object = {};
+  const set = new Set(['a', object, 1.5, -0, NaN, 10n]);
+  function has(key) {
+    return set.has(key);
+  }
+
+  %PrepareFunctionForOptimization(has);
+  assertTrue(has('a'));
+  assertFalse(has('b'));
+  %OptimizeFunctionOnNextCall(has);
+  assertTrue(has('a'));
+  assertTrue(has('ab'.substring(0, 1)));
+  assertTrue(has(object));
+  assertFalse(has({}));
+  assertTrue(has(1.5));
+  assertTrue(has(0));
+  assertTrue(has(NaN));
+  assertTrue(has(10n));
+  assertFalse(has(undefined));
+  set.add(undefined);
+  assertTrue(has(undefined));
+})();
+
+// A receiver that isn't a Set still throws.
+(() => {
+  function has(set, key) {
+    return set.has(key);
+  }
+
+  %PrepareFunctionForOptimization(has);
+  assertTrue(has(new Set([1]), 1));
+  %OptimizeFunctionOnNextCall(has);
+  assertTrue(has(new Set([1]), 1));
+  assertThrows(() => Set.prototype.has.call(new Map(), 1), TypeError);
+  assertEquals(false, has(new Map(), 1));
+})();
@@ -0,0 +1,110 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax
+
+function sum() {
+  let result = 0;
+  for (let i = 0; i < arguments.length; ++i) result += arguments[i];
+  return result;
+}
+
+(function testCallWithSpreadOfNewArray() {
+  function foo(a, b, c) {
+    return sum(...new Array(a, b, c));
+  }
+
+  %PrepareFunctionForOptimization(foo);
+  assertEquals(6, foo(1, 2, 3));
+  assertEquals(6, foo(1, 2, 3));
+  %OptimizeFunctionOnNextCall(foo);
+  assertEquals(6, foo(1, 2, 3));
+  assertEquals("abc", foo("a", "b", "c"));
+})();
+
+(function testCallWithSpreadOfEmptyArray() {
+  function foo(a) {
+    return sum(a, ...[]);
+  }
+
+  %PrepareFunctionForOptimization(foo);
+  assertEquals(1, foo(1));
+  assertEquals(1, foo(1));
+  %OptimizeFunctionOnNextCall(foo);
+  assertEquals(1, foo(1));
+})();
+
+(function testCallWithSpreadOfSingleLengthArray() {
+  function countArgs() {
+    return arguments.length;
+  }
+  function foo(n) {
+    return countArgs(...new Array(n));
+  }
+
+  %PrepareFunctionForOptimization(foo);
+  assertEquals(3, foo(3));
+  assertEquals(3, foo(3));
+  %OptimizeFunctionOnNextCall(foo);
+  assertEquals(3, foo(3));
+})();
+
+(function testConstructWithSpreadOfNewArray() {
+  function A(a, b) {
+    this.sum = a + b;
+  }
+  function foo(a, b) {
+    return new A(...new Array(a, b));
+  }
+
+  %PrepareFunctionForOptimization(foo);
+  assertEquals(3, foo(1, 2).sum);
+  assertEquals(3, foo(1, 2).sum);
+  %OptimizeFunctionOnNextCall(foo);
+  assertEquals(3, foo(1, 2).sum);
+})();
+
+(function testApplyWithNewArray() {
+  function foo(a, b) {
+    return sum.apply(undefined, new Array(a, b));
+  }
+
+  %PrepareFunctionForOptimization(foo);
+  assertEquals(3, foo(1, 2));
+  assertEquals(3, foo(1, 2));
+  %OptimizeFunctionOnNextCall(foo);
+  assertEquals(3, foo(1, 2));
+})();
+
+(function testArrayEscapes() {
+  let escaped;
+  function foo(a, b) {
+    const array = new Array(a, b);
+    escaped = array;
+    return sum(...array);
+  }
+
+  %PrepareFunctionForOptimization(foo);
+  assertEquals(3, foo(1, 2));
+  assertEquals(3, foo(1, 2));
+  %OptimizeFunctionOnNextCall(foo);
+  assertEquals(3, foo(1, 2));
+  assertEquals([1, 2], escaped);
+})();
+
+// This test invalidates the array iterator protector, so it must come last.
+(function testArrayIteratorProtector() {
+  function foo(a, b) {
+    return sum(...new Array(a, b));
+  }
+
+  %PrepareFunctionForOptimization(foo);
+  assertEquals(3, foo(1, 2));
+  assertEquals(3, foo(1, 2));
+  %OptimizeFunctionOnNextCall(foo);
+  assertEquals(3, foo(1, 2));
+
+  Array.prototype[Symbol.iterator] = function*() { yield 42; };
+  assertEquals(42, foo(1, 2));
+})();
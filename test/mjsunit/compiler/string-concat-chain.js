@@ -0,0 +1,37 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax
+
+// Concatenation chains whose combined constant parts are long enough to
+// allocate ConsStrings inline, with empty and non-empty substitutions.
+(() => {
+  function f(a, b) {
+    return `<${a}|${b}>` + 'abcdef' + 'ghijkl' + a;
+  }
+
+  %PrepareFunctionForOptimization(f);
+  assertEquals('<x|y>abcdefghijklx', f('x', 'y'));
+  assertEquals('<|>abcdefghijkl', f('', ''));
+  %OptimizeFunctionOnNextCall(f);
+  assertEquals('<x|y>abcdefghijklx', f('x', 'y'));
+  assertEquals('<|>abcdefghijkl', f('', ''));
+  assertEquals('<ሴ|>abcdefghijklሴ', f('ሴ', ''));
+})();
+
+(() => {
+  function f(a) {
+    const s = 'abcdefg' + a;
+    return s + 'hijklmn' + a + '!';
+  }
+
+  %PrepareFunctionForOptimization(f);
+  assertEquals('abcdefgxhijklmnx!', f('x'));
+  %OptimizeFunctionOnNextCall(f);
+  assertEquals('abcdefgxhijklmnx!', f('x'));
+  assertEquals('abcdefghijklmn!', f(''));
+  const result = f('');
+  assertEquals(15, result.length);
+  assertEquals('!', result[14]);
+})();
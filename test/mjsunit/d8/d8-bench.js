@@ -0,0 +1,9 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --bench --bench-isolates=2 --bench-iterations=3
+
+// Each isolate runs the scripts three times in the same context.
+var iterations = (typeof iterations === 'undefined') ? 1 : iterations + 1;
+assertTrue(iterations <= 3);
@@ -0,0 +1,44 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Fixed-width ISO 8601 strings take a fast path in the date parser. Check
+// that they parse like the general ES5 date-time string grammar.
+
+assertEquals(Date.UTC(2019, 4, 8), Date.parse('2019-05-08'));
+assertEquals(Date.UTC(2019, 4, 8, 4, 16, 4, 845),
+             Date.parse('2019-05-08T04:16:04.845Z'));
+assertEquals(Date.UTC(2019, 4, 8, 4, 16, 4),
+             Date.parse('2019-05-08T04:16:04Z'));
+assertEquals(Date.UTC(2019, 4, 8, 4, 16), Date.parse('2019-05-08T04:16Z'));
+assertEquals(Date.UTC(2019, 4, 8, 2, 46, 4, 845),
+             Date.parse('2019-05-08T04:16:04.845+01:30'));
+assertEquals(Date.UTC(2019, 4, 8, 5, 46, 4, 845),
+             Date.parse('2019-05-08T04:16:04.845-01:30'));
+assertEquals(new Date(0).setUTCFullYear(0, 0, 1), Date.parse('0000-01-01'));
+
+// Date-time forms without an offset are local time.
+assertEquals(new Date(2019, 4, 8, 4, 16, 4, 845).getTime(),
+             Date.parse('2019-05-08T04:16:04.845'));
+assertEquals(new Date(2019, 4, 8, 4, 16).getTime(),
+             Date.parse('2019-05-08T04:16'));
+
+// Days are not checked against the length of the month.
+assertEquals(Date.UTC(2015, 1, 31), Date.parse('2015-02-31'));
+
+// Strings that do not have the fixed-width shape use the full parser.
+assertEquals(Date.UTC(2019, 4, 8, 24), Date.parse('2019-05-08T24:00Z'));
+assertEquals(Date.UTC(2019, 4, 8, 4, 16, 4, 500),
+             Date.parse('2019-05-08T04:16:04.5Z'));
+assertEquals(Date.UTC(2019, 4, 8, 4, 16, 4, 123),
+             Date.parse('2019-05-08T04:16:04.123456Z'));
+assertEquals(Date.UTC(2019, 4, 8, 2, 46),
+             Date.parse('2019-05-08T04:16+0130'));
+assertEquals(Date.UTC(-1, 0, 1), Date.parse('-000001-01-01'));
+
+// Invalid strings.
+assertEquals(NaN, Date.parse('2019-05-08T25:00Z'));
+assertEquals(NaN, Date.parse('2019-05-08T04:60Z'));
+assertEquals(NaN, Date.parse('2019-05-08T04:16:60Z'));
+assertEquals(NaN, Date.parse('2019-05-08T04:16:04.845+24:00'));
+assertEquals(NaN, Date.parse('2019-05-08T04:16:04.845Zx'));
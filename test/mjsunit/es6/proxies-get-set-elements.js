@@ -0,0 +1,73 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Trap result invariant checks for element keys on various targets.
+
+(function testFastElementsTarget() {
+  const handler = {
+    get() { return 42; },
+    set() { return true; }
+  };
+  for (const target of [[1, 2, 3], [1.5, 2.5], [{}, , {}], {0: 1, 1: 2}]) {
+    const proxy = new Proxy(target, handler);
+    assertEquals(42, proxy[0]);
+    assertEquals(42, proxy[1]);
+    assertEquals(42, proxy[100]);
+    assertEquals(42, proxy['2']);
+    proxy[0] = 1;
+    proxy[9999999] = 1;
+    proxy[10000000] = 1;
+  }
+})();
+
+(function testFrozenTarget() {
+  const target = Object.freeze([1, 2, 3]);
+  const proxy = new Proxy(target, {
+    get() { return 42; },
+    set() { return true; }
+  });
+  assertThrows(() => proxy[0], TypeError);
+  assertThrows(() => { 'use strict'; proxy[1] = 1; }, TypeError);
+  assertEquals(42, proxy[3]);
+})();
+
+(function testSealedTarget() {
+  const target = Object.seal([1, 2, 3]);
+  const proxy = new Proxy(target, { get() { return 42; } });
+  assertEquals(42, proxy[0]);
+})();
+
+(function testNonConfigurableElement() {
+  const target = [1, 2, 3];
+  Object.defineProperty(target, 1, {value: 2, configurable: false,
+                                    writable: false});
+  const proxy = new Proxy(target, {
+    get() { return 42; },
+    set() { return true; }
+  });
+  assertEquals(42, proxy[0]);
+  assertThrows(() => proxy[1], TypeError);
+  assertThrows(() => { 'use strict'; proxy[1] = 1; }, TypeError);
+})();
+
+(function testNonConfigurableAccessor() {
+  const target = {};
+  Object.defineProperty(target, 0, {set(v) {}, configurable: false});
+  const proxy = new Proxy(target, { get() { return 42; } });
+  assertThrows(() => proxy[0], TypeError);
+})();
+
+(function testStringWrapperTarget() {
+  const proxy = new Proxy(new String('abc'), { get() { return 42; } });
+  assertThrows(() => proxy[0], TypeError);
+  assertEquals(42, proxy[3]);
+})();
+
+(function testLargeIndexNamedProperty() {
+  const target = [];
+  Object.defineProperty(target, '4294967295', {value: 1, configurable: false,
+                                               writable: false});
+  const proxy = new Proxy(target, { get() { return 42; } });
+  assertThrows(() => proxy[4294967295], TypeError);
+})();
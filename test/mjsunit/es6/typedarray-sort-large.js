@@ -0,0 +1,64 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Sorting integer typed arrays long enough to be sorted without comparisons.
+
+const ctors = [
+  Int8Array, Uint8Array, Uint8ClampedArray, Int16Array, Uint16Array,
+  Int32Array, Uint32Array
+];
+
+let seed = 17;
+function random() {
+  seed = (seed * 1103515245 + 12345) & 0x7fffffff;
+  return seed;
+}
+
+function checkSorted(array) {
+  const expected = Array.from(array).sort((a, b) => a - b);
+  array.sort();
+  for (let i = 0; i < array.length; i++) {
+    assertEquals(expected[i], array[i]);
+  }
+}
+
+for (const ctor of ctors) {
+  for (const length of [255, 256, 1000, 8192, 10000]) {
+    // Random values of the full range, including negative ones.
+    const array = new ctor(length);
+    for (let i = 0; i < length; i++) array[i] = random() * 2654435761;
+    checkSorted(array);
+
+    // Values that only differ in the lowest byte.
+    const narrow = new ctor(length);
+    for (let i = 0; i < length; i++) narrow[i] = (random() & 0xf) - 8;
+    checkSorted(narrow);
+
+    // Already sorted and constant arrays.
+    checkSorted(narrow);
+    checkSorted(new ctor(length).fill(3));
+  }
+}
+
+// Extreme values.
+const int32 = new Int32Array(300);
+int32[0] = 0x7fffffff;
+int32[1] = -0x80000000;
+int32[2] = -1;
+int32.sort();
+assertEquals(-0x80000000, int32[0]);
+assertEquals(-1, int32[1]);
+assertEquals(0x7fffffff, int32[299]);
+
+const uint32 = new Uint32Array(300);
+uint32[0] = 0xffffffff;
+uint32[1] = 0x80000000;
+uint32.sort();
+assertEquals(0x80000000, uint32[298]);
+assertEquals(0xffffffff, uint32[299]);
+
+// Shared buffers are sorted through a copy.
+const shared = new Int16Array(new SharedArrayBuffer(2 * 9000));
+for (let i = 0; i < shared.length; i++) shared[i] = random();
+checkSorted(shared);
@@ -0,0 +1,56 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --harmony-sharedarraybuffer --harmony-atomics-waitasync
+
+(function test() {
+  const L = 8;
+  const N = 3;
+  const sab = new SharedArrayBuffer(4 * L);
+  const i32a = new Int32Array(sab);
+
+  let log = [];
+
+  // Create N async waiters on each of L locations.
+  for (let location = 0; location < L; ++location) {
+    for (let i = 0; i < N; ++i) {
+      const result = Atomics.waitAsync(i32a, location, 0);
+      assertEquals(true, result.async);
+      result.value.then(
+        (value) => { assertEquals("ok", value); log.push(location); },
+        () => { assertUnreachable(); });
+    }
+  }
+  for (let location = 0; location < L; ++location) {
+    assertEquals(N, %AtomicsNumWaitersForTesting(i32a, location));
+  }
+
+  // Waking up waiters on one location doesn't affect the other locations.
+  assertEquals(1, Atomics.notify(i32a, 3, 1));
+  assertEquals(N - 1, %AtomicsNumWaitersForTesting(i32a, 3));
+  assertEquals(1, %AtomicsNumUnresolvedAsyncPromisesForTesting(i32a, 3));
+  assertEquals(N, Atomics.notify(i32a, 5));
+  assertEquals(0, %AtomicsNumWaitersForTesting(i32a, 5));
+  for (let location = 0; location < L; ++location) {
+    if (location == 3 || location == 5) continue;
+    assertEquals(N, %AtomicsNumWaitersForTesting(i32a, location));
+    assertEquals(0,
+                 %AtomicsNumUnresolvedAsyncPromisesForTesting(i32a, location));
+  }
+
+  // Wake up the rest.
+  for (let location = 0; location < L; ++location) {
+    Atomics.notify(i32a, location);
+    assertEquals(0, %AtomicsNumWaitersForTesting(i32a, location));
+  }
+
+  function continuation() {
+    assertEquals(L * N, log.length);
+    // The first two wake-ups are resolved first.
+    assertEquals(3, log[0]);
+    assertEquals(5, log[1]);
+  }
+
+  setTimeout(continuation, 0);
+})();
@@ -0,0 +1,32 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --dynamic-import-fast-path
+
+import * as static_ns from 'modules-skip-1.mjs';
+
+// import() of a static dependency resolves to the same namespace, also from
+// nested functions and eval.
+var ns1, ns2, ns3;
+import('modules-skip-1.mjs').then(x => ns1 = x);
+(() => import('modules-skip-1.mjs'))().then(x => ns2 = x);
+eval("import('modules-skip-1.mjs')").then(x => ns3 = x);
+
+// The Function constructor has no module context, so this goes through the
+// embedder.
+var ns4;
+new Function("return import('modules-skip-1.mjs')")().then(x => ns4 = x);
+
+// Module specifiers that are not statically imported go through the
+// embedder as well.
+var ns5;
+import('modules-skip-13.mjs').then(x => ns5 = x);
+
+%PerformMicrotaskCheckpoint();
+assertSame(static_ns, ns1);
+assertSame(static_ns, ns2);
+assertSame(static_ns, ns3);
+assertSame(static_ns, ns4);
+assertEquals(42, ns1.life());
+assertEquals(42, ns5.default);
@@ -0,0 +1,27 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax
+
+// Objects at the same nesting depth share their maps, also when they are not
+// direct siblings in an array.
+let result = JSON.parse(
+    '[{"a": {"x": 1, "y": "s"}}, {"a": {"x": 2, "y": "t"}}]');
+assertTrue(%HaveSameMap(result[0], result[1]));
+assertTrue(%HaveSameMap(result[0].a, result[1].a));
+
+result = JSON.parse('[[{"x": 1, "y": 2}], [{"x": 3, "y": 4}]]');
+assertTrue(%HaveSameMap(result[0][0], result[1][0]));
+
+// Differing keys or representations don't reuse the feedback.
+result = JSON.parse(
+    '{"p": {"x": 1, "y": 2}, "q": {"x": 1, "z": 2}, "r": {"x": 1.5, "y": 2}}');
+assertFalse(%HaveSameMap(result.p, result.q));
+assertEquals({x: 1, y: 2}, result.p);
+assertEquals({x: 1, z: 2}, result.q);
+assertEquals({x: 1.5, y: 2}, result.r);
+assertEquals(["x", "z"], Object.keys(result.q));
+
+result = JSON.parse('[{"a": {"x": 1}}, {"b": {"x": "s", "y": {}}}]');
+assertEquals({x: "s", y: {}}, result[1].b);
@@ -0,0 +1,26 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// String contents are scanned several characters at a time. Check quotes,
+// escapes and control characters at every offset within a word.
+
+for (const filler of ["a", "é", "π"]) {
+  for (let i = 0; i < 20; i++) {
+    const prefix = filler.repeat(i);
+    assertEquals(prefix, JSON.parse(`"${prefix}"`));
+    assertEquals([prefix + "x", 1], JSON.parse(`["${prefix}x", 1]`));
+    assertEquals(prefix + "\"" + prefix,
+                 JSON.parse(`"${prefix}\\"${prefix}"`));
+    assertEquals(prefix + "\n", JSON.parse(`"${prefix}\\n"`));
+    assertEquals(prefix + "ሴ", JSON.parse(`"${prefix}\\u1234"`));
+    assertThrows(() => JSON.parse(`"${prefix}\n"`), SyntaxError);
+    assertThrows(() => JSON.parse(`"${prefix}\u001f"`), SyntaxError);
+    assertThrows(() => JSON.parse(`"${prefix}`), SyntaxError);
+  }
+}
+
+// Two-byte sources with only Latin1 string contents.
+const key = "π";
+assertEquals({[key]: "abcdefghijklmnop"},
+             JSON.parse(`{"${key}": "abcdefghijklmnop"}`));
@@ -0,0 +1,24 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Keys of objects with the same map are checked for escapes only once per
+// JSON.stringify call.
+
+const plain = Array.from({length: 3}, (_, i) => ({a: i, bb: "x", "c d": null}));
+assertEquals('[{"a":0,"bb":"x","c d":null},{"a":1,"bb":"x","c d":null},' +
+             '{"a":2,"bb":"x","c d":null}]', JSON.stringify(plain));
+assertEquals('[\n  {\n    "a": 0,\n    "bb": "x",\n    "c d": null\n  }\n]',
+             JSON.stringify(plain.slice(0, 1), undefined, 2));
+
+// Keys that need escaping alternate with plain ones.
+const mixed = [{"q\"": 1}, {q: 2}, {"q\"": 3}, {"π": 4}, {"q\n": 5}, {q: 6}];
+assertEquals('[{"q\\"":1},{"q":2},{"q\\"":3},{"π":4},{"q\\n":5},{"q":6}]',
+             JSON.stringify(mixed));
+
+// Plain keys in two-byte output.
+assertEquals('[{"a":"π"},{"a":"b"}]', JSON.stringify([{a: "π"}, {a: "b"}]));
+
+// Keys whose values are skipped keep the separators right.
+assertEquals('[{"b":2},{"b":2}]',
+             JSON.stringify([{a: undefined, b: 2}, {a: () => 1, b: 2}]));
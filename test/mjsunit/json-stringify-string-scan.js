@@ -0,0 +1,19 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Strings are scanned for characters that need escaping several characters
+// at a time. Check such characters at every offset within a word.
+
+for (const filler of ["a", " ", "π"]) {
+  for (let i = 0; i < 20; i++) {
+    const prefix = filler.repeat(i);
+    for (const [c, escaped] of [['"', '\\"'], ['\\', '\\\\'], ['\n', '\\n'],
+                                ['\x01', '\\u0001'], ['\x7f', '\x7f'],
+                                ['é', 'é'], ['\ud800', '\\ud800'],
+                                ['😀', '😀']]) {
+      assertEquals(`"${prefix}${escaped}${prefix}"`,
+                   JSON.stringify(prefix + c + prefix));
+    }
+  }
+}
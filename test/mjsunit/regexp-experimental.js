@@ -0,0 +1,59 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --enable-experimental-regexp-engine
+
+function Test(regexp, subject, expected) {
+  assertEquals("EXPERIMENTAL", %RegexpTypeTag(regexp));
+  assertEquals(expected, regexp.exec(subject));
+}
+
+// Plain string searches are still handled as atoms.
+assertEquals("ATOM", %RegexpTypeTag(/abc/));
+
+// Patterns the experimental engine can't handle fall back to irregexp.
+assertEquals("IRREGEXP", %RegexpTypeTag(/(a)\1/));
+assertEquals("IRREGEXP", %RegexpTypeTag(/a(?=b)/));
+assertEquals("IRREGEXP", %RegexpTypeTag(/a(?<!b)/));
+assertEquals("IRREGEXP", %RegexpTypeTag(/a.b/i));
+assertEquals("IRREGEXP", %RegexpTypeTag(/a.b/u));
+
+// The experimental engine must find the same matches as a backtracking
+// engine, including the contents of captures.
+Test(/a(b|c)d/, "acd", ["acd", "c"]);
+Test(/(a|ab)(c|bcd)(d*)/, "abcd", ["abcd", "a", "bcd", ""]);
+Test(/x*?(y+)/, "xxyyy", ["xxyyy", "yyy"]);
+Test(/(a+)(a*)/, "aaa", ["aaa", "aaa", ""]);
+Test(/(a+?)(a*)/, "aaa", ["aaa", "a", "aa"]);
+Test(/a{2,3}/, "aaaa", ["aaa"]);
+Test(/(?:ab){2}/, "abababx", ["abab"]);
+Test(/^b/m, "a\nb", ["b"]);
+Test(/\bfoo\b/, "afoo foo", ["foo"]);
+Test(/[^a-c]+/, "abcdefa", ["def"]);
+Test(/(a)|b/, "b", ["b", undefined]);
+Test(/.+/s, "a\nb", ["a\nb"]);
+Test(/c$/, "abc", ["c"]);
+Test(/(z)((a+)?(b+)?(c))*/, "zaacbbbcac",
+     ["zaacbbbcac", "z", "ac", "a", undefined, "c"]);
+Test(/x[yz]/, "ሴxz", ["xz"]);
+Test(/x(y|z)/, "abc", null);
+
+// Named captures.
+let match = /(?<year>\d{4})-(?<month>\d{2})/.exec("on 2020-09");
+assertEquals("2020", match.groups.year);
+assertEquals("09", match.groups.month);
+
+// Global and sticky regexps.
+assertEquals(["1", "22", "333"], "a1b22c333".match(/\d+/g));
+assertEquals("-a-b-c-", "abc".replace(/x*/g, "-"));
+let sticky = /a+/y;
+sticky.lastIndex = 1;
+assertEquals(["aa"], sticky.exec("baab"));
+assertEquals(3, sticky.lastIndex);
+assertEquals(null, sticky.exec("baab"));
+
+// Patterns with exponential backtracking behavior complete in linear time.
+let subject = "a".repeat(100000);
+assertEquals(null, /(a*)*b/.exec(subject));
+assertEquals(null, /(a|aa)+$x/.exec(subject));
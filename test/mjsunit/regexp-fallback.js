@@ -0,0 +1,37 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax
+// Flags: --enable-experimental-regexp-engine-on-excessive-backtracks
+// Flags: --regexp-backtracks-before-fallback=50
+
+// Regexps that exceed their backtrack limit compute the match with the
+// experimental engine instead of failing.
+{
+  const re = %NewRegExpWithBacktrackLimit("(\\d+)+x", "", 50);
+  assertEquals(["3333x", "3333"], re.exec("333333333ax3333x"));
+}
+
+// Without an explicit limit, --regexp-backtracks-before-fallback applies.
+{
+  const re = /(x+x+)+y/;
+  assertEquals(["xxxxxxxxxxxxxxxxxy", "xxxxxxxxxxxxxxxxx"],
+               re.exec("xxxxxxxxxxxxxxxxxy"));
+  assertEquals(["xxxxxxxxxxy", "xxy"], "xxxxxxxxxxy xxy".match(/(x+x+)+y/g));
+}
+
+// Patterns with exponential backtracking behavior complete quickly.
+{
+  const s = "a".repeat(10000);
+  assertEquals(null, /(a*)*b/.exec(s));
+  assertEquals(null, s.match(/(a*)*b/g));
+  assertEquals(s, s.replace(/(a+)+b/g, "x"));
+}
+
+// Patterns the experimental engine can't handle still fail once they exceed
+// their limit.
+{
+  const re = %NewRegExpWithBacktrackLimit("(\\d+)+x\\1", "", 50);
+  assertEquals(null, re.exec("333333333ax3333x3333"));
+}
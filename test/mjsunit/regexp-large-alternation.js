@@ -0,0 +1,32 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Large alternations of literals are compiled into nested choices. Check that
+// this preserves the order in which alternatives are tried.
+
+const words = [];
+for (let i = 0; i < 1000; i++) words.push("w" + i.toString(36) + "x");
+
+let re = new RegExp("(" + words.join("|") + ")", "g");
+assertEquals(["w0x", "wrrx", "w2rx"], "w0x-wrrx-w2rx-w3".match(re));
+assertEquals(null, "wzzzx".match(re));
+
+re = new RegExp("^(?:" + words.join("|") + ")$", "i");
+assertTrue(re.test("W1Ax"));
+assertFalse(re.test("w1a"));
+
+// Earlier alternatives win even if later ones would match more.
+const prefixes = ["ab", "abc", "b", "bcd", "c", "cde", "d", "def", "e", "efg",
+                  "f", "fgh", "g", "ghi", "h", "hij", "i", "ijk"];
+re = new RegExp(prefixes.join("|"), "g");
+assertEquals(["ab", "c", "b", "c"], "abcbcdcdefd".match(re).slice(0, 4));
+assertEquals(["ab", "c"], "abc".match(re));
+re = new RegExp(prefixes.slice().reverse().join("|"), "g");
+assertEquals(["ijk", "hij", "abc"], "ijkhijabc".match(re));
+
+// Alternatives that are not atoms stay in place.
+re = new RegExp(words.slice(0, 20).join("|") + "|w\\d+x|" +
+                words.slice(20, 40).join("|"));
+assertEquals(["w10x"], "w10x".match(re));
+assertEquals("w1x", "w1x".match(re)[0]);
@@ -0,0 +1,32 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --regexp-simd --no-regexp-tier-up
+
+// Native regexp code scans for the leading characters of unanchored patterns
+// with SIMD instructions.  Place the match at every offset around the vector
+// size, in one-byte and two-byte subjects, to cover the vectorized loop, the
+// scalar tail and the end of the input.
+
+function Check(re, needle, filler) {
+  for (let length = 0; length < 70; length++) {
+    for (let pos = 0; pos <= length; pos++) {
+      let subject = filler.repeat(pos) + needle + filler.repeat(length - pos);
+      let match = re.exec(subject);
+      assertNotNull(match, subject);
+      assertEquals(pos, match.index, subject);
+      assertEquals(null, re.exec(filler.repeat(length)));
+    }
+  }
+}
+
+// A single leading character.
+Check(/x\d+y/, "x123y", "a");
+Check(/x\d+y/, "x123y", "ሴ");
+// Few leading characters in the skip table.
+Check(/(?:ab|cb)cdef/, "cbcdef", "z");
+Check(/(?:ab|cb)cdef/, "abcdef", "ሴ");
+// Characters that only match modulo the skip table size must not be found.
+Check(/état/, "état", "i");
+Check(/ሴስ\d/, "ሴስ7", "4");
@@ -0,0 +1,37 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --regexp-tier-up --regexp-tier-up-ticks=1 --regexp-tier-up-in-task
+// Flags: --allow-natives-syntax --no-force-slow-path --no-regexp-interpret-all
+
+const kLatin1 = true;
+const kUnicode = false;
+
+let re = new RegExp('^(a+)b$');
+assertEquals(["aab", "aa"], re.exec("aab"));
+assertTrue(%RegexpHasBytecode(re, kLatin1));
+
+// The regexp is marked for tier-up now, but keeps being interpreted until the
+// tier-up task has run.
+assertEquals(["ab", "a"], re.exec("ab"));
+assertEquals(null, re.exec("abb"));
+assertTrue(%RegexpHasBytecode(re, kLatin1));
+assertFalse(%RegexpHasNativeCode(re, kLatin1));
+
+// Encodings seen before the task runs get bytecode, too.
+assertEquals(null, re.exec("π"));
+assertTrue(%RegexpHasBytecode(re, kUnicode));
+
+// Long subjects would force a synchronous tier-up otherwise.
+assertTrue(re.test("a".repeat(2000) + "b"));
+assertFalse(%RegexpHasNativeCode(re, kLatin1));
+
+setTimeout(() => {
+  assertTrue(!%RegexpHasBytecode(re, kLatin1) &&
+             %RegexpHasNativeCode(re, kLatin1));
+  assertTrue(!%RegexpHasBytecode(re, kUnicode) &&
+             %RegexpHasNativeCode(re, kUnicode));
+  assertEquals(["aaab", "aaa"], re.exec("aaab"));
+  assertEquals(null, re.exec("πb"));
+}, 0);
@@ -0,0 +1,23 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --perf-prof --perf-prof-delete-file --allow-natives-syntax
+// Flags: --compact-code-space --stress-compaction --interpreted-frames-native-stack
+
+// Compacting GCs move logged code with --perf-prof and must be reported as
+// moves of the original load records.
+
+function inner(a, b) { return a + b; }
+function outer(x) { return inner(x, 1) * 2; }
+
+%PrepareFunctionForOptimization(outer);
+assertEquals(4, outer(1));
+assertEquals(6, outer(2));
+%OptimizeFunctionOnNextCall(outer);
+assertEquals(8, outer(3));
+
+for (let i = 0; i < 3; i++) {
+  gc();
+  assertEquals(10, outer(4));
+}
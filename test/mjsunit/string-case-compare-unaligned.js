@@ -0,0 +1,37 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Case conversion of sliced (possibly unaligned) one-byte strings.
+function slowToLower(s) {
+  let r = '';
+  for (const c of s) {
+    r += (c >= 'A' && c <= 'Z') ? String.fromCharCode(c.charCodeAt(0) + 32) : c;
+  }
+  return r;
+}
+
+const base =
+    'xYz' + 'The Quick Brown Fox Jumps Over The Lazy Dog 0123'.repeat(4);
+for (let start = 0; start < 9; start++) {
+  for (let len = 0; len < 40; len += 3) {
+    const s = base.substring(start, start + 20 + len);
+    assertEquals(slowToLower(s), s.toLowerCase());
+    assertEquals(slowToLower(s.toUpperCase()), s.toLowerCase());
+  }
+}
+// Non-ASCII characters after an aligned prefix fall back to the slow path.
+const latin1 = base.substring(1, 30) + 'Ää';
+assertEquals(latin1.substring(0, 29).toLowerCase() + 'ää',
+             latin1.toLowerCase());
+
+// Ordering of two-byte strings that share a longer common prefix.
+const prefix = 'αβγδ'.repeat(5);
+for (let i = 0; i < 12; i++) {
+  const a = prefix + 'x'.repeat(i) + 'Ā';
+  const b = prefix + 'x'.repeat(i) + 'ÿ';
+  assertTrue(a > b);
+  assertTrue(b < a);
+  assertFalse(a == b);
+  assertTrue(a == (prefix + 'x'.repeat(i) + 'Ā'));
+}
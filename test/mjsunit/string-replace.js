@@ -296,3 +296,17 @@ assertEquals(1, replace_tostring_count);
 
 "a".replace("a", fake_replacer);
 assertEquals(2, replace_tostring_count);
+
+// Global non-atom regexps with a replacement without $-patterns.
+assertEquals("-b-c-", "abaca".replace(/a/gi, "-"));
+assertEquals("x<>y<>z", "x12y345z".replace(/\d+/g, "<>"));
+assertEquals("xሴyሴz", "x12y345z".replace(/\d+/g, "ሴ"));
+assertEquals("ሴ--ሴ", "ሴabሴ".replace(/[ab]/g, "-"));
+assertEquals("-a-b-", "ab".replace(/x*/g, "-"));
+assertEquals("", "aaa".replace(/a+/g, ""));
+assertEquals("", "aaa".replace(/a/g, ""));
+let re_simple = /(\d)(\d)/g;
+assertEquals("a--b", "a1234b".replace(re_simple, "-"));
+assertEquals("3", RegExp.$1);
+assertEquals("4", RegExp.$2);
+assertEquals("34", RegExp.lastMatch);
@@ -0,0 +1,60 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Tests indexOf and includes on typed arrays with matches in and around the
+// blocks that are compared at once.
+
+const ctors = [
+  Int8Array, Uint8Array, Uint8ClampedArray, Int16Array, Uint16Array,
+  Int32Array, Uint32Array, Float32Array, Float64Array
+];
+
+for (const ctor of ctors) {
+  const length = 100;
+  for (const position of [0, 1, 7, 8, 15, 16, 31, 32, 33, 63, 64, 99]) {
+    const array = new ctor(length);
+    array[position] = 42;
+    assertEquals(position, array.indexOf(42));
+    assertTrue(array.includes(42));
+    assertEquals(position, array.indexOf(42, position));
+    assertEquals(-1, array.indexOf(42, position + 1));
+    assertFalse(array.includes(42, position + 1));
+    if (position < length - 1) {
+      array[length - 1] = 42;
+      assertEquals(length - 1, array.indexOf(42, position + 1));
+    }
+  }
+  const array = new ctor(length);
+  assertEquals(-1, array.indexOf(1));
+  assertFalse(array.includes(1));
+  assertEquals(0, array.indexOf(0));
+  assertEquals(-1, array.indexOf(0, length));
+}
+
+// Negative values in byte-sized arrays.
+const int8 = new Int8Array(40);
+int8[37] = -1;
+assertEquals(37, int8.indexOf(-1));
+assertEquals(-1, int8.indexOf(255));
+assertEquals(-1, new Uint8Array(40).indexOf(-1));
+
+// Signed zeros compare equal, NaN is only found by includes.
+const float64 = new Float64Array(40);
+float64[20] = -0;
+float64[30] = NaN;
+assertEquals(0, float64.indexOf(-0));
+assertEquals(-1, float64.indexOf(NaN));
+assertTrue(float64.includes(NaN));
+assertFalse(float64.subarray(0, 30).includes(NaN));
+
+// Array.prototype.fill on packed numeric arrays.
+const smis = [1, 2, 3, 4, 5];
+smis.fill(7, 1, 4);
+assertEquals([1, 7, 7, 7, 5], smis);
+const doubles = [1.5, 2.5, 3.5, 4.5];
+doubles.fill(0.25, 2);
+assertEquals([1.5, 2.5, 0.25, 0.25], doubles);
+const objects = [{}, {}, {}];
+objects.fill(3);
+assertEquals([3, 3, 3], objects);
@@ -0,0 +1,59 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --no-wasm-trap-handler --wasm-eliminate-redundant-bounds-checks
+
+load('test/mjsunit/wasm/wasm-module-builder.js');
+
+// Accesses at the same index are only checked once if the first check covers
+// all later offsets. Make sure that accesses which are not covered still trap.
+const builder = new WasmModuleBuilder();
+builder.addMemory(1, 1, false);
+// Loads at offsets 8 and 0, the second one is covered by the first check.
+builder.addFunction('covered', kSig_i_i)
+    .addBody([
+      kExprLocalGet, 0,
+      kExprI32LoadMem, 0, 8,
+      kExprLocalGet, 0,
+      kExprI32LoadMem, 0, 0,
+      kExprI32Add
+    ])
+    .exportFunc();
+// Loads at offsets 0 and 8, the second one needs its own check.
+builder.addFunction('uncovered', kSig_i_i)
+    .addBody([
+      kExprLocalGet, 0,
+      kExprI32LoadMem, 0, 0,
+      kExprLocalGet, 0,
+      kExprI32LoadMem, 0, 8,
+      kExprI32Add
+    ])
+    .exportFunc();
+// A store at offset 4 followed by a load at offset 4 of the same index.
+builder.addFunction('store_load', kSig_i_ii)
+    .addBody([
+      kExprLocalGet, 0,
+      kExprLocalGet, 1,
+      kExprI32StoreMem, 0, 4,
+      kExprLocalGet, 0,
+      kExprI32LoadMem, 0, 4
+    ])
+    .exportFunc();
+const instance = builder.instantiate();
+const kPageSize = 65536;
+
+assertEquals(0, instance.exports.covered(0));
+assertEquals(0, instance.exports.covered(kPageSize - 12));
+assertTraps(
+    kTrapMemOutOfBounds, () => instance.exports.covered(kPageSize - 11));
+
+assertEquals(0, instance.exports.uncovered(kPageSize - 12));
+assertTraps(
+    kTrapMemOutOfBounds, () => instance.exports.uncovered(kPageSize - 11));
+assertTraps(
+    kTrapMemOutOfBounds, () => instance.exports.uncovered(kPageSize - 4));
+
+assertEquals(17, instance.exports.store_load(kPageSize - 8, 17));
+assertTraps(
+    kTrapMemOutOfBounds, () => instance.exports.store_load(kPageSize - 7, 17));
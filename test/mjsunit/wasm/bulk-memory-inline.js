@@ -0,0 +1,83 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --experimental-wasm-bulk-memory --no-liftoff
+
+load("test/mjsunit/wasm/wasm-module-builder.js");
+
+// memory.copy and memory.fill with small constant sizes are expanded inline
+// by TurboFan. Check overlapping copies, all chunk sizes and bounds checks.
+
+function getMemoryCopy(mem, size) {
+  const builder = new WasmModuleBuilder();
+  builder.addImportedMemory("", "mem", 0);
+  builder.addFunction("copy", kSig_v_ii).addBody([
+    kExprLocalGet, 0,  // Dest.
+    kExprLocalGet, 1,  // Source.
+    ...wasmI32Const(size),
+    kNumericPrefix, kExprMemoryCopy, 0, 0,
+  ]).exportAs("copy");
+  return builder.instantiate({'': {mem}}).exports.copy;
+}
+
+function getMemoryFill(mem, size) {
+  const builder = new WasmModuleBuilder();
+  builder.addImportedMemory("", "mem", 0);
+  builder.addFunction("fill", kSig_v_ii).addBody([
+    kExprLocalGet, 0,  // Dest.
+    kExprLocalGet, 1,  // Byte value.
+    ...wasmI32Const(size),
+    kNumericPrefix, kExprMemoryFill, 0,
+  ]).exportAs("fill");
+  return builder.instantiate({'': {mem}}).exports.fill;
+}
+
+function reset(u8) {
+  for (let i = 0; i < 64; ++i) u8[i] = i;
+}
+
+(function TestInlineMemoryCopy() {
+  const mem = new WebAssembly.Memory({initial: 1});
+  const u8 = new Uint8Array(mem.buffer);
+  for (let size = 1; size <= 33; ++size) {
+    const copy = getMemoryCopy(mem, size);
+    // Overlapping forward and backward copies behave like memmove.
+    for (const [dst, src] of [[0, 3], [3, 0], [9, 9], [40, 1]]) {
+      reset(u8);
+      copy(dst, src);
+      for (let i = 0; i < 64; ++i) {
+        const expected = i >= dst && i < dst + size ? src + i - dst : i;
+        assertEquals(expected, u8[i]);
+      }
+    }
+    // Out of bounds copies trap without modifying memory.
+    reset(u8);
+    u8[kPageSize - 1] = 0xAB;
+    assertTraps(kTrapMemOutOfBounds, () => copy(kPageSize - size + 1, 0));
+    assertTraps(kTrapMemOutOfBounds, () => copy(10, kPageSize - size + 1));
+    assertEquals(10, u8[10]);
+    assertEquals(0xAB, u8[kPageSize - 1]);
+    copy(kPageSize - size, 0);
+    assertEquals(size - 1, u8[kPageSize - 1]);
+  }
+})();
+
+(function TestInlineMemoryFill() {
+  const mem = new WebAssembly.Memory({initial: 1});
+  const u8 = new Uint8Array(mem.buffer);
+  for (let size = 1; size <= 33; ++size) {
+    const fill = getMemoryFill(mem, size);
+    reset(u8);
+    // Only the low byte of the value is used.
+    fill(5, 0x1234);
+    for (let i = 0; i < 64; ++i) {
+      assertEquals(i >= 5 && i < 5 + size ? 0x34 : i, u8[i]);
+    }
+    u8[kPageSize - 1] = 0;
+    assertTraps(kTrapMemOutOfBounds, () => fill(kPageSize - size + 1, 0xFF));
+    assertEquals(0, u8[kPageSize - 1]);
+    fill(kPageSize - size, 0xFF);
+    assertEquals(0xFF, u8[kPageSize - 1]);
+  }
+})();
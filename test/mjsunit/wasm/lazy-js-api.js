@@ -0,0 +1,55 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --expose-wasm --lazy-wasm-js-api --validate-asm
+
+(function TestPropertyDescriptor() {
+  let realm = Realm.create();
+  let desc = Realm.eval(
+      realm, "Object.getOwnPropertyDescriptor(globalThis, 'WebAssembly')");
+  assertFalse(desc.enumerable);
+  assertTrue(desc.writable);
+  assertTrue(desc.configurable);
+  assertEquals('object', typeof desc.value);
+  assertSame(desc.value, Realm.eval(realm, 'WebAssembly'));
+  assertEquals('function', typeof desc.value.Module);
+})();
+
+(function TestAssignBeforeFirstAccess() {
+  let realm = Realm.create();
+  assertEquals(1, Realm.eval(realm, 'WebAssembly = 1; WebAssembly'));
+})();
+
+(function TestAccessFromOtherRealm() {
+  let realm = Realm.create();
+  let global = Realm.global(realm);
+  let module_constructor = global.WebAssembly.Module;
+  assertNotSame(WebAssembly.Module, module_constructor);
+  assertSame(module_constructor, Realm.eval(realm, 'WebAssembly.Module'));
+})();
+
+(function TestAsmJsBeforeFirstAccess() {
+  let realm = Realm.create();
+  assertEquals(23, Realm.eval(realm, `
+    function Module() {
+      'use asm';
+      function f() { return 23; }
+      return {f: f};
+    }
+    Module().f()`));
+  assertEquals('function', Realm.eval(realm, 'typeof WebAssembly.Module'));
+})();
+
+(function TestAsmJsAfterDelete() {
+  let realm = Realm.create();
+  assertEquals(42, Realm.eval(realm, `
+    delete globalThis.WebAssembly;
+    function Module() {
+      'use asm';
+      function f() { return 42; }
+      return {f: f};
+    }
+    Module().f()`));
+  assertEquals('undefined', Realm.eval(realm, 'typeof WebAssembly'));
+})();
@@ -0,0 +1,47 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --liftoff --no-wasm-tier-up --expose-gc
+
+load('test/mjsunit/wasm/wasm-module-builder.js');
+
+// Liftoff keeps the instance in a register between memory accesses. Calls,
+// stack checks and loop back edges must reload it, also after the instance
+// object was moved by a GC.
+(function testMemoryAccessesAcrossCallsAndLoops() {
+  print(arguments.callee.name);
+  const builder = new WasmModuleBuilder();
+  builder.addMemory(1, 1, false);
+  builder.exportMemoryAs('memory');
+  const gc_index = builder.addImport('m', 'gc', kSig_v_v);
+  builder.addFunction('sum', kSig_i_i)
+      .addLocals({i32_count: 1})
+      .addBody([
+        kExprLoop, kWasmStmt,
+          // acc += mem[i]
+          kExprLocalGet, 0, kExprI32Const, 4, kExprI32Mul,
+          kExprI32LoadMem, 2, 0,
+          kExprLocalGet, 1, kExprI32Add, kExprLocalSet, 1,
+          // Call out to JS every 16 iterations.
+          kExprLocalGet, 0, kExprI32Const, 15, kExprI32And, kExprI32Eqz,
+          kExprIf, kWasmStmt,
+            kExprCallFunction, gc_index,
+          kExprEnd,
+          // i -= 1, continue while i != 0
+          kExprLocalGet, 0, kExprI32Const, 1, kExprI32Sub, kExprLocalTee, 0,
+          kExprBrIf, 0,
+        kExprEnd,
+        kExprLocalGet, 1
+      ])
+      .exportFunc();
+
+  let num_gcs = 0;
+  const instance = builder.instantiate({m: {gc: () => { gc(); ++num_gcs; }}});
+  const memory = new Uint32Array(instance.exports.memory.buffer);
+  for (let i = 0; i <= 100; ++i) memory[i] = i;
+
+  assertTrue(%IsLiftoffFunction(instance.exports.sum));
+  assertEquals(5050, instance.exports.sum(100));
+  assertEquals(6, num_gcs);
+})();
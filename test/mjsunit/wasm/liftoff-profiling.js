@@ -0,0 +1,42 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --liftoff --no-wasm-tier-up
+// Flags: --wasm-liftoff-profiling
+
+load('test/mjsunit/wasm/wasm-module-builder.js');
+
+const builder = new WasmModuleBuilder();
+const imp_index = builder.addImport('m', 'imp', kSig_v_v);
+builder.addFunction('noop', kSig_v_v).addBody([]).exportFunc();
+// Loops {n} times and returns 0.
+builder.addFunction('countdown', kSig_i_i)
+    .addBody([
+      kExprLoop, kWasmStmt,                                // loop
+      kExprLocalGet, 0, kExprI32Const, 1, kExprI32Sub,    // n - 1
+      kExprLocalTee, 0,                                    // n = n - 1
+      kExprBrIf, 0,                                        // br_if n != 0
+      kExprEnd,                                            // end
+      kExprLocalGet, 0                                     // n
+    ])
+    .exportFunc();
+
+const instance = builder.instantiate({m: {imp: () => {}}});
+const noop_index = imp_index + 1;
+const countdown_index = imp_index + 2;
+
+assertEquals([0, 0], %WasmGetLiftoffProfile(instance, noop_index));
+assertEquals([0, 0], %WasmGetLiftoffProfile(instance, countdown_index));
+
+for (let i = 0; i < 3; ++i) instance.exports.noop();
+assertEquals([3, 0], %WasmGetLiftoffProfile(instance, noop_index));
+
+assertEquals(0, instance.exports.countdown(10));
+assertEquals(0, instance.exports.countdown(5));
+assertEquals([2, 15], %WasmGetLiftoffProfile(instance, countdown_index));
+
+// Counters are shared by all instances of the module.
+const instance2 = builder.instantiate({m: {imp: () => {}}});
+instance2.exports.noop();
+assertEquals([4, 0], %WasmGetLiftoffProfile(instance, noop_index));
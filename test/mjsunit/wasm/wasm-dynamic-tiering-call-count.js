@@ -0,0 +1,30 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --wasm-dynamic-tiering --liftoff
+// Flags: --wasm-tier-up --wasm-tier-up-call-count=2 --no-stress-opt
+
+load('test/mjsunit/wasm/wasm-module-builder.js');
+
+const builder = new WasmModuleBuilder();
+builder.addFunction('f0', kSig_i_v).addBody(wasmI32Const(0)).exportAs('f0');
+builder.addFunction('f1', kSig_i_v).addBody(wasmI32Const(1)).exportAs('f1');
+
+let instance = builder.instantiate();
+
+// With dynamic tiering, no function is eagerly tiered up even though
+// --wasm-tier-up is set.
+instance.exports.f1();
+assertTrue(%IsLiftoffFunction(instance.exports.f0));
+assertTrue(%IsLiftoffFunction(instance.exports.f1));
+
+instance.exports.f1();
+
+// Busy waiting until the function is tiered up.
+while (true) {
+  if (!%IsLiftoffFunction(instance.exports.f1)) {
+    break;
+  }
+}
+assertTrue(%IsLiftoffFunction(instance.exports.f0));
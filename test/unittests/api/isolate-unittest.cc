@@ -135,4 +135,49 @@ TEST_F(IncumbentContextTest, Basic) {
   }
 }
 
+TEST(IsolatePoolTest, AcquireWithContext) {
+  std::unique_ptr<ArrayBuffer::Allocator> allocator(
+      ArrayBuffer::Allocator::NewDefaultAllocator());
+  Isolate::CreateParams create_params;
+  create_params.array_buffer_allocator = allocator.get();
+
+  IsolatePool pool(create_params, 2);
+  for (int i = 0; i < 4; i++) {
+    Global<Context> global_context;
+    Isolate* isolate = pool.Acquire(&global_context);
+    ASSERT_NE(nullptr, isolate);
+    ASSERT_FALSE(global_context.IsEmpty());
+    {
+      Isolate::Scope isolate_scope(isolate);
+      HandleScope handle_scope(isolate);
+      Local<Context> context = global_context.Get(isolate);
+      Context::Scope context_scope(context);
+      Local<Value> result =
+          Script::Compile(context,
+                          String::NewFromUtf8Literal(isolate, "6 * 7"))
+              .ToLocalChecked()
+              ->Run(context)
+              .ToLocalChecked();
+      EXPECT_EQ(42, result->Int32Value(context).FromJust());
+    }
+    global_context.Reset();
+    isolate->Dispose();
+  }
+  EXPECT_LE(pool.ReadyCount(), 2u);
+}
+
+TEST(IsolatePoolTest, DisposeWithPendingIsolates) {
+  std::unique_ptr<ArrayBuffer::Allocator> allocator(
+      ArrayBuffer::Allocator::NewDefaultAllocator());
+  Isolate::CreateParams create_params;
+  create_params.array_buffer_allocator = allocator.get();
+
+  // Destroying the pool right away waits for the isolates that are still
+  // being created and disposes them.
+  IsolatePool pool(create_params, 4, false);
+  Isolate* isolate = pool.Acquire();
+  ASSERT_NE(nullptr, isolate);
+  isolate->Dispose();
+}
+
 }  // namespace v8
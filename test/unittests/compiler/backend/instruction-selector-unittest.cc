@@ -638,6 +638,14 @@ class InstructionSelectorShuffleTest : public ::testing::Test {
   static bool TryMatchBlend(const Shuffle& shuffle) {
     return InstructionSelector::TryMatchBlendForTesting(&shuffle[0]);
   }
+  static bool TryMatchByteShiftRight(const Shuffle& shuffle, uint8_t* shift) {
+    return InstructionSelector::TryMatchByteShiftRightForTesting(&shuffle[0],
+                                                                 shift);
+  }
+  static bool TryMatchByteShiftLeft(const Shuffle& shuffle, uint8_t* shift) {
+    return InstructionSelector::TryMatchByteShiftLeftForTesting(&shuffle[0],
+                                                                shift);
+  }
 };
 
 bool operator==(const InstructionSelectorShuffleTest::Shuffle& a,
@@ -841,6 +849,46 @@ TEST_F(InstructionSelectorShuffleTest, TryMatchBlend) {
       {{1, 17, 2, 19, 4, 21, 6, 23, 8, 25, 10, 27, 12, 29, 14, 31}}));
 }
 
+TEST_F(InstructionSelectorShuffleTest, TryMatchByteShiftRight) {
+  uint8_t shift;
+  // Ascending indices from the first input, then any lane of the second.
+  EXPECT_TRUE(TryMatchByteShiftRight(
+      {{4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19}}, &shift));
+  EXPECT_EQ(4, shift);
+  EXPECT_TRUE(TryMatchByteShiftRight(
+      {{15, 31, 30, 29, 28, 27, 26, 25, 24, 23, 22, 21, 20, 19, 18, 17}},
+      &shift));
+  EXPECT_EQ(15, shift);
+
+  // Shuffles that should not match:
+  // The identity.
+  EXPECT_FALSE(TryMatchByteShiftRight(
+      {{0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15}}, &shift));
+  // Wrapping around to the first input.
+  EXPECT_FALSE(TryMatchByteShiftRight(
+      {{4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 0, 1, 2, 3}}, &shift));
+}
+
+TEST_F(InstructionSelectorShuffleTest, TryMatchByteShiftLeft) {
+  uint8_t shift;
+  // Any lanes of the first input, then ascending indices from the second.
+  EXPECT_TRUE(TryMatchByteShiftLeft(
+      {{0, 0, 0, 0, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27}}, &shift));
+  EXPECT_EQ(4, shift);
+  EXPECT_TRUE(TryMatchByteShiftLeft(
+      {{3, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30}},
+      &shift));
+  EXPECT_EQ(1, shift);
+
+  // Shuffles that should not match:
+  // The second input is not taken from its start.
+  EXPECT_FALSE(TryMatchByteShiftLeft(
+      {{0, 0, 0, 0, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28}}, &shift));
+  // Only lanes of the first input.
+  EXPECT_FALSE(TryMatchByteShiftLeft(
+      {{0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15}}, &shift));
+}
+
 }  // namespace compiler
 }  // namespace internal
 }  // namespace v8
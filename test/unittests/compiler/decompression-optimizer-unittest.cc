@@ -223,6 +223,39 @@ TEST_F(DecompressionOptimizerTest, Word32SarSmiUntag) {
   EXPECT_EQ(LoadMachRep(load), CompressedMachRep(MachineType::AnyTagged()));
 }
 
+TEST_F(DecompressionOptimizerTest, Word32BinopsTwoDecompresses) {
+  // Define variables.
+  Node* const control = graph()->start();
+  Node* object = Parameter(Type::Any(), 0);
+  Node* effect = graph()->start();
+  Node* index = Parameter(Type::UnsignedSmall(), 1);
+
+  const Operator* const binops[] = {
+      machine()->Int32Add(),  machine()->Int32AddWithOverflow(),
+      machine()->Int32Sub(),  machine()->Int32SubWithOverflow(),
+      machine()->Int32Mul(),  machine()->Int32MulWithOverflow(),
+      machine()->Word32Or(),  machine()->Word32Xor(),
+      machine()->Word32Sar(), machine()->Word32Shr()};
+
+  // Test for both AnyTagged and TaggedPointer, for all the binops.
+  for (size_t i = 0; i < arraysize(types); ++i) {
+    for (size_t j = 0; j < arraysize(binops); ++j) {
+      // Create the graph.
+      Node* load_1 = graph()->NewNode(machine()->Load(types[i]), object, index,
+                                      effect, control);
+      Node* load_2 = graph()->NewNode(machine()->Load(types[i]), object, index,
+                                      effect, control);
+      Node* binop = graph()->NewNode(binops[j], load_1, load_2);
+      graph()->SetEnd(binop);
+
+      // Change the nodes, and test the change.
+      Reduce();
+      EXPECT_EQ(LoadMachRep(load_1), CompressedMachRep(types[i]));
+      EXPECT_EQ(LoadMachRep(load_2), CompressedMachRep(types[i]));
+    }
+  }
+}
+
 // -----------------------------------------------------------------------------
 // FrameState and TypedStateValues interaction.
 
@@ -6,6 +6,7 @@
 
 #include "src/codegen/code-factory.h"
 #include "src/compiler/access-builder.h"
+#include "src/compiler/compilation-dependencies.h"
 #include "src/compiler/js-graph.h"
 #include "src/compiler/js-heap-copy-reducer.h"
 #include "src/compiler/js-operator.h"
@@ -52,7 +53,8 @@ class JSTypedLoweringTest : public TypedGraphTest {
                     &machine);
     // TODO(titzer): mock the GraphReducer here for better unit testing.
     GraphReducer graph_reducer(zone(), graph(), tick_counter());
-    JSTypedLowering reducer(&graph_reducer, &jsgraph, broker(), zone());
+    CompilationDependencies deps(broker(), zone());
+    JSTypedLowering reducer(&graph_reducer, &jsgraph, broker(), &deps, zone());
     return reducer.Reduce(node);
   }
 
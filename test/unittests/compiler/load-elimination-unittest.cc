@@ -4,6 +4,7 @@
 
 #include "src/compiler/load-elimination.h"
 #include "src/compiler/access-builder.h"
+#include "src/compiler/compilation-dependencies.h"
 #include "src/compiler/js-graph.h"
 #include "src/compiler/node.h"
 #include "src/compiler/simplified-operator.h"
@@ -24,17 +25,19 @@ class LoadEliminationTest : public TypedGraphTest {
   LoadEliminationTest()
       : TypedGraphTest(3),
         simplified_(zone()),
-        jsgraph_(isolate(), graph(), common(), nullptr, simplified(), nullptr) {
-  }
+        jsgraph_(isolate(), graph(), common(), nullptr, simplified(), nullptr),
+        deps_(broker(), zone()) {}
   ~LoadEliminationTest() override = default;
 
  protected:
+  CompilationDependencies* deps() { return &deps_; }
   JSGraph* jsgraph() { return &jsgraph_; }
   SimplifiedOperatorBuilder* simplified() { return &simplified_; }
 
  private:
   SimplifiedOperatorBuilder simplified_;
   JSGraph jsgraph_;
+  CompilationDependencies deps_;
 };
 
 TEST_F(LoadEliminationTest, LoadElementAndLoadElement) {
@@ -46,7 +49,8 @@ TEST_F(LoadEliminationTest, LoadElementAndLoadElement) {
                                 MachineType::AnyTagged(), kNoWriteBarrier};
 
   StrictMock<MockAdvancedReducerEditor> editor;
-  LoadElimination load_elimination(&editor, jsgraph(), zone());
+  LoadElimination load_elimination(&editor, deps(), jsgraph(), broker(),
+                                   zone());
 
   load_elimination.Reduce(graph()->start());
 
@@ -72,7 +76,8 @@ TEST_F(LoadEliminationTest, StoreElementAndLoadElement) {
                                 MachineType::AnyTagged(), kNoWriteBarrier};
 
   StrictMock<MockAdvancedReducerEditor> editor;
-  LoadElimination load_elimination(&editor, jsgraph(), zone());
+  LoadElimination load_elimination(&editor, deps(), jsgraph(), broker(),
+                                   zone());
 
   load_elimination.Reduce(graph()->start());
 
@@ -99,7 +104,8 @@ TEST_F(LoadEliminationTest, StoreElementAndStoreFieldAndLoadElement) {
                                 MachineType::AnyTagged(), kNoWriteBarrier};
 
   StrictMock<MockAdvancedReducerEditor> editor;
-  LoadElimination load_elimination(&editor, jsgraph(), zone());
+  LoadElimination load_elimination(&editor, deps(), jsgraph(), broker(),
+                                   zone());
 
   load_elimination.Reduce(graph()->start());
 
@@ -131,7 +137,8 @@ TEST_F(LoadEliminationTest, LoadFieldAndLoadField) {
                               kNoWriteBarrier};
 
   StrictMock<MockAdvancedReducerEditor> editor;
-  LoadElimination load_elimination(&editor, jsgraph(), zone());
+  LoadElimination load_elimination(&editor, deps(), jsgraph(), broker(),
+                                   zone());
 
   load_elimination.Reduce(graph()->start());
 
@@ -158,7 +165,8 @@ TEST_F(LoadEliminationTest, StoreFieldAndLoadField) {
                         kNoWriteBarrier};
 
   StrictMock<MockAdvancedReducerEditor> editor;
-  LoadElimination load_elimination(&editor, jsgraph(), zone());
+  LoadElimination load_elimination(&editor, deps(), jsgraph(), broker(),
+                                   zone());
 
   load_elimination.Reduce(graph()->start());
 
@@ -192,7 +200,8 @@ TEST_F(LoadEliminationTest, StoreFieldAndKillFields) {
                          kNoWriteBarrier};
 
   StrictMock<MockAdvancedReducerEditor> editor;
-  LoadElimination load_elimination(&editor, jsgraph(), zone());
+  LoadElimination load_elimination(&editor, deps(), jsgraph(), broker(),
+                                   zone());
 
   load_elimination.Reduce(graph()->start());
 
@@ -226,7 +235,8 @@ TEST_F(LoadEliminationTest, StoreFieldAndStoreElementAndLoadField) {
                         kNoWriteBarrier};
 
   StrictMock<MockAdvancedReducerEditor> editor;
-  LoadElimination load_elimination(&editor, jsgraph(), zone());
+  LoadElimination load_elimination(&editor, deps(), jsgraph(), broker(),
+                                   zone());
 
   load_elimination.Reduce(graph()->start());
 
@@ -257,7 +267,8 @@ TEST_F(LoadEliminationTest, LoadElementOnTrueBranchOfDiamond) {
                                 MachineType::AnyTagged(), kNoWriteBarrier};
 
   StrictMock<MockAdvancedReducerEditor> editor;
-  LoadElimination load_elimination(&editor, jsgraph(), zone());
+  LoadElimination load_elimination(&editor, deps(), jsgraph(), broker(),
+                                   zone());
 
   load_elimination.Reduce(graph()->start());
 
@@ -292,7 +303,8 @@ TEST_F(LoadEliminationTest, LoadElementOnFalseBranchOfDiamond) {
                                 MachineType::AnyTagged(), kNoWriteBarrier};
 
   StrictMock<MockAdvancedReducerEditor> editor;
-  LoadElimination load_elimination(&editor, jsgraph(), zone());
+  LoadElimination load_elimination(&editor, deps(), jsgraph(), broker(),
+                                   zone());
 
   load_elimination.Reduce(graph()->start());
 
@@ -328,7 +340,8 @@ TEST_F(LoadEliminationTest, LoadFieldOnFalseBranchOfDiamond) {
                               kNoWriteBarrier};
 
   StrictMock<MockAdvancedReducerEditor> editor;
-  LoadElimination load_elimination(&editor, jsgraph(), zone());
+  LoadElimination load_elimination(&editor, deps(), jsgraph(), broker(),
+                                   zone());
 
   load_elimination.Reduce(graph()->start());
 
@@ -364,7 +377,8 @@ TEST_F(LoadEliminationTest, LoadFieldOnTrueBranchOfDiamond) {
                               kNoWriteBarrier};
 
   StrictMock<MockAdvancedReducerEditor> editor;
-  LoadElimination load_elimination(&editor, jsgraph(), zone());
+  LoadElimination load_elimination(&editor, deps(), jsgraph(), broker(),
+                                   zone());
 
   load_elimination.Reduce(graph()->start());
 
@@ -400,7 +414,8 @@ TEST_F(LoadEliminationTest, LoadFieldWithTypeMismatch) {
                               kNoWriteBarrier};
 
   StrictMock<MockAdvancedReducerEditor> editor;
-  LoadElimination load_elimination(&editor, jsgraph(), zone());
+  LoadElimination load_elimination(&editor, deps(), jsgraph(), broker(),
+                                   zone());
 
   load_elimination.Reduce(graph()->start());
 
@@ -426,7 +441,8 @@ TEST_F(LoadEliminationTest, LoadElementWithTypeMismatch) {
                                 MachineType::AnyTagged(), kNoWriteBarrier};
 
   StrictMock<MockAdvancedReducerEditor> editor;
-  LoadElimination load_elimination(&editor, jsgraph(), zone());
+  LoadElimination load_elimination(&editor, deps(), jsgraph(), broker(),
+                                   zone());
 
   load_elimination.Reduce(graph()->start());
 
@@ -452,7 +468,8 @@ TEST_F(LoadEliminationTest, AliasAnalysisForFinishRegion) {
                               kNoWriteBarrier};
 
   StrictMock<MockAdvancedReducerEditor> editor;
-  LoadElimination load_elimination(&editor, jsgraph(), zone());
+  LoadElimination load_elimination(&editor, deps(), jsgraph(), broker(),
+                                   zone());
 
   load_elimination.Reduce(effect);
 
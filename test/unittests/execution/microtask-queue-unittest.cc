@@ -189,6 +189,51 @@ TEST_P(MicrotaskQueueTest, BufferGrowth) {
   EXPECT_EQ(MicrotaskQueue::kMinimumCapacity + 2, count);
 }
 
+// Running a limited number of Microtasks leaves the rest in the queue.
+TEST_P(MicrotaskQueueTest, RunWithLimit) {
+  int count = 0;
+  for (int i = 0; i < 3; ++i) {
+    microtask_queue()->EnqueueMicrotask(*NewMicrotask([&count] { count++; }));
+  }
+  EXPECT_EQ(2, microtask_queue()->RunMicrotasks(isolate(), 2));
+  EXPECT_EQ(2, count);
+  EXPECT_EQ(1, microtask_queue()->size());
+  EXPECT_EQ(1, microtask_queue()->RunMicrotasks(isolate()));
+  EXPECT_EQ(3, count);
+  EXPECT_EQ(0, microtask_queue()->size());
+}
+
+// Microtasks enqueued while running count towards the budget.
+TEST_P(MicrotaskQueueTest, PerformCheckpointWithBudget) {
+  int count = 0;
+  std::function<void()> chain = [&] {
+    count++;
+    microtask_queue()->EnqueueMicrotask(*NewMicrotask(chain));
+  };
+  microtask_queue()->EnqueueMicrotask(*NewMicrotask(chain));
+
+  EXPECT_FALSE(
+      microtask_queue()->PerformCheckpointWithBudget(v8_isolate(), 100, 1e9));
+  EXPECT_EQ(100, count);
+  EXPECT_EQ(1, microtask_queue()->size());
+
+  // A zero time budget still runs the first batch.
+  EXPECT_FALSE(
+      microtask_queue()->PerformCheckpointWithBudget(v8_isolate(), 1000, 0));
+  EXPECT_LT(100, count);
+  EXPECT_GT(1100, count);
+
+  // Draining the queue reports completion. The pending link of the chain
+  // enqueues one last Microtask that doesn't continue it.
+  int start = count;
+  chain = [&count] { count++; };
+  microtask_queue()->EnqueueMicrotask(*NewMicrotask([&count] { count++; }));
+  EXPECT_TRUE(
+      microtask_queue()->PerformCheckpointWithBudget(v8_isolate(), 10, 1e9));
+  EXPECT_EQ(start + 3, count);
+  EXPECT_EQ(0, microtask_queue()->size());
+}
+
 // MicrotaskQueue instances form a doubly linked list.
 TEST_P(MicrotaskQueueTest, InstanceChain) {
   ClearTestMicrotaskQueue();
@@ -316,5 +316,35 @@ TEST_F(ConcurrentSweeperTest, IncrementalSweeping) {
   FinishSweeping();
 }
 
+TEST_F(ConcurrentSweeperTest, SweepOnAllocation) {
+  testing::TestPlatform::DisableBackgroundTasksScope disable_concurrent_sweeper(
+      &GetPlatform());
+
+  auto* unmarked_normal_object =
+      MakeGarbageCollected<NormalFinalizable>(GetAllocationHandle());
+  // Keep the page alive so that sweeping it yields free list entries.
+  auto* marked_normal_object =
+      MakeGarbageCollected<NormalFinalizable>(GetAllocationHandle());
+  HeapObjectHeader::FromPayload(marked_normal_object).TryMarkAtomic();
+  MakeGarbageCollected<LargeFinalizable>(GetAllocationHandle());
+  const auto* page = BasePage::FromPayload(unmarked_normal_object);
+  ASSERT_EQ(page, BasePage::FromPayload(marked_normal_object));
+
+  StartSweeping();
+
+  EXPECT_EQ(0u, g_destructor_callcount);
+
+  // The space's free list is empty, so allocation sweeps the unswept page
+  // instead of finishing sweeping or adding a new page.
+  auto* new_object =
+      MakeGarbageCollected<NormalFinalizable>(GetAllocationHandle());
+  EXPECT_EQ(page, BasePage::FromPayload(new_object));
+  // Only the normal page was swept; the large object is still pending.
+  EXPECT_EQ(1u, g_destructor_callcount);
+
+  FinishSweeping();
+  EXPECT_EQ(2u, g_destructor_callcount);
+}
+
 }  // namespace internal
 }  // namespace cppgc
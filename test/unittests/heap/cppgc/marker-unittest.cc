@@ -184,7 +184,7 @@ TEST_F(MarkerTest, DeepHierarchyIsMarked) {
     parent = parent->child();
   }
   DoMarking(MarkingConfig::StackState::kNoHeapPointers);
-  EXPECT_TRUE(HeapObjectHeader::FromPayload(root).IsMarked());
+  EXPECT_TRUE(HeapObjectHeader::FromPayload(root.Get()).IsMarked());
   parent = root;
   for (int i = 0; i < kHierarchyDepth; ++i) {
     EXPECT_TRUE(HeapObjectHeader::FromPayload(parent->child()).IsMarked());
@@ -198,7 +198,7 @@ TEST_F(MarkerTest, NestedObjectsOnStackAreMarked) {
   root->SetChild(MakeGarbageCollected<GCed>(GetAllocationHandle()));
   root->child()->SetChild(MakeGarbageCollected<GCed>(GetAllocationHandle()));
   DoMarking(MarkingConfig::StackState::kMayContainHeapPointers);
-  EXPECT_TRUE(HeapObjectHeader::FromPayload(root).IsMarked());
+  EXPECT_TRUE(HeapObjectHeader::FromPayload(root.Get()).IsMarked());
   EXPECT_TRUE(HeapObjectHeader::FromPayload(root->child()).IsMarked());
   EXPECT_TRUE(HeapObjectHeader::FromPayload(root->child()->child()).IsMarked());
 }
@@ -261,5 +261,21 @@ TEST_F(MarkerTest, SentinelNotClearedOnWeakPersistentHandling) {
   EXPECT_EQ(kSentinelPointer, root->weak_child());
 }
 
+TEST_F(MarkerTest, IncrementalMarkingTaskMarksReachableObjects) {
+  Persistent<GCed> root = MakeGarbageCollected<GCed>(GetAllocationHandle());
+  root->SetChild(MakeGarbageCollected<GCed>(GetAllocationHandle()));
+  Marker marker(Heap::From(GetHeap())->AsBase());
+  static const Marker::MarkingConfig config = {
+      MarkingConfig::CollectionType::kMajor,
+      MarkingConfig::StackState::kNoHeapPointers,
+      MarkingConfig::MarkingType::kIncremental};
+  marker.StartMarking(config);
+  EXPECT_TRUE(HeapObjectHeader::FromPayload(root.Get()).IsMarked());
+  EXPECT_FALSE(HeapObjectHeader::FromPayload(root->child()).IsMarked());
+  GetPlatform().WaitAllForegroundTasks();
+  EXPECT_TRUE(HeapObjectHeader::FromPayload(root->child()).IsMarked());
+  marker.FinishMarking(config);
+}
+
 }  // namespace internal
 }  // namespace cppgc
@@ -233,6 +233,28 @@ TYPED_TEST(MinorGCTestForType, OmitGenerationalBarrierForSentinels) {
   old->next = static_cast<Type*>(kSentinelPointer);
   EXPECT_EQ(set_size_before_barrier, set.size());
 }
+
+TYPED_TEST(MinorGCTestForType, ClearedRememberedSlotIsIgnored) {
+  using Type = typename TestFixture::Type;
+
+  Persistent<Type> old =
+      MakeGarbageCollected<Type>(this->GetAllocationHandle());
+
+  TestFixture::CollectMinor();
+  EXPECT_FALSE(HeapObjectHeader::FromPayload(old.Get()).IsYoung());
+
+  const auto& set = Heap::From(this->GetHeap())->remembered_slots();
+  old->next = MakeGarbageCollected<Type>(this->GetAllocationHandle());
+  EXPECT_EQ(1u, set.count(&old->next));
+
+  // Clearing the slot does not remove it from the remembered set.
+  old->next = static_cast<Type*>(nullptr);
+  EXPECT_EQ(1u, set.count(&old->next));
+
+  TestFixture::CollectMinor();
+  EXPECT_EQ(1u, TestFixture::DestructedObjects());
+  EXPECT_TRUE(set.empty());
+}
 }  // namespace internal
 }  // namespace cppgc
 
@@ -40,7 +40,8 @@ class SweeperTest : public testing::TestWithHeap {
  public:
   SweeperTest() { g_destructor_callcount = 0; }
 
-  void Sweep() {
+  void Sweep(Sweeper::FreeMemoryHandling free_memory_handling =
+                 Sweeper::FreeMemoryHandling::kDoNotDiscard) {
     Heap* heap = Heap::From(GetHeap());
     ResetLinearAllocationBuffers();
     Sweeper& sweeper = heap->sweeper();
@@ -48,7 +49,7 @@ class SweeperTest : public testing::TestWithHeap {
     // methods are called in the right order.
     heap->stats_collector()->NotifyMarkingStarted();
     heap->stats_collector()->NotifyMarkingCompleted(0);
-    sweeper.Start(Sweeper::Config::kAtomic);
+    sweeper.Start(Sweeper::Config::kAtomic, free_memory_handling);
     sweeper.Finish();
   }
 
@@ -211,6 +212,42 @@ TEST_F(SweeperTest, CoalesceFreeListEntries) {
   EXPECT_TRUE(freelist.Contains(coalesced_block));
 }
 
+TEST_F(SweeperTest, DiscardingFreeMemoryKeepsFreeListEntries) {
+  constexpr size_t kObjectSize = 512;
+  // Enough dead objects to cover several commit pages.
+  constexpr size_t kNumberOfDeadObjects = 64;
+  using Type = GCed<kObjectSize>;
+
+  auto* first = MakeGarbageCollected<Type>(GetAllocationHandle());
+  Type* dead = nullptr;
+  for (size_t i = 0; i < kNumberOfDeadObjects; ++i) {
+    auto* object = MakeGarbageCollected<Type>(GetAllocationHandle());
+    if (!dead) dead = object;
+  }
+  auto* last = MakeGarbageCollected<Type>(GetAllocationHandle());
+
+  MarkObject(first);
+  MarkObject(last);
+
+  Address dead_start =
+      reinterpret_cast<Address>(&HeapObjectHeader::FromPayload(dead));
+  Address dead_end =
+      reinterpret_cast<Address>(&HeapObjectHeader::FromPayload(last));
+  const BasePage* page = BasePage::FromPayload(dead);
+  ASSERT_EQ(page, BasePage::FromPayload(last));
+  const FreeList& freelist = NormalPageSpace::From(page->space())->free_list();
+
+  Sweep(Sweeper::FreeMemoryHandling::kDiscardWherePossible);
+
+  EXPECT_EQ(kNumberOfDeadObjects, g_destructor_callcount);
+  EXPECT_TRUE(freelist.Contains(
+      {dead_start, static_cast<size_t>(dead_end - dead_start)}));
+  // Discarded memory must be usable for subsequent allocations.
+  for (size_t i = 0; i < kNumberOfDeadObjects; ++i) {
+    EXPECT_NE(nullptr, MakeGarbageCollected<Type>(GetAllocationHandle()));
+  }
+}
+
 namespace {
 
 class GCInDestructor final : public GarbageCollected<GCInDestructor> {
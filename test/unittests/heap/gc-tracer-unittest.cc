@@ -5,6 +5,7 @@
 #include <cmath>
 #include <limits>
 
+#include "include/v8-metrics.h"
 #include "src/base/platform/platform.h"
 #include "src/common/globals.h"
 #include "src/execution/isolate.h"
@@ -437,6 +438,87 @@ TEST_F(GCTracerTest, BackgroundMajorMCScope) {
               .scopes[GCTracer::Scope::MC_BACKGROUND_EVACUATE_UPDATE_POINTERS]);
 }
 
+namespace {
+
+class GCMetricsRecorder : public v8::metrics::Recorder {
+ public:
+  std::vector<v8::metrics::GarbageCollectionFullCycle> full_cycles_;
+  std::vector<v8::metrics::GarbageCollectionYoungCycle> young_cycles_;
+  using BatchedIncrementalMark =
+      v8::metrics::GarbageCollectionFullMainThreadBatchedIncrementalMark;
+  std::vector<BatchedIncrementalMark> incremental_marks_;
+
+  void AddThreadSafeEvent(
+      const v8::metrics::GarbageCollectionFullCycle& event) override {
+    full_cycles_.push_back(event);
+  }
+  void AddThreadSafeEvent(
+      const v8::metrics::GarbageCollectionYoungCycle& event) override {
+    young_cycles_.push_back(event);
+  }
+  void AddThreadSafeEvent(const BatchedIncrementalMark& event) override {
+    incremental_marks_.push_back(event);
+  }
+};
+
+}  // namespace
+
+TEST_F(GCTracerTest, MetricsRecorderEvents) {
+  std::shared_ptr<GCMetricsRecorder> recorder =
+      std::make_shared<GCMetricsRecorder>();
+  isolate()->SetMetricsRecorder(recorder);
+  GCTracer* tracer = i_isolate()->heap()->tracer();
+  tracer->ResetForTesting();
+
+  tracer->Start(SCAVENGER, GarbageCollectionReason::kTesting,
+                "collector unittest");
+  tracer->AddBackgroundScopeSample(
+      GCTracer::BackgroundScope::SCAVENGER_BACKGROUND_SCAVENGE_PARALLEL, 10);
+  tracer->Stop(SCAVENGER);
+  ASSERT_EQ(1u, recorder->young_cycles_.size());
+  EXPECT_STREQ("testing", recorder->young_cycles_[0].reason);
+  EXPECT_FALSE(recorder->young_cycles_[0].minor_mark_compactor);
+  EXPECT_EQ(10000,
+            recorder->young_cycles_[0].background_wall_clock_duration_in_us);
+  EXPECT_TRUE(recorder->full_cycles_.empty());
+
+  // Incremental marking steps are batched.
+  const size_t kBatchSize = GCTracer::kMaxBatchedIncrementalMarkEvents;
+  const size_t kSteps = kBatchSize + 2;
+  for (size_t i = 0; i < kSteps; i++) {
+    tracer->AddIncrementalMarkingStep(1, 1000);
+  }
+  ASSERT_EQ(1u, recorder->incremental_marks_.size());
+  EXPECT_EQ(kBatchSize, recorder->incremental_marks_[0].events.size());
+  EXPECT_EQ(1000, recorder->incremental_marks_[0]
+                      .events[0]
+                      .wall_clock_duration_in_us);
+  EXPECT_EQ(1000u, recorder->incremental_marks_[0].events[0].bytes_marked);
+
+  // The remaining steps are flushed before the full cycle is reported.
+  tracer->Start(MARK_COMPACTOR, GarbageCollectionReason::kTesting,
+                "collector unittest");
+  tracer->current_.type = GCTracer::Event::INCREMENTAL_MARK_COMPACTOR;
+  tracer->AddScopeSample(GCTracer::Scope::MC_MARK, 5);
+  tracer->AddBackgroundScopeSample(
+      GCTracer::BackgroundScope::MC_BACKGROUND_MARKING, 20);
+  tracer->AddCompactionEvent(1, 4096);
+  tracer->Stop(MARK_COMPACTOR);
+  ASSERT_EQ(2u, recorder->incremental_marks_.size());
+  EXPECT_EQ(2u, recorder->incremental_marks_[1].events.size());
+  ASSERT_EQ(1u, recorder->full_cycles_.size());
+  const v8::metrics::GarbageCollectionFullCycle& full =
+      recorder->full_cycles_[0];
+  EXPECT_TRUE(full.incremental);
+  EXPECT_EQ(static_cast<int64_t>(kSteps * 1000),
+            full.main_thread_incremental_wall_clock_duration_in_us);
+  EXPECT_EQ(5000,
+            full.main_thread_atomic_phases.mark_wall_clock_duration_in_us);
+  EXPECT_EQ(20000, full.background_phases.mark_wall_clock_duration_in_us);
+  EXPECT_EQ(-1, full.background_phases.weak_wall_clock_duration_in_us);
+  EXPECT_EQ(4096u, full.bytes_compacted);
+}
+
 class ThreadWithBackgroundScope final : public base::Thread {
  public:
   explicit ThreadWithBackgroundScope(GCTracer* tracer)
@@ -4,7 +4,9 @@
 
 #include <limits>
 #include <map>
+#include <memory>
 
+#include "src/base/platform/platform.h"
 #include "src/common/globals.h"
 #include "src/heap/slot-set.h"
 #include "src/heap/spaces.h"
@@ -75,6 +77,48 @@ TEST(SlotSet, InsertAndLookup2) {
   SlotSet::Delete(set, SlotSet::kBucketsRegularPage);
 }
 
+namespace {
+
+class SlotInsertingThread final : public base::Thread {
+ public:
+  SlotInsertingThread(SlotSet* set, int offset, int stride)
+      : base::Thread(Options("SlotInsertingThread")),
+        set_(set),
+        offset_(offset),
+        stride_(stride) {}
+
+  void Run() final {
+    for (int i = offset_; i < Page::kPageSize; i += stride_) {
+      set_->Insert<AccessMode::ATOMIC>(i);
+    }
+  }
+
+ private:
+  SlotSet* const set_;
+  const int offset_;
+  const int stride_;
+};
+
+}  // namespace
+
+TEST(SlotSet, InsertConcurrently) {
+  const int kThreads = 4;
+  SlotSet* set = SlotSet::Allocate(SlotSet::kBucketsRegularPage);
+  std::unique_ptr<SlotInsertingThread> threads[kThreads];
+  for (int i = 0; i < kThreads; i++) {
+    threads[i] = std::make_unique<SlotInsertingThread>(set, i * kTaggedSize,
+                                                       kThreads * kTaggedSize);
+    CHECK(threads[i]->Start());
+  }
+  for (int i = 0; i < kThreads; i++) {
+    threads[i]->Join();
+  }
+  for (int i = 0; i < Page::kPageSize; i += kTaggedSize) {
+    EXPECT_TRUE(set->Lookup(i));
+  }
+  SlotSet::Delete(set, SlotSet::kBucketsRegularPage);
+}
+
 TEST(SlotSet, Iterate) {
   SlotSet* set = SlotSet::Allocate(SlotSet::kBucketsRegularPage);
 
@@ -180,6 +224,21 @@ TEST(PossiblyEmptyBuckets, ContainsAndInsert) {
   EXPECT_TRUE(possibly_empty_buckets.Contains(last + 1));
 }
 
+TEST(PossiblyEmptyBuckets, AllocateForConcurrentInsert) {
+  static const int kBuckets = 4 * PossiblyEmptyBuckets::kBucketsPerWord;
+  PossiblyEmptyBuckets possibly_empty_buckets;
+  possibly_empty_buckets.Insert(1, kBuckets);
+  possibly_empty_buckets.AllocateForConcurrentInsert(kBuckets);
+  // Buckets inserted before allocation are preserved.
+  EXPECT_TRUE(possibly_empty_buckets.Contains(1));
+  EXPECT_FALSE(possibly_empty_buckets.IsEmpty());
+  possibly_empty_buckets.Insert(kBuckets - 1, kBuckets);
+  EXPECT_TRUE(possibly_empty_buckets.Contains(kBuckets - 1));
+  EXPECT_FALSE(possibly_empty_buckets.Contains(0));
+  possibly_empty_buckets.Release();
+  EXPECT_TRUE(possibly_empty_buckets.IsEmpty());
+}
+
 void CheckRemoveRangeOn(uint32_t start, uint32_t end) {
   SlotSet* set = SlotSet::Allocate(SlotSet::kBucketsRegularPage);
   uint32_t first = start == 0 ? 0 : start - kTaggedSize;
@@ -7,6 +7,7 @@
 #include "include/cppgc/platform.h"
 #include "src/api/api-inl.h"
 #include "src/heap/cppgc-js/cpp-heap.h"
+#include "src/heap/embedder-tracing.h"
 #include "src/objects/objects-inl.h"
 #include "test/unittests/heap/heap-utils.h"
 
@@ -96,5 +97,30 @@ TEST_F(UnifiedHeapTest, FindingV8ToBlinkReference) {
   EXPECT_EQ(1u, Wrappable::destructor_callcount);
 }
 
+namespace {
+
+class LargeWrappable final : public cppgc::GarbageCollected<LargeWrappable> {
+ public:
+  void Trace(cppgc::Visitor* visitor) const {}
+
+ private:
+  char payload_[1024];
+};
+
+}  // namespace
+
+TEST_F(UnifiedHeapTest, CppHeapAllocationsAreReportedToV8) {
+  LocalEmbedderHeapTracer* tracer = heap()->local_embedder_heap_tracer();
+  const size_t used_size_before = tracer->used_size();
+  for (int i = 0; i < 256; ++i) {
+    cppgc::MakeGarbageCollected<LargeWrappable>(allocation_handle());
+  }
+  EXPECT_LT(used_size_before, tracer->used_size());
+  CollectGarbage(OLD_SPACE);
+  // None of the objects are reachable, so V8's view of the C++ heap is reset
+  // to the (empty) live size after marking.
+  EXPECT_GT(256 * sizeof(LargeWrappable), tracer->used_size());
+}
+
 }  // namespace internal
 }  // namespace v8
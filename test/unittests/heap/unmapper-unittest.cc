@@ -334,6 +334,37 @@ TEST_F(SequentialUnmapperTest, UnmapOnTeardown) {
     tracking_page_allocator()->CheckIsFree(page->address(), page_size);
   }
 }
+
+TEST_F(SequentialUnmapperTest, ReusePooledLargePage) {
+  const int old_pool_size = i::FLAG_large_page_pool_size;
+  i::FLAG_large_page_pool_size = 16;
+  const size_t object_size = 2 * MB;
+  LargePage* page = allocator()->AllocateLargePage(
+      object_size, heap()->lo_space(), Executability::NOT_EXECUTABLE);
+  EXPECT_NE(nullptr, page);
+  const Address address = page->address();
+  const size_t reserved_size = page->reserved_memory()->size();
+  allocator()->Free<MemoryAllocator::kPreFreeAndQueue>(page);
+  unmapper()->FreeQueuedChunks();
+  tracking_page_allocator()->CheckPagePermissions(address, reserved_size,
+                                                  PageAllocator::kNoAccess);
+  EXPECT_EQ(reserved_size, unmapper()->PooledLargeChunksSize());
+
+  // An allocation of the same size reuses the pooled reservation.
+  page = allocator()->AllocateLargePage(object_size, heap()->lo_space(),
+                                        Executability::NOT_EXECUTABLE);
+  EXPECT_EQ(address, page->address());
+  EXPECT_EQ(0u, unmapper()->PooledLargeChunksSize());
+  tracking_page_allocator()->CheckPagePermissions(address, reserved_size,
+                                                  PageAllocator::kReadWrite);
+
+  allocator()->Free<MemoryAllocator::kPreFreeAndQueue>(page);
+  unmapper()->FreeQueuedChunks();
+  EXPECT_EQ(reserved_size, unmapper()->PooledLargeChunksSize());
+  unmapper()->TearDown();
+  EXPECT_EQ(0u, unmapper()->PooledLargeChunksSize());
+  i::FLAG_large_page_pool_size = old_pool_size;
+}
 #endif  // V8_SHARED_RO_HEAP
 
 }  // namespace internal
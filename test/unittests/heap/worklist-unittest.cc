@@ -271,6 +271,28 @@ TEST(WorkListTest, SingleSegmentSteal) {
   EXPECT_EQ(0U, worklist.GlobalPoolSize());
 }
 
+TEST(WorkListTest, StealStats) {
+  TestWorklist worklist;
+  TestWorklist::View worklist_view1(&worklist, 0);
+  TestWorklist::View worklist_view2(&worklist, 1);
+  SomeObject dummy;
+  for (size_t i = 0; i < TestWorklist::kSegmentCapacity; i++) {
+    EXPECT_TRUE(worklist_view1.Push(&dummy));
+  }
+  worklist_view1.FlushToGlobal();
+  EXPECT_EQ(1U, worklist_view1.PublishedSegments());
+  EXPECT_EQ(0U, worklist_view2.StolenSegments());
+  SomeObject* retrieved = nullptr;
+  while (worklist_view2.Pop(&retrieved)) {
+  }
+  EXPECT_EQ(1U, worklist_view2.StolenSegments());
+  EXPECT_EQ(0U, worklist_view1.StolenSegments());
+  worklist.ResetStats();
+  EXPECT_EQ(0U, worklist_view1.PublishedSegments());
+  EXPECT_EQ(0U, worklist_view2.StolenSegments());
+  EXPECT_TRUE(worklist.IsEmpty());
+}
+
 TEST(WorkListTest, MultipleSegmentsStolen) {
   TestWorklist worklist;
   TestWorklist::View worklist_view1(&worklist, 0);
@@ -11,6 +11,7 @@
 #include "src/base/platform/platform.h"
 #include "src/base/platform/semaphore.h"
 #include "src/base/platform/time.h"
+#include "src/base/sys-info.h"
 #include "testing/gtest-support.h"
 
 namespace v8 {
@@ -59,6 +60,46 @@ TEST(DefaultWorkerThreadsTaskRunnerUnittest, PostTaskOrder) {
   ASSERT_EQ(3, order[2]);
 }
 
+TEST(DefaultWorkerThreadsTaskRunnerUnittest, PostTaskWithPriorityOrder) {
+  DefaultWorkerThreadsTaskRunner runner(1, RealTime);
+
+  std::vector<int> order;
+  base::Semaphore blocker_started(0);
+  base::Semaphore unblock(0);
+  base::Semaphore done(0);
+
+  // Keep the only worker busy until all other tasks are posted.
+  runner.PostTask(std::make_unique<TestTask>([&] {
+    blocker_started.Signal();
+    unblock.Wait();
+  }));
+  blocker_started.Wait();
+
+  runner.PostTaskWithPriority(
+      std::make_unique<TestTask>([&] {
+        order.push_back(5);
+        done.Signal();
+      }),
+      TaskPriority::kBestEffort);
+  runner.PostTaskWithPriority(
+      std::make_unique<TestTask>([&] { order.push_back(3); }),
+      TaskPriority::kUserVisible);
+  runner.PostTaskWithPriority(
+      std::make_unique<TestTask>([&] { order.push_back(1); }),
+      TaskPriority::kUserBlocking);
+  runner.PostTask(std::make_unique<TestTask>([&] { order.push_back(4); }));
+  runner.PostTaskWithPriority(
+      std::make_unique<TestTask>([&] { order.push_back(2); }),
+      TaskPriority::kUserBlocking);
+
+  unblock.Signal();
+  done.Wait();
+
+  runner.Terminate();
+  ASSERT_EQ(5UL, order.size());
+  for (int i = 0; i < 5; i++) ASSERT_EQ(i + 1, order[i]);
+}
+
 TEST(DefaultWorkerThreadsTaskRunnerUnittest, PostTaskOrderMultipleWorkers) {
   DefaultWorkerThreadsTaskRunner runner(4, RealTime);
 
@@ -275,5 +316,25 @@ TEST(DefaultWorkerThreadsTaskRunnerUnittest, NoIdleTasks) {
   runner.Terminate();
 }
 
+TEST(DefaultWorkerThreadsTaskRunnerUnittest, SetWorkerThreadAffinity) {
+  DefaultWorkerThreadsTaskRunner runner(2, RealTime);
+
+  ASSERT_FALSE(runner.SetWorkerThreadAffinity({}));
+
+  // Whether restricting the threads succeeds depends on the operating system,
+  // but tasks have to keep running either way.
+  std::vector<int> all_processors;
+  for (int i = 0; i < base::SysInfo::NumberOfProcessors(); i++) {
+    all_processors.push_back(i);
+  }
+  runner.SetWorkerThreadAffinity({all_processors});
+
+  base::Semaphore semaphore(0);
+  runner.PostTask(std::make_unique<TestTask>([&] { semaphore.Signal(); }));
+  semaphore.Wait();
+
+  runner.Terminate();
+}
+
 }  // namespace platform
 }  // namespace v8
@@ -65,12 +65,30 @@ TEST_F(BackingStoreTest, CopyWasmMemory) {
   EXPECT_EQ(1 * wasm::kWasmPageSize, bs1->byte_length());
   EXPECT_EQ(2 * wasm::kWasmPageSize, bs1->byte_capacity());
 
-  auto bs2 = bs1->CopyWasmMemory(isolate(), 3);
+  auto bs2 = bs1->CopyWasmMemory(isolate(), 3, 3);
   EXPECT_TRUE(bs2->is_wasm_memory());
   EXPECT_EQ(3 * wasm::kWasmPageSize, bs2->byte_length());
   EXPECT_EQ(3 * wasm::kWasmPageSize, bs2->byte_capacity());
 }
 
+TEST_F(BackingStoreTest, CopyWasmMemoryReservesCapacity) {
+  auto bs1 =
+      BackingStore::AllocateWasmMemory(isolate(), 1, 1, SharedFlag::kNotShared);
+  CHECK(bs1);
+  EXPECT_EQ(1 * wasm::kWasmPageSize, bs1->byte_capacity());
+
+  auto bs2 = bs1->CopyWasmMemory(isolate(), 2, 4);
+  CHECK(bs2);
+  EXPECT_EQ(2 * wasm::kWasmPageSize, bs2->byte_length());
+  EXPECT_EQ(4 * wasm::kWasmPageSize, bs2->byte_capacity());
+
+  // The copy can now be grown in place up to the reserved capacity.
+  base::Optional<size_t> result = bs2->GrowWasmMemoryInPlace(isolate(), 2, 4);
+  EXPECT_TRUE(result.has_value());
+  EXPECT_EQ(result.value(), 2u);
+  EXPECT_EQ(4 * wasm::kWasmPageSize, bs2->byte_length());
+}
+
 class GrowerThread : public base::Thread {
  public:
   GrowerThread(Isolate* isolate, uint32_t increment, uint32_t max,
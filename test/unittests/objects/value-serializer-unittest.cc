@@ -871,6 +871,83 @@ TEST_F(ValueSerializerTest, RoundTripDictionaryObjectForTransitions) {
       ",{\"\xF0\x9F\x91\x8A\":5,\"\xF0\x9F\x91\x9B\":6}]");
 }
 
+TEST_F(ValueSerializerTest, RoundTripShapedObjects) {
+  // Keys of objects with the same map are only written once.
+  std::vector<uint8_t> data = EncodeTest(
+      "[{alpha: 1, beta: 'x'}, {alpha: 2, beta: 'y'}, {alpha: 3, beta: 'z'}]");
+  std::string encoded(data.begin(), data.end());
+  EXPECT_EQ(encoded.find("alpha"), encoded.rfind("alpha"));
+  EXPECT_EQ(encoded.find("beta"), encoded.rfind("beta"));
+  Local<Value> value = DecodeTest(data);
+  ASSERT_TRUE(value->IsArray());
+  ExpectScriptTrue("result.length === 3");
+  ExpectScriptTrue("result.map(o => o.alpha).toString() === '1,2,3'");
+  ExpectScriptTrue("result.map(o => o.beta).join('') === 'xyz'");
+  ExpectScriptTrue(
+      "Object.getOwnPropertyNames(result[2]).toString() === 'alpha,beta'");
+
+  // Field representations which don't match the first object.
+  RoundTripJSON(
+      "[{\"a\":1,\"b\":2}"
+      ",{\"a\":1.5,\"b\":{}}"
+      ",{\"a\":\"s\",\"b\":3}]");
+
+  // Shapes only contain the enumerable string keys.
+  value = RoundTripTest(
+      "var make = () => {"
+      "  var o = {a: 1, [Symbol()]: 2};"
+      "  Object.defineProperty(o, 'b', {value: 3, enumerable: false});"
+      "  o.c = 4;"
+      "  return o;"
+      "};"
+      "[make(), make()];");
+  ExpectScriptTrue(
+      "Object.getOwnPropertyNames(result[1]).toString() === 'a,c'");
+
+  // Properties deleted while serializing are skipped.
+  value = RoundTripTest(
+      "var o = {a: {get x() { delete o.b; return 1; }}, b: 2};"
+      "o;");
+  ExpectScriptTrue("!('b' in result)");
+  ExpectScriptTrue("result.a.x === 1");
+}
+
+TEST_F(ValueSerializerTest, DecodeShapedObjects) {
+  // Two objects sharing the shape ['a'].
+  Local<Value> value =
+      DecodeTest({0xFF, 0x0E, 0x41, 0x02, 0x4F, 0x00, 0x01, 0x22, 0x01, 0x61,
+                  0x49, 0x02, 0x4F, 0x00, 0x49, 0x04, 0x24, 0x00, 0x02});
+  ASSERT_TRUE(value->IsArray());
+  ExpectScriptTrue("result.length === 2");
+  ExpectScriptTrue("result[0].a === 1");
+  ExpectScriptTrue("result[1].a === 2");
+
+  // A hole skips the corresponding key.
+  value = DecodeTest({0xFF, 0x0E, 0x4F, 0x00, 0x02, 0x22, 0x01, 0x61, 0x22,
+                      0x01, 0x62, 0x2D, 0x49, 0x02});
+  ASSERT_TRUE(value->IsObject());
+  ExpectScriptTrue("Object.getOwnPropertyNames(result).toString() === 'b'");
+  ExpectScriptTrue("result.b === 1");
+
+  // Self references resolve to the object being read.
+  value = DecodeTest({0xFF, 0x0E, 0x4F, 0x00, 0x01, 0x22, 0x04, 0x73, 0x65,
+                      0x6C, 0x66, 0x5E, 0x00});
+  ExpectScriptTrue("result === result.self");
+}
+
+TEST_F(ValueSerializerTest, InvalidDecodeShapedObjects) {
+  // Shape IDs must refer to earlier shapes, or define the next one.
+  InvalidDecodeTest({0xFF, 0x0E, 0x4F, 0x01, 0x01, 0x22, 0x01, 0x61, 0x49,
+                     0x02});
+  // Keys must be strings.
+  InvalidDecodeTest({0xFF, 0x0E, 0x4F, 0x00, 0x01, 0x49, 0x02, 0x49, 0x02});
+  // Keys must be unique.
+  InvalidDecodeTest({0xFF, 0x0E, 0x4F, 0x00, 0x02, 0x22, 0x01, 0x61, 0x22,
+                     0x01, 0x61, 0x49, 0x02, 0x49, 0x04});
+  // The number of keys must fit into the remaining data.
+  InvalidDecodeTest({0xFF, 0x0E, 0x4F, 0x00, 0x7F, 0x22, 0x01, 0x61});
+}
+
 TEST_F(ValueSerializerTest, DecodeDictionaryObjectVersion0) {
   // Empty object.
   Local<Value> value = DecodeTestForVersion0({0x7B, 0x00});
@@ -2692,6 +2769,106 @@ TEST_F(ValueSerializerTestWithWasm, ComplexObjectWithManyTransfer) {
   ExpectScriptTrue("result.mod1 != result.mod2");
 }
 
+class ValueSerializerTestWithExternalStringTransfer
+    : public ValueSerializerTest {
+ protected:
+  class StaticOneByteResource : public String::ExternalOneByteStringResource {
+   public:
+    explicit StaticOneByteResource(const char* data)
+        : data_(data), length_(strlen(data)) {}
+    const char* data() const override { return data_; }
+    size_t length() const override { return length_; }
+    void Dispose() override {}
+
+   private:
+    const char* data_;
+    size_t length_;
+  };
+
+// GMock doesn't use the "override" keyword.
+#if __clang__
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Winconsistent-missing-override"
+#endif
+
+  class SerializerDelegate : public ValueSerializer::Delegate {
+   public:
+    MOCK_METHOD(Maybe<uint32_t>, GetExternalStringTransferId,
+                (Isolate*, Local<String> string), (override));
+    void ThrowDataCloneError(Local<String> message) override {}
+  };
+
+  class DeserializerDelegate : public ValueDeserializer::Delegate {
+   public:
+    MOCK_METHOD(MaybeLocal<String>, GetExternalStringFromId,
+                (Isolate*, uint32_t id), (override));
+  };
+
+#if __clang__
+#pragma clang diagnostic pop
+#endif
+
+  ValueSerializer::Delegate* GetSerializerDelegate() override {
+    return &serializer_delegate_;
+  }
+
+  ValueDeserializer::Delegate* GetDeserializerDelegate() override {
+    return &deserializer_delegate_;
+  }
+
+  Local<String> NewExternalString(Local<Context> context,
+                                  StaticOneByteResource* resource) {
+    Context::Scope scope(context);
+    return String::NewExternalOneByte(isolate(), resource).ToLocalChecked();
+  }
+
+  SerializerDelegate serializer_delegate_;
+  DeserializerDelegate deserializer_delegate_;
+};
+
+TEST_F(ValueSerializerTestWithExternalStringTransfer, RoundTripTransfer) {
+  static StaticOneByteResource input_resource("shared payload");
+  static StaticOneByteResource output_resource("shared payload");
+  Local<String> input =
+      NewExternalString(serialization_context(), &input_resource);
+  Local<String> output =
+      NewExternalString(deserialization_context(), &output_resource);
+
+  EXPECT_CALL(serializer_delegate_,
+              GetExternalStringTransferId(isolate(), input))
+      .WillRepeatedly(Return(Just(7U)));
+  EXPECT_CALL(deserializer_delegate_, GetExternalStringFromId(isolate(), 7U))
+      .WillRepeatedly(Return(output));
+
+  // Only the tag and the transfer ID follow the header.
+  std::vector<uint8_t> encoded = EncodeTest(input);
+  ASSERT_LE(2u, encoded.size());
+  EXPECT_EQ('E', encoded[encoded.size() - 2]);
+  EXPECT_EQ(7, encoded[encoded.size() - 1]);
+
+  Local<Value> value = DecodeTest(encoded);
+  ASSERT_TRUE(value->IsString());
+  EXPECT_TRUE(value.As<String>()->IsExternalOneByte());
+  EXPECT_EQ(&output_resource,
+            value.As<String>()->GetExternalOneByteStringResource());
+  ExpectScriptTrue("result === 'shared payload'");
+}
+
+TEST_F(ValueSerializerTestWithExternalStringTransfer, CopyWithoutTransferId) {
+  static StaticOneByteResource resource("copied payload");
+  Local<String> input = NewExternalString(serialization_context(), &resource);
+
+  EXPECT_CALL(serializer_delegate_,
+              GetExternalStringTransferId(isolate(), input))
+      .WillRepeatedly(Return(Nothing<uint32_t>()));
+  EXPECT_CALL(deserializer_delegate_, GetExternalStringFromId(_, _)).Times(0);
+
+  Local<Value> value = RoundTripTest(input);
+  ASSERT_TRUE(value->IsString());
+  EXPECT_FALSE(value.As<String>()->IsExternal());
+  ExpectScriptTrue("result === 'copied payload'");
+}
+
 class ValueSerializerTestWithLimitedMemory : public ValueSerializerTest {
  protected:
 // GMock doesn't use the "override" keyword.
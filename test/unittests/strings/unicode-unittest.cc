@@ -493,5 +493,49 @@ TEST(UnicodeTest, IncrementalUTF8DecodingVsNonIncrementalUtf8Decoding) {
   }
 }
 
+TEST(UnicodeTest, AsciiRunsBetweenMultiByteSequences) {
+  // Long ASCII runs after the first non-ASCII character are skipped a word
+  // at a time; make sure that agrees with decoding byte by byte, including
+  // around incomplete and invalid sequences.
+  const std::vector<byte> prefixes[] = {
+      {0xC3, 0xA4}, {0xE2, 0x82, 0xAC}, {0xF0, 0x9F, 0x98, 0x80},
+      {0xE2, 0x82}, {0xFF},             {0xC3}};
+  for (const std::vector<byte>& prefix : prefixes) {
+    for (size_t run = 0; run < 3 * sizeof(uintptr_t); run++) {
+      std::vector<byte> bytes(prefix);
+      for (size_t i = 0; i < run; i++) bytes.push_back('a' + i % 26);
+      bytes.push_back(0xC3);
+      bytes.push_back(0xBF);
+      for (size_t i = 0; i < run; i++) bytes.push_back('0' + i % 10);
+
+      std::vector<unibrow::uchar> expected;
+      DecodeIncrementally(bytes, &expected);
+
+      std::vector<unibrow::uchar> output_utf16;
+      DecodeUtf16(bytes, &output_utf16);
+      CHECK_EQ(expected.size(), output_utf16.size());
+      for (size_t i = 0; i < expected.size(); ++i) {
+        CHECK_EQ(expected[i], output_utf16[i]);
+      }
+
+      auto utf8_data = Vector<const uint8_t>::cast(VectorOf(bytes));
+      Utf8Decoder decoder(utf8_data);
+      size_t expected_utf16_length = 0;
+      for (unibrow::uchar c : expected) {
+        expected_utf16_length +=
+            c > unibrow::Utf16::kMaxNonSurrogateCharCode ? 2 : 1;
+      }
+      CHECK_EQ(expected_utf16_length, decoder.utf16_length());
+      if (decoder.is_one_byte()) {
+        std::vector<uint8_t> latin1(decoder.utf16_length());
+        decoder.Decode(latin1.data(), utf8_data);
+        for (size_t i = 0; i < expected.size(); ++i) {
+          CHECK_EQ(expected[i], latin1[i]);
+        }
+      }
+    }
+  }
+}
+
 }  // namespace internal
 }  // namespace v8
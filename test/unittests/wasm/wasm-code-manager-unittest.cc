@@ -105,6 +105,15 @@ TEST_F(DisjointAllocationPoolTest, ExtractExact) {
   CheckRange(b, {10, 5});
 }
 
+TEST_F(DisjointAllocationPoolTest, ExtractInRegionReportsContainingRegion) {
+  DisjointAllocationPool a = Make({{1, 4}, {10, 10}});
+  base::AddressRegion containing_region;
+  base::AddressRegion b = a.AllocateInRegion(3, {12, 8}, &containing_region);
+  CheckRange(b, {12, 3});
+  CheckRange(containing_region, {10, 10});
+  CheckPool(a, {{1, 4}, {10, 2}, {15, 5}});
+}
+
 TEST_F(DisjointAllocationPoolTest, Merging) {
   DisjointAllocationPool a = Make({{10, 5}, {20, 5}});
   a.Merge({15, 5});
@@ -0,0 +1,79 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/zone/zone-compression.h"
+
+#include <type_traits>
+
+#include "src/zone/accounting-allocator.h"
+#include "src/zone/zone-type-traits.h"
+#include "src/zone/zone.h"
+#include "testing/gtest/include/gtest/gtest.h"
+
+namespace v8 {
+namespace internal {
+
+#ifdef V8_COMPRESS_ZONES
+
+namespace {
+
+struct ZoneCompressionTestObject {
+  CompressedZonePtr<ZoneCompressionTestObject> next;
+  int value = 0;
+};
+
+}  // namespace
+
+TEST(ZoneCompression, CompressDecompress) {
+  AccountingAllocator allocator;
+  Zone zone(&allocator, ZONE_NAME, true);
+  ASSERT_TRUE(zone.supports_compression());
+
+  int* first = zone.New<int>(1);
+  int* second = zone.New<int>(2);
+  uint32_t compressed = ZoneCompression::Compress(first);
+  EXPECT_NE(0u, compressed);
+  EXPECT_EQ(reinterpret_cast<Address>(first),
+            ZoneCompression::Decompress(second, compressed));
+  EXPECT_EQ(0u, ZoneCompression::Compress(nullptr));
+  EXPECT_EQ(kNullAddress, ZoneCompression::Decompress(second, 0));
+  EXPECT_TRUE(ZoneCompression::CheckSameBase(first, second));
+}
+
+TEST(ZoneCompression, CompressedZonePtr) {
+  AccountingAllocator allocator;
+  Zone zone(&allocator, ZONE_NAME, true);
+  ASSERT_EQ(kUInt32Size, sizeof(CompressedZonePtr<int>));
+
+  ZoneCompressionTestObject* a = zone.New<ZoneCompressionTestObject>();
+  ZoneCompressionTestObject* b = zone.New<ZoneCompressionTestObject>();
+  b->value = 42;
+  EXPECT_TRUE(a->next == nullptr);
+
+  a->next = b;
+  EXPECT_TRUE(a->next == b);
+  EXPECT_FALSE(a->next != b);
+  EXPECT_EQ(b, static_cast<ZoneCompressionTestObject*>(a->next));
+  EXPECT_EQ(42, a->next->value);
+
+  // Copies between compressed pointers in the same zone keep the target.
+  b->next = a->next;
+  EXPECT_TRUE(b->next == a->next);
+  EXPECT_EQ(b, static_cast<ZoneCompressionTestObject*>(b->next));
+
+  a->next = nullptr;
+  EXPECT_TRUE(a->next == nullptr);
+  EXPECT_EQ(nullptr, static_cast<ZoneCompressionTestObject*>(a->next));
+}
+
+#endif  // V8_COMPRESS_ZONES
+
+TEST(ZoneCompression, ZoneTypeTraits) {
+  static_assert(
+      std::is_same<ZoneTypeTraits<false>::Ptr<int>, int*>::value,
+      "uncompressed zone pointers are full pointers");
+}
+
+}  // namespace internal
+}  // namespace v8
@@ -0,0 +1,51 @@
+#!/usr/bin/env python
+
+# Copyright 2020 the V8 project authors. All rights reserved.
+# Use of this source code is governed by a BSD-style license that can be found
+# in the LICENSE file.
+
+# Extracts the compilation hints printed by d8 with
+#   --wasm-print-compilation-hints --wasm-lazy-compilation
+#   --wasm-dynamic-tiering
+# into a binary hints file for inject-compilation-hints.py.
+
+import argparse
+import io
+import sys
+
+PREFIX = "[wasm-compilation-hints] "
+
+def parse_args():
+  parser = argparse.ArgumentParser(\
+      description="Extract compilation hints from a d8 profiling run.")
+  parser.add_argument("-i", "--in-log-file", \
+      type=str, \
+      help="output of the profiling run")
+  parser.add_argument("-o", "--out-hints-file", \
+      type=str, required=True, \
+      help="binary hints file to be passed to inject-compilation-hints.py")
+  parser.add_argument("-n", "--num-functions", \
+      type=int, \
+      help="only consider modules with this many declared functions")
+  return parser.parse_args()
+
+if __name__ == "__main__":
+  args = parse_args()
+  in_log_file = args.in_log_file if args.in_log_file else sys.stdin.fileno()
+  hints = None
+  with io.open(in_log_file, "r") as fin:
+    for line in fin:
+      if not line.startswith(PREFIX):
+        continue
+      fields = line[len(PREFIX):].split()
+      num_functions = fields[0]
+      hex_hints = fields[1] if len(fields) > 1 else ""
+      if args.num_functions is not None and \
+          int(num_functions) != args.num_functions:
+        continue
+      # Use the last matching module.
+      hints = bytearray.fromhex(hex_hints)
+      assert len(hints) == int(num_functions), "malformed hints"
+  assert hints is not None, "no compilation hints found"
+  with io.open(args.out_hints_file, "wb") as fout:
+    fout.write(hints)
@@ -23,6 +23,10 @@ export class Isolate {
     this.zonePeakMemory = Object.create(null);
     // Peak memory consumed by a single zone.
     this.singleZonePeakMemory = 0;
+
+    // Segment pool counters of the last sample, they only ever grow.
+    this.poolHits = 0;
+    this.poolMisses = 0;
   }
 
   finalize() {
@@ -36,6 +40,11 @@ export class Isolate {
     let label = `${this.address}: `;
     label += ` peak=${formatBytes(this.peakAllocatedMemory)}`;
     label += ` time=[${this.start}, ${this.end}] ms`;
+    const poolRequests = this.poolHits + this.poolMisses;
+    if (poolRequests > 0) {
+      const hitRate = (100 * this.poolHits / poolRequests).toFixed(1);
+      label += ` segment pool hits=${hitRate}%`;
+    }
     return label;
   }
 
@@ -54,6 +63,12 @@ export class Isolate {
       this.peakAllocatedMemory = allocated;
     }
 
+    // Traces of older V8 versions don't have segment pool counters.
+    if (sample.pool_hits !== undefined) {
+      this.poolHits = Math.max(this.poolHits, sample.pool_hits);
+      this.poolMisses = Math.max(this.poolMisses, sample.pool_misses);
+    }
+
     const sample_zones = sample.zones;
     if (sample_zones !== undefined) {
       sample.zones.forEach((zone_sample, zone_name) => {
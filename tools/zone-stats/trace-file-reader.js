@@ -169,6 +169,9 @@ defineCustomElement('trace-file-reader', (templateText) =>
       allocated: entry_stats.allocated,
       used: entry_stats.used,
       freed: entry_stats.freed,
+      pooled: entry_stats.pooled,
+      pool_hits: entry_stats.pool_hits,
+      pool_misses: entry_stats.pool_misses,
       zones: zones
     };
     isolate_data.samples.set(time, sample);